@@ -262,20 +262,34 @@ class Atom {
     { _x_avail=false; _q_avail=false; _quat_avail=false; _v_avail=false; _resized=false; }
 
   /// Cast positions and types to write buffer
-  inline void cast_x_data(double **host_ptr, const int *host_type) {
+  /** If type_cached is true, the type lanes left in the buffer by the
+    * previous cast are reused; only valid when the atom ordering has not
+    * changed since that cast, i.e. no reneighboring has occurred **/
+  inline void cast_x_data(double **host_ptr, const int *host_type,
+                          const bool type_cached=false) {
     if (_x_avail==false) {
       double t=MPI_Wtime();
       #ifdef GPU_CAST
       memcpy(host_x_cast.begin(),host_ptr[0],_nall*3*sizeof(double));
-      memcpy(host_type_cast.begin(),host_type,_nall*sizeof(int));
+      if (!type_cached)
+        memcpy(host_type_cast.begin(),host_type,_nall*sizeof(int));
       #else
       int wl=0;
-      for (int i=0; i<_nall; i++) {
-        x[wl]=host_ptr[i][0];
-        x[wl+1]=host_ptr[i][1];
-        x[wl+2]=host_ptr[i][2];
-        x[wl+3]=host_type[i];
-        wl+=4;
+      if (type_cached) {
+        for (int i=0; i<_nall; i++) {
+          x[wl]=host_ptr[i][0];
+          x[wl+1]=host_ptr[i][1];
+          x[wl+2]=host_ptr[i][2];
+          wl+=4;
+        }
+      } else {
+        for (int i=0; i<_nall; i++) {
+          x[wl]=host_ptr[i][0];
+          x[wl+1]=host_ptr[i][1];
+          x[wl+2]=host_ptr[i][2];
+          x[wl+3]=host_type[i];
+          wl+=4;
+        }
       }
       #endif
       _time_cast+=MPI_Wtime()-t;
@@ -283,13 +297,15 @@ class Atom {
   }
 
   /// Copy positions and types to device asynchronously
-  /** Copies nall() elements **/
-  inline void add_x_data(double **host_ptr, int *host_type) {
+  /** Copies nall() elements; type transfer is skipped when type_cached **/
+  inline void add_x_data(double **host_ptr, int *host_type,
+                         const bool type_cached=false) {
     time_pos.start();
     if (_x_avail==false) {
       #ifdef GPU_CAST
       x_cast.update_device(_nall*3,true);
-      type_cast.update_device(_nall,true);
+      if (!type_cached)
+        type_cast.update_device(_nall,true);
       int block_size=64;
       int GX=static_cast<int>(ceil(static_cast<double>(_nall)/block_size));
       k_cast_x.set_size(GX,block_size);
@@ -363,20 +379,35 @@ class Atom {
   }
 
   /// Cast velocities and tags to write buffer
-  inline void cast_v_data(double **host_ptr, const tagint *host_tag) {
+  /// Cast velocities and tags to write buffer
+  /** If tag_cached is true, the tag lanes left in the buffer by the
+    * previous cast are reused; only valid when the atom ordering has not
+    * changed since that cast, i.e. no reneighboring has occurred **/
+  inline void cast_v_data(double **host_ptr, const tagint *host_tag,
+                          const bool tag_cached=false) {
     if (_v_avail==false) {
       double t=MPI_Wtime();
       #ifdef GPU_CAST
       memcpy(host_v_cast.begin(),host_ptr[0],_nall*3*sizeof(double));
-      memcpy(host_tag_cast.begin(),host_tag,_nall*sizeof(int));
+      if (!tag_cached)
+        memcpy(host_tag_cast.begin(),host_tag,_nall*sizeof(int));
       #else
       int wl=0;
-      for (int i=0; i<_nall; i++) {
-        v[wl]=host_ptr[i][0];
-        v[wl+1]=host_ptr[i][1];
-        v[wl+2]=host_ptr[i][2];
-        v[wl+3]=host_tag[i];
-        wl+=4;
+      if (tag_cached) {
+        for (int i=0; i<_nall; i++) {
+          v[wl]=host_ptr[i][0];
+          v[wl+1]=host_ptr[i][1];
+          v[wl+2]=host_ptr[i][2];
+          wl+=4;
+        }
+      } else {
+        for (int i=0; i<_nall; i++) {
+          v[wl]=host_ptr[i][0];
+          v[wl+1]=host_ptr[i][1];
+          v[wl+2]=host_ptr[i][2];
+          v[wl+3]=host_tag[i];
+          wl+=4;
+        }
       }
       #endif
       _time_cast+=MPI_Wtime()-t;
@@ -384,13 +415,15 @@ class Atom {
   }
 
   /// Copy velocities and tags to device asynchronously
-  /** Copies nall() elements **/
-  inline void add_v_data(double **host_ptr, tagint *host_tag) {
+  /** Copies nall() elements; tag transfer is skipped when tag_cached **/
+  inline void add_v_data(double **host_ptr, tagint *host_tag,
+                         const bool tag_cached=false) {
     time_vel.start();
     if (_v_avail==false) {
       #ifdef GPU_CAST
       v_cast.update_device(_nall*3,true);
-      tag_cast.update_device(_nall,true);
+      if (!tag_cached)
+        tag_cast.update_device(_nall,true);
       int block_size=64;
       int GX=static_cast<int>(ceil(static_cast<double>(_nall)/block_size));
       k_cast_x.set_size(GX,block_size);
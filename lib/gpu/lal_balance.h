@@ -185,11 +185,17 @@ void BalanceT::balance(const double cpu_time) {
                                    cpu_time_per_atom);
 
     double split=static_cast<double>(_inum_full-host_inum)/_inum_full;
-    _desired_split=split*_HD_BALANCE_GAP;
-    if (_desired_split>1.0)
-      _desired_split=1.0;
-    if (_desired_split<0.0)
-      _desired_split=0.0;
+    split*=_HD_BALANCE_GAP;
+    if (split>1.0)
+      split=1.0;
+    if (split<0.0)
+      split=0.0;
+
+    // damp the controller so a single noisy measurement cannot swing
+    // the split; relaxes toward each new estimate at the weight rate
+
+    _desired_split=_HD_BALANCE_WEIGHT*split+
+      (1.0-_HD_BALANCE_WEIGHT)*_desired_split;
 
     if (_gpu_nbor==0) {
       if (_desired_split<_max_split)
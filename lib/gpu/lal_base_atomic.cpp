@@ -21,12 +21,16 @@ namespace LAMMPS_AL {
 extern Device<PRECISION,ACC_PRECISION> global_device;
 
 template <class numtyp, class acctyp>
-BaseAtomicT::BaseAtomic() : _compiled(false), _max_bytes(0)  {
+BaseAtomicT::BaseAtomic() : _compiled(false), _max_bytes(0) {
   device=&global_device;
   ans=new Answer<numtyp,acctyp>();
   nbor=new Neighbor();
   pair_program=NULL;
   ucl_device=NULL;
+  _pair_cq=1;
+  _pair_cq_bound=false;
+  _pair_cq_registered=false;
+  _multi_cq_ok=true;
 }
 
 template <class numtyp, class acctyp>
@@ -98,6 +102,15 @@ int BaseAtomicT::init_atomic(const int nlocal, const int nall,
 
   _max_an_bytes=ans->gpu_bytes()+nbor->gpu_bytes();
 
+  // defer the command queue choice to the first compute, when all of the
+  // styles sharing the device have been initialized
+
+  if (_multi_cq_ok && !_pair_cq_registered) {
+    device->register_pair_queue();
+    _pair_cq_registered=true;
+  }
+  _pair_cq_bound=false;
+
   return 0;
 }
 
@@ -119,10 +132,39 @@ void BaseAtomicT::clear_atomic() {
   time_pair.clear();
   hd_balancer.clear();
 
+  if (_pair_cq_registered) {
+    device->unregister_pair_queue(_pair_cq);
+    _pair_cq_registered=false;
+    _pair_cq=1;
+    _pair_cq_bound=false;
+  }
+
   nbor->clear();
   ans->clear();
 }
 
+// ---------------------------------------------------------------------------
+// Select the command queue for this style's kernels and answer copies
+// With a single pair style everything stays in the default queue; when
+// multiple styles share the device each gets its own queue so that the
+// kernels of hybrid sub-styles can execute concurrently
+// ---------------------------------------------------------------------------
+template <class numtyp, class acctyp>
+void BaseAtomicT::choose_pair_queue() {
+  _pair_cq_bound=true;
+  if (_multi_cq_ok && device->multi_pair_queue())
+    _pair_cq=device->assign_pair_queue();
+  else
+    _pair_cq=1;
+
+  k_pair.cq(ucl_device->cq(_pair_cq));
+  k_pair_fast.cq(ucl_device->cq(_pair_cq));
+  time_pair.clear();
+  time_pair.init(*ucl_device,ucl_device->cq(_pair_cq));
+  time_pair.zero();
+  ans->cq(_pair_cq);
+}
+
 // ---------------------------------------------------------------------------
 // Copy neighbor list from host
 // ---------------------------------------------------------------------------
@@ -183,6 +225,8 @@ void BaseAtomicT::compute(const int f_ago, const int inum_full,
                                const bool eatom, const bool vatom,
                                int &host_start, const double cpu_time,
                                bool &success) {
+  if (!_pair_cq_bound)
+    choose_pair_queue();
   acc_timers();
   if (inum_full==0) {
     host_start=0;
@@ -203,9 +247,15 @@ void BaseAtomicT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago>0);
   hd_balancer.start_timer();
-  atom->add_x_data(host_x,host_type);
+  atom->add_x_data(host_x,host_type,ago>0);
+
+  // kernels in a non-default queue wait on transfers and neighbor
+  // data issued to the default queue before launching
+
+  if (_pair_cq!=1)
+    device->sync_default_queue();
 
   loop(eflag,vflag);
   ans->copy_answers(eflag,vflag,eatom,vatom,ilist);
@@ -225,6 +275,8 @@ int ** BaseAtomicT::compute(const int ago, const int inum_full,
                                  const bool vatom, int &host_start,
                                  int **ilist, int **jnum,
                                  const double cpu_time, bool &success) {
+  if (!_pair_cq_bound)
+    choose_pair_queue();
   acc_timers();
   if (inum_full==0) {
     host_start=0;
@@ -247,13 +299,19 @@ int ** BaseAtomicT::compute(const int ago, const int inum_full,
       return NULL;
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,true);
     hd_balancer.start_timer();
-    atom->add_x_data(host_x,host_type);
+    atom->add_x_data(host_x,host_type,true);
   }
   *ilist=nbor->host_ilist.begin();
   *jnum=nbor->host_acc.begin();
 
+  // kernels in a non-default queue wait on transfers and neighbor
+  // data issued to the default queue before launching
+
+  if (_pair_cq!=1)
+    device->sync_default_queue();
+
   loop(eflag,vflag);
   ans->copy_answers(eflag,vflag,eatom,vatom);
   device->add_ans_object(ans);
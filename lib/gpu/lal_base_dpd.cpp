@@ -27,6 +27,10 @@ BaseDPDT::BaseDPD() : _compiled(false), _max_bytes(0) {
   nbor=new Neighbor();
   pair_program=NULL;
   ucl_device=NULL;
+  _pair_cq=1;
+  _pair_cq_bound=false;
+  _pair_cq_registered=false;
+  _multi_cq_ok=true;
 }
 
 template <class numtyp, class acctyp>
@@ -101,6 +105,15 @@ int BaseDPDT::init_atomic(const int nlocal, const int nall,
 
   _max_an_bytes=ans->gpu_bytes()+nbor->gpu_bytes();
 
+  // defer the command queue choice to the first compute, when all of the
+  // styles sharing the device have been initialized
+
+  if (_multi_cq_ok && !_pair_cq_registered) {
+    device->register_pair_queue();
+    _pair_cq_registered=true;
+  }
+  _pair_cq_bound=false;
+
   return success;
 }
 
@@ -122,10 +135,39 @@ void BaseDPDT::clear_atomic() {
   time_pair.clear();
   hd_balancer.clear();
 
+  if (_pair_cq_registered) {
+    device->unregister_pair_queue(_pair_cq);
+    _pair_cq_registered=false;
+    _pair_cq=1;
+    _pair_cq_bound=false;
+  }
+
   nbor->clear();
   ans->clear();
 }
 
+// ---------------------------------------------------------------------------
+// Select the command queue for this style's kernels and answer copies
+// With a single pair style everything stays in the default queue; when
+// multiple styles share the device each gets its own queue so that the
+// kernels of hybrid sub-styles can execute concurrently
+// ---------------------------------------------------------------------------
+template <class numtyp, class acctyp>
+void BaseDPDT::choose_pair_queue() {
+  _pair_cq_bound=true;
+  if (_multi_cq_ok && device->multi_pair_queue())
+    _pair_cq=device->assign_pair_queue();
+  else
+    _pair_cq=1;
+
+  k_pair.cq(ucl_device->cq(_pair_cq));
+  k_pair_fast.cq(ucl_device->cq(_pair_cq));
+  time_pair.clear();
+  time_pair.init(*ucl_device,ucl_device->cq(_pair_cq));
+  time_pair.zero();
+  ans->cq(_pair_cq);
+}
+
 // ---------------------------------------------------------------------------
 // Copy neighbor list from host
 // ---------------------------------------------------------------------------
@@ -188,6 +230,8 @@ void BaseDPDT::compute(const int f_ago, const int inum_full,
                        bool &success, tagint *tag, double **host_v,
                        const double dtinvsqrt, const int seed, const int timestep,
                        const int nlocal, double *boxlo, double *prd) {
+  if (!_pair_cq_bound)
+    choose_pair_queue();
   acc_timers();
   if (inum_full==0) {
     host_start=0;
@@ -208,16 +252,22 @@ void BaseDPDT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
-  atom->cast_v_data(host_v,tag);
+  atom->cast_x_data(host_x,host_type,ago>0);
+  atom->cast_v_data(host_v,tag,ago>0);
   hd_balancer.start_timer();
-  atom->add_x_data(host_x,host_type);
-  atom->add_v_data(host_v,tag);
+  atom->add_x_data(host_x,host_type,ago>0);
+  atom->add_v_data(host_v,tag,ago>0);
 
   _dtinvsqrt = dtinvsqrt;
   _seed = seed;
   _timestep = timestep;
 
+  // kernels in a non-default queue wait on transfers and neighbor
+  // data issued to the default queue before launching
+
+  if (_pair_cq!=1)
+    device->sync_default_queue();
+
   loop(eflag,vflag);
   ans->copy_answers(eflag,vflag,eatom,vatom,ilist);
   device->add_ans_object(ans);
@@ -239,6 +289,8 @@ int** BaseDPDT::compute(const int ago, const int inum_full,
                         double **host_v, const double dtinvsqrt,
                         const int seed, const int timestep,
                         double *boxlo, double *prd) {
+  if (!_pair_cq_bound)
+    choose_pair_queue();
   acc_timers();
   if (inum_full==0) {
     host_start=0;
@@ -262,12 +314,12 @@ int** BaseDPDT::compute(const int ago, const int inum_full,
     atom->cast_v_data(host_v,tag);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
-    atom->cast_v_data(host_v,tag);
+    atom->cast_x_data(host_x,host_type,true);
+    atom->cast_v_data(host_v,tag,true);
     hd_balancer.start_timer();
-    atom->add_x_data(host_x,host_type);
+    atom->add_x_data(host_x,host_type,true);
   }
-  atom->add_v_data(host_v,tag);
+  atom->add_v_data(host_v,tag,ago>0);
   *ilist=nbor->host_ilist.begin();
   *jnum=nbor->host_acc.begin();
 
@@ -275,6 +327,12 @@ int** BaseDPDT::compute(const int ago, const int inum_full,
   _seed = seed;
   _timestep = timestep;
 
+  // kernels in a non-default queue wait on transfers and neighbor
+  // data issued to the default queue before launching
+
+  if (_pair_cq!=1)
+    device->sync_default_queue();
+
   loop(eflag,vflag);
   ans->copy_answers(eflag,vflag,eatom,vatom);
   device->add_ans_object(ans);
@@ -196,7 +196,17 @@ class BaseDPD {
   double _gpu_overhead, _driver_overhead;
   UCL_D_Vec<int> *_nbor_data;
 
+
+  int _pair_cq;            // command queue index for this style's kernels
+  bool _pair_cq_bound;     // true once the queue choice has been made
+  bool _pair_cq_registered;  // true while registered with the device
+  bool _multi_cq_ok;       // false for styles with kernels outside the base
+
   void compile_kernels(UCL_Device &dev, const void *pair_string, const char *k);
+
+  /// Move kernels, answers, and timer to a separate command queue when
+  /// multiple pair styles share the device, so their kernels can overlap
+  void choose_pair_queue();
   virtual void loop(const bool _eflag, const bool _vflag) = 0;
 };
 
@@ -377,10 +377,10 @@ int* BaseEllipsoidT::compute(const int f_ago, const int inum_full,
   else
     list=ilist;
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago>0);
   atom->cast_quat_data(host_quat[0]);
   hd_balancer.start_timer();
-  atom->add_x_data(host_x,host_type);
+  atom->add_x_data(host_x,host_type,ago>0);
   atom->add_quat_data();
 
   loop(eflag,vflag);
@@ -424,10 +424,10 @@ int** BaseEllipsoidT::compute(const int ago, const int inum_full, const int nall
     atom->cast_quat_data(host_quat[0]);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,true);
     atom->cast_quat_data(host_quat[0]);
     hd_balancer.start_timer();
-    atom->add_x_data(host_x,host_type);
+    atom->add_x_data(host_x,host_type,true);
   }
 
   atom->add_quat_data();
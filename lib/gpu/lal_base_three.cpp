@@ -263,9 +263,9 @@ void BaseThreeT::compute(const int f_ago, const int inum_full, const int nall,
     _max_nbors = nbor->max_nbor_loop(nlist,numj,ilist);
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago>0);
   hd_balancer.start_timer();
-  atom->add_x_data(host_x,host_type);
+  atom->add_x_data(host_x,host_type,ago>0);
 
   // re-allocate dev_short_nbor if necessary
   if (nall*(2+_max_nbors) > dev_short_nbor.cols()) {
@@ -329,9 +329,9 @@ int ** BaseThreeT::compute(const int ago, const int inum_full,
       return NULL;
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,true);
     hd_balancer.start_timer();
-    atom->add_x_data(host_x,host_type);
+    atom->add_x_data(host_x,host_type,true);
   }
   *ilist=nbor->host_ilist.begin();
   *jnum=nbor->host_acc.begin();
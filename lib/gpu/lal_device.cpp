@@ -34,7 +34,8 @@ namespace LAMMPS_AL {
 #define DeviceT Device<numtyp, acctyp>
 
 template <class numtyp, class acctyp>
-DeviceT::Device() : _init_count(0), _device_init(false),
+DeviceT::Device() : _pair_queue_count(0), _init_count(0),
+                    _device_init(false),
                     _gpu_mode(GPU_FORCE), _first_device(0),
                     _last_device(0), _platform_id(-1), _compiled(false) {
 }
@@ -164,6 +165,9 @@ int DeviceT::init_device(MPI_Comm world, MPI_Comm replica, const int first_gpu,
   gpu->push_command_queue();
   gpu->set_command_queue(1);
 
+  _pair_queue_count=0;
+  _pair_queue_free.clear();
+
   _long_range_precompute=0;
 
   if (set_ocl_params(ocl_vendor)!=0)
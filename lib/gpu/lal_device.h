@@ -25,6 +25,7 @@
 #include <cstdio>
 #include <string>
 #include <queue>
+#include <vector>
 
 namespace LAMMPS_AL {
 
@@ -159,6 +160,34 @@ class Device {
   inline void add_ans_object(Answer<numtyp,acctyp> *ans)
     { ans_queue.push(ans); }
 
+  /// Register a pair style that can run its kernels in a separate queue
+  /** When more than one style registers, e.g. for hybrid/overlay, each
+    * is moved to its own command queue so the kernels can overlap **/
+  inline void register_pair_queue() { _pair_queue_count++; }
+
+  /// Give back a command queue index when a pair style is cleared
+  inline void unregister_pair_queue(const int cq_index) {
+    _pair_queue_count--;
+    if (cq_index>1) _pair_queue_free.push_back(cq_index);
+  }
+
+  /// True if multiple registered pair styles share the device
+  inline bool multi_pair_queue() const { return _pair_queue_count>1; }
+
+  /// Return a command queue index distinct from the default queue
+  inline int assign_pair_queue() {
+    if (_pair_queue_free.empty()==false) {
+      int cq_index=_pair_queue_free.back();
+      _pair_queue_free.pop_back();
+      return cq_index;
+    }
+    gpu->push_command_queue();
+    return gpu->num_queues()-1;
+  }
+
+  /// Block until work in the default queue (data transfers) has completed
+  inline void sync_default_queue() { gpu->sync(1); }
+
   /// Add "answers" (force,energies,etc.) into LAMMPS structures
   inline double fix_gpu(double **f, double **tor, double *eatom,
                         double **vatom, double *virial, double &ecoul) {
@@ -307,6 +336,8 @@ class Device {
 
  private:
   std::queue<Answer<numtyp,acctyp> *> ans_queue;
+  int _pair_queue_count;            // # of registered multi-queue pair styles
+  std::vector<int> _pair_queue_free;  // released queue indices for reuse
   int _init_count;
   bool _device_init, _host_timer_started, _time_device;
   MPI_Comm _comm_world, _comm_replica, _comm_gpu;
@@ -327,8 +327,8 @@ void EAMT::compute(const int f_ago, const int inum_full, const int nlocal,
       return;
   }
 
-  this->atom->cast_x_data(host_x,host_type);
-  this->atom->add_x_data(host_x,host_type);
+  this->atom->cast_x_data(host_x,host_type,ago>0);
+  this->atom->add_x_data(host_x,host_type,ago>0);
 
   loop(eflag,vflag);
 
@@ -396,8 +396,8 @@ int** EAMT::compute(const int ago, const int inum_full, const int nall,
     if (!success)
       return NULL;
   } else {
-    this->atom->cast_x_data(host_x,host_type);
-    this->atom->add_x_data(host_x,host_type);
+    this->atom->cast_x_data(host_x,host_type,true);
+    this->atom->add_x_data(host_x,host_type,true);
   }
   *ilist=this->nbor->host_ilist.begin();
   *jnum=this->nbor->host_acc.begin();
@@ -304,10 +304,10 @@ void LJTIP4PLongT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  this->atom->cast_x_data(host_x,host_type);
+  this->atom->cast_x_data(host_x,host_type,ago>0);
   this->atom->cast_q_data(host_q);
   this->hd_balancer.start_timer();
-  this->atom->add_x_data(host_x,host_type);
+  this->atom->add_x_data(host_x,host_type,ago>0);
   this->atom->add_q_data();
 
   this->device->precompute(f_ago,nlocal,nall,host_x,host_type,success,host_q,
@@ -357,10 +357,10 @@ int** LJTIP4PLongT::compute(const int ago, const int inum_full,
     this->atom->cast_q_data(host_q);
     this->hd_balancer.start_timer();
   } else {
-    this->atom->cast_x_data(host_x,host_type);
+    this->atom->cast_x_data(host_x,host_type,true);
     this->atom->cast_q_data(host_q);
     this->hd_balancer.start_timer();
-    this->atom->add_x_data(host_x,host_type);
+    this->atom->add_x_data(host_x,host_type,true);
   }
   this->atom->add_q_data();
   *ilist=this->nbor->host_ilist.begin();
@@ -36,6 +36,9 @@ extern Device<PRECISION,ACC_PRECISION> device;
 template <class numtyp, class acctyp>
 TableT::Table() : BaseAtomic<numtyp,acctyp>(),
   _allocated(false), _compiled_styles(false) {
+  // table kernels are not managed by the base class and must stay in
+  // the default command queue
+  this->_multi_cq_ok=false;
 }
 
 template <class numtyp, class acctyp>
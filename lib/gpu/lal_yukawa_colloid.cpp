@@ -171,10 +171,10 @@ void YukawaColloidT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  this->atom->cast_x_data(host_x,host_type);
+  this->atom->cast_x_data(host_x,host_type,ago>0);
   this->cast_rad_data(rad);
   this->hd_balancer.start_timer();
-  this->atom->add_x_data(host_x,host_type);
+  this->atom->add_x_data(host_x,host_type,ago>0);
   this->add_rad_data();
 
   this->loop(eflag,vflag);
@@ -231,10 +231,10 @@ int** YukawaColloidT::compute(const int ago, const int inum_full, const int nall
     this->cast_rad_data(rad);
     this->hd_balancer.start_timer();
   } else {
-    this->atom->cast_x_data(host_x,host_type);
+    this->atom->cast_x_data(host_x,host_type,true);
     this->cast_rad_data(rad);
     this->hd_balancer.start_timer();
-    this->atom->add_x_data(host_x,host_type);
+    this->atom->add_x_data(host_x,host_type,true);
   }
   this->add_rad_data();
   *ilist=this->nbor->host_ilist.begin();
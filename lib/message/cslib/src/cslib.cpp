@@ -25,6 +25,7 @@
 #include "cslib.h"
 #include "msg_file.h"
 #include "msg_zmq.h"
+#include "msg_shm.h"
 #include "msg_mpi_one.h"
 #include "msg_mpi_two.h"
 
@@ -63,7 +64,8 @@ CSlib::CSlib(int csflag, const char *mode, const void *ptr, const void *pcomm)
 
     if (strcmp(mode,"file") == 0) msg = new MsgFile(csflag,ptr);
     else if (strcmp(mode,"zmq") == 0) msg = new MsgZMQ(csflag,ptr);
-    else if (strcmp(mode,"mpi/one") == 0) 
+    else if (strcmp(mode,"shm") == 0) msg = new MsgShm(csflag,ptr);
+    else if (strcmp(mode,"mpi/one") == 0)
       error_all("constructor(): No mpi/one mode for serial lib usage");
     else if (strcmp(mode,"mpi/two") == 0)
       error_all("constructor(): No mpi/two mode for serial lib usage");
@@ -76,6 +78,7 @@ CSlib::CSlib(int csflag, const char *mode, const void *ptr, const void *pcomm)
 
     if (strcmp(mode,"file") == 0) msg = new MsgFile(csflag,ptr,world);
     else if (strcmp(mode,"zmq") == 0) msg = new MsgZMQ(csflag,ptr,world);
+    else if (strcmp(mode,"shm") == 0) msg = new MsgShm(csflag,ptr,world);
     else if (strcmp(mode,"mpi/one") == 0) msg = new MsgMPIOne(csflag,ptr,world);
     else if (strcmp(mode,"mpi/two") == 0) msg = new MsgMPITwo(csflag,ptr,world);
     else error_all("constructor(): Unknown mode");
@@ -0,0 +1,279 @@
+/* ----------------------------------------------------------------------
+   CSlib - Client/server library for code coupling
+   http://cslib.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright 2018 National Technology & Engineering Solutions of
+   Sandia, LLC (NTESS). Under the terms of Contract DE-NA0003525 with
+   NTESS, the U.S. Government retains certain rights in this software.
+   This software is distributed under the modified Berkeley Software
+   Distribution (BSD) License.
+
+   See the README file in the top-level CSlib directory.
+------------------------------------------------------------------------- */
+
+#ifdef MPI_YES
+#include <mpi.h>
+#else
+#include <mpi_dummy.h>
+#endif
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "msg_shm.h"
+
+using namespace CSLIB_NS;
+
+#define SHM_MAGIC 0x43534d53      // "CSMS"
+#define SHM_NSLOTS 4              // frame slots per direction
+#define SHM_MAXHEADER 1024        // header ints per slot
+#define SHM_DEFAULT_MB 16         // default payload capacity per slot
+#define SHM_ALIGN 64              // cache-line alignment of slots
+
+// segment layout: ShmHeader, then SHM_NSLOTS slots for the
+// client -> server direction, then SHM_NSLOTS for server -> client
+// each slot = 2 length ints + SHM_MAXHEADER ints + payload, padded
+// head counts messages produced, tail messages consumed; with one
+// producer and one consumer per ring no locks are needed, only a
+// memory fence between filling a slot and publishing the new head
+
+namespace {
+  struct ShmRing {
+    volatile unsigned long head;
+    volatile unsigned long tail;
+    char pad[SHM_ALIGN - 2*sizeof(unsigned long)];
+  };
+
+  struct ShmHeader {
+    volatile int magic;
+    int nslots;
+    long slotsize;
+    ShmRing ring[2];          // 0 = client -> server, 1 = server -> client
+  };
+}
+
+/* ---------------------------------------------------------------------- */
+
+MsgShm::MsgShm(int csflag, const void *ptr, MPI_Comm cworld) :
+  Msg(csflag, ptr, cworld)
+{
+  init((const char *) ptr);
+}
+
+MsgShm::MsgShm(int csflag, const void *ptr) : Msg(csflag, ptr)
+{
+  init((const char *) ptr);
+}
+
+/* ---------------------------------------------------------------------- */
+
+MsgShm::~MsgShm()
+{
+  if (me == 0) {
+    munmap(shmbase,totalbytes);
+    if (server) shm_unlink(shmname);
+  }
+  delete [] shmname;
+}
+
+/* ----------------------------------------------------------------------
+   arg = segment name, optionally followed by :size with the per-slot
+     payload capacity in Mbytes (default 16), e.g. "qmmm:64"
+   both sides must pass the same name and size
+   the server creates and initializes the segment, the client polls
+     until the server has done so, thus either side can start first
+------------------------------------------------------------------------- */
+
+void MsgShm::init(const char *arg)
+{
+  shmbase = NULL;
+  shmname = NULL;
+  slotsize = (long) SHM_DEFAULT_MB * 1024*1024;
+
+  // parse "name" or "name:sizeMB", prepend the slash shm_open() wants
+
+  int n = strlen(arg);
+  char *name = new char[n+1];
+  strcpy(name,arg);
+  char *colon = strchr(name,':');
+  if (colon) {
+    *colon = '\0';
+    long mb = atol(colon+1);
+    if (mb <= 0) error_all("constructor(): Invalid shm size");
+    slotsize = mb * 1024*1024;
+  }
+
+  shmname = new char[strlen(name)+2];
+  if (name[0] == '/') strcpy(shmname,name);
+  else {
+    shmname[0] = '/';
+    strcpy(&shmname[1],name);
+  }
+  delete [] name;
+
+  slotbytes = 2*sizeof(int) + SHM_MAXHEADER*sizeof(int) + slotsize;
+  slotbytes = ((slotbytes + SHM_ALIGN - 1) / SHM_ALIGN) * SHM_ALIGN;
+  long slotoffset = ((sizeof(ShmHeader) + SHM_ALIGN - 1) / SHM_ALIGN) *
+    SHM_ALIGN;
+  totalbytes = slotoffset + 2 * SHM_NSLOTS * slotbytes;
+
+  if (me != 0) return;
+
+  if (server) {
+    int fd = shm_open(shmname,O_CREAT|O_RDWR,0600);
+    if (fd < 0) error_one("constructor(): Server could not create shm");
+    if (ftruncate(fd,totalbytes) < 0)
+      error_one("constructor(): Server could not size shm");
+    shmbase = mmap(NULL,totalbytes,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    close(fd);
+    if (shmbase == MAP_FAILED)
+      error_one("constructor(): Server could not map shm");
+
+    ShmHeader *hdr = (ShmHeader *) shmbase;
+    hdr->nslots = SHM_NSLOTS;
+    hdr->slotsize = slotsize;
+    for (int i = 0; i < 2; i++)
+      hdr->ring[i].head = hdr->ring[i].tail = 0;
+    __sync_synchronize();
+    hdr->magic = SHM_MAGIC;
+
+  } else {
+
+    // client: poll until the server has created and initialized it
+
+    int fd = -1;
+    for (int iter = 0; iter < 60000; iter++) {
+      fd = shm_open(shmname,O_RDWR,0600);
+      if (fd >= 0) break;
+      usleep(1000);
+    }
+    if (fd < 0) error_one("constructor(): Client timed out waiting for shm");
+
+    struct stat st;
+    for (int iter = 0; iter < 60000; iter++) {
+      if (fstat(fd,&st) == 0 && st.st_size >= totalbytes) break;
+      usleep(1000);
+    }
+    if (st.st_size < totalbytes)
+      error_one("constructor(): Client/server shm sizes do not match");
+
+    shmbase = mmap(NULL,totalbytes,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    close(fd);
+    if (shmbase == MAP_FAILED)
+      error_one("constructor(): Client could not map shm");
+
+    ShmHeader *hdr = (ShmHeader *) shmbase;
+    for (int iter = 0; iter < 60000; iter++) {
+      if (hdr->magic == SHM_MAGIC) break;
+      usleep(1000);
+    }
+    if (hdr->magic != SHM_MAGIC)
+      error_one("constructor(): Client timed out waiting for shm init");
+    if (hdr->slotsize != slotsize || hdr->nslots != SHM_NSLOTS)
+      error_one("constructor(): Client/server shm sizes do not match");
+  }
+}
+
+/* ----------------------------------------------------------------------
+   address of slot imsg of direction dir
+------------------------------------------------------------------------- */
+
+char *MsgShm::slot_ptr(int dir, unsigned long imsg)
+{
+  long slotoffset = ((sizeof(ShmHeader) + SHM_ALIGN - 1) / SHM_ALIGN) *
+    SHM_ALIGN;
+  return (char *) shmbase + slotoffset +
+    (dir*SHM_NSLOTS + (long) (imsg % SHM_NSLOTS)) * slotbytes;
+}
+
+/* ----------------------------------------------------------------------
+   spin until *counter >= target
+   the partner runs on the same node, so latency matters more than the
+   burned cycles; yield periodically in case of oversubscription
+------------------------------------------------------------------------- */
+
+void MsgShm::wait_ge(volatile unsigned long *counter, unsigned long target)
+{
+  long iter = 0;
+  while (*counter < target)
+    if ((++iter & 1023) == 0) sched_yield();
+  __sync_synchronize();
+}
+
+/* ----------------------------------------------------------------------
+   copy the message into the next free slot of my direction's ring,
+   then publish it by advancing head; blocks only if the consumer is
+   SHM_NSLOTS messages behind
+------------------------------------------------------------------------- */
+
+void MsgShm::send(int nheader, int *header, int nbuf, char *buf)
+{
+  if (me != 0) return;
+
+  if (nheader > SHM_MAXHEADER)
+    error_one("send(): Message header exceeds shm slot capacity");
+  if ((long) nbuf > slotsize)
+    error_one("send(): Message exceeds shm slot capacity, "
+              "increase the size in the message command");
+
+  ShmHeader *hdr = (ShmHeader *) shmbase;
+  int dir = client ? 0 : 1;
+  ShmRing *ring = &hdr->ring[dir];
+
+  unsigned long head = ring->head;
+  if (head - ring->tail >= SHM_NSLOTS)
+    wait_ge(&ring->tail,head - SHM_NSLOTS + 1);
+
+  char *slot = slot_ptr(dir,head);
+  ((int *) slot)[0] = nheader;
+  ((int *) slot)[1] = nbuf;
+  memcpy(slot + 2*sizeof(int),header,nheader*sizeof(int));
+  if (nbuf) memcpy(slot + 2*sizeof(int) + SHM_MAXHEADER*sizeof(int),buf,nbuf);
+
+  __sync_synchronize();
+  ring->head = head + 1;
+}
+
+/* ----------------------------------------------------------------------
+   wait for the next message in the other direction's ring, copy it
+   out, then free the slot by advancing tail
+------------------------------------------------------------------------- */
+
+void MsgShm::recv(int &maxheader, int *&header, int &maxbuf, char *&buf)
+{
+  ShmHeader *hdr = (ShmHeader *) shmbase;
+  int dir = client ? 1 : 0;
+  ShmRing *ring = (me == 0) ? &hdr->ring[dir] : NULL;
+  char *slot = NULL;
+
+  if (me == 0) {
+    unsigned long tail = ring->tail;
+    wait_ge(&ring->head,tail + 1);
+    slot = slot_ptr(dir,tail);
+    lengths[0] = ((int *) slot)[0];
+    lengths[1] = ((int *) slot)[1];
+  }
+  if (nprocs > 1) MPI_Bcast(lengths,2,MPI_INT,0,world);
+
+  int nheader = lengths[0];
+  int nbuf = lengths[1];
+  allocate(nheader,maxheader,header,nbuf,maxbuf,buf);
+
+  if (me == 0) {
+    memcpy(header,slot + 2*sizeof(int),nheader*sizeof(int));
+    if (nbuf)
+      memcpy(buf,slot + 2*sizeof(int) + SHM_MAXHEADER*sizeof(int),nbuf);
+    __sync_synchronize();
+    ring->tail = ring->tail + 1;
+  }
+  if (nprocs > 1) {
+    MPI_Bcast(header,nheader,MPI_INT,0,world);
+    MPI_Bcast(buf,nbuf,MPI_CHAR,0,world);
+  }
+}
@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+   CSlib - Client/server library for code coupling
+   http://cslib.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright 2018 National Technology & Engineering Solutions of
+   Sandia, LLC (NTESS). Under the terms of Contract DE-NA0003525 with
+   NTESS, the U.S. Government retains certain rights in this software.
+   This software is distributed under the modified Berkeley Software
+   Distribution (BSD) License.
+
+   See the README file in the top-level CSlib directory.
+------------------------------------------------------------------------- */
+
+#ifndef MSG_SHM_H
+#define MSG_SHM_H
+
+#include "msg.h"
+
+namespace CSLIB_NS {
+
+// shared-memory transport for same-node client/server coupling
+// one POSIX shm segment holds two lock-free single-producer
+// single-consumer rings of frame slots, one per direction, so a
+// message is written once into the slot and read once out of it
+
+class MsgShm : public Msg {
+ public:
+  MsgShm(int, const void *, MPI_Comm);
+  MsgShm(int, const void *);
+  ~MsgShm();
+  void send(int, int *, int, char *);
+  void recv(int &, int *&, int &, char *&);
+
+ private:
+  char *shmname;            // segment name, leading slash included
+  long slotsize;            // payload capacity of one slot in bytes
+  long slotbytes;           // full stride of one slot in bytes
+  long totalbytes;          // size of the whole segment
+  void *shmbase;            // mapped address of the segment
+
+  void init(const char *);
+  char *slot_ptr(int, unsigned long);
+  void wait_ge(volatile unsigned long *, unsigned long);
+};
+
+}
+
+#endif
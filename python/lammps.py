@@ -304,6 +304,11 @@ class lammps(object):
     self.lib.lammps_set_fix_external_callback.argtypes = [c_void_p, c_char_p, self.FIX_EXTERNAL_CALLBACK_FUNC, py_object]
     self.lib.lammps_set_fix_external_callback.restype = None
 
+    # way to insert Python callback for in-situ analysis of dump ring frames
+    self.FRAME_CALLBACK_FUNC = CFUNCTYPE(None, py_object, self.c_bigint, c_int)
+    self.lib.lammps_set_frame_callback.argtypes = [c_void_p, c_char_p, self.FRAME_CALLBACK_FUNC, py_object]
+    self.lib.lammps_set_frame_callback.restype = c_int
+
   # shut-down LAMMPS instance
 
   def __del__(self):
@@ -417,6 +422,33 @@ class lammps(object):
     ptr = self.lib.lammps_extract_atom(self.lmp,name)
     return ptr
 
+  # extract per-atom info as a zero-copy per-rank view
+  # returns (ptr,nlocal,epoch); the view covers only the atoms owned by
+  # this rank and is valid while atom_epoch() still returns epoch
+
+  def extract_atom_view(self,name,type):
+    if name: name = name.encode()
+    if type == 0:
+      self.lib.lammps_extract_atom_view.restype = POINTER(c_int)
+    elif type == 1:
+      self.lib.lammps_extract_atom_view.restype = POINTER(POINTER(c_int))
+    elif type == 2:
+      self.lib.lammps_extract_atom_view.restype = POINTER(c_double)
+    elif type == 3:
+      self.lib.lammps_extract_atom_view.restype = POINTER(POINTER(c_double))
+    else: return None
+    nlocal = c_int()
+    epoch = c_int64()
+    ptr = self.lib.lammps_extract_atom_view(self.lmp,name,
+                                            byref(nlocal),byref(epoch))
+    return ptr,nlocal.value,epoch.value
+
+  # current validity epoch of per-atom views
+
+  def atom_epoch(self):
+    self.lib.lammps_atom_epoch.restype = c_int64
+    return self.lib.lammps_atom_epoch(self.lmp)
+
   @property
   def numpy(self):
     if not self._numpy:
@@ -455,6 +487,33 @@ class lammps(object):
 
           return self.darray(raw_ptr, nelem, dim)
 
+        # zero-copy per-rank views: shape comes from the library call
+        # and the returned epoch tells when the view must be refreshed,
+        # i.e. as soon as lmp.atom_epoch() no longer matches it
+
+        def extract_atom_view_iarray(self, name, dim=1):
+          if name in ['id', 'molecule']:
+            c_int_type = self.lmp.c_tagint
+          elif name in ['image']:
+            c_int_type = self.lmp.c_imageint
+          else:
+            c_int_type = c_int
+
+          if dim == 1:
+            raw_ptr, nlocal, epoch = self.lmp.extract_atom_view(name, 0)
+          else:
+            raw_ptr, nlocal, epoch = self.lmp.extract_atom_view(name, 1)
+
+          return self.iarray(c_int_type, raw_ptr, nlocal, dim), epoch
+
+        def extract_atom_view_darray(self, name, dim=1):
+          if dim == 1:
+            raw_ptr, nlocal, epoch = self.lmp.extract_atom_view(name, 2)
+          else:
+            raw_ptr, nlocal, epoch = self.lmp.extract_atom_view(name, 3)
+
+          return self.darray(raw_ptr, nlocal, dim), epoch
+
         def iarray(self, c_int_type, raw_ptr, nelem, dim=1):
           np_int_type = self._ctype_to_numpy_int(c_int_type)
 
@@ -762,6 +821,20 @@ class lammps(object):
 
     self.lib.lammps_set_fix_external_callback(self.lmp, fix_name.encode(), cFunc, cCaller)
 
+  def set_frame_callback(self, dump_id, callback, caller=None):
+    """Register an in-situ analysis callback on a dump ring command.
+
+    The callback fires inside the run loop each time the dump buffers a
+    snapshot and receives (caller, ntimestep, iframe); iframe can be
+    passed to lammps_extract_frame to read the buffered data.
+    """
+    cFunc   = self.FRAME_CALLBACK_FUNC(callback)
+    cCaller = caller
+
+    self.callback[dump_id] = { 'function': cFunc, 'caller': caller }
+
+    return self.lib.lammps_set_frame_callback(self.lmp, dump_id.encode(), cFunc, cCaller)
+
   def get_neighlist(self, idx):
     """Returns an instance of :class:`NeighList` which wraps access to the neighbor list with the given index
 
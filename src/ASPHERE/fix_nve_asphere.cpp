@@ -59,8 +59,7 @@ void FixNVEAsphere::init()
 void FixNVEAsphere::initial_integrate(int /*vflag*/)
 {
   double dtfm;
-  double inertia[3],omega[3];
-  double *shape,*quat;
+  double *shape;
 
   AtomVecEllipsoid::Bonus *bonus = avec->bonus;
   int *ellipsoid = atom->ellipsoid;
@@ -78,6 +77,16 @@ void FixNVEAsphere::initial_integrate(int /*vflag*/)
 
   dtq = 0.5 * dtv;
 
+  // quaternion updates are batched: pointers and per-atom moments are
+  // gathered and the block is integrated by one richardson_batch call
+
+  int nbatch = 0;
+  double *qbatch[MathExtra::RICHARDSON_BATCH];
+  double *mbatch[MathExtra::RICHARDSON_BATCH];
+  double *ibatch[MathExtra::RICHARDSON_BATCH];
+  double ibuf[MathExtra::RICHARDSON_BATCH][3];
+  for (int k = 0; k < MathExtra::RICHARDSON_BATCH; k++) ibatch[k] = ibuf[k];
+
   for (int i = 0; i < nlocal; i++)
     if (mask[i] & groupbit) {
       dtfm = dtf / rmass[i];
@@ -97,19 +106,25 @@ void FixNVEAsphere::initial_integrate(int /*vflag*/)
       // principal moments of inertia
 
       shape = bonus[ellipsoid[i]].shape;
-      quat = bonus[ellipsoid[i]].quat;
 
-      inertia[0] = INERTIA*rmass[i] * (shape[1]*shape[1]+shape[2]*shape[2]);
-      inertia[1] = INERTIA*rmass[i] * (shape[0]*shape[0]+shape[2]*shape[2]);
-      inertia[2] = INERTIA*rmass[i] * (shape[0]*shape[0]+shape[1]*shape[1]);
+      ibuf[nbatch][0] = INERTIA*rmass[i] * (shape[1]*shape[1]+shape[2]*shape[2]);
+      ibuf[nbatch][1] = INERTIA*rmass[i] * (shape[0]*shape[0]+shape[2]*shape[2]);
+      ibuf[nbatch][2] = INERTIA*rmass[i] * (shape[0]*shape[0]+shape[1]*shape[1]);
 
       // compute omega at 1/2 step from angmom at 1/2 step and current q
       // update quaternion a full step via Richardson iteration
-      // returns new normalized quaternion
-
-      MathExtra::mq_to_omega(angmom[i],quat,inertia,omega);
-      MathExtra::richardson(quat,angmom[i],omega,inertia,dtq);
+      // stores new normalized quaternion, one block of atoms at a time
+
+      qbatch[nbatch] = bonus[ellipsoid[i]].quat;
+      mbatch[nbatch] = angmom[i];
+      nbatch++;
+      if (nbatch == MathExtra::RICHARDSON_BATCH) {
+        MathExtra::richardson_batch(nbatch,qbatch,mbatch,ibatch,dtq);
+        nbatch = 0;
+      }
     }
+
+  if (nbatch) MathExtra::richardson_batch(nbatch,qbatch,mbatch,ibatch,dtq);
 }
 
 /* ---------------------------------------------------------------------- */
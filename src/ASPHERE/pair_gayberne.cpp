@@ -18,6 +18,7 @@
 #include "pair_gayberne.h"
 #include <mpi.h>
 #include <cmath>
+#include <cstring>
 #include "math_extra.h"
 #include "atom.h"
 #include "atom_vec_ellipsoid.h"
@@ -51,6 +52,9 @@ PairGayBerne::PairGayBerne(LAMMPS *lmp) : Pair(lmp)
 
   single_enable = 0;
   writedata = 1;
+
+  screen_flag = 0;
+  screen_gap = 0.0;
 }
 
 /* ----------------------------------------------------------------------
@@ -77,6 +81,7 @@ PairGayBerne::~PairGayBerne()
     memory->destroy(offset);
     delete [] lshape;
     delete [] setwell;
+    delete [] isoshape;
   }
 }
 
@@ -144,6 +149,37 @@ void PairGayBerne::compute(int eflag, int vflag)
 
       if (rsq < cutsq[itype][jtype]) {
 
+        // orientation-aware screening: skip the pair when the gap
+        // between the two oriented surfaces exceeds screen_gap even
+        // though the centers are inside the cutoff; the extent of an
+        // ellipsoid along rhat is sqrt(sum_k (shape_k * (ek.rhat))^2)
+        // with ek the body axes, i.e. the rows of the a matrices
+
+        if (screen_flag && form[itype][jtype] != SPHERE_SPHERE) {
+          double r = sqrt(rsq);
+          double gap = r;
+          double rhat[3],ebody[3],a2s[3][3];
+          rhat[0] = r12[0]/r;
+          rhat[1] = r12[1]/r;
+          rhat[2] = r12[2]/r;
+          if (isoshape[itype]) gap -= shape1[itype][0];
+          else {
+            MathExtra::matvec(a1,rhat,ebody);
+            gap -= sqrt(shape2[itype][0]*ebody[0]*ebody[0] +
+                        shape2[itype][1]*ebody[1]*ebody[1] +
+                        shape2[itype][2]*ebody[2]*ebody[2]);
+          }
+          if (isoshape[jtype]) gap -= shape1[jtype][0];
+          else {
+            MathExtra::quat_to_mat_trans(bonus[ellipsoid[j]].quat,a2s);
+            MathExtra::matvec(a2s,rhat,ebody);
+            gap -= sqrt(shape2[jtype][0]*ebody[0]*ebody[0] +
+                        shape2[jtype][1]*ebody[1]*ebody[1] +
+                        shape2[jtype][2]*ebody[2]*ebody[2]);
+          }
+          if (gap > screen_gap) continue;
+        }
+
         switch (form[itype][jtype]) {
         case SPHERE_SPHERE:
           r2inv = 1.0/rsq;
@@ -257,6 +293,7 @@ void PairGayBerne::allocate()
 
   lshape = new double[n+1];
   setwell = new int[n+1];
+  isoshape = new int[n+1];
   for (int i = 1; i <= n; i++) setwell[i] = 0;
 }
 
@@ -266,13 +303,25 @@ void PairGayBerne::allocate()
 
 void PairGayBerne::settings(int narg, char **arg)
 {
-  if (narg != 4) error->all(FLERR,"Illegal pair_style command");
+  if (narg != 4 && narg != 6) error->all(FLERR,"Illegal pair_style command");
 
   gamma = force->numeric(FLERR,arg[0]);
   upsilon = force->numeric(FLERR,arg[1])/2.0;
   mu = force->numeric(FLERR,arg[2]);
   cut_global = force->numeric(FLERR,arg[3]);
 
+  // optional orientation-aware screening of pairs whose surface gap
+  // exceeds screen_gap, even though their centers are inside the cutoff
+
+  screen_flag = 0;
+  if (narg == 6) {
+    if (strcmp(arg[4],"screen") != 0)
+      error->all(FLERR,"Illegal pair_style command");
+    screen_gap = force->numeric(FLERR,arg[5]);
+    if (screen_gap <= 0.0) error->all(FLERR,"Illegal pair_style command");
+    screen_flag = 1;
+  }
+
   // reset cutoffs that have been explicitly set
 
   if (allocated) {
@@ -364,6 +413,12 @@ void PairGayBerne::init_style()
     shape2[i][2] = shape1[i][2]*shape1[i][2];
     lshape[i] = (shape1[i][0]*shape1[i][1]+shape1[i][2]*shape1[i][2]) *
       sqrt(shape1[i][0]*shape1[i][1]);
+
+    // shape class used by the screening test: isotropic types have a
+    // fixed extent along any direction, so no quaternion math is needed
+
+    isoshape[i] = (shape1[i][0] == shape1[i][1] &&
+                   shape1[i][1] == shape1[i][2]);
   }
 }
 
@@ -494,6 +549,8 @@ void PairGayBerne::write_restart_settings(FILE *fp)
   fwrite(&upsilon,sizeof(double),1,fp);
   fwrite(&mu,sizeof(double),1,fp);
   fwrite(&cut_global,sizeof(double),1,fp);
+  fwrite(&screen_flag,sizeof(int),1,fp);
+  fwrite(&screen_gap,sizeof(double),1,fp);
   fwrite(&offset_flag,sizeof(int),1,fp);
   fwrite(&mix_flag,sizeof(int),1,fp);
 }
@@ -510,6 +567,8 @@ void PairGayBerne::read_restart_settings(FILE *fp)
     utils::sfread(FLERR,&upsilon,sizeof(double),1,fp,NULL,error);
     utils::sfread(FLERR,&mu,sizeof(double),1,fp,NULL,error);
     utils::sfread(FLERR,&cut_global,sizeof(double),1,fp,NULL,error);
+    utils::sfread(FLERR,&screen_flag,sizeof(int),1,fp,NULL,error);
+    utils::sfread(FLERR,&screen_gap,sizeof(double),1,fp,NULL,error);
     utils::sfread(FLERR,&offset_flag,sizeof(int),1,fp,NULL,error);
     utils::sfread(FLERR,&mix_flag,sizeof(int),1,fp,NULL,error);
   }
@@ -517,6 +576,8 @@ void PairGayBerne::read_restart_settings(FILE *fp)
   MPI_Bcast(&upsilon,1,MPI_DOUBLE,0,world);
   MPI_Bcast(&mu,1,MPI_DOUBLE,0,world);
   MPI_Bcast(&cut_global,1,MPI_DOUBLE,0,world);
+  MPI_Bcast(&screen_flag,1,MPI_INT,0,world);
+  MPI_Bcast(&screen_gap,1,MPI_DOUBLE,0,world);
   MPI_Bcast(&offset_flag,1,MPI_INT,0,world);
   MPI_Bcast(&mix_flag,1,MPI_INT,0,world);
 }
@@ -54,6 +54,9 @@ class PairGayBerne : public Pair {
   double **epsilon,**sigma;  // epsilon and sigma values for atom-type pairs
 
   int **form;
+  int screen_flag;           // 1 if orientation-aware pair screening is on
+  double screen_gap;         // pair skipped when surface gap exceeds this
+  int *isoshape;             // 1 if the per-type shape is isotropic
   double **lj1,**lj2,**lj3,**lj4;
   double **offset;
   int *setwell;
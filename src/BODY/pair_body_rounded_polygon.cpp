@@ -561,19 +561,37 @@ void PairBodyRoundedPolygon::body2space(int i)
   edfirst[i] = nedge;
 
   // grow the edge list if necessary
-  // the first 2 columns are for vertex indices within body, the last 3 for forces
+  // the first 2 columns are for vertex indices within body, the next 3 for
+  // forces, the last 4 for the space-frame unit vector and length of the edge
 
   if (nedge + body_num_edges > edmax) {
     edmax += DELTA;
-    memory->grow(edge,edmax,5,"pair:edge");
+    memory->grow(edge,edmax,9,"pair:edge");
   }
 
+  // cache the space-frame unit vector and length of each edge once here
+  // so that the pairwise distance tests below need not recompute them
+  // for every candidate vertex
+
+  int ifirst = dfirst[i];
+
   for (int m = 0; m < body_num_edges; m++) {
-    edge[nedge][0] = static_cast<int>(edge_ends[2*m+0]);
-    edge[nedge][1] = static_cast<int>(edge_ends[2*m+1]);
+    int pt1 = static_cast<int>(edge_ends[2*m+0]);
+    int pt2 = static_cast<int>(edge_ends[2*m+1]);
+    double vx = discrete[ifirst+pt2][0] - discrete[ifirst+pt1][0];
+    double vy = discrete[ifirst+pt2][1] - discrete[ifirst+pt1][1];
+    double vz = discrete[ifirst+pt2][2] - discrete[ifirst+pt1][2];
+    double magv = sqrt(vx*vx + vy*vy + vz*vz);
+
+    edge[nedge][0] = pt1;
+    edge[nedge][1] = pt2;
     edge[nedge][2] = 0;
     edge[nedge][3] = 0;
     edge[nedge][4] = 0;
+    edge[nedge][5] = vx / magv;
+    edge[nedge][6] = vy / magv;
+    edge[nedge][7] = vz / magv;
+    edge[nedge][8] = magv;
     nedge++;
   }
 
@@ -1011,8 +1029,8 @@ int PairBodyRoundedPolygon::compute_distance_to_vertex(int ibody,
   if (edge_index >= ednum[ibody]) return INVALID;
 
   int mode,ifirst,iefirst,npi1,npi2;
-  double xi1[3],xi2[3],u[3],v[3],uij[3];
-  double udotv, magv, magucostheta;
+  double xi1[3],xi2[3],u[3],uij[3];
+  double magucostheta;
   double delx,dely,delz;
 
   ifirst = dfirst[ibody];
@@ -1036,23 +1054,16 @@ int PairBodyRoundedPolygon::compute_distance_to_vertex(int ibody,
   u[1] = x0[1] - xi1[1];
   u[2] = x0[2] - xi1[2];
 
-  // v = xi2 - xi1
-
-  v[0] = xi2[0] - xi1[0];
-  v[1] = xi2[1] - xi1[1];
-  v[2] = xi2[2] - xi1[2];
-
-  // dot product between u and v = magu * magv * costheta
+  // uij is the unit vector pointing from xi to xj,
+  // cached in space frame by body2space() along with the edge length
 
-  udotv = u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
-  magv = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
-  magucostheta = udotv / magv;
+  uij[0] = edge[iefirst+edge_index][5];
+  uij[1] = edge[iefirst+edge_index][6];
+  uij[2] = edge[iefirst+edge_index][7];
 
-  // uij is the unit vector pointing from xi to xj
+  // dot product between u and uij = magu * costheta
 
-  uij[0] = v[0] / magv;
-  uij[1] = v[1] / magv;
-  uij[2] = v[2] / magv;
+  magucostheta = u[0] * uij[0] + u[1] * uij[1] + u[2] * uij[2];
 
   // position of the projection of x0 on the line (xi, xj)
 
@@ -1099,13 +1110,9 @@ int PairBodyRoundedPolygon::compute_distance_to_vertex(int ibody,
 
       // x0 and xmi are on the different sides
       // t is the ratio to detect if x0 is closer to the vertices xi or xj
+      // hi - xi1 = magucostheta * uij, so t follows from the edge length
 
-      if (fabs(xi2[0] - xi1[0]) > EPSILON)
-        t = (hi[0] - xi1[0]) / (xi2[0] - xi1[0]);
-      else if (fabs(xi2[1] - xi1[1]) > EPSILON)
-        t = (hi[1] - xi1[1]) / (xi2[1] - xi1[1]);
-      else if (fabs(xi2[2] - xi1[2]) > EPSILON)
-        t = (hi[2] - xi1[2]) / (xi2[2] - xi1[2]);
+      t = magucostheta / edge[iefirst+edge_index][8];
 
       double contact_dist = rounded_radius + x0_rounded_radius;
       if (t >= 0 && t <= 1) {
@@ -62,7 +62,9 @@ class PairBodyRoundedPolygon : public Pair {
   int *dfirst;        // index of first discrete per each line
   int nmax;           // allocated size of dnum,dfirst vectors
 
-  double **edge;      // list of all edge for all bodies
+  double **edge;      // list of all edge for all bodies:
+                      // 0-1: vertex indices within body; 2-4: forces;
+                      // 5-8: cached space-frame unit vector and length
   int nedge;          // number of edge in list
   int edmax;          // allocated size of edge list
   int *ednum;         // number of edges per line, 0 if uninit
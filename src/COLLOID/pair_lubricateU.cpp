@@ -63,6 +63,9 @@ PairLubricateU::PairLubricateU(LAMMPS *lmp) : Pair(lmp)
   cgmax = 0;
   bcg = xcg = rcg = rcg1 = pcg = RU =  NULL;
 
+  ncachemax = 0;
+  resist = NULL;
+
   // set comm size needed by this Pair
 
   comm_forward = 6;
@@ -83,6 +86,8 @@ PairLubricateU::~PairLubricateU()
   memory->destroy(pcg);
   memory->destroy(RU);
 
+  memory->destroy(resist);
+
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
@@ -210,6 +215,11 @@ void PairLubricateU::stage_one()
   double normi,error,normig;
   double send[2],recv[2],rcg_dot_rcg;
 
+  // Cache the pair separations and scalar resistances for this
+  // configuration, used by compute_RE and every compute_RU below
+
+  cache_resistances(x);
+
   // First compute R_FE*E
 
   compute_RE();
@@ -234,12 +244,18 @@ void PairLubricateU::stage_one()
   // Start solving the equation : F^H = -F^P -F^B - F^H_{Ef}
   // Store initial guess for velocity and angular-velocities/angular momentum
   // NOTE velocities and angular velocities are assumed relative to the fluid
+  // warm start from the previous step's converged velocities,
+  // converted back to fluid-relative values
 
-  for (ii=0;ii<inum;ii++)
-    for (j=0;j<3;j++) {
-      xcg[6*ii+j] = 0.0;
-      xcg[6*ii+j+3] = 0.0;
-    }
+  for (ii=0;ii<inum;ii++) {
+    i = ilist[ii];
+    xcg[6*ii] = v[i][0] - gdot*x[i][1];
+    xcg[6*ii+1] = v[i][1];
+    xcg[6*ii+2] = v[i][2];
+    xcg[6*ii+3] = omega[i][0];
+    xcg[6*ii+4] = omega[i][1];
+    xcg[6*ii+5] = omega[i][2] + gdot/2.0;
+  }
 
   // Copy initial guess to the global arrays to be acted upon by R_{FU}
   // and returned by f and torque arrays
@@ -394,6 +410,10 @@ void PairLubricateU::stage_two(double **x)
   double normi,error,normig;
   double send[2],recv[2],rcg_dot_rcg;
 
+  // Re-cache the resistances for the intermediate positions
+
+  cache_resistances(x);
+
   // First compute R_FE*E
 
   compute_RE(x);
@@ -418,12 +438,18 @@ void PairLubricateU::stage_two(double **x)
   // Start solving the equation : F^H = -F^P -F^B - F^H_{Ef}
   // Store initial guess for velocity and angular-velocities/angular momentum
   // NOTE velocities and angular velocities are assumed relative to the fluid
+  // warm start from the stage-one solution,
+  // converted back to fluid-relative values
 
-  for (ii=0;ii<inum;ii++)
-    for (j=0;j<3;j++) {
-      xcg[6*ii+j] = 0.0;
-      xcg[6*ii+j+3] = 0.0;
-    }
+  for (ii=0;ii<inum;ii++) {
+    i = ilist[ii];
+    xcg[6*ii] = v[i][0] - gdot*x[i][1];
+    xcg[6*ii+1] = v[i][1];
+    xcg[6*ii+2] = v[i][2];
+    xcg[6*ii+3] = omega[i][0];
+    xcg[6*ii+4] = omega[i][1];
+    xcg[6*ii+5] = omega[i][2] + gdot/2.0;
+  }
 
   // Copy initial guess to the global arrays to be acted upon by R_{FU}
   // and returned by f and torque arrays
@@ -542,6 +568,146 @@ void PairLubricateU::stage_two(double **x)
   }
 }
 
+/* ------------------------------------------------------------------------
+   Precompute the pair separations and scalar resistances for the current
+   configuration. They depend only on positions, which are fixed during a
+   CG solve, so each call to compute_RE/compute_RU applies them from this
+   cache instead of re-deriving them pair by pair.
+   One cache entry per neighbor-list slot; r = 0.0 flags a pair beyond
+   the cutoff.
+   ------------------------------------------------------------------------- */
+
+void PairLubricateU::cache_resistances(double **x)
+{
+  int i,j,ii,jj,inum,jnum,itype,jtype,nc;
+  double xtmp,ytmp,ztmp,delx,dely,delz;
+  double rsq,r,h_sep,radi;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+
+  double *radius = atom->radius;
+  int *type = atom->type;
+
+  inum = list->inum;
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  // This section of code adjusts R0/RT0/RS0 if necessary due to changes
+  // in the volume fraction as a result of fix deform or moving walls
+
+  double dims[3], wallcoord;
+  if (flagVF) // Flag for volume fraction corrections
+    if (flagdeform || flagwall == 2){ // Possible changes in volume fraction
+      if (flagdeform && !flagwall)
+        for (j = 0; j < 3; j++)
+          dims[j] = domain->prd[j];
+      else if (flagwall == 2 || (flagdeform && flagwall == 1)){
+         double wallhi[3], walllo[3];
+         for (int j = 0; j < 3; j++){
+           wallhi[j] = domain->prd[j];
+           walllo[j] = 0;
+         }
+         for (int m = 0; m < wallfix->nwall; m++){
+           int dim = wallfix->wallwhich[m] / 2;
+           int side = wallfix->wallwhich[m] % 2;
+           if (wallfix->xstyle[m] == VARIABLE){
+             wallcoord = input->variable->compute_equal(wallfix->xindex[m]);
+           }
+           else wallcoord = wallfix->coord0[m];
+           if (side == 0) walllo[dim] = wallcoord;
+           else wallhi[dim] = wallcoord;
+         }
+         for (int j = 0; j < 3; j++)
+           dims[j] = wallhi[j] - walllo[j];
+      }
+      double vol_T = dims[0]*dims[1]*dims[2];
+      double vol_f = vol_P/vol_T;
+      if (flaglog == 0) {
+        R0  = 6*MY_PI*mu*rad*(1.0 + 2.16*vol_f);
+        RT0 = 8*MY_PI*mu*pow(rad,3.0);
+      } else {
+        R0  = 6*MY_PI*mu*rad*(1.0 + 2.725*vol_f - 6.583*vol_f*vol_f);
+        RT0 = 8*MY_PI*mu*pow(rad,3.0)*(1.0 + 0.749*vol_f - 2.469*vol_f*vol_f);
+      }
+    }
+
+  // end of R0 adjustment code
+
+  if (!flagHI) return;
+
+  // grow the cache if necessary: one entry per neighbor-list slot
+
+  nc = 0;
+  for (ii = 0; ii < inum; ii++) nc += numneigh[ilist[ii]];
+
+  if (nc > ncachemax) {
+    memory->destroy(resist);
+    ncachemax = nc;
+    memory->create(resist,ncachemax,7,"pair:resist");
+  }
+
+  nc = 0;
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    itype = type[i];
+    radi = radius[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      jtype = type[j];
+
+      if (rsq >= cutsq[itype][jtype]) {
+        resist[nc++][3] = 0.0;
+        continue;
+      }
+
+      r = sqrt(rsq);
+
+      // Find the scalar resistances a_sq, a_sh and a_pu
+
+      h_sep = r - 2.0*radi;
+
+      // If less than the minimum gap use the minimum gap instead
+
+      if (r < cut_inner[itype][jtype])
+        h_sep = cut_inner[itype][jtype] - 2.0*radi;
+
+      // Scale h_sep by radi
+
+      h_sep = h_sep/radi;
+
+      resist[nc][0] = delx;
+      resist[nc][1] = dely;
+      resist[nc][2] = delz;
+      resist[nc][3] = r;
+
+      if (flaglog) {
+        resist[nc][4] = 6.0*MY_PI*mu*radi*
+          (1.0/4.0/h_sep + 9.0/40.0*log(1.0/h_sep));
+        resist[nc][5] = 6.0*MY_PI*mu*radi*(1.0/6.0*log(1.0/h_sep));
+        resist[nc][6] = 8.0*MY_PI*mu*pow(radi,3.0)*(3.0/160.0*log(1.0/h_sep));
+      } else {
+        resist[nc][4] = 6.0*MY_PI*mu*radi*(1.0/4.0/h_sep);
+        resist[nc][5] = 0.0;
+        resist[nc][6] = 0.0;
+      }
+
+      nc++;
+    }
+  }
+}
+
 /* ------------------------------------------------------------------------
    This function computes the final hydrodynamic force once the
    velocities have converged.
@@ -782,75 +948,31 @@ void PairLubricateU::compute_Fh(double **x)
 
 void PairLubricateU::compute_RU()
 {
-  int i,j,ii,jj,inum,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,fx,fy,fz,tx,ty,tz;
-  double rsq,r,h_sep,radi;
+  int i,j,ii,jj,inum,jnum,nc;
+  double delx,dely,delz,fx,fy,fz,tx,ty,tz;
+  double r,radi;
   double vr1,vr2,vr3,vnnr,vn1,vn2,vn3;
   double vt1,vt2,vt3,wdotn,wt1,wt2,wt3;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
-  double **x = atom->x;
   double **v = atom->v;
   double **f = atom->f;
   double **omega = atom->omega;
   double **torque = atom->torque;
   double *radius = atom->radius;
-  int *type = atom->type;
   int nlocal = atom->nlocal;
   int nghost = atom->nghost;
   int newton_pair = force->newton_pair;
 
   double vxmu2f = force->vxmu2f;
   double vi[3],vj[3],wi[3],wj[3],xl[3],a_sq,a_sh,a_pu;
+  double *rc;
 
   inum = list->inum;
   ilist = list->ilist;
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
-  // This section of code adjusts R0/RT0/RS0 if necessary due to changes
-  // in the volume fraction as a result of fix deform or moving walls
-
-  double dims[3], wallcoord;
-  if (flagVF) // Flag for volume fraction corrections
-    if (flagdeform || flagwall == 2){ // Possible changes in volume fraction
-      if (flagdeform && !flagwall)
-        for (j = 0; j < 3; j++)
-          dims[j] = domain->prd[j];
-      else if (flagwall == 2 || (flagdeform && flagwall == 1)){
-         double wallhi[3], walllo[3];
-         for (int j = 0; j < 3; j++){
-           wallhi[j] = domain->prd[j];
-           walllo[j] = 0;
-         }
-         for (int m = 0; m < wallfix->nwall; m++){
-           int dim = wallfix->wallwhich[m] / 2;
-           int side = wallfix->wallwhich[m] % 2;
-           if (wallfix->xstyle[m] == VARIABLE){
-             wallcoord = input->variable->compute_equal(wallfix->xindex[m]);
-           }
-           else wallcoord = wallfix->coord0[m];
-           if (side == 0) walllo[dim] = wallcoord;
-           else wallhi[dim] = wallcoord;
-         }
-         for (int j = 0; j < 3; j++)
-           dims[j] = wallhi[j] - walllo[j];
-      }
-      double vol_T = dims[0]*dims[1]*dims[2];
-      double vol_f = vol_P/vol_T;
-      if (flaglog == 0) {
-        R0  = 6*MY_PI*mu*rad*(1.0 + 2.16*vol_f);
-        RT0 = 8*MY_PI*mu*pow(rad,3.0);
-        //        RS0 = 20.0/3.0*MY_PI*mu*pow(rad,3)*(1.0 + 3.33*vol_f + 2.80*vol_f*vol_f);
-      } else {
-        R0  = 6*MY_PI*mu*rad*(1.0 + 2.725*vol_f - 6.583*vol_f*vol_f);
-        RT0 = 8*MY_PI*mu*pow(rad,3.0)*(1.0 + 0.749*vol_f - 2.469*vol_f*vol_f);
-        //        RS0 = 20.0/3.0*MY_PI*mu*pow(rad,3)*(1.0 + 3.64*vol_f - 6.95*vol_f*vol_f);
-      }
-    }
-
-  // end of R0 adjustment code
-
   // Initialize f to zero
   for (i=0;i<nlocal+nghost;i++)
     for (j=0;j<3;j++) {
@@ -858,12 +980,10 @@ void PairLubricateU::compute_RU()
       torque[i][j] = 0.0;
     }
 
+  nc = 0;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
     radi = radius[i];
     jlist = firstneigh[i];
     jnum = numneigh[i];
@@ -889,15 +1009,19 @@ void PairLubricateU::compute_RU()
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       j &= NEIGHMASK;
+      rc = resist[nc++];
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
-      jtype = type[j];
+      // cached separation and scalar resistances for this pair
+      // rc[3] = 0.0 flags a pair beyond the cutoff
 
-      if (rsq < cutsq[itype][jtype]) {
-        r = sqrt(rsq);
+      if (rc[3] != 0.0) {
+        delx = rc[0];
+        dely = rc[1];
+        delz = rc[2];
+        r = rc[3];
+        a_sq = rc[4];
+        a_sh = rc[5];
+        a_pu = rc[6];
 
         // Use omega directly if it exists, else angmom
         // angular momentum = I*omega = 2/5 * M*R^2 * omega
@@ -927,28 +1051,6 @@ void PairLubricateU::compute_RU()
         vj[1] = v[j][1] - (wj[2]*xl[0] - wj[0]*xl[2]);
         vj[2] = v[j][2] - (wj[0]*xl[1] - wj[1]*xl[0]);
 
-        // Find the scalar resistances a_sq and a_sh
-
-        h_sep = r - 2.0*radi;
-
-        // If less than the minimum gap use the minimum gap instead
-
-        if (r < cut_inner[itype][jtype])
-          h_sep = cut_inner[itype][jtype] - 2.0*radi;
-
-        // Scale h_sep by radi
-
-        h_sep = h_sep/radi;
-
-        // Scalar resistances
-
-        if (flaglog) {
-          a_sq = 6.0*MY_PI*mu*radi*(1.0/4.0/h_sep + 9.0/40.0*log(1.0/h_sep));
-          a_sh = 6.0*MY_PI*mu*radi*(1.0/6.0*log(1.0/h_sep));
-          a_pu = 8.0*MY_PI*mu*pow(radi,3.0)*(3.0/160.0*log(1.0/h_sep));
-        } else
-          a_sq = 6.0*MY_PI*mu*radi*(1.0/4.0/h_sep);
-
         // Relative  velocity at the point of closest approach
 
         vr1 = vi[0] - vj[0];
@@ -1052,11 +1154,11 @@ void PairLubricateU::compute_RU()
   computes R_FU * U
 ---------------------------------------------------------------------- */
 
-void PairLubricateU::compute_RU(double **x)
+void PairLubricateU::compute_RU(double ** /*x*/)
 {
-  int i,j,ii,jj,inum,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,fx,fy,fz,tx,ty,tz;
-  double rsq,r,h_sep,radi;
+  int i,j,ii,jj,inum,jnum,nc;
+  double delx,dely,delz,fx,fy,fz,tx,ty,tz;
+  double r,radi;
   double vr1,vr2,vr3,vnnr,vn1,vn2,vn3;
   double vt1,vt2,vt3,wdotn,wt1,wt2,wt3;
   int *ilist,*jlist,*numneigh,**firstneigh;
@@ -1066,62 +1168,19 @@ void PairLubricateU::compute_RU(double **x)
   double **omega = atom->omega;
   double **torque = atom->torque;
   double *radius = atom->radius;
-  int *type = atom->type;
   int nlocal = atom->nlocal;
   int nghost = atom->nghost;
   int newton_pair = force->newton_pair;
 
   double vxmu2f = force->vxmu2f;
   double vi[3],vj[3],wi[3],wj[3],xl[3],a_sq,a_sh,a_pu;
+  double *rc;
 
   inum = list->inum;
   ilist = list->ilist;
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
-  // This section of code adjusts R0/RT0/RS0 if necessary due to changes
-  // in the volume fraction as a result of fix deform or moving walls
-
-  double dims[3], wallcoord;
-  if (flagVF) // Flag for volume fraction corrections
-    if (flagdeform || flagwall == 2){ // Possible changes in volume fraction
-      if (flagdeform && !flagwall)
-        for (j = 0; j < 3; j++)
-          dims[j] = domain->prd[j];
-      else if (flagwall == 2 || (flagdeform && flagwall == 1)){
-         double wallhi[3], walllo[3];
-         for (int j = 0; j < 3; j++){
-           wallhi[j] = domain->prd[j];
-           walllo[j] = 0;
-         }
-         for (int m = 0; m < wallfix->nwall; m++){
-           int dim = wallfix->wallwhich[m] / 2;
-           int side = wallfix->wallwhich[m] % 2;
-           if (wallfix->xstyle[m] == VARIABLE){
-             wallcoord = input->variable->compute_equal(wallfix->xindex[m]);
-           }
-           else wallcoord = wallfix->coord0[m];
-           if (side == 0) walllo[dim] = wallcoord;
-           else wallhi[dim] = wallcoord;
-         }
-         for (int j = 0; j < 3; j++)
-           dims[j] = wallhi[j] - walllo[j];
-      }
-      double vol_T = dims[0]*dims[1]*dims[2];
-      double vol_f = vol_P/vol_T;
-      if (flaglog == 0) {
-        R0  = 6*MY_PI*mu*rad*(1.0 + 2.16*vol_f);
-        RT0 = 8*MY_PI*mu*pow(rad,3.0);
-        //        RS0 = 20.0/3.0*MY_PI*mu*pow(rad,3)*(1.0 + 3.33*vol_f + 2.80*vol_f*vol_f);
-      } else {
-        R0  = 6*MY_PI*mu*rad*(1.0 + 2.725*vol_f - 6.583*vol_f*vol_f);
-        RT0 = 8*MY_PI*mu*pow(rad,3.0)*(1.0 + 0.749*vol_f - 2.469*vol_f*vol_f);
-        //        RS0 = 20.0/3.0*MY_PI*mu*pow(rad,3)*(1.0 + 3.64*vol_f - 6.95*vol_f*vol_f);
-      }
-    }
-
-  // end of R0 adjustment code
-
   // Initialize f to zero
   for (i=0;i<nlocal+nghost;i++)
     for (j=0;j<3;j++) {
@@ -1129,12 +1188,10 @@ void PairLubricateU::compute_RU(double **x)
       torque[i][j] = 0.0;
     }
 
+  nc = 0;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
     radi = radius[i];
     jlist = firstneigh[i];
     jnum = numneigh[i];
@@ -1160,15 +1217,19 @@ void PairLubricateU::compute_RU(double **x)
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       j &= NEIGHMASK;
+      rc = resist[nc++];
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
-      jtype = type[j];
+      // cached separation and scalar resistances for this pair
+      // rc[3] = 0.0 flags a pair beyond the cutoff
 
-      if (rsq < cutsq[itype][jtype]) {
-        r = sqrt(rsq);
+      if (rc[3] != 0.0) {
+        delx = rc[0];
+        dely = rc[1];
+        delz = rc[2];
+        r = rc[3];
+        a_sq = rc[4];
+        a_sh = rc[5];
+        a_pu = rc[6];
 
         // Use omega directly if it exists, else angmom
         // angular momentum = I*omega = 2/5 * M*R^2 * omega
@@ -1198,28 +1259,6 @@ void PairLubricateU::compute_RU(double **x)
         vj[1] = v[j][1] - (wj[2]*xl[0] - wj[0]*xl[2]);
         vj[2] = v[j][2] - (wj[0]*xl[1] - wj[1]*xl[0]);
 
-        // Find the scalar resistances a_sq and a_sh
-
-        h_sep = r - 2.0*radi;
-
-        // If less than the minimum gap use the minimum gap instead
-
-        if (r < cut_inner[itype][jtype])
-          h_sep = cut_inner[itype][jtype] - 2.0*radi;
-
-        // Scale h_sep by radi
-
-        h_sep = h_sep/radi;
-
-        // Scalar resistances
-
-        if (flaglog) {
-          a_sq = 6.0*MY_PI*mu*radi*(1.0/4.0/h_sep + 9.0/40.0*log(1.0/h_sep));
-          a_sh = 6.0*MY_PI*mu*radi*(1.0/6.0*log(1.0/h_sep));
-          a_pu = 8.0*MY_PI*mu*pow(radi,3.0)*(3.0/160.0*log(1.0/h_sep));
-        } else
-          a_sq = 6.0*MY_PI*mu*radi*(1.0/4.0/h_sep);
-
         // Relative  velocity at the point of closest approach
 
         vr1 = vi[0] - vj[0];
@@ -1328,23 +1367,22 @@ void PairLubricateU::compute_RU(double **x)
 
 void PairLubricateU::compute_RE()
 {
-  int i,j,ii,jj,inum,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,fx,fy,fz,tx,ty,tz;
-  double rsq,r,h_sep,radi;
+  int i,j,ii,jj,inum,jnum,nc;
+  double delx,dely,delz,fx,fy,fz,tx,ty,tz;
+  double r,radi;
   double vr1,vr2,vr3,vnnr,vn1,vn2,vn3;
   double vt1,vt2,vt3;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
-  double **x = atom->x;
   double **f = atom->f;
   double **torque = atom->torque;
   double *radius = atom->radius;
-  int *type = atom->type;
   int nlocal = atom->nlocal;
   int newton_pair = force->newton_pair;
 
   double vxmu2f = force->vxmu2f;
   double xl[3],a_sq,a_sh;
+  double *rc;
 
   inum = list->inum;
   ilist = list->ilist;
@@ -1353,12 +1391,10 @@ void PairLubricateU::compute_RE()
 
   if (!flagHI) return;
 
+  nc = 0;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
     radi = radius[i];
     jlist = firstneigh[i];
     jnum = numneigh[i];
@@ -1368,15 +1404,18 @@ void PairLubricateU::compute_RE()
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       j &= NEIGHMASK;
+      rc = resist[nc++];
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
-      jtype = type[j];
+      // cached separation and scalar resistances for this pair
+      // rc[3] = 0.0 flags a pair beyond the cutoff
 
-      if (rsq < cutsq[itype][jtype]) {
-        r = sqrt(rsq);
+      if (rc[3] != 0.0) {
+        delx = rc[0];
+        dely = rc[1];
+        delz = rc[2];
+        r = rc[3];
+        a_sq = rc[4];
+        a_sh = rc[5];
 
         // loc of the point of closest approach on particle i from its center
 
@@ -1384,32 +1423,6 @@ void PairLubricateU::compute_RE()
         xl[1] = -dely/r*radi;
         xl[2] = -delz/r*radi;
 
-        // Find the scalar resistances a_sq and a_sh
-
-        h_sep = r - 2.0*radi;
-
-        // If less than the minimum gap use the minimum gap instead
-
-        if (r < cut_inner[itype][jtype])
-          h_sep = cut_inner[itype][jtype] - 2.0*radi;
-
-        // Scale h_sep by radi
-
-        h_sep = h_sep/radi;
-
-        // Scalar resistance for Squeeze type motions
-
-        if (flaglog)
-          a_sq = 6*MY_PI*mu*radi*(1.0/4.0/h_sep + 9.0/40.0*log(1/h_sep));
-        else
-          a_sq = 6*MY_PI*mu*radi*(1.0/4.0/h_sep);
-
-        // Scalar resistance for Shear type motions
-
-        if (flaglog) {
-          a_sh = 6*MY_PI*mu*radi*(1.0/6.0*log(1/h_sep));
-        }
-
         // Relative velocity at the point of closest approach due to Ef only
 
         vr1 = -2.0*(Ef[0][0]*xl[0] + Ef[0][1]*xl[1] + Ef[0][2]*xl[2]);
@@ -1492,11 +1505,11 @@ void PairLubricateU::compute_RE()
    transferred to the RHS
    ---------------------------------------------------------------------- */
 
-void PairLubricateU::compute_RE(double **x)
+void PairLubricateU::compute_RE(double ** /*x*/)
 {
-  int i,j,ii,jj,inum,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,fx,fy,fz,tx,ty,tz;
-  double rsq,r,h_sep,radi;
+  int i,j,ii,jj,inum,jnum,nc;
+  double delx,dely,delz,fx,fy,fz,tx,ty,tz;
+  double r,radi;
   double vr1,vr2,vr3,vnnr,vn1,vn2,vn3;
   double vt1,vt2,vt3;
   int *ilist,*jlist,*numneigh,**firstneigh;
@@ -1504,12 +1517,12 @@ void PairLubricateU::compute_RE(double **x)
   double **f = atom->f;
   double **torque = atom->torque;
   double *radius = atom->radius;
-  int *type = atom->type;
   int nlocal = atom->nlocal;
   int newton_pair = force->newton_pair;
 
   double vxmu2f = force->vxmu2f;
   double xl[3],a_sq,a_sh;
+  double *rc;
 
   if (!flagHI) return;
 
@@ -1518,12 +1531,10 @@ void PairLubricateU::compute_RE(double **x)
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
+  nc = 0;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
     radi = radius[i];
     jlist = firstneigh[i];
     jnum = numneigh[i];
@@ -1533,15 +1544,18 @@ void PairLubricateU::compute_RE(double **x)
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       j &= NEIGHMASK;
+      rc = resist[nc++];
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
-      jtype = type[j];
+      // cached separation and scalar resistances for this pair
+      // rc[3] = 0.0 flags a pair beyond the cutoff
 
-      if (rsq < cutsq[itype][jtype]) {
-        r = sqrt(rsq);
+      if (rc[3] != 0.0) {
+        delx = rc[0];
+        dely = rc[1];
+        delz = rc[2];
+        r = rc[3];
+        a_sq = rc[4];
+        a_sh = rc[5];
 
         // loc of the point of closest approach on particle i from its center
 
@@ -1549,32 +1563,6 @@ void PairLubricateU::compute_RE(double **x)
         xl[1] = -dely/r*radi;
         xl[2] = -delz/r*radi;
 
-        // Find the scalar resistances a_sq and a_sh
-
-        h_sep = r - 2.0*radi;
-
-        // If less than the minimum gap use the minimum gap instead
-
-        if (r < cut_inner[itype][jtype])
-          h_sep = cut_inner[itype][jtype] - 2.0*radi;
-
-        // Scale h_sep by radi
-
-        h_sep = h_sep/radi;
-
-        // Scalar resistance for Squeeze type motions
-
-        if (flaglog)
-          a_sq = 6*MY_PI*mu*radi*(1.0/4.0/h_sep + 9.0/40.0*log(1/h_sep));
-        else
-          a_sq = 6*MY_PI*mu*radi*(1.0/4.0/h_sep);
-
-        // Scalar resistance for Shear type motions
-
-        if (flaglog) {
-          a_sh = 6*MY_PI*mu*radi*(1.0/6.0*log(1/h_sep));
-        }
-
         // Relative velocity at the point of closest approach due to Ef only
 
         vr1 = -2.0*(Ef[0][0]*xl[0] + Ef[0][1]*xl[1] + Ef[0][2]*xl[2]);
@@ -61,6 +61,10 @@ class PairLubricateU : public Pair {
   int cgmax;
   double *bcg,*xcg,*rcg,*rcg1,*pcg,*RU;
 
+  int ncachemax;
+  double **resist;
+
+  void cache_resistances(double **);
   void compute_RE();
   virtual void compute_RE(double **);
   void compute_RU();
@@ -308,6 +308,8 @@ void ComputeTempCS::vcm_pairs()
 
   // vcm = COM velocity of each CS pair
   // vint = internal velocity of each C/S atom, used as bias
+  // when both partners are local the pair is processed once, on the
+  // visit to the lower index, which sets vint for both atoms
 
   double **v = atom->v;
   int *mask = atom->mask;
@@ -321,16 +323,21 @@ void ComputeTempCS::vcm_pairs()
   for (i = 0; i < nlocal; i++) {
     if ((mask[i] & groupbit) &&
         (mask[i] & groupbit_c || mask[i] & groupbit_s)) {
+      partnerID = (tagint) ubuf(partner[i]).i;
+      j = atom->map(partnerID);
+      if (j == -1) error->one(FLERR,"Core/shell partner atom not found");
+
+      // skip if vint[i] was already set on the visit to partner j
+
+      if (j < i && j < nlocal && (mask[j] & groupbit) &&
+          (mask[j] & groupbit_c || mask[j] & groupbit_s)) continue;
+
       if (rmass) massone = rmass[i];
       else massone = mass[type[i]];
       vcm[0] = v[i][0]*massone;
       vcm[1] = v[i][1]*massone;
       vcm[2] = v[i][2]*massone;
 
-      partnerID = (tagint) ubuf(partner[i]).i;
-      j = atom->map(partnerID);
-      if (j == -1) error->one(FLERR,"Core/shell partner atom not found");
-
       if (rmass) masstwo = rmass[j];
       else masstwo = mass[type[j]];
       vcm[0] += v[j][0]*masstwo;
@@ -343,6 +350,16 @@ void ComputeTempCS::vcm_pairs()
       vint[i][0] = v[i][0] - vcm[0];
       vint[i][1] = v[i][1] - vcm[1];
       vint[i][2] = v[i][2] - vcm[2];
+
+      // set the partner's vint from the same COM velocity
+      // only if the partner is local and also in the compute group
+
+      if (j > i && j < nlocal && (mask[j] & groupbit) &&
+          (mask[j] & groupbit_c || mask[j] & groupbit_s)) {
+        vint[j][0] = v[j][0] - vcm[0];
+        vint[j][1] = v[j][1] - vcm[1];
+        vint[j][2] = v[j][2] - vcm[2];
+      }
     } else vint[i][0] = vint[i][1] = vint[i][2] = 0.0;
   }
 }
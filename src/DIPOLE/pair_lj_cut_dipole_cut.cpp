@@ -61,7 +61,8 @@ PairLJCutDipoleCut::~PairLJCutDipoleCut()
 void PairLJCutDipoleCut::compute(int eflag, int vflag)
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
-  double qtmp,xtmp,ytmp,ztmp,delx,dely,delz,evdwl,ecoul,fx,fy,fz;
+  double qtmp,xtmp,ytmp,ztmp,muix,muiy,muiz;
+  double delx,dely,delz,evdwl,ecoul,fx,fy,fz;
   double rsq,rinv,r2inv,r6inv,r3inv,r5inv,r7inv;
   double forcecoulx,forcecouly,forcecoulz,crossx,crossy,crossz;
   double tixcoul,tiycoul,tizcoul,tjxcoul,tjycoul,tjzcoul;
@@ -97,6 +98,9 @@ void PairLJCutDipoleCut::compute(int eflag, int vflag)
     xtmp = x[i][0];
     ytmp = x[i][1];
     ztmp = x[i][2];
+    muix = mu[i][0];
+    muiy = mu[i][1];
+    muiz = mu[i][2];
     itype = type[i];
     jlist = firstneigh[i];
     jnum = numneigh[i];
@@ -119,81 +123,51 @@ void PairLJCutDipoleCut::compute(int eflag, int vflag)
 
         // atom can have both a charge and dipole
         // i,j = charge-charge, dipole-dipole, dipole-charge, or charge-dipole
-
-        forcecoulx = forcecouly = forcecoulz = 0.0;
-        tixcoul = tiycoul = tizcoul = 0.0;
-        tjxcoul = tjycoul = tjzcoul = 0.0;
+        // the four terms are fused into one straight-line kernel:
+        // accumulate the coefficients of r_ij, mu_i and mu_j across all
+        // terms, then assemble force and torque once per pair
+        // terms with a zero charge or zero dipole vanish identically,
+        // so no per-term branches are needed and the loop vectorizes
 
         if (rsq < cut_coulsq[itype][jtype]) {
-
-          if (qtmp != 0.0 && q[j] != 0.0) {
-            r3inv = r2inv*rinv;
-            pre1 = qtmp*q[j]*r3inv;
-
-            forcecoulx += pre1*delx;
-            forcecouly += pre1*dely;
-            forcecoulz += pre1*delz;
-          }
-
-          if (mu[i][3] > 0.0 && mu[j][3] > 0.0) {
-            r3inv = r2inv*rinv;
-            r5inv = r3inv*r2inv;
-            r7inv = r5inv*r2inv;
-
-            pdotp = mu[i][0]*mu[j][0] + mu[i][1]*mu[j][1] + mu[i][2]*mu[j][2];
-            pidotr = mu[i][0]*delx + mu[i][1]*dely + mu[i][2]*delz;
-            pjdotr = mu[j][0]*delx + mu[j][1]*dely + mu[j][2]*delz;
-
-            pre1 = 3.0*r5inv*pdotp - 15.0*r7inv*pidotr*pjdotr;
-            pre2 = 3.0*r5inv*pjdotr;
-            pre3 = 3.0*r5inv*pidotr;
-            pre4 = -1.0*r3inv;
-
-            forcecoulx += pre1*delx + pre2*mu[i][0] + pre3*mu[j][0];
-            forcecouly += pre1*dely + pre2*mu[i][1] + pre3*mu[j][1];
-            forcecoulz += pre1*delz + pre2*mu[i][2] + pre3*mu[j][2];
-
-            crossx = pre4 * (mu[i][1]*mu[j][2] - mu[i][2]*mu[j][1]);
-            crossy = pre4 * (mu[i][2]*mu[j][0] - mu[i][0]*mu[j][2]);
-            crossz = pre4 * (mu[i][0]*mu[j][1] - mu[i][1]*mu[j][0]);
-
-            tixcoul += crossx + pre2 * (mu[i][1]*delz - mu[i][2]*dely);
-            tiycoul += crossy + pre2 * (mu[i][2]*delx - mu[i][0]*delz);
-            tizcoul += crossz + pre2 * (mu[i][0]*dely - mu[i][1]*delx);
-            tjxcoul += -crossx + pre3 * (mu[j][1]*delz - mu[j][2]*dely);
-            tjycoul += -crossy + pre3 * (mu[j][2]*delx - mu[j][0]*delz);
-            tjzcoul += -crossz + pre3 * (mu[j][0]*dely - mu[j][1]*delx);
-          }
-
-          if (mu[i][3] > 0.0 && q[j] != 0.0) {
-            r3inv = r2inv*rinv;
-            r5inv = r3inv*r2inv;
-            pidotr = mu[i][0]*delx + mu[i][1]*dely + mu[i][2]*delz;
-            pre1 = 3.0*q[j]*r5inv * pidotr;
-            pre2 = q[j]*r3inv;
-
-            forcecoulx += pre2*mu[i][0] - pre1*delx;
-            forcecouly += pre2*mu[i][1] - pre1*dely;
-            forcecoulz += pre2*mu[i][2] - pre1*delz;
-            tixcoul += pre2 * (mu[i][1]*delz - mu[i][2]*dely);
-            tiycoul += pre2 * (mu[i][2]*delx - mu[i][0]*delz);
-            tizcoul += pre2 * (mu[i][0]*dely - mu[i][1]*delx);
-          }
-
-          if (mu[j][3] > 0.0 && qtmp != 0.0) {
-            r3inv = r2inv*rinv;
-            r5inv = r3inv*r2inv;
-            pjdotr = mu[j][0]*delx + mu[j][1]*dely + mu[j][2]*delz;
-            pre1 = 3.0*qtmp*r5inv * pjdotr;
-            pre2 = qtmp*r3inv;
-
-            forcecoulx += pre1*delx - pre2*mu[j][0];
-            forcecouly += pre1*dely - pre2*mu[j][1];
-            forcecoulz += pre1*delz - pre2*mu[j][2];
-            tjxcoul += -pre2 * (mu[j][1]*delz - mu[j][2]*dely);
-            tjycoul += -pre2 * (mu[j][2]*delx - mu[j][0]*delz);
-            tjzcoul += -pre2 * (mu[j][0]*dely - mu[j][1]*delx);
-          }
+          r3inv = r2inv*rinv;
+          r5inv = r3inv*r2inv;
+          r7inv = r5inv*r2inv;
+
+          pdotp = muix*mu[j][0] + muiy*mu[j][1] + muiz*mu[j][2];
+          pidotr = muix*delx + muiy*dely + muiz*delz;
+          pjdotr = mu[j][0]*delx + mu[j][1]*dely + mu[j][2]*delz;
+
+          // pre1,pre2,pre3 = coefficients of r_ij, mu_i, mu_j in the force
+          // pre2,pre3 also scale mu_i x r_ij and mu_j x r_ij in the torques
+          // pre4 = coefficient of mu_i x mu_j
+
+          pre1 = qtmp*q[j]*r3inv +
+            3.0*r5inv*pdotp - 15.0*r7inv*pidotr*pjdotr +
+            3.0*r5inv*(qtmp*pjdotr - q[j]*pidotr);
+          pre2 = 3.0*r5inv*pjdotr + q[j]*r3inv;
+          pre3 = 3.0*r5inv*pidotr - qtmp*r3inv;
+          pre4 = -1.0*r3inv;
+
+          forcecoulx = pre1*delx + pre2*muix + pre3*mu[j][0];
+          forcecouly = pre1*dely + pre2*muiy + pre3*mu[j][1];
+          forcecoulz = pre1*delz + pre2*muiz + pre3*mu[j][2];
+
+          crossx = pre4 * (muiy*mu[j][2] - muiz*mu[j][1]);
+          crossy = pre4 * (muiz*mu[j][0] - muix*mu[j][2]);
+          crossz = pre4 * (muix*mu[j][1] - muiy*mu[j][0]);
+
+          tixcoul = crossx + pre2 * (muiy*delz - muiz*dely);
+          tiycoul = crossy + pre2 * (muiz*delx - muix*delz);
+          tizcoul = crossz + pre2 * (muix*dely - muiy*delx);
+          tjxcoul = -crossx + pre3 * (mu[j][1]*delz - mu[j][2]*dely);
+          tjycoul = -crossy + pre3 * (mu[j][2]*delx - mu[j][0]*delz);
+          tjzcoul = -crossz + pre3 * (mu[j][0]*dely - mu[j][1]*delx);
+
+        } else {
+          forcecoulx = forcecouly = forcecoulz = 0.0;
+          tixcoul = tiycoul = tizcoul = 0.0;
+          tjxcoul = tjycoul = tjzcoul = 0.0;
         }
 
         // LJ interaction
@@ -231,13 +205,9 @@ void PairLJCutDipoleCut::compute(int eflag, int vflag)
 
         if (eflag) {
           if (rsq < cut_coulsq[itype][jtype]) {
-            ecoul = qtmp*q[j]*rinv;
-            if (mu[i][3] > 0.0 && mu[j][3] > 0.0)
-              ecoul += r3inv*pdotp - 3.0*r5inv*pidotr*pjdotr;
-            if (mu[i][3] > 0.0 && q[j] != 0.0)
-              ecoul += -q[j]*r3inv*pidotr;
-            if (mu[j][3] > 0.0 && qtmp != 0.0)
-              ecoul += qtmp*r3inv*pjdotr;
+            ecoul = qtmp*q[j]*rinv +
+              r3inv*pdotp - 3.0*r5inv*pidotr*pjdotr +
+              r3inv*(qtmp*pjdotr - q[j]*pidotr);
             ecoul *= factor_coul*qqrd2e;
           } else ecoul = 0.0;
 
@@ -179,7 +179,7 @@ void PairLJCutTIP4PLongGPU::init_style()
   if (force->angle == NULL)
     error->all(FLERR,"Must use an angle style with TIP4P potential");
 
-  if (atom->map_style == 2)
+  if (atom->map_style != 1)
     error->all(FLERR,"GPU-accelerated lj/cut/tip4p/long currently"
         " requires map style 'array' (atom_modify map array)");
 
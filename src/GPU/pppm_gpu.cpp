@@ -92,6 +92,7 @@ void PPPM_GPU_API(forces)(double **f);
 PPPMGPU::PPPMGPU(LAMMPS *lmp) : PPPM(lmp)
 {
   density_brick_gpu = vd_brick = NULL;
+  fieldforce_overlap_ok = 0;
   kspace_split = false;
   im_real_space = false;
 
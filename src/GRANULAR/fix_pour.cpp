@@ -44,14 +44,15 @@ enum{CONSTANT,EQUAL};    // same as FixGravity
 
 #define EPSILON 0.001
 #define SMALL 1.0e-10
+#define DELTABIN 1024
 
 /* ---------------------------------------------------------------------- */
 
 FixPour::FixPour(LAMMPS *lmp, int narg, char **arg) :
   Fix(lmp, narg, arg), radius_poly(NULL), frac_poly(NULL),
   idrigid(NULL), idshake(NULL), onemols(NULL), molfrac(NULL), coords(NULL),
-  imageflags(NULL), fixrigid(NULL), fixshake(NULL), recvcounts(NULL),
-  displs(NULL), random(NULL), random2(NULL)
+  imageflags(NULL), fixrigid(NULL), fixshake(NULL), random(NULL),
+  random2(NULL), binhead(NULL), binnext(NULL), xbin(NULL)
 {
   if (narg < 6) error->all(FLERR,"Illegal fix pour command");
 
@@ -175,12 +176,7 @@ FixPour::FixPour(LAMMPS *lmp, int narg, char **arg) :
   random = new RanPark(lmp,seed);
   for (int ii=0; ii < 30; ii++) random->uniform();
 
-  // allgather arrays
-
   MPI_Comm_rank(world,&me);
-  MPI_Comm_size(world,&nprocs);
-  recvcounts = new int[nprocs];
-  displs = new int[nprocs];
 
   // grav = gravity in distance/time^2 units
   // assume grav = -magnitude at this point, enforce in init()
@@ -291,8 +287,6 @@ FixPour::~FixPour()
   delete [] frac_poly;
   memory->destroy(coords);
   memory->destroy(imageflags);
-  delete [] recvcounts;
-  delete [] displs;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -412,101 +406,132 @@ void FixPour::pre_exchange()
     hi_current = yhi + (update->ntimestep - nfirst) * update->dt * rate;
   }
 
-  // ncount = # of my atoms that overlap the insertion region
-  // nprevious = total of ncount across all procs
+  // find atoms of mine that could overlap an inserted particle
+  // also compute max radius of any such atom across all procs
+  //   which sets the bin size needed for conservative overlap checks
 
   int ncount = 0;
+  double radnear = 0.0;
   for (i = 0; i < atom->nlocal; i++)
-    if (overlap(i)) ncount++;
-
-  int nprevious;
-  MPI_Allreduce(&ncount,&nprevious,1,MPI_INT,MPI_SUM,world);
-
-  // xmine is for my atoms
-  // xnear is for atoms from all procs + atoms to be inserted
+    if (overlap(i)) {
+      ncount++;
+      radnear = MAX(radnear,atom->radius[i]);
+    }
 
-  double **xmine,**xnear;
-  memory->create(xmine,ncount,4,"fix_pour:xmine");
-  memory->create(xnear,nprevious+nnew*natom_max,4,"fix_pour:xnear");
-  int nnear = nprevious;
+  double radnearmax;
+  MPI_Allreduce(&radnear,&radnearmax,1,MPI_DOUBLE,MPI_MAX,world);
 
-  // setup for allgatherv
+  // radinsert = max radius of any single inserted atom
 
-  int n = 4*ncount;
-  MPI_Allgather(&n,1,MPI_INT,recvcounts,1,MPI_INT,world);
+  double radinsert = radius_max;
+  if (mode == MOLECULE) {
+    radinsert = 0.5;
+    for (i = 0; i < nmol; i++) {
+      if (!onemols[i]->radiusflag) continue;
+      for (m = 0; m < onemols[i]->natoms; m++)
+        radinsert = MAX(radinsert,onemols[i]->radius[m]);
+    }
+  }
 
-  displs[0] = 0;
-  for (int iproc = 1; iproc < nprocs; iproc++)
-    displs[iproc] = displs[iproc-1] + recvcounts[iproc-1];
+  // bin my nearby atoms over the extended insertion region
+  // periodic images that fall in the binned volume are stored explicitly
+  //   so overlap checks need no minimum_image() calls
 
-  // load up xmine array
+  double cutoff = radinsert + MAX(radnearmax,radinsert);
+  setup_overlap_bins(cutoff);
 
   double **x = atom->x;
   double *radius = atom->radius;
+  double pt[4];
 
-  ncount = 0;
   for (i = 0; i < atom->nlocal; i++)
     if (overlap(i)) {
-      xmine[ncount][0] = x[i][0];
-      xmine[ncount][1] = x[i][1];
-      xmine[ncount][2] = x[i][2];
-      xmine[ncount][3] = radius[i];
-      ncount++;
+      pt[0] = x[i][0];
+      pt[1] = x[i][1];
+      pt[2] = x[i][2];
+      pt[3] = radius[i];
+      add_to_bins(pt);
     }
 
-  // perform allgatherv to acquire list of nearby particles on all procs
-
-  double *ptr = NULL;
-  if (ncount) ptr = xmine[0];
-  MPI_Allgatherv(ptr,4*ncount,MPI_DOUBLE,
-                 xnear[0],recvcounts,displs,MPI_DOUBLE,world);
-
-  // insert new particles into xnear list, one by one
-  // check against all nearby atoms and previously inserted ones
-  // if there is an overlap then try again at same z (3d) or y (2d) coord
-  // else insert by adding to xnear list
-  // max = maximum # of insertion attempts for all particles
+  // insert new particles in batched rounds with conflict resolution
+  // each round, every proc generates one identical trial per particle
+  //   not yet placed, using the shared RNG
+  // each proc tests the trials only against its own binned atoms,
+  //   then one allreduce merges the per-trial verdicts
+  // surviving trials are accepted in order, each tested against trials
+  //   accepted earlier in this event, which every proc adds to its bins
+  // a rejected particle retries at the same height and radius next round
   // h = height, biased to give uniform distribution in time of insertion
   // for MOLECULE mode:
-  //   coords = coords of all atoms in particle
+  //   trial coords = coords of all atoms in particle
   //   perform random rotation around center pt
-  //   apply PBC so final coords are inside box
-  //   store image flag modified due to PBC
+  //   keep coords unwrapped for overlap checks (binned images handle PBC)
+  //   apply PBC below only when the accepted particle is created
 
-  int success;
-  double radtmp,delx,dely,delz,rsq,radsum,rn,h;
+  double radtmp,rn;
   double coord[3];
 
   double denstmp;
   double *sublo = domain->sublo;
   double *subhi = domain->subhi;
 
+  double **candcoord,**candcenter,**candquat;
+  double *hlist,*rlist;
+  int *candimol,*placed,*flaglocal,*flagall;
+  memory->create(candcoord,nnew*natom_max,4,"pour:candcoord");
+  memory->create(candcenter,nnew,3,"pour:candcenter");
+  memory->create(candquat,nnew,4,"pour:candquat");
+  memory->create(hlist,nnew,"pour:hlist");
+  memory->create(rlist,nnew,"pour:rlist");
+  memory->create(candimol,nnew,"pour:candimol");
+  memory->create(placed,nnew,"pour:placed");
+  memory->create(flaglocal,nnew,"pour:flaglocal");
+  memory->create(flagall,nnew,"pour:flagall");
+
+  for (m = 0; m < nnew; m++) {
+    rn = random->uniform();
+    hlist[m] = hi_current - rn*rn * (hi_current-lo_current);
+    if (mode == ATOM) rlist[m] = radius_sample();
+    placed[m] = 0;
+  }
+
+  int ip;
   int nsuccess = 0;
+  int ninserted_atoms = 0;
+  bigint nbonds_add = 0;
+  bigint nangles_add = 0;
+  bigint ndihedrals_add = 0;
+  bigint nimpropers_add = 0;
   int attempt = 0;
   int maxiter = nnew * maxattempt;
 
-  while (nsuccess < nnew) {
-    rn = random->uniform();
-    h = hi_current - rn*rn * (hi_current-lo_current);
-    if (mode == ATOM) radtmp = radius_sample();
+  while (nsuccess < nnew && attempt < maxiter) {
 
-    success = 0;
-    while (attempt < maxiter) {
+    // generate one trial per unplaced particle, identical on all procs
+    // flaglocal = 1 if trial overlaps one of my binned atoms
+
+    for (ip = 0; ip < nnew; ip++) {
+      flaglocal[ip] = 0;
+      if (placed[ip]) continue;
       attempt++;
-      xyz_random(h,coord);
+      xyz_random(hlist[ip],coord);
+
+      double **ctrial = &candcoord[ip*natom_max];
+      candcenter[ip][0] = coord[0];
+      candcenter[ip][1] = coord[1];
+      candcenter[ip][2] = coord[2];
 
       if (mode == ATOM) {
         natom = 1;
-        coords[0][0] = coord[0];
-        coords[0][1] = coord[1];
-        coords[0][2] = coord[2];
-        coords[0][3] = radtmp;
-        imageflags[0] = ((imageint) IMGMAX << IMG2BITS) |
-            ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+        ctrial[0][0] = coord[0];
+        ctrial[0][1] = coord[1];
+        ctrial[0][2] = coord[2];
+        ctrial[0][3] = rlist[ip];
       } else {
         double rng = random->uniform();
         imol = 0;
         while (rng > molfrac[imol]) imol++;
+        candimol[ip] = imol;
         natom = onemols[imol]->natoms;
         if (dimension == 3) {
           r[0] = random->uniform() - 0.5;
@@ -520,178 +545,196 @@ void FixPour::pre_exchange()
         MathExtra::norm3(r);
         MathExtra::axisangle_to_quat(r,theta,quat);
         MathExtra::quat_to_mat(quat,rotmat);
+        candquat[ip][0] = quat[0];
+        candquat[ip][1] = quat[1];
+        candquat[ip][2] = quat[2];
+        candquat[ip][3] = quat[3];
         for (i = 0; i < natom; i++) {
-          MathExtra::matvec(rotmat,onemols[imol]->dx[i],coords[i]);
-          coords[i][0] += coord[0];
-          coords[i][1] += coord[1];
-          coords[i][2] += coord[2];
+          MathExtra::matvec(rotmat,onemols[imol]->dx[i],ctrial[i]);
+          ctrial[i][0] += coord[0];
+          ctrial[i][1] += coord[1];
+          ctrial[i][2] += coord[2];
 
-          // coords[3] = particle radius
+          // ctrial[3] = particle radius
           // default to 0.5, if radii not defined in Molecule
           //   same as atom->avec->create_atom(), invoked below
 
           if (onemols[imol]->radiusflag)
-            coords[i][3] = onemols[imol]->radius[i];
-          else coords[i][3] = 0.5;
-
-          imageflags[i] = ((imageint) IMGMAX << IMG2BITS) |
-            ((imageint) IMGMAX << IMGBITS) | IMGMAX;
-          domain->remap(coords[i],imageflags[i]);
+            ctrial[i][3] = onemols[imol]->radius[i];
+          else ctrial[i][3] = 0.5;
         }
       }
 
-      // if any pair of atoms overlap, try again
-      // use minimum_image() to account for PBC
+      flaglocal[ip] = check_overlap(ctrial,natom);
+    }
 
-      for (m = 0; m < natom; m++) {
-        for (i = 0; i < nnear; i++) {
-          delx = coords[m][0] - xnear[i][0];
-          dely = coords[m][1] - xnear[i][1];
-          delz = coords[m][2] - xnear[i][2];
-          domain->minimum_image(delx,dely,delz);
-          rsq = delx*delx + dely*dely + delz*delz;
-          radsum = coords[m][3] + xnear[i][3];
-          if (rsq <= radsum*radsum) break;
-        }
-        if (i < nnear) break;
-      }
-      if (m == natom) {
-        success = 1;
-        break;
+    MPI_Allreduce(flaglocal,flagall,nnew,MPI_INT,MPI_MAX,world);
+
+    // accept surviving trials in order
+    // the re-check catches clashes with trials accepted earlier in this
+    //   event, whose coords every proc has added to its bins
+    // insertion decisions below are identical on all procs
+
+    for (ip = 0; ip < nnew; ip++) {
+      if (placed[ip] || flagall[ip]) continue;
+
+      double **ctrial = &candcoord[ip*natom_max];
+      if (mode == ATOM) natom = 1;
+      else {
+        imol = candimol[ip];
+        natom = onemols[imol]->natoms;
+        quat[0] = candquat[ip][0];
+        quat[1] = candquat[ip][1];
+        quat[2] = candquat[ip][2];
+        quat[3] = candquat[ip][3];
       }
-    }
 
-    if (!success) break;
+      if (check_overlap(ctrial,natom)) continue;
 
-    // proceed with insertion
+      // proceed with insertion
 
-    nsuccess++;
-    nlocalprev = atom->nlocal;
+      placed[ip] = 1;
+      nsuccess++;
+      nlocalprev = atom->nlocal;
+      coord[0] = candcenter[ip][0];
+      coord[1] = candcenter[ip][1];
+      coord[2] = candcenter[ip][2];
 
-    // add all atoms in particle to xnear
+      // add all atoms in particle to my bins
+      // copy trial into coords/imageflags, applying PBC remap
 
-    for (m = 0; m < natom; m++) {
-      xnear[nnear][0] = coords[m][0];
-      xnear[nnear][1] = coords[m][1];
-      xnear[nnear][2] = coords[m][2];
-      xnear[nnear][3] = coords[m][3];
-      nnear++;
-    }
+      for (m = 0; m < natom; m++) {
+        add_to_bins(ctrial[m]);
+        coords[m][0] = ctrial[m][0];
+        coords[m][1] = ctrial[m][1];
+        coords[m][2] = ctrial[m][2];
+        coords[m][3] = ctrial[m][3];
+        imageflags[m] = ((imageint) IMGMAX << IMG2BITS) |
+          ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+        if (mode == MOLECULE) domain->remap(coords[m],imageflags[m]);
+      }
 
-    // choose random velocity for new particle
-    // used for every atom in molecule
-    // z velocity set to what velocity would be if particle
-    //   had fallen from top of insertion region
-    //   this gives continuous stream of atoms
-    //   solution for v from these 2 eqs, after eliminate t:
-    //     v = vz + grav*t
-    //     coord[2] = hi_current + vz*t + 1/2 grav t^2
-
-    if (dimension == 3) {
-      vnew[0] = vxlo + random->uniform() * (vxhi-vxlo);
-      vnew[1] = vylo + random->uniform() * (vyhi-vylo);
-      vnew[2] = -sqrt(vz*vz + 2.0*grav*(coord[2]-hi_current));
-    } else {
-      vnew[0] = vxlo + random->uniform() * (vxhi-vxlo);
-      vnew[1] = -sqrt(vy*vy + 2.0*grav*(coord[1]-hi_current));
-      vnew[2] = 0.0;
-    }
+      // choose random velocity for new particle
+      // used for every atom in molecule
+      // z velocity set to what velocity would be if particle
+      //   had fallen from top of insertion region
+      //   this gives continuous stream of atoms
+      //   solution for v from these 2 eqs, after eliminate t:
+      //     v = vz + grav*t
+      //     coord[2] = hi_current + vz*t + 1/2 grav t^2
+
+      if (dimension == 3) {
+        vnew[0] = vxlo + random->uniform() * (vxhi-vxlo);
+        vnew[1] = vylo + random->uniform() * (vyhi-vylo);
+        vnew[2] = -sqrt(vz*vz + 2.0*grav*(coord[2]-hi_current));
+      } else {
+        vnew[0] = vxlo + random->uniform() * (vxhi-vxlo);
+        vnew[1] = -sqrt(vy*vy + 2.0*grav*(coord[1]-hi_current));
+        vnew[2] = 0.0;
+      }
 
-    // check if new atoms are in my sub-box or above it if I am highest proc
-    // if so, add atom to my list via create_atom()
-    // initialize additional info about the atoms
-    // set group mask to "all" plus fix group
-
-    for (m = 0; m < natom; m++) {
-      if (mode == ATOM)
-        denstmp = density_lo + random->uniform() * (density_hi-density_lo);
-      newcoord = coords[m];
-
-      flag = 0;
-      if (newcoord[0] >= sublo[0] && newcoord[0] < subhi[0] &&
-          newcoord[1] >= sublo[1] && newcoord[1] < subhi[1] &&
-          newcoord[2] >= sublo[2] && newcoord[2] < subhi[2]) flag = 1;
-      else if (dimension == 3 && newcoord[2] >= domain->boxhi[2]) {
-        if (comm->layout != Comm::LAYOUT_TILED) {
-          if (comm->myloc[2] == comm->procgrid[2]-1 &&
-              newcoord[0] >= sublo[0] && newcoord[0] < subhi[0] &&
-              newcoord[1] >= sublo[1] && newcoord[1] < subhi[1]) flag = 1;
-        } else {
-          if (comm->mysplit[2][1] == 1.0 &&
-              newcoord[0] >= sublo[0] && newcoord[0] < subhi[0] &&
-              newcoord[1] >= sublo[1] && newcoord[1] < subhi[1]) flag = 1;
-        }
-      } else if (dimension == 2 && newcoord[1] >= domain->boxhi[1]) {
-        if (comm->layout != Comm::LAYOUT_TILED) {
-          if (comm->myloc[1] == comm->procgrid[1]-1 &&
-              newcoord[0] >= sublo[0] && newcoord[0] < subhi[0]) flag = 1;
-        } else {
-          if (comm->mysplit[1][1] == 1.0 &&
-              newcoord[0] >= sublo[0] && newcoord[0] < subhi[0]) flag = 1;
+      // check if new atoms are in my sub-box or above it if I am highest proc
+      // if so, add atom to my list via create_atom()
+      // initialize additional info about the atoms
+      // set group mask to "all" plus fix group
+
+      for (m = 0; m < natom; m++) {
+        if (mode == ATOM)
+          denstmp = density_lo + random->uniform() * (density_hi-density_lo);
+        newcoord = coords[m];
+
+        flag = 0;
+        if (newcoord[0] >= sublo[0] && newcoord[0] < subhi[0] &&
+            newcoord[1] >= sublo[1] && newcoord[1] < subhi[1] &&
+            newcoord[2] >= sublo[2] && newcoord[2] < subhi[2]) flag = 1;
+        else if (dimension == 3 && newcoord[2] >= domain->boxhi[2]) {
+          if (comm->layout != Comm::LAYOUT_TILED) {
+            if (comm->myloc[2] == comm->procgrid[2]-1 &&
+                newcoord[0] >= sublo[0] && newcoord[0] < subhi[0] &&
+                newcoord[1] >= sublo[1] && newcoord[1] < subhi[1]) flag = 1;
+          } else {
+            if (comm->mysplit[2][1] == 1.0 &&
+                newcoord[0] >= sublo[0] && newcoord[0] < subhi[0] &&
+                newcoord[1] >= sublo[1] && newcoord[1] < subhi[1]) flag = 1;
+          }
+        } else if (dimension == 2 && newcoord[1] >= domain->boxhi[1]) {
+          if (comm->layout != Comm::LAYOUT_TILED) {
+            if (comm->myloc[1] == comm->procgrid[1]-1 &&
+                newcoord[0] >= sublo[0] && newcoord[0] < subhi[0]) flag = 1;
+          } else {
+            if (comm->mysplit[1][1] == 1.0 &&
+                newcoord[0] >= sublo[0] && newcoord[0] < subhi[0]) flag = 1;
+          }
         }
-      }
 
-      if (flag) {
-        if (mode == ATOM) atom->avec->create_atom(ntype,coords[m]);
-        else atom->avec->create_atom(ntype+onemols[imol]->type[m],coords[m]);
-        int n = atom->nlocal - 1;
-        atom->tag[n] = maxtag_all + m+1;
-        if (mode == MOLECULE) {
-          if (atom->molecule_flag) {
-            if (onemols[imol]->moleculeflag) {
-              atom->molecule[n] = maxmol_all + onemols[imol]->molecule[m];
-            } else {
-              atom->molecule[n] = maxmol_all+1;
+        if (flag) {
+          if (mode == ATOM) atom->avec->create_atom(ntype,coords[m]);
+          else atom->avec->create_atom(ntype+onemols[imol]->type[m],coords[m]);
+          int n = atom->nlocal - 1;
+          atom->tag[n] = maxtag_all + m+1;
+          if (mode == MOLECULE) {
+            if (atom->molecule_flag) {
+              if (onemols[imol]->moleculeflag) {
+                atom->molecule[n] = maxmol_all + onemols[imol]->molecule[m];
+              } else {
+                atom->molecule[n] = maxmol_all+1;
+              }
+            }
+            if (atom->molecular == 2) {
+              atom->molindex[n] = 0;
+              atom->molatom[n] = m;
             }
           }
-          if (atom->molecular == 2) {
-            atom->molindex[n] = 0;
-            atom->molatom[n] = m;
+          atom->mask[n] = 1 | groupbit;
+          atom->image[n] = imageflags[m];
+          atom->v[n][0] = vnew[0];
+          atom->v[n][1] = vnew[1];
+          atom->v[n][2] = vnew[2];
+          if (mode == ATOM) {
+            radtmp = newcoord[3];
+            atom->radius[n] = radtmp;
+            atom->rmass[n] = 4.0*MY_PI/3.0 * radtmp*radtmp*radtmp * denstmp;
+          } else {
+            onemols[imol]->quat_external = quat;
+            atom->add_molecule_atom(onemols[imol],m,n,maxtag_all);
           }
-        }
-        atom->mask[n] = 1 | groupbit;
-        atom->image[n] = imageflags[m];
-        atom->v[n][0] = vnew[0];
-        atom->v[n][1] = vnew[1];
-        atom->v[n][2] = vnew[2];
-        if (mode == ATOM) {
-          radtmp = newcoord[3];
-          atom->radius[n] = radtmp;
-          atom->rmass[n] = 4.0*MY_PI/3.0 * radtmp*radtmp*radtmp * denstmp;
-        } else {
-          onemols[imol]->quat_external = quat;
-          atom->add_molecule_atom(onemols[imol],m,n,maxtag_all);
-        }
 
-        modify->create_attribute(n);
+          modify->create_attribute(n);
+        }
       }
-    }
 
-    // FixRigidSmall::set_molecule stores rigid body attributes
-    //   coord is new position of geometric center of mol, not COM
-    // FixShake::set_molecule stores shake info for molecule
+      // FixRigidSmall::set_molecule stores rigid body attributes
+      //   coord is new position of geometric center of mol, not COM
+      // FixShake::set_molecule stores shake info for molecule
 
-    if (rigidflag)
-      fixrigid->set_molecule(nlocalprev,maxtag_all,imol,coord,vnew,quat);
-    else if (shakeflag)
-      fixshake->set_molecule(nlocalprev,maxtag_all,imol,coord,vnew,quat);
+      if (rigidflag)
+        fixrigid->set_molecule(nlocalprev,maxtag_all,imol,coord,vnew,quat);
+      else if (shakeflag)
+        fixshake->set_molecule(nlocalprev,maxtag_all,imol,coord,vnew,quat);
 
-    maxtag_all += natom;
-    if (mode == MOLECULE && atom->molecule_flag) {
-      if (onemols[imol]->moleculeflag) {
-        maxmol_all += onemols[imol]->nmolecules;
-      } else {
-        maxmol_all++;
+      maxtag_all += natom;
+      if (mode == MOLECULE && atom->molecule_flag) {
+        if (onemols[imol]->moleculeflag) {
+          maxmol_all += onemols[imol]->nmolecules;
+        } else {
+          maxmol_all++;
+        }
+      }
+
+      ninserted_atoms += natom;
+      if (mode == MOLECULE) {
+        nbonds_add += onemols[imol]->nbonds;
+        nangles_add += onemols[imol]->nangles;
+        ndihedrals_add += onemols[imol]->ndihedrals;
+        nimpropers_add += onemols[imol]->nimpropers;
       }
     }
   }
 
   // warn if not successful with all insertions b/c too many attempts
 
-  int ninserted_atoms = nnear - nprevious;
-  int ninserted_mols = ninserted_atoms / natom;
-  ninserted += ninserted_mols;
-  if (ninserted_mols < nnew && me == 0)
+  ninserted += nsuccess;
+  if (nsuccess < nnew && me == 0)
     error->warning(FLERR,"Less insertions than requested",0);
 
   // reset global natoms,nbonds,etc
@@ -705,10 +748,10 @@ void FixPour::pre_exchange()
     if (atom->natoms < 0)
       error->all(FLERR,"Too many total atoms");
     if (mode == MOLECULE) {
-      atom->nbonds += onemols[imol]->nbonds * ninserted_mols;
-      atom->nangles += onemols[imol]->nangles * ninserted_mols;
-      atom->ndihedrals += onemols[imol]->ndihedrals * ninserted_mols;
-      atom->nimpropers += onemols[imol]->nimpropers * ninserted_mols;
+      atom->nbonds += nbonds_add;
+      atom->nangles += nangles_add;
+      atom->ndihedrals += ndihedrals_add;
+      atom->nimpropers += nimpropers_add;
     }
     if (maxtag_all >= MAXTAGINT)
       error->all(FLERR,"New atom IDs exceed maximum allowed ID");
@@ -720,8 +763,20 @@ void FixPour::pre_exchange()
 
   // free local memory
 
-  memory->destroy(xmine);
-  memory->destroy(xnear);
+  memory->destroy(candcoord);
+  memory->destroy(candcenter);
+  memory->destroy(candquat);
+  memory->destroy(hlist);
+  memory->destroy(rlist);
+  memory->destroy(candimol);
+  memory->destroy(placed);
+  memory->destroy(flaglocal);
+  memory->destroy(flagall);
+  memory->destroy(binhead);
+  memory->destroy(binnext);
+  memory->destroy(xbin);
+  binhead = binnext = NULL;
+  xbin = NULL;
 
   // next timestep to insert
 
@@ -860,6 +915,158 @@ void FixPour::xyz_random(double h, double *coord)
   }
 }
 
+/* ----------------------------------------------------------------------
+   setup linked-list bins over the insertion region for overlap checks
+   extend region bounds by cutoff, plus max molecule radius for MOLECULE
+     mode since trial coords of molecule atoms stick out of the region
+   bin size >= cutoff so only 27 bins need checking per trial atom
+------------------------------------------------------------------------- */
+
+void FixPour::setup_overlap_bins(double cutoff)
+{
+  double margin = cutoff;
+  if (mode == MOLECULE) margin += molradius_max;
+
+  if (domain->dimension == 3) {
+    if (region_style == 1) {
+      binlo[0] = xlo;
+      binhi[0] = xhi;
+      binlo[1] = ylo;
+      binhi[1] = yhi;
+    } else {
+      binlo[0] = xc - rc;
+      binhi[0] = xc + rc;
+      binlo[1] = yc - rc;
+      binhi[1] = yc + rc;
+    }
+    binlo[2] = lo_current;
+    binhi[2] = hi_current;
+  } else {
+    binlo[0] = xlo;
+    binhi[0] = xhi;
+    binlo[1] = lo_current;
+    binhi[1] = hi_current;
+    binlo[2] = domain->boxlo[2];
+    binhi[2] = domain->boxhi[2];
+  }
+
+  for (int dim = 0; dim < 3; dim++) {
+    binlo[dim] -= margin;
+    binhi[dim] += margin;
+  }
+
+  nbinx = MAX(static_cast<int> ((binhi[0]-binlo[0]) / cutoff),1);
+  nbiny = MAX(static_cast<int> ((binhi[1]-binlo[1]) / cutoff),1);
+  nbinz = MAX(static_cast<int> ((binhi[2]-binlo[2]) / cutoff),1);
+  bininv[0] = nbinx / (binhi[0]-binlo[0]);
+  bininv[1] = nbiny / (binhi[1]-binlo[1]);
+  bininv[2] = nbinz / (binhi[2]-binlo[2]);
+
+  memory->create(binhead,nbinx*nbiny*nbinz,"pour:binhead");
+  for (int i = 0; i < nbinx*nbiny*nbinz; i++) binhead[i] = -1;
+
+  nbinatom = maxbinatom = 0;
+  binnext = NULL;
+  xbin = NULL;
+}
+
+/* ----------------------------------------------------------------------
+   add point pt = (x,y,z,radius) to the overlap bins
+   also add any periodic image of it that falls in the binned volume,
+     so overlap checks against the bins need no minimum_image() calls
+------------------------------------------------------------------------- */
+
+void FixPour::add_to_bins(const double *pt)
+{
+  int sx,sy,sz;
+  double img[4];
+
+  int sxmax = (domain->periodicity[0]) ? 1 : 0;
+  int symax = (domain->periodicity[1]) ? 1 : 0;
+  int szmax = (domain->periodicity[2]) ? 1 : 0;
+  img[3] = pt[3];
+
+  for (sz = -szmax; sz <= szmax; sz++) {
+    img[2] = pt[2] + sz*domain->zprd;
+    if (img[2] < binlo[2] || img[2] > binhi[2]) continue;
+    for (sy = -symax; sy <= symax; sy++) {
+      img[1] = pt[1] + sy*domain->yprd;
+      if (img[1] < binlo[1] || img[1] > binhi[1]) continue;
+      for (sx = -sxmax; sx <= sxmax; sx++) {
+        img[0] = pt[0] + sx*domain->xprd;
+        if (img[0] < binlo[0] || img[0] > binhi[0]) continue;
+
+        if (nbinatom == maxbinatom) {
+          maxbinatom += DELTABIN;
+          memory->grow(xbin,maxbinatom,4,"pour:xbin");
+          memory->grow(binnext,maxbinatom,"pour:binnext");
+        }
+
+        xbin[nbinatom][0] = img[0];
+        xbin[nbinatom][1] = img[1];
+        xbin[nbinatom][2] = img[2];
+        xbin[nbinatom][3] = img[3];
+        int ibin = coord2bin(img);
+        binnext[nbinatom] = binhead[ibin];
+        binhead[ibin] = nbinatom;
+        nbinatom++;
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   map point to overlap bin index, clamped to the binned volume
+------------------------------------------------------------------------- */
+
+int FixPour::coord2bin(const double *pt)
+{
+  int ix = static_cast<int> ((pt[0]-binlo[0]) * bininv[0]);
+  int iy = static_cast<int> ((pt[1]-binlo[1]) * bininv[1]);
+  int iz = static_cast<int> ((pt[2]-binlo[2]) * bininv[2]);
+  ix = MAX(MIN(ix,nbinx-1),0);
+  iy = MAX(MIN(iy,nbiny-1),0);
+  iz = MAX(MIN(iz,nbinz-1),0);
+  return (iz*nbiny + iy)*nbinx + ix;
+}
+
+/* ----------------------------------------------------------------------
+   check trial particle of natom atoms against binned atoms
+   each atom only scans the 27 bins around its own bin, which cover
+     all points within cutoff since bins are at least cutoff wide
+   return 1 if any pair of atoms overlap, 0 if no overlap
+------------------------------------------------------------------------- */
+
+int FixPour::check_overlap(double **c, int natom)
+{
+  int ix,iy,iz,kx,ky,kz,j;
+  double delx,dely,delz,rsq,radsum;
+
+  for (int m = 0; m < natom; m++) {
+    ix = static_cast<int> ((c[m][0]-binlo[0]) * bininv[0]);
+    iy = static_cast<int> ((c[m][1]-binlo[1]) * bininv[1]);
+    iz = static_cast<int> ((c[m][2]-binlo[2]) * bininv[2]);
+    ix = MAX(MIN(ix,nbinx-1),0);
+    iy = MAX(MIN(iy,nbiny-1),0);
+    iz = MAX(MIN(iz,nbinz-1),0);
+
+    for (kz = MAX(iz-1,0); kz <= MIN(iz+1,nbinz-1); kz++)
+      for (ky = MAX(iy-1,0); ky <= MIN(iy+1,nbiny-1); ky++)
+        for (kx = MAX(ix-1,0); kx <= MIN(ix+1,nbinx-1); kx++)
+          for (j = binhead[(kz*nbiny + ky)*nbinx + kx]; j >= 0;
+               j = binnext[j]) {
+            delx = c[m][0] - xbin[j][0];
+            dely = c[m][1] - xbin[j][1];
+            delz = c[m][2] - xbin[j][2];
+            rsq = delx*delx + dely*dely + delz*delz;
+            radsum = c[m][3] + xbin[j][3];
+            if (rsq <= radsum*radsum) return 1;
+          }
+  }
+
+  return 0;
+}
+
 /* ---------------------------------------------------------------------- */
 
 double FixPour::radius_sample()
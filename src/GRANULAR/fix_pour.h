@@ -61,19 +61,31 @@ class FixPour : public Fix {
   class Fix *fixrigid,*fixshake;
   double oneradius;
 
-  int me,nprocs;
-  int *recvcounts,*displs;
+  int me;
   int nfreq,nfirst,ninserted,nper;
   double lo_current,hi_current;
   tagint maxtag_all,maxmol_all;
   class RanPark *random,*random2;
 
+  // local bins over extended insertion region for trial overlap checks
+
+  int *binhead,*binnext;       // linked-list bins of nearby local atoms
+  double **xbin;               // coords + radius of binned atoms & images
+  int nbinatom,maxbinatom;     // # of binned points and allocated size
+  int nbinx,nbiny,nbinz;       // # of bins in each dimension
+  double binlo[3],binhi[3];    // extent of binned volume
+  double bininv[3];            // inverse bin sizes
+
   void find_maxid();
   int overlap(int);
   bool outside(int, double, double, double);
   void xyz_random(double, double *);
   double radius_sample();
   void options(int, char **);
+  void setup_overlap_bins(double);
+  void add_to_bins(const double *);
+  int coord2bin(const double *);
+  int check_overlap(double **, int);
 };
 
 }
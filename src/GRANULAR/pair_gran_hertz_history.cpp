@@ -47,7 +47,7 @@ void PairGranHertzHistory::compute(int eflag, int vflag)
   double wr1,wr2,wr3;
   double vtr1,vtr2,vtr3,vrel;
   double mi,mj,meff,damp,ccel,tor1,tor2,tor3;
-  double fn,fs,fs1,fs2,fs3;
+  double fn,fs,fs1,fs2,fs3,fnfs,mgt1,mgt2,mgt3;
   double shrmag,rsht,polyhertz;
   int *ilist,*jlist,*numneigh,**firstneigh;
   int *touch,**firsttouch;
@@ -225,15 +225,16 @@ void PairGranHertzHistory::compute(int eflag, int vflag)
 
         if (fs > fn) {
           if (shrmag != 0.0) {
-            shear[0] = (fn/fs) * (shear[0] + meff*gammat*vtr1/kt) -
-              meff*gammat*vtr1/kt;
-            shear[1] = (fn/fs) * (shear[1] + meff*gammat*vtr2/kt) -
-              meff*gammat*vtr2/kt;
-            shear[2] = (fn/fs) * (shear[2] + meff*gammat*vtr3/kt) -
-              meff*gammat*vtr3/kt;
-            fs1 *= fn/fs;
-            fs2 *= fn/fs;
-            fs3 *= fn/fs;
+            fnfs = fn/fs;
+            mgt1 = meff*gammat*vtr1/kt;
+            mgt2 = meff*gammat*vtr2/kt;
+            mgt3 = meff*gammat*vtr3/kt;
+            shear[0] = fnfs * (shear[0] + mgt1) - mgt1;
+            shear[1] = fnfs * (shear[1] + mgt2) - mgt2;
+            shear[2] = fnfs * (shear[2] + mgt3) - mgt3;
+            fs1 *= fnfs;
+            fs2 *= fnfs;
+            fs3 *= fnfs;
           } else fs1 = fs2 = fs3 = 0.0;
         }
 
@@ -435,10 +436,11 @@ double PairGranHertzHistory::single(int i, int j, int /*itype*/, int /*jtype*/,
 
   if (fs > fn) {
     if (shrmag != 0.0) {
-      fs1 *= fn/fs;
-      fs2 *= fn/fs;
-      fs3 *= fn/fs;
-      fs *= fn/fs;
+      double fnfs = fn/fs;
+      fs1 *= fnfs;
+      fs2 *= fnfs;
+      fs3 *= fnfs;
+      fs *= fnfs;
     } else fs1 = fs2 = fs3 = fs = 0.0;
   }
 
@@ -105,6 +105,13 @@ PairKIM::PairKIM(LAMMPS *lmp) :
   lmps_maxalloc(0),
   kim_particleSpecies(NULL),
   kim_particleContributing(NULL),
+  lmps_reg_x(NULL),
+  lmps_reg_f(NULL),
+  lmps_reg_eatom(NULL),
+  lmps_reg_vatom(NULL),
+  lmps_reg_eflag_global(-1),
+  lmps_reg_eflag_atom(-1),
+  lmps_reg_vflag_atom(-1),
   lmps_stripped_neigh_list(NULL),
   lmps_stripped_neigh_ptr(NULL)
 {
@@ -186,9 +193,15 @@ void PairKIM::compute(int eflag, int vflag)
 {
   ev_init(eflag,vflag);
 
+  // species codes and contributing flags only change when atoms migrate,
+  // i.e. on reneighboring steps; in between, reuse last step's arrays
+
+  int rebuild_species_flags = (neighbor->ago == 0);
+
   // grow kim_particleSpecies and kim_particleContributing array if necessary
   // needs to be atom->nmax in length
   if (atom->nmax > lmps_maxalloc) {
+    rebuild_species_flags = 1;
     memory->destroy(kim_particleSpecies);
     memory->destroy(kim_particleContributing);
 
@@ -215,16 +228,28 @@ void PairKIM::compute(int eflag, int vflag)
   int nall = atom->nlocal + atom->nghost;
   int ielement;
 
-  for (int i = 0; i < nall; i++) {
-    ielement = lmps_map_species_to_unique[species[i]];
-    kim_particleSpecies[i] = kim_particle_codes[ielement];
+  if (rebuild_species_flags) {
+    for (int i = 0; i < nall; i++) {
+      ielement = lmps_map_species_to_unique[species[i]];
+      kim_particleSpecies[i] = kim_particle_codes[ielement];
+    }
+
+    // Set kim contributing flags
+    set_contributing();
   }
 
-  // Set kim contributing flags
-  set_contributing();
+  // pass current atom pointers to KIM, but only re-register them when a
+  // pointer or an energy/virial flag changed since the last registration:
+  // the KIM-API retains the pointers between Compute calls
 
-  // pass current atom pointers to KIM
-  set_argument_pointers();
+  if ((&(atom->x[0][0]) != lmps_reg_x) ||
+      (&(atom->f[0][0]) != lmps_reg_f) ||
+      (eatom != lmps_reg_eatom) ||
+      ((vatom ? &(vatom[0][0]) : NULL) != lmps_reg_vatom) ||
+      (eflag_global != lmps_reg_eflag_global) ||
+      (eflag_atom != lmps_reg_eflag_atom) ||
+      (vflag_atom != lmps_reg_vflag_atom))
+    set_argument_pointers();
 
   // set number of particles
   lmps_local_tot_num_atoms = (int) nall;
@@ -874,6 +899,18 @@ void PairKIM::kim_init()
     &lmps_local_tot_num_atoms);
   if (kimerror) error->all(FLERR,"Unable to set KIM argument pointer");
 
+  // the compute-arguments object is new: nothing is registered with it yet,
+  // so invalidate the cached registration state
+
+  lmps_reg_x = NULL;
+  lmps_reg_f = NULL;
+  lmps_reg_eatom = NULL;
+  lmps_reg_vatom = NULL;
+  lmps_reg_eflag_global = -1;
+  lmps_reg_eflag_atom = -1;
+  lmps_reg_vflag_atom = -1;
+  lmps_maxalloc = 0;
+
   kimerror = KIM_ComputeArguments_SetCallbackPointer(pargs,
     KIM_COMPUTE_CALLBACK_NAME_GetNeighborList,
     KIM_LANGUAGE_NAME_cpp,
@@ -969,6 +1006,16 @@ void PairKIM::set_argument_pointers()
   }
 
   if (kimerror) error->all(FLERR,"Unable to set KIM argument pointers");
+
+  // remember what was registered so compute() can skip redundant calls
+
+  lmps_reg_x = &(atom->x[0][0]);
+  lmps_reg_f = &(atom->f[0][0]);
+  lmps_reg_eatom = eatom;
+  lmps_reg_vatom = (vatom) ? &(vatom[0][0]) : NULL;
+  lmps_reg_eflag_global = eflag_global;
+  lmps_reg_eflag_atom = eflag_atom;
+  lmps_reg_vflag_atom = vflag_atom;
 }
 
 /* ---------------------------------------------------------------------- */
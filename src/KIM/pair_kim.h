@@ -155,6 +155,15 @@ class PairKIM : public Pair {
   int lmps_maxalloc;              // max allocated memory value
   int* kim_particleSpecies;       // array of KIM particle species
   int* kim_particleContributing;  // array of KIM particle contributing
+  // last state registered with the KIM-API; compute() only re-registers
+  // argument pointers when one of these changed
+  double* lmps_reg_x;
+  double* lmps_reg_f;
+  double* lmps_reg_eatom;
+  double* lmps_reg_vatom;
+  int lmps_reg_eflag_global;
+  int lmps_reg_eflag_atom;
+  int lmps_reg_vflag_atom;
   int* lmps_stripped_neigh_list;  // neighbors of one atom, used when LAMMPS
                                   // is in molecular mode
   int** lmps_stripped_neigh_ptr;  // pointer into lists
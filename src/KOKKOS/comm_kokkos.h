@@ -51,6 +51,7 @@ class CommKokkos : public CommBrick {
   template<class DeviceType> void forward_comm_device(int dummy);
   template<class DeviceType> void reverse_comm_device();
   template<class DeviceType> void forward_comm_pair_device(Pair *pair);
+  template<class DeviceType> void forward_comm_fix_device(Fix *fix, int size);
   template<class DeviceType> void exchange_device();
   template<class DeviceType> void borders_device();
 
@@ -78,6 +79,11 @@ class CommKokkos : public CommBrick {
   DAT::tdual_xfloat_1d k_buf_recv_pair;
   void grow_buf_pair(int);
 
+  int max_buf_fix;
+  DAT::tdual_xfloat_1d k_buf_send_fix;
+  DAT::tdual_xfloat_1d k_buf_recv_fix;
+  void grow_buf_fix(int);
+
   void grow_send(int, int);
   void grow_recv(int);
   void grow_send_kokkos(int, int, ExecutionSpace space = Host);
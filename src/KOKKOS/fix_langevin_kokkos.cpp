@@ -790,18 +790,22 @@ void FixLangevinKokkos<DeviceType>::end_of_step()
   energy_onestep = 0.0;
 
   k_flangevin.template sync<DeviceType>();
-  FixLangevinKokkosTallyEnergyFunctor<DeviceType> tally_functor(this);
-  Kokkos::parallel_reduce(nlocal,tally_functor,energy_onestep);
+
+  // with GJF the energy tally and the velocity update are fused into
+  // one kernel; the tally reads v before the update rewrites it
 
   if (gjfflag){
     if (rmass.data()) {
-      FixLangevinKokkosEndOfStepFunctor<DeviceType,1> functor(this);
-      Kokkos::parallel_for(nlocal,functor);
+      FixLangevinKokkosTallyEndOfStepFunctor<DeviceType,1> functor(this);
+      Kokkos::parallel_reduce(nlocal,functor,energy_onestep);
     } else {
       mass = atomKK->k_mass.view<DeviceType>();
-      FixLangevinKokkosEndOfStepFunctor<DeviceType,0> functor(this);
-      Kokkos::parallel_for(nlocal,functor);
+      FixLangevinKokkosTallyEndOfStepFunctor<DeviceType,0> functor(this);
+      Kokkos::parallel_reduce(nlocal,functor,energy_onestep);
     }
+  } else {
+    FixLangevinKokkosTallyEnergyFunctor<DeviceType> tally_functor(this);
+    Kokkos::parallel_reduce(nlocal,tally_functor,energy_onestep);
   }
 
   energy += energy_onestep*update->dt;
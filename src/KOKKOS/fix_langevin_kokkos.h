@@ -258,6 +258,36 @@ namespace LAMMPS_NS {
       else c.end_of_step_item(i);
     }
   };
+
+  // fused tally + end-of-step functor: the energy tally reads the
+  // velocities before the GJF update rewrites them, so both sweeps
+  // can run as one kernel
+
+  template <class DeviceType, int RMass>
+  struct FixLangevinKokkosTallyEndOfStepFunctor {
+    typedef DeviceType  device_type ;
+    FixLangevinKokkos<DeviceType> c;
+    typedef double value_type;
+
+    FixLangevinKokkosTallyEndOfStepFunctor(FixLangevinKokkos<DeviceType>* c_ptr):
+      c(*c_ptr) {c.cleanup_copy();}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int i, value_type &energy) const {
+      energy += c.compute_energy_item(i);
+      if (RMass) c.end_of_step_rmass_item(i);
+      else c.end_of_step_item(i);
+    }
+    KOKKOS_INLINE_FUNCTION
+    static void init(volatile value_type &update) {
+      update = 0.0;
+    }
+    KOKKOS_INLINE_FUNCTION
+    static void join(volatile value_type &update,
+                     const volatile value_type &source) {
+      update += source;
+    }
+  };
 }
 
 #endif
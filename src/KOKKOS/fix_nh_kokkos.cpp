@@ -218,13 +218,15 @@ void FixNHKokkos<DeviceType>::initial_integrate(int vflag)
     nh_v_press();
   }
 
-  nve_v();
-
-  // remap simulation box by 1/2 step
+  // remap simulation box by 1/2 step between the velocity and
+  // position updates when a barostat is active; without one the
+  // two updates run back-to-back as a single fused kernel
 
-  if (pstat_flag) remap();
-
-  nve_x();
+  if (pstat_flag) {
+    nve_v();
+    remap();
+    nve_x();
+  } else nve_vx();
 
   // remap simulation box by 1/2 step
   // redo KSpace coeffs since volume has changed
@@ -578,6 +580,45 @@ void FixNHKokkos<DeviceType>::operator()(TagFixNH_nve_v<RMASS>, const int &i) co
   }
 }
 
+/* ----------------------------------------------------------------------
+   perform half-step update of velocities and full-step update of
+   positions as one kernel; only valid when the box is not remapped
+   between the two updates
+-----------------------------------------------------------------------*/
+
+template<class DeviceType>
+void FixNHKokkos<DeviceType>::nve_vx()
+{
+  atomKK->sync(execution_space,X_MASK | V_MASK | F_MASK | MASK_MASK | RMASS_MASK | TYPE_MASK);
+
+  x = atomKK->k_x.view<DeviceType>();
+  v = atomKK->k_v.view<DeviceType>();
+  f = atomKK->k_f.view<DeviceType>();
+  rmass = atomKK->k_rmass.view<DeviceType>();
+  mass = atomKK->k_mass.view<DeviceType>();
+  type = atomKK->k_type.view<DeviceType>();
+  mask = atomKK->k_mask.view<DeviceType>();
+  int nlocal = atomKK->nlocal;
+  if (igroup == atomKK->firstgroup) nlocal = atomKK->nfirst;
+
+  copymode = 1;
+  if (rmass.data())
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType, TagFixNH_nve_vx<1> >(0,nlocal),*this);
+  else
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType, TagFixNH_nve_vx<0> >(0,nlocal),*this);
+  copymode = 0;
+
+  atomKK->modified(execution_space,X_MASK | V_MASK);
+}
+
+template<class DeviceType>
+template<int RMASS>
+KOKKOS_INLINE_FUNCTION
+void FixNHKokkos<DeviceType>::operator()(TagFixNH_nve_vx<RMASS>, const int &i) const {
+  (*this)(TagFixNH_nve_v<RMASS>(),i);
+  (*this)(TagFixNH_nve_x(),i);
+}
+
 /* ----------------------------------------------------------------------
    perform full-step update of positions
 -----------------------------------------------------------------------*/
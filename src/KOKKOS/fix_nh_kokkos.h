@@ -27,6 +27,9 @@ struct TagFixNH_nve_v{};
 
 struct TagFixNH_nve_x{};
 
+template<int RMASS>
+struct TagFixNH_nve_vx{};
+
 struct TagFixNH_nh_v_temp{};
 
 template<class DeviceType>
@@ -53,6 +56,10 @@ class FixNHKokkos : public FixNH {
   KOKKOS_INLINE_FUNCTION
   void operator()(TagFixNH_nve_x, const int&) const;
 
+  template<int RMASS>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixNH_nve_vx<RMASS>, const int&) const;
+
   KOKKOS_INLINE_FUNCTION
   void operator()(TagFixNH_nh_v_temp, const int&) const;
 
@@ -61,6 +68,8 @@ class FixNHKokkos : public FixNH {
 
   virtual void nve_x();            // may be overwritten by child classes
   virtual void nve_v();
+  void nve_vx();                   // fused nve_v + nve_x, used when
+                                   // no box remap occurs between them
   virtual void nh_v_press();
   virtual void nh_v_temp();
 
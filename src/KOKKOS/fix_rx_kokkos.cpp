@@ -66,6 +66,7 @@ FixRxKokkos<DeviceType>::FixRxKokkos(LAMMPS *lmp, int narg, char **arg) :
   update_kinetics_data(true)
 {
   kokkosable = 1;
+  fix_comm_kokkos_flag = 1;
   atomKK = (AtomKokkos *) atom;
   execution_space = ExecutionSpaceFromDevice<DeviceType>::space;
   datamask_read = EMPTY_MASK;
@@ -1668,12 +1669,12 @@ void FixRxKokkos<DeviceType>::solve_reactions(const int vflag, const bool isPreF
   atomKK->modified( execution_space, DVECTOR_MASK );
 
   // Communicate the updated species data to all nodes
-  atomKK->sync ( Host, DVECTOR_MASK );
+  // the pack/unpack routines sync and modify dvector on whichever
+  // execution space the comm runs in, so no blanket host round
+  // trip is forced here
 
   comm->forward_comm_fix(this);
 
-  atomKK->modified ( Host, DVECTOR_MASK );
-
   TimerType timer_stop = getTimeStamp();
 
   double time_ODE = getElapsedTime(timer_localTemperature, timer_ODE);
@@ -2200,6 +2201,8 @@ int FixRxKokkos<DeviceType>::pack_forward_comm(int n, int *list, double *buf, in
 {
   //printf("inside FixRxKokkos::pack_forward_comm %d\n", comm->me);
 
+  atomKK->sync( Host, DVECTOR_MASK );
+
   HAT::t_float_2d h_dvector = atomKK->k_dvector.h_view;
 
   int m = 0;
@@ -2234,11 +2237,65 @@ void FixRxKokkos<DeviceType>::unpack_forward_comm(int n, int first, double *buf)
     }
   }
 
+  atomKK->modified( Host, DVECTOR_MASK );
+
   //printf("done with FixRxKokkos::unpack_forward_comm %d\n", comm->me);
 }
 
 /* ---------------------------------------------------------------------- */
 
+template <typename DeviceType>
+int FixRxKokkos<DeviceType>::pack_forward_comm_fix_kokkos(int n, DAT::tdual_int_2d k_sendlist,
+                                                          int iswap_in, DAT::tdual_xfloat_1d &buf,
+                                                          int /*pbc_flag*/, int * /*pbc*/)
+{
+  atomKK->sync( execution_space, DVECTOR_MASK );
+  d_dvector = atomKK->k_dvector.template view<DeviceType>();
+
+  d_sendlist = k_sendlist.view<DeviceType>();
+  iswap = iswap_in;
+  v_buf = buf.view<DeviceType>();
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType, Tag_FixRxKokkos_packForwardComm>(0,n),*this);
+  return n*2*nspecies;
+}
+
+template <typename DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRxKokkos<DeviceType>::operator()(Tag_FixRxKokkos_packForwardComm, const int &i) const {
+  const int j = d_sendlist(iswap, i);
+  int m = i*2*nspecies;
+  for (int ispecies = 0; ispecies < nspecies; ispecies++) {
+    v_buf[m++] = d_dvector(ispecies, j);
+    v_buf[m++] = d_dvector(ispecies+nspecies, j);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <typename DeviceType>
+void FixRxKokkos<DeviceType>::unpack_forward_comm_fix_kokkos(int n, int first_in, DAT::tdual_xfloat_1d &buf)
+{
+  d_dvector = atomKK->k_dvector.template view<DeviceType>();
+
+  first = first_in;
+  v_buf = buf.view<DeviceType>();
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType, Tag_FixRxKokkos_unpackForwardComm>(0,n),*this);
+
+  atomKK->modified( execution_space, DVECTOR_MASK );
+}
+
+template <typename DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRxKokkos<DeviceType>::operator()(Tag_FixRxKokkos_unpackForwardComm, const int &i) const {
+  int m = i*2*nspecies;
+  for (int ispecies = 0; ispecies < nspecies; ispecies++) {
+    d_dvector(ispecies, first + i) = v_buf[m++];
+    d_dvector(ispecies+nspecies, first + i) = v_buf[m++];
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
 template <typename DeviceType>
 int FixRxKokkos<DeviceType>::pack_reverse_comm(int n, int first, double *buf)
 {
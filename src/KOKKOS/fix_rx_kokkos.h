@@ -25,6 +25,7 @@ FixStyle(rx/kk/host,FixRxKokkos<LMPHostType>)
 #include "fix_rx.h"
 #include "pair_dpd_fdt_energy_kokkos.h"
 #include "kokkos_type.h"
+#include "kokkos_base.h"
 #include "neigh_list.h"
 #include "neigh_list_kokkos.h"
 
@@ -32,6 +33,8 @@ namespace LAMMPS_NS {
 
 struct Tag_FixRxKokkos_zeroTemperatureViews {};
 struct Tag_FixRxKokkos_zeroCounterViews {};
+struct Tag_FixRxKokkos_packForwardComm {};
+struct Tag_FixRxKokkos_unpackForwardComm {};
 
 template <int WT_FLAG, bool NEWTON_PAIR, int NEIGHFLAG>
 struct Tag_FixRxKokkos_firstPairOperator {};
@@ -72,7 +75,7 @@ struct s_CounterType
 typedef struct s_CounterType CounterType;
 
 template <typename DeviceType>
-class FixRxKokkos : public FixRX {
+class FixRxKokkos : public FixRX, public KokkosBase {
  public:
   typedef ArrayTypes<DeviceType> AT;
 
@@ -93,6 +96,12 @@ class FixRxKokkos : public FixRX {
   KOKKOS_INLINE_FUNCTION
   void operator()(Tag_FixRxKokkos_zeroTemperatureViews, const int&) const;
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Tag_FixRxKokkos_packForwardComm, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Tag_FixRxKokkos_unpackForwardComm, const int&) const;
+
   template <int WT_FLAG, bool NEWTON_PAIR, int NEIGHFLAG>
   KOKKOS_INLINE_FUNCTION
   void operator()(Tag_FixRxKokkos_firstPairOperator<WT_FLAG,NEWTON_PAIR,NEIGHFLAG>, const int&) const;
@@ -266,6 +275,15 @@ class FixRxKokkos : public FixRX {
   void unpack_reverse_comm(int, int *, double *);
   int pack_forward_comm(int , int *, double *, int, int *);
   void unpack_forward_comm(int , int , double *);
+  int pack_forward_comm_fix_kokkos(int, DAT::tdual_int_2d, int,
+                                   DAT::tdual_xfloat_1d &, int, int *);
+  void unpack_forward_comm_fix_kokkos(int, int, DAT::tdual_xfloat_1d &);
+
+  // device views used by the forward comm pack/unpack operators
+
+  typename AT::t_int_2d d_sendlist;
+  typename AT::t_xfloat_1d v_buf;
+  int iswap, first;
 
  //private: // replicate a few from FixRX
   int my_restartFlag;
@@ -20,7 +20,7 @@ namespace LAMMPS_NS {
 
 class KokkosBase {
  public:
-  KokkosBase() {}
+  KokkosBase() {fix_comm_kokkos_flag = 0;}
 
   // Pair
   virtual int pack_forward_comm_kokkos(int, DAT::tdual_int_2d,
@@ -28,6 +28,14 @@ class KokkosBase {
                                        int, int *) {return 0;};
   virtual void unpack_forward_comm_kokkos(int, int, DAT::tdual_xfloat_1d &) {}
 
+  // Fix
+  int fix_comm_kokkos_flag;      // 1 if Fix implements the device hooks below
+
+  virtual int pack_forward_comm_fix_kokkos(int, DAT::tdual_int_2d,
+                                           int, DAT::tdual_xfloat_1d &,
+                                           int, int *) {return 0;};
+  virtual void unpack_forward_comm_fix_kokkos(int, int, DAT::tdual_xfloat_1d &) {}
+
   // Region
   virtual void match_all_kokkos(int, DAT::tdual_int_1d) {}
 };
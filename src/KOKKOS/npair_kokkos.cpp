@@ -206,6 +206,10 @@ void NPairKokkos<DeviceType,HALF_NEIGH,GHOST,TRI,SIZE>::build(NeighList *list_)
   data.special_flag[2] = special_flag[2];
   data.special_flag[3] = special_flag[3];
 
+#ifdef KOKKOS_ENABLE_CUDA
+  int team_build = 0;
+#endif
+
   data.h_resize()=1;
   while(data.h_resize()) {
     data.h_new_maxneighs() = list->maxneighs;
@@ -233,6 +237,7 @@ void NPairKokkos<DeviceType,HALF_NEIGH,GHOST,TRI,SIZE>::build(NeighList *list_)
             if (team_size <= team_size_max) {
               Kokkos::TeamPolicy<DeviceType> config((mbins+factor-1)/factor,team_size);
               Kokkos::parallel_for(config, f);
+              team_build = 1;
             } else { // fall back to flat method
               f.sharedsize = 0;
               Kokkos::parallel_for(nall, f);
@@ -251,6 +256,7 @@ void NPairKokkos<DeviceType,HALF_NEIGH,GHOST,TRI,SIZE>::build(NeighList *list_)
             if (team_size <= team_size_max) {
               Kokkos::TeamPolicy<DeviceType> config((mbins+factor-1)/factor,team_size);
               Kokkos::parallel_for(config, f);
+              team_build = 1;
             } else { // fall back to flat method
               f.sharedsize = 0;
               Kokkos::parallel_for(nall, f);
@@ -271,6 +277,7 @@ void NPairKokkos<DeviceType,HALF_NEIGH,GHOST,TRI,SIZE>::build(NeighList *list_)
             if (team_size <= team_size_max) {
               Kokkos::TeamPolicy<DeviceType> config((mbins+factor-1)/factor,team_size);
               Kokkos::parallel_for(config, f);
+              team_build = 1;
             } else { // fall back to flat method
               f.sharedsize = 0;
               Kokkos::parallel_for(nall, f);
@@ -289,6 +296,7 @@ void NPairKokkos<DeviceType,HALF_NEIGH,GHOST,TRI,SIZE>::build(NeighList *list_)
             if (team_size <= team_size_max) {
               Kokkos::TeamPolicy<DeviceType> config((mbins+factor-1)/factor,team_size);
               Kokkos::parallel_for(config, f);
+              team_build = 1;
             } else { // fall back to flat method
               f.sharedsize = 0;
               Kokkos::parallel_for(nall, f);
@@ -312,6 +320,19 @@ void NPairKokkos<DeviceType,HALF_NEIGH,GHOST,TRI,SIZE>::build(NeighList *list_)
     }
   }
 
+#ifdef KOKKOS_ENABLE_CUDA
+
+  // the team-per-bin build emits each row in shared-memory gather order,
+  // which scatters downstream reads in the pair kernels
+  // re-sort rows into ascending index order so x is walked in the same
+  // coalesced pattern as the flat build produces
+
+  if (team_build) {
+    NPairKokkosSortFunctor<DeviceType> fsort(data);
+    Kokkos::parallel_for(nlocal, fsort);
+  }
+#endif
+
   if (GHOST) {
     list->inum = atom->nlocal;
     list->gnum = nall - atom->nlocal;
@@ -527,6 +548,33 @@ void NeighborKokkosExecute<DeviceType>::
   neigh_list.d_ilist(i) = i;
 }
 
+/* ----------------------------------------------------------------------
+   insertion sort the neighbors of atom i into ascending index order
+   rows are short and already sorted bin-by-bin, so insertion sort
+   beats a general sort here
+   the sort key masks off the special-bond bits stored above NEIGHMASK
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_FUNCTION
+void NeighborKokkosExecute<DeviceType>::
+   sort_Item(const int &i) const
+{
+  const AtomNeighbors neighbors_i = neigh_list.get_neighbors(i);
+  const int n = neigh_list.d_numneigh(i);
+
+  for (int m = 1; m < n; m++) {
+    const int j = neighbors_i(m);
+    const int jmasked = j & NEIGHMASK;
+    int k = m;
+    while (k > 0 && (neighbors_i(k-1) & NEIGHMASK) > jmasked) {
+      neighbors_i(k) = neighbors_i(k-1);
+      k--;
+    }
+    neighbors_i(k) = j;
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 #ifdef KOKKOS_ENABLE_CUDA
@@ -312,6 +312,9 @@ class NeighborKokkosExecute
   KOKKOS_FUNCTION
   void build_ItemSize(const int &i) const;
 
+  KOKKOS_FUNCTION
+  void sort_Item(const int &i) const;
+
 #ifdef KOKKOS_ENABLE_CUDA
   template<int HalfNeigh, int Newton, int Tri>
   __device__ inline
@@ -418,6 +421,20 @@ struct NPairKokkosBuildFunctor<LMPHostType,HALF_NEIGH,GHOST_NEWTON,TRI> {
   void operator() (typename Kokkos::TeamPolicy<LMPHostType>::member_type dev) const {} // Should error out
 };
 
+template<class DeviceType>
+struct NPairKokkosSortFunctor {
+  typedef DeviceType device_type;
+
+  const NeighborKokkosExecute<DeviceType> c;
+
+  NPairKokkosSortFunctor(const NeighborKokkosExecute<DeviceType> &_c):c(_c) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int & i) const {
+    c.sort_Item(i);
+  }
+};
+
 template<class DeviceType,int HALF_NEIGH>
 struct NPairKokkosBuildFunctorGhost {
   typedef DeviceType device_type;
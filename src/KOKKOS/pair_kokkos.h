@@ -48,6 +48,17 @@ struct DoCoul<1> {
   typedef CoulTag type;
 };
 
+// Per-style opt-in for the FP32 pre-screen of the cutoff test in the
+// non-coulomb compute loops below. A pair style enables it by
+// specializing this trait to value = 1 in its translation unit.
+// Only worthwhile for large-cutoff potentials where most candidate
+// pairs are rejected and the FP64 distance math dominates.
+
+template<class PairStyle>
+struct PrescreenF32 {
+  enum {value = 0};
+};
+
 
 //Specialisation for Neighborlist types Half, HalfThread, Full
 template <class PairStyle, int NEIGHFLAG, bool STACKPARAMS, class Specialisation = void>
@@ -102,6 +113,22 @@ class PairComputeFunctor  {
     return j >> SBBITS & 3;
   }
 
+  // square the pair separation in FP32 against a conservatively
+  // inflated cutoff, so rejected pairs skip the FP64 distance math
+  // the deltas are formed in FP64 first, so the FP32 result is off by
+  // a few ulp of the separation itself and the margin covers it
+  // pairs that survive are re-tested against the exact FP64 cutoff
+
+  KOKKOS_INLINE_FUNCTION
+  int prescreen_f32(const X_FLOAT& delx, const X_FLOAT& dely,
+                    const X_FLOAT& delz, const F_FLOAT& cutsq) const {
+    const float delxf = (float) delx;
+    const float delyf = (float) dely;
+    const float delzf = (float) delz;
+    const float rsqf = delxf*delxf + delyf*delyf + delzf*delzf;
+    return rsqf < (float) cutsq * (1.0f + 1.0e-5f);
+  }
+
   void contribute() {
     Kokkos::Experimental::contribute(c.f, dup_f);
 
@@ -143,6 +170,12 @@ class PairComputeFunctor  {
       const X_FLOAT dely = ytmp - c.x(j,1);
       const X_FLOAT delz = ztmp - c.x(j,2);
       const int jtype = c.type(j);
+
+      if (PrescreenF32<PairStyle>::value &&
+          !prescreen_f32(delx,dely,delz,
+                         STACKPARAMS?c.m_cutsq[itype][jtype]:c.d_cutsq(itype,jtype)))
+        continue;
+
       const F_FLOAT rsq = delx*delx + dely*dely + delz*delz;
 
       if(rsq < (STACKPARAMS?c.m_cutsq[itype][jtype]:c.d_cutsq(itype,jtype))) {
@@ -293,6 +326,12 @@ class PairComputeFunctor  {
         const X_FLOAT dely = ytmp - c.x(j,1);
         const X_FLOAT delz = ztmp - c.x(j,2);
         const int jtype = c.type(j);
+
+        if (PrescreenF32<PairStyle>::value &&
+            !prescreen_f32(delx,dely,delz,
+                           STACKPARAMS?c.m_cutsq[itype][jtype]:c.d_cutsq(itype,jtype)))
+          return;
+
         const F_FLOAT rsq = delx*delx + dely*dely + delz*delz;
 
         if(rsq < (STACKPARAMS?c.m_cutsq[itype][jtype]:c.d_cutsq(itype,jtype))) {
@@ -412,6 +451,12 @@ class PairComputeFunctor  {
         const X_FLOAT dely = ytmp - c.x(j,1);
         const X_FLOAT delz = ztmp - c.x(j,2);
         const int jtype = c.type(j);
+
+        if (PrescreenF32<PairStyle>::value &&
+            !prescreen_f32(delx,dely,delz,
+                           STACKPARAMS?c.m_cutsq[itype][jtype]:c.d_cutsq(itype,jtype)))
+          return;
+
         const F_FLOAT rsq = delx*delx + dely*dely + delz*delz;
 
         if(rsq < (STACKPARAMS?c.m_cutsq[itype][jtype]:c.d_cutsq(itype,jtype))) {
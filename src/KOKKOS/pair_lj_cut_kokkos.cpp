@@ -27,6 +27,16 @@
 
 using namespace LAMMPS_NS;
 
+// large cutoffs reject most candidate pairs, so screen the cutoff
+// test in FP32 before the FP64 distance math (see pair_kokkos.h)
+
+namespace LAMMPS_NS {
+template<class DeviceType>
+struct PrescreenF32<PairLJCutKokkos<DeviceType> > {
+  enum {value = 1};
+};
+}
+
 #define KOKKOS_CUDA_MAX_THREADS 256
 #define KOKKOS_CUDA_MIN_BLOCKS 8
 
@@ -64,6 +64,7 @@ template<class DeviceType>
 PPPMKokkos<DeviceType>::PPPMKokkos(LAMMPS *lmp) : PPPM(lmp)
 {
   atomKK = (AtomKokkos *) atom;
+  fieldforce_overlap_ok = 0;
   execution_space = ExecutionSpaceFromDevice<DeviceType>::space;
   datamask_read = X_MASK | F_MASK | TYPE_MASK | Q_MASK;
   datamask_modify = F_MASK;
@@ -43,7 +43,8 @@ using namespace MathConst;
 Ewald::Ewald(LAMMPS *lmp) : KSpace(lmp),
   kxvecs(NULL), kyvecs(NULL), kzvecs(NULL), ug(NULL), eg(NULL), vg(NULL),
   ek(NULL), sfacrl(NULL), sfacim(NULL), sfacrl_all(NULL), sfacim_all(NULL),
-  cs(NULL), sn(NULL), sfacrl_A(NULL), sfacim_A(NULL), sfacrl_A_all(NULL),
+  cs(NULL), sn(NULL), qcos(NULL), qsin(NULL),
+  sfacrl_A(NULL), sfacim_A(NULL), sfacrl_A_all(NULL),
   sfacim_A_all(NULL), sfacrl_B(NULL), sfacim_B(NULL), sfacrl_B_all(NULL),
   sfacim_B_all(NULL)
 {
@@ -63,6 +64,7 @@ Ewald::Ewald(LAMMPS *lmp) : KSpace(lmp),
   nmax = 0;
   ek = NULL;
   cs = sn = NULL;
+  qcos = qsin = NULL;
 
   kcount = 0;
 }
@@ -85,6 +87,8 @@ Ewald::~Ewald()
   memory->destroy(ek);
   memory->destroy3d_offset(cs,-kmax_created);
   memory->destroy3d_offset(sn,-kmax_created);
+  memory->destroy(qcos);
+  memory->destroy(qsin);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -315,10 +319,14 @@ void Ewald::setup()
     memory->destroy(ek);
     memory->destroy3d_offset(cs,-kmax_created);
     memory->destroy3d_offset(sn,-kmax_created);
+    memory->destroy(qcos);
+    memory->destroy(qsin);
     nmax = atom->nmax;
     memory->create(ek,nmax,3,"ewald:ek");
     memory->create3d_offset(cs,-kmax,kmax,3,nmax,"ewald:cs");
     memory->create3d_offset(sn,-kmax,kmax,3,nmax,"ewald:sn");
+    memory->create(qcos,nmax,"ewald:qcos");
+    memory->create(qsin,nmax,"ewald:qsin");
     kmax_created = kmax;
   }
 
@@ -373,10 +381,14 @@ void Ewald::compute(int eflag, int vflag)
     memory->destroy(ek);
     memory->destroy3d_offset(cs,-kmax_created);
     memory->destroy3d_offset(sn,-kmax_created);
+    memory->destroy(qcos);
+    memory->destroy(qsin);
     nmax = atom->nmax;
     memory->create(ek,nmax,3,"ewald:ek");
     memory->create3d_offset(cs,-kmax,kmax,3,nmax,"ewald:cs");
     memory->create3d_offset(sn,-kmax,kmax,3,nmax,"ewald:sn");
+    memory->create(qcos,nmax,"ewald:qcos");
+    memory->create(qsin,nmax,"ewald:qsin");
     kmax_created = kmax;
   }
 
@@ -413,18 +425,33 @@ void Ewald::compute(int eflag, int vflag)
     ky = kyvecs[k];
     kz = kzvecs[k];
 
+    // hoist per-k quantities so the inner loop streams
+    // thru contiguous per-atom rows of cs/sn
+
+    const double *csx = cs[kx][0];
+    const double *snx = sn[kx][0];
+    const double *csy = cs[ky][1];
+    const double *sny = sn[ky][1];
+    const double *csz = cs[kz][2];
+    const double *snz = sn[kz][2];
+    const double sfr = sfacrl_all[k];
+    const double sfi = sfacim_all[k];
+    const double egx = eg[k][0];
+    const double egy = eg[k][1];
+    const double egz = eg[k][2];
+
     for (i = 0; i < nlocal; i++) {
-      cypz = cs[ky][1][i]*cs[kz][2][i] - sn[ky][1][i]*sn[kz][2][i];
-      sypz = sn[ky][1][i]*cs[kz][2][i] + cs[ky][1][i]*sn[kz][2][i];
-      exprl = cs[kx][0][i]*cypz - sn[kx][0][i]*sypz;
-      expim = sn[kx][0][i]*cypz + cs[kx][0][i]*sypz;
-      partial = expim*sfacrl_all[k] - exprl*sfacim_all[k];
-      ek[i][0] += partial*eg[k][0];
-      ek[i][1] += partial*eg[k][1];
-      ek[i][2] += partial*eg[k][2];
+      cypz = csy[i]*csz[i] - sny[i]*snz[i];
+      sypz = sny[i]*csz[i] + csy[i]*snz[i];
+      exprl = csx[i]*cypz - snx[i]*sypz;
+      expim = snx[i]*cypz + csx[i]*sypz;
+      partial = expim*sfr - exprl*sfi;
+      ek[i][0] += partial*egx;
+      ek[i][1] += partial*egy;
+      ek[i][2] += partial*egz;
 
       if (evflag_atom) {
-        partial_peratom = exprl*sfacrl_all[k] + expim*sfacim_all[k];
+        partial_peratom = exprl*sfr + expim*sfi;
         if (eflag_atom) eatom[i] += q[i]*ug[k]*partial_peratom;
         if (vflag_atom)
           for (j = 0; j < 6; j++)
@@ -492,9 +519,9 @@ void Ewald::compute(int eflag, int vflag)
 
 void Ewald::eik_dot_r()
 {
-  int i,k,l,m,n,ic;
+  int i,k,l,m,n,ic,kflag;
   double cstr1,sstr1,cstr2,sstr2,cstr3,sstr3,cstr4,sstr4;
-  double sqk,clpm,slpm;
+  double sqk,clpm,slpm,clmm,slmm;
 
   double **x = atom->x;
   double *q = atom->q;
@@ -547,20 +574,32 @@ void Ewald::eik_dot_r()
   }
 
   // 1 = (k,l,0), 2 = (k,-l,0)
+  // q-weighted x-axis phase factors are shared by all l for a given k,
+  // so fill them once on the first l that passes the cutoff
 
   for (k = 1; k <= kxmax; k++) {
+    kflag = 0;
     for (l = 1; l <= kymax; l++) {
       sqk = (k*unitk[0] * k*unitk[0]) + (l*unitk[1] * l*unitk[1]);
       if (sqk <= gsqmx) {
+        if (!kflag) {
+          for (i = 0; i < nlocal; i++) {
+            qcos[i] = q[i]*cs[k][0][i];
+            qsin[i] = q[i]*sn[k][0][i];
+          }
+          kflag = 1;
+        }
+        const double *cy = cs[l][1];
+        const double *sy = sn[l][1];
         cstr1 = 0.0;
         sstr1 = 0.0;
         cstr2 = 0.0;
         sstr2 = 0.0;
         for (i = 0; i < nlocal; i++) {
-          cstr1 += q[i]*(cs[k][0][i]*cs[l][1][i] - sn[k][0][i]*sn[l][1][i]);
-          sstr1 += q[i]*(sn[k][0][i]*cs[l][1][i] + cs[k][0][i]*sn[l][1][i]);
-          cstr2 += q[i]*(cs[k][0][i]*cs[l][1][i] + sn[k][0][i]*sn[l][1][i]);
-          sstr2 += q[i]*(sn[k][0][i]*cs[l][1][i] - cs[k][0][i]*sn[l][1][i]);
+          cstr1 += qcos[i]*cy[i] - qsin[i]*sy[i];
+          sstr1 += qsin[i]*cy[i] + qcos[i]*sy[i];
+          cstr2 += qcos[i]*cy[i] + qsin[i]*sy[i];
+          sstr2 += qsin[i]*cy[i] - qcos[i]*sy[i];
         }
         sfacrl[n] = cstr1;
         sfacim[n++] = sstr1;
@@ -573,18 +612,28 @@ void Ewald::eik_dot_r()
   // 1 = (0,l,m), 2 = (0,l,-m)
 
   for (l = 1; l <= kymax; l++) {
+    kflag = 0;
     for (m = 1; m <= kzmax; m++) {
       sqk = (l*unitk[1] * l*unitk[1]) + (m*unitk[2] * m*unitk[2]);
       if (sqk <= gsqmx) {
+        if (!kflag) {
+          for (i = 0; i < nlocal; i++) {
+            qcos[i] = q[i]*cs[l][1][i];
+            qsin[i] = q[i]*sn[l][1][i];
+          }
+          kflag = 1;
+        }
+        const double *cz = cs[m][2];
+        const double *sz = sn[m][2];
         cstr1 = 0.0;
         sstr1 = 0.0;
         cstr2 = 0.0;
         sstr2 = 0.0;
         for (i = 0; i < nlocal; i++) {
-          cstr1 += q[i]*(cs[l][1][i]*cs[m][2][i] - sn[l][1][i]*sn[m][2][i]);
-          sstr1 += q[i]*(sn[l][1][i]*cs[m][2][i] + cs[l][1][i]*sn[m][2][i]);
-          cstr2 += q[i]*(cs[l][1][i]*cs[m][2][i] + sn[l][1][i]*sn[m][2][i]);
-          sstr2 += q[i]*(sn[l][1][i]*cs[m][2][i] - cs[l][1][i]*sn[m][2][i]);
+          cstr1 += qcos[i]*cz[i] - qsin[i]*sz[i];
+          sstr1 += qsin[i]*cz[i] + qcos[i]*sz[i];
+          cstr2 += qcos[i]*cz[i] + qsin[i]*sz[i];
+          sstr2 += qsin[i]*cz[i] - qcos[i]*sz[i];
         }
         sfacrl[n] = cstr1;
         sfacim[n++] = sstr1;
@@ -597,18 +646,28 @@ void Ewald::eik_dot_r()
   // 1 = (k,0,m), 2 = (k,0,-m)
 
   for (k = 1; k <= kxmax; k++) {
+    kflag = 0;
     for (m = 1; m <= kzmax; m++) {
       sqk = (k*unitk[0] * k*unitk[0]) + (m*unitk[2] * m*unitk[2]);
       if (sqk <= gsqmx) {
+        if (!kflag) {
+          for (i = 0; i < nlocal; i++) {
+            qcos[i] = q[i]*cs[k][0][i];
+            qsin[i] = q[i]*sn[k][0][i];
+          }
+          kflag = 1;
+        }
+        const double *cz = cs[m][2];
+        const double *sz = sn[m][2];
         cstr1 = 0.0;
         sstr1 = 0.0;
         cstr2 = 0.0;
         sstr2 = 0.0;
         for (i = 0; i < nlocal; i++) {
-          cstr1 += q[i]*(cs[k][0][i]*cs[m][2][i] - sn[k][0][i]*sn[m][2][i]);
-          sstr1 += q[i]*(sn[k][0][i]*cs[m][2][i] + cs[k][0][i]*sn[m][2][i]);
-          cstr2 += q[i]*(cs[k][0][i]*cs[m][2][i] + sn[k][0][i]*sn[m][2][i]);
-          sstr2 += q[i]*(sn[k][0][i]*cs[m][2][i] - cs[k][0][i]*sn[m][2][i]);
+          cstr1 += qcos[i]*cz[i] - qsin[i]*sz[i];
+          sstr1 += qsin[i]*cz[i] + qcos[i]*sz[i];
+          cstr2 += qcos[i]*cz[i] + qsin[i]*sz[i];
+          sstr2 += qsin[i]*cz[i] - qcos[i]*sz[i];
         }
         sfacrl[n] = cstr1;
         sfacim[n++] = sstr1;
@@ -621,11 +680,23 @@ void Ewald::eik_dot_r()
   // 1 = (k,l,m), 2 = (k,-l,m), 3 = (k,l,-m), 4 = (k,-l,-m)
 
   for (k = 1; k <= kxmax; k++) {
+    kflag = 0;
     for (l = 1; l <= kymax; l++) {
       for (m = 1; m <= kzmax; m++) {
         sqk = (k*unitk[0] * k*unitk[0]) + (l*unitk[1] * l*unitk[1]) +
           (m*unitk[2] * m*unitk[2]);
         if (sqk <= gsqmx) {
+          if (!kflag) {
+            for (i = 0; i < nlocal; i++) {
+              qcos[i] = q[i]*cs[k][0][i];
+              qsin[i] = q[i]*sn[k][0][i];
+            }
+            kflag = 1;
+          }
+          const double *cy = cs[l][1];
+          const double *sy = sn[l][1];
+          const double *cz = cs[m][2];
+          const double *sz = sn[m][2];
           cstr1 = 0.0;
           sstr1 = 0.0;
           cstr2 = 0.0;
@@ -634,26 +705,27 @@ void Ewald::eik_dot_r()
           sstr3 = 0.0;
           cstr4 = 0.0;
           sstr4 = 0.0;
+
+          // the 4 sign combos share the (l,m) and (l,-m) phase
+          // factors, so form each of them once per atom
+
           for (i = 0; i < nlocal; i++) {
-            clpm = cs[l][1][i]*cs[m][2][i] - sn[l][1][i]*sn[m][2][i];
-            slpm = sn[l][1][i]*cs[m][2][i] + cs[l][1][i]*sn[m][2][i];
-            cstr1 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
-            sstr1 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
-
-            clpm = cs[l][1][i]*cs[m][2][i] + sn[l][1][i]*sn[m][2][i];
-            slpm = -sn[l][1][i]*cs[m][2][i] + cs[l][1][i]*sn[m][2][i];
-            cstr2 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
-            sstr2 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
-
-            clpm = cs[l][1][i]*cs[m][2][i] + sn[l][1][i]*sn[m][2][i];
-            slpm = sn[l][1][i]*cs[m][2][i] - cs[l][1][i]*sn[m][2][i];
-            cstr3 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
-            sstr3 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
-
-            clpm = cs[l][1][i]*cs[m][2][i] - sn[l][1][i]*sn[m][2][i];
-            slpm = -sn[l][1][i]*cs[m][2][i] - cs[l][1][i]*sn[m][2][i];
-            cstr4 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
-            sstr4 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
+            clpm = cy[i]*cz[i] - sy[i]*sz[i];
+            slpm = sy[i]*cz[i] + cy[i]*sz[i];
+            clmm = cy[i]*cz[i] + sy[i]*sz[i];
+            slmm = sy[i]*cz[i] - cy[i]*sz[i];
+
+            cstr1 += qcos[i]*clpm - qsin[i]*slpm;
+            sstr1 += qsin[i]*clpm + qcos[i]*slpm;
+
+            cstr2 += qcos[i]*clmm + qsin[i]*slmm;
+            sstr2 += qsin[i]*clmm - qcos[i]*slmm;
+
+            cstr3 += qcos[i]*clmm - qsin[i]*slmm;
+            sstr3 += qsin[i]*clmm + qcos[i]*slmm;
+
+            cstr4 += qcos[i]*clpm + qsin[i]*slpm;
+            sstr4 += qsin[i]*clpm - qcos[i]*slpm;
           }
           sfacrl[n] = cstr1;
           sfacim[n++] = sstr1;
@@ -1234,6 +1306,7 @@ double Ewald::memory_usage()
   bytes += 4 * kmax3d * sizeof(double);
   bytes += nmax*3 * sizeof(double);
   bytes += 2 * (2*kmax+1)*3*nmax * sizeof(double);
+  bytes += 2 * nmax * sizeof(double);
   return bytes;
 }
 
@@ -50,6 +50,7 @@ class Ewald : public KSpace {
   double **ek;
   double *sfacrl,*sfacim,*sfacrl_all,*sfacim_all;
   double ***cs,***sn;
+  double *qcos,*qsin;     // q-weighted phase factors, scratch for eik_dot_r()
 
   // group-group interactions
 
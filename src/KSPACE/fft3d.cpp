@@ -37,6 +37,9 @@
 #define MIN(A,B) ((A) < (B) ? (A) : (B))
 #define MAX(A,B) ((A) > (B) ? (A) : (B))
 
+static void fft_3d_1d_ffts(FFT_DATA *, int, int, struct fft_plan_3d *);
+static void fft_3d_scale(FFT_DATA *, struct fft_plan_3d *);
+
 /* ----------------------------------------------------------------------
    Data layout for 3d FFTs:
 
@@ -69,21 +72,8 @@
 
 void fft_3d(FFT_DATA *in, FFT_DATA *out, int flag, struct fft_plan_3d *plan)
 {
-  int i,total,length,offset,num;
-  FFT_SCALAR norm;
-#if defined(FFT_FFTW3)
-  FFT_SCALAR *out_ptr;
-#endif
   FFT_DATA *data,*copy;
 
-  // system specific constants
-
-#if defined(FFT_FFTW3)
-  FFTW_API(plan) theplan;
-#else
-  // nothing to do for other FFTs
-#endif
-
   // pre-remap to prepare for 1st FFTs if needed
   // copy = loc for remap result
 
@@ -99,28 +89,7 @@ void fft_3d(FFT_DATA *in, FFT_DATA *out, int flag, struct fft_plan_3d *plan)
 
   // 1d FFTs along fast axis
 
-  total = plan->total1;
-  length = plan->length1;
-
-#if defined(FFT_MKL)
-  if (flag == -1)
-    DftiComputeForward(plan->handle_fast,data);
-  else
-    DftiComputeBackward(plan->handle_fast,data);
-#elif defined(FFT_FFTW3)
-  if (flag == -1)
-    theplan=plan->plan_fast_forward;
-  else
-    theplan=plan->plan_fast_backward;
-  FFTW_API(execute_dft)(theplan,data,data);
-#else
-  if (flag == -1)
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_fast_forward,&data[offset],&data[offset]);
-  else
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_fast_backward,&data[offset],&data[offset]);
-#endif
+  fft_3d_1d_ffts(data,flag,1,plan);
 
   // 1st mid-remap to prepare for 2nd FFTs
   // copy = loc for remap result
@@ -133,28 +102,7 @@ void fft_3d(FFT_DATA *in, FFT_DATA *out, int flag, struct fft_plan_3d *plan)
 
   // 1d FFTs along mid axis
 
-  total = plan->total2;
-  length = plan->length2;
-
-#if defined(FFT_MKL)
-  if (flag == -1)
-    DftiComputeForward(plan->handle_mid,data);
-  else
-    DftiComputeBackward(plan->handle_mid,data);
-#elif defined(FFT_FFTW3)
-  if (flag == -1)
-    theplan=plan->plan_mid_forward;
-  else
-    theplan=plan->plan_mid_backward;
-  FFTW_API(execute_dft)(theplan,data,data);
-#else
-  if (flag == -1)
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_mid_forward,&data[offset],&data[offset]);
-  else
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_mid_backward,&data[offset],&data[offset]);
-#endif
+  fft_3d_1d_ffts(data,flag,2,plan);
 
   // 2nd mid-remap to prepare for 3rd FFTs
   // copy = loc for remap result
@@ -167,57 +115,223 @@ void fft_3d(FFT_DATA *in, FFT_DATA *out, int flag, struct fft_plan_3d *plan)
 
   // 1d FFTs along slow axis
 
-  total = plan->total3;
-  length = plan->length3;
+  fft_3d_1d_ffts(data,flag,3,plan);
+
+  // post-remap to put data in output format if needed
+  // destination is always out
+
+  if (plan->post_plan)
+    remap_3d((FFT_SCALAR *) data, (FFT_SCALAR *) out,
+             (FFT_SCALAR *) plan->scratch, plan->post_plan);
+
+  // scaling if required
+
+  if (flag == 1 && plan->scaled) fft_3d_scale(out,plan);
+}
+
+/* ----------------------------------------------------------------------
+   Perform the 1d FFTs of one pass of a 3d FFT
+
+   Arguments:
+   data         starting address of in-place data for this pass
+   flag         1 for forward FFT, -1 for inverse FFT
+   pass         1/2/3 = FFTs along fast/mid/slow axis
+   plan         plan returned by previous call to fft_3d_create_plan
+------------------------------------------------------------------------- */
 
+static void fft_3d_1d_ffts(FFT_DATA *data, int flag, int pass,
+                           struct fft_plan_3d *plan)
+{
 #if defined(FFT_MKL)
+  DFTI_DESCRIPTOR *handle;
+
+  if (pass == 1) handle = plan->handle_fast;
+  else if (pass == 2) handle = plan->handle_mid;
+  else handle = plan->handle_slow;
+
   if (flag == -1)
-    DftiComputeForward(plan->handle_slow,data);
+    DftiComputeForward(handle,data);
   else
-    DftiComputeBackward(plan->handle_slow,data);
+    DftiComputeBackward(handle,data);
 #elif defined(FFT_FFTW3)
-  if (flag == -1)
-    theplan=plan->plan_slow_forward;
-  else
-    theplan=plan->plan_slow_backward;
+  FFTW_API(plan) theplan;
+
+  if (pass == 1) {
+    if (flag == -1) theplan = plan->plan_fast_forward;
+    else theplan = plan->plan_fast_backward;
+  } else if (pass == 2) {
+    if (flag == -1) theplan = plan->plan_mid_forward;
+    else theplan = plan->plan_mid_backward;
+  } else {
+    if (flag == -1) theplan = plan->plan_slow_forward;
+    else theplan = plan->plan_slow_backward;
+  }
+
   FFTW_API(execute_dft)(theplan,data,data);
 #else
-  if (flag == -1)
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_slow_forward,&data[offset],&data[offset]);
-  else
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_slow_backward,&data[offset],&data[offset]);
-#endif
+  int total,length,offset;
+  kiss_fft_cfg cfg;
+
+  if (pass == 1) {
+    total = plan->total1;
+    length = plan->length1;
+    if (flag == -1) cfg = plan->cfg_fast_forward;
+    else cfg = plan->cfg_fast_backward;
+  } else if (pass == 2) {
+    total = plan->total2;
+    length = plan->length2;
+    if (flag == -1) cfg = plan->cfg_mid_forward;
+    else cfg = plan->cfg_mid_backward;
+  } else {
+    total = plan->total3;
+    length = plan->length3;
+    if (flag == -1) cfg = plan->cfg_slow_forward;
+    else cfg = plan->cfg_slow_backward;
+  }
 
-  // post-remap to put data in output format if needed
-  // destination is always out
+  for (offset = 0; offset < total; offset += length)
+    kiss_fft(cfg,&data[offset],&data[offset]);
+#endif
+}
 
-  if (plan->post_plan)
-    remap_3d((FFT_SCALAR *) data, (FFT_SCALAR *) out,
-             (FFT_SCALAR *) plan->scratch, plan->post_plan);
+/* ----------------------------------------------------------------------
+   Scale the result of a forward 3d FFT
+------------------------------------------------------------------------- */
 
-  // scaling if required
-  if (flag == 1 && plan->scaled) {
-    norm = plan->norm;
-    num = plan->normnum;
+static void fft_3d_scale(FFT_DATA *out, struct fft_plan_3d *plan)
+{
+  int i;
+  FFT_SCALAR norm = plan->norm;
+  int num = plan->normnum;
 #if defined(FFT_FFTW3)
-    out_ptr = (FFT_SCALAR *)out;
+  FFT_SCALAR *out_ptr = (FFT_SCALAR *) out;
 #endif
-    for (i = 0; i < num; i++) {
+
+  for (i = 0; i < num; i++) {
 #if defined(FFT_FFTW3)
-      *(out_ptr++) *= norm;
-      *(out_ptr++) *= norm;
+    *(out_ptr++) *= norm;
+    *(out_ptr++) *= norm;
 #elif defined(FFT_MKL)
-      out[i] *= norm;
+    out[i] *= norm;
 #else  /* FFT_KISS */
-      out[i].re *= norm;
-      out[i].im *= norm;
+    out[i].re *= norm;
+    out[i].im *= norm;
 #endif
-    }
   }
 }
 
+/* ----------------------------------------------------------------------
+   Start a 3d FFT but defer its remaps and later passes
+
+   stores out and flag in the plan and posts the pre-remap messages,
+   then returns so the caller can overlap other work with the
+   communication, the FFT is advanced by fft_3d_progress() and
+   completed by fft_3d_finish()
+   only one FFT per plan can be in flight at a time and neither in
+   nor out may be touched until fft_3d_finish() returns
+------------------------------------------------------------------------- */
+
+void fft_3d_start(FFT_DATA *in, FFT_DATA *out, int flag,
+                  struct fft_plan_3d *plan)
+{
+  FFT_DATA *copy;
+
+  plan->async_out = out;
+  plan->async_flag = flag;
+
+  // pre-remap to prepare for 1st FFTs if needed
+  // copy = loc for remap result
+
+  if (plan->pre_plan) {
+    if (plan->pre_target == 0) copy = out;
+    else copy = plan->copy;
+    remap_3d_start((FFT_SCALAR *) in, (FFT_SCALAR *) copy,
+                   (FFT_SCALAR *) plan->scratch, plan->pre_plan);
+    plan->async_data = copy;
+  }
+  else
+    plan->async_data = in;
+
+  plan->async_stage = 1;
+}
+
+/* ----------------------------------------------------------------------
+   Advance a 3d FFT begun by fft_3d_start() by one stage
+
+   completes the remap in flight, performs the 1d FFTs of one pass,
+   and posts the messages of the next remap before returning
+   returns # of stages remaining, 0 when the FFT is complete
+------------------------------------------------------------------------- */
+
+int fft_3d_progress(struct fft_plan_3d *plan)
+{
+  FFT_DATA *copy;
+  FFT_DATA *data = plan->async_data;
+  FFT_DATA *out = plan->async_out;
+  int flag = plan->async_flag;
+
+  switch (plan->async_stage) {
+
+  // complete pre-remap, 1d FFTs along fast axis, start 1st mid-remap
+
+  case 1:
+    if (plan->pre_plan)
+      remap_3d_finish((FFT_SCALAR *) data,plan->pre_plan);
+    fft_3d_1d_ffts(data,flag,1,plan);
+    if (plan->mid1_target == 0) copy = out;
+    else copy = plan->copy;
+    remap_3d_start((FFT_SCALAR *) data, (FFT_SCALAR *) copy,
+                   (FFT_SCALAR *) plan->scratch, plan->mid1_plan);
+    plan->async_data = copy;
+    plan->async_stage = 2;
+    return 3;
+
+  // complete 1st mid-remap, 1d FFTs along mid axis, start 2nd mid-remap
+
+  case 2:
+    remap_3d_finish((FFT_SCALAR *) data,plan->mid1_plan);
+    fft_3d_1d_ffts(data,flag,2,plan);
+    if (plan->mid2_target == 0) copy = out;
+    else copy = plan->copy;
+    remap_3d_start((FFT_SCALAR *) data, (FFT_SCALAR *) copy,
+                   (FFT_SCALAR *) plan->scratch, plan->mid2_plan);
+    plan->async_data = copy;
+    plan->async_stage = 3;
+    return 2;
+
+  // complete 2nd mid-remap, 1d FFTs along slow axis, start post-remap
+
+  case 3:
+    remap_3d_finish((FFT_SCALAR *) data,plan->mid2_plan);
+    fft_3d_1d_ffts(data,flag,3,plan);
+    if (plan->post_plan)
+      remap_3d_start((FFT_SCALAR *) data, (FFT_SCALAR *) out,
+                     (FFT_SCALAR *) plan->scratch, plan->post_plan);
+    plan->async_stage = 4;
+    return 1;
+
+  // complete post-remap and scale if required
+
+  case 4:
+    if (plan->post_plan)
+      remap_3d_finish((FFT_SCALAR *) out,plan->post_plan);
+    if (flag == 1 && plan->scaled) fft_3d_scale(out,plan);
+    plan->async_stage = 0;
+    return 0;
+  }
+
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   Complete a 3d FFT begun by fft_3d_start()
+------------------------------------------------------------------------- */
+
+void fft_3d_finish(struct fft_plan_3d *plan)
+{
+  while (fft_3d_progress(plan)) {}
+}
+
 /* ----------------------------------------------------------------------
    Create plan for performing a 3d FFT
 
@@ -270,21 +384,34 @@ struct fft_plan_3d *fft_3d_create_plan(
 #endif
 
   // compute division of procs in 2 dimensions not on-processor
-
-  bifactor(nprocs,&np1,&np2);
-  ip1 = me % np1;
-  ip2 = me/np1;
+  // intermediate layouts are restricted to procs with non-empty input,
+  // so a caller can keep the FFTs on a subset of procs by assigning
+  // empty partitions (hi < lo) to the others (see kspace_modify fft/ranks)
+
+  int active,nactive,iactive;
+  if (in_ihi >= in_ilo && in_jhi >= in_jlo && in_khi >= in_klo) active = 1;
+  else active = 0;
+  MPI_Allreduce(&active,&nactive,1,MPI_INT,MPI_SUM,comm);
+  MPI_Scan(&active,&iactive,1,MPI_INT,MPI_SUM,comm);
+  iactive--;
+
+  bifactor(nactive,&np1,&np2);
+  if (active) {
+    ip1 = iactive % np1;
+    ip2 = iactive/np1;
+  } else ip1 = ip2 = -1;
 
   // allocate memory for plan data struct
 
   plan = (struct fft_plan_3d *) malloc(sizeof(struct fft_plan_3d));
   if (plan == NULL) return NULL;
+  plan->async_stage = 0;
 
   // remap from initial distribution to layout needed for 1st set of 1d FFTs
   // not needed if all procs own entire fast axis initially
   // first indices = distribution after 1st set of FFTs
 
-  if (in_ilo == 0 && in_ihi == nfast-1)
+  if ((in_ilo == 0 && in_ihi == nfast-1) || !active)
     flag = 0;
   else
     flag = 1;
@@ -300,12 +427,17 @@ struct fft_plan_3d *fft_3d_create_plan(
     first_khi = in_khi;
     plan->pre_plan = NULL;
   } else {
-    first_ilo = 0;
-    first_ihi = nfast - 1;
-    first_jlo = ip1*nmid/np1;
-    first_jhi = (ip1+1)*nmid/np1 - 1;
-    first_klo = ip2*nslow/np2;
-    first_khi = (ip2+1)*nslow/np2 - 1;
+    if (active) {
+      first_ilo = 0;
+      first_ihi = nfast - 1;
+      first_jlo = ip1*nmid/np1;
+      first_jhi = (ip1+1)*nmid/np1 - 1;
+      first_klo = ip2*nslow/np2;
+      first_khi = (ip2+1)*nslow/np2 - 1;
+    } else {
+      first_ilo = first_jlo = first_klo = 0;
+      first_ihi = first_jhi = first_khi = -1;
+    }
     plan->pre_plan =
       remap_3d_create_plan(comm,in_ilo,in_ihi,in_jlo,in_jhi,in_klo,in_khi,
                            first_ilo,first_ihi,first_jlo,first_jhi,
@@ -322,12 +454,17 @@ struct fft_plan_3d *fft_3d_create_plan(
   // choose which axis is split over np1 vs np2 to minimize communication
   // second indices = distribution after 2nd set of FFTs
 
-  second_ilo = ip1*nfast/np1;
-  second_ihi = (ip1+1)*nfast/np1 - 1;
-  second_jlo = 0;
-  second_jhi = nmid - 1;
-  second_klo = ip2*nslow/np2;
-  second_khi = (ip2+1)*nslow/np2 - 1;
+  if (active) {
+    second_ilo = ip1*nfast/np1;
+    second_ihi = (ip1+1)*nfast/np1 - 1;
+    second_jlo = 0;
+    second_jhi = nmid - 1;
+    second_klo = ip2*nslow/np2;
+    second_khi = (ip2+1)*nslow/np2 - 1;
+  } else {
+    second_ilo = second_jlo = second_klo = 0;
+    second_ihi = second_jhi = second_khi = -1;
+  }
   plan->mid1_plan =
       remap_3d_create_plan(comm,
                            first_ilo,first_ihi,first_jlo,first_jhi,
@@ -347,7 +484,7 @@ struct fft_plan_3d *fft_3d_create_plan(
   //   then this remapping goes directly to final distribution
   //  third indices = distribution after 3rd set of FFTs
 
-  if (permute == 2 && out_klo == 0 && out_khi == nslow-1)
+  if ((permute == 2 && out_klo == 0 && out_khi == nslow-1) || !active)
     flag = 0;
   else
     flag = 1;
@@ -362,12 +499,17 @@ struct fft_plan_3d *fft_3d_create_plan(
     third_klo = out_klo;
     third_khi = out_khi;
   } else {
-    third_ilo = ip1*nfast/np1;
-    third_ihi = (ip1+1)*nfast/np1 - 1;
-    third_jlo = ip2*nmid/np2;
-    third_jhi = (ip2+1)*nmid/np2 - 1;
-    third_klo = 0;
-    third_khi = nslow - 1;
+    if (active) {
+      third_ilo = ip1*nfast/np1;
+      third_ihi = (ip1+1)*nfast/np1 - 1;
+      third_jlo = ip2*nmid/np2;
+      third_jhi = (ip2+1)*nmid/np2 - 1;
+      third_klo = 0;
+      third_khi = nslow - 1;
+    } else {
+      third_ilo = third_jlo = third_klo = 0;
+      third_ihi = third_jhi = third_khi = -1;
+    }
   }
 
   plan->mid2_plan =
@@ -120,6 +120,12 @@ struct fft_plan_3d {
   int normnum;                      // # of values to rescale
   double norm;                      // normalization factor for rescaling
 
+                                    // split FFT via fft_3d_start/progress
+  int async_stage;                  // 0 = idle, 1-4 = next stage to perform
+  int async_flag;                   // forward/inverse flag of split FFT
+  FFT_DATA *async_data;             // current working buffer of split FFT
+  FFT_DATA *async_out;              // final output location of split FFT
+
                                     // system specific 1d FFT info
 #if defined(FFT_MKL)
   DFTI_DESCRIPTOR *handle_fast;
@@ -146,6 +152,9 @@ struct fft_plan_3d {
 
 extern "C" {
   void fft_3d(FFT_DATA *, FFT_DATA *, int, struct fft_plan_3d *);
+  void fft_3d_start(FFT_DATA *, FFT_DATA *, int, struct fft_plan_3d *);
+  int fft_3d_progress(struct fft_plan_3d *);
+  void fft_3d_finish(struct fft_plan_3d *);
   struct fft_plan_3d *fft_3d_create_plan(MPI_Comm, int, int, int,
                                          int, int, int, int, int,
                                          int, int, int, int, int, int, int,
@@ -47,6 +47,35 @@ void FFT3d::compute(FFT_SCALAR *in, FFT_SCALAR *out, int flag)
   fft_3d((FFT_DATA *) in,(FFT_DATA *) out,flag,plan);
 }
 
+/* ----------------------------------------------------------------------
+   split FFT, allows the caller to overlap other work with the remap
+   communication between calls
+   start() posts the first remap, each progress() call completes the
+   remap in flight, performs one pass of 1d FFTs, and posts the next
+   remap, returning # of stages remaining
+   finish() drives the FFT to completion, in and out may not be
+   touched until it returns
+------------------------------------------------------------------------- */
+
+void FFT3d::compute_start(FFT_SCALAR *in, FFT_SCALAR *out, int flag)
+{
+  fft_3d_start((FFT_DATA *) in,(FFT_DATA *) out,flag,plan);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FFT3d::compute_progress()
+{
+  return fft_3d_progress(plan);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FFT3d::compute_finish()
+{
+  fft_3d_finish(plan);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FFT3d::timing1d(FFT_SCALAR *in, int nsize, int flag)
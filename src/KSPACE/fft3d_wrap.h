@@ -25,6 +25,9 @@ class FFT3d : protected Pointers {
         int,int,int,int,int,int,int,int,int *,int);
   ~FFT3d();
   void compute(FFT_SCALAR *, FFT_SCALAR *, int);
+  void compute_start(FFT_SCALAR *, FFT_SCALAR *, int);
+  int compute_progress();
+  void compute_finish();
   void timing1d(FFT_SCALAR *, int, int);
 
  private:
@@ -505,6 +505,38 @@ void GridComm::forward_comm(KSpace *kspace, int which)
   }
 }
 
+/* ----------------------------------------------------------------------
+   same as forward_comm(), but while each message is in flight,
+   call back into the KSpace class to perform chunks of work
+   that do not depend on the incoming ghost values
+------------------------------------------------------------------------- */
+
+void GridComm::forward_comm_overlap(KSpace *kspace, int which)
+{
+  int flag;
+
+  for (int m = 0; m < nswap; m++) {
+    if (swap[m].sendproc == me)
+      kspace->pack_forward(which,buf2,swap[m].npack,swap[m].packlist);
+    else
+      kspace->pack_forward(which,buf1,swap[m].npack,swap[m].packlist);
+
+    if (swap[m].sendproc != me) {
+      MPI_Irecv(buf2,nforward*swap[m].nunpack,MPI_FFT_SCALAR,
+                swap[m].recvproc,0,gridcomm,&request);
+      MPI_Send(buf1,nforward*swap[m].npack,MPI_FFT_SCALAR,
+               swap[m].sendproc,0,gridcomm);
+
+      MPI_Test(&request,&flag,MPI_STATUS_IGNORE);
+      while (!flag && kspace->overlap_progress())
+        MPI_Test(&request,&flag,MPI_STATUS_IGNORE);
+      if (!flag) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    }
+
+    kspace->unpack_forward(which,buf2,swap[m].nunpack,swap[m].unpacklist);
+  }
+}
+
 /* ----------------------------------------------------------------------
    use swap list in reverse order to compute fully summed value
    for each owned grid pt that some other proc has copy of as a ghost grid pt
@@ -42,6 +42,7 @@ class GridComm : protected Pointers {
   int ghost_overlap();
   void setup();
   void forward_comm(class KSpace *, int);
+  void forward_comm_overlap(class KSpace *, int);
   void reverse_comm(class KSpace *, int);
   double memory_usage();
 
@@ -97,6 +97,9 @@ MSM::MSM(LAMMPS *lmp) : KSpace(lmp),
   scalar_pressure_flag = 1;
   warn_nonneutral = 0;
 
+  direct_level = -1;
+  direct_z = 0;
+
   order = 10;
 }
 
@@ -487,28 +490,47 @@ void MSM::compute(int eflag, int vflag)
 
   // forward communicate charge density values to fill ghost grid points
   // compute direct sum interaction and then restrict to coarser grid
+  // for kspace_modify overlap/comm, restrict first and defer each level's
+  //   direct sum so it is computed plane by plane while the ghost comm
+  //   of the next coarser level is in flight (restriction only reads
+  //   this level's charge and writes the next level's, so it can come
+  //   before the direct sum, which writes this level's potential)
 
   for (int n=0; n<=levels-2; n++) {
     if (!active_flag[n]) continue;
     current_level = n;
-    cg[n]->forward_comm(this,FORWARD_RHO);
-
-    direct(n);
-    restriction(n);
+    if (direct_level >= 0) {
+      cg[n]->forward_comm_overlap(this,FORWARD_RHO);
+      direct_finish();
+    } else cg[n]->forward_comm(this,FORWARD_RHO);
+
+    if (overlap_comm_flag) {
+      restriction(n);
+      direct_start(n);
+    } else {
+      direct(n);
+      restriction(n);
+    }
   }
 
   // compute direct interation for top grid level for non-periodic
   //   and for second from top grid level for periodic
+  // a deferred direct sum can also overlap the top level's ghost comm,
+  //   but not the MPI_Allreduce of the periodic case
 
   if (active_flag[levels-1]) {
     if (domain->nonperiodic) {
       current_level = levels-1;
-      cg[levels-1]->forward_comm(this,FORWARD_RHO);
+      if (direct_level >= 0) {
+        cg[levels-1]->forward_comm_overlap(this,FORWARD_RHO);
+        direct_finish();
+      } else cg[levels-1]->forward_comm(this,FORWARD_RHO);
       direct_top(levels-1);
       cg[levels-1]->reverse_comm(this,REVERSE_AD);
       if (vflag_atom)
         cg_peratom[levels-1]->reverse_comm(this,REVERSE_AD_PERATOM);
     } else {
+      direct_finish();
       // Here using MPI_Allreduce is cheaper than using commgrid
       grid_swap_forward(levels-1,qgrid[levels-1]);
       direct(levels-1);
@@ -517,7 +539,7 @@ void MSM::compute(int eflag, int vflag)
       if (vflag_atom)
         cg_peratom[levels-1]->reverse_comm(this,REVERSE_AD_PERATOM);
     }
-  }
+  } else direct_finish();
 
   // prolongate energy/virial from coarser grid to finer grid
   // reverse communicate from ghost grid points to get full sum
@@ -1547,7 +1569,17 @@ void MSM::make_rho()
 
 void MSM::direct(int n)
 {
-  double ***qgridn = qgrid[n];
+  direct_start(n);
+  direct_finish();
+}
+
+/* ----------------------------------------------------------------------
+   begin a (possibly deferred) direct sum for level n by zeroing its
+   grids, direct_finish() or overlap_progress() do the actual work
+------------------------------------------------------------------------- */
+
+void MSM::direct_start(int n)
+{
   double ***egridn = egrid[n];
   double ***v0gridn = v0grid[n];
   double ***v1gridn = v1grid[n];
@@ -1555,13 +1587,6 @@ void MSM::direct(int n)
   double ***v3gridn = v3grid[n];
   double ***v4gridn = v4grid[n];
   double ***v5gridn = v5grid[n];
-  double *g_directn = g_direct[n];
-  double *v0_directn = v0_direct[n];
-  double *v1_directn = v1_direct[n];
-  double *v2_directn = v2_direct[n];
-  double *v3_directn = v3_direct[n];
-  double *v4_directn = v4_direct[n];
-  double *v5_directn = v5_direct[n];
 
   // zero out electric potential
 
@@ -1578,6 +1603,64 @@ void MSM::direct(int n)
     memset(&(v5gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
   }
 
+  direct_level = n;
+  direct_z = nzlo_in[n];
+}
+
+/* ----------------------------------------------------------------------
+   complete a pending direct sum begun by direct_start(), no-op if none
+------------------------------------------------------------------------- */
+
+void MSM::direct_finish()
+{
+  if (direct_level < 0) return;
+  int n = direct_level;
+  direct_level = -1;
+
+  if (direct_z <= nzhi_in[n]) direct_range(n,direct_z,nzhi_in[n]);
+
+  // compute per-atom virial (if requested)
+
+  if (vflag_atom)
+    direct_peratom(n);
+}
+
+/* ----------------------------------------------------------------------
+   called by GridComm while grid messages for another level are in flight
+   compute the pending direct sum for one more z plane of grid points
+   return 1 if planes remain, 0 if the level is done
+------------------------------------------------------------------------- */
+
+int MSM::overlap_progress()
+{
+  if (direct_level < 0 || direct_z > nzhi_in[direct_level]) return 0;
+  direct_range(direct_level,direct_z,direct_z);
+  direct_z++;
+  return direct_z <= nzhi_in[direct_level];
+}
+
+/* ----------------------------------------------------------------------
+   direct sum for inner grid points of level n in z planes zlo to zhi
+------------------------------------------------------------------------- */
+
+void MSM::direct_range(int n, int zlo, int zhi)
+{
+  double ***qgridn = qgrid[n];
+  double ***egridn = egrid[n];
+  double ***v0gridn = v0grid[n];
+  double ***v1gridn = v1grid[n];
+  double ***v2gridn = v2grid[n];
+  double ***v3gridn = v3grid[n];
+  double ***v4gridn = v4grid[n];
+  double ***v5gridn = v5grid[n];
+  double *g_directn = g_direct[n];
+  double *v0_directn = v0_direct[n];
+  double *v1_directn = v1_direct[n];
+  double *v2_directn = v2_direct[n];
+  double *v3_directn = v3_direct[n];
+  double *v4_directn = v4_direct[n];
+  double *v5_directn = v5_direct[n];
+
   int icx,icy,icz,ix,iy,iz,zk,zyk,k;
   int ii,jj,kk;
   int imin,imax,jmin,jmax,kmax;
@@ -1591,7 +1674,7 @@ void MSM::direct(int n)
 
   // loop over inner grid points
 
-  for (icz = nzlo_in[n]; icz <= nzhi_in[n]; icz++) {
+  for (icz = zlo; icz <= zhi; icz++) {
 
     if (domain->zperiodic) {
       kmax = nzhi_direct;
@@ -1764,11 +1847,6 @@ void MSM::direct(int n)
       }
     }
   }
-
-  // compute per-atom virial (if requested)
-
-  if (vflag_atom)
-    direct_peratom(n);
 }
 
 /* ----------------------------------------------------------------------
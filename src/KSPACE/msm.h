@@ -32,6 +32,7 @@ class MSM : public KSpace {
   void setup();
   virtual void settings(int, char **);
   virtual void compute(int, int);
+  virtual int overlap_progress();
 
  protected:
   int me,nprocs;
@@ -86,6 +87,9 @@ class MSM : public KSpace {
 
   int current_level;
 
+  int direct_level;            // level of deferred direct sum, -1 if none
+  int direct_z;                // next z grid plane of deferred direct sum
+
   int **part2grid;             // storage for particle -> grid mapping
   int nmax;
 
@@ -108,6 +112,9 @@ class MSM : public KSpace {
   void particle_map();
   void make_rho();
   virtual void direct(int);
+  void direct_start(int);
+  void direct_range(int, int, int);
+  void direct_finish();
   void direct_peratom(int);
   void direct_top(int);
   void direct_peratom_top(int);
@@ -29,6 +29,7 @@
 #include "neigh_list.h"
 #include "neigh_request.h"
 #include "math_const.h"
+#include "math_special.h"
 #include "memory.h"
 #include "error.h"
 #include "utils.h"
@@ -54,6 +55,9 @@ PairLJCutCoulLong::PairLJCutCoulLong(LAMMPS *lmp) : Pair(lmp)
   ftable = NULL;
   qdist = 0.0;
   cut_respa = NULL;
+
+  maxewald = 0;
+  ewrsq = ewrinv = ewerfc = ewexpm2 = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -75,6 +79,11 @@ PairLJCutCoulLong::~PairLJCutCoulLong()
     memory->destroy(offset);
   }
   if (ftable) free_tables();
+
+  memory->destroy(ewrsq);
+  memory->destroy(ewrinv);
+  memory->destroy(ewerfc);
+  memory->destroy(ewexpm2);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -86,6 +95,7 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
   double fraction,table;
   double r,r2inv,r6inv,forcecoul,forcelj,factor_coul,factor_lj;
   double grij,expm2,prefactor,t,erfc;
+  const double *tb = NULL;
   int *ilist,*jlist,*numneigh,**firstneigh;
   double rsq;
 
@@ -119,6 +129,32 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    // with tables off, batch-evaluate erfc/exp for all neighbors of atom i
+    // evaluated for every neighbor regardless of cutoff, branch-free,
+    // the skin fraction is the price of the vectorized loop
+
+    if (!ncoultablebits) {
+      if (jnum > maxewald) {
+        maxewald = jnum;
+        memory->destroy(ewrsq);
+        memory->destroy(ewrinv);
+        memory->destroy(ewerfc);
+        memory->destroy(ewexpm2);
+        memory->create(ewrsq,maxewald,"pair:ewrsq");
+        memory->create(ewrinv,maxewald,"pair:ewrinv");
+        memory->create(ewerfc,maxewald,"pair:ewerfc");
+        memory->create(ewexpm2,maxewald,"pair:ewexpm2");
+      }
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj] & NEIGHMASK;
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        ewrsq[jj] = delx*delx + dely*dely + delz*delz;
+      }
+      MathSpecial::vewald(jnum,g_ewald,ewrsq,ewrinv,ewerfc,ewexpm2);
+    }
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
@@ -135,7 +171,14 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
         r2inv = 1.0/rsq;
 
         if (rsq < cut_coulsq) {
-          if (!ncoultablebits || rsq <= tabinnersq) {
+          if (!ncoultablebits) {
+            erfc = ewerfc[jj];
+            expm2 = ewexpm2[jj];
+            grij = g_ewald * rsq * ewrinv[jj];
+            prefactor = qqrd2e * qtmp*q[j] * ewrinv[jj];
+            forcecoul = prefactor * (erfc + EWALD_F*grij*expm2);
+            if (factor_coul < 1.0) forcecoul -= (1.0-factor_coul)*prefactor;
+          } else if (rsq <= tabinnersq) {
             r = sqrt(rsq);
             grij = g_ewald * r;
             expm2 = exp(-grij*grij);
@@ -145,15 +188,17 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
             forcecoul = prefactor * (erfc + EWALD_F*grij*expm2);
             if (factor_coul < 1.0) forcecoul -= (1.0-factor_coul)*prefactor;
           } else {
+            // interleaved table: one lookup touches one cacheline
             union_int_float_t rsq_lookup;
             rsq_lookup.f = rsq;
             itable = rsq_lookup.i & ncoulmask;
             itable >>= ncoulshiftbits;
-            fraction = (rsq_lookup.f - rtable[itable]) * drtable[itable];
-            table = ftable[itable] + fraction*dftable[itable];
+            tb = &tabpacked[8*itable];
+            fraction = (rsq_lookup.f - tb[0]) * tb[1];
+            table = tb[2] + fraction*tb[3];
             forcecoul = qtmp*q[j] * table;
             if (factor_coul < 1.0) {
-              table = ctable[itable] + fraction*dctable[itable];
+              table = tb[4] + fraction*tb[5];
               prefactor = qtmp*q[j] * table;
               forcecoul -= (1.0-factor_coul)*prefactor;
             }
@@ -181,7 +226,7 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
             if (!ncoultablebits || rsq <= tabinnersq)
               ecoul = prefactor*erfc;
             else {
-              table = etable[itable] + fraction*detable[itable];
+              table = tb[6] + fraction*tb[7];
               ecoul = qtmp*q[j] * table;
             }
             if (factor_coul < 1.0) ecoul -= (1.0-factor_coul)*prefactor;
@@ -57,6 +57,10 @@ class PairLJCutCoulLong : public Pair {
   double qdist;             // TIP4P distance from O site to negative charge
   double g_ewald;
 
+  int maxewald;             // allocated length of batch buffers below
+  double *ewrsq,*ewrinv,*ewerfc,*ewexpm2;   // per-neighbor erfc/exp staging
+                                            // for the untabulated path
+
   virtual void allocate();
 };
 
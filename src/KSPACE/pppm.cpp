@@ -48,6 +48,7 @@ using namespace MathSpecial;
 
 #define MAXORDER 7
 #define OFFSET 16384
+#define OVERLAP_CHUNK 256
 #define LARGE 10000.0
 #define SMALL 0.00001
 #define EPS_HOC 1.0e-7
@@ -105,6 +106,8 @@ PPPM::PPPM(LAMMPS *lmp) : KSpace(lmp),
   work1 = work2 = NULL;
   vg = NULL;
   fkx = fky = fkz = NULL;
+  wxalias = wyalias = wzalias = NULL;
+  nbx_alias = nby_alias = nbz_alias = -1;
 
   sf_precoeff1 = sf_precoeff2 = sf_precoeff3 =
     sf_precoeff4 = sf_precoeff5 = sf_precoeff6 = NULL;
@@ -123,6 +126,10 @@ PPPM::PPPM(LAMMPS *lmp) : KSpace(lmp),
   nmax = 0;
   part2grid = NULL;
 
+  fieldforce_overlap_ok = 1;
+  innerlist = boundarylist = NULL;
+  ninner = nboundary = ninner_done = 0;
+
   // define acons coefficients for estimation of kspace errors
   // see JCP 109, pg 7698 for derivation of coefficients
   // higher order coefficients may be computed if needed
@@ -179,6 +186,8 @@ PPPM::~PPPM()
   if (peratom_allocate_flag) deallocate_peratom();
   if (group_allocate_flag) deallocate_groups();
   memory->destroy(part2grid);
+  memory->destroy(innerlist);
+  memory->destroy(boundarylist);
   memory->destroy(acons);
 }
 
@@ -223,6 +232,21 @@ void PPPM::init()
   if (order < 2 || order > MAXORDER)
     error->all(FLERR,fmt::format("PPPM order cannot be < 2 or > {}",MAXORDER));
 
+  // grid/FFT precision is fixed at build time via the FFT_SINGLE switch,
+  // so a kspace_modify precision request can only be verified here
+  // forces are accumulated in double in either build
+
+  if (fft_precision_flag && fft_precision_flag != FFT_PRECISION) {
+    if (fft_precision_flag == 1)
+      error->all(FLERR,"Requested single precision FFTs but LAMMPS was "
+                 "built with double precision FFTs, rebuild with "
+                 "-DFFT_SINGLE");
+    else
+      error->all(FLERR,"Requested double precision FFTs but LAMMPS was "
+                 "built with single precision FFTs, rebuild without "
+                 "-DFFT_SINGLE");
+  }
+
   // compute two charge force
 
   two_charge();
@@ -638,8 +662,12 @@ void PPPM::compute(int eflag, int vflag)
 
   if (atom->nmax > nmax) {
     memory->destroy(part2grid);
+    memory->destroy(innerlist);
+    memory->destroy(boundarylist);
     nmax = atom->nmax;
     memory->create(part2grid,nmax,3,"pppm:part2grid");
+    memory->create(innerlist,nmax,"pppm:innerlist");
+    memory->create(boundarylist,nmax,"pppm:boundarylist");
   }
 
   // find grid points for all my particles
@@ -664,8 +692,31 @@ void PPPM::compute(int eflag, int vflag)
 
   // all procs communicate E-field values
   // to fill ghost cells surrounding their 3d bricks
+  // if overlapping, partition atoms into those whose stencil lies fully
+  //   inside my owned brick (no ghost values needed) and the rest,
+  //   then interpolate force on interior atoms while messages are in flight
+
+  int overlap = 0;
+  if (overlap_comm_flag && fieldforce_overlap_ok &&
+      differentiation_flag == 0 && !tip4pflag) overlap = 1;
 
-  if (differentiation_flag == 1) cg->forward_comm(this,FORWARD_AD);
+  if (overlap) {
+    int nx,ny,nz;
+    int nlocal = atom->nlocal;
+    ninner = nboundary = 0;
+    for (i = 0; i < nlocal; i++) {
+      nx = part2grid[i][0];
+      ny = part2grid[i][1];
+      nz = part2grid[i][2];
+      if (nx+nlower >= nxlo_in && nx+nupper <= nxhi_in &&
+          ny+nlower >= nylo_in && ny+nupper <= nyhi_in &&
+          nz+nlower >= nzlo_in && nz+nupper <= nzhi_in)
+        innerlist[ninner++] = i;
+      else boundarylist[nboundary++] = i;
+    }
+    ninner_done = 0;
+    cg->forward_comm_overlap(this,FORWARD_IK);
+  } else if (differentiation_flag == 1) cg->forward_comm(this,FORWARD_AD);
   else cg->forward_comm(this,FORWARD_IK);
 
   // extra per-atom energy/virial communication
@@ -678,8 +729,13 @@ void PPPM::compute(int eflag, int vflag)
   }
 
   // calculate the force on my particles
+  // if overlapping, finish interior atoms not reached during comm,
+  //   then the atoms whose stencils needed ghost values
 
-  fieldforce();
+  if (overlap) {
+    fieldforce_ik_list(innerlist,ninner_done,ninner);
+    fieldforce_ik_list(boundarylist,0,nboundary);
+  } else fieldforce();
 
   // extra per-atom energy/virial communication
 
@@ -802,23 +858,25 @@ void PPPM::allocate()
   // 1st FFT keeps data in FFT decomposition
   // 2nd FFT returns data in 3d brick decomposition
   // remap takes data from 3d brick to FFT decomposition
+  // remapflag = 2 selects the two-level node-aggregated exchange
 
   int tmp;
+  int remapflag = collective_flag ? 1 : (remap_node_flag ? 2 : 0);
 
   fft1 = new FFT3d(lmp,world,nx_pppm,ny_pppm,nz_pppm,
                    nxlo_fft,nxhi_fft,nylo_fft,nyhi_fft,nzlo_fft,nzhi_fft,
                    nxlo_fft,nxhi_fft,nylo_fft,nyhi_fft,nzlo_fft,nzhi_fft,
-                   0,0,&tmp,collective_flag);
+                   0,0,&tmp,remapflag);
 
   fft2 = new FFT3d(lmp,world,nx_pppm,ny_pppm,nz_pppm,
                    nxlo_fft,nxhi_fft,nylo_fft,nyhi_fft,nzlo_fft,nzhi_fft,
                    nxlo_in,nxhi_in,nylo_in,nyhi_in,nzlo_in,nzhi_in,
-                   0,0,&tmp,collective_flag);
+                   0,0,&tmp,remapflag);
 
   remap = new Remap(lmp,world,
                     nxlo_in,nxhi_in,nylo_in,nyhi_in,nzlo_in,nzhi_in,
                     nxlo_fft,nxhi_fft,nylo_fft,nyhi_fft,nzlo_fft,nzhi_fft,
-                    1,0,0,FFT_PRECISION,collective_flag);
+                    1,0,0,FFT_PRECISION,remapflag);
 
   // create ghost grid object for rho and electric field communication
 
@@ -876,6 +934,12 @@ void PPPM::deallocate()
     memory->destroy(fkz);
   }
 
+  memory->destroy(wxalias);
+  memory->destroy(wyalias);
+  memory->destroy(wzalias);
+  wxalias = wyalias = wzalias = NULL;
+  nbx_alias = nby_alias = nbz_alias = -1;
+
   memory->destroy(gf_b);
   if (stagger_flag) gf_b = NULL;
   memory->destroy2d_offset(rho1d,-order_allocated/2);
@@ -1462,22 +1526,40 @@ void PPPM::set_grid_local()
   // me_y,me_z = which proc (0-npe_fft-1) I am in y,z dimensions
   // nlo_fft,nhi_fft = lower/upper limit of the section
   //   of the global FFT mesh that I own
+  // for kspace_modify fft/ranks R > 1, only every Rth proc owns a pencil
+  //   other procs own an empty FFT partition (hi < lo) which drops them
+  //   out of the FFT transposes and 1d FFTs, shrinking the all-to-all
+  //   the remaps gather/scatter their brick data to/from the FFT procs
+  //   striding by R keeps the FFT procs spread evenly across nodes
+
+  int npes_fft = nprocs;
+  int me_fft = me;
+  if (fft_ranks > 1) {
+    npes_fft = (nprocs-1)/fft_ranks + 1;
+    if (me % fft_ranks == 0) me_fft = me/fft_ranks;
+    else me_fft = -1;
+  }
 
   int npey_fft,npez_fft;
-  if (nz_pppm >= nprocs) {
+  if (nz_pppm >= npes_fft) {
     npey_fft = 1;
-    npez_fft = nprocs;
-  } else procs2grid2d(nprocs,ny_pppm,nz_pppm,&npey_fft,&npez_fft);
-
-  int me_y = me % npey_fft;
-  int me_z = me / npey_fft;
-
-  nxlo_fft = 0;
-  nxhi_fft = nx_pppm - 1;
-  nylo_fft = me_y*ny_pppm/npey_fft;
-  nyhi_fft = (me_y+1)*ny_pppm/npey_fft - 1;
-  nzlo_fft = me_z*nz_pppm/npez_fft;
-  nzhi_fft = (me_z+1)*nz_pppm/npez_fft - 1;
+    npez_fft = npes_fft;
+  } else procs2grid2d(npes_fft,ny_pppm,nz_pppm,&npey_fft,&npez_fft);
+
+  if (me_fft >= 0) {
+    int me_y = me_fft % npey_fft;
+    int me_z = me_fft / npey_fft;
+
+    nxlo_fft = 0;
+    nxhi_fft = nx_pppm - 1;
+    nylo_fft = me_y*ny_pppm/npey_fft;
+    nyhi_fft = (me_y+1)*ny_pppm/npey_fft - 1;
+    nzlo_fft = me_z*nz_pppm/npez_fft;
+    nzhi_fft = (me_z+1)*nz_pppm/npez_fft - 1;
+  } else {
+    nxlo_fft = nylo_fft = nzlo_fft = 0;
+    nxhi_fft = nyhi_fft = nzhi_fft = -1;
+  }
 
   // PPPM grid pts owned by this proc, including ghosts
 
@@ -1519,8 +1601,63 @@ void PPPM::compute_gf_denom()
   for (l = 0; l < order; l++) gf_b[l] *= gaminv;
 }
 
+/* ----------------------------------------------------------------------
+   cache the per-dimension alias weights W(k)^2 used in greensfn sums
+   the weights depend only on grid indices, alias extents, and stencil
+     order, not on box size/shape, so the cache survives box changes
+     during a deformation run and is rebuilt only when the extents change
+   arg of each weight = pi*kper/n_pppm + pi*nalias for both the orthogonal
+     and triclinic forms of the greensfn sums
+------------------------------------------------------------------------- */
+
+void PPPM::update_gf_alias(int nbx, int nby, int nbz)
+{
+  int i,k,nx;
+
+  if (wxalias && nbx == nbx_alias && nby == nby_alias && nbz == nbz_alias)
+    return;
+
+  memory->destroy(wxalias);
+  memory->destroy(wyalias);
+  memory->destroy(wzalias);
+  memory->create(wxalias,(nxhi_fft-nxlo_fft+1)*(2*nbx+1),"pppm:wxalias");
+  memory->create(wyalias,(nyhi_fft-nylo_fft+1)*(2*nby+1),"pppm:wyalias");
+  memory->create(wzalias,(nzhi_fft-nzlo_fft+1)*(2*nbz+1),"pppm:wzalias");
+
+  const int twoorder = 2*order;
+  int kper;
+
+  i = 0;
+  for (k = nxlo_fft; k <= nxhi_fft; k++) {
+    kper = k - nx_pppm*(2*k/nx_pppm);
+    for (nx = -nbx; nx <= nbx; nx++)
+      wxalias[i++] = powsinxx(MY_PI*kper/nx_pppm + MY_PI*nx,twoorder);
+  }
+
+  i = 0;
+  for (k = nylo_fft; k <= nyhi_fft; k++) {
+    kper = k - ny_pppm*(2*k/ny_pppm);
+    for (nx = -nby; nx <= nby; nx++)
+      wyalias[i++] = powsinxx(MY_PI*kper/ny_pppm + MY_PI*nx,twoorder);
+  }
+
+  i = 0;
+  for (k = nzlo_fft; k <= nzhi_fft; k++) {
+    kper = k - nz_pppm*(2*k/nz_pppm);
+    for (nx = -nbz; nx <= nbz; nx++)
+      wzalias[i++] = powsinxx(MY_PI*kper/nz_pppm + MY_PI*nx,twoorder);
+  }
+
+  nbx_alias = nbx;
+  nby_alias = nby;
+  nbz_alias = nbz;
+}
+
 /* ----------------------------------------------------------------------
    pre-compute modified (Hockney-Eastwood) Coulomb Green's function
+   alias weights come from the cache, the step-dependent wavevector and
+     charge smearing factors are tabulated per dimension, so the triple
+     alias sum is pure arithmetic
 ------------------------------------------------------------------------- */
 
 void PPPM::compute_gf_ik()
@@ -1536,7 +1673,7 @@ void PPPM::compute_gf_ik()
   const double unitkz = (MY_2PI/zprd_slab);
 
   double snx,sny,snz;
-  double argx,argy,argz,wx,wy,wz,sx,sy,sz,qx,qy,qz;
+  double qx,qy,qz;
   double sum1,dot1,dot2;
   double numerator,denominator;
   double sqk;
@@ -1549,17 +1686,40 @@ void PPPM::compute_gf_ik()
                                     pow(-log(EPS_HOC),0.25));
   const int nbz = static_cast<int> ((g_ewald*zprd_slab/(MY_PI*nz_pppm)) *
                                     pow(-log(EPS_HOC),0.25));
-  const int twoorder = 2*order;
+
+  update_gf_alias(nbx,nby,nbz);
+
+  double *qxn,*sxn,*qyn,*syn,*qzn,*szn;
+  memory->create(qxn,2*nbx+1,"pppm:qxn");
+  memory->create(sxn,2*nbx+1,"pppm:sxn");
+  memory->create(qyn,2*nby+1,"pppm:qyn");
+  memory->create(syn,2*nby+1,"pppm:syn");
+  memory->create(qzn,2*nbz+1,"pppm:qzn");
+  memory->create(szn,2*nbz+1,"pppm:szn");
 
   n = 0;
   for (m = nzlo_fft; m <= nzhi_fft; m++) {
     mper = m - nz_pppm*(2*m/nz_pppm);
     snz = square(sin(0.5*unitkz*mper*zprd_slab/nz_pppm));
 
+    const double *wzrow = &wzalias[(m-nzlo_fft)*(2*nbz+1)];
+    for (nz = -nbz; nz <= nbz; nz++) {
+      qz = unitkz*(mper+nz_pppm*nz);
+      qzn[nz+nbz] = qz;
+      szn[nz+nbz] = exp(-0.25*square(qz/g_ewald)) * wzrow[nz+nbz];
+    }
+
     for (l = nylo_fft; l <= nyhi_fft; l++) {
       lper = l - ny_pppm*(2*l/ny_pppm);
       sny = square(sin(0.5*unitky*lper*yprd/ny_pppm));
 
+      const double *wyrow = &wyalias[(l-nylo_fft)*(2*nby+1)];
+      for (ny = -nby; ny <= nby; ny++) {
+        qy = unitky*(lper+ny_pppm*ny);
+        qyn[ny+nby] = qy;
+        syn[ny+nby] = exp(-0.25*square(qy/g_ewald)) * wyrow[ny+nby];
+      }
+
       for (k = nxlo_fft; k <= nxhi_fft; k++) {
         kper = k - nx_pppm*(2*k/nx_pppm);
         snx = square(sin(0.5*unitkx*kper*xprd/nx_pppm));
@@ -1567,31 +1727,38 @@ void PPPM::compute_gf_ik()
         sqk = square(unitkx*kper) + square(unitky*lper) + square(unitkz*mper);
 
         if (sqk != 0.0) {
-          numerator = 12.5663706/sqk;
-          denominator = gf_denom(snx,sny,snz);
-          sum1 = 0.0;
-
+          const double *wxrow = &wxalias[(k-nxlo_fft)*(2*nbx+1)];
           for (nx = -nbx; nx <= nbx; nx++) {
             qx = unitkx*(kper+nx_pppm*nx);
-            sx = exp(-0.25*square(qx/g_ewald));
-            argx = 0.5*qx*xprd/nx_pppm;
-            wx = powsinxx(argx,twoorder);
-
-            for (ny = -nby; ny <= nby; ny++) {
-              qy = unitky*(lper+ny_pppm*ny);
-              sy = exp(-0.25*square(qy/g_ewald));
-              argy = 0.5*qy*yprd/ny_pppm;
-              wy = powsinxx(argy,twoorder);
+            qxn[nx+nbx] = qx;
+            sxn[nx+nbx] = exp(-0.25*square(qx/g_ewald)) * wxrow[nx+nbx];
+          }
 
-              for (nz = -nbz; nz <= nbz; nz++) {
-                qz = unitkz*(mper+nz_pppm*nz);
-                sz = exp(-0.25*square(qz/g_ewald));
-                argz = 0.5*qz*zprd_slab/nz_pppm;
-                wz = powsinxx(argz,twoorder);
+          numerator = 12.5663706/sqk;
+          denominator = gf_denom(snx,sny,snz);
+          sum1 = 0.0;
 
-                dot1 = unitkx*kper*qx + unitky*lper*qy + unitkz*mper*qz;
-                dot2 = qx*qx+qy*qy+qz*qz;
-                sum1 += (dot1/dot2) * sx*sy*sz * wx*wy*wz;
+          const double ukx = unitkx*kper;
+          const double uky = unitky*lper;
+          const double ukz = unitkz*mper;
+
+          for (nx = 0; nx <= 2*nbx; nx++) {
+            qx = qxn[nx];
+            const double swx = sxn[nx];
+            const double dot1x = ukx*qx;
+            const double qx2 = qx*qx;
+
+            for (ny = 0; ny <= 2*nby; ny++) {
+              qy = qyn[ny];
+              const double swxy = swx*syn[ny];
+              const double dot1xy = dot1x + uky*qy;
+              const double qxy2 = qx2 + qy*qy;
+
+              for (nz = 0; nz <= 2*nbz; nz++) {
+                qz = qzn[nz];
+                dot1 = dot1xy + ukz*qz;
+                dot2 = qxy2 + qz*qz;
+                sum1 += (dot1/dot2) * swxy * szn[nz];
               }
             }
           }
@@ -1600,6 +1767,13 @@ void PPPM::compute_gf_ik()
       }
     }
   }
+
+  memory->destroy(qxn);
+  memory->destroy(sxn);
+  memory->destroy(qyn);
+  memory->destroy(syn);
+  memory->destroy(qzn);
+  memory->destroy(szn);
 }
 
 /* ----------------------------------------------------------------------
@@ -1610,7 +1784,7 @@ void PPPM::compute_gf_ik()
 void PPPM::compute_gf_ik_triclinic()
 {
   double snx,sny,snz;
-  double argx,argy,argz,wx,wy,wz,sx,sy,sz,qx,qy,qz;
+  double qx,qy,qz;
   double sum1,dot1,dot2;
   double numerator,denominator;
   double sqk;
@@ -1626,20 +1800,38 @@ void PPPM::compute_gf_ik_triclinic()
   const int nby = static_cast<int> (tmp[1]);
   const int nbz = static_cast<int> (tmp[2]);
 
-  const int twoorder = 2*order;
+  update_gf_alias(nbx,nby,nbz);
+
+  // x2lamdaT() is linear, so the reciprocal offset of alias (nx,ny,nz)
+  //   is the sum of nx,ny,nz multiples of 3 fixed per-axis vectors
+  // sx*sy*sz of the aliased wavevector collapses to a single exponential
+  //   of the squared magnitude
+
+  double bx[3],by[3],bz[3];
+  bx[0] = 2.0*MY_PI*nx_pppm; bx[1] = 0.0; bx[2] = 0.0;
+  by[0] = 0.0; by[1] = 2.0*MY_PI*ny_pppm; by[2] = 0.0;
+  bz[0] = 0.0; bz[1] = 0.0; bz[2] = 2.0*MY_PI*nz_pppm;
+  x2lamdaT(&bx[0],&bx[0]);
+  x2lamdaT(&by[0],&by[0]);
+  x2lamdaT(&bz[0],&bz[0]);
+
+  const double inv4g2 = -0.25/(g_ewald*g_ewald);
 
   n = 0;
   for (m = nzlo_fft; m <= nzhi_fft; m++) {
     mper = m - nz_pppm*(2*m/nz_pppm);
     snz = square(sin(MY_PI*mper/nz_pppm));
+    const double *wzrow = &wzalias[(m-nzlo_fft)*(2*nbz+1)];
 
     for (l = nylo_fft; l <= nyhi_fft; l++) {
       lper = l - ny_pppm*(2*l/ny_pppm);
       sny = square(sin(MY_PI*lper/ny_pppm));
+      const double *wyrow = &wyalias[(l-nylo_fft)*(2*nby+1)];
 
       for (k = nxlo_fft; k <= nxhi_fft; k++) {
         kper = k - nx_pppm*(2*k/nx_pppm);
         snx = square(sin(MY_PI*kper/nx_pppm));
+        const double *wxrow = &wxalias[(k-nxlo_fft)*(2*nbx+1)];
 
         double unitk_lamda[3];
         unitk_lamda[0] = 2.0*MY_PI*kper;
@@ -1655,35 +1847,25 @@ void PPPM::compute_gf_ik_triclinic()
           sum1 = 0.0;
 
           for (nx = -nbx; nx <= nbx; nx++) {
-            argx = MY_PI*kper/nx_pppm + MY_PI*nx;
-            wx = powsinxx(argx,twoorder);
+            const double wx = wxrow[nx+nbx];
+            const double qx0 = unitk_lamda[0] + nx*bx[0];
+            const double qy0 = unitk_lamda[1] + nx*bx[1];
+            const double qz0 = unitk_lamda[2] + nx*bx[2];
 
             for (ny = -nby; ny <= nby; ny++) {
-              argy = MY_PI*lper/ny_pppm + MY_PI*ny;
-              wy = powsinxx(argy,twoorder);
+              const double wxy = wx*wyrow[ny+nby];
+              const double qx1 = qx0 + ny*by[0];
+              const double qy1 = qy0 + ny*by[1];
+              const double qz1 = qz0 + ny*by[2];
 
               for (nz = -nbz; nz <= nbz; nz++) {
-                argz = MY_PI*mper/nz_pppm + MY_PI*nz;
-                wz = powsinxx(argz,twoorder);
-
-                double b[3];
-                b[0] = 2.0*MY_PI*nx_pppm*nx;
-                b[1] = 2.0*MY_PI*ny_pppm*ny;
-                b[2] = 2.0*MY_PI*nz_pppm*nz;
-                x2lamdaT(&b[0],&b[0]);
-
-                qx = unitk_lamda[0]+b[0];
-                sx = exp(-0.25*square(qx/g_ewald));
-
-                qy = unitk_lamda[1]+b[1];
-                sy = exp(-0.25*square(qy/g_ewald));
-
-                qz = unitk_lamda[2]+b[2];
-                sz = exp(-0.25*square(qz/g_ewald));
+                qx = qx1 + nz*bz[0];
+                qy = qy1 + nz*bz[1];
+                qz = qz1 + nz*bz[2];
 
                 dot1 = unitk_lamda[0]*qx + unitk_lamda[1]*qy + unitk_lamda[2]*qz;
                 dot2 = qx*qx+qy*qy+qz*qz;
-                sum1 += (dot1/dot2) * sx*sy*sz * wx*wy*wz;
+                sum1 += (dot1/dot2) * exp(inv4g2*dot2) * wxy*wzrow[nz+nbz];
               }
             }
           }
@@ -1927,7 +2109,7 @@ void PPPM::particle_map()
 
 void PPPM::make_rho()
 {
-  int l,m,n,nx,ny,nz,mx,my,mz;
+  int l,m,n,nx,ny,nz,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
 
   // clear 3d density array
@@ -1955,6 +2137,12 @@ void PPPM::make_rho()
 
     compute_rho1d(dx,dy,dz);
 
+    // hoist row pointers so the inner loop is a unit-stride
+    // multiply-add the compiler can vectorize
+
+    const FFT_SCALAR *r1d = &rho1d[0][nlower];
+    const int nl = nupper - nlower;
+
     z0 = delvolinv * q[i];
     for (n = nlower; n <= nupper; n++) {
       mz = n+nz;
@@ -1962,10 +2150,9 @@ void PPPM::make_rho()
       for (m = nlower; m <= nupper; m++) {
         my = m+ny;
         x0 = y0*rho1d[1][m];
-        for (l = nlower; l <= nupper; l++) {
-          mx = l+nx;
-          density_brick[mz][my][mx] += x0*rho1d[0][l];
-        }
+        FFT_SCALAR *d0 = &density_brick[mz][my][nx+nlower];
+        for (l = 0; l <= nl; l++)
+          d0[l] += x0*r1d[l];
       }
     }
   }
@@ -2429,9 +2616,9 @@ void PPPM::fieldforce()
 
 void PPPM::fieldforce_ik()
 {
-  int i,l,m,n,nx,ny,nz,mx,my,mz;
+  int i,l,m,n,nx,ny,nz,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
-  FFT_SCALAR ekx,eky,ekz;
+  double ekx,eky,ekz;
 
   // loop over my charges, interpolate electric field from nearby grid points
   // (nx,ny,nz) = global coords of grid pt to "lower left" of charge
@@ -2455,19 +2642,87 @@ void PPPM::fieldforce_ik()
 
     compute_rho1d(dx,dy,dz);
 
-    ekx = eky = ekz = ZEROF;
+    // hoist row pointers so the inner loop reads unit-stride
+    // field rows the compiler can vectorize
+
+    const FFT_SCALAR *r1d = &rho1d[0][nlower];
+    const int nl = nupper - nlower;
+
+    ekx = eky = ekz = 0.0;
     for (n = nlower; n <= nupper; n++) {
       mz = n+nz;
       z0 = rho1d[2][n];
       for (m = nlower; m <= nupper; m++) {
         my = m+ny;
         y0 = z0*rho1d[1][m];
-        for (l = nlower; l <= nupper; l++) {
-          mx = l+nx;
-          x0 = y0*rho1d[0][l];
-          ekx -= x0*vdx_brick[mz][my][mx];
-          eky -= x0*vdy_brick[mz][my][mx];
-          ekz -= x0*vdz_brick[mz][my][mx];
+        const FFT_SCALAR *vx0 = &vdx_brick[mz][my][nx+nlower];
+        const FFT_SCALAR *vy0 = &vdy_brick[mz][my][nx+nlower];
+        const FFT_SCALAR *vz0 = &vdz_brick[mz][my][nx+nlower];
+        for (l = 0; l <= nl; l++) {
+          x0 = y0*r1d[l];
+          ekx -= x0*vx0[l];
+          eky -= x0*vy0[l];
+          ekz -= x0*vz0[l];
+        }
+      }
+    }
+
+    // convert E-field to force
+
+    const double qfactor = qqrd2e * scale * q[i];
+    f[i][0] += qfactor*ekx;
+    f[i][1] += qfactor*eky;
+    if (slabflag != 2) f[i][2] += qfactor*ekz;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as fieldforce_ik() for atoms nfrom to nto-1 of an index list
+   used when interpolation is overlapped with ghost E-field comm
+------------------------------------------------------------------------- */
+
+void PPPM::fieldforce_ik_list(int *list, int nfrom, int nto)
+{
+  int i,ii,l,m,n,nx,ny,nz,my,mz;
+  FFT_SCALAR dx,dy,dz,x0,y0,z0;
+  double ekx,eky,ekz;
+
+  double *q = atom->q;
+  double **x = atom->x;
+  double **f = atom->f;
+
+  for (ii = nfrom; ii < nto; ii++) {
+    i = list[ii];
+    nx = part2grid[i][0];
+    ny = part2grid[i][1];
+    nz = part2grid[i][2];
+    dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
+    dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
+    dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
+
+    compute_rho1d(dx,dy,dz);
+
+    // hoist row pointers so the inner loop reads unit-stride
+    // field rows the compiler can vectorize
+
+    const FFT_SCALAR *r1d = &rho1d[0][nlower];
+    const int nl = nupper - nlower;
+
+    ekx = eky = ekz = 0.0;
+    for (n = nlower; n <= nupper; n++) {
+      mz = n+nz;
+      z0 = rho1d[2][n];
+      for (m = nlower; m <= nupper; m++) {
+        my = m+ny;
+        y0 = z0*rho1d[1][m];
+        const FFT_SCALAR *vx0 = &vdx_brick[mz][my][nx+nlower];
+        const FFT_SCALAR *vy0 = &vdy_brick[mz][my][nx+nlower];
+        const FFT_SCALAR *vz0 = &vdz_brick[mz][my][nx+nlower];
+        for (l = 0; l <= nl; l++) {
+          x0 = y0*r1d[l];
+          ekx -= x0*vx0[l];
+          eky -= x0*vy0[l];
+          ekz -= x0*vz0[l];
         }
       }
     }
@@ -2481,15 +2736,30 @@ void PPPM::fieldforce_ik()
   }
 }
 
+/* ----------------------------------------------------------------------
+   called by GridComm while ghost E-field messages are in flight
+   interpolate force on next chunk of interior atoms
+   return 1 if interior atoms remain, 0 if all are done
+------------------------------------------------------------------------- */
+
+int PPPM::overlap_progress()
+{
+  if (ninner_done == ninner) return 0;
+  int stop = MIN(ninner_done + OVERLAP_CHUNK,ninner);
+  fieldforce_ik_list(innerlist,ninner_done,stop);
+  ninner_done = stop;
+  return ninner_done < ninner;
+}
+
 /* ----------------------------------------------------------------------
    interpolate from grid to get electric field & force on my particles for ad
 ------------------------------------------------------------------------- */
 
 void PPPM::fieldforce_ad()
 {
-  int i,l,m,n,nx,ny,nz,mx,my,mz;
+  int i,l,m,n,nx,ny,nz,my,mz;
   FFT_SCALAR dx,dy,dz;
-  FFT_SCALAR ekx,eky,ekz;
+  double ekx,eky,ekz;
   double s1,s2,s3;
   double sf = 0.0;
   double *prd;
@@ -2526,16 +2796,26 @@ void PPPM::fieldforce_ad()
     compute_rho1d(dx,dy,dz);
     compute_drho1d(dx,dy,dz);
 
-    ekx = eky = ekz = ZEROF;
+    // hoist the per-row weight products and row pointer so the
+    // inner loop reads a unit-stride potential row
+
+    const FFT_SCALAR *r1d = &rho1d[0][nlower];
+    const FFT_SCALAR *dr1d = &drho1d[0][nlower];
+    const int nl = nupper - nlower;
+
+    ekx = eky = ekz = 0.0;
     for (n = nlower; n <= nupper; n++) {
       mz = n+nz;
       for (m = nlower; m <= nupper; m++) {
         my = m+ny;
-        for (l = nlower; l <= nupper; l++) {
-          mx = l+nx;
-          ekx += drho1d[0][l]*rho1d[1][m]*rho1d[2][n]*u_brick[mz][my][mx];
-          eky += rho1d[0][l]*drho1d[1][m]*rho1d[2][n]*u_brick[mz][my][mx];
-          ekz += rho1d[0][l]*rho1d[1][m]*drho1d[2][n]*u_brick[mz][my][mx];
+        const FFT_SCALAR wx = rho1d[1][m]*rho1d[2][n];
+        const FFT_SCALAR wy = drho1d[1][m]*rho1d[2][n];
+        const FFT_SCALAR wz = rho1d[1][m]*drho1d[2][n];
+        const FFT_SCALAR *u0 = &u_brick[mz][my][nx+nlower];
+        for (l = 0; l <= nl; l++) {
+          ekx += dr1d[l]*wx*u0[l];
+          eky += r1d[l]*wy*u0[l];
+          ekz += r1d[l]*wz*u0[l];
         }
       }
     }
@@ -57,6 +57,7 @@ class PPPM : public KSpace {
   virtual int timing_1d(int, double &);
   virtual int timing_3d(int, double &);
   virtual double memory_usage();
+  virtual int overlap_progress();
 
   virtual void compute_group_group(int, int, int);
 
@@ -86,6 +87,9 @@ class PPPM : public KSpace {
   double *greensfn;
   double **vg;
   double *fkx,*fky,*fkz;
+  double *wxalias,*wyalias,*wzalias;   // cached alias weights for greensfn,
+                                       //   independent of box size/shape
+  int nbx_alias,nby_alias,nbz_alias;   // alias extents of cached weights
   FFT_SCALAR *density_fft;
   FFT_SCALAR *work1,*work2;
 
@@ -110,6 +114,15 @@ class PPPM : public KSpace {
   int **part2grid;             // storage for particle -> grid mapping
   int nmax;
 
+  // overlap of ghost E-field comm with interpolation
+  // interior atoms = stencil fully inside my owned brick, no ghosts needed
+
+  int fieldforce_overlap_ok;   // 0 if derived style replaces interpolation
+  int *innerlist;              // indices of interior atoms
+  int *boundarylist;           // indices of atoms whose stencil needs ghosts
+  int ninner,nboundary;
+  int ninner_done;             // # of interior atoms interpolated so far
+
   double *boxlo;
                                // TIP4P settings
   int typeH,typeO;             // atom types of TIP4P water H and O atoms
@@ -132,6 +145,7 @@ class PPPM : public KSpace {
   double estimate_ik_error(double, double, bigint);
   virtual double compute_qopt();
   virtual void compute_gf_denom();
+  void update_gf_alias(int, int, int);
   virtual void compute_gf_ik();
   virtual void compute_gf_ad();
   void compute_sf_precoeff();
@@ -147,6 +161,7 @@ class PPPM : public KSpace {
   virtual void fieldforce();
   virtual void fieldforce_ik();
   virtual void fieldforce_ad();
+  void fieldforce_ik_list(int *, int, int);
 
   virtual void poisson_peratom();
   virtual void fieldforce_peratom();
@@ -52,6 +52,7 @@ PPPMCG::PPPMCG(LAMMPS *lmp) : PPPM(lmp),
   is_charged(NULL)
 {
   num_charged = -1;
+  fieldforce_overlap_ok = 0;
   group_group_enable = 1;
 }
 
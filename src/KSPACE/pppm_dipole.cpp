@@ -77,6 +77,7 @@ PPPMDipole::PPPMDipole(LAMMPS *lmp) : PPPM(lmp),
   densityz_fft_dipole(NULL)
 {
   dipoleflag = 1;
+  fieldforce_overlap_ok = 0;
   group_group_enable = 0;
 
   cg_dipole = NULL;
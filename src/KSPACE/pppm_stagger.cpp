@@ -53,6 +53,7 @@ PPPMStagger::PPPMStagger(LAMMPS *lmp) :
   gf_b2(NULL)
 {
   stagger_flag = 1;
+  fieldforce_overlap_ok = 0;
   group_group_enable = 0;
 
   memory->create(gf_b2,8,7,"pppm_stagger:gf_b2");
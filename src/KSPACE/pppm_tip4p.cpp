@@ -43,6 +43,7 @@ PPPMTIP4P::PPPMTIP4P(LAMMPS *lmp) : PPPM(lmp)
 {
   triclinic_support = 1;
   tip4pflag = 1;
+  fieldforce_overlap_ok = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -15,6 +15,7 @@
 #include <mpi.h>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #define PACK_DATA FFT_SCALAR
 
@@ -23,6 +24,12 @@
 #define MIN(A,B) ((A) < (B) ? (A) : (B))
 #define MAX(A,B) ((A) > (B) ? (A) : (B))
 
+static int remap_3d_chunk(struct extent_3d *, struct extent_3d *,
+                          int, int, int);
+static void remap_3d_node_setup(struct remap_plan_3d *, MPI_Comm,
+                                int, int, int,
+                                struct extent_3d *, struct extent_3d *);
+
 /* ----------------------------------------------------------------------
    Data layout for 3d remaps:
 
@@ -110,6 +117,109 @@ void remap_3d(FFT_SCALAR *in, FFT_SCALAR *out, FFT_SCALAR *buf,
                    &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
     }
 
+  // two-level node-aggregated exchange
+  // off-node chunks are gathered on the node leader, leaders exchange one
+  // aggregate message per node pair, arrivals are scattered to their
+  // destination procs; on-node chunks use the point-to-point path
+
+  } else if (plan->usenodeaggregate) {
+    int i,isend,irecv,offset;
+    FFT_SCALAR *scratch;
+
+    if (plan->memory == 0)
+      scratch = buf;
+    else
+      scratch = plan->scratch;
+
+    // post recvs for on-node chunks, then send on-node chunks directly
+
+    for (irecv = 0; irecv < plan->nrecv; irecv++)
+      if (!plan->recv_isinter[irecv])
+        MPI_Irecv(&scratch[plan->recv_bufloc[irecv]],plan->recv_size[irecv],
+                  MPI_FFT_SCALAR,plan->recv_proc[irecv],0,
+                  plan->comm,&plan->request[irecv]);
+
+    for (isend = 0; isend < plan->nsend; isend++)
+      if (!plan->send_isinter[isend]) {
+        plan->pack(&in[plan->send_offset[isend]],
+                   plan->sendbuf,&plan->packplan[isend]);
+        MPI_Send(plan->sendbuf,plan->send_size[isend],MPI_FFT_SCALAR,
+                 plan->send_proc[isend],0,plan->comm);
+      }
+
+    // copy in -> scratch -> out for self data
+
+    if (plan->self) {
+      isend = plan->nsend;
+      irecv = plan->nrecv;
+      plan->pack(&in[plan->send_offset[isend]],
+                 &scratch[plan->recv_bufloc[irecv]],
+                 &plan->packplan[isend]);
+      plan->unpack(&scratch[plan->recv_bufloc[irecv]],
+                   &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
+    }
+
+    // pack my off-node chunks in canonical order, gather them on the leader
+
+    offset = 0;
+    for (i = 0; i < plan->naggsend; i++) {
+      isend = plan->aggsendidx[i];
+      plan->pack(&in[plan->send_offset[isend]],
+                 &plan->aggsendbuf[offset],&plan->packplan[isend]);
+      offset += plan->send_size[isend];
+    }
+    MPI_Gatherv(plan->aggsendbuf,plan->aggsendtotal,MPI_FFT_SCALAR,
+                plan->gatherbuf,plan->gathercnt,plan->gatherdispl,
+                MPI_FFT_SCALAR,0,plan->nodecomm);
+
+    // leaders route chunks into one aggregate message per destination node,
+    // exchange the aggregates, then route arrivals per destination proc
+
+    if (plan->noderank == 0) {
+      int nreq = 0;
+      for (i = 0; i < plan->nsegsend; i++)
+        memcpy(&plan->nodesendbuf[plan->segsend_to[i]],
+               &plan->gatherbuf[plan->segsend_from[i]],
+               plan->segsend_size[i]*sizeof(FFT_SCALAR));
+      for (i = 0; i < plan->nnodes; i++)
+        if (i != plan->mynode && plan->noderecvcnt[i])
+          MPI_Irecv(&plan->noderecvbuf[plan->noderecvdispl[i]],
+                    plan->noderecvcnt[i],MPI_FFT_SCALAR,
+                    plan->nodeleader[i],0,plan->comm,
+                    &plan->noderequest[nreq++]);
+      for (i = 0; i < plan->nnodes; i++)
+        if (i != plan->mynode && plan->nodesendcnt[i])
+          MPI_Send(&plan->nodesendbuf[plan->nodesenddispl[i]],
+                   plan->nodesendcnt[i],MPI_FFT_SCALAR,
+                   plan->nodeleader[i],0,plan->comm);
+      MPI_Waitall(nreq,plan->noderequest,MPI_STATUSES_IGNORE);
+      for (i = 0; i < plan->nsegrecv; i++)
+        memcpy(&plan->scatterbuf[plan->segrecv_to[i]],
+               &plan->noderecvbuf[plan->segrecv_from[i]],
+               plan->segrecv_size[i]*sizeof(FFT_SCALAR));
+    }
+
+    MPI_Scatterv(plan->scatterbuf,plan->scattercnt,plan->scatterdispl,
+                 MPI_FFT_SCALAR,plan->aggrecvbuf,plan->aggrecvtotal,
+                 MPI_FFT_SCALAR,0,plan->nodecomm);
+
+    // unpack delivered off-node chunks, then complete on-node recvs
+
+    offset = 0;
+    for (i = 0; i < plan->naggrecv; i++) {
+      irecv = plan->aggrecvidx[i];
+      plan->unpack(&plan->aggrecvbuf[offset],
+                   &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
+      offset += plan->recv_size[irecv];
+    }
+
+    for (irecv = 0; irecv < plan->nrecv; irecv++)
+      if (!plan->recv_isinter[irecv]) {
+        MPI_Wait(&plan->request[irecv],MPI_STATUS_IGNORE);
+        plan->unpack(&scratch[plan->recv_bufloc[irecv]],
+                     &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
+      }
+
   // use All2Allv collective for remap communication
 
   } else {
@@ -204,6 +314,91 @@ void remap_3d(FFT_SCALAR *in, FFT_SCALAR *out, FFT_SCALAR *buf,
   }
 }
 
+/* ----------------------------------------------------------------------
+   Start a 3d remap but do not wait for incoming messages
+
+   posts all recvs and sends, then returns so the caller can overlap
+   other work with the communication, completed by remap_3d_finish()
+   only one exchange per plan can be in flight at a time and neither
+   in, out, nor buf may be touched until remap_3d_finish() returns
+   collective and node-aggregated plans have no split point, for them
+   the entire remap is performed here and remap_3d_finish() is a no-op
+------------------------------------------------------------------------- */
+
+void remap_3d_start(FFT_SCALAR *in, FFT_SCALAR *out, FFT_SCALAR *buf,
+                    struct remap_plan_3d *plan)
+{
+  int isend,irecv;
+  FFT_SCALAR *scratch;
+
+  if (plan->usecollective || plan->usenodeaggregate) {
+    remap_3d(in,out,buf,plan);
+    plan->inflight = 0;
+    return;
+  }
+
+  if (plan->memory == 0)
+    scratch = buf;
+  else
+    scratch = plan->scratch;
+
+  // post all recvs into scratch space
+
+  for (irecv = 0; irecv < plan->nrecv; irecv++)
+    MPI_Irecv(&scratch[plan->recv_bufloc[irecv]],plan->recv_size[irecv],
+              MPI_FFT_SCALAR,plan->recv_proc[irecv],0,
+              plan->comm,&plan->request[irecv]);
+
+  // send all messages to other procs
+
+  for (isend = 0; isend < plan->nsend; isend++) {
+    plan->pack(&in[plan->send_offset[isend]],
+               plan->sendbuf,&plan->packplan[isend]);
+    MPI_Send(plan->sendbuf,plan->send_size[isend],MPI_FFT_SCALAR,
+             plan->send_proc[isend],0,plan->comm);
+  }
+
+  // copy in -> scratch -> out for self data
+
+  if (plan->self) {
+    isend = plan->nsend;
+    irecv = plan->nrecv;
+    plan->pack(&in[plan->send_offset[isend]],
+               &scratch[plan->recv_bufloc[irecv]],
+               &plan->packplan[isend]);
+    plan->unpack(&scratch[plan->recv_bufloc[irecv]],
+                 &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
+  }
+
+  plan->inflight = 1;
+  plan->inflight_scratch = scratch;
+}
+
+/* ----------------------------------------------------------------------
+   Complete a 3d remap begun by remap_3d_start()
+
+   out must be the same pointer that was passed to remap_3d_start()
+------------------------------------------------------------------------- */
+
+void remap_3d_finish(FFT_SCALAR *out, struct remap_plan_3d *plan)
+{
+  int i,irecv;
+  FFT_SCALAR *scratch;
+
+  if (!plan->inflight) return;
+  scratch = plan->inflight_scratch;
+
+  // unpack all messages from scratch -> out
+
+  for (i = 0; i < plan->nrecv; i++) {
+    MPI_Waitany(plan->nrecv,plan->request,&irecv,MPI_STATUS_IGNORE);
+    plan->unpack(&scratch[plan->recv_bufloc[irecv]],
+                 &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
+  }
+
+  plan->inflight = 0;
+}
+
 /* ----------------------------------------------------------------------
    Create plan for performing a 3d remap
 
@@ -253,7 +448,9 @@ struct remap_plan_3d *remap_3d_create_plan(
 
   plan = (struct remap_plan_3d *) malloc(sizeof(struct remap_plan_3d));
   if (plan == NULL) return NULL;
-  plan->usecollective = usecollective;
+  plan->usecollective = (usecollective == 1);
+  plan->usenodeaggregate = 0;
+  plan->inflight = 0;
 
   // store parameters in local data structs
 
@@ -571,6 +768,12 @@ struct remap_plan_3d *remap_3d_create_plan(
   if (nrecv == plan->nrecv) plan->self = 0;
   else plan->self = 1;
 
+  // setup two-level node-aggregated exchange if requested
+  // falls back to point-to-point on a single node or with 1 proc per node
+
+  if (usecollective == 2)
+    remap_3d_node_setup(plan,comm,me,nprocs,nqty,inarray,outarray);
+
   // free locally malloced space
 
   free(inarray);
@@ -647,6 +850,38 @@ void remap_3d_destroy_plan(struct remap_plan_3d *plan)
       free(plan->commringlist);
   }
 
+  if (plan->usenodeaggregate) {
+    MPI_Comm_free(&plan->nodecomm);
+    free(plan->nodeleader);
+    free(plan->send_isinter);
+    free(plan->recv_isinter);
+    free(plan->aggsendidx);
+    free(plan->aggrecvidx);
+    free(plan->aggsendbuf);
+    free(plan->aggrecvbuf);
+    if (plan->noderank == 0) {
+      free(plan->gathercnt);
+      free(plan->gatherdispl);
+      free(plan->scattercnt);
+      free(plan->scatterdispl);
+      free(plan->nodesendcnt);
+      free(plan->nodesenddispl);
+      free(plan->noderecvcnt);
+      free(plan->noderecvdispl);
+      free(plan->segsend_from);
+      free(plan->segsend_to);
+      free(plan->segsend_size);
+      free(plan->segrecv_from);
+      free(plan->segrecv_to);
+      free(plan->segrecv_size);
+      free(plan->gatherbuf);
+      free(plan->nodesendbuf);
+      free(plan->noderecvbuf);
+      free(plan->scatterbuf);
+      free(plan->noderequest);
+    }
+  }
+
   // free internal arrays
 
   if (plan->nsend || plan->self) {
@@ -700,3 +935,345 @@ int remap_3d_collide(struct extent_3d *block1, struct extent_3d *block2,
 
   return 1;
 }
+
+/* ----------------------------------------------------------------------
+   size in datums of the chunk proc s sends to proc r in this remap
+   computable locally by any proc from the gathered in/out extents
+   return 0 if proc s sends nothing to proc r
+------------------------------------------------------------------------- */
+
+static int remap_3d_chunk(struct extent_3d *inarray,
+                          struct extent_3d *outarray,
+                          int s, int r, int nqty)
+{
+  struct extent_3d overlap;
+
+  if (!remap_3d_collide(&inarray[s],&outarray[r],&overlap)) return 0;
+  return nqty*overlap.isize*overlap.jsize*overlap.ksize;
+}
+
+/* ----------------------------------------------------------------------
+   setup the two-level node-aggregated exchange for a remap plan
+   each proc's off-node chunks are gathered on its node's leader,
+   leaders exchange one aggregate message per pair of nodes,
+   arrivals are scattered to their destination procs,
+   on-node chunks keep using the point-to-point path
+   all chunk sizes and orderings are derived locally from the
+   gathered in/out extents, so no extra setup communication is needed
+   leaves plan->usenodeaggregate 0 (pure point-to-point) if there are
+   fewer than 2 nodes or no node has more than 1 proc
+------------------------------------------------------------------------- */
+
+static void remap_3d_node_setup(struct remap_plan_3d *plan, MPI_Comm comm,
+                                int me, int nprocs, int nqty,
+                                struct extent_3d *inarray,
+                                struct extent_3d *outarray)
+{
+  int i,k,n,r,s,size,offset,total,widest,nnodes;
+
+  // split procs by physical node, keyed by comm rank so that
+  // node rank order matches comm rank order within each node
+  // this keeps sender-side and receiver-side chunk orderings consistent
+
+  MPI_Comm_split_type(comm,MPI_COMM_TYPE_SHARED,me,MPI_INFO_NULL,
+                      &plan->nodecomm);
+  MPI_Comm_rank(plan->nodecomm,&plan->noderank);
+  MPI_Comm_size(plan->nodecomm,&plan->nodesize);
+
+  MPI_Allreduce(&plan->nodesize,&widest,1,MPI_INT,MPI_MAX,comm);
+
+  // identify each proc's node by the comm rank of its node's leader
+  // nodes are indexed by ascending leader rank
+
+  int leadrank = me;
+  MPI_Bcast(&leadrank,1,MPI_INT,0,plan->nodecomm);
+
+  int *leaderof = (int *) malloc(nprocs*sizeof(int));
+  int *noderankof = (int *) malloc(nprocs*sizeof(int));
+  int *rank2node = (int *) malloc(nprocs*sizeof(int));
+  MPI_Allgather(&leadrank,1,MPI_INT,leaderof,1,MPI_INT,comm);
+  MPI_Allgather(&plan->noderank,1,MPI_INT,noderankof,1,MPI_INT,comm);
+
+  plan->nodeleader = (int *) malloc(nprocs*sizeof(int));
+  nnodes = 0;
+  for (r = 0; r < nprocs; r++)
+    if (leaderof[r] == r) plan->nodeleader[nnodes++] = r;
+  plan->nnodes = nnodes;
+
+  for (r = 0; r < nprocs; r++) {
+    for (n = 0; n < nnodes; n++)
+      if (plan->nodeleader[n] == leaderof[r]) break;
+    rank2node[r] = n;
+  }
+  plan->mynode = rank2node[me];
+
+  // aggregation only pays off with multiple multi-proc nodes
+
+  if (nnodes < 2 || widest < 2) {
+    MPI_Comm_free(&plan->nodecomm);
+    free(plan->nodeleader);
+    free(leaderof);
+    free(noderankof);
+    free(rank2node);
+    return;
+  }
+
+  // flag each of my send/recv entries as on-node or off-node
+  // the self entry (at index nsend/nrecv) is on-node by definition
+
+  plan->send_isinter = (int *) malloc((plan->nsend+1)*sizeof(int));
+  plan->recv_isinter = (int *) malloc((plan->nrecv+1)*sizeof(int));
+  for (i = 0; i < plan->nsend; i++)
+    plan->send_isinter[i] = (rank2node[plan->send_proc[i]] != plan->mynode);
+  for (i = 0; i < plan->nrecv; i++)
+    plan->recv_isinter[i] = (rank2node[plan->recv_proc[i]] != plan->mynode);
+
+  // my off-node sends in canonical order:
+  // ascending dest node, then ascending dest comm rank
+  // aggsendidx maps that order onto my send_* entries
+
+  plan->naggsend = 0;
+  plan->aggsendtotal = 0;
+  plan->aggsendidx = (int *) malloc((plan->nsend+1)*sizeof(int));
+  for (n = 0; n < nnodes; n++) {
+    if (n == plan->mynode) continue;
+    for (r = 0; r < nprocs; r++) {
+      if (rank2node[r] != n) continue;
+      for (i = 0; i < plan->nsend; i++)
+        if (plan->send_proc[i] == r) {
+          plan->aggsendidx[plan->naggsend++] = i;
+          plan->aggsendtotal += plan->send_size[i];
+        }
+    }
+  }
+
+  // off-node chunks arrive in delivery order:
+  // ascending source node, then ascending sender comm rank
+  // aggrecvidx maps that order onto my recv_* entries
+
+  plan->naggrecv = 0;
+  plan->aggrecvtotal = 0;
+  plan->aggrecvidx = (int *) malloc((plan->nrecv+1)*sizeof(int));
+  for (n = 0; n < nnodes; n++) {
+    if (n == plan->mynode) continue;
+    for (s = 0; s < nprocs; s++) {
+      if (rank2node[s] != n) continue;
+      for (i = 0; i < plan->nrecv; i++)
+        if (plan->recv_proc[i] == s) {
+          plan->aggrecvidx[plan->naggrecv++] = i;
+          plan->aggrecvtotal += plan->recv_size[i];
+        }
+    }
+  }
+
+  plan->aggsendbuf =
+    (FFT_SCALAR *) malloc((plan->aggsendtotal+1)*sizeof(FFT_SCALAR));
+  plan->aggrecvbuf =
+    (FFT_SCALAR *) malloc((plan->aggrecvtotal+1)*sizeof(FFT_SCALAR));
+
+  plan->gathercnt = plan->gatherdispl = NULL;
+  plan->scattercnt = plan->scatterdispl = NULL;
+  plan->nodesendcnt = plan->nodesenddispl = NULL;
+  plan->noderecvcnt = plan->noderecvdispl = NULL;
+  plan->segsend_from = plan->segsend_to = plan->segsend_size = NULL;
+  plan->segrecv_from = plan->segrecv_to = plan->segrecv_size = NULL;
+  plan->gatherbuf = plan->nodesendbuf = NULL;
+  plan->noderecvbuf = plan->scatterbuf = NULL;
+  plan->noderequest = NULL;
+  plan->nsegsend = plan->nsegrecv = 0;
+
+  // remaining setup is for node leaders only
+
+  if (plan->noderank == 0) {
+
+    // locrank[k] = comm rank of the proc with node rank k on my node
+
+    int *locrank = (int *) malloc(plan->nodesize*sizeof(int));
+    for (r = 0; r < nprocs; r++)
+      if (rank2node[r] == plan->mynode) locrank[noderankof[r]] = r;
+
+    plan->gathercnt = (int *) malloc(plan->nodesize*sizeof(int));
+    plan->gatherdispl = (int *) malloc(plan->nodesize*sizeof(int));
+    plan->scattercnt = (int *) malloc(plan->nodesize*sizeof(int));
+    plan->scatterdispl = (int *) malloc(plan->nodesize*sizeof(int));
+    plan->nodesendcnt = (int *) malloc(nnodes*sizeof(int));
+    plan->nodesenddispl = (int *) malloc(nnodes*sizeof(int));
+    plan->noderecvcnt = (int *) malloc(nnodes*sizeof(int));
+    plan->noderecvdispl = (int *) malloc(nnodes*sizeof(int));
+
+    // gathercnt[k] = total off-node datums proc locrank[k] contributes
+    // offmap[k*nprocs+r] = offset of its chunk for proc r within that
+    // contribution, which is packed in the same canonical order as above
+
+    int *offmap = (int *) malloc(plan->nodesize*nprocs*sizeof(int));
+
+    for (k = 0; k < plan->nodesize; k++) {
+      offset = 0;
+      for (n = 0; n < nnodes; n++) {
+        if (n == plan->mynode) continue;
+        for (r = 0; r < nprocs; r++) {
+          if (rank2node[r] != n) continue;
+          size = remap_3d_chunk(inarray,outarray,locrank[k],r,nqty);
+          if (size) {
+            offmap[k*nprocs+r] = offset;
+            offset += size;
+          }
+        }
+      }
+      plan->gathercnt[k] = offset;
+    }
+
+    plan->gatherdispl[0] = 0;
+    for (k = 1; k < plan->nodesize; k++)
+      plan->gatherdispl[k] = plan->gatherdispl[k-1] + plan->gathercnt[k-1];
+
+    // aggregate message to node n is ordered by ascending sender node
+    // rank, then ascending dest comm rank, so the receiving leader can
+    // reproduce the layout from its own chunk scan
+    // segsend routes chunks from gatherbuf into nodesendbuf
+
+    for (n = 0; n < nnodes; n++) {
+      plan->nodesendcnt[n] = 0;
+      plan->noderecvcnt[n] = 0;
+    }
+
+    plan->nsegsend = 0;
+    for (n = 0; n < nnodes; n++) {
+      if (n == plan->mynode) continue;
+      for (k = 0; k < plan->nodesize; k++)
+        for (r = 0; r < nprocs; r++) {
+          if (rank2node[r] != n) continue;
+          size = remap_3d_chunk(inarray,outarray,locrank[k],r,nqty);
+          if (size) {
+            plan->nodesendcnt[n] += size;
+            plan->nsegsend++;
+          }
+        }
+    }
+
+    plan->nodesenddispl[0] = 0;
+    for (n = 1; n < nnodes; n++)
+      plan->nodesenddispl[n] =
+        plan->nodesenddispl[n-1] + plan->nodesendcnt[n-1];
+
+    plan->segsend_from = (int *) malloc((plan->nsegsend+1)*sizeof(int));
+    plan->segsend_to = (int *) malloc((plan->nsegsend+1)*sizeof(int));
+    plan->segsend_size = (int *) malloc((plan->nsegsend+1)*sizeof(int));
+
+    plan->nsegsend = 0;
+    for (n = 0; n < nnodes; n++) {
+      if (n == plan->mynode) continue;
+      offset = plan->nodesenddispl[n];
+      for (k = 0; k < plan->nodesize; k++)
+        for (r = 0; r < nprocs; r++) {
+          if (rank2node[r] != n) continue;
+          size = remap_3d_chunk(inarray,outarray,locrank[k],r,nqty);
+          if (size) {
+            plan->segsend_from[plan->nsegsend] =
+              plan->gatherdispl[k] + offmap[k*nprocs+r];
+            plan->segsend_to[plan->nsegsend] = offset;
+            plan->segsend_size[plan->nsegsend] = size;
+            offset += size;
+            plan->nsegsend++;
+          }
+        }
+    }
+
+    // noderecvcnt[n] = total datums node n ships to procs on my node
+    // scattercnt[k] = total off-node datums destined for proc locrank[k]
+
+    for (n = 0; n < nnodes; n++) {
+      if (n == plan->mynode) continue;
+      for (s = 0; s < nprocs; s++) {
+        if (rank2node[s] != n) continue;
+        for (k = 0; k < plan->nodesize; k++)
+          plan->noderecvcnt[n] +=
+            remap_3d_chunk(inarray,outarray,s,locrank[k],nqty);
+      }
+    }
+
+    plan->noderecvdispl[0] = 0;
+    for (n = 1; n < nnodes; n++)
+      plan->noderecvdispl[n] =
+        plan->noderecvdispl[n-1] + plan->noderecvcnt[n-1];
+
+    for (k = 0; k < plan->nodesize; k++) {
+      plan->scattercnt[k] = 0;
+      for (s = 0; s < nprocs; s++)
+        if (rank2node[s] != plan->mynode)
+          plan->scattercnt[k] +=
+            remap_3d_chunk(inarray,outarray,s,locrank[k],nqty);
+    }
+
+    plan->scatterdispl[0] = 0;
+    for (k = 1; k < plan->nodesize; k++)
+      plan->scatterdispl[k] =
+        plan->scatterdispl[k-1] + plan->scattercnt[k-1];
+
+    // segrecv routes chunks from noderecvbuf into scatterbuf,
+    // depositing each proc's chunks in its delivery order
+
+    plan->nsegrecv = 0;
+    for (n = 0; n < nnodes; n++) {
+      if (n == plan->mynode) continue;
+      for (s = 0; s < nprocs; s++) {
+        if (rank2node[s] != n) continue;
+        for (k = 0; k < plan->nodesize; k++)
+          if (remap_3d_chunk(inarray,outarray,s,locrank[k],nqty))
+            plan->nsegrecv++;
+      }
+    }
+
+    plan->segrecv_from = (int *) malloc((plan->nsegrecv+1)*sizeof(int));
+    plan->segrecv_to = (int *) malloc((plan->nsegrecv+1)*sizeof(int));
+    plan->segrecv_size = (int *) malloc((plan->nsegrecv+1)*sizeof(int));
+
+    int *cur = (int *) malloc(plan->nodesize*sizeof(int));
+    for (k = 0; k < plan->nodesize; k++) cur[k] = plan->scatterdispl[k];
+
+    plan->nsegrecv = 0;
+    for (n = 0; n < nnodes; n++) {
+      if (n == plan->mynode) continue;
+      offset = plan->noderecvdispl[n];
+      for (s = 0; s < nprocs; s++) {
+        if (rank2node[s] != n) continue;
+        for (k = 0; k < plan->nodesize; k++) {
+          size = remap_3d_chunk(inarray,outarray,s,locrank[k],nqty);
+          if (size) {
+            plan->segrecv_from[plan->nsegrecv] = offset;
+            plan->segrecv_to[plan->nsegrecv] = cur[k];
+            plan->segrecv_size[plan->nsegrecv] = size;
+            offset += size;
+            cur[k] += size;
+            plan->nsegrecv++;
+          }
+        }
+      }
+    }
+
+    total = 0;
+    for (k = 0; k < plan->nodesize; k++) total += plan->gathercnt[k];
+    plan->gatherbuf = (FFT_SCALAR *) malloc((total+1)*sizeof(FFT_SCALAR));
+    total = 0;
+    for (n = 0; n < nnodes; n++) total += plan->nodesendcnt[n];
+    plan->nodesendbuf = (FFT_SCALAR *) malloc((total+1)*sizeof(FFT_SCALAR));
+    total = 0;
+    for (n = 0; n < nnodes; n++) total += plan->noderecvcnt[n];
+    plan->noderecvbuf = (FFT_SCALAR *) malloc((total+1)*sizeof(FFT_SCALAR));
+    total = 0;
+    for (k = 0; k < plan->nodesize; k++) total += plan->scattercnt[k];
+    plan->scatterbuf = (FFT_SCALAR *) malloc((total+1)*sizeof(FFT_SCALAR));
+
+    plan->noderequest = (MPI_Request *) malloc(nnodes*sizeof(MPI_Request));
+
+    free(locrank);
+    free(offmap);
+    free(cur);
+  }
+
+  free(leaderof);
+  free(noderankof);
+  free(rank2node);
+
+  plan->usenodeaggregate = 1;
+}
@@ -48,6 +48,44 @@ struct remap_plan_3d {
   int usecollective;                // use collective or point-to-point MPI
   int commringlen;                  // length of commringlist
   int *commringlist;                // ranks on communication ring of this plan
+
+  // split exchange via remap_3d_start/finish
+
+  int inflight;                     // 1 if a started exchange awaits finish
+  FFT_SCALAR *inflight_scratch;     // scratch in use by the started exchange
+
+  // two-level node-aggregated exchange
+  // off-node chunks are gathered to the node leader, leaders exchange
+  // one aggregate message per node pair, then chunks are scattered
+  // to their destination procs; on-node chunks stay point-to-point
+
+  int usenodeaggregate;             // 1 if two-level exchange is active
+  MPI_Comm nodecomm;                // procs of comm on my physical node
+  int noderank,nodesize;            // my rank in nodecomm and its size
+  int nnodes,mynode;                // # of nodes and index of my node
+  int *nodeleader;                  // comm rank of each node's leader
+  int *send_isinter;                // 1 if send entry goes off-node
+  int *recv_isinter;                // 1 if recv entry comes from off-node
+  int naggsend;                     // my off-node sends, canonical order
+  int *aggsendidx;                  //   indices into send_* arrays
+  int naggrecv;                     // my off-node recvs, delivery order
+  int *aggrecvidx;                  //   indices into recv_* arrays
+  int aggsendtotal,aggrecvtotal;    // total datums shipped to/from leader
+  FFT_SCALAR *aggsendbuf;           // my packed off-node chunks
+  FFT_SCALAR *aggrecvbuf;           // off-node chunks delivered to me
+  int *gathercnt,*gatherdispl;      // leader: gatherv over nodecomm
+  int *scattercnt,*scatterdispl;    // leader: scatterv over nodecomm
+  int *nodesendcnt,*nodesenddispl;  // leader: aggregate sizes per node
+  int *noderecvcnt,*noderecvdispl;
+  int nsegsend;                     // leader: chunk routing gather -> node
+  int *segsend_from,*segsend_to,*segsend_size;
+  int nsegrecv;                     // leader: chunk routing node -> scatter
+  int *segrecv_from,*segrecv_to,*segrecv_size;
+  FFT_SCALAR *gatherbuf;            // leader: chunks from my node's procs
+  FFT_SCALAR *nodesendbuf;          // leader: reordered per destination node
+  FFT_SCALAR *noderecvbuf;          // leader: aggregates from other nodes
+  FFT_SCALAR *scatterbuf;           // leader: reordered per destination proc
+  MPI_Request *noderequest;         // leader: requests for aggregate recvs
 };
 
 // collision between 2 regions
@@ -61,6 +99,9 @@ struct extent_3d {
 // function prototypes
 
 void remap_3d(FFT_SCALAR *, FFT_SCALAR *, FFT_SCALAR *, struct remap_plan_3d *);
+void remap_3d_start(FFT_SCALAR *, FFT_SCALAR *, FFT_SCALAR *,
+                    struct remap_plan_3d *);
+void remap_3d_finish(FFT_SCALAR *, struct remap_plan_3d *);
 struct remap_plan_3d *remap_3d_create_plan(MPI_Comm,
                                            int, int, int, int, int, int,
                                            int, int, int, int, int, int,
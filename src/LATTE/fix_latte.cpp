@@ -16,6 +16,7 @@
 ------------------------------------------------------------------------- */
 
 #include "fix_latte.h"
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include "atom.h"
@@ -65,14 +66,40 @@ FixLatte::FixLatte(LAMMPS *lmp, int narg, char **arg) :
   if (LATTE_ABIVERSION != latte_abiversion())
     error->all(FLERR,"LAMMPS is linked against incompatible LATTE library");
 
-  if (narg != 4) error->all(FLERR,"Illegal fix latte command");
+  if (narg < 4) error->all(FLERR,"Illegal fix latte command");
 
   scalar_flag = 1;
   global_freq = 1;
   extscalar = 1;
+  vector_flag = 1;
+  size_vector = 2;
+  extvector = 0;
   virial_flag = 1;
   thermo_virial = 1;
 
+  // optional keywords
+  // every N = invoke LATTE only every N steps, extrapolate in between
+  // check X = warn if extrapolated forces drifted more than X from
+  //           the next quantum evaluation (force units, 0.0 = no check)
+
+  nevery = 1;
+  drift_tol = 0.0;
+
+  int iarg = 4;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"every") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix latte command");
+      nevery = force->inumeric(FLERR,arg[iarg+1]);
+      if (nevery <= 0) error->all(FLERR,"Illegal fix latte command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"check") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix latte command");
+      drift_tol = force->numeric(FLERR,arg[iarg+1]);
+      if (drift_tol < 0.0) error->all(FLERR,"Illegal fix latte command");
+      iarg += 2;
+    } else error->all(FLERR,"Illegal fix latte command");
+  }
+
   // store ID of compute pe/atom used to generate Coulomb potential for LATTE
   // NULL means LATTE will compute Coulombic potential
 
@@ -100,6 +127,11 @@ FixLatte::FixLatte(LAMMPS *lmp, int narg, char **arg) :
   qpotential = NULL;
   flatte = NULL;
 
+  flast = fprev = NULL;
+  last_eval = prev_eval = -1;
+  for (int i = 0; i < 6; i++) virial_last[i] = 0.0;
+  drift_max = drift_rms = 0.0;
+
   latte_energy = 0.0;
 }
 
@@ -110,6 +142,8 @@ FixLatte::~FixLatte()
   delete [] id_pe;
   memory->destroy(qpotential);
   memory->destroy(flatte);
+  memory->destroy(flast);
+  memory->destroy(fprev);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -159,6 +193,15 @@ void FixLatte::init()
     memory->create(flatte,atom->nlocal,3,"latte:flatte");
   }
 
+  // multi-rate mode needs a private force buffer for the LATTE output
+  // plus the last two quantum force snapshots for extrapolation
+
+  if (nevery > 1 && flast == NULL) {
+    if (flatte == NULL) memory->create(flatte,atom->nlocal,3,"latte:flatte");
+    memory->create(flast,atom->nlocal,3,"latte:flast");
+    memory->create(fprev,atom->nlocal,3,"latte:fprev");
+  }
+
   /*
   // warn if any integrate fix comes after this one
   // is it actually necessary for q(n) update to come after x,v update ??
@@ -241,6 +284,31 @@ void FixLatte::post_force(int vflag)
   int eflag = eflag_caller;
   ev_init(eflag,vflag);
 
+  // multi-rate mode: on intermediate MD steps apply quantum forces
+  // linearly extrapolated from the last two LATTE evaluations and
+  // reuse the last quantum energy and virial, skipping the solve
+  // only during dynamics: minimization line searches need
+  // self-consistent forces on every call
+
+  if (nevery > 1 && !newsystem && update->whichflag == 1 &&
+      last_eval >= 0 && (update->ntimestep % nevery)) {
+    double **f = atom->f;
+    int nlocal = atom->nlocal;
+
+    double xi = 0.0;
+    if (prev_eval >= 0 && last_eval > prev_eval)
+      xi = ((double) (update->ntimestep - last_eval)) /
+        ((double) (last_eval - prev_eval));
+
+    for (int i = 0; i < nlocal; i++) {
+      f[i][0] += flast[i][0] + xi*(flast[i][0] - fprev[i][0]);
+      f[i][1] += flast[i][1] + xi*(flast[i][1] - fprev[i][1]);
+      f[i][2] += flast[i][2] + xi*(flast[i][2] - fprev[i][2]);
+    }
+    for (int i = 0; i < 6; i++) virial[i] = virial_last[i];
+    return;
+  }
+
   // compute Coulombic potential = pe[i]/q[i]
   // invoke compute pe/atom
   // wrap with clear/add and trigger pe/atom calculation every step
@@ -295,7 +363,7 @@ void FixLatte::post_force(int vflag)
   double *boxhi = domain->boxhi;
   double *forces;
   bool latteerror = 0;
-  if (coulomb) forces = &flatte[0][0];
+  if (coulomb || nevery > 1) forces = &flatte[0][0];
   else forces = &atom->f[0][0];
   int maxiter = -1;
 
@@ -305,10 +373,51 @@ void FixLatte::post_force(int vflag)
 
   if (latteerror) error->all(FLERR,"Internal LATTE problem");
 
+  // multi-rate bookkeeping: measure how far the extrapolated forces
+  // drifted from the fresh quantum forces, then rotate the snapshots
+
+  if (nevery > 1) {
+    int nlocal = atom->nlocal;
+
+    if (last_eval >= 0 && update->ntimestep > last_eval) {
+      double xi = 0.0;
+      if (prev_eval >= 0 && last_eval > prev_eval)
+        xi = ((double) (update->ntimestep - last_eval)) /
+          ((double) (last_eval - prev_eval));
+
+      drift_max = 0.0;
+      drift_rms = 0.0;
+      for (int i = 0; i < nlocal; i++)
+        for (int j = 0; j < 3; j++) {
+          double df = flatte[i][j] -
+            (flast[i][j] + xi*(flast[i][j] - fprev[i][j]));
+          drift_max = MAX(drift_max,fabs(df));
+          drift_rms += df*df;
+        }
+      if (nlocal) drift_rms = sqrt(drift_rms/(3.0*nlocal));
+
+      if (drift_tol > 0.0 && drift_max > drift_tol)
+        error->warning(FLERR,"Fix latte extrapolated force drift "
+                       "exceeds check threshold");
+    }
+
+    for (int i = 0; i < nlocal; i++) {
+      fprev[i][0] = flast[i][0];
+      fprev[i][1] = flast[i][1];
+      fprev[i][2] = flast[i][2];
+      flast[i][0] = flatte[i][0];
+      flast[i][1] = flatte[i][1];
+      flast[i][2] = flatte[i][2];
+    }
+    prev_eval = last_eval;
+    last_eval = update->ntimestep;
+    for (int i = 0; i < 6; i++) virial_last[i] = virial[i];
+  }
+
   // sum LATTE forces to LAMMPS forces
   // e.g. LAMMPS may compute Coulombics at some point
 
-  if (coulomb) {
+  if (coulomb || nevery > 1) {
     double **f = atom->f;
     int nlocal = atom->nlocal;
     for (int i = 0; i < nlocal; i++) {
@@ -349,6 +458,17 @@ double FixLatte::compute_scalar()
   return latte_energy;
 }
 
+/* ----------------------------------------------------------------------
+   max and RMS drift of the extrapolated quantum forces, measured
+   against the most recent LATTE evaluation (zero if nevery = 1)
+------------------------------------------------------------------------- */
+
+double FixLatte::compute_vector(int n)
+{
+  if (n == 0) return drift_max;
+  return drift_rms;
+}
+
 /* ----------------------------------------------------------------------
    memory usage of local arrays
 ------------------------------------------------------------------------- */
@@ -358,5 +478,6 @@ double FixLatte::memory_usage()
   double bytes = 0.0;
   if (coulomb) bytes += nmax * sizeof(double);
   if (coulomb) bytes += nmax*3 * sizeof(double);
+  if (nevery > 1) bytes += 3*atom->nlocal*3 * sizeof(double);
   return bytes;
 }
@@ -41,6 +41,7 @@ class FixLatte : public Fix {
   void final_integrate();
   void reset_dt();
   double compute_scalar();
+  double compute_vector(int);
   double memory_usage();
 
  protected:
@@ -53,6 +54,15 @@ class FixLatte : public Fix {
   double **flatte;
   double latte_energy;
 
+  // multi-rate coupling: LATTE invoked every nevery steps,
+  // intermediate steps use linearly extrapolated quantum forces
+
+  double **flast,**fprev;      // quantum forces of last two evaluations
+  bigint last_eval,prev_eval;  // timesteps of last two evaluations
+  double virial_last[6];       // quantum virial of last evaluation
+  double drift_tol;            // warn threshold for extrapolation drift
+  double drift_max,drift_rms;  // force drift measured at last evaluation
+
   class NeighList *list;
   class Compute *c_pe;
 };
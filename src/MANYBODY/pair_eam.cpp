@@ -49,6 +49,7 @@ PairEAM::PairEAM(LAMMPS *lmp) : Pair(lmp)
   rho = NULL;
   fp = NULL;
   numforce = NULL;
+  deferlist = NULL;
   map = NULL;
   type2frho = NULL;
 
@@ -84,6 +85,7 @@ PairEAM::~PairEAM()
   memory->destroy(rho);
   memory->destroy(fp);
   memory->destroy(numforce);
+  memory->destroy(deferlist);
 
   if (allocated) {
     memory->destroy(setflag);
@@ -144,12 +146,11 @@ PairEAM::~PairEAM()
 void PairEAM::compute(int eflag, int vflag)
 {
   int i,j,ii,jj,m,inum,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
-  double rsq,r,p,rhoip,rhojp,z2,z2p,recip,phip,psip,phi;
+  double xtmp,ytmp,ztmp,delx,dely,delz;
+  double rsq,p,phi;
   double *coeff;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
-  evdwl = 0.0;
   ev_init(eflag,vflag);
 
   // grow energy and fp arrays if necessary
@@ -159,14 +160,15 @@ void PairEAM::compute(int eflag, int vflag)
     memory->destroy(rho);
     memory->destroy(fp);
     memory->destroy(numforce);
+    memory->destroy(deferlist);
     nmax = atom->nmax;
     memory->create(rho,nmax,"pair:rho");
     memory->create(fp,nmax,"pair:fp");
     memory->create(numforce,nmax,"pair:numforce");
+    memory->create(deferlist,nmax,"pair:deferlist");
   }
 
   double **x = atom->x;
-  double **f = atom->f;
   int *type = atom->type;
   int nlocal = atom->nlocal;
   int nall = nlocal + atom->nghost;
@@ -249,85 +251,132 @@ void PairEAM::compute(int eflag, int vflag)
   }
 
   // communicate derivative of embedding function
+  // post the final swap and compute forces on atoms with no pending
+  // ghost neighbors while it is in flight
 
-  comm->forward_comm_pair(this);
+  int ghostready = comm->forward_comm_pair_start(this);
   embedstep = update->ntimestep;
 
   // compute forces on each atom
   // loop over neighbors of my atoms
+  // defer atoms with a neighbor whose fp has not yet arrived
+
+  int ndefer = 0;
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
 
-    jlist = firstneigh[i];
-    jnum = numneigh[i];
-    numforce[i] = 0;
+    if (ghostready < nall) {
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+      for (jj = 0; jj < jnum; jj++)
+        if ((jlist[jj] & NEIGHMASK) >= ghostready) break;
+      if (jj < jnum) {
+        deferlist[ndefer++] = i;
+        continue;
+      }
+    }
 
-    for (jj = 0; jj < jnum; jj++) {
-      j = jlist[jj];
-      j &= NEIGHMASK;
+    compute_force_atom(i,eflag,nlocal,newton_pair);
+  }
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
+  // complete the exchange, then do the deferred atoms
 
-      if (rsq < cutforcesq) {
-        ++numforce[i];
-        jtype = type[j];
-        r = sqrt(rsq);
-        p = r*rdr + 1.0;
-        m = static_cast<int> (p);
-        m = MIN(m,nr-1);
-        p -= m;
-        p = MIN(p,1.0);
+  comm->forward_comm_pair_finish(this);
 
-        // rhoip = derivative of (density at atom j due to atom i)
-        // rhojp = derivative of (density at atom i due to atom j)
-        // phi = pair potential energy
-        // phip = phi'
-        // z2 = phi * r
-        // z2p = (phi * r)' = (phi' r) + phi
-        // psip needs both fp[i] and fp[j] terms since r_ij appears in two
-        //   terms of embed eng: Fi(sum rho_ij) and Fj(sum rho_ji)
-        //   hence embed' = Fi(sum rho_ij) rhojp + Fj(sum rho_ji) rhoip
-        // scale factor can be applied by thermodynamic integration
-
-        coeff = rhor_spline[type2rhor[itype][jtype]][m];
-        rhoip = (coeff[0]*p + coeff[1])*p + coeff[2];
-        coeff = rhor_spline[type2rhor[jtype][itype]][m];
-        rhojp = (coeff[0]*p + coeff[1])*p + coeff[2];
-        coeff = z2r_spline[type2z2r[itype][jtype]][m];
-        z2p = (coeff[0]*p + coeff[1])*p + coeff[2];
-        z2 = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
-
-        recip = 1.0/r;
-        phi = z2*recip;
-        phip = z2p*recip - phi*recip;
-        psip = fp[i]*rhojp + fp[j]*rhoip + phip;
-        fpair = -scale[itype][jtype]*psip*recip;
-
-        f[i][0] += delx*fpair;
-        f[i][1] += dely*fpair;
-        f[i][2] += delz*fpair;
-        if (newton_pair || j < nlocal) {
-          f[j][0] -= delx*fpair;
-          f[j][1] -= dely*fpair;
-          f[j][2] -= delz*fpair;
-        }
+  for (ii = 0; ii < ndefer; ii++)
+    compute_force_atom(deferlist[ii],eflag,nlocal,newton_pair);
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+/* ----------------------------------------------------------------------
+   force contributions of all pairs of owned atom i
+   fp of atom i and of all its neighbors must be current
+------------------------------------------------------------------------- */
+
+void PairEAM::compute_force_atom(int i, int eflag, int nlocal,
+                                 int newton_pair)
+{
+  int j,jj,jnum,itype,jtype,m;
+  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
+  double rsq,r,p,rhoip,rhojp,z2,z2p,recip,phip,psip,phi;
+  double *coeff;
+  int *jlist;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
 
-        if (eflag) evdwl = scale[itype][jtype]*phi;
-        if (evflag) ev_tally(i,j,nlocal,newton_pair,
-                             evdwl,0.0,fpair,delx,dely,delz);
+  evdwl = 0.0;
+
+  xtmp = x[i][0];
+  ytmp = x[i][1];
+  ztmp = x[i][2];
+  itype = type[i];
+
+  jlist = list->firstneigh[i];
+  jnum = list->numneigh[i];
+  numforce[i] = 0;
+
+  for (jj = 0; jj < jnum; jj++) {
+    j = jlist[jj];
+    j &= NEIGHMASK;
+
+    delx = xtmp - x[j][0];
+    dely = ytmp - x[j][1];
+    delz = ztmp - x[j][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+
+    if (rsq < cutforcesq) {
+      ++numforce[i];
+      jtype = type[j];
+      r = sqrt(rsq);
+      p = r*rdr + 1.0;
+      m = static_cast<int> (p);
+      m = MIN(m,nr-1);
+      p -= m;
+      p = MIN(p,1.0);
+
+      // rhoip = derivative of (density at atom j due to atom i)
+      // rhojp = derivative of (density at atom i due to atom j)
+      // phi = pair potential energy
+      // phip = phi'
+      // z2 = phi * r
+      // z2p = (phi * r)' = (phi' r) + phi
+      // psip needs both fp[i] and fp[j] terms since r_ij appears in two
+      //   terms of embed eng: Fi(sum rho_ij) and Fj(sum rho_ji)
+      //   hence embed' = Fi(sum rho_ij) rhojp + Fj(sum rho_ji) rhoip
+      // scale factor can be applied by thermodynamic integration
+
+      coeff = rhor_spline[type2rhor[itype][jtype]][m];
+      rhoip = (coeff[0]*p + coeff[1])*p + coeff[2];
+      coeff = rhor_spline[type2rhor[jtype][itype]][m];
+      rhojp = (coeff[0]*p + coeff[1])*p + coeff[2];
+      coeff = z2r_spline[type2z2r[itype][jtype]][m];
+      z2p = (coeff[0]*p + coeff[1])*p + coeff[2];
+      z2 = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
+
+      recip = 1.0/r;
+      phi = z2*recip;
+      phip = z2p*recip - phi*recip;
+      psip = fp[i]*rhojp + fp[j]*rhoip + phip;
+      fpair = -scale[itype][jtype]*psip*recip;
+
+      f[i][0] += delx*fpair;
+      f[i][1] += dely*fpair;
+      f[i][2] += delz*fpair;
+      if (newton_pair || j < nlocal) {
+        f[j][0] -= delx*fpair;
+        f[j][1] -= dely*fpair;
+        f[j][2] -= delz*fpair;
       }
+
+      if (eflag) evdwl = scale[itype][jtype]*phi;
+      if (evflag) ev_tally(i,j,nlocal,newton_pair,
+                           evdwl,0.0,fpair,delx,dely,delz);
     }
   }
-
-  if (vflag_fdotr) virial_fdotr_compute();
 }
 
 /* ----------------------------------------------------------------------
@@ -754,9 +803,13 @@ void PairEAM::array2spline()
   memory->destroy(rhor_spline);
   memory->destroy(z2r_spline);
 
-  memory->create(frho_spline,nfrho,nrho+1,7,"pair:frho");
-  memory->create(rhor_spline,nrhor,nr+1,7,"pair:rhor");
-  memory->create(z2r_spline,nz2r,nr+1,7,"pair:z2r");
+  // 7 spline coefficients per point, padded to 8 so each row is
+  // exactly one cache line (aligned when built with LAMMPS_MEMALIGN=64)
+  // instead of straddling two lines on most lookups
+
+  memory->create(frho_spline,nfrho,nrho+1,8,"pair:frho");
+  memory->create(rhor_spline,nrhor,nr+1,8,"pair:rhor");
+  memory->create(z2r_spline,nz2r,nr+1,8,"pair:z2r");
 
   for (int i = 0; i < nfrho; i++)
     interpolate(nrho,drho,frho[i],frho_spline[i]);
@@ -797,6 +850,7 @@ void PairEAM::interpolate(int n, double delta, double *f, double **spline)
     spline[m][2] = spline[m][5]/delta;
     spline[m][1] = 2.0*spline[m][4]/delta;
     spline[m][0] = 3.0*spline[m][3]/delta;
+    spline[m][7] = 0.0;
   }
 }
 
@@ -914,6 +968,7 @@ double PairEAM::memory_usage()
   double bytes = maxeatom * sizeof(double);
   bytes += maxvatom*6 * sizeof(double);
   bytes += 2 * nmax * sizeof(double);
+  bytes += 2 * nmax * sizeof(int);
   return bytes;
 }
 
@@ -72,6 +72,7 @@ class PairEAM : public Pair {
 
   double *rho,*fp;
   int *numforce;
+  int *deferlist;             // atoms deferred until ghost fp arrives
 
   // potentials as file data
 
@@ -104,6 +105,7 @@ class PairEAM : public Pair {
   };
   Fs *fs;
 
+  void compute_force_atom(int, int, int, int);
   virtual void allocate();
   virtual void array2spline();
   void interpolate(int, double, double *, double **);
@@ -42,6 +42,8 @@
 #include "memory.h"
 #include "error.h"
 #include "neighbor.h"
+#include "neigh_list.h"
+#include "neigh_request.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -127,9 +129,11 @@ void FixAtomSwap::options(int narg, char **arg)
   regionflag = 0;
   conserve_ke_flag = 1;
   semi_grand_flag = 0;
+  batch_flag = 0;
   nswaptypes = 0;
   nmutypes = 0;
   iregion = -1;
+  list = NULL;
 
   int iarg = 0;
   while (iarg < narg) {
@@ -155,6 +159,12 @@ void FixAtomSwap::options(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"yes") == 0) semi_grand_flag = 1;
       else error->all(FLERR,"Illegal fix atom/swap command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"batch") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix atom/swap command");
+      if (strcmp(arg[iarg+1],"no") == 0) batch_flag = 0;
+      else if (strcmp(arg[iarg+1],"yes") == 0) batch_flag = 1;
+      else error->all(FLERR,"Illegal fix atom/swap command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"types") == 0) {
       if (iarg+3 > narg) error->all(FLERR,"Illegal fix atom/swap command");
       iarg++;
@@ -274,6 +284,30 @@ void FixAtomSwap::init()
         if (cutsq[type_list[iswaptype]][ktype] != cutsq[type_list[jswaptype]][ktype])
           unequal_cutoffs = true;
 
+  // batch mode computes local energy deltas via pair->single() on a
+  // full occasional neighbor list, so reneighboring between swaps
+  // (unequal cutoffs) and styles without single() are not supported
+
+  if (batch_flag) {
+    if (!semi_grand_flag)
+      error->all(FLERR,"Fix atom/swap batch requires semi-grand yes");
+    if (unequal_cutoffs)
+      error->all(FLERR,"Fix atom/swap batch requires equal cutoffs "
+                 "for all swapped types");
+    if (force->pair->single_enable == 0)
+      error->all(FLERR,"Fix atom/swap batch requires a pair style "
+                 "that supports single calls");
+    if (domain->triclinic)
+      error->all(FLERR,"Fix atom/swap batch requires an orthogonal box");
+
+    int irequest = neighbor->request(this,instance_me);
+    neighbor->requests[irequest]->pair = 0;
+    neighbor->requests[irequest]->fix = 1;
+    neighbor->requests[irequest]->half = 0;
+    neighbor->requests[irequest]->full = 1;
+    neighbor->requests[irequest]->occasional = 1;
+  }
+
   // check that no swappable atoms are in atom->firstgroup
   // swapping such an atom might not leave firstgroup atoms first
 
@@ -316,19 +350,156 @@ void FixAtomSwap::pre_exchange()
   int nsuccess = 0;
   if (semi_grand_flag) {
     update_semi_grand_atoms_list();
-    for (int i = 0; i < ncycles; i++) nsuccess += attempt_semi_grand();
+    if (batch_flag) nsuccess = attempt_semi_grand_batch(ncycles);
+    else {
+      for (int i = 0; i < ncycles; i++) nsuccess += attempt_semi_grand();
+      nswap_attempts += ncycles;
+    }
   } else {
     update_swap_atoms_list();
     for (int i = 0; i < ncycles; i++) nsuccess += attempt_swap();
+    nswap_attempts += ncycles;
   }
 
-  nswap_attempts += ncycles;
   nswap_successes += nsuccess;
 
   energy_full();
   next_reneighbor = update->ntimestep + nevery;
 }
 
+/* ---------------------------------------------------------------------- */
+
+void FixAtomSwap::init_list(int /*id*/, NeighList *ptr)
+{
+  list = ptr;
+}
+
+/* ----------------------------------------------------------------------
+   propose many spatially-disjoint semi-grand swaps at once
+   local energy deltas are evaluated independently on each proc via
+   pair->single() and the batch is settled with a single collective
+   candidates are restricted to atoms further than the neighbor cutoff
+   from the subdomain boundary so batches on different procs can never
+   interact; skipped boundary atoms become eligible as atoms migrate
+   Note: atom charges are assumed equal and so are not updated
+------------------------------------------------------------------------- */
+
+int FixAtomSwap::attempt_semi_grand_batch(int nattempt)
+{
+  if (nswap == 0) return 0;
+
+  double **x = atom->x;
+  int *type = atom->type;
+  int nall = atom->nlocal + atom->nghost;
+
+  neighbor->build_one(list,1);
+
+  int *selected;
+  memory->create(selected,nall,"atom/swap:selected");
+  for (int i = 0; i < nall; i++) selected[i] = 0;
+
+  double margin = neighbor->cutneighmax;
+  double lo[3],hi[3];
+  for (int d = 0; d < 3; d++) {
+    lo[d] = domain->sublo[d] + margin;
+    hi[d] = domain->subhi[d] - margin;
+  }
+
+  Pair *pair = force->pair;
+  double **cutsq = force->pair->cutsq;
+  double cutsq_max = force->pair->cutforce*force->pair->cutforce;
+
+  // proportional share of the global attempt count, randomized rounding
+
+  double share = nattempt*((double) nswap_local)/nswap;
+  int ntry = static_cast<int>(share);
+  if (random_unequal->uniform() < share - ntry) ntry++;
+
+  double nselected = 0.0;
+  double nsuccess = 0.0;
+  double de_total = 0.0;
+  double fpair = 0.0;
+
+  for (int itry = 0; itry < ntry; itry++) {
+    int iwhich = static_cast<int>(nswap_local*random_unequal->uniform());
+    if (iwhich >= nswap_local) continue;
+    int i = local_swap_atom_list[iwhich];
+    if (selected[i]) continue;
+    if (x[i][0] < lo[0] || x[i][0] > hi[0] ||
+        x[i][1] < lo[1] || x[i][1] > hi[1] ||
+        x[i][2] < lo[2] || x[i][2] > hi[2]) continue;
+
+    int itype = type[i];
+    int jswaptype = static_cast<int>(nswaptypes*random_unequal->uniform());
+    int jtype = type_list[jswaptype];
+    while (itype == jtype) {
+      jswaptype = static_cast<int>(nswaptypes*random_unequal->uniform());
+      jtype = type_list[jswaptype];
+    }
+
+    // local energy delta of retyping atom i
+    // candidate conflicts with an earlier pick in force range: skip it,
+    //   its delta would depend on whether that pick gets accepted
+
+    int *jlist = list->firstneigh[i];
+    int jnum = list->numneigh[i];
+    int conflict = 0;
+    double de = 0.0;
+
+    for (int jj = 0; jj < jnum; jj++) {
+      int j = jlist[jj] & NEIGHMASK;
+      double delx = x[i][0] - x[j][0];
+      double dely = x[i][1] - x[j][1];
+      double delz = x[i][2] - x[j][2];
+      double rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq >= cutsq_max) continue;
+      if (selected[j]) {
+        conflict = 1;
+        break;
+      }
+      int jt = type[j];
+      if (rsq < cutsq[itype][jt])
+        de -= pair->single(i,j,itype,jt,rsq,1.0,1.0,fpair);
+      if (rsq < cutsq[jtype][jt])
+        de += pair->single(i,j,jtype,jt,rsq,1.0,1.0,fpair);
+    }
+    if (conflict) continue;
+
+    selected[i] = 1;
+    nselected += 1.0;
+
+    if (random_unequal->uniform() <
+        exp(beta*(-de + mu[jtype] - mu[itype]))) {
+      type[i] = jtype;
+      de_total += de;
+      nsuccess += 1.0;
+      if (conserve_ke_flag) {
+        atom->v[i][0] *= sqrt_mass_ratio[itype][jtype];
+        atom->v[i][1] *= sqrt_mass_ratio[itype][jtype];
+        atom->v[i][2] *= sqrt_mass_ratio[itype][jtype];
+      }
+    }
+  }
+
+  memory->destroy(selected);
+
+  // settle the whole batch with a single collective
+
+  double local[3],global[3];
+  local[0] = nselected;
+  local[1] = nsuccess;
+  local[2] = de_total;
+  MPI_Allreduce(local,global,3,MPI_DOUBLE,MPI_SUM,world);
+
+  comm->forward_comm_fix(this);
+
+  nswap_attempts += global[0];
+  energy_stored += global[2];
+  if (global[1] != 0.0) update_semi_grand_atoms_list();
+
+  return static_cast<int>(global[1]);
+}
+
 /* ----------------------------------------------------------------------
 Note: atom charges are assumed equal and so are not updated
 ------------------------------------------------------------------------- */
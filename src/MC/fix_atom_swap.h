@@ -30,8 +30,10 @@ class FixAtomSwap : public Fix {
   ~FixAtomSwap();
   int setmask();
   void init();
+  void init_list(int, class NeighList *);
   void pre_exchange();
   int attempt_semi_grand();
+  int attempt_semi_grand_batch(int);
   int attempt_swap();
   double energy_full();
   int pick_semi_grand_atom();
@@ -50,6 +52,7 @@ class FixAtomSwap : public Fix {
   int nevery,seed;
   int conserve_ke_flag;                   // yes = conserve ke, no = do not conserve ke
   int semi_grand_flag;                    // yes = semi-grand canonical, no = constant composition
+  int batch_flag;                         // yes = batched spatially-disjoint semi-grand swaps
   int ncycles;
   int niswap,njswap;                      // # of i,j swap atoms on all procs
   int niswap_local,njswap_local;          // # of swap atoms on this proc
@@ -82,6 +85,8 @@ class FixAtomSwap : public Fix {
   class RanPark *random_equal;
   class RanPark *random_unequal;
 
+  class NeighList *list;                  // full occasional list for batch mode
+
   class Compute *c_pe;
 
   void options(int, char **);
@@ -220,6 +220,11 @@ FixGCMC::FixGCMC(LAMMPS *lmp, int narg, char **arg) :
 
   gcmc_nmax = 0;
   local_gas_list = NULL;
+
+  bins_valid = 0;
+  nbinx = nbiny = nbinz = nbins = 0;
+  maxbin = maxbinatom = 0;
+  binhead = binnext = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -410,6 +415,8 @@ FixGCMC::~FixGCMC()
   delete random_unequal;
 
   memory->destroy(local_gas_list);
+  memory->destroy(binhead);
+  memory->destroy(binnext);
   memory->destroy(molcoords);
   memory->destroy(molq);
   memory->destroy(molimage);
@@ -2189,8 +2196,75 @@ void FixGCMC::attempt_molecule_insertion_full()
   update_gas_atoms_list();
 }
 
+/* ----------------------------------------------------------------------
+   bin all owned+ghost atoms into a uniform grid spanning their extent
+   the neighbor class bins cannot be reused mid-MC since trial
+   insertions/deletions change the atom set without a list rebuild
+------------------------------------------------------------------------- */
+
+void FixGCMC::bins_build()
+{
+  double **x = atom->x;
+  int nall = atom->nlocal + atom->nghost;
+
+  if (nall == 0) {
+    nbins = 0;
+    bins_valid = 1;
+    return;
+  }
+
+  // bin edge must be >= max force cutoff and overlap cutoff
+
+  double cut = MAX(force->pair->cutforce,sqrt(overlap_cutoffsq));
+
+  double binhi[3];
+  binlo[0] = binhi[0] = x[0][0];
+  binlo[1] = binhi[1] = x[0][1];
+  binlo[2] = binhi[2] = x[0][2];
+  for (int j = 1; j < nall; j++)
+    for (int d = 0; d < 3; d++) {
+      binlo[d] = MIN(binlo[d],x[j][d]);
+      binhi[d] = MAX(binhi[d],x[j][d]);
+    }
+
+  int nbin[3];
+  for (int d = 0; d < 3; d++) {
+    double extent = binhi[d] - binlo[d];
+    nbin[d] = MAX(1,static_cast<int>(extent/cut));
+    if (extent > 0.0) bininv[d] = nbin[d]/extent;
+    else bininv[d] = 0.0;
+  }
+  nbinx = nbin[0];
+  nbiny = nbin[1];
+  nbinz = nbin[2];
+  nbins = nbinx*nbiny*nbinz;
+
+  if (nbins > maxbin) {
+    maxbin = nbins;
+    memory->grow(binhead,maxbin,"gcmc:binhead");
+  }
+  if (nall > maxbinatom) {
+    maxbinatom = nall + atom->nmax;
+    memory->grow(binnext,maxbinatom,"gcmc:binnext");
+  }
+
+  for (int m = 0; m < nbins; m++) binhead[m] = -1;
+  for (int j = 0; j < nall; j++) {
+    int ix = MIN(static_cast<int>((x[j][0]-binlo[0])*bininv[0]),nbinx-1);
+    int iy = MIN(static_cast<int>((x[j][1]-binlo[1])*bininv[1]),nbiny-1);
+    int iz = MIN(static_cast<int>((x[j][2]-binlo[2])*bininv[2]),nbinz-1);
+    int m = (iz*nbiny + iy)*nbinx + ix;
+    binnext[j] = binhead[m];
+    binhead[m] = j;
+  }
+
+  bins_valid = 1;
+}
+
 /* ----------------------------------------------------------------------
    compute particle's interaction energy with the rest of the system
+   scans only the 27 bins surrounding coord: since the bin edge is
+   >= the force cutoff they contain every atom within interaction range
 ------------------------------------------------------------------------- */
 
 double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
@@ -2200,7 +2274,6 @@ double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
   double **x = atom->x;
   int *type = atom->type;
   tagint *molecule = atom->molecule;
-  int nall = atom->nlocal + atom->nghost;
   pair = force->pair;
   cutsq = force->pair->cutsq;
 
@@ -2210,27 +2283,51 @@ double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
 
   double total_energy = 0.0;
 
-  for (int j = 0; j < nall; j++) {
+  if (!bins_valid) bins_build();
+  if (nbins == 0) return 0.0;
+
+  // center bin of coord may be outside the grid by one layer
+  // bins beyond the grid are empty by construction, just skip them
 
-    if (i == j) continue;
-    if (exchmode == EXCHMOL || movemode == MOVEMOL)
-      if (imolecule == molecule[j]) continue;
+  int ix = static_cast<int>(floor((coord[0]-binlo[0])*bininv[0]));
+  int iy = static_cast<int>(floor((coord[1]-binlo[1])*bininv[1]));
+  int iz = static_cast<int>(floor((coord[2]-binlo[2])*bininv[2]));
 
-    delx = coord[0] - x[j][0];
-    dely = coord[1] - x[j][1];
-    delz = coord[2] - x[j][2];
-    rsq = delx*delx + dely*dely + delz*delz;
-    int jtype = type[j];
+  for (int dz = -1; dz <= 1; dz++) {
+    int jz = iz + dz;
+    if (jz < 0 || jz >= nbinz) continue;
+    for (int dy = -1; dy <= 1; dy++) {
+      int jy = iy + dy;
+      if (jy < 0 || jy >= nbiny) continue;
+      for (int dx = -1; dx <= 1; dx++) {
+        int jx = ix + dx;
+        if (jx < 0 || jx >= nbinx) continue;
 
-    // if overlap check requested, if overlap,
-    // return signal value for energy
+        int m = (jz*nbiny + jy)*nbinx + jx;
+        for (int j = binhead[m]; j >= 0; j = binnext[j]) {
 
-    if (overlap_flag && rsq < overlap_cutoffsq)
-      return MAXENERGYSIGNAL;
+          if (i == j) continue;
+          if (exchmode == EXCHMOL || movemode == MOVEMOL)
+            if (imolecule == molecule[j]) continue;
 
-    if (rsq < cutsq[itype][jtype])
-      total_energy +=
-        pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+          delx = coord[0] - x[j][0];
+          dely = coord[1] - x[j][1];
+          delz = coord[2] - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          int jtype = type[j];
+
+          // if overlap check requested, if overlap,
+          // return signal value for energy
+
+          if (overlap_flag && rsq < overlap_cutoffsq)
+            return MAXENERGYSIGNAL;
+
+          if (rsq < cutsq[itype][jtype])
+            total_energy +=
+              pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+        }
+      }
+    }
   }
 
   return total_energy;
@@ -2410,6 +2507,11 @@ void FixGCMC::toggle_intramolecular(int i)
 
 void FixGCMC::update_gas_atoms_list()
 {
+  // called whenever the atom set has changed (accepted moves, exchanges,
+  // new ghosts), so the local-energy bins must be rebuilt before reuse
+
+  bins_valid = 0;
+
   int nlocal = atom->nlocal;
   int *mask = atom->mask;
   tagint *molecule = atom->molecule;
@@ -124,6 +124,22 @@ class FixGCMC : public Fix {
 
   double energy_intra;
 
+  // uniform bins over owned+ghost atoms for local energy evaluation
+  // bin edge >= force cutoff, so scanning 27 bins finds all interactions
+  // rebuilt lazily whenever the atom set changes
+
+  int bins_valid;           // 0 if bins must be rebuilt before use
+  int nbinx,nbiny,nbinz;    // # of bins in each dim
+  int nbins;                // total # of bins
+  int maxbin;               // allocated length of binhead
+  int maxbinatom;           // allocated length of binnext
+  int *binhead;             // first atom in each bin, -1 if empty
+  int *binnext;             // next atom in same bin, -1 at end
+  double binlo[3];          // lower corner of bin grid
+  double bininv[3];         // inverse bin edge lengths
+
+  void bins_build();
+
   class Pair *pair;
 
   class RanPark *random_equal;
@@ -57,7 +57,7 @@ void Message::command(int narg, char **arg)
   // instantiate CSlib with chosen communication mode
 
   if (strcmp(arg[2],"file") == 0 || strcmp(arg[2],"zmq") == 0 ||
-      strcmp(arg[2],"mpi/two") == 0) {
+      strcmp(arg[2],"shm") == 0 || strcmp(arg[2],"mpi/two") == 0) {
     if (narg != 4) error->all(FLERR,"Illegal message command");
     lmp->cslib = new CSlib(clientserver-1,arg[2],arg[3],&world);
 
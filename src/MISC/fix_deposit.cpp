@@ -47,7 +47,7 @@ enum{DIST_UNIFORM,DIST_GAUSSIAN};
 FixDeposit::FixDeposit(LAMMPS *lmp, int narg, char **arg) :
   Fix(lmp, narg, arg), idregion(NULL), idrigid(NULL),
   idshake(NULL), onemols(NULL), molfrac(NULL), coords(NULL), imageflags(NULL),
-  fixrigid(NULL), fixshake(NULL), random(NULL)
+  fixrigid(NULL), fixshake(NULL), random(NULL), binhead(NULL), binnext(NULL)
 {
   if (narg < 7) error->all(FLERR,"Illegal fix deposit command");
 
@@ -300,7 +300,7 @@ void FixDeposit::init()
 void FixDeposit::pre_exchange()
 {
   int i,m,n,nlocalprev,imol,natom,flag,flagall;
-  double coord[3],lamda[3],delx,dely,delz,rsq;
+  double coord[3],lamda[3],delx,dely,delz;
   double r[3],vnew[3],rotmat[3][3],quat[4];
   double *newcoord;
 
@@ -333,6 +333,12 @@ void FixDeposit::pre_exchange()
 
   if (!idnext) find_maxid();
 
+  // bin my atoms once for the near-distance checks below
+  // at most one particle is inserted per event, so the bins stay valid
+  //   across all attempts
+
+  if (nearsq > 0.0) setup_near_bins();
+
   // attempt an insertion until successful
 
   int dimension = domain->dimension;
@@ -450,22 +456,11 @@ void FixDeposit::pre_exchange()
 
     // check distance between any existing atom and any inserted atom
     // if less than near, try again
-    // use minimum_image() to account for PBC
-
-    double **x = atom->x;
-    int nlocal = atom->nlocal;
+    // check my binned atoms only, scanning just the bins around each
+    //   inserted atom and its periodic images in place of minimum_image()
 
     flag = 0;
-    for (m = 0; m < natom; m++) {
-      for (i = 0; i < nlocal; i++) {
-        delx = coords[m][0] - x[i][0];
-        dely = coords[m][1] - x[i][1];
-        delz = coords[m][2] - x[i][2];
-        domain->minimum_image(delx,dely,delz);
-        rsq = delx*delx + dely*dely + delz*delz;
-        if (rsq < nearsq) flag = 1;
-      }
-    }
+    if (nearsq > 0.0) flag = check_near(coords,natom);
     MPI_Allreduce(&flag,&flagall,1,MPI_INT,MPI_MAX,world);
     if (flagall) continue;
 
@@ -583,6 +578,12 @@ void FixDeposit::pre_exchange()
     break;
   }
 
+  // free the bins
+
+  memory->destroy(binhead);
+  memory->destroy(binnext);
+  binhead = binnext = NULL;
+
   // warn if not successful b/c too many attempts
 
   if (!success && comm->me == 0)
@@ -650,6 +651,125 @@ void FixDeposit::find_maxid()
   }
 }
 
+/* ----------------------------------------------------------------------
+   setup linked-list bins of my atoms for near-distance checks
+   binned volume = bounding box of my atoms extended by the near distance,
+     derived from actual coords since atoms can drift out of the sub-domain
+     before this fix runs
+   bin size >= near distance so only 27 bins need checking per trial atom
+------------------------------------------------------------------------- */
+
+void FixDeposit::setup_near_bins()
+{
+  int i,dim;
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+
+  double cutoff = sqrt(nearsq);
+
+  if (nlocal) {
+    for (dim = 0; dim < 3; dim++) binlo[dim] = binhi[dim] = x[0][dim];
+    for (i = 1; i < nlocal; i++)
+      for (dim = 0; dim < 3; dim++) {
+        binlo[dim] = MIN(binlo[dim],x[i][dim]);
+        binhi[dim] = MAX(binhi[dim],x[i][dim]);
+      }
+  } else {
+    for (dim = 0; dim < 3; dim++) {
+      binlo[dim] = domain->sublo[dim];
+      binhi[dim] = domain->subhi[dim];
+    }
+  }
+
+  for (dim = 0; dim < 3; dim++) {
+    binlo[dim] -= cutoff;
+    binhi[dim] += cutoff;
+  }
+
+  nbinx = MAX(static_cast<int> ((binhi[0]-binlo[0]) / cutoff),1);
+  nbiny = MAX(static_cast<int> ((binhi[1]-binlo[1]) / cutoff),1);
+  nbinz = MAX(static_cast<int> ((binhi[2]-binlo[2]) / cutoff),1);
+  bininv[0] = nbinx / (binhi[0]-binlo[0]);
+  bininv[1] = nbiny / (binhi[1]-binlo[1]);
+  bininv[2] = nbinz / (binhi[2]-binlo[2]);
+
+  memory->create(binhead,nbinx*nbiny*nbinz,"deposit:binhead");
+  memory->create(binnext,nlocal,"deposit:binnext");
+  for (i = 0; i < nbinx*nbiny*nbinz; i++) binhead[i] = -1;
+
+  for (i = 0; i < nlocal; i++) {
+    int ix = static_cast<int> ((x[i][0]-binlo[0]) * bininv[0]);
+    int iy = static_cast<int> ((x[i][1]-binlo[1]) * bininv[1]);
+    int iz = static_cast<int> ((x[i][2]-binlo[2]) * bininv[2]);
+    ix = MAX(MIN(ix,nbinx-1),0);
+    iy = MAX(MIN(iy,nbiny-1),0);
+    iz = MAX(MIN(iz,nbinz-1),0);
+    int ibin = (iz*nbiny + iy)*nbinx + ix;
+    binnext[i] = binhead[ibin];
+    binhead[ibin] = i;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   check trial particle of natom atoms against my binned atoms
+   each trial atom and each of its periodic images inside the binned
+     volume scans only the 27 bins around it, so PBC are accounted for
+     without minimum_image() calls
+   periodic image shifts use the box spanning vectors, so triclinic
+     boxes work too
+   return 1 if any pair is closer than the near distance, 0 if not
+------------------------------------------------------------------------- */
+
+int FixDeposit::check_near(double **c, int natom)
+{
+  int m,sx,sy,sz,kx,ky,kz,j;
+  double img[3],delx,dely,delz,rsq;
+
+  int nlocal = atom->nlocal;
+  if (!nlocal) return 0;
+
+  double **x = atom->x;
+  int sxmax = (domain->xperiodic) ? 1 : 0;
+  int symax = (domain->yperiodic) ? 1 : 0;
+  int szmax = (domain->zperiodic) ? 1 : 0;
+
+  for (m = 0; m < natom; m++) {
+    for (sz = -szmax; sz <= szmax; sz++) {
+      for (sy = -symax; sy <= symax; sy++) {
+        for (sx = -sxmax; sx <= sxmax; sx++) {
+          img[0] = c[m][0] + sx*domain->xprd + sy*domain->xy + sz*domain->xz;
+          img[1] = c[m][1] + sy*domain->yprd + sz*domain->yz;
+          img[2] = c[m][2] + sz*domain->zprd;
+          if (img[0] < binlo[0] || img[0] > binhi[0] ||
+              img[1] < binlo[1] || img[1] > binhi[1] ||
+              img[2] < binlo[2] || img[2] > binhi[2]) continue;
+
+          int ix = static_cast<int> ((img[0]-binlo[0]) * bininv[0]);
+          int iy = static_cast<int> ((img[1]-binlo[1]) * bininv[1]);
+          int iz = static_cast<int> ((img[2]-binlo[2]) * bininv[2]);
+          ix = MAX(MIN(ix,nbinx-1),0);
+          iy = MAX(MIN(iy,nbiny-1),0);
+          iz = MAX(MIN(iz,nbinz-1),0);
+
+          for (kz = MAX(iz-1,0); kz <= MIN(iz+1,nbinz-1); kz++)
+            for (ky = MAX(iy-1,0); ky <= MIN(iy+1,nbiny-1); ky++)
+              for (kx = MAX(ix-1,0); kx <= MIN(ix+1,nbinx-1); kx++)
+                for (j = binhead[(kz*nbiny + ky)*nbinx + kx]; j >= 0;
+                     j = binnext[j]) {
+                  delx = img[0] - x[j][0];
+                  dely = img[1] - x[j][1];
+                  delz = img[2] - x[j][2];
+                  rsq = delx*delx + dely*dely + delz*delz;
+                  if (rsq < nearsq) return 1;
+                }
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    parse optional parameters at end of input line
 ------------------------------------------------------------------------- */
@@ -58,8 +58,17 @@ class FixDeposit : public Fix {
   tagint maxtag_all,maxmol_all;
   class RanPark *random;
 
+  // local bins of my atoms for near-distance checks of insertion trials
+
+  int *binhead,*binnext;       // linked-list bins of local atoms
+  int nbinx,nbiny,nbinz;       // # of bins in each dimension
+  double binlo[3],binhi[3];    // extent of binned volume
+  double bininv[3];            // inverse bin sizes
+
   void find_maxid();
   void options(int, char **);
+  void setup_near_bins();
+  int check_near(double **, int);
 };
 
 }
@@ -128,6 +128,19 @@ FixTTM::FixTTM(LAMMPS *lmp, int narg, char **arg) :
   memory->create(net_energy_transfer_all,nxnodes,nynodes,nznodes,
                  "TTM:net_energy_transfer_all");
 
+  // partition grid x-planes across procs for the diffusion solve
+
+  int nprocs = comm->nprocs;
+  nxlo_slab = comm->me*nxnodes/nprocs;
+  nxhi_slab = (comm->me+1)*nxnodes/nprocs;
+
+  memory->create(slabcnt,nprocs,"ttm:slabcnt");
+  memory->create(slabdsp,nprocs,"ttm:slabdsp");
+  for (int p = 0; p < nprocs; p++) {
+    slabcnt[p] = ((p+1)*nxnodes/nprocs - p*nxnodes/nprocs)*nynodes*nznodes;
+    slabdsp[p] = (p*nxnodes/nprocs)*nynodes*nznodes;
+  }
+
   flangevin = NULL;
   grow_arrays(atom->nmax);
 
@@ -170,6 +183,8 @@ FixTTM::~FixTTM()
   memory->destroy(flangevin);
   memory->destroy(net_energy_transfer);
   memory->destroy(net_energy_transfer_all);
+  memory->destroy(slabcnt);
+  memory->destroy(slabdsp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -318,6 +333,19 @@ void FixTTM::reset_dt()
       sqrt(24.0*force->boltz*gamma_p/update->dt/force->mvv2e) / force->ftm2v;
 }
 
+/* ----------------------------------------------------------------------
+   which proc owns x-plane ixnode of the electron grid
+------------------------------------------------------------------------- */
+
+int FixTTM::slab_owner(int ixnode)
+{
+  int nprocs = comm->nprocs;
+  for (int p = 0; p < nprocs; p++)
+    if (ixnode >= p*nxnodes/nprocs && ixnode < (p+1)*nxnodes/nprocs)
+      return p;
+  return comm->me;
+}
+
 /* ----------------------------------------------------------------------
    read in initial electron temperatures from a user-specified file
    only called by proc 0
@@ -437,47 +465,99 @@ void FixTTM::end_of_step()
       error->warning(FLERR,"Too many inner timesteps in fix ttm",0);
   }
 
+  // integrate the electronic heat equation on this proc's slab of
+  // x-planes only, instead of every proc redundantly sweeping the
+  // whole replicated grid; slab boundary planes are refreshed from
+  // the periodic neighbor slabs between inner steps and the full
+  // grid is re-replicated once per MD step below
+
+  const int nplane = nynodes*nznodes;
+  const int nprocs = comm->nprocs;
+  const int prevproc = slab_owner((nxlo_slab-1+nxnodes) % nxnodes);
+  const int nextproc = slab_owner(nxhi_slab % nxnodes);
+
+  // hoisted stencil prefactors
+
+  const double dtcv = inner_dt/(electronic_specific_heat*electronic_density);
+  const double cx = dtcv*electronic_thermal_conductivity/dx/dx;
+  const double cy = dtcv*electronic_thermal_conductivity/dy/dy;
+  const double cz = dtcv*electronic_thermal_conductivity/dz/dz;
+  const double cnet = dtcv/del_vol;
+
   for (int ith_inner_timestep = 0; ith_inner_timestep < num_inner_timesteps;
        ith_inner_timestep++) {
 
-    for (int ixnode = 0; ixnode < nxnodes; ixnode++)
-      for (int iynode = 0; iynode < nynodes; iynode++)
-        for (int iznode = 0; iznode < nznodes; iznode++)
-          T_electron_old[ixnode][iynode][iznode] =
-            T_electron[ixnode][iynode][iznode];
+    // latest temperatures become the old ones: pointer swap, no copy
+    // on entry (step 0) T_electron holds the replicated grid, so all
+    // ghost planes are current; afterwards refresh the two boundary
+    // planes of the slab from their periodic neighbor owners
+
+    double ***tmp = T_electron_old;
+    T_electron_old = T_electron;
+    T_electron = tmp;
+
+    if (ith_inner_timestep > 0 && nxhi_slab > nxlo_slab &&
+        prevproc != comm->me) {
+      int leftghost = (nxlo_slab-1+nxnodes) % nxnodes;
+      int rightghost = nxhi_slab % nxnodes;
+
+      // ring shift down then up, deadlock-free
+
+      MPI_Sendrecv(&T_electron_old[nxlo_slab][0][0],nplane,MPI_DOUBLE,
+                   prevproc,0,
+                   &T_electron_old[rightghost][0][0],nplane,MPI_DOUBLE,
+                   nextproc,0,world,MPI_STATUS_IGNORE);
+      MPI_Sendrecv(&T_electron_old[nxhi_slab-1][0][0],nplane,MPI_DOUBLE,
+                   nextproc,1,
+                   &T_electron_old[leftghost][0][0],nplane,MPI_DOUBLE,
+                   prevproc,1,world,MPI_STATUS_IGNORE);
+    }
 
     // compute new electron T profile
 
-    for (int ixnode = 0; ixnode < nxnodes; ixnode++)
-      for (int iynode = 0; iynode < nynodes; iynode++)
+    for (int ixnode = nxlo_slab; ixnode < nxhi_slab; ixnode++) {
+      int right_xnode = ixnode + 1;
+      if (right_xnode == nxnodes) right_xnode = 0;
+      int left_xnode = ixnode - 1;
+      if (left_xnode == -1) left_xnode = nxnodes - 1;
+      for (int iynode = 0; iynode < nynodes; iynode++) {
+        int right_ynode = iynode + 1;
+        if (right_ynode == nynodes) right_ynode = 0;
+        int left_ynode = iynode - 1;
+        if (left_ynode == -1) left_ynode = nynodes - 1;
         for (int iznode = 0; iznode < nznodes; iznode++) {
-          int right_xnode = ixnode + 1;
-          int right_ynode = iynode + 1;
           int right_znode = iznode + 1;
-          if (right_xnode == nxnodes) right_xnode = 0;
-          if (right_ynode == nynodes) right_ynode = 0;
-          if (right_znode == nznodes) right_znode = 0;
-          int left_xnode = ixnode - 1;
-          int left_ynode = iynode - 1;
           int left_znode = iznode - 1;
-          if (left_xnode == -1) left_xnode = nxnodes - 1;
-          if (left_ynode == -1) left_ynode = nynodes - 1;
+          if (right_znode == nznodes) right_znode = 0;
           if (left_znode == -1) left_znode = nznodes - 1;
           T_electron[ixnode][iynode][iznode] =
             T_electron_old[ixnode][iynode][iznode] +
-            inner_dt/(electronic_specific_heat*electronic_density) *
-            (electronic_thermal_conductivity *
-             ((T_electron_old[right_xnode][iynode][iznode] +
-               T_electron_old[left_xnode][iynode][iznode] -
-               2*T_electron_old[ixnode][iynode][iznode])/dx/dx +
-              (T_electron_old[ixnode][right_ynode][iznode] +
-               T_electron_old[ixnode][left_ynode][iznode] -
-               2*T_electron_old[ixnode][iynode][iznode])/dy/dy +
-              (T_electron_old[ixnode][iynode][right_znode] +
-               T_electron_old[ixnode][iynode][left_znode] -
-               2*T_electron_old[ixnode][iynode][iznode])/dz/dz) -
-             (net_energy_transfer_all[ixnode][iynode][iznode])/del_vol);
+            cx*(T_electron_old[right_xnode][iynode][iznode] +
+                T_electron_old[left_xnode][iynode][iznode] -
+                2.0*T_electron_old[ixnode][iynode][iznode]) +
+            cy*(T_electron_old[ixnode][right_ynode][iznode] +
+                T_electron_old[ixnode][left_ynode][iznode] -
+                2.0*T_electron_old[ixnode][iynode][iznode]) +
+            cz*(T_electron_old[ixnode][iynode][right_znode] +
+                T_electron_old[ixnode][iynode][left_znode] -
+                2.0*T_electron_old[ixnode][iynode][iznode]) -
+            cnet*net_energy_transfer_all[ixnode][iynode][iznode];
         }
+      }
+    }
+  }
+
+  // re-replicate the grid: gather all slabs into T_electron_old,
+  // then swap it into place
+
+  if (nprocs > 1) {
+    double *sendbuf = &T_electron[0][0][0];
+    if (nxhi_slab > nxlo_slab) sendbuf = &T_electron[nxlo_slab][0][0];
+    MPI_Allgatherv(sendbuf,(nxhi_slab-nxlo_slab)*nplane,MPI_DOUBLE,
+                   &T_electron_old[0][0][0],slabcnt,slabdsp,MPI_DOUBLE,world);
+    double ***tmp = T_electron_old;
+    T_electron_old = T_electron;
+    T_electron = tmp;
   }
 
   // output nodal temperatures for current timestep
@@ -65,6 +65,14 @@ class FixTTM : public Fix {
   double electronic_thermal_conductivity;
   double gamma_p,gamma_s,v_0,v_0_sq;
 
+  // x-slab decomposition of the diffusion solve:
+  // this proc integrates grid planes [nxlo_slab,nxhi_slab)
+  // and the grid is re-replicated after each MD step
+
+  int nxlo_slab,nxhi_slab;
+  int *slabcnt,*slabdsp;       // allgatherv counts/displs in grid points
+
+  int slab_owner(int);
   void read_initial_electron_temperatures(const char *);
 };
 
@@ -110,22 +110,24 @@ void MLIAPData::generate_neighdata(NeighList* list_in, int eflag_in, int vflag_i
   int *numneigh = list->numneigh;
   int **firstneigh = list->firstneigh;
 
-  // grow nmax gradforce array if necessary
-
-  if (atom->nmax > nmax) {
-    nmax = atom->nmax;
-    memory->grow(gradforce,nmax,size_gradforce,
-                 "MLIAPData:gradforce");
- }
-
-  // clear gradforce array
-
-  int ntotal = atom->nlocal + atom->nghost;
-  for (int i = 0; i < ntotal; i++)
-    for (int j = 0; j < size_gradforce; j++) {
-      gradforce[i][j] = 0.0;
+  // grow and clear nmax gradforce array if necessary
+  // only the compute mliap force gradient paths accumulate into it,
+  // so the pair style (gradgradflag = -1) never pays for the clear
+
+  if (gradgradflag >= 0) {
+    if (atom->nmax > nmax) {
+      nmax = atom->nmax;
+      memory->grow(gradforce,nmax,size_gradforce,
+                   "MLIAPData:gradforce");
     }
 
+    int ntotal = atom->nlocal + atom->nghost;
+    for (int i = 0; i < ntotal; i++)
+      for (int j = 0; j < size_gradforce; j++) {
+        gradforce[i][j] = 0.0;
+      }
+  }
+
   // grow gamma arrays if necessary
 
   if (gradgradflag == 1) {
@@ -56,8 +56,11 @@ void MLIAPModelLinear::compute_gradients(MLIAPData* data)
     const int ielem = data->ielems[ii];
 
     double* coeffi = coeffelem[ielem];
+    double* betai = data->betas[ii];
+    double* bvec = data->descriptors[ii];
+
     for (int icoeff = 0; icoeff < data->ndescriptors; icoeff++)
-      data->betas[ii][icoeff] = coeffi[icoeff+1];
+      betai[icoeff] = coeffi[icoeff+1];
 
     // add in contributions to global and per-atom energy
     // this is optional and has no effect on force calculation
@@ -66,13 +69,12 @@ void MLIAPModelLinear::compute_gradients(MLIAPData* data)
 
       // energy of atom I
 
-      double* coeffi = coeffelem[ielem];
       double etmp = coeffi[0];
 
       // E_i = beta.B_i
 
       for (int icoeff = 0; icoeff < data->ndescriptors; icoeff++)
-        etmp += coeffi[icoeff+1]*data->descriptors[ii][icoeff];
+        etmp += coeffi[icoeff+1]*bvec[icoeff];
 
       data->pairmliap->e_tally(i,etmp);
     }
@@ -57,18 +57,21 @@ void MLIAPModelQuadratic::compute_gradients(MLIAPData* data)
     const int ielem = data->ielems[ii];
 
     double* coeffi = coeffelem[ielem];
+    double* betai = data->betas[ii];
+    double* bvec = data->descriptors[ii];
+
     for (int icoeff = 0; icoeff < data->ndescriptors; icoeff++)
-      data->betas[ii][icoeff] = coeffi[icoeff+1];
+      betai[icoeff] = coeffi[icoeff+1];
 
     int k = ndescriptors+1;
     for (int icoeff = 0; icoeff < data->ndescriptors; icoeff++) {
-      double bveci = data->descriptors[ii][icoeff];
-      data->betas[ii][icoeff] += coeffi[k]*bveci;
+      double bveci = bvec[icoeff];
+      betai[icoeff] += coeffi[k]*bveci;
       k++;
       for (int jcoeff = icoeff+1; jcoeff < data->ndescriptors; jcoeff++) {
-        double bvecj = data->descriptors[ii][jcoeff];
-        data->betas[ii][icoeff] += coeffi[k]*bvecj;
-        data->betas[ii][jcoeff] += coeffi[k]*bveci;
+        double bvecj = bvec[jcoeff];
+        betai[icoeff] += coeffi[k]*bvecj;
+        betai[jcoeff] += coeffi[k]*bveci;
         k++;
       }
     }
@@ -79,26 +82,16 @@ void MLIAPModelQuadratic::compute_gradients(MLIAPData* data)
     if (data->eflag) {
 
       // energy of atom I
-
-      double* coeffi = coeffelem[ielem];
-      double etmp = coeffi[0];
-
       // E_i = beta.B_i + 0.5*B_i^t.alpha.B_i
+      //     = 0.5*(beta.B_i + (beta + alpha.B_i).B_i)
+      // betas above already hold beta + alpha.B_i, so recover the
+      // energy with one dot product instead of re-walking the
+      // O(K^2) triangle of alpha
 
+      double etmp = coeffi[0];
       for (int icoeff = 0; icoeff < data->ndescriptors; icoeff++)
-        etmp += coeffi[icoeff+1]*data->descriptors[ii][icoeff];
+        etmp += 0.5*(coeffi[icoeff+1] + betai[icoeff])*bvec[icoeff];
 
-      // quadratic contributions
-
-      int k = ndescriptors+1;
-      for (int icoeff = 0; icoeff < data->ndescriptors; icoeff++) {
-        double bveci = data->descriptors[ii][icoeff];
-        etmp += 0.5*coeffi[k++]*bveci*bveci;
-        for (int jcoeff = icoeff+1; jcoeff < data->ndescriptors; jcoeff++) {
-          double bvecj = data->descriptors[ii][jcoeff];
-          etmp += coeffi[k++]*bveci*bvecj;
-        }
-      }
       data->pairmliap->e_tally(i,etmp);
     }
   }
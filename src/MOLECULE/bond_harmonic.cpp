@@ -46,20 +46,43 @@ BondHarmonic::~BondHarmonic()
 /* ---------------------------------------------------------------------- */
 
 void BondHarmonic::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  // dispatch to a compile-time specialization of the bond loop,
+  // so the common no-tally case runs with no per-bond branches
+
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_bond) eval<1,1,1>();
+      else eval<1,1,0>();
+    } else {
+      if (force->newton_bond) eval<1,0,1>();
+      else eval<1,0,0>();
+    }
+  } else {
+    if (force->newton_bond) eval<0,0,1>();
+    else eval<0,0,0>();
+  }
+}
+
+template <int EVFLAG, int EFLAG, int NEWTON_BOND>
+void BondHarmonic::eval()
 {
   int i1,i2,n,type;
   double delx,dely,delz,ebond,fbond;
   double rsq,r,dr,rk;
 
   ebond = 0.0;
-  ev_init(eflag,vflag);
 
   double **x = atom->x;
   double **f = atom->f;
   int **bondlist = neighbor->bondlist;
+  int detflag = atom->f_det_flag;
+  int64_t **f_det = atom->f_det;
+  double detscale = atom->f_det_scale;
   int nbondlist = neighbor->nbondlist;
   int nlocal = atom->nlocal;
-  int newton_bond = force->newton_bond;
 
   for (n = 0; n < nbondlist; n++) {
     i1 = bondlist[n][0];
@@ -80,23 +103,41 @@ void BondHarmonic::compute(int eflag, int vflag)
     if (r > 0.0) fbond = -2.0*rk/r;
     else fbond = 0.0;
 
-    if (eflag) ebond = rk*dr;
+    if (EFLAG) ebond = rk*dr;
 
     // apply force to each of 2 atoms
-
-    if (newton_bond || i1 < nlocal) {
-      f[i1][0] += delx*fbond;
-      f[i1][1] += dely*fbond;
-      f[i1][2] += delz*fbond;
-    }
-
-    if (newton_bond || i2 < nlocal) {
-      f[i2][0] -= delx*fbond;
-      f[i2][1] -= dely*fbond;
-      f[i2][2] -= delz*fbond;
+    // in deterministic mode round the contribution once and
+    // accumulate it in fixed point
+
+    if (detflag) {
+      int64_t fdx = (int64_t) llround(delx*fbond*detscale);
+      int64_t fdy = (int64_t) llround(dely*fbond*detscale);
+      int64_t fdz = (int64_t) llround(delz*fbond*detscale);
+      if (NEWTON_BOND || i1 < nlocal) {
+        f_det[i1][0] += fdx;
+        f_det[i1][1] += fdy;
+        f_det[i1][2] += fdz;
+      }
+      if (NEWTON_BOND || i2 < nlocal) {
+        f_det[i2][0] -= fdx;
+        f_det[i2][1] -= fdy;
+        f_det[i2][2] -= fdz;
+      }
+    } else {
+      if (NEWTON_BOND || i1 < nlocal) {
+        f[i1][0] += delx*fbond;
+        f[i1][1] += dely*fbond;
+        f[i1][2] += delz*fbond;
+      }
+
+      if (NEWTON_BOND || i2 < nlocal) {
+        f[i2][0] -= delx*fbond;
+        f[i2][1] -= dely*fbond;
+        f[i2][2] -= delz*fbond;
+      }
     }
 
-    if (evflag) ev_tally(i1,i2,nlocal,newton_bond,ebond,fbond,delx,dely,delz);
+    if (EVFLAG) ev_tally(i1,i2,nlocal,NEWTON_BOND,ebond,fbond,delx,dely,delz);
   }
 }
 
@@ -40,6 +40,7 @@ class BondHarmonic : public Bond {
  protected:
   double *k,*r0;
 
+  template <int EVFLAG, int EFLAG, int NEWTON_BOND> void eval();
   virtual void allocate();
 };
 
@@ -62,6 +62,33 @@ DihedralCharmm::~DihedralCharmm()
 /* ---------------------------------------------------------------------- */
 
 void DihedralCharmm::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  // insure pair->ev_tally() will use 1-4 virial contribution
+
+  if (weightflag && vflag_global == 2)
+    force->pair->vflag_either = force->pair->vflag_global = 1;
+
+  // dispatch to a compile-time specialization of the dihedral loop,
+  // so the common no-tally case runs with no per-dihedral branches
+
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_bond) eval<1,1,1>();
+      else eval<1,1,0>();
+    } else {
+      if (force->newton_bond) eval<1,0,1>();
+      else eval<1,0,0>();
+    }
+  } else {
+    if (force->newton_bond) eval<0,0,1>();
+    else eval<0,0,0>();
+  }
+}
+
+template <int EVFLAG, int EFLAG, int NEWTON_BOND>
+void DihedralCharmm::eval()
 {
   int i1,i2,i3,i4,i,m,n,type;
   double vb1x,vb1y,vb1z,vb2x,vb2y,vb2z,vb3x,vb3y,vb3z,vb2xm,vb2ym,vb2zm;
@@ -75,12 +102,6 @@ void DihedralCharmm::compute(int eflag, int vflag)
   double forcecoul,forcelj,fpair,ecoul,evdwl;
 
   edihedral = evdwl = ecoul = 0.0;
-  ev_init(eflag,vflag);
-
-  // insure pair->ev_tally() will use 1-4 virial contribution
-
-  if (weightflag && vflag_global == 2)
-    force->pair->vflag_either = force->pair->vflag_global = 1;
 
   double **x = atom->x;
   double **f = atom->f;
@@ -89,7 +110,6 @@ void DihedralCharmm::compute(int eflag, int vflag)
   int **dihedrallist = neighbor->dihedrallist;
   int ndihedrallist = neighbor->ndihedrallist;
   int nlocal = atom->nlocal;
-  int newton_bond = force->newton_bond;
   double qqrd2e = force->qqrd2e;
 
   for (n = 0; n < ndihedrallist; n++) {
@@ -189,7 +209,7 @@ void DihedralCharmm::compute(int eflag, int vflag)
       df1 = 0.0;
     }
 
-    if (eflag) edihedral = k[type] * p;
+    if (EFLAG) edihedral = k[type] * p;
 
     fg = vb1x*vb2xm + vb1y*vb2ym + vb1z*vb2zm;
     hg = vb3x*vb2xm + vb3y*vb2ym + vb3z*vb2zm;
@@ -232,32 +252,32 @@ void DihedralCharmm::compute(int eflag, int vflag)
 
     // apply force to each of 4 atoms
 
-    if (newton_bond || i1 < nlocal) {
+    if (NEWTON_BOND || i1 < nlocal) {
       f[i1][0] += f1[0];
       f[i1][1] += f1[1];
       f[i1][2] += f1[2];
     }
 
-    if (newton_bond || i2 < nlocal) {
+    if (NEWTON_BOND || i2 < nlocal) {
       f[i2][0] += f2[0];
       f[i2][1] += f2[1];
       f[i2][2] += f2[2];
     }
 
-    if (newton_bond || i3 < nlocal) {
+    if (NEWTON_BOND || i3 < nlocal) {
       f[i3][0] += f3[0];
       f[i3][1] += f3[1];
       f[i3][2] += f3[2];
     }
 
-    if (newton_bond || i4 < nlocal) {
+    if (NEWTON_BOND || i4 < nlocal) {
       f[i4][0] += f4[0];
       f[i4][1] += f4[1];
       f[i4][2] += f4[2];
     }
 
-    if (evflag)
-      ev_tally(i1,i2,i3,i4,nlocal,newton_bond,edihedral,f1,f3,f4,
+    if (EVFLAG)
+      ev_tally(i1,i2,i3,i4,nlocal,NEWTON_BOND,edihedral,f1,f3,f4,
                vb1x,vb1y,vb1z,vb2x,vb2y,vb2z,vb3x,vb3y,vb3z);
 
     // 1-4 LJ and Coulomb interactions
@@ -279,24 +299,24 @@ void DihedralCharmm::compute(int eflag, int vflag)
       forcelj = r6inv * (lj14_1[itype][jtype]*r6inv - lj14_2[itype][jtype]);
       fpair = weight[type] * (forcelj+forcecoul)*r2inv;
 
-      if (eflag) {
+      if (EFLAG) {
         ecoul = weight[type] * forcecoul;
         evdwl = r6inv * (lj14_3[itype][jtype]*r6inv - lj14_4[itype][jtype]);
         evdwl *= weight[type];
       }
 
-      if (newton_bond || i1 < nlocal) {
+      if (NEWTON_BOND || i1 < nlocal) {
         f[i1][0] += delx*fpair;
         f[i1][1] += dely*fpair;
         f[i1][2] += delz*fpair;
       }
-      if (newton_bond || i4 < nlocal) {
+      if (NEWTON_BOND || i4 < nlocal) {
         f[i4][0] -= delx*fpair;
         f[i4][1] -= dely*fpair;
         f[i4][2] -= delz*fpair;
       }
 
-      if (evflag) force->pair->ev_tally(i1,i4,nlocal,newton_bond,
+      if (EVFLAG) force->pair->ev_tally(i1,i4,nlocal,NEWTON_BOND,
                                         evdwl,ecoul,fpair,delx,dely,delz);
     }
   }
@@ -41,6 +41,7 @@ class DihedralCharmm : public Dihedral {
   double **lj14_1,**lj14_2,**lj14_3,**lj14_4;
   int implicit,weightflag;
 
+  template <int EVFLAG, int EFLAG, int NEWTON_BOND> void eval();
   virtual void allocate();
 };
 
@@ -96,7 +96,6 @@ void ComputeDamageAtom::compute_peratom()
       jnum = npartner[i];
       damage_temp = 0.0;
       for (jj = 0; jj < jnum; jj++) {
-        if (partner[i][jj] == 0) continue;
 
         // look up local index of this partner particle
         // skip if particle is "lost"
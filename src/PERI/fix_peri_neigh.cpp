@@ -322,10 +322,6 @@ void FixPeriNeigh::setup(int /*vflag*/)
 
     for (jj = 0; jj < jnum; jj++) {
 
-      // if bond already broken, skip this partner
-
-      if (partner[i][jj] == 0) continue;
-
       // lookup local index of partner particle
 
       j = atom->map(partner[i][jj]);
@@ -391,6 +387,26 @@ void FixPeriNeigh::setup(int /*vflag*/)
   }
 }
 
+/* ----------------------------------------------------------------------
+   remove partner JJ of atom I when its bond breaks or the partner is lost
+   swap the last partner into slot JJ so surviving bonds stay contiguous
+   callers iterating over the partner list must revisit slot JJ
+------------------------------------------------------------------------- */
+
+void FixPeriNeigh::delete_partner(int i, int jj)
+{
+  int last = npartner[i] - 1;
+  partner[i][jj] = partner[i][last];
+  if (isVES) {
+    deviatorextention[i][jj] = deviatorextention[i][last];
+    deviatorBackextention[i][jj] = deviatorBackextention[i][last];
+  }
+  if (isEPS)
+    deviatorPlasticextension[i][jj] = deviatorPlasticextension[i][last];
+  r0[i][jj] = r0[i][last];
+  npartner[i] = last;
+}
+
 /* ----------------------------------------------------------------------
    memory usage of local atom-based arrays
 ------------------------------------------------------------------------- */
@@ -613,8 +629,11 @@ void FixPeriNeigh::unpack_restart(int nlocal, int nth)
   for (int i = 0; i < nth; i++) m += static_cast<int> (extra[nlocal][m]);
   m++;
 
-  npartner[nlocal] = static_cast<int> (extra[nlocal][m++]);
-  for (int n = 0; n < npartner[nlocal]; n++) {
+  // drop partners stored as 0 = broken bonds from older restart files
+
+  int np = static_cast<int> (extra[nlocal][m++]);
+  int n = 0;
+  for (int k = 0; k < np; k++) {
     partner[nlocal][n] = static_cast<tagint> (extra[nlocal][m++]);
     if (isVES) {
       deviatorextention[nlocal][n] = extra[nlocal][m++];
@@ -622,7 +641,9 @@ void FixPeriNeigh::unpack_restart(int nlocal, int nth)
     }
     if (isEPS) deviatorPlasticextension[nlocal][n] = extra[nlocal][m++];
     r0[nlocal][n] = extra[nlocal][m++];
+    if (partner[nlocal][n] != 0) n++;
   }
+  npartner[nlocal] = n;
   if (isEPS) lambdaValue[nlocal] = extra[nlocal][m++];
   vinter[nlocal] = extra[nlocal][m++];
   wvolume[nlocal] = extra[nlocal][m++];
@@ -42,6 +42,7 @@ class FixPeriNeigh : public Fix {
   void init_list(int, class NeighList *);
   void setup(int);
   void min_setup(int);
+  void delete_partner(int, int);
 
   double memory_usage();
   void grow_arrays(int);
@@ -61,8 +62,10 @@ class FixPeriNeigh : public Fix {
  protected:
   int first;                 // flag for first time initialization
   int maxpartner;            // max # of peridynamic neighs for any atom
-  int *npartner;             // # of neighbors for each atom
+  int *npartner;             // # of surviving bonds for each atom
   tagint **partner;          // neighs for each atom, stored as global IDs
+                             // broken bonds are removed via delete_partner()
+                             // so the first npartner entries are all live
   double **deviatorextention; // Deviatoric extension
   double **deviatorBackextention; // Deviatoric back extension
   double **deviatorPlasticextension; // Deviatoric plastic extension
@@ -108,13 +108,13 @@ void PairPeriEPS::compute(int eflag, int vflag)
   double *vfrac = atom->vfrac;
   double *s0 = atom->s0;
   double **x0 = atom->x0;
-  double **r0 = ((FixPeriNeigh *) modify->fix[ifix_peri])->r0;
-  double **deviatorPlasticextension =
-    ((FixPeriNeigh *) modify->fix[ifix_peri])->deviatorPlasticextension;
-  tagint **partner = ((FixPeriNeigh *) modify->fix[ifix_peri])->partner;
-  int *npartner = ((FixPeriNeigh *) modify->fix[ifix_peri])->npartner;
-  double *wvolume = ((FixPeriNeigh *) modify->fix[ifix_peri])->wvolume;
-  double *lambdaValue = ((FixPeriNeigh *) modify->fix[ifix_peri])->lambdaValue;
+  FixPeriNeigh *fix_peri_neigh = (FixPeriNeigh *) modify->fix[ifix_peri];
+  double **r0 = fix_peri_neigh->r0;
+  double **deviatorPlasticextension = fix_peri_neigh->deviatorPlasticextension;
+  tagint **partner = fix_peri_neigh->partner;
+  int *npartner = fix_peri_neigh->npartner;
+  double *wvolume = fix_peri_neigh->wvolume;
+  double *lambdaValue = fix_peri_neigh->lambdaValue;
 
   // lc = lattice constant
   // init_style guarantees it's the same in x, y, and z
@@ -232,12 +232,15 @@ void PairPeriEPS::compute(int eflag, int vflag)
   compute_dilatation();
 
   // communicate dilatation (theta) of each particle
-  comm->forward_comm_pair(this);
-
   // communicate weighted volume (wvolume) upon every reneighbor
+  // fused into one message per swap when both are sent
 
-  if (neighbor->ago == 0)
-    comm->forward_comm_fix(modify->fix[ifix_peri]);
+  if (neighbor->ago == 0) {
+    comm->coalesce_begin();
+    comm->coalesce_pair(this);
+    comm->coalesce_fix(modify->fix[ifix_peri]);
+    comm->coalesce_flush();
+  } else comm->forward_comm_pair(this);
 
   // volume-dependent part of the energy
 
@@ -253,7 +256,7 @@ void PairPeriEPS::compute(int eflag, int vflag)
 
   // loop over my particles and their partners
   // partner list contains all bond partners, so I-J appears twice
-  // if bond already broken, skip this partner
+  // broken bonds are swapped out of the list, so all entries are live
   // first = true if this is first neighbor of particle i
 
   bool first;
@@ -290,12 +293,14 @@ void PairPeriEPS::compute(int eflag, int vflag)
     }
 
     for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
       j = atom->map(partner[i][jj]);
-       // check if lost a partner without first breaking bond
+
+      // check if lost a partner without first breaking bond
 
       if (j < 0) {
-        partner[i][jj] = 0;
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
         continue;
       }
 
@@ -382,7 +387,11 @@ void PairPeriEPS::compute(int eflag, int vflag)
 
 
       stretch = dr / r0[i][jj];
-      if (stretch > MIN(s0[i],s0[j])) partner[i][jj] = 0;
+      if (stretch > MIN(s0[i],s0[j])) {
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
+      }
 
       // update s0 for next timestep
 
@@ -649,9 +658,6 @@ void PairPeriEPS::compute_dilatation()
 
     for (jj = 0; jj < jnum; jj++) {
 
-      // if bond already broken, skip this partner
-      if (partner[i][jj] == 0) continue;
-
       // look up local index of this partner particle
       j = atom->map(partner[i][jj]);
 
@@ -736,13 +742,11 @@ double PairPeriEPS::compute_DeviatoricForceStateNorm(int i)
     itype = type[i];
 
     for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
       j = atom->map(partner[i][jj]);
-       // check if lost a partner without first breaking bond
-      if (j < 0) {
-        partner[i][jj] = 0;
-        continue;
-      }
+
+      // skip if particle is "lost"; compute() prunes the bond
+
+      if (j < 0) continue;
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
       delz = ztmp - x[j][2];
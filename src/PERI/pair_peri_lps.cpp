@@ -103,10 +103,11 @@ void PairPeriLPS::compute(int eflag, int vflag)
   double *vfrac = atom->vfrac;
   double *s0 = atom->s0;
   double **x0 = atom->x0;
-  double **r0   = ((FixPeriNeigh *) modify->fix[ifix_peri])->r0;
-  tagint **partner = ((FixPeriNeigh *) modify->fix[ifix_peri])->partner;
-  int *npartner = ((FixPeriNeigh *) modify->fix[ifix_peri])->npartner;
-  double *wvolume = ((FixPeriNeigh *) modify->fix[ifix_peri])->wvolume;
+  FixPeriNeigh *fix_peri_neigh = (FixPeriNeigh *) modify->fix[ifix_peri];
+  double **r0   = fix_peri_neigh->r0;
+  tagint **partner = fix_peri_neigh->partner;
+  int *npartner = fix_peri_neigh->npartner;
+  double *wvolume = fix_peri_neigh->wvolume;
 
   // lc = lattice constant
   // init_style guarantees it's the same in x, y, and z
@@ -210,10 +211,15 @@ void PairPeriLPS::compute(int eflag, int vflag)
   compute_dilatation();
 
   // communicate dilatation (theta) of each particle
-  comm->forward_comm_pair(this);
   // communicate wighted volume (wvolume) upon every reneighbor
-  if (neighbor->ago == 0)
-    comm->forward_comm_fix(modify->fix[ifix_peri]);
+  // fused into one message per swap when both are sent
+
+  if (neighbor->ago == 0) {
+    comm->coalesce_begin();
+    comm->coalesce_pair(this);
+    comm->coalesce_fix(modify->fix[ifix_peri]);
+    comm->coalesce_flush();
+  } else comm->forward_comm_pair(this);
 
   // Volume-dependent part of the energy
   if (eflag) {
@@ -228,7 +234,7 @@ void PairPeriLPS::compute(int eflag, int vflag)
 
   // loop over my particles and their partners
   // partner list contains all bond partners, so I-J appears twice
-  // if bond already broken, skip this partner
+  // broken bonds are swapped out of the list, so all entries are live
   // first = true if this is first neighbor of particle i
 
   bool first;
@@ -246,13 +252,14 @@ void PairPeriLPS::compute(int eflag, int vflag)
     first = true;
 
     for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
       j = atom->map(partner[i][jj]);
 
       // check if lost a partner without first breaking bond
 
       if (j < 0) {
-        partner[i][jj] = 0;
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
         continue;
       }
 
@@ -318,7 +325,11 @@ void PairPeriLPS::compute(int eflag, int vflag)
       // use s0 from previous timestep
 
       stretch = dr / r0[i][jj];
-      if (stretch > MIN(s0[i],s0[j])) partner[i][jj] = 0;
+      if (stretch > MIN(s0[i],s0[j])) {
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
+      }
 
       // update s0 for next timestep
 
@@ -570,9 +581,6 @@ void PairPeriLPS::compute_dilatation()
 
     for (jj = 0; jj < jnum; jj++) {
 
-      // if bond already broken, skip this partner
-      if (partner[i][jj] == 0) continue;
-
       // Look up local index of this partner particle
       j = atom->map(partner[i][jj]);
 
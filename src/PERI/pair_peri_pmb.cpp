@@ -94,9 +94,10 @@ void PairPeriPMB::compute(int eflag, int vflag)
   double *vfrac = atom->vfrac;
   double *s0 = atom->s0;
   double **x0 = atom->x0;
-  double **r0   = ((FixPeriNeigh *) modify->fix[ifix_peri])->r0;
-  tagint **partner = ((FixPeriNeigh *) modify->fix[ifix_peri])->partner;
-  int *npartner = ((FixPeriNeigh *) modify->fix[ifix_peri])->npartner;
+  FixPeriNeigh *fix_peri_neigh = (FixPeriNeigh *) modify->fix[ifix_peri];
+  double **r0   = fix_peri_neigh->r0;
+  tagint **partner = fix_peri_neigh->partner;
+  int *npartner = fix_peri_neigh->npartner;
 
   // lc = lattice constant
   // init_style guarantees it's the same in x, y, and z
@@ -190,7 +191,7 @@ void PairPeriPMB::compute(int eflag, int vflag)
 
   // loop over my particles and their partners
   // partner list contains all bond partners, so I-J appears twice
-  // if bond already broken, skip this partner
+  // broken bonds are swapped out of the list, so all entries are live
   // first = true if this is first neighbor of particle i
 
   bool first;
@@ -205,13 +206,14 @@ void PairPeriPMB::compute(int eflag, int vflag)
     first = true;
 
     for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
       j = atom->map(partner[i][jj]);
 
       // check if lost a partner without first breaking bond
 
       if (j < 0) {
-        partner[i][jj] = 0;
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
         continue;
       }
 
@@ -255,7 +257,11 @@ void PairPeriPMB::compute(int eflag, int vflag)
       // find stretch in bond I-J and break if necessary
       // use s0 from previous timestep
 
-      if (stretch > MIN(s0[i],s0[j])) partner[i][jj] = 0;
+      if (stretch > MIN(s0[i],s0[j])) {
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
+      }
 
       // update s0 for next timestep
 
@@ -471,7 +477,6 @@ double PairPeriPMB::single(int i, int j, int itype, int jtype, double rsq,
 
   int jnum = npartner[i];
   for (int jj = 0; jj < jnum; jj++) {
-    if (partner[i][jj] == 0) continue;
     if (j < 0) continue;
     if (j == atom->map(partner[i][jj])) {
       dr = r - r0[i][jj];
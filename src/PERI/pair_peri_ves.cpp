@@ -110,14 +110,13 @@ void PairPeriVES::compute(int eflag, int vflag)
   double *vfrac = atom->vfrac;
   double *s0 = atom->s0;
   double **x0 = atom->x0;
-  double **r0 = ((FixPeriNeigh *) modify->fix[ifix_peri])->r0;
-  double **deviatorextention =
-    ((FixPeriNeigh *) modify->fix[ifix_peri])->deviatorextention;
-  double **deviatorBackextention =
-    ((FixPeriNeigh *) modify->fix[ifix_peri])->deviatorBackextention;
-  tagint **partner = ((FixPeriNeigh *) modify->fix[ifix_peri])->partner;
-  int *npartner = ((FixPeriNeigh *) modify->fix[ifix_peri])->npartner;
-  double *wvolume = ((FixPeriNeigh *) modify->fix[ifix_peri])->wvolume;
+  FixPeriNeigh *fix_peri_neigh = (FixPeriNeigh *) modify->fix[ifix_peri];
+  double **r0 = fix_peri_neigh->r0;
+  double **deviatorextention = fix_peri_neigh->deviatorextention;
+  double **deviatorBackextention = fix_peri_neigh->deviatorBackextention;
+  tagint **partner = fix_peri_neigh->partner;
+  int *npartner = fix_peri_neigh->npartner;
+  double *wvolume = fix_peri_neigh->wvolume;
 
   // lc = lattice constant
   // init_style guarantees it's the same in x, y, and z
@@ -221,12 +220,15 @@ void PairPeriVES::compute(int eflag, int vflag)
   compute_dilatation();
 
   // communicate dilatation (theta) of each particle
-  comm->forward_comm_pair(this);
-
   // communicate weighted volume (wvolume) upon every reneighbor
+  // fused into one message per swap when both are sent
 
-  if (neighbor->ago == 0)
-    comm->forward_comm_fix(modify->fix[ifix_peri]);
+  if (neighbor->ago == 0) {
+    comm->coalesce_begin();
+    comm->coalesce_pair(this);
+    comm->coalesce_fix(modify->fix[ifix_peri]);
+    comm->coalesce_flush();
+  } else comm->forward_comm_pair(this);
 
   // volume-dependent part of the energy
 
@@ -242,7 +244,7 @@ void PairPeriVES::compute(int eflag, int vflag)
 
   // loop over my particles and their partners
   // partner list contains all bond partners, so I-J appears twice
-  // if bond already broken, skip this partner
+  // broken bonds are swapped out of the list, so all entries are live
   // first = true if this is first neighbor of particle i
 
   bool first;
@@ -260,13 +262,14 @@ void PairPeriVES::compute(int eflag, int vflag)
     first = true;
 
     for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
       j = atom->map(partner[i][jj]);
 
       // check if lost a partner without first breaking bond
 
       if (j < 0) {
-        partner[i][jj] = 0;
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
         continue;
       }
 
@@ -364,7 +367,11 @@ void PairPeriVES::compute(int eflag, int vflag)
       deviatorBackextention[i][jj]=edbNp1;
 
       stretch = dr / r0[i][jj];
-      if (stretch > MIN(s0[i],s0[j])) partner[i][jj] = 0;
+      if (stretch > MIN(s0[i],s0[j])) {
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
+      }
 
       // update s0 for next timestep
 
@@ -633,10 +640,6 @@ void PairPeriVES::compute_dilatation()
 
     for (jj = 0; jj < jnum; jj++) {
 
-      // if bond already broken, skip this partner
-
-      if (partner[i][jj] == 0) continue;
-
       // look up local index of this partner particle
 
       j = atom->map(partner[i][jj]);
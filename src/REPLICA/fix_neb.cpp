@@ -42,6 +42,15 @@ enum{SINGLE_PROC_DIRECT,SINGLE_PROC_MAP,MULTI_PROC};
 
 #define BUFSIZE 8
 
+// message tags for the inter-replica exchanges
+// coords+IDs are posted before the force evaluation and must not match
+// the energy or force messages sent between the same pairs of procs
+
+#define TAG_ENERGY 0
+#define TAG_COORD 1
+#define TAG_ID 2
+#define TAG_FORCE 3
+
 /* ---------------------------------------------------------------------- */
 
 FixNEB::FixNEB(LAMMPS *lmp, int narg, char **arg) :
@@ -49,10 +58,14 @@ FixNEB::FixNEB(LAMMPS *lmp, int narg, char **arg) :
   id_pe(NULL), pe(NULL), nlenall(NULL), xprev(NULL), xnext(NULL),
   fnext(NULL), springF(NULL), tangent(NULL), xsend(NULL), xrecv(NULL),
   fsend(NULL), frecv(NULL), tagsend(NULL), tagrecv(NULL),
+  xrecvnext(NULL), tagrecvnext(NULL),
   xsendall(NULL), xrecvall(NULL), fsendall(NULL), frecvall(NULL),
-  tagsendall(NULL), tagrecvall(NULL), counts(NULL),
+  tagsendall(NULL), tagrecvall(NULL),
+  xrecvallnext(NULL), tagrecvallnext(NULL), counts(NULL),
   displacements(NULL)
 {
+  xcomm_posted = 0;
+  nxrequest = 0;
 
   if (narg < 4) error->all(FLERR,"Illegal fix neb command");
 
@@ -178,6 +191,8 @@ FixNEB::~FixNEB()
   memory->destroy(frecv);
   memory->destroy(tagsend);
   memory->destroy(tagrecv);
+  memory->destroy(xrecvnext);
+  memory->destroy(tagrecvnext);
 
   memory->destroy(xsendall);
   memory->destroy(xrecvall);
@@ -185,6 +200,8 @@ FixNEB::~FixNEB()
   memory->destroy(frecvall);
   memory->destroy(tagsendall);
   memory->destroy(tagrecvall);
+  memory->destroy(xrecvallnext);
+  memory->destroy(tagrecvallnext);
 
   memory->destroy(counts);
   memory->destroy(displacements);
@@ -200,6 +217,7 @@ FixNEB::~FixNEB()
 int FixNEB::setmask()
 {
   int mask = 0;
+  mask |= MIN_PRE_FORCE;
   mask |= MIN_POST_FORCE;
   return mask;
 }
@@ -245,6 +263,8 @@ void FixNEB::init()
     memory->create(frecvall,ntotal,3,"neb:frecvall");
     memory->create(tagsendall,ntotal,"neb:tagsendall");
     memory->create(tagrecvall,ntotal,"neb:tagrecvall");
+    memory->create(xrecvallnext,ntotal,3,"neb:xrecvallnext");
+    memory->create(tagrecvallnext,ntotal,"neb:tagrecvallnext");
     memory->create(counts,nprocs,"neb:counts");
     memory->create(displacements,nprocs,"neb:displacements");
   }
@@ -261,6 +281,16 @@ void FixNEB::min_setup(int vflag)
   pe->addstep(update->ntimestep+1);
 }
 
+/* ----------------------------------------------------------------------
+   post the coord exchange with adjacent replicas before the force
+   evaluation, so the messages transit while forces are computed
+------------------------------------------------------------------------- */
+
+void FixNEB::min_pre_force(int /*vflag*/)
+{
+  inter_replica_comm_post();
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixNEB::min_post_force(int /*vflag*/)
@@ -272,14 +302,14 @@ void FixNEB::min_post_force(int /*vflag*/)
   vprev = vnext = veng = pe->compute_scalar();
 
   if (ireplica < nreplica-1 && me == 0)
-    MPI_Send(&veng,1,MPI_DOUBLE,procnext,0,uworld);
+    MPI_Send(&veng,1,MPI_DOUBLE,procnext,TAG_ENERGY,uworld);
   if (ireplica > 0 && me == 0)
-    MPI_Recv(&vprev,1,MPI_DOUBLE,procprev,0,uworld,MPI_STATUS_IGNORE);
+    MPI_Recv(&vprev,1,MPI_DOUBLE,procprev,TAG_ENERGY,uworld,MPI_STATUS_IGNORE);
 
   if (ireplica > 0 && me == 0)
-    MPI_Send(&veng,1,MPI_DOUBLE,procprev,0,uworld);
+    MPI_Send(&veng,1,MPI_DOUBLE,procprev,TAG_ENERGY,uworld);
   if (ireplica < nreplica-1 && me == 0)
-    MPI_Recv(&vnext,1,MPI_DOUBLE,procnext,0,uworld,MPI_STATUS_IGNORE);
+    MPI_Recv(&vnext,1,MPI_DOUBLE,procnext,TAG_ENERGY,uworld,MPI_STATUS_IGNORE);
 
   if (cmode == MULTI_PROC) {
     MPI_Bcast(&vprev,1,MPI_DOUBLE,0,world);
@@ -313,9 +343,12 @@ void FixNEB::min_post_force(int /*vflag*/)
       }
       }*/
 
-  // communicate atoms to/from adjacent replicas to fill xprev,xnext
+  // complete the coord exchange posted before the force evaluation and
+  // exchange forces with adjacent replicas to fill xprev,xnext,fnext
+  // min_setup() arrives here without a preceding min_pre_force() call
 
-  inter_replica_comm();
+  if (!xcomm_posted) inter_replica_comm_post();
+  inter_replica_comm_complete();
 
   // trigger potential energy computation on next timestep
 
@@ -635,29 +668,28 @@ void FixNEB::min_post_force(int /*vflag*/)
 }
 
 /* ----------------------------------------------------------------------
-   send/recv NEB atoms to/from adjacent replicas
-   received atoms matching my local atoms are stored in xprev,xnext
+   post nonblocking send/recv of NEB atom coords and IDs with adjacent
+   replicas, both directions at once
+   coords are final when the force evaluation starts, so the exchange
+   proceeds while forces are computed and is completed in min_post_force()
    replicas 0 and N-1 send but do not receive any atoms
 ------------------------------------------------------------------------- */
 
-
-void FixNEB::inter_replica_comm()
+void FixNEB::inter_replica_comm_post()
 {
   int i,m;
-  MPI_Request request;
-  MPI_Request requests[2];
-  MPI_Status statuses[2];
 
   // reallocate memory if necessary
 
   if (atom->nmax > maxlocal) reallocate();
 
   double **x = atom->x;
-  double **f = atom->f;
   tagint *tag = atom->tag;
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
 
+  nxrequest = 0;
+
   // -----------------------------------------------------
   // 3 cases: two for single proc per replica
   //          one for multiple procs per replica
@@ -668,81 +700,185 @@ void FixNEB::inter_replica_comm()
   // direct comm of x -> xprev and x -> xnext
 
   if (cmode == SINGLE_PROC_DIRECT) {
-    if (ireplica > 0)
-      MPI_Irecv(xprev[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld,&request);
-    if (ireplica < nreplica-1)
-      MPI_Send(x[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld);
-    if (ireplica > 0) MPI_Wait(&request,MPI_STATUS_IGNORE);
-    if (ireplica < nreplica-1)
-      MPI_Irecv(xnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,&request);
-    if (ireplica > 0)
-      MPI_Send(x[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld);
-    if (ireplica < nreplica-1) MPI_Wait(&request,MPI_STATUS_IGNORE);
-
-    if (ireplica < nreplica-1)
-      MPI_Irecv(fnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,&request);
-    if (ireplica > 0)
-      MPI_Send(f[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld);
-    if (ireplica < nreplica-1) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    if (ireplica > 0) {
+      MPI_Irecv(xprev[0],3*nlocal,MPI_DOUBLE,procprev,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(x[0],3*nlocal,MPI_DOUBLE,procprev,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+    }
+    if (ireplica < nreplica-1) {
+      MPI_Irecv(xnext[0],3*nlocal,MPI_DOUBLE,procnext,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(x[0],3*nlocal,MPI_DOUBLE,procnext,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+    }
 
+    xcomm_posted = 1;
     return;
   }
 
+  // pack my NEB atom IDs and coords
+  // same loop and ordering is used to pack forces at completion
+
+  m = 0;
+  for (i = 0; i < nlocal; i++)
+    if (mask[i] & groupbit) {
+      tagsend[m] = tag[i];
+      xsend[m][0] = x[i][0];
+      xsend[m][1] = x[i][1];
+      xsend[m][2] = x[i][2];
+      m++;
+    }
+
   // single proc per replica
   // but only some atoms are NEB atoms or atom sorting is enabled
   // send atom IDs and coords of only NEB atoms to prev/next proc
   // recv procs use atom->map() to match received coords to owned atoms
 
   if (cmode == SINGLE_PROC_MAP) {
-    m = 0;
-    for (i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        tagsend[m] = tag[i];
-        xsend[m][0] = x[i][0];
-        xsend[m][1] = x[i][1];
-        xsend[m][2] = x[i][2];
-        fsend[m][0] = f[i][0];
-        fsend[m][1] = f[i][1];
-        fsend[m][2] = f[i][2];
-        m++;
-      }
-
     if (ireplica > 0) {
-      MPI_Irecv(xrecv[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld,&requests[0]);
-      MPI_Irecv(tagrecv,nebatoms,MPI_LMP_TAGINT,procprev,0,uworld,&requests[1]);
+      MPI_Irecv(xrecv[0],3*nebatoms,MPI_DOUBLE,procprev,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Irecv(tagrecv,nebatoms,MPI_LMP_TAGINT,procprev,TAG_ID,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(xsend[0],3*nebatoms,MPI_DOUBLE,procprev,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(tagsend,nebatoms,MPI_LMP_TAGINT,procprev,TAG_ID,uworld,
+                &xrequest[nxrequest++]);
     }
     if (ireplica < nreplica-1) {
-      MPI_Send(xsend[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld);
-      MPI_Send(tagsend,nebatoms,MPI_LMP_TAGINT,procnext,0,uworld);
+      MPI_Irecv(xrecvnext[0],3*nebatoms,MPI_DOUBLE,procnext,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Irecv(tagrecvnext,nebatoms,MPI_LMP_TAGINT,procnext,TAG_ID,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(xsend[0],3*nebatoms,MPI_DOUBLE,procnext,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(tagsend,nebatoms,MPI_LMP_TAGINT,procnext,TAG_ID,uworld,
+                &xrequest[nxrequest++]);
     }
 
+    xcomm_posted = 1;
+    return;
+  }
+
+  // multiple procs per replica
+  // MPI_Gather all coords and atom IDs to root proc of each replica
+  // root procs of adjacent replicas exchange the gathered buffers
+
+  MPI_Gather(&m,1,MPI_INT,counts,1,MPI_INT,0,world);
+  displacements[0] = 0;
+  for (i = 0; i < nprocs-1; i++)
+    displacements[i+1] = displacements[i] + counts[i];
+  MPI_Gatherv(tagsend,m,MPI_LMP_TAGINT,
+              tagsendall,counts,displacements,MPI_LMP_TAGINT,0,world);
+  for (i = 0; i < nprocs; i++) counts[i] *= 3;
+  for (i = 0; i < nprocs-1; i++)
+    displacements[i+1] = displacements[i] + counts[i];
+  if (xsend)
+    MPI_Gatherv(xsend[0],3*m,MPI_DOUBLE,
+                xsendall[0],counts,displacements,MPI_DOUBLE,0,world);
+  else
+    MPI_Gatherv(NULL,3*m,MPI_DOUBLE,
+                xsendall[0],counts,displacements,MPI_DOUBLE,0,world);
+
+  if (me == 0) {
     if (ireplica > 0) {
-      MPI_Waitall(2,requests,statuses);
+      MPI_Irecv(xrecvall[0],3*nebatoms,MPI_DOUBLE,procprev,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Irecv(tagrecvall,nebatoms,MPI_LMP_TAGINT,procprev,TAG_ID,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(xsendall[0],3*nebatoms,MPI_DOUBLE,procprev,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(tagsendall,nebatoms,MPI_LMP_TAGINT,procprev,TAG_ID,uworld,
+                &xrequest[nxrequest++]);
+    }
+    if (ireplica < nreplica-1) {
+      MPI_Irecv(xrecvallnext[0],3*nebatoms,MPI_DOUBLE,procnext,TAG_COORD,
+                uworld,&xrequest[nxrequest++]);
+      MPI_Irecv(tagrecvallnext,nebatoms,MPI_LMP_TAGINT,procnext,TAG_ID,
+                uworld,&xrequest[nxrequest++]);
+      MPI_Isend(xsendall[0],3*nebatoms,MPI_DOUBLE,procnext,TAG_COORD,uworld,
+                &xrequest[nxrequest++]);
+      MPI_Isend(tagsendall,nebatoms,MPI_LMP_TAGINT,procnext,TAG_ID,uworld,
+                &xrequest[nxrequest++]);
+    }
+  }
+
+  xcomm_posted = 1;
+}
+
+/* ----------------------------------------------------------------------
+   complete the posted coord exchange and store matching atoms in
+   xprev,xnext, then exchange forces of NEB atoms with the next replica
+   force exchange is blocking since forces only exist after the force
+   evaluation, just before the tangent/spring computation that needs them
+------------------------------------------------------------------------- */
+
+void FixNEB::inter_replica_comm_complete()
+{
+  int i,m;
+  MPI_Request request;
+
+  double **f = atom->f;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  xcomm_posted = 0;
+
+  // single proc per replica, direct comm
+  // coords were received directly into xprev/xnext
+  // f -> fnext of prev replica
+
+  if (cmode == SINGLE_PROC_DIRECT) {
+    if (nxrequest) MPI_Waitall(nxrequest,xrequest,MPI_STATUSES_IGNORE);
+
+    if (ireplica < nreplica-1)
+      MPI_Irecv(fnext[0],3*nlocal,MPI_DOUBLE,procnext,TAG_FORCE,uworld,
+                &request);
+    if (ireplica > 0)
+      MPI_Send(f[0],3*nlocal,MPI_DOUBLE,procprev,TAG_FORCE,uworld);
+    if (ireplica < nreplica-1) MPI_Wait(&request,MPI_STATUS_IGNORE);
+
+    return;
+  }
+
+  // pack forces of my NEB atoms in the same order coords were packed
+
+  m = 0;
+  for (i = 0; i < nlocal; i++)
+    if (mask[i] & groupbit) {
+      fsend[m][0] = f[i][0];
+      fsend[m][1] = f[i][1];
+      fsend[m][2] = f[i][2];
+      m++;
+    }
+
+  // single proc per replica with atom map
+
+  if (cmode == SINGLE_PROC_MAP) {
+    if (nxrequest) MPI_Waitall(nxrequest,xrequest,MPI_STATUSES_IGNORE);
+
+    if (ireplica > 0)
       for (i = 0; i < nebatoms; i++) {
         m = atom->map(tagrecv[i]);
         xprev[m][0] = xrecv[i][0];
         xprev[m][1] = xrecv[i][1];
         xprev[m][2] = xrecv[i][2];
       }
-    }
-    if (ireplica < nreplica-1) {
-      MPI_Irecv(xrecv[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
-      MPI_Irecv(frecv[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
-      MPI_Irecv(tagrecv,nebatoms,MPI_LMP_TAGINT,procnext,0,uworld,&requests[1]);
-    }
-    if (ireplica > 0) {
-      MPI_Send(xsend[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld);
-      MPI_Send(fsend[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld);
-      MPI_Send(tagsend,nebatoms,MPI_LMP_TAGINT,procprev,0,uworld);
-    }
+
+    if (ireplica < nreplica-1)
+      MPI_Irecv(frecv[0],3*nebatoms,MPI_DOUBLE,procnext,TAG_FORCE,uworld,
+                &request);
+    if (ireplica > 0)
+      MPI_Send(fsend[0],3*nebatoms,MPI_DOUBLE,procprev,TAG_FORCE,uworld);
 
     if (ireplica < nreplica-1) {
-      MPI_Waitall(2,requests,statuses);
+      MPI_Wait(&request,MPI_STATUS_IGNORE);
       for (i = 0; i < nebatoms; i++) {
-        m = atom->map(tagrecv[i]);
-        xnext[m][0] = xrecv[i][0];
-        xnext[m][1] = xrecv[i][1];
-        xnext[m][2] = xrecv[i][2];
+        m = atom->map(tagrecvnext[i]);
+        xnext[m][0] = xrecvnext[i][0];
+        xnext[m][1] = xrecvnext[i][1];
+        xnext[m][2] = xrecvnext[i][2];
         fnext[m][0] = frecv[i][0];
         fnext[m][1] = frecv[i][1];
         fnext[m][2] = frecv[i][2];
@@ -753,59 +889,23 @@ void FixNEB::inter_replica_comm()
   }
 
   // multiple procs per replica
-  // MPI_Gather all coords and atom IDs to root proc of each replica
-  // send to root of adjacent replicas
-  // bcast within each replica
+  // MPI_Gather all forces to root proc of each replica
+  // root procs exchange forces, bcast coords and forces within each replica
   // each proc extracts info for atoms it owns via atom->map()
+  // counts,displacements still hold the 3*count values from the coord gather
 
-  m = 0;
-  for (i = 0; i < nlocal; i++)
-    if (mask[i] & groupbit) {
-      tagsend[m] = tag[i];
-      xsend[m][0] = x[i][0];
-      xsend[m][1] = x[i][1];
-      xsend[m][2] = x[i][2];
-      fsend[m][0] = f[i][0];
-      fsend[m][1] = f[i][1];
-      fsend[m][2] = f[i][2];
-      m++;
-    }
-
-  MPI_Gather(&m,1,MPI_INT,counts,1,MPI_INT,0,world);
-  displacements[0] = 0;
-  for (i = 0; i < nprocs-1; i++)
-    displacements[i+1] = displacements[i] + counts[i];
-  MPI_Gatherv(tagsend,m,MPI_LMP_TAGINT,
-              tagsendall,counts,displacements,MPI_LMP_TAGINT,0,world);
-  for (i = 0; i < nprocs; i++) counts[i] *= 3;
-  for (i = 0; i < nprocs-1; i++)
-    displacements[i+1] = displacements[i] + counts[i];
-  if (xsend) {
-    MPI_Gatherv(xsend[0],3*m,MPI_DOUBLE,
-                xsendall[0],counts,displacements,MPI_DOUBLE,0,world);
+  if (fsend)
     MPI_Gatherv(fsend[0],3*m,MPI_DOUBLE,
                 fsendall[0],counts,displacements,MPI_DOUBLE,0,world);
-  } else {
-    MPI_Gatherv(NULL,3*m,MPI_DOUBLE,
-                xsendall[0],counts,displacements,MPI_DOUBLE,0,world);
+  else
     MPI_Gatherv(NULL,3*m,MPI_DOUBLE,
                 fsendall[0],counts,displacements,MPI_DOUBLE,0,world);
-  }
 
-  if (ireplica > 0 && me == 0) {
-    MPI_Irecv(xrecvall[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld,&requests[0]);
-    MPI_Irecv(tagrecvall,nebatoms,MPI_LMP_TAGINT,procprev,0,uworld,
-              &requests[1]);
-  }
-  if (ireplica < nreplica-1 && me == 0) {
-    MPI_Send(xsendall[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld);
-    MPI_Send(tagsendall,nebatoms,MPI_LMP_TAGINT,procnext,0,uworld);
-  }
+  if (me == 0 && nxrequest)
+    MPI_Waitall(nxrequest,xrequest,MPI_STATUSES_IGNORE);
 
   if (ireplica > 0) {
-    if (me == 0) MPI_Waitall(2,requests,statuses);
-
-    MPI_Bcast(tagrecvall,nebatoms,MPI_INT,0,world);
+    MPI_Bcast(tagrecvall,nebatoms,MPI_LMP_TAGINT,0,world);
     MPI_Bcast(xrecvall[0],3*nebatoms,MPI_DOUBLE,0,world);
 
     for (i = 0; i < nebatoms; i++) {
@@ -817,31 +917,25 @@ void FixNEB::inter_replica_comm()
     }
   }
 
-  if (ireplica < nreplica-1 && me == 0) {
-    MPI_Irecv(xrecvall[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
-    MPI_Irecv(frecvall[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
-    MPI_Irecv(tagrecvall,nebatoms,MPI_LMP_TAGINT,procnext,0,uworld,
-              &requests[1]);
-  }
-  if (ireplica > 0 && me == 0) {
-    MPI_Send(xsendall[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld);
-    MPI_Send(fsendall[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld);
-    MPI_Send(tagsendall,nebatoms,MPI_LMP_TAGINT,procprev,0,uworld);
-  }
+  if (ireplica < nreplica-1 && me == 0)
+    MPI_Irecv(frecvall[0],3*nebatoms,MPI_DOUBLE,procnext,TAG_FORCE,uworld,
+              &request);
+  if (ireplica > 0 && me == 0)
+    MPI_Send(fsendall[0],3*nebatoms,MPI_DOUBLE,procprev,TAG_FORCE,uworld);
 
   if (ireplica < nreplica-1) {
-    if (me == 0) MPI_Waitall(2,requests,statuses);
+    if (me == 0) MPI_Wait(&request,MPI_STATUS_IGNORE);
 
-    MPI_Bcast(tagrecvall,nebatoms,MPI_INT,0,world);
-    MPI_Bcast(xrecvall[0],3*nebatoms,MPI_DOUBLE,0,world);
+    MPI_Bcast(tagrecvallnext,nebatoms,MPI_LMP_TAGINT,0,world);
+    MPI_Bcast(xrecvallnext[0],3*nebatoms,MPI_DOUBLE,0,world);
     MPI_Bcast(frecvall[0],3*nebatoms,MPI_DOUBLE,0,world);
 
     for (i = 0; i < nebatoms; i++) {
-      m = atom->map(tagrecvall[i]);
+      m = atom->map(tagrecvallnext[i]);
       if (m < 0 || m >= nlocal) continue;
-      xnext[m][0] = xrecvall[i][0];
-      xnext[m][1] = xrecvall[i][1];
-      xnext[m][2] = xrecvall[i][2];
+      xnext[m][0] = xrecvallnext[i][0];
+      xnext[m][1] = xrecvallnext[i][1];
+      xnext[m][2] = xrecvallnext[i][2];
       fnext[m][0] = frecvall[i][0];
       fnext[m][1] = frecvall[i][1];
       fnext[m][2] = frecvall[i][2];
@@ -883,6 +977,10 @@ void FixNEB::reallocate()
     memory->create(frecv,maxlocal,3,"neb:frecv");
     memory->create(tagsend,maxlocal,"neb:tagsend");
     memory->create(tagrecv,maxlocal,"neb:tagrecv");
+    memory->destroy(xrecvnext);
+    memory->destroy(tagrecvnext);
+    memory->create(xrecvnext,maxlocal,3,"neb:xrecvnext");
+    memory->create(tagrecvnext,maxlocal,"neb:tagrecvnext");
   }
 
   if (NEBLongRange) {
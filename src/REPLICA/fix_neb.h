@@ -34,6 +34,7 @@ class FixNEB : public Fix {
   int setmask();
   void init();
   void min_setup(int);
+  void min_pre_force(int);
   void min_post_force(int);
 
  private:
@@ -60,15 +61,25 @@ class FixNEB : public Fix {
   double **xsend,**xrecv;      // coords to send/recv to/from other replica
   double **fsend,**frecv;      // coords to send/recv to/from other replica
   tagint *tagsend,*tagrecv;    // ditto for atom IDs
+  double **xrecvnext;          // coords recv'd from next replica, needed
+  tagint *tagrecvnext;         //   separately since both directions of the
+                               //   coord exchange are in flight at once
 
                                  // info gathered from all procs in my replica
   double **xsendall,**xrecvall;    // coords to send/recv to/from other replica
   double **fsendall,**frecvall;    // force to send/recv to/from other replica
   tagint *tagsendall,*tagrecvall;  // ditto for atom IDs
+  double **xrecvallnext;           // replica-wide versions of the
+  tagint *tagrecvallnext;          //   next-direction coord recv buffers
 
   int *counts,*displacements;   // used for MPI_Gather
 
-  void inter_replica_comm();
+  int xcomm_posted;            // 1 if nonblocking coord exchange in flight
+  int nxrequest;               // # of outstanding coord exchange requests
+  MPI_Request xrequest[8];     // requests for the posted coord exchange
+
+  void inter_replica_comm_post();
+  void inter_replica_comm_complete();
   void reallocate();
 };
 
@@ -86,6 +86,12 @@ void PRD::command(int narg, char **arg)
 
   options(narg-7,&arg[7]);
 
+  // quench screening is inactive until a quenched reference geometry exists
+
+  screen_flag = (skip_dist > 0.0 || seed_dist > 0.0) ? 1 : 0;
+  screen_valid = 0;
+  nquench = nquench_skip = 0;
+
   // total # of timesteps must be multiple of t_event
 
   if (t_event <= 0) error->universe_all(FLERR,"Invalid t_event in prd command");
@@ -435,6 +441,13 @@ void PRD::command(int narg, char **arg)
               nsteps,atom->natoms);
   }
 
+  if (me == 0 && screen_flag) {
+    char str[128];
+    snprintf(str,128,"Quench screening skipped " BIGINT_FORMAT " of "
+             BIGINT_FORMAT " quenches\n",nquench_skip,nquench);
+    utils::logmesg(lmp,str);
+  }
+
   if (me == 0) utils::logmesg(lmp,"\nPRD done\n");
 
   finish->end(2);
@@ -554,6 +567,62 @@ void PRD::quench()
   bigint ntimestep_hold = update->ntimestep;
   bigint endstep_hold = update->endstep;
 
+  nquench++;
+
+  // displacement screening against last quenched geometry in fix_event
+  // if no atom moved further than skip_dist since the last quench,
+  //   this state still relaxes into the same basin: reinstate the previous
+  //   quenched geometry without minimizing, which makes the subsequent
+  //   event check trivially negative
+  // else reset atoms that moved less than seed_dist onto their previous
+  //   quenched positions, so the minimizer starts from an already
+  //   converged geometry everywhere except where atoms actually moved
+
+  if (screen_flag && screen_valid) {
+    double **x = atom->x;
+    double **xevent = fix_event->array_atom;
+    imageint *image = atom->image;
+    int nlocal = atom->nlocal;
+    double xu[3],dx,dy,dz,rsq;
+
+    double maxsq = 0.0;
+    for (int i = 0; i < nlocal; i++) {
+      domain->unmap(x[i],image[i],xu);
+      dx = xu[0] - xevent[i][0];
+      dy = xu[1] - xevent[i][1];
+      dz = xu[2] - xevent[i][2];
+      rsq = dx*dx + dy*dy + dz*dz;
+      maxsq = MAX(maxsq,rsq);
+    }
+    double maxsq_all;
+    MPI_Allreduce(&maxsq,&maxsq_all,1,MPI_DOUBLE,MPI_MAX,world);
+
+    if (skip_dist > 0.0 && maxsq_all < skip_dist*skip_dist) {
+      fix_event->restore_event();
+      nquench_skip++;
+      return;
+    }
+
+    if (seed_dist > 0.0) {
+      double seedsq = seed_dist*seed_dist;
+      for (int i = 0; i < nlocal; i++) {
+        domain->unmap(x[i],image[i],xu);
+        dx = xu[0] - xevent[i][0];
+        dy = xu[1] - xevent[i][1];
+        dz = xu[2] - xevent[i][2];
+        rsq = dx*dx + dy*dy + dz*dz;
+        if (rsq < seedsq) {
+          x[i][0] = xevent[i][0];
+          x[i][1] = xevent[i][1];
+          x[i][2] = xevent[i][2];
+          image[i] = ((imageint) IMGMAX << IMG2BITS) |
+            ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+          domain->remap(x[i],image[i]);
+        }
+      }
+    }
+  }
+
   // need to change whichflag so that minimize->setup() calling
   // modify->setup() will call fix->min_setup()
 
@@ -724,6 +793,11 @@ void PRD::share_event(int ireplica, int flag, int decrement)
   replicate(ireplica);
   timer->barrier_stop();
   time_comm += timer->get_wall(Timer::TOTAL);
+
+  // all replicas now hold a valid quenched geometry in fix_event,
+  // which subsequent quenches can screen against
+
+  screen_valid = 1;
 }
 
 /* ----------------------------------------------------------------------
@@ -877,6 +951,8 @@ void PRD::options(int narg, char **arg)
   maxeval = 50;
   temp_flag = 0;
   stepmode = 0;
+  skip_dist = 0.0;
+  seed_dist = 0.0;
 
   char *str = (char *) "geom";
   int n = strlen(str) + 1;
@@ -928,6 +1004,14 @@ void PRD::options(int narg, char **arg)
 
       iarg += 3;
 
+    } else if (strcmp(arg[iarg],"screen") == 0) {
+      if (iarg+3 > narg) error->all(FLERR,"Illegal prd command");
+      skip_dist = force->numeric(FLERR,arg[iarg+1]);
+      seed_dist = force->numeric(FLERR,arg[iarg+2]);
+      if (skip_dist < 0.0 || seed_dist < 0.0)
+        error->all(FLERR,"Illegal prd command");
+      iarg += 3;
+
     } else if (strcmp(arg[iarg],"time") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal prd command");
       if (strcmp(arg[iarg+1],"steps") == 0) stepmode = 0;
@@ -42,6 +42,11 @@ class PRD : protected Pointers {
   int quench_reneighbor;
   bigint nbuild,ndanger;
 
+  double skip_dist,seed_dist;   // quench screening displacement thresholds
+  int screen_flag;              // 1 if either screening threshold is set
+  int screen_valid;             // 1 once a quenched reference geometry exists
+  bigint nquench,nquench_skip;  // # of quench calls, # skipped by screening
+
   double time_dephase,time_dynamics,time_quench,time_comm,time_output;
   double time_start;
 
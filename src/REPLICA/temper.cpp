@@ -144,10 +144,12 @@ void Temper::command(int narg, char **arg)
 
   // RNGs for swaps and Boltzmann test
   // warm up Boltzmann RNG
+  // decision stream is identical on all procs so both swap partners can
+  // evaluate the same Boltzmann test without exchanging a decision message
 
   if (seed_swap) ranswap = new RanPark(lmp,seed_swap);
   else ranswap = NULL;
-  ranboltz = new RanPark(lmp,seed_boltz + me_universe);
+  ranboltz = new RanPark(lmp,seed_boltz);
   for (int i = 0; i < 100; i++) ranboltz->uniform();
 
   // world2root[i] = global proc that is root proc of world i
@@ -189,6 +191,17 @@ void Temper::command(int narg, char **arg)
   int i,which,partner,swap,partner_set_temp,partner_world;
   double pe,pe_partner,boltz_factor,new_temp;
 
+  // buffers for the deferred temp-table refresh among root procs
+  // posted with nonblocking sends/recvs after each swap decision and
+  // completed after the next chunk of MD steps has run
+
+  double *rboltz_draw = new double[nworlds];
+  int *world2temp_new = new int[nworlds];
+  MPI_Request *table_req = new MPI_Request[2*(nworlds-1)];
+  int ntable_req = 0;
+  int table_pending = 0;
+  bigint table_step = 0;
+
   if (me_universe == 0 && universe->uscreen)
     fprintf(universe->uscreen,"Setting up tempering ...\n");
 
@@ -207,7 +220,7 @@ void Temper::command(int narg, char **arg)
         fprintf(universe->ulogfile," T%d",i);
       fprintf(universe->ulogfile,"\n");
     }
-    print_status();
+    print_status(update->ntimestep);
   }
 
   timer->init();
@@ -231,6 +244,20 @@ void Temper::command(int narg, char **arg)
       break;
     }
 
+    // complete the temp-table refresh posted after the previous swap,
+    // which has been in flight while the MD steps above were running
+
+    if (table_pending) {
+      if (me == 0) {
+        MPI_Waitall(ntable_req,table_req,MPI_STATUSES_IGNORE);
+        for (i = 0; i < nworlds; i++) world2temp[i] = world2temp_new[i];
+        for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+      }
+      MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+      if (me_universe == 0) print_status(table_step);
+      table_pending = 0;
+    }
+
     // compute PE
     // notify compute it will be called at next swap
 
@@ -262,30 +289,39 @@ void Temper::command(int narg, char **arg)
       partner = world2root[partner_world];
     }
 
+    // all root procs advance the shared decision stream in lockstep,
+    // one draw per set temp, so both partners of any pair can read the
+    // same random number without communicating
+
+    if (me == 0)
+      for (i = 0; i < nworlds; i++) rboltz_draw[i] = ranboltz->uniform();
+
     // swap with a partner, only root procs in each world participate
-    // hi proc sends PE to low proc
-    // lo proc make Boltzmann decision on whether to swap
-    // lo proc communicates decision back to hi proc
+    // partners exchange PE with a nonblocking send/recv pair and then
+    // evaluate the identical Boltzmann test, so no decision round trip
+    // or ordered send/recv protocol holds the faster replica back
 
     swap = 0;
     if (partner != -1) {
-      if (me_universe > partner)
-        MPI_Send(&pe,1,MPI_DOUBLE,partner,0,universe->uworld);
-      else
-        MPI_Recv(&pe_partner,1,MPI_DOUBLE,partner,0,universe->uworld,MPI_STATUS_IGNORE);
-
-      if (me_universe < partner) {
-        boltz_factor = (pe - pe_partner) *
-          (1.0/(boltz*set_temp[my_set_temp]) -
-           1.0/(boltz*set_temp[partner_set_temp]));
-        if (boltz_factor >= 0.0) swap = 1;
-        else if (ranboltz->uniform() < exp(boltz_factor)) swap = 1;
-      }
-
-      if (me_universe < partner)
-        MPI_Send(&swap,1,MPI_INT,partner,0,universe->uworld);
-      else
-        MPI_Recv(&swap,1,MPI_INT,partner,0,universe->uworld,MPI_STATUS_IGNORE);
+      MPI_Request pe_req[2];
+      MPI_Irecv(&pe_partner,1,MPI_DOUBLE,partner,0,universe->uworld,
+                &pe_req[0]);
+      MPI_Isend(&pe,1,MPI_DOUBLE,partner,0,universe->uworld,&pe_req[1]);
+      MPI_Waitall(2,pe_req,MPI_STATUSES_IGNORE);
+
+      // formulate the test from the lower set temp's perspective on
+      // both sides so the two evaluations agree exactly
+
+      int lo_set_temp = MIN(my_set_temp,partner_set_temp);
+      int hi_set_temp = MAX(my_set_temp,partner_set_temp);
+      double pe_lo = (my_set_temp == lo_set_temp) ? pe : pe_partner;
+      double pe_hi = (my_set_temp == lo_set_temp) ? pe_partner : pe;
+
+      boltz_factor = (pe_lo - pe_hi) *
+        (1.0/(boltz*set_temp[lo_set_temp]) -
+         1.0/(boltz*set_temp[hi_set_temp]));
+      if (boltz_factor >= 0.0) swap = 1;
+      else if (rboltz_draw[lo_set_temp] < exp(boltz_factor)) swap = 1;
 
 #ifdef TEMPER_DEBUG
       if (me_universe < partner)
@@ -311,23 +347,44 @@ void Temper::command(int narg, char **arg)
       modify->fix[whichfix]->reset_target(new_temp);
     }
 
-    // update my_set_temp and temp2world on every proc
-    // root procs update their value if swap took place
-    // allgather across root procs
-    // bcast within my world
+    // update my_set_temp, then post the temp-table refresh without
+    // waiting for it: each root proc sends its new my_set_temp to and
+    // receives one from every other root via nonblocking point-to-point,
+    // which completes while the next chunk of MD steps runs
 
     if (swap) my_set_temp = partner_set_temp;
     if (me == 0) {
-      MPI_Allgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots);
-      for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+      ntable_req = 0;
+      world2temp_new[iworld] = my_set_temp;
+      for (i = 0; i < nworlds; i++) {
+        if (i == iworld) continue;
+        MPI_Irecv(&world2temp_new[i],1,MPI_INT,world2root[i],1,
+                  universe->uworld,&table_req[ntable_req++]);
+        MPI_Isend(&my_set_temp,1,MPI_INT,world2root[i],1,
+                  universe->uworld,&table_req[ntable_req++]);
+      }
     }
-    MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+    table_pending = 1;
+    table_step = update->ntimestep;
+  }
 
-    // print out current swap status
+  // complete the last in-flight temp-table refresh and print final status
 
-    if (me_universe == 0) print_status();
+  if (table_pending) {
+    if (me == 0) {
+      MPI_Waitall(ntable_req,table_req,MPI_STATUSES_IGNORE);
+      for (i = 0; i < nworlds; i++) world2temp[i] = world2temp_new[i];
+      for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+    }
+    MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+    if (me_universe == 0) print_status(table_step);
+    table_pending = 0;
   }
 
+  delete [] rboltz_draw;
+  delete [] world2temp_new;
+  delete [] table_req;
+
   timer->barrier_stop();
 
   update->integrate->cleanup();
@@ -362,16 +419,16 @@ void Temper::scale_velocities(int t_partner, int t_me)
    proc 0 prints current tempering status
 ------------------------------------------------------------------------- */
 
-void Temper::print_status()
+void Temper::print_status(bigint step)
 {
   if (universe->uscreen) {
-    fprintf(universe->uscreen,BIGINT_FORMAT,update->ntimestep);
+    fprintf(universe->uscreen,BIGINT_FORMAT,step);
     for (int i = 0; i < nworlds; i++)
       fprintf(universe->uscreen," %d",world2temp[i]);
     fprintf(universe->uscreen,"\n");
   }
   if (universe->ulogfile) {
-    fprintf(universe->ulogfile,BIGINT_FORMAT,update->ntimestep);
+    fprintf(universe->ulogfile,BIGINT_FORMAT,step);
     for (int i = 0; i < nworlds; i++)
       fprintf(universe->ulogfile," %d",world2temp[i]);
     fprintf(universe->ulogfile,"\n");
@@ -50,7 +50,7 @@ class Temper : protected Pointers {
   int *world2root;             // world2root[i] = root proc of world i
 
   void scale_velocities(int, int);
-  void print_status();
+  void print_status(bigint);
 };
 
 }
@@ -16,6 +16,7 @@
 ------------------------------------------------------------------------- */
 
 #include "verlet_split.h"
+#include <cstring>
 #include "universe.h"
 #include "neighbor.h"
 #include "domain.h"
@@ -39,6 +40,10 @@
 
 using namespace LAMMPS_NS;
 
+#define BUFFACTOR 1.5
+#define BUFMIN 1000
+#define SPLIT_EPS 1.0e-10
+
 /* ---------------------------------------------------------------------- */
 
 VerletSplit::VerletSplit(LAMMPS *lmp, int narg, char **arg) :
@@ -48,9 +53,6 @@ VerletSplit::VerletSplit(LAMMPS *lmp, int narg, char **arg) :
 
   if (universe->nworlds != 2)
     error->universe_all(FLERR,"Verlet/split requires 2 partitions");
-  if (universe->procs_per_world[0] % universe->procs_per_world[1])
-    error->universe_all(FLERR,"Verlet/split requires Rspace partition "
-                        "size be multiple of Kspace partition size");
   if (comm->style != 0)
     error->universe_all(FLERR,"Verlet/split can only currently be used with "
                         "comm_style brick");
@@ -60,8 +62,6 @@ VerletSplit::VerletSplit(LAMMPS *lmp, int narg, char **arg) :
   if (universe->iworld == 0) master = 1;
   else master = 0;
 
-  ratio = universe->procs_per_world[0] / universe->procs_per_world[1];
-
   // Kspace root proc broadcasts info about Kspace proc layout to Rspace procs
 
   int kspace_procgrid[3];
@@ -88,23 +88,33 @@ VerletSplit::VerletSplit(LAMMPS *lmp, int narg, char **arg) :
             kspace_procgrid[0]*kspace_procgrid[1]*kspace_procgrid[2],MPI_INT,
             universe->root_proc[1],universe->uworld);
 
-  // Rspace partition must be multiple of Kspace partition in each dim
-  // so atoms of one Kspace proc coincide with atoms of several Rspace procs
+  // Kspace root proc broadcasts its split fractions so Rspace procs
+  // can locate their sub-domain within the Kspace decomposition
 
-  if (master) {
-    int flag = 0;
-    if (comm->procgrid[0] % kspace_procgrid[0]) flag = 1;
-    if (comm->procgrid[1] % kspace_procgrid[1]) flag = 1;
-    if (comm->procgrid[2] % kspace_procgrid[2]) flag = 1;
-    if (flag)
-      error->one(FLERR,
-                 "Verlet/split requires Rspace partition layout be "
-                 "multiple of Kspace partition layout in each dim");
+  double *ksplitx = new double[kspace_procgrid[0]+1];
+  double *ksplity = new double[kspace_procgrid[1]+1];
+  double *ksplitz = new double[kspace_procgrid[2]+1];
+
+  if (universe->me == universe->root_proc[1]) {
+    memcpy(ksplitx,comm->xsplit,(kspace_procgrid[0]+1)*sizeof(double));
+    memcpy(ksplity,comm->ysplit,(kspace_procgrid[1]+1)*sizeof(double));
+    memcpy(ksplitz,comm->zsplit,(kspace_procgrid[2]+1)*sizeof(double));
   }
+  MPI_Bcast(ksplitx,kspace_procgrid[0]+1,MPI_DOUBLE,
+            universe->root_proc[1],universe->uworld);
+  MPI_Bcast(ksplity,kspace_procgrid[1]+1,MPI_DOUBLE,
+            universe->root_proc[1],universe->uworld);
+  MPI_Bcast(ksplitz,kspace_procgrid[2]+1,MPI_DOUBLE,
+            universe->root_proc[1],universe->uworld);
+
+  // each Rspace proc sub-domain must lie within one Kspace proc sub-domain
+  // so atoms of one Kspace proc coincide with atoms of a set of Rspace procs
+  // checked against the actual split fractions, not grid-index arithmetic,
+  // so unequal ratios are allowed as long as the sub-domains nest
 
   // block = 1 Kspace proc with set of Rspace procs it overlays
   // me_block = 0 for Kspace proc
-  // me_block = 1 to ratio for Rspace procs
+  // me_block = 1 to nblock for Rspace procs, nblock can differ per block
   // block = MPI communicator for that set of procs
 
   int iblock,key;
@@ -113,68 +123,95 @@ VerletSplit::VerletSplit(LAMMPS *lmp, int narg, char **arg) :
     iblock = comm->me;
     key = 0;
   } else {
-    int kpx = comm->myloc[0] / (comm->procgrid[0]/kspace_procgrid[0]);
-    int kpy = comm->myloc[1] / (comm->procgrid[1]/kspace_procgrid[1]);
-    int kpz = comm->myloc[2] / (comm->procgrid[2]/kspace_procgrid[2]);
-    iblock = kspace_grid2proc[kpx][kpy][kpz];
+    int kloc[3];
+    double *ksplit[3] = {ksplitx,ksplity,ksplitz};
+    for (int dim = 0; dim < 3; dim++) {
+      kloc[dim] = -1;
+      for (int i = 0; i < kspace_procgrid[dim]; i++)
+        if (comm->mysplit[dim][0] >= ksplit[dim][i] - SPLIT_EPS &&
+            comm->mysplit[dim][1] <= ksplit[dim][i+1] + SPLIT_EPS) {
+          kloc[dim] = i;
+          break;
+        }
+      if (kloc[dim] < 0)
+        error->one(FLERR,
+                   "Verlet/split requires each Rspace proc sub-domain "
+                   "be contained in one Kspace proc sub-domain");
+    }
+    iblock = kspace_grid2proc[kloc[0]][kloc[1]][kloc[2]];
     key = 1;
   }
 
+  delete [] ksplitx;
+  delete [] ksplity;
+  delete [] ksplitz;
+
   MPI_Comm_split(universe->uworld,iblock,key,&block);
   MPI_Comm_rank(block,&me_block);
 
+  int bsize;
+  MPI_Comm_size(block,&bsize);
+  nblock = bsize - 1;
+
   // output block groupings to universe screen/logfile
   // bmap is ordered by block and then by proc within block
+  // blocks can have different sizes, so stride by the largest block
+
+  int nblocks = universe->procs_per_world[1];
+  int maxblock;
+  MPI_Allreduce(&bsize,&maxblock,1,MPI_INT,MPI_MAX,universe->uworld);
 
-  int *bmap = new int[universe->nprocs];
-  for (int i = 0; i < universe->nprocs; i++) bmap[i] = -1;
-  bmap[iblock*(ratio+1)+me_block] = universe->me;
+  int *bmap = new int[nblocks*maxblock];
+  for (int i = 0; i < nblocks*maxblock; i++) bmap[i] = -1;
+  bmap[iblock*maxblock+me_block] = universe->me;
 
-  int *bmapall = new int[universe->nprocs];
-  MPI_Allreduce(bmap,bmapall,universe->nprocs,MPI_INT,MPI_MAX,universe->uworld);
+  int *bmapall = new int[nblocks*maxblock];
+  MPI_Allreduce(bmap,bmapall,nblocks*maxblock,MPI_INT,MPI_MAX,
+                universe->uworld);
 
   if (universe->me == 0) {
     if (universe->uscreen) {
       fprintf(universe->uscreen,
               "Per-block Rspace/Kspace proc IDs (original proc IDs):\n");
-      int m = 0;
-      for (int i = 0; i < universe->nprocs/(ratio+1); i++) {
+      for (int i = 0; i < nblocks; i++) {
         fprintf(universe->uscreen,"  block %d:",i);
-        int kspace_proc = bmapall[m];
-        for (int j = 1; j <= ratio; j++)
-          fprintf(universe->uscreen," %d",bmapall[m+j]);
+        int kspace_proc = bmapall[i*maxblock];
+        for (int j = 1; j < maxblock; j++)
+          if (bmapall[i*maxblock+j] >= 0)
+            fprintf(universe->uscreen," %d",bmapall[i*maxblock+j]);
         fprintf(universe->uscreen," %d",kspace_proc);
-        kspace_proc = bmapall[m];
-        for (int j = 1; j <= ratio; j++) {
-          if (j == 1) fprintf(universe->uscreen," (");
+        int first = 1;
+        for (int j = 1; j < maxblock; j++) {
+          if (bmapall[i*maxblock+j] < 0) continue;
+          if (first) fprintf(universe->uscreen," (");
           else fprintf(universe->uscreen," ");
+          first = 0;
           fprintf(universe->uscreen,"%d",
-                  universe->uni2orig[bmapall[m+j]]);
+                  universe->uni2orig[bmapall[i*maxblock+j]]);
         }
         fprintf(universe->uscreen," %d)\n",universe->uni2orig[kspace_proc]);
-        m += ratio + 1;
       }
     }
     if (universe->ulogfile) {
       fprintf(universe->ulogfile,
               "Per-block Rspace/Kspace proc IDs (original proc IDs):\n");
-      int m = 0;
-      for (int i = 0; i < universe->nprocs/(ratio+1); i++) {
+      for (int i = 0; i < nblocks; i++) {
         fprintf(universe->ulogfile,"  block %d:",i);
-        int kspace_proc = bmapall[m];
-        for (int j = 1; j <= ratio; j++)
-          fprintf(universe->ulogfile," %d",bmapall[m+j]);
-
+        int kspace_proc = bmapall[i*maxblock];
+        for (int j = 1; j < maxblock; j++)
+          if (bmapall[i*maxblock+j] >= 0)
+            fprintf(universe->ulogfile," %d",bmapall[i*maxblock+j]);
         fprintf(universe->ulogfile," %d",kspace_proc);
-        kspace_proc = bmapall[m];
-        for (int j = 1; j <= ratio; j++) {
-          if (j == 1) fprintf(universe->ulogfile," (");
+        int first = 1;
+        for (int j = 1; j < maxblock; j++) {
+          if (bmapall[i*maxblock+j] < 0) continue;
+          if (first) fprintf(universe->ulogfile," (");
           else fprintf(universe->ulogfile," ");
+          first = 0;
           fprintf(universe->ulogfile,"%d",
-                  universe->uni2orig[bmapall[m+j]]);
+                  universe->uni2orig[bmapall[i*maxblock+j]]);
         }
         fprintf(universe->ulogfile," %d)\n",universe->uni2orig[kspace_proc]);
-        m += ratio + 1;
       }
     }
   }
@@ -185,10 +222,26 @@ VerletSplit::VerletSplit(LAMMPS *lmp, int narg, char **arg) :
 
   // size/disp = vectors for MPI gather/scatter within block
 
-  qsize = new int[ratio+1];
-  qdisp = new int[ratio+1];
-  xsize = new int[ratio+1];
-  xdisp = new int[ratio+1];
+  qsize = new int[nblock+1];
+  qdisp = new int[nblock+1];
+  xsize = new int[nblock+1];
+  xdisp = new int[nblock+1];
+
+  // if all procs of my block share one node, hand off x/f blocks
+  // through a shared-memory window instead of MPI messages
+
+  MPI_Comm nodecomm;
+  int nodesize;
+  MPI_Comm_split_type(block,MPI_COMM_TYPE_SHARED,me_block,
+                      MPI_INFO_NULL,&nodecomm);
+  MPI_Comm_size(nodecomm,&nodesize);
+  shmflag = (nodesize == bsize);
+  MPI_Comm_free(&nodecomm);
+
+  shmwin = MPI_WIN_NULL;
+  shmbuf = NULL;
+  maxshm = 0;
+  myxdisp = 0;
 
   // f_kspace = Rspace copy of Kspace forces
   // allocate dummy version for Kspace partition
@@ -207,6 +260,10 @@ VerletSplit::~VerletSplit()
   delete [] xsize;
   delete [] xdisp;
   memory->destroy(f_kspace);
+  if (shmwin != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(shmwin);
+    MPI_Win_free(&shmwin);
+  }
   MPI_Comm_free(&block);
 }
 
@@ -441,8 +498,9 @@ void VerletSplit::run(int n)
 void VerletSplit::rk_setup()
 {
   // grow f_kspace array on master procs if necessary
+  // not needed for shared-memory handoff, forces are read in place
 
-  if (master) {
+  if (master && !shmflag) {
     if (atom->nmax > maxatom) {
       memory->destroy(f_kspace);
       maxatom = atom->nmax;
@@ -463,17 +521,49 @@ void VerletSplit::rk_setup()
 
   if (!master) {
     qsize[0] = qdisp[0] = xsize[0] = xdisp[0] = 0;
-    for (int i = 1; i <= ratio; i++) {
+    for (int i = 1; i <= nblock; i++) {
       qdisp[i] = qdisp[i-1]+qsize[i-1];
       xsize[i] = 3*qsize[i];
       xdisp[i] = xdisp[i-1]+xsize[i-1];
     }
 
-    atom->nlocal = qdisp[ratio] + qsize[ratio];
+    atom->nlocal = qdisp[nblock] + qsize[nblock];
     while (atom->nmax <= atom->nlocal) atom->avec->grow(0);
     atom->nghost = 0;
   }
 
+  // setup shared-memory window for the x/f handoff
+  // only the Kspace proc owns a segment, sized for all atoms of the block
+  // Rspace procs learn where their block of it starts
+  // window ops are collective over the block and all procs reach
+  // rk_setup() together after each reneighbor
+
+  if (shmflag) {
+    MPI_Scatter(xdisp,1,MPI_INT,&myxdisp,1,MPI_INT,0,block);
+
+    int need = 0;
+    if (!master) need = 3*atom->nlocal;
+    MPI_Bcast(&need,1,MPI_INT,0,block);
+
+    if (need > maxshm) {
+      if (shmwin != MPI_WIN_NULL) {
+        MPI_Win_unlock_all(shmwin);
+        MPI_Win_free(&shmwin);
+      }
+      maxshm = MAX(static_cast<int> (BUFFACTOR*need),BUFMIN);
+      MPI_Aint mysize = 0;
+      if (!master) mysize = (MPI_Aint) maxshm*sizeof(double);
+      MPI_Win_allocate_shared(mysize,sizeof(double),MPI_INFO_NULL,block,
+                              &shmbuf,&shmwin);
+      MPI_Win_lock_all(MPI_MODE_NOCHECK,shmwin);
+      if (master) {
+        MPI_Aint winsize;
+        int dispunit;
+        MPI_Win_shared_query(shmwin,0,&winsize,&dispunit,&shmbuf);
+      }
+    }
+  }
+
   // one-time gather of Rspace atom charges to Kspace proc
 
   MPI_Gatherv(atom->q,n,MPI_DOUBLE,atom->q,qsize,qdisp,MPI_DOUBLE,0,block);
@@ -512,8 +602,23 @@ void VerletSplit::r2k_comm()
 {
   int n = 0;
   if (master) n = atom->nlocal;
-  MPI_Gatherv(atom->x[0],n*3,MPI_DOUBLE,atom->x[0],xsize,xdisp,
-              MPI_DOUBLE,0,block);
+
+  // shared-memory handoff: Rspace procs store their coord blocks
+  // directly into the Kspace proc's window segment
+  // Win_sync before/after the barrier pairs the memory barriers
+  // between writers and reader
+
+  if (shmflag) {
+    if (master && n)
+      memcpy(&shmbuf[myxdisp],atom->x[0],3*n*sizeof(double));
+    MPI_Win_sync(shmwin);
+    MPI_Barrier(block);
+    MPI_Win_sync(shmwin);
+    if (!master && atom->nlocal)
+      memcpy(atom->x[0],shmbuf,3*atom->nlocal*sizeof(double));
+  } else
+    MPI_Gatherv(atom->x[0],n*3,MPI_DOUBLE,atom->x[0],xsize,xdisp,
+                MPI_DOUBLE,0,block);
 
   // send eflag,vflag from Rspace to Kspace
 
@@ -562,6 +667,30 @@ void VerletSplit::k2r_comm()
 
   int n = 0;
   if (master) n = atom->nlocal;
+
+  // shared-memory handoff: Kspace proc stores its forces into the
+  // window, Rspace procs sum their block from it in place
+  // safe to reuse the window for both x and f within one step since
+  // the Kspace proc only writes f after the coord barrier in r2k_comm()
+
+  if (shmflag) {
+    if (!master && atom->nlocal)
+      memcpy(shmbuf,atom->f[0],3*atom->nlocal*sizeof(double));
+    MPI_Win_sync(shmwin);
+    MPI_Barrier(block);
+    MPI_Win_sync(shmwin);
+    if (master) {
+      double **f = atom->f;
+      double *fk = &shmbuf[myxdisp];
+      for (int i = 0; i < n; i++) {
+        f[i][0] += fk[3*i];
+        f[i][1] += fk[3*i+1];
+        f[i][2] += fk[3*i+2];
+      }
+    }
+    return;
+  }
+
   MPI_Scatterv(atom->f[0],xsize,xdisp,MPI_DOUBLE,
                f_kspace[0],n*3,MPI_DOUBLE,0,block);
 
@@ -583,5 +712,6 @@ void VerletSplit::k2r_comm()
 bigint VerletSplit::memory_usage()
 {
   bigint bytes = maxatom*3 * sizeof(double);
+  bytes += (bigint) maxshm * sizeof(double);
   return bytes;
 }
@@ -37,7 +37,7 @@ class VerletSplit : public Verlet {
  private:
   int master;                        // 1 if an Rspace proc, 0 if Kspace
   int me_block;                      // proc ID within Rspace/Kspace block
-  int ratio;                         // ratio of Rspace procs to Kspace procs
+  int nblock;                        // # of Rspace procs in my block
   int *qsize,*qdisp,*xsize,*xdisp;   // MPI gather/scatter params for block comm
   MPI_Comm block;                    // communicator within one block
   int tip4p_flag;                    // 1 if PPPM/tip4p so do extra comm
@@ -45,6 +45,12 @@ class VerletSplit : public Verlet {
   double **f_kspace;                 // copy of Kspace forces on Rspace procs
   int maxatom;
 
+  int shmflag;                       // 1 if my block is all on one node
+  MPI_Win shmwin;                    // shared window for x/f handoff
+  double *shmbuf;                    // base of Kspace proc's window segment
+  int maxshm;                        // # of doubles window is sized for
+  int myxdisp;                       // where my x/f block starts in shmbuf
+
   void rk_setup();
   void r2k_comm();
   void k2r_comm();
@@ -61,18 +67,15 @@ E: Verlet/split requires 2 partitions
 
 See the -partition command-line switch.
 
-E: Verlet/split requires Rspace partition size be multiple of Kspace partition size
-
-This is so there is an equal number of Rspace processors for every
-Kspace processor.
-
 E: Verlet/split can only currently be used with comm_style brick
 
 This is a current restriction in LAMMPS.
 
-E: Verlet/split requires Rspace partition layout be multiple of Kspace partition layout in each dim
+E: Verlet/split requires each Rspace proc sub-domain be contained in one Kspace proc sub-domain
 
-This is controlled by the processors command.
+The sub-domains of the two partitions must nest so every Rspace proc
+can hand its atoms to a single Kspace proc.  This is controlled by the
+processors command.
 
 W: No Kspace calculation with verlet/split
 
@@ -913,10 +913,15 @@ void FixRigidSmall::compute_forces_and_torques()
   double **f = atom->f;
   int nlocal = atom->nlocal;
 
+  int xbox,ybox,zbox;
   double dx,dy,dz;
-  double unwrap[3];
   double *xcm,*fcm,*tcm;
 
+  double *h = domain->h;
+  double xprd = domain->xprd;
+  double yprd = domain->yprd;
+  double zprd = domain->zprd;
+
   for (ibody = 0; ibody < nlocal_body+nghost_body; ibody++) {
     fcm = body[ibody].fcm;
     fcm[0] = fcm[1] = fcm[2] = 0.0;
@@ -924,6 +929,8 @@ void FixRigidSmall::compute_forces_and_torques()
     tcm[0] = tcm[1] = tcm[2] = 0.0;
   }
 
+  // unmap atom coords inline, as in set_xv(), to avoid a per-atom call
+
   for (i = 0; i < nlocal; i++) {
     if (atom2body[i] < 0) continue;
     Body *b = &body[atom2body[i]];
@@ -933,11 +940,20 @@ void FixRigidSmall::compute_forces_and_torques()
     fcm[1] += f[i][1];
     fcm[2] += f[i][2];
 
-    domain->unmap(x[i],xcmimage[i],unwrap);
+    xbox = (xcmimage[i] & IMGMASK) - IMGMAX;
+    ybox = (xcmimage[i] >> IMGBITS & IMGMASK) - IMGMAX;
+    zbox = (xcmimage[i] >> IMG2BITS) - IMGMAX;
+
     xcm = b->xcm;
-    dx = unwrap[0] - xcm[0];
-    dy = unwrap[1] - xcm[1];
-    dz = unwrap[2] - xcm[2];
+    if (triclinic == 0) {
+      dx = x[i][0] + xbox*xprd - xcm[0];
+      dy = x[i][1] + ybox*yprd - xcm[1];
+      dz = x[i][2] + zbox*zprd - xcm[2];
+    } else {
+      dx = x[i][0] + h[0]*xbox + h[5]*ybox + h[4]*zbox - xcm[0];
+      dy = x[i][1] + h[1]*ybox + h[3]*zbox - xcm[1];
+      dz = x[i][2] + h[2]*zbox - xcm[2];
+    }
 
     tcm = b->torque;
     tcm[0] += dy*f[i][2] - dz*f[i][1];
@@ -234,6 +234,7 @@ FixShake::FixShake(LAMMPS *lmp, int narg, char **arg) :
 
   maxlist = 0;
   list = NULL;
+  listtmp = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -306,6 +307,7 @@ FixShake::~FixShake()
   }
 
   memory->destroy(list);
+  memory->destroy(listtmp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -510,11 +512,18 @@ void FixShake::pre_neighbor()
     maxlist = nlocal;
     memory->destroy(list);
     memory->create(list,maxlist,"shake:list");
+    memory->destroy(listtmp);
+    memory->create(listtmp,maxlist,"shake:listtmp");
   }
 
   // build list of SHAKE clusters I compute
+  // count clusters of each topology for grouping below
 
   nlist = 0;
+  int n1 = 0;
+  int n2 = 0;
+  int n3 = 0;
+  int n4 = 0;
 
   for (int i = 0; i < nlocal; i++)
     if (shake_flag[i]) {
@@ -525,7 +534,10 @@ void FixShake::pre_neighbor()
           error->one(FLERR,fmt::format("Shake atoms {} {} missing on proc "
                                        "{} at step {}",shake_atom[i][0],
                                        shake_atom[i][1],me,update->ntimestep));
-        if (i <= atom1 && i <= atom2) list[nlist++] = i;
+        if (i <= atom1 && i <= atom2) {
+          list[nlist++] = i;
+          n2++;
+        }
       } else if (shake_flag[i] % 2 == 1) {
         atom1 = atom->map(shake_atom[i][0]);
         atom2 = atom->map(shake_atom[i][1]);
@@ -535,7 +547,11 @@ void FixShake::pre_neighbor()
                                        "{} at step {}",shake_atom[i][0],
                                        shake_atom[i][1],shake_atom[i][2],
                                        me,update->ntimestep));
-        if (i <= atom1 && i <= atom2 && i <= atom3) list[nlist++] = i;
+        if (i <= atom1 && i <= atom2 && i <= atom3) {
+          list[nlist++] = i;
+          if (shake_flag[i] == 3) n3++;
+          else n1++;
+        }
       } else {
         atom1 = atom->map(shake_atom[i][0]);
         atom2 = atom->map(shake_atom[i][1]);
@@ -546,10 +562,36 @@ void FixShake::pre_neighbor()
                                        "proc {} at step {}",shake_atom[i][0],
                                        shake_atom[i][1],shake_atom[i][2],
                                        shake_atom[i][3],me,update->ntimestep));
-        if (i <= atom1 && i <= atom2 && i <= atom3 && i <= atom4)
+        if (i <= atom1 && i <= atom2 && i <= atom3 && i <= atom4) {
           list[nlist++] = i;
+          n4++;
+        }
       }
     }
+
+  // reorder list so clusters with the same topology are contiguous
+  // post_force() then solves each topology class in its own tight loop
+
+  int i2 = 0;
+  int i3 = n2;
+  int i4 = n2 + n3;
+  int i1 = n2 + n3 + n4;
+
+  for (int i = 0; i < nlist; i++) {
+    int m = list[i];
+    if (shake_flag[m] == 2) listtmp[i2++] = m;
+    else if (shake_flag[m] == 3) listtmp[i3++] = m;
+    else if (shake_flag[m] == 4) listtmp[i4++] = m;
+    else listtmp[i1++] = m;
+  }
+
+  int *tmp = list;
+  list = listtmp;
+  listtmp = tmp;
+
+  nlist2 = n2;
+  nlist3 = n2 + n3;
+  nlist4 = n2 + n3 + n4;
 }
 
 /* ----------------------------------------------------------------------
@@ -572,15 +614,13 @@ void FixShake::post_force(int vflag)
   else evflag = 0;
 
   // loop over clusters to add constraint forces
+  // list is grouped by topology, so each class gets its own loop
 
-  int m;
-  for (int i = 0; i < nlist; i++) {
-    m = list[i];
-    if (shake_flag[m] == 2) shake(m);
-    else if (shake_flag[m] == 3) shake3(m);
-    else if (shake_flag[m] == 4) shake4(m);
-    else shake3angle(m);
-  }
+  int i = 0;
+  for (; i < nlist2; i++) shake(list[i]);
+  for (; i < nlist3; i++) shake3(list[i]);
+  for (; i < nlist4; i++) shake4(list[i]);
+  for (; i < nlist; i++) shake3angle(list[i]);
 
   // store vflag for coordinate_constraints_end_of_step()
 
@@ -620,15 +660,13 @@ void FixShake::post_force_respa(int vflag, int ilevel, int iloop)
   else evflag = 0;
 
   // loop over clusters to add constraint forces
+  // list is grouped by topology, so each class gets its own loop
 
-  int m;
-  for (int i = 0; i < nlist; i++) {
-    m = list[i];
-    if (shake_flag[m] == 2) shake(m);
-    else if (shake_flag[m] == 3) shake3(m);
-    else if (shake_flag[m] == 4) shake4(m);
-    else shake3angle(m);
-  }
+  int i = 0;
+  for (; i < nlist2; i++) shake(list[i]);
+  for (; i < nlist3; i++) shake3(list[i]);
+  for (; i < nlist4; i++) shake4(list[i]);
+  for (; i < nlist; i++) shake3angle(list[i]);
 
   // store vflag for coordinate_constraints_end_of_step()
   vflag_post_force = vflag;
@@ -106,6 +106,8 @@ class FixShake : public Fix {
 
   int *list;                            // list of clusters to SHAKE
   int nlist,maxlist;                    // size and max-size of list
+  int nlist2,nlist3,nlist4;             // ends of topology sections in list
+  int *listtmp;                         // scratch for grouping list
 
                                         // stat quantities
   int *b_count,*b_count_all;            // counts for each bond type
@@ -1054,11 +1054,13 @@ void SNA::compute_uarray(double x, double y, double z,
     // fill in left side of matrix layer from previous layer
 
     for (int mb = 0; 2*mb <= j; mb++) {
+      const double* rootpq_mb = rootpqarray_mb[j - mb];
+
       ulist_r[jju] = 0.0;
       ulist_i[jju] = 0.0;
 
       for (int ma = 0; ma < j; ma++) {
-        rootpq = rootpqarray[j - ma][j - mb];
+        rootpq = rootpq_mb[j - ma];
         ulist_r[jju] +=
           rootpq *
           (a_r * ulist_r[jjup] +
@@ -1068,7 +1070,7 @@ void SNA::compute_uarray(double x, double y, double z,
           (a_r * ulist_i[jjup] -
            a_i * ulist_r[jjup]);
 
-        rootpq = rootpqarray[ma + 1][j - mb];
+        rootpq = rootpq_mb[ma + 1];
         ulist_r[jju+1] =
           -rootpq *
           (b_r * ulist_r[jjup] +
@@ -1173,6 +1175,8 @@ void SNA::compute_duarray(double x, double y, double z,
     int jju = idxu_block[j];
     int jjup = idxu_block[j-1];
     for (int mb = 0; 2*mb <= j; mb++) {
+      const double* rootpq_mb = rootpqarray_mb[j - mb];
+
       dulist_r[jju][0] = 0.0;
       dulist_r[jju][1] = 0.0;
       dulist_r[jju][2] = 0.0;
@@ -1181,7 +1185,7 @@ void SNA::compute_duarray(double x, double y, double z,
       dulist_i[jju][2] = 0.0;
 
       for (int ma = 0; ma < j; ma++) {
-        rootpq = rootpqarray[j - ma][j - mb];
+        rootpq = rootpq_mb[j - ma];
         for (int k = 0; k < 3; k++) {
           dulist_r[jju][k] +=
             rootpq * (da_r[k] * ulist_r[jjup] +
@@ -1195,7 +1199,7 @@ void SNA::compute_duarray(double x, double y, double z,
                       a_i * dulist_r[jjup][k]);
         }
 
-        rootpq = rootpqarray[ma + 1][j - mb];
+        rootpq = rootpq_mb[ma + 1];
         for (int k = 0; k < 3; k++) {
           dulist_r[jju+1][k] =
             -rootpq * (db_r[k] * ulist_r[jjup] +
@@ -1280,7 +1284,7 @@ double SNA::memory_usage()
 
   bytes = 0;
 
-  bytes += jdimpq*jdimpq * sizeof(double);               // pqarray
+  bytes += 2*jdimpq*jdimpq * sizeof(double);             // pqarray + transpose
   bytes += idxcg_max * sizeof(double);                   // cglist
 
   bytes += nmax * idxu_max * sizeof(double) * 2;         // ulist_ij
@@ -1317,6 +1321,8 @@ void SNA::create_twojmax_arrays()
   int jdimpq = twojmax + 2;
   memory->create(rootpqarray, jdimpq, jdimpq,
                  "sna:rootpqarray");
+  memory->create(rootpqarray_mb, jdimpq, jdimpq,
+                 "sna:rootpqarray_mb");
   memory->create(cglist, idxcg_max, "sna:cglist");
   memory->create(ulisttot_r, idxu_max*nelements, "sna:ulisttot");
   memory->create(ulisttot_i, idxu_max*nelements, "sna:ulisttot");
@@ -1341,6 +1347,7 @@ void SNA::create_twojmax_arrays()
 void SNA::destroy_twojmax_arrays()
 {
   memory->destroy(rootpqarray);
+  memory->destroy(rootpqarray_mb);
   memory->destroy(cglist);
   memory->destroy(ulisttot_r);
   memory->destroy(ulisttot_i);
@@ -1672,8 +1679,10 @@ void SNA::print_clebsch_gordan()
 void SNA::init_rootpqarray()
 {
   for (int p = 1; p <= twojmax; p++)
-    for (int q = 1; q <= twojmax; q++)
+    for (int q = 1; q <= twojmax; q++) {
       rootpqarray[p][q] = sqrt(static_cast<double>(p)/q);
+      rootpqarray_mb[q][p] = rootpqarray[p][q];
+    }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -85,6 +85,9 @@ private:
   SNA_BINDICES* idxb;
 
   double** rootpqarray;
+  double** rootpqarray_mb;   // transpose of rootpqarray, so the recursion
+                             // in compute_uarray()/compute_duarray() reads
+                             // one contiguous row per mb
   double* cglist;
   int*** idxcg_block;
 
@@ -34,6 +34,9 @@
 #include "force.h"
 #include "memory.h"
 #include "modify.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "neigh_request.h"
 #include "pair_spin.h"
 #include "update.h"
 
@@ -62,7 +65,7 @@ FixNVESpin::FixNVESpin(LAMMPS *lmp, int narg, char **arg) :
   Fix(lmp, narg, arg),
   pair(NULL), spin_pairs(NULL),
   rsec(NULL), stack_head(NULL), stack_foot(NULL),
-  backward_stacks(NULL), forward_stacks(NULL)
+  backward_stacks(NULL), forward_stacks(NULL), list(NULL), color(NULL)
 {
   if (lmp->citeme) lmp->citeme->add(cite_fix_nve_spin);
 
@@ -74,6 +77,11 @@ FixNVESpin::FixNVESpin(LAMMPS *lmp, int narg, char **arg) :
   nlocal_max = 0;
   npairs = 0;
   npairspin = 0;
+  ncolors = 1;
+
+  // ghost spins are refreshed between sweeps with a fix forward comm
+
+  comm_forward = 3;
 
   // checking if map array or hash is defined
 
@@ -137,6 +145,7 @@ FixNVESpin::~FixNVESpin()
   memory->destroy(stack_foot);
   memory->destroy(forward_stacks);
   memory->destroy(backward_stacks);
+  memory->destroy(color);
   delete [] spin_pairs;
 }
 
@@ -146,7 +155,7 @@ int FixNVESpin::setmask()
 {
   int mask = 0;
   mask |= INITIAL_INTEGRATE;
-  mask |= PRE_NEIGHBOR;
+  mask |= POST_NEIGHBOR;
   mask |= FINAL_INTEGRATE;
   return mask;
 }
@@ -264,6 +273,24 @@ void FixNVESpin::init()
   memory->grow(stack_foot,nsectors,"NVE/spin:stack_foot");
   memory->grow(backward_stacks,nlocal_max,"NVE/spin:backward_stacks");
   memory->grow(forward_stacks,nlocal_max,"NVE/spin:forward_stacks");
+  memory->grow(color,nlocal_max,"NVE/spin:color");
+
+  // full neighbor list to color the local spins (sectoring)
+
+  if (sector_flag) {
+    int irequest = neighbor->request(this,instance_me);
+    neighbor->requests[irequest]->pair = 0;
+    neighbor->requests[irequest]->fix = 1;
+    neighbor->requests[irequest]->half = 0;
+    neighbor->requests[irequest]->full = 1;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixNVESpin::init_list(int /*id*/, NeighList *ptr)
+{
+  list = ptr;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -300,7 +327,7 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
 
   if (sector_flag) {                            // sectoring seq. update
     for (int j = 0; j < nsectors; j++) {        // advance quarter s for nlocal
-      comm->forward_comm();
+      comm->forward_comm_fix(this);             // comm. ghost spins only
       int i = stack_foot[j];
       while (i >= 0) {
         if (mask[i] & groupbit) {
@@ -311,7 +338,7 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
       }
     }
     for (int j = nsectors-1; j >= 0; j--) {     // advance quarter s for nlocal
-      comm->forward_comm();
+      comm->forward_comm_fix(this);             // comm. ghost spins only
       int i = stack_head[j];
       while (i >= 0) {
         if (mask[i] & groupbit) {
@@ -322,7 +349,7 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
       }
     }
   } else if (sector_flag == 0) {                // serial seq. update
-    comm->forward_comm();                       // comm. positions of ghost atoms
+    comm->forward_comm_fix(this);               // comm. ghost spins only
     for (int i = 0; i < nlocal; i++){           // advance quarter s for nlocal
       if (mask[i] & groupbit) {
         ComputeInteractionsSpin(i);
@@ -338,6 +365,8 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
   } else error->all(FLERR,"Illegal fix NVE/spin command");
 
   // update x for all particles
+  // ghost positions must be refreshed once before the second spin sweep,
+  //   the per-sector comms below only carry spins
 
   if (lattice_flag) {
     for (int i = 0; i < nlocal; i++) {
@@ -347,13 +376,14 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
         x[i][2] += dtv * v[i][2];
       }
     }
+    comm->forward_comm();
   }
 
   // update half s for all particles
 
   if (sector_flag) {                            // sectoring seq. update
     for (int j = 0; j < nsectors; j++) {        // advance quarter s for nlocal
-      comm->forward_comm();
+      comm->forward_comm_fix(this);             // comm. ghost spins only
       int i = stack_foot[j];
       while (i >= 0) {
         if (mask[i] & groupbit) {
@@ -364,7 +394,7 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
       }
     }
     for (int j = nsectors-1; j >= 0; j--) {     // advance quarter s for nlocal
-      comm->forward_comm();
+      comm->forward_comm_fix(this);             // comm. ghost spins only
       int i = stack_head[j];
       while (i >= 0) {
         if (mask[i] & groupbit) {
@@ -375,7 +405,7 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
       }
     }
   } else if (sector_flag == 0) {                // serial seq. update
-    comm->forward_comm();                       // comm. positions of ghost atoms
+    comm->forward_comm_fix(this);               // comm. ghost spins only
     for (int i = 0; i < nlocal; i++){           // advance quarter s for nlocal-1
       if (mask[i] & groupbit) {
         ComputeInteractionsSpin(i);
@@ -393,20 +423,27 @@ void FixNVESpin::initial_integrate(int /*vflag*/)
 }
 
 /* ----------------------------------------------------------------------
-   setup pre_neighbor()
+   setup post_neighbor()
 ---------------------------------------------------------------------- */
 
-void FixNVESpin::setup_pre_neighbor()
+void FixNVESpin::setup_post_neighbor()
 {
-  pre_neighbor();
+  post_neighbor();
 }
 
 /* ----------------------------------------------------------------------
    store in two linked lists the advance order of the spins (sectoring)
+   spins are ordered by (sector,color) so that within each sector all
+     spins of one color form a contiguous run with no mutual interaction
+     and can be advanced concurrently
+   the backward sweep is the exact mirror of the forward sweep, which
+     preserves the symplectic ordering of the sequential algorithm
 ---------------------------------------------------------------------- */
 
-void FixNVESpin::pre_neighbor()
+void FixNVESpin::post_neighbor()
 {
+  if (sector_flag == 0) return;
+
   double **x = atom->x;
   int nlocal = atom->nlocal;
 
@@ -414,31 +451,114 @@ void FixNVESpin::pre_neighbor()
     nlocal_max = nlocal;
     memory->grow(backward_stacks,nlocal_max,"NVE/spin:backward_stacks");
     memory->grow(forward_stacks,nlocal_max,"NVE/spin:forward_stacks");
+    memory->grow(color,nlocal_max,"NVE/spin:color");
+  }
+
+  // color the local spins from the fresh neighbor list
+
+  ncolors = coloring();
+
+  // counting sort of the local spins by (sector,color)
+
+  int i,j,k,ibucket;
+  int nbuckets = nsectors*ncolors;
+
+  int *isec,*order,*bucket;
+  memory->create(isec,nlocal,"NVE/spin:isec");
+  memory->create(order,nlocal,"NVE/spin:order");
+  memory->create(bucket,nbuckets+1,"NVE/spin:bucket");
+
+  for (i = 0; i < nbuckets+1; i++) bucket[i] = 0;
+  for (i = 0; i < nlocal; i++) {
+    isec[i] = coords2sector(x[i]);
+    bucket[isec[i]*ncolors + color[i] + 1]++;
+  }
+  for (i = 0; i < nbuckets; i++) bucket[i+1] += bucket[i];
+  for (i = 0; i < nlocal; i++) {
+    ibucket = isec[i]*ncolors + color[i];
+    order[bucket[ibucket]++] = i;
   }
 
-  for (int j = 0; j < nsectors; j++) {
+  for (j = 0; j < nsectors; j++) {
     stack_head[j] = -1;
     stack_foot[j] = -1;
   }
 
-  int nseci;
-  for (int j = 0; j < nsectors; j++) {          // stacking backward order
-    for (int i = 0; i < nlocal; i++) {
-      nseci = coords2sector(x[i]);
-      if (j != nseci) continue;
-      backward_stacks[i] = stack_head[j];
-      stack_head[j] = i;
-    }
+  for (k = nlocal-1; k >= 0; k--) {             // stacking forward order
+    i = order[k];
+    j = isec[i];
+    forward_stacks[i] = stack_foot[j];
+    stack_foot[j] = i;
+  }
+  for (k = 0; k < nlocal; k++) {                // stacking backward order
+    i = order[k];
+    j = isec[i];
+    backward_stacks[i] = stack_head[j];
+    stack_head[j] = i;
   }
-  for (int j = nsectors-1; j >= 0; j--) {       // stacking forward order
-    for (int i = nlocal-1; i >= 0; i--) {
-      nseci = coords2sector(x[i]);
-      if (j != nseci) continue;
-      forward_stacks[i] = stack_foot[j];
-      stack_foot[j] = i;
+
+  memory->destroy(isec);
+  memory->destroy(order);
+  memory->destroy(bucket);
+}
+
+/* ----------------------------------------------------------------------
+   greedy coloring of the local spins from the full neighbor list
+   two spins conflict if one is a neighbor of the other or of one of its
+     periodic images, so all spins of one color can be advanced in any
+     order (or concurrently) between two ghost updates
+   the list cutoff exceeds every magnetic pair cutoff plus skin, so the
+     coloring stays valid until the next reneighboring
+   return the # of colors used
+---------------------------------------------------------------------- */
+
+int FixNVESpin::coloring()
+{
+  int i,j,jj,ii,jm,c,inum,jnum;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+
+  tagint *tag = atom->tag;
+  int nlocal = atom->nlocal;
+
+  inum = list->inum;
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  for (i = 0; i < nlocal; i++) color[i] = -1;
+
+  // used[c] = i marks color c as taken by a neighbor of spin i
+
+  int *used;
+  memory->create(used,nlocal+1,"NVE/spin:used");
+  for (i = 0; i < nlocal+1; i++) used[i] = -2;
+
+  int nc = 1;
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (i >= nlocal) continue;
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj] & NEIGHMASK;
+      jm = j;
+      if (j >= nlocal) jm = atom->map(tag[j]);
+      if (jm < 0 || jm >= nlocal || jm == i) continue;
+      if (color[jm] >= 0) used[color[jm]] = i;
     }
+    c = 0;
+    while (used[c] == i) c++;
+    color[i] = c;
+    nc = MAX(nc,c+1);
   }
 
+  // spins without a neighbor list have no conflicts
+
+  for (i = 0; i < nlocal; i++)
+    if (color[i] < 0) color[i] = 0;
+
+  memory->destroy(used);
+  return nc;
 }
 
 /* ----------------------------------------------------------------------
@@ -642,6 +762,44 @@ void FixNVESpin::AdvanceSingleSpin(int i)
 
 }
 
+/* ----------------------------------------------------------------------
+   forward comm of the spin directions only
+   positions are untouched by the spin sweeps, so the full forward comm
+     of all atom coords + spins is not needed between sectors
+------------------------------------------------------------------------- */
+
+int FixNVESpin::pack_forward_comm(int n, int *list, double *buf,
+                                  int /*pbc_flag*/, int * /*pbc*/)
+{
+  int i,j,m;
+  double **sp = atom->sp;
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = sp[j][0];
+    buf[m++] = sp[j][1];
+    buf[m++] = sp[j][2];
+  }
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixNVESpin::unpack_forward_comm(int n, int first, double *buf)
+{
+  int i,m,last;
+  double **sp = atom->sp;
+
+  m = 0;
+  last = first + n;
+  for (i = first; i < last; i++) {
+    sp[i][0] = buf[m++];
+    sp[i][1] = buf[m++];
+    sp[i][2] = buf[m++];
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixNVESpin::final_integrate()
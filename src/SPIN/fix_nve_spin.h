@@ -40,8 +40,12 @@ friend class PairSpin;
   void sectoring();                     // sectoring operation functions
   int coords2sector(double *);
 
-  void setup_pre_neighbor();
-  void pre_neighbor();
+  void init_list(int, class NeighList *);
+  void setup_post_neighbor();
+  void post_neighbor();
+
+  int pack_forward_comm(int, int *, double *, int, int *);
+  void unpack_forward_comm(int, int, double *);
 
   int lattice_flag;                     // lattice_flag = 0 if spins only
                                         // lattice_flag = 1 if spin-lattice calc.
@@ -85,6 +89,13 @@ friend class PairSpin;
   int *backward_stacks;                 // index of next atom in backward stack
   int *forward_stacks;                  // index of next atom in forward stack
 
+  // coloring variables for conflict-free updates within each sector
+
+  class NeighList *list;                // full neighbor list for coloring
+  int *color;                           // color of each local spin
+  int ncolors;                          // # of colors in use
+
+  int coloring();
 };
 
 }
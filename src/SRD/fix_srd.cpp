@@ -80,7 +80,7 @@ FixSRD::FixSRD(LAMMPS *lmp, int narg, char **arg) : Fix(lmp, narg, arg),
   wallfix(NULL), wallwhich(NULL), xwall(NULL), xwallhold(NULL),
   vwall(NULL), fwall(NULL), avec_ellipsoid(NULL), avec_line(NULL),
   avec_tri(NULL), random(NULL), randomshift(NULL), flocal(NULL),
-  tlocal(NULL), biglist(NULL), binhead(NULL), binnext(NULL), sbuf1(NULL),
+  tlocal(NULL), biglist(NULL), binscale(NULL), binvel(NULL), sbuf1(NULL),
   sbuf2(NULL), rbuf1(NULL), rbuf2(NULL), nbinbig(NULL), binbig(NULL),
   binsrd(NULL), stencil(NULL)
 {
@@ -240,9 +240,9 @@ FixSRD::FixSRD(LAMMPS *lmp, int narg, char **arg) : Fix(lmp, narg, arg),
   else biggroupbit = 0;
 
   nmax = 0;
-  binhead = NULL;
+  binscale = NULL;
   maxbin1 = 0;
-  binnext = NULL;
+  binvel = NULL;
   maxbuf = 0;
   sbuf1 = sbuf2 = rbuf1 = rbuf2 = NULL;
 
@@ -294,8 +294,8 @@ FixSRD::~FixSRD()
   delete random;
   delete randomshift;
 
-  memory->destroy(binhead);
-  memory->destroy(binnext);
+  memory->destroy(binscale);
+  memory->destroy(binvel);
   memory->destroy(sbuf1);
   memory->destroy(sbuf2);
   memory->destroy(rbuf1);
@@ -480,9 +480,9 @@ void FixSRD::pre_neighbor()
   if (atom->nmax > nmax) {
     nmax = atom->nmax;
     memory->destroy(binsrd);
-    memory->destroy(binnext);
+    memory->destroy(binvel);
     memory->create(binsrd,nmax,"fix/srd:binsrd");
-    memory->create(binnext,nmax,"fix/srd:binnext");
+    memory->create(binvel,nmax,"fix/srd:binvel");
   }
 
   // setup and grow BIG info list if necessary
@@ -837,7 +837,7 @@ void FixSRD::post_force(int /*vflag*/)
 void FixSRD::reset_velocities()
 {
   int i,j,n,ix,iy,iz,ibin,axis,sign,irandom;
-  double u[3],vsum[3];
+  double u[3];
   double vsq,tbin,scale;
   double *vave,*xlamda;
   double vstream[3];
@@ -864,8 +864,10 @@ void FixSRD::reset_velocities()
   int nbiny = shifts[shiftflag].nbiny;
   BinAve *vbin = shifts[shiftflag].vbin;
 
-  // binhead = 1st SRD particle in each bin
-  // binnext = index of next particle in bin
+  // binvel = velocity bin of each SRD particle, for streaming passes below
+  // bin each particle and accumulate its velocity into its bin directly,
+  //   a single pass over contiguous atom arrays in place of building and
+  //   chasing per-bin linked lists
   // bin assignment is done in lamda units for triclinic
 
   int *mask = atom->mask;
@@ -875,9 +877,12 @@ void FixSRD::reset_velocities()
 
   if (triclinic) domain->x2lamda(nlocal);
 
-  for (i = 0; i < nbins; i++) binhead[i] = -1;
+  for (i = 0; i < nbins; i++) {
+    vbin[i].n = 0;
+    vbin[i].vsum[0] = vbin[i].vsum[1] = vbin[i].vsum[2] = 0.0;
+  }
 
-  for (i = 0; i < nlocal; i++)
+  for (i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
       ix = static_cast<int> ((x[i][0]-corner[0])*bininv1x);
       ix = MAX(ix,binlo[0]);
@@ -890,30 +895,19 @@ void FixSRD::reset_velocities()
       iz = MIN(iz,binhi[2]);
 
       ibin = (iz-binlo[2])*nbiny*nbinx + (iy-binlo[1])*nbinx + (ix-binlo[0]);
-      binnext[i] = binhead[ibin];
-      binhead[ibin] = i;
-    }
+      binvel[i] = ibin;
+      vbin[ibin].vsum[0] += v[i][0];
+      vbin[ibin].vsum[1] += v[i][1];
+      vbin[ibin].vsum[2] += v[i][2];
+      vbin[ibin].n++;
+    } else binvel[i] = -1;
+  }
 
   if (triclinic) domain->lamda2x(nlocal);
 
-  // for each bin I have particles contributing to:
-  // compute summed v of particles in that bin
   // if I own the bin, set its random value, else set to 0.0
 
   for (i = 0; i < nbins; i++) {
-    n = 0;
-    vsum[0] = vsum[1] = vsum[2] = 0.0;
-    for (j = binhead[i]; j >= 0; j = binnext[j]) {
-      vsum[0] += v[j][0];
-      vsum[1] += v[j][1];
-      vsum[2] += v[j][2];
-      n++;
-    }
-
-    vbin[i].vsum[0] = vsum[0];
-    vbin[i].vsum[1] = vsum[1];
-    vbin[i].vsum[2] = vsum[2];
-    vbin[i].n = n;
     if (vbin[i].owner) vbin[i].random = random->uniform();
     else vbin[i].random = 0.0;
   }
@@ -953,6 +947,8 @@ void FixSRD::reset_velocities()
   double *h_rate = domain->h_rate;
   double *h_ratelo = domain->h_ratelo;
 
+  // convert vsum to vave in place and clear per-bin thermal KE sums
+
   for (i = 0; i < nbins; i++) {
     vbin[i].value[0] = 0.0;
     n = vbin[i].n;
@@ -961,48 +957,66 @@ void FixSRD::reset_velocities()
     vave[0] /= n;
     vave[1] /= n;
     vave[2] /= n;
+  }
+
+  // rotation pass streams over particles via binvel
+  // a bin with a single particle accumulates exactly zero thermal KE
+
+  for (j = 0; j < nlocal; j++) {
+    ibin = binvel[j];
+    if (ibin < 0) continue;
+    vave = vbin[ibin].vsum;
 
-    irandom = static_cast<int> (6.0*vbin[i].random);
+    irandom = static_cast<int> (6.0*vbin[ibin].random);
     sign = irandom % 2;
     if (dimension == 3) axis = irandom / 2;
 
-    vsq = 0.0;
-    for (j = binhead[i]; j >= 0; j = binnext[j]) {
-      if (axis == 0) {
-        u[0] = v[j][0]-vave[0];
-        u[1] = sign ? v[j][2]-vave[2] : vave[2]-v[j][2];
-        u[2] = sign ? vave[1]-v[j][1] : v[j][1]-vave[1];
-      } else if (axis == 1) {
-        u[1] = v[j][1]-vave[1];
-        u[0] = sign ? v[j][2]-vave[2] : vave[2]-v[j][2];
-        u[2] = sign ? vave[0]-v[j][0] : v[j][0]-vave[0];
-      } else {
-        u[2] = v[j][2]-vave[2];
-        u[1] = sign ? v[j][0]-vave[0] : vave[0]-v[j][0];
-        u[0] = sign ? vave[1]-v[j][1] : v[j][1]-vave[1];
-      }
-      vsq += u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
-      v[j][0] = u[0] + vave[0];
-      v[j][1] = u[1] + vave[1];
-      v[j][2] = u[2] + vave[2];
+    if (axis == 0) {
+      u[0] = v[j][0]-vave[0];
+      u[1] = sign ? v[j][2]-vave[2] : vave[2]-v[j][2];
+      u[2] = sign ? vave[1]-v[j][1] : v[j][1]-vave[1];
+    } else if (axis == 1) {
+      u[1] = v[j][1]-vave[1];
+      u[0] = sign ? v[j][2]-vave[2] : vave[2]-v[j][2];
+      u[2] = sign ? vave[0]-v[j][0] : v[j][0]-vave[0];
+    } else {
+      u[2] = v[j][2]-vave[2];
+      u[1] = sign ? v[j][0]-vave[0] : vave[0]-v[j][0];
+      u[0] = sign ? vave[1]-v[j][1] : v[j][1]-vave[1];
     }
-
-    if (n > 1) vbin[i].value[0] = vsq;
+    vbin[ibin].value[0] += u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
+    v[j][0] = u[0] + vave[0];
+    v[j][1] = u[1] + vave[1];
+    v[j][2] = u[2] + vave[2];
   }
 
   if (shifts[shiftflag].commflag) xbin_comm(shiftflag,1);
 
   if (tstat) {
+
+    // tbin = thermal temperature of particles in bin
+    // binscale = cached scale factor for thermal velocity of bin
+
     for (i = 0; i < nbins; i++){
       n = vbin[i].n;
       if (n <= 1) continue;
+      tbin = vbin[i].value[0]/(n-dof_tstat) * tfactor;
+      binscale[i] = sqrt(temperature_srd/tbin);
+      vbin[i].value[0] = 0.0;
+    }
+
+    // thermostat pass also streams over particles
+
+    for (j = 0; j < nlocal; j++) {
+      ibin = binvel[j];
+      if (ibin < 0 || vbin[ibin].n <= 1) continue;
 
       // vsum is already average velocity
 
-      vave = vbin[i].vsum;
+      vave = vbin[ibin].vsum;
 
       if (deformflag) {
-        xlamda = vbin[i].xctr;
+        xlamda = vbin[ibin].xctr;
         vstream[0] = h_rate[0]*xlamda[0] + h_rate[5]*xlamda[1] +
           h_rate[4]*xlamda[2] + h_ratelo[0];
         vstream[1] = h_rate[1]*xlamda[1] + h_rate[3]*xlamda[2] + h_ratelo[1];
@@ -1013,22 +1027,14 @@ void FixSRD::reset_velocities()
         vstream[2] = vave[2];
       }
 
-      // tbin = thermal temperature of particles in bin
-      // scale = scale factor for thermal velocity
-
-      tbin = vbin[i].value[0]/(n-dof_tstat) * tfactor;
-      scale = sqrt(temperature_srd/tbin);
-      vsq = 0.0;
-      for (j = binhead[i]; j >= 0; j = binnext[j]) {
-        u[0] = (v[j][0] - vave[0]) * scale;
-        u[1] = (v[j][1] - vave[1]) * scale;
-        u[2] = (v[j][2] - vave[2]) * scale;
-        vsq += u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
-        v[j][0] = u[0] + vstream[0];
-        v[j][1] = u[1] + vstream[1];
-        v[j][2] = u[2] + vstream[2];
-      }
-      vbin[i].value[0] = vsq;
+      scale = binscale[ibin];
+      u[0] = (v[j][0] - vave[0]) * scale;
+      u[1] = (v[j][1] - vave[1]) * scale;
+      u[2] = (v[j][2] - vave[2]) * scale;
+      vbin[ibin].value[0] += u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
+      v[j][0] = u[0] + vstream[0];
+      v[j][1] = u[1] + vstream[1];
+      v[j][2] = u[2] + vstream[2];
     }
 
     if (shifts[shiftflag].commflag) xbin_comm(shiftflag,1);
@@ -3223,15 +3229,15 @@ void FixSRD::setup_velocity_bins()
   shifts[1].corner[2] = boxlo[2];
   setup_velocity_shift(1,0);
 
-  // allocate binhead based on max # of bins in either shift
+  // allocate binscale based on max # of bins in either shift
 
   int max = shifts[0].nbins;
   max = MAX(max,shifts[1].nbins);
 
   if (max > maxbin1) {
-    memory->destroy(binhead);
+    memory->destroy(binscale);
     maxbin1 = max;
-    memory->create(binhead,max,"fix/srd:binhead");
+    memory->create(binscale,max,"fix/srd:binscale");
   }
 
   // allocate sbuf,rbuf based on biggest bin message
@@ -153,8 +153,8 @@ class FixSRD : public Fix {
   BinShift shifts[2];             // 0 = no shift, 1 = shift
 
   int maxbin1;
-  int *binhead;          // 1st SRD particle in each bin
-  int *binnext;          // next SRD particle in same bin
+  double *binscale;      // thermostat scale factor of each velocity bin
+  int *binvel;           // velocity bin of each SRD particle
   int maxbuf;
   double *sbuf1,*sbuf2;  // buffers for send/recv of velocity bin data
   double *rbuf1,*rbuf2;
@@ -51,9 +51,21 @@ extern "C" {
 
 #define MPI_ANY_SOURCE -1
 #define MPI_STATUS_IGNORE NULL
+#define MPI_STATUSES_IGNORE NULL
+#define MPI_REQUEST_NULL -1
+
+#define MPI_COMM_TYPE_SHARED 1
+#define MPI_UNWEIGHTED NULL
+
+#define MPI_WIN_NULL -1
+#define MPI_MODE_NOCHECK 0
 
 #define MPI_Comm int
 #define MPI_Request int
+#define MPI_Info int
+#define MPI_INFO_NULL 0
+#define MPI_Win int
+#define MPI_Aint long
 #define MPI_Datatype int
 #define MPI_Op int
 #define MPI_Fint int
@@ -103,7 +115,13 @@ int MPI_Recv(void *buf, int count, MPI_Datatype datatype,
              int source, int tag, MPI_Comm comm, MPI_Status *status);
 int MPI_Irecv(void *buf, int count, MPI_Datatype datatype,
               int source, int tag, MPI_Comm comm, MPI_Request *request);
+int MPI_Send_init(const void *buf, int count, MPI_Datatype datatype,
+                  int dest, int tag, MPI_Comm comm, MPI_Request *request);
+int MPI_Recv_init(void *buf, int count, MPI_Datatype datatype,
+                  int source, int tag, MPI_Comm comm, MPI_Request *request);
+int MPI_Start(MPI_Request *request);
 int MPI_Wait(MPI_Request *request, MPI_Status *status);
+int MPI_Test(MPI_Request *request, int *flag, MPI_Status *status);
 int MPI_Waitall(int n, MPI_Request *request, MPI_Status *status);
 int MPI_Waitany(int count, MPI_Request *request, int *index,
                 MPI_Status *status);
@@ -118,7 +136,28 @@ int MPI_Comm_dup(MPI_Comm comm, MPI_Comm *comm_out);
 int MPI_Comm_free(MPI_Comm *comm);
 MPI_Fint MPI_Comm_c2f(MPI_Comm comm);
 MPI_Comm MPI_Comm_f2c(MPI_Fint comm);
+int MPI_Comm_split_type(MPI_Comm comm, int split_type, int key,
+                        MPI_Info info, MPI_Comm *comm_out);
+int MPI_Dist_graph_create_adjacent(MPI_Comm comm, int indegree,
+                                   const int *sources,
+                                   const int *sourceweights, int outdegree,
+                                   const int *destinations,
+                                   const int *destweights, MPI_Info info,
+                                   int reorder, MPI_Comm *comm_out);
+int MPI_Neighbor_alltoallv(const void *sendbuf, const int *sendcounts,
+                           const int *sdispls, MPI_Datatype sendtype,
+                           void *recvbuf, const int *recvcounts,
+                           const int *rdispls, MPI_Datatype recvtype,
+                           MPI_Comm comm);
 int MPI_Comm_group(MPI_Comm comm, MPI_Group *group);
+int MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info,
+                            MPI_Comm comm, void *baseptr, MPI_Win *win);
+int MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint *size,
+                         int *disp_unit, void *baseptr);
+int MPI_Win_lock_all(int assert, MPI_Win win);
+int MPI_Win_unlock_all(MPI_Win win);
+int MPI_Win_sync(MPI_Win win);
+int MPI_Win_free(MPI_Win *win);
 int MPI_Comm_create(MPI_Comm comm, MPI_Group group, MPI_Comm *newcomm);
 int MPI_Group_incl(MPI_Group group, int n, int *ranks, MPI_Group *newgroup);
 
@@ -23,6 +23,7 @@
 #include <cstring>
 #include "math_const.h"
 #include "compute_saed_consts.h"
+#include "diffraction_kernels.h"
 #include "atom.h"
 #include "comm.h"
 #include "update.h"
@@ -415,81 +416,93 @@ void ComputeSAED::compute_vector()
       fprintf(screen,"\n");
   }
 
-  int m = 0;
   double frac = 0.1;
 
+  // precompute per-node atomic scattering factors;
+  // they depend only on the node, not on the atoms
+
+  double **ftable;
+  memory->create(ftable,nRows,ntypes,"saed:ftable");
+
 #if defined(_OPENMP)
-#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(offset,ASFSAED,typelocal,xlocal,Fvec,m,frac)
+#pragma omp parallel for LMP_DEFAULT_NONE LMP_SHARED(offset,ftable,ASFSAED)
 #endif
-  {
-    double *f = new double[ntypes];    // atomic structure factor by type
-    int typei = 0;
-    double Fatom1 = 0.0;               // structure factor per atom
-    double Fatom2 = 0.0;               // structure factor per atom (imaginary)
+  for (int n = 0; n < nRows; n++) {
     double K[3];
-    double dinv2 = 0.0;
-    double dinv  = 0.0;
-    double SinTheta_lambda = 0.0;
-    double inners = 0.0;
+    int i = store_tmp[3*n+0];
+    int j = store_tmp[3*n+1];
+    int k = store_tmp[3*n+2];
+    K[0] = i * dK[0];
+    K[1] = j * dK[1];
+    K[2] = k * dK[2];
+
+    double dinv2 = (K[0] * K[0] + K[1] * K[1] + K[2] * K[2]);
+    double SinTheta_lambda = 0.5*sqrt(dinv2);
+
+    // Calculate the atomic structure factor by type
+    // determining parameter set to use based on S = sin(theta)/lambda <> 2
+    for (int ii = 0; ii < ntypes; ii++){
+      ftable[n][ii] = 0;
+      for (int C = 0; C < 5; C++){
+        int D = C + offset;
+        ftable[n][ii] += ASFSAED[ztype[ii]][D] * exp(-1*ASFSAED[ztype[ii]][5+D] * SinTheta_lambda * SinTheta_lambda);
+      }
+    }
+  }
+
+  // evaluate the structure factor equation tile by tile:
+  // the per-axis phase tables for a tile of atoms are built once, then
+  // every node is summed with three complex multiplies per atom
+  // instead of a sin and a cos call (see diffraction_kernels.h)
+
+  for (int n = 0; n < 2*nRows; n++) Fvec[n] = 0.0;
+
+  int tilesize = 2048;
+  if (tilesize > nlocalgroup) tilesize = nlocalgroup;
+
+  double *csx = new double[2*tilesize*(Knmax[0]+1)];
+  double *csy = new double[2*tilesize*(Knmax[1]+1)];
+  double *csz = new double[2*tilesize*(Knmax[2]+1)];
+
+  for (int s = 0; s < nlocalgroup; s += tilesize) {
+    int tn = nlocalgroup - s;
+    if (tn > tilesize) tn = tilesize;
+
+    diffraction_phase_table(2*MY_PI*dK[0],&xlocal[3*s],0,tn,tilesize,Knmax[0],csx);
+    diffraction_phase_table(2*MY_PI*dK[1],&xlocal[3*s],1,tn,tilesize,Knmax[1],csy);
+    diffraction_phase_table(2*MY_PI*dK[2],&xlocal[3*s],2,tn,tilesize,Knmax[2],csz);
 
 #if defined(_OPENMP)
-#pragma omp for
+#pragma omp parallel for LMP_DEFAULT_NONE LMP_SHARED(Fvec,ftable,typelocal,csx,csy,csz,s,tn,tilesize)
 #endif
     for (int n = 0; n < nRows; n++) {
       int i = store_tmp[3*n+0];
       int j = store_tmp[3*n+1];
       int k = store_tmp[3*n+2];
-      K[0] = i * dK[0];
-      K[1] = j * dK[1];
-      K[2] = k * dK[2];
-
-      dinv2 = (K[0] * K[0] + K[1] * K[1] + K[2] * K[2]);
-      dinv = sqrt(dinv2);
-      SinTheta_lambda = 0.5*dinv;
-
-      Fatom1 = 0.0;
-      Fatom2 = 0.0;
-
-      // Calculate the atomic structure factor by type
-      // determining parameter set to use based on S = sin(theta)/lambda <> 2
-      for (int ii = 0; ii < ntypes; ii++){
-        f[ii] = 0;
-        for (int C = 0; C < 5; C++){
-          int D = C + offset;
-          f[ii] += ASFSAED[ztype[ii]][D] * exp(-1*ASFSAED[ztype[ii]][5+D] * SinTheta_lambda * SinTheta_lambda);
-        }
-      }
 
-      // Evaluate the structure factor equation -- looping over all atoms
-      for (int ii = 0; ii < nlocalgroup; ii++){
-        typei=typelocal[ii]-1;
-        inners = 2 * MY_PI * (K[0] * xlocal[3*ii+0] + K[1] * xlocal[3*ii+1] +
-                  K[2] * xlocal[3*ii+2]);
-        Fatom1 += f[typei] * cos(inners);
-        Fatom2 += f[typei] * sin(inners);
-      }
+      double Fatom1 = 0.0;               // structure factor per atom
+      double Fatom2 = 0.0;               // structure factor per atom (imaginary)
 
-      Fvec[2*n] = Fatom1;
-      Fvec[2*n+1] = Fatom2;
+      diffraction_tile_sum(i,j,k,csx,csy,csz,tilesize,tn,ftable[n],
+                           &typelocal[s],Fatom1,Fatom2);
 
-      // reporting progress of calculation
-      if ( echo ) {
-#if defined(_OPENMP)
-        #pragma omp critical
-      // TODO use VMD timer style incrementer
-#endif
-        {
-          if ( m == round(frac * nRows) ) {
-            if (me == 0 && screen) fprintf(screen," %0.0f%% -",frac*100);
-            frac += 0.1;
-          }
-          m++;
-        }
+      Fvec[2*n] += Fatom1;
+      Fvec[2*n+1] += Fatom2;
+    }
+
+    // reporting progress of calculation
+    if ( echo ) {
+      if ( s+tn >= round(frac * nlocalgroup) ) {
+        if (me == 0 && screen) fprintf(screen," %0.0f%% -",frac*100);
+        frac += 0.1;
       }
-    } // End of pragma omp for region
-    delete [] f;
+    }
   }
 
+  delete [] csx;
+  delete [] csy;
+  delete [] csz;
+
   double *scratch = new double[2*nRows];
 
   // Sum intensity for each ang-hkl combination across processors
@@ -504,7 +517,8 @@ void ComputeSAED::compute_vector()
   // compute memory usage per processor
   double bytes = nRows * sizeof(double); //vector
   bytes +=  4.0 * nRows * sizeof(double); //Fvec1 & 2, scratch1 & 2
-  bytes += ntypes * sizeof(double); // f
+  bytes += (double) nRows * ntypes * sizeof(double); // ftable
+  bytes += 2.0 * tilesize * (Knmax[0]+Knmax[1]+Knmax[2]+3) * sizeof(double); // phase tables
   bytes += 3.0 * nlocalgroup * sizeof(double); // xlocal
   bytes += nlocalgroup * sizeof(int); // typelocal
   bytes += 3.0 * nRows * sizeof(int); // store_temp
@@ -514,6 +528,7 @@ void ComputeSAED::compute_vector()
       fprintf(screen," 100%% \nTime elapsed during compute_saed = %0.2f sec using %0.2f Mbytes/processor\n-----\n", t2-t0,  bytes/1024.0/1024.0);
   }
 
+  memory->destroy(ftable);
   delete [] xlocal;
   delete [] typelocal;
   delete [] scratch;
@@ -24,6 +24,7 @@
 #include <cstring>
 #include "math_const.h"
 #include "compute_xrd_consts.h"
+#include "diffraction_kernels.h"
 #include "atom.h"
 #include "comm.h"
 #include "update.h"
@@ -350,148 +351,109 @@ void ComputeXRD::compute_array()
         fprintf(screen,"Applying Lorentz-Polarization Factor During XRD Calculation 2\n");
     }
   }
-  int m = 0;
   double frac = 0.1;
 
-#if defined(_OPENMP)
-#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(typelocal,xlocal,Fvec,m,frac,ASFXRD)
-#endif
-  {
-    double *f = new double[ntypes];    // atomic structure factor by type
-    int n,typei = 0;
+  // precompute per-node atomic scattering factors and LP scaling;
+  // both depend only on the node, not on the atoms
 
-    double Fatom1 = 0.0;               // structure factor per atom (real)
-    double Fatom2 = 0.0;               // structure factor per atom (imaginary)
+  double **ftable;
+  double *sqrt_lp = NULL;
+  memory->create(ftable,size_array_rows,ntypes,"xrd:ftable");
+  if (LP == 1) memory->create(sqrt_lp,size_array_rows,"xrd:sqrt_lp");
 
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE LMP_SHARED(ftable,sqrt_lp,ASFXRD)
+#endif
+  for (int n = 0; n < size_array_rows; n++) {
     double K[3];
-    double dinv2 = 0.0;
-    double dinv  = 0.0;
-    double SinTheta_lambda  = 0.0;
-    double SinTheta = 0.0;
-    double ang = 0.0;
-    double Cos2Theta = 0.0;
-    double CosTheta = 0.0;
+    int k = store_tmp[3*n];
+    int j = store_tmp[3*n+1];
+    int i = store_tmp[3*n+2];
+    K[0] = i * dK[0];
+    K[1] = j * dK[1];
+    K[2] = k * dK[2];
 
-    double inners = 0.0;
-    double sqrt_lp = 0.0;
+    double dinv2 = (K[0] * K[0] + K[1] * K[1] + K[2] * K[2]);
+    double SinTheta_lambda = 0.5*sqrt(dinv2);
+
+    // Calculate the atomic structure factor by type
+    for (int ii = 0; ii < ntypes; ii++){
+      ftable[n][ii] = 0;
+      for (int C = 0; C < 8 ; C+=2){
+        ftable[n][ii] += ASFXRD[ztype[ii]][C] * exp(-1 * ASFXRD[ztype[ii]][C+1] * SinTheta_lambda * SinTheta_lambda );
+      }
+      ftable[n][ii] += ASFXRD[ztype[ii]][8];
+    }
 
     if (LP == 1) {
+      double SinTheta = SinTheta_lambda * lambda;
+      double ang = asin( SinTheta );
+      double Cos2Theta = cos( 2 * ang);
+      double CosTheta = cos( ang );
+      sqrt_lp[n] = sqrt( (1 + Cos2Theta * Cos2Theta) /
+           ( CosTheta * SinTheta * SinTheta) );
+    }
+  }
 
-#if defined(_OPENMP)
-#pragma omp for
-#endif
-      for (n = 0; n < size_array_rows; n++) {
-        int k = store_tmp[3*n];
-        int j = store_tmp[3*n+1];
-        int i = store_tmp[3*n+2];
-        K[0] = i * dK[0];
-        K[1] = j * dK[1];
-        K[2] = k * dK[2];
+  // evaluate the structure factor equation tile by tile:
+  // the per-axis phase tables for a tile of atoms are built once, then
+  // every node is summed with three complex multiplies per atom
+  // instead of a sin and a cos call (see diffraction_kernels.h)
 
-        dinv2 = (K[0] * K[0] + K[1] * K[1] + K[2] * K[2]);
-        dinv = sqrt(dinv2);
-        SinTheta_lambda = 0.5*dinv;
-        SinTheta = SinTheta_lambda * lambda;
-        ang = asin( SinTheta );
-        Cos2Theta = cos( 2 * ang);
-        CosTheta = cos( ang );
-
-        Fatom1 = 0.0;
-        Fatom2 = 0.0;
-
-        // Calculate the atomic structure factor by type
-        for (int ii = 0; ii < ntypes; ii++){
-          f[ii] = 0;
-          for (int C = 0; C < 8 ; C+=2){
-            f[ii] += ASFXRD[ztype[ii]][C] * exp(-1 * ASFXRD[ztype[ii]][C+1] * SinTheta_lambda * SinTheta_lambda );
-          }
-          f[ii] += ASFXRD[ztype[ii]][8];
-        }
+  for (int n = 0; n < 2*size_array_rows; n++) Fvec[n] = 0.0;
 
-        // Evaluate the structure factor equation -- looping over all atoms
-        for (int ii = 0; ii < nlocalgroup; ii++){
-          typei=typelocal[ii]-1;
-          inners = 2 * MY_PI * (K[0] * xlocal[3*ii] + K[1] * xlocal[3*ii+1] +
-                    K[2] * xlocal[3*ii+2]);
-          Fatom1 += f[typei] * cos(inners);
-          Fatom2 += f[typei] * sin(inners);
-        }
-        sqrt_lp = sqrt( (1 + Cos2Theta * Cos2Theta) /
-             ( CosTheta * SinTheta * SinTheta) );
-        Fvec[2*n] = Fatom1 * sqrt_lp;
-        Fvec[2*n+1] = Fatom2 * sqrt_lp;
+  int tilesize = 2048;
+  if (tilesize > nlocalgroup) tilesize = nlocalgroup;
 
-        // reporting progress of calculation
-        if ( echo ) {
-#if defined(_OPENMP)
-          #pragma omp critical
-#endif
-          {
-            if ( m == round(frac * size_array_rows) ) {
-              if (me == 0 && screen) fprintf(screen," %0.0f%% -",frac*100);
-              frac += 0.1;
-            }
-            m++;
-          }
-        }
-      } // End of pragma omp for region
+  double *csx = new double[2*tilesize*(Knmax[0]+1)];
+  double *csy = new double[2*tilesize*(Knmax[1]+1)];
+  double *csz = new double[2*tilesize*(Knmax[2]+1)];
+
+  for (int s = 0; s < nlocalgroup; s += tilesize) {
+    int tn = nlocalgroup - s;
+    if (tn > tilesize) tn = tilesize;
+
+    diffraction_phase_table(2*MY_PI*dK[0],&xlocal[3*s],0,tn,tilesize,Knmax[0],csx);
+    diffraction_phase_table(2*MY_PI*dK[1],&xlocal[3*s],1,tn,tilesize,Knmax[1],csy);
+    diffraction_phase_table(2*MY_PI*dK[2],&xlocal[3*s],2,tn,tilesize,Knmax[2],csz);
 
-    } else {
 #if defined(_OPENMP)
-#pragma omp for
+#pragma omp parallel for LMP_DEFAULT_NONE LMP_SHARED(Fvec,ftable,typelocal,csx,csy,csz,s,tn,tilesize)
 #endif
-      for (n = 0; n < size_array_rows; n++) {
-        int k = store_tmp[3*n];
-        int j = store_tmp[3*n+1];
-        int i = store_tmp[3*n+2];
-        K[0] = i * dK[0];
-        K[1] = j * dK[1];
-        K[2] = k * dK[2];
+    for (int n = 0; n < size_array_rows; n++) {
+      int k = store_tmp[3*n];
+      int j = store_tmp[3*n+1];
+      int i = store_tmp[3*n+2];
 
-        dinv2 = (K[0] * K[0] + K[1] * K[1] + K[2] * K[2]);
-        dinv = sqrt(dinv2);
-        SinTheta_lambda = 0.5*dinv;
-
-        Fatom1 = 0.0;
-        Fatom2 = 0.0;
-
-        // Calculate the atomic structure factor by type
-        for (int ii = 0; ii < ntypes; ii++){
-          f[ii] = 0;
-          for (int C = 0; C < 8 ; C+=2){
-            f[ii] += ASFXRD[ztype[ii]][C] * exp(-1 * ASFXRD[ztype[ii]][C+1] * SinTheta_lambda * SinTheta_lambda );
-          }
-          f[ii] += ASFXRD[ztype[ii]][8];
-        }
+      double Fatom1 = 0.0;               // structure factor per atom (real)
+      double Fatom2 = 0.0;               // structure factor per atom (imaginary)
 
-        // Evaluate the structure factor equation -- looping over all atoms
-        for (int ii = 0; ii < nlocalgroup; ii++){
-          typei=typelocal[ii]-1;
-          inners = 2 * MY_PI * (K[0] * xlocal[3*ii] + K[1] * xlocal[3*ii+1] +
-                    K[2] * xlocal[3*ii+2]);
-          Fatom1 += f[typei] * cos(inners);
-          Fatom2 += f[typei] * sin(inners);
-        }
-        Fvec[2*n] = Fatom1;
-        Fvec[2*n+1] = Fatom2;
+      diffraction_tile_sum(i,j,k,csx,csy,csz,tilesize,tn,ftable[n],
+                           &typelocal[s],Fatom1,Fatom2);
 
-        // reporting progress of calculation
-        if ( echo ) {
-#if defined(_OPENMP)
-          #pragma omp critical
-#endif
-          {
-            if ( m == round(frac * size_array_rows) ) {
-              if (me == 0 && screen) fprintf(screen," %0.0f%% -",frac*100 );
-              frac += 0.1;
-            }
-            m++;
-          }
-        }
-      } // End of pragma omp for region
-    } // End of if LP=1 check
-    delete [] f;
-  } // End of pragma omp parallel region
+      Fvec[2*n] += Fatom1;
+      Fvec[2*n+1] += Fatom2;
+    }
+
+    // reporting progress of calculation
+    if ( echo ) {
+      if ( s+tn >= round(frac * nlocalgroup) ) {
+        if (me == 0 && screen) fprintf(screen," %0.0f%% -",frac*100);
+        frac += 0.1;
+      }
+    }
+  }
+
+  if (LP == 1) {
+    for (int n = 0; n < size_array_rows; n++) {
+      Fvec[2*n] *= sqrt_lp[n];
+      Fvec[2*n+1] *= sqrt_lp[n];
+    }
+  }
+
+  delete [] csx;
+  delete [] csy;
+  delete [] csz;
 
   double *scratch = new double[2*size_array_rows];
 
@@ -507,7 +469,8 @@ void ComputeXRD::compute_array()
   // compute memory usage per processor
   double bytes = size_array_rows * size_array_cols * sizeof(double); //array
   bytes +=  4.0 * size_array_rows * sizeof(double); //Fvec1 & 2, scratch1 & 2
-  bytes += ntypes * sizeof(double); // f
+  bytes += (double) size_array_rows * ntypes * sizeof(double); // ftable
+  bytes += 2.0 * tilesize * (Knmax[0]+Knmax[1]+Knmax[2]+3) * sizeof(double); // phase tables
   bytes += 3.0 * nlocalgroup * sizeof(double); // xlocal
   bytes += nlocalgroup * sizeof(int); // typelocal
   bytes += 3.0 * size_array_rows * sizeof(int); // store_temp
@@ -517,6 +480,8 @@ void ComputeXRD::compute_array()
       fprintf(screen," 100%% \nTime elapsed during compute_xrd = %0.2f sec using %0.2f Mbytes/processor\n-----\n", t2-t0, bytes/1024.0/1024.0);
   }
 
+  memory->destroy(ftable);
+  if (LP == 1) memory->destroy(sqrt_lp);
   delete [] scratch;
   delete [] Fvec;
   delete [] xlocal;
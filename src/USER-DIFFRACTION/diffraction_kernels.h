@@ -0,0 +1,105 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   Batched structure-factor kernels shared by compute xrd and compute saed.
+
+   Every reciprocal-lattice node is an integer multiple (i,j,k) of the
+   spacing dK, so exp(2 pi I K.x) factorizes into per-axis phase factors
+   exp(2 pi I i dK[0] x) * exp(2 pi I j dK[1] y) * exp(2 pi I k dK[2] z).
+   For a tile of atoms the phase factors for all needed multiples of the
+   base phase are built once by the angle-addition recurrence (one sin/cos
+   per atom per axis), after which each node costs three complex multiplies
+   per atom instead of a sin and a cos call.  This is the same phase-table
+   scheme the Ewald kspace solver uses for its structure factors.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_DIFFRACTION_KERNELS_H
+#define LMP_DIFFRACTION_KERNELS_H
+
+#include <cmath>
+#include <cstdlib>
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   build the phase-factor table for one axis of one tile of atoms
+   cs[2*(stride*m + a)] / cs[2*(stride*m + a) + 1] hold cos/sin of
+   m * twopidk * x(a,dim) for multiples m = 0..nmax; negative multiples
+   are obtained by conjugation in diffraction_tile_sum()
+------------------------------------------------------------------------- */
+
+static inline void diffraction_phase_table(double twopidk, const double *xlocal,
+                                           int dim, int tn, int stride,
+                                           int nmax, double *cs)
+{
+  int a,m;
+  double arg,c1,s1;
+  double *prev,*cur;
+
+  for (a = 0; a < tn; a++) {
+    arg = twopidk * xlocal[3*a + dim];
+    c1 = cos(arg);
+    s1 = sin(arg);
+    cs[2*a] = 1.0;
+    cs[2*a+1] = 0.0;
+    for (m = 1; m <= nmax; m++) {
+      prev = cs + 2*stride*(m-1);
+      cur = cs + 2*stride*m;
+      cur[2*a] = prev[2*a]*c1 - prev[2*a+1]*s1;
+      cur[2*a+1] = prev[2*a+1]*c1 + prev[2*a]*s1;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   accumulate the structure factor of one reciprocal node (i,j,k) over a
+   tile of tn atoms using the per-axis phase tables
+   f = atomic scattering factors per type for this node
+------------------------------------------------------------------------- */
+
+static inline void diffraction_tile_sum(int i, int j, int k,
+                                        const double *csx, const double *csy,
+                                        const double *csz, int stride, int tn,
+                                        const double *f, const int *typelocal,
+                                        double &Freal, double &Fimag)
+{
+  const double *cx = csx + 2*stride*abs(i);
+  const double *cy = csy + 2*stride*abs(j);
+  const double *cz = csz + 2*stride*abs(k);
+  const double sgx = (i < 0) ? -1.0 : 1.0;
+  const double sgy = (j < 0) ? -1.0 : 1.0;
+  const double sgz = (k < 0) ? -1.0 : 1.0;
+  int a;
+  double cxa,sxa,cya,sya,cza,sza,cxy,sxy,c,s,fa;
+
+  for (a = 0; a < tn; a++) {
+    cxa = cx[2*a];
+    sxa = sgx*cx[2*a+1];
+    cya = cy[2*a];
+    sya = sgy*cy[2*a+1];
+    cza = cz[2*a];
+    sza = sgz*cz[2*a+1];
+    cxy = cxa*cya - sxa*sya;
+    sxy = sxa*cya + cxa*sya;
+    c = cxy*cza - sxy*sza;
+    s = sxy*cza + cxy*sza;
+    fa = f[typelocal[a]-1];
+    Freal += fa*c;
+    Fimag += fa*s;
+  }
+}
+
+}
+
+#endif
@@ -174,6 +174,9 @@ void FixShardlow::setup(int /*vflag*/)
    Perform the stochastic integration and Shardlow update for constant temperature
    Allow for both per-type and per-atom mass
 
+   May be called concurrently for the work items of one SSA phase: each
+   call updates a disjoint set of atoms and only its own rand_state slot
+
    NOTE: only implemented for orthogonal boxes, not triclinic
 ------------------------------------------------------------------------- */
 void FixShardlow::ssa_update_dpd(
@@ -336,6 +339,9 @@ while (ct-- > 0) {
    Perform the stochastic integration and Shardlow update for constant energy
    Allow for both per-type and per-atom mass
 
+   May be called concurrently for the work items of one SSA phase: each
+   call updates a disjoint set of atoms and only its own rand_state slot
+
    NOTE: only implemented for orthogonal boxes, not triclinic
 ------------------------------------------------------------------------- */
 void FixShardlow::ssa_update_dpde(
@@ -529,8 +535,6 @@ while (ct-- > 0) {
 
 void FixShardlow::initial_integrate(int /*vflag*/)
 {
-  int ii;
-
   const int nlocal = atom->nlocal;
   const int nghost = atom->nghost;
 
@@ -594,12 +598,21 @@ void FixShardlow::initial_integrate(int /*vflag*/)
   dtsqrt = sqrt(update->dt);
 
   // process neighbors in the local AIR
+
+  // the SSA phase decomposition is a coloring of the interaction graph:
+  // work items within one phase update disjoint sets of atoms, and each
+  // work item advances its own RNG stream, so the items of a phase can
+  // run in any order (or concurrently) with bitwise identical results
+
   for (int workPhase = 0; workPhase < ssa_phaseCt; ++workPhase) {
     int workItemCt = ssa_phaseLen[workPhase];
 
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
     for (int workItem = 0; workItem < workItemCt; ++workItem) {
       int ct = ssa_itemLen[workPhase][workItem];
-      ii = ssa_itemLoc[workPhase][workItem];
+      int ii = ssa_itemLoc[workPhase][workItem];
       if (useDPDE) ssa_update_dpde(ii, ct, workItem);
       else ssa_update_dpd(ii, ct, workItem);
     }
@@ -618,9 +631,13 @@ void FixShardlow::initial_integrate(int /*vflag*/)
       memset(&(atom->uMech[nlocal]), 0, sizeof(double)*nghost);
     }
 
+    // the list builder emits a single work item per ghost AIR, and two
+    // ghosts in one AIR may share a local neighbor, so this sweep is
+    // serial; the local phases above dominate the pair count
+
     for (int workItem = 0; workItem < workItemCt; ++workItem) {
       int ct = ssa_gitemLen[workPhase][workItem];
-      ii = ssa_gitemLoc[workPhase][workItem];
+      int ii = ssa_gitemLoc[workPhase][workItem];
       if (useDPDE) ssa_update_dpde(ii, ct, workItem);
       else ssa_update_dpd(ii, ct, workItem);
     }
@@ -0,0 +1,392 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "omp_compat.h"
+#include <cmath>
+#include <cstring>
+#include "pair_gran_hertz_history_intel.h"
+#include "fix_neigh_history.h"
+#include "atom.h"
+#include "comm.h"
+#include "fix.h"
+#include "force.h"
+#include "memory.h"
+#include "modify.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "update.h"
+#include "error.h"
+
+#include "suffix.h"
+using namespace LAMMPS_NS;
+
+/* ----------------------------------------------------------------------
+   The contact history (v, omega, radius, rmass, shear) does not stream
+   through the packed mixed-precision IntelBuffers and the shear
+   integration needs full precision anyway, so this style keeps the
+   force math in double and takes its threading from the package: the
+   neighbor loop is divided over the package's threads with private
+   force/torque accumulators that are reduced in contiguous slices.
+------------------------------------------------------------------------- */
+
+PairGranHertzHistoryIntel::PairGranHertzHistoryIntel(LAMMPS *lmp) :
+  PairGranHertzHistory(lmp)
+{
+  suffix_flag |= Suffix::INTEL;
+
+  fix = NULL;
+  _thr_fa = NULL;
+  _nmax = 0;
+  _use_base = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairGranHertzHistoryIntel::~PairGranHertzHistoryIntel()
+{
+  memory->destroy(_thr_fa);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairGranHertzHistoryIntel::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  // per-atom stress or a virial that cannot come from fdotr needs the
+  // per-pair tallies of the base class; with offload balancing active
+  // the base class runs too, since this style computes on the host only
+
+  if (_use_base || vflag_atom || (vflag_either && vflag_fdotr == 0)) {
+    PairGranHertzHistory::compute(eflag,vflag);
+    return;
+  }
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+  const int shearupdate = (update->setupflag) ? 0 : 1;
+
+  // update rigid body info for owned & ghost atoms if using FixRigid masses
+  // body[i] = which body atom I is in, -1 if none
+  // mass_body = mass of each rigid body
+
+  if (fix_rigid && neighbor->ago == 0) {
+    int tmp;
+    int *body = (int *) fix_rigid->extract("body",tmp);
+    double *mass_body = (double *) fix_rigid->extract("masstotal",tmp);
+    if (atom->nmax > nmax) {
+      memory->destroy(mass_rigid);
+      nmax = atom->nmax;
+      memory->create(mass_rigid,nmax,"pair:mass_rigid");
+    }
+    int nlocal = atom->nlocal;
+    for (int i = 0; i < nlocal; i++)
+      if (body[i] >= 0) mass_rigid[i] = mass_body[body[i]];
+      else mass_rigid[i] = 0.0;
+    comm->forward_comm_pair(this);
+  }
+
+  // grow the per-thread force/torque accumulators
+
+  if (atom->nmax > _nmax) {
+    memory->destroy(_thr_fa);
+    _nmax = atom->nmax;
+    memory->create(_thr_fa,nthreads*_nmax*6,"pair:thr_fa");
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE
+#endif
+  {
+    int ifrom, ito, tid;
+    IP_PRE_omp_range_id(ifrom, ito, tid, inum, nthreads);
+
+    double * _noalias const fa = _thr_fa + tid*_nmax*6;
+    memset(fa, 0, nall*6*sizeof(double));
+
+    if (shearupdate) eval<1>(ifrom, ito, tid);
+    else eval<0>(ifrom, ito, tid);
+
+    // all threads must finish writing before the reduction reads
+
+#if defined(_OPENMP)
+#pragma omp barrier
+#endif
+
+    // reduce the per-thread accumulators into the atom arrays,
+    // each thread summing a contiguous slice of atoms
+
+    int afrom, ato;
+    IP_PRE_omp_range_id(afrom, ato, tid, nall, nthreads);
+
+    double * const * const f = atom->f;
+    double * const * const torque = atom->torque;
+    for (int t = 0; t < nthreads; t++) {
+      const double * _noalias const ft = _thr_fa + t*_nmax*6;
+      for (int i = afrom; i < ato; i++) {
+        f[i][0] += ft[6*i];
+        f[i][1] += ft[6*i+1];
+        f[i][2] += ft[6*i+2];
+        torque[i][0] += ft[6*i+3];
+        torque[i][1] += ft[6*i+4];
+        torque[i][2] += ft[6*i+5];
+      }
+    }
+  } // end of omp parallel region
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int SHEARUPDATE>
+void PairGranHertzHistoryIntel::eval(const int iifrom, const int iito,
+                                     const int tid)
+{
+  int i,j,ii,jj,jnum;
+  double xtmp,ytmp,ztmp,delx,dely,delz,fx,fy,fz;
+  double radi,radj,radsum,rsq,r,rinv,rsqinv;
+  double vr1,vr2,vr3,vnnr,vn1,vn2,vn3,vt1,vt2,vt3;
+  double wr1,wr2,wr3;
+  double vtr1,vtr2,vtr3,vrel;
+  double mi,mj,meff,damp,ccel,tor1,tor2,tor3;
+  double fn,fs,fs1,fs2,fs3;
+  double shrmag,rsht,polyhertz;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+  int *touch,**firsttouch;
+  double *shear,*allshear,**firstshear;
+
+  const double * const * const x = atom->x;
+  const double * const * const v = atom->v;
+  const double * const * const omega = atom->omega;
+  const double * const radius = atom->radius;
+  const double * const rmass = atom->rmass;
+  const int * const mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  const int newton = force->newton_pair;
+  double * _noalias const fa = _thr_fa + tid*_nmax*6;
+  double fxtmp,fytmp,fztmp;
+  double t1tmp,t2tmp,t3tmp;
+
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+  firsttouch = fix_history->firstflag;
+  firstshear = fix_history->firstvalue;
+
+  // loop over neighbors of my atoms
+
+  for (ii = iifrom; ii < iito; ++ii) {
+
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    radi = radius[i];
+    touch = firsttouch[i];
+    allshear = firstshear[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+    fxtmp=fytmp=fztmp=t1tmp=t2tmp=t3tmp=0.0;
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      radj = radius[j];
+      radsum = radi + radj;
+
+      if (rsq >= radsum*radsum) {
+
+        // unset non-touching neighbors
+
+        touch[jj] = 0;
+        shear = &allshear[3*jj];
+        shear[0] = 0.0;
+        shear[1] = 0.0;
+        shear[2] = 0.0;
+
+      } else {
+        r = sqrt(rsq);
+        rinv = 1.0/r;
+        rsqinv = 1.0/rsq;
+
+        // relative translational velocity
+
+        vr1 = v[i][0] - v[j][0];
+        vr2 = v[i][1] - v[j][1];
+        vr3 = v[i][2] - v[j][2];
+
+        // normal component
+
+        vnnr = vr1*delx + vr2*dely + vr3*delz;
+        vn1 = delx*vnnr * rsqinv;
+        vn2 = dely*vnnr * rsqinv;
+        vn3 = delz*vnnr * rsqinv;
+
+        // tangential component
+
+        vt1 = vr1 - vn1;
+        vt2 = vr2 - vn2;
+        vt3 = vr3 - vn3;
+
+        // relative rotational velocity
+
+        wr1 = (radi*omega[i][0] + radj*omega[j][0]) * rinv;
+        wr2 = (radi*omega[i][1] + radj*omega[j][1]) * rinv;
+        wr3 = (radi*omega[i][2] + radj*omega[j][2]) * rinv;
+
+        // meff = effective mass of pair of particles
+        // if I or J part of rigid body, use body mass
+        // if I or J is frozen, meff is other particle
+
+        mi = rmass[i];
+        mj = rmass[j];
+        if (fix_rigid) {
+          if (mass_rigid[i] > 0.0) mi = mass_rigid[i];
+          if (mass_rigid[j] > 0.0) mj = mass_rigid[j];
+        }
+
+        meff = mi*mj / (mi+mj);
+        if (mask[i] & freeze_group_bit) meff = mj;
+        if (mask[j] & freeze_group_bit) meff = mi;
+
+        // normal force = Hertzian contact + normal velocity damping
+
+        damp = meff*gamman*vnnr*rsqinv;
+        ccel = kn*(radsum-r)*rinv - damp;
+        polyhertz = sqrt((radsum-r)*radi*radj / radsum);
+        ccel *= polyhertz;
+
+        // relative velocities
+
+        vtr1 = vt1 - (delz*wr2-dely*wr3);
+        vtr2 = vt2 - (delx*wr3-delz*wr1);
+        vtr3 = vt3 - (dely*wr1-delx*wr2);
+        vrel = vtr1*vtr1 + vtr2*vtr2 + vtr3*vtr3;
+        vrel = sqrt(vrel);
+
+        // shear history effects
+
+        touch[jj] = 1;
+        shear = &allshear[3*jj];
+
+        if (SHEARUPDATE) {
+          shear[0] += vtr1*dt;
+          shear[1] += vtr2*dt;
+          shear[2] += vtr3*dt;
+        }
+        shrmag = sqrt(shear[0]*shear[0] + shear[1]*shear[1] +
+                      shear[2]*shear[2]);
+
+        // rotate shear displacements
+
+        rsht = shear[0]*delx + shear[1]*dely + shear[2]*delz;
+        rsht *= rsqinv;
+        if (SHEARUPDATE) {
+          shear[0] -= rsht*delx;
+          shear[1] -= rsht*dely;
+          shear[2] -= rsht*delz;
+        }
+
+        // tangential forces = shear + tangential velocity damping
+
+        fs1 = -polyhertz * (kt*shear[0] + meff*gammat*vtr1);
+        fs2 = -polyhertz * (kt*shear[1] + meff*gammat*vtr2);
+        fs3 = -polyhertz * (kt*shear[2] + meff*gammat*vtr3);
+
+        // rescale frictional displacements and forces if needed
+
+        fs = sqrt(fs1*fs1 + fs2*fs2 + fs3*fs3);
+        fn = xmu * fabs(ccel*r);
+
+        if (fs > fn) {
+          if (shrmag != 0.0) {
+            const double fnfs = fn/fs;
+            const double mgkt = meff*gammat/kt;
+            shear[0] = fnfs * (shear[0] + mgkt*vtr1) - mgkt*vtr1;
+            shear[1] = fnfs * (shear[1] + mgkt*vtr2) - mgkt*vtr2;
+            shear[2] = fnfs * (shear[2] + mgkt*vtr3) - mgkt*vtr3;
+            fs1 *= fnfs;
+            fs2 *= fnfs;
+            fs3 *= fnfs;
+          } else fs1 = fs2 = fs3 = 0.0;
+        }
+
+        // forces & torques
+
+        fx = delx*ccel + fs1;
+        fy = dely*ccel + fs2;
+        fz = delz*ccel + fs3;
+        fxtmp  += fx;
+        fytmp  += fy;
+        fztmp  += fz;
+
+        tor1 = rinv * (dely*fs3 - delz*fs2);
+        tor2 = rinv * (delz*fs1 - delx*fs3);
+        tor3 = rinv * (delx*fs2 - dely*fs1);
+        t1tmp -= radi*tor1;
+        t2tmp -= radi*tor2;
+        t3tmp -= radi*tor3;
+
+        if (newton || j < nlocal) {
+          fa[6*j]   -= fx;
+          fa[6*j+1] -= fy;
+          fa[6*j+2] -= fz;
+          fa[6*j+3] -= radj*tor1;
+          fa[6*j+4] -= radj*tor2;
+          fa[6*j+5] -= radj*tor3;
+        }
+      }
+    }
+    fa[6*i]   += fxtmp;
+    fa[6*i+1] += fytmp;
+    fa[6*i+2] += fztmp;
+    fa[6*i+3] += t1tmp;
+    fa[6*i+4] += t2tmp;
+    fa[6*i+5] += t3tmp;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairGranHertzHistoryIntel::init_style()
+{
+  PairGranHertzHistory::init_style();
+
+  int ifix = modify->find_fix("package_intel");
+  if (ifix < 0)
+    error->all(FLERR,
+               "The 'package intel' command is required for /intel styles");
+  fix = static_cast<FixIntel *>(modify->fix[ifix]);
+
+  #ifdef _LMP_INTEL_OFFLOAD
+  _use_base = 0;
+  if (fix->offload_balance() != 0.0) {
+    _use_base = 1;
+    return;
+  }
+  #endif
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairGranHertzHistoryIntel::memory_usage()
+{
+  double bytes = PairGranHertzHistory::memory_usage();
+  bytes += comm->nthreads*_nmax*6*sizeof(double);
+
+  return bytes;
+}
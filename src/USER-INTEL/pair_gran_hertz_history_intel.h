@@ -0,0 +1,55 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(gran/hertz/history/intel,PairGranHertzHistoryIntel)
+
+#else
+
+#ifndef LMP_PAIR_GRAN_HERTZ_HISTORY_INTEL_H
+#define LMP_PAIR_GRAN_HERTZ_HISTORY_INTEL_H
+
+#include "pair_gran_hertz_history.h"
+#include "fix_intel.h"
+
+namespace LAMMPS_NS {
+
+class PairGranHertzHistoryIntel : public PairGranHertzHistory {
+ public:
+  PairGranHertzHistoryIntel(class LAMMPS *);
+  virtual ~PairGranHertzHistoryIntel();
+  virtual void compute(int, int);
+  virtual void init_style();
+  double memory_usage();
+
+ protected:
+  template <int SHEARUPDATE>
+  void eval(const int ifrom, const int ito, const int tid);
+
+  FixIntel *fix;
+
+  double *_thr_fa;     // per-thread force/torque accumulators, 6 per atom
+  int _nmax;           // per-thread capacity of _thr_fa in atoms
+  int _use_base;       // 1 if base class does the work (offload active)
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: The 'package intel' command is required for /intel styles
+
+Self-explanatory.
+
+*/
@@ -64,6 +64,7 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
   :  Fix(lmp, narg, arg),
      thr(NULL), last_omp_style(NULL), last_pair_hybrid(NULL),
      _nthr(-1), _neighbor(true), _mixed(false), _reduced(true),
+     _old_nall(-1),
      _pair_compute_flag(false), _kspace_compute_flag(false)
 {
   if (narg < 4) error->all(FLERR,"Illegal package omp command");
@@ -350,6 +351,13 @@ void FixOMP::pre_force(int)
 {
   const int nall = atom->nlocal + atom->nghost;
 
+  // the per-thread force copies (tid > 0) are still zeroed from the
+  // last force reduction, provided one ran and the per-thread offsets
+  // into the storage did not move since
+
+  const int fclean = (_reduced && nall == _old_nall) ? 1 : 0;
+  _old_nall = nall;
+
   double **f = atom->f;
   double **torque = atom->torque;
   double *erforce = atom->erforce;
@@ -362,7 +370,7 @@ void FixOMP::pre_force(int)
   {
     const int tid = get_tid();
     thr[tid]->check_tid(tid);
-    thr[tid]->init_force(nall,f,torque,erforce,desph,drho);
+    thr[tid]->init_force(nall,f,torque,erforce,desph,drho,fclean);
   } // end of omp parallel region
 
   _reduced = false;
@@ -70,6 +70,7 @@ class FixOMP : public Fix {
   bool _neighbor;   // en/disable threads for neighbor list construction
   bool _mixed;      // whether to prefer mixed precision compute kernels
   bool _reduced;    // whether forces have been reduced for this step
+  int _old_nall;    // atom count covered by that reduction
   bool _pair_compute_flag;    // whether pair_compute is called
   bool _kspace_compute_flag;  // whether kspace_compute is called
 
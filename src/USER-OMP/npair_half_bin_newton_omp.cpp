@@ -41,10 +41,25 @@ void NPairHalfBinNewtonOmp::build(NeighList *list)
   const int moltemplate = (molecular == 2) ? 1 : 0;
 
   NPAIR_OMP_INIT;
+
+  // hand out atoms in chunks from a shared counter (lock-free atomic
+  // fetch-and-add) instead of one fixed range per thread: variable
+  // neighbor counts across density interfaces can otherwise strand a
+  // single thread with most of the work
+  // ~8 chunks per thread balances stealing granularity against
+  // counter traffic; the cap keeps chunks small on huge subdomains
+
+#if defined(_OPENMP)
+  const int chunksize = MAX(1,MIN(512,nlocal/(8*nthreads)+1));
+#else
+  const int chunksize = nlocal;
+#endif
+  int chunk_next = 0;
+
 #if defined(_OPENMP)
-#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(list)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(list,chunk_next)
 #endif
-  NPAIR_OMP_SETUP(nlocal);
+  NPAIR_OMP_SETUP_CHUNKED;
 
   int i,j,k,n,itype,jtype,ibin,which,imol,iatom;
   tagint tagprev;
@@ -73,6 +88,21 @@ void NPairHalfBinNewtonOmp::build(NeighList *list)
   MyPage<int> &ipage = list->ipage[tid];
   ipage.reset();
 
+  // grab the next chunk of atoms until the counter runs past nlocal
+  // any thread may build any atom: firstneigh[i] simply ends up
+  // pointing into the page of whichever thread built it
+
+  for (;;) {
+    int ifrom;
+#if defined(_OPENMP)
+#pragma omp atomic capture
+    { ifrom = chunk_next; chunk_next += chunksize; }
+#else
+    ifrom = chunk_next; chunk_next += chunksize;
+#endif
+    if (ifrom >= nlocal) break;
+    const int ito = MIN(ifrom+chunksize,nlocal);
+
   for (i = ifrom; i < ito; i++) {
 
     n = 0;
@@ -166,6 +196,7 @@ void NPairHalfBinNewtonOmp::build(NeighList *list)
     if (ipage.status())
       error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
   }
+  }
   NPAIR_OMP_CLOSE;
   list->inum = nlocal;
 }
@@ -46,6 +46,15 @@ namespace LAMMPS_NS {
     ThrData *thr = fix->get_thr(tid);           \
     thr->timer(Timer::START);
 
+// get thread id and per-thread data for builds that hand out the
+// iteration range dynamically (see NPairHalfBinNewtonOmp::build)
+#define NPAIR_OMP_SETUP_CHUNKED                 \
+  {                                             \
+    const int tid = omp_get_thread_num();       \
+    FixOMP *fix = static_cast<FixOMP *>(modify->fix[ifix]); \
+    ThrData *thr = fix->get_thr(tid);           \
+    thr->timer(Timer::START);
+
 #define NPAIR_OMP_CLOSE                         \
       thr->timer(Timer::NEIGH);                 \
     }
@@ -59,6 +68,9 @@ namespace LAMMPS_NS {
   const int ifrom = 0;                          \
   const int ito = num
 
+#define NPAIR_OMP_SETUP_CHUNKED                 \
+  const int tid = 0
+
 #define NPAIR_OMP_CLOSE
 
 #endif
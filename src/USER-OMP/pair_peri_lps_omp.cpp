@@ -112,10 +112,11 @@ void PairPeriLPSOMP::eval(int iifrom, int iito, ThrData * const thr)
   double *vfrac = atom->vfrac;
   double *s0 = atom->s0;
   double **x0 = atom->x0;
-  double **r0   = ((FixPeriNeigh *) modify->fix[ifix_peri])->r0;
-  tagint **partner = ((FixPeriNeigh *) modify->fix[ifix_peri])->partner;
-  int *npartner = ((FixPeriNeigh *) modify->fix[ifix_peri])->npartner;
-  double *wvolume = ((FixPeriNeigh *) modify->fix[ifix_peri])->wvolume;
+  FixPeriNeigh *fix_peri_neigh = (FixPeriNeigh *) modify->fix[ifix_peri];
+  double **r0   = fix_peri_neigh->r0;
+  tagint **partner = fix_peri_neigh->partner;
+  int *npartner = fix_peri_neigh->npartner;
+  double *wvolume = fix_peri_neigh->wvolume;
 
   // lc = lattice constant
   // init_style guarantees it's the same in x, y, and z
@@ -252,7 +253,8 @@ void PairPeriLPSOMP::eval(int iifrom, int iito, ThrData * const thr)
 
   // loop over my particles and their partners
   // partner list contains all bond partners, so I-J appears twice
-  // if bond already broken, skip this partner
+  // broken bonds are swapped out of the list, so all entries are live
+  // each thread owns a fixed chunk of atoms, so deletions are thread-safe
   // first = true if this is first neighbor of particle i
 
   bool first;
@@ -270,13 +272,14 @@ void PairPeriLPSOMP::eval(int iifrom, int iito, ThrData * const thr)
     first = true;
 
     for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
       j = atom->map(partner[i][jj]);
 
       // check if lost a partner without first breaking bond
 
       if (j < 0) {
-        partner[i][jj] = 0;
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
         continue;
       }
 
@@ -340,7 +343,11 @@ void PairPeriLPSOMP::eval(int iifrom, int iito, ThrData * const thr)
       // use s0 from previous timestep
 
       stretch = dr / r0[i][jj];
-      if (stretch > MIN(s0[i],s0[j])) partner[i][jj] = 0;
+      if (stretch > MIN(s0[i],s0[j])) {
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
+      }
 
       // update s0 for next timestep
 
@@ -401,9 +408,6 @@ void PairPeriLPSOMP::compute_dilatation_thr(int ifrom, int ito)
 
     for (jj = 0; jj < jnum; jj++) {
 
-      // if bond already broken, skip this partner
-      if (partner[i][jj] == 0) continue;
-
       // Look up local index of this partner particle
       j = atom->map(partner[i][jj]);
 
@@ -108,9 +108,10 @@ void PairPeriPMBOMP::eval(int iifrom, int iito, ThrData * const thr)
   double *vfrac = atom->vfrac;
   double *s0 = atom->s0;
   double **x0 = atom->x0;
-  double **r0   = ((FixPeriNeigh *) modify->fix[ifix_peri])->r0;
-  tagint **partner = ((FixPeriNeigh *) modify->fix[ifix_peri])->partner;
-  int *npartner = ((FixPeriNeigh *) modify->fix[ifix_peri])->npartner;
+  FixPeriNeigh *fix_peri_neigh = (FixPeriNeigh *) modify->fix[ifix_peri];
+  double **r0   = fix_peri_neigh->r0;
+  tagint **partner = fix_peri_neigh->partner;
+  int *npartner = fix_peri_neigh->npartner;
 
   // lc = lattice constant
   // init_style guarantees it's the same in x, y, and z
@@ -214,7 +215,8 @@ void PairPeriPMBOMP::eval(int iifrom, int iito, ThrData * const thr)
 
   // loop over my particles and their partners
   // partner list contains all bond partners, so I-J appears twice
-  // if bond already broken, skip this partner
+  // broken bonds are swapped out of the list, so all entries are live
+  // each thread owns a fixed chunk of atoms, so deletions are thread-safe
   // first = true if this is first neighbor of particle i
 
   bool first;
@@ -229,13 +231,14 @@ void PairPeriPMBOMP::eval(int iifrom, int iito, ThrData * const thr)
     first = true;
 
     for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
       j = atom->map(partner[i][jj]);
 
       // check if lost a partner without first breaking bond
 
       if (j < 0) {
-        partner[i][jj] = 0;
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
         continue;
       }
 
@@ -281,7 +284,11 @@ void PairPeriPMBOMP::eval(int iifrom, int iito, ThrData * const thr)
       // find stretch in bond I-J and break if necessary
       // use s0 from previous timestep
 
-      if (stretch > MIN(s0[i],s0[j])) partner[i][jj] = 0;
+      if (stretch > MIN(s0[i],s0[j])) {
+        fix_peri_neigh->delete_partner(i,jj);
+        jj--;
+        jnum--;
+      }
 
       // update s0 for next timestep
 
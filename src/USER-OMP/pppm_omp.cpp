@@ -26,6 +26,7 @@
 #include "force.h"
 #include "math_const.h"
 #include "math_special.h"
+#include "memory.h"
 #include "timer.h"
 
 #if defined(_OPENMP)
@@ -51,6 +52,10 @@ PPPMOMP::PPPMOMP(LAMMPS *lmp) : PPPM(lmp), ThrOMP(lmp, THR_KSPACE)
 {
   triclinic_support = 1;
   suffix_flag |= Suffix::OMP;
+  fieldforce_overlap_ok = 0;
+
+  bin_off = bin_cnt = bin_atoms = NULL;
+  maxbin = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -72,6 +77,16 @@ void PPPMOMP::allocate()
 #endif
     ThrData *thr = fix->get_thr(tid);
     thr->init_pppm(order,memory);
+
+    // first touch of the density brick by the thread that owns each
+    // slab range in make_rho(), so with first-touch NUMA policy the
+    // pages land in the memory domain of the depositing thread
+
+    int jfrom,jto,jtid;
+    loop_setup_thr(jfrom,jto,jtid,ngrid,comm->nthreads);
+    if (jto > jfrom)
+      memset(&(density_brick[nzlo_out][nylo_out][nxlo_out]) + jfrom,0,
+             (jto-jfrom)*sizeof(FFT_SCALAR));
   }
 }
 
@@ -93,6 +108,10 @@ PPPMOMP::~PPPMOMP()
     ThrData *thr = fix->get_thr(tid);
     thr->init_pppm(-order,memory);
   }
+
+  memory->destroy(bin_off);
+  memory->destroy(bin_cnt);
+  memory->destroy(bin_atoms);
 }
 
 /* ----------------------------------------------------------------------
@@ -338,19 +357,61 @@ void PPPMOMP::compute(int eflag, int vflag)
 
 void PPPMOMP::make_rho()
 {
-
-  // clear 3d density array
-
   FFT_SCALAR * _noalias const d = &(density_brick[nzlo_out][nylo_out][nxlo_out]);
-  memset(d,0,ngrid*sizeof(FFT_SCALAR));
 
-  // no local atoms => nothing else to do
+  // no local atoms => just clear the 3d density array
 
   const int nlocal = atom->nlocal;
-  if (nlocal == 0) return;
+  if (nlocal == 0) {
+    memset(d,0,ngrid*sizeof(FFT_SCALAR));
+    return;
+  }
 
   const int ix = nxhi_out - nxlo_out + 1;
   const int iy = nyhi_out - nylo_out + 1;
+  const int nthreads = comm->nthreads;
+
+  // bin atoms by the thread slab ranges their stencils can reach, so
+  // each thread deposits only its own atoms instead of scanning all of
+  // them. an atom whose stencil straddles a range boundary is binned
+  // to every owner; the range guards in the deposit loop below keep
+  // each grid update on the owning thread. the thread ranges here must
+  // match what loop_setup_thr() hands out inside the parallel region.
+
+  if (bin_off == NULL) {
+    memory->create(bin_off,nthreads+1,"pppm:bin_off");
+    memory->create(bin_cnt,nthreads,"pppm:bin_cnt");
+  }
+
+  const int3_t * _noalias const p2g_bin = (int3_t *) part2grid[0];
+  const int idelta = 1 + ngrid/nthreads;
+
+  for (int t = 0; t <= nthreads; t++) bin_off[t] = 0;
+
+  for (int i = 0; i < nlocal; i++) {
+    const int nz = p2g_bin[i].t;
+    const int tlo = ((nz+nlower-nzlo_out)*ix*iy) / idelta;
+    int thi = ((nz+nupper-nzlo_out+1)*ix*iy - 1) / idelta;
+    if (thi >= nthreads) thi = nthreads-1;
+    for (int t = tlo; t <= thi; t++) bin_off[t+1]++;
+  }
+
+  for (int t = 0; t < nthreads; t++) bin_off[t+1] += bin_off[t];
+
+  if (bin_off[nthreads] > maxbin) {
+    maxbin = bin_off[nthreads];
+    memory->grow(bin_atoms,maxbin,"pppm:bin_atoms");
+  }
+
+  for (int t = 0; t < nthreads; t++) bin_cnt[t] = bin_off[t];
+
+  for (int i = 0; i < nlocal; i++) {
+    const int nz = p2g_bin[i].t;
+    const int tlo = ((nz+nlower-nzlo_out)*ix*iy) / idelta;
+    int thi = ((nz+nupper-nzlo_out+1)*ix*iy - 1) / idelta;
+    if (thi >= nthreads) thi = nthreads-1;
+    for (int t = tlo; t <= thi; t++) bin_atoms[bin_cnt[t]++] = i;
+  }
 
 #if defined(_OPENMP)
 #pragma omp parallel LMP_DEFAULT_NONE
@@ -365,7 +426,7 @@ void PPPMOMP::make_rho()
     const double boxloz = boxlo[2];
 
     // determine range of grid points handled by this thread
-    int i,jfrom,jto,tid;
+    int jfrom,jto,tid;
     loop_setup_thr(jfrom,jto,tid,ngrid,comm->nthreads);
 
     // get per thread data
@@ -373,22 +434,22 @@ void PPPMOMP::make_rho()
     thr->timer(Timer::START);
     FFT_SCALAR * const * const r1d = static_cast<FFT_SCALAR **>(thr->get_rho1d());
 
-    // loop over my charges, add their contribution to nearby grid points
+    // clear my slab range of the density array. no barrier is needed:
+    // the guards below keep every thread inside its own range
+
+    if (jto > jfrom) memset(d+jfrom,0,(jto-jfrom)*sizeof(FFT_SCALAR));
+
+    // loop over my binned charges, add their contribution to nearby grid points
     // (nx,ny,nz) = global coords of grid pt to "lower left" of charge
     // (dx,dy,dz) = distance to "lower left" grid pt
 
-    // loop over all local atoms for all threads
-    for (i = 0; i < nlocal; i++) {
+    for (int b = bin_off[tid]; b < bin_off[tid+1]; b++) {
+      const int i = bin_atoms[b];
 
       const int nx = p2g[i].a;
       const int ny = p2g[i].b;
       const int nz = p2g[i].t;
 
-      // pre-screen whether this atom will ever come within
-      // reach of the data segement this thread is updating.
-      if ( ((nz+nlower-nzlo_out)*ix*iy >= jto)
-           || ((nz+nupper-nzlo_out+1)*ix*iy < jfrom) ) continue;
-
       const FFT_SCALAR dx = nx+shiftone - (x[i].x-boxlox)*delxinv;
       const FFT_SCALAR dy = ny+shiftone - (x[i].y-boxloy)*delyinv;
       const FFT_SCALAR dz = nz+shiftone - (x[i].z-boxloz)*delzinv;
@@ -32,6 +32,11 @@ class PPPMOMP : public PPPM, public ThrOMP {
   virtual void compute(int, int);
 
  protected:
+  int *bin_off;           // CSR offsets of per-thread atom bins
+  int *bin_cnt;           // fill cursors for the bins
+  int *bin_atoms;         // atom indices binned by owning thread slab
+  int maxbin;             // allocated length of bin_atoms
+
   virtual void allocate();
 
   virtual void compute_gf_ik();
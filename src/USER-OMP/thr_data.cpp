@@ -72,7 +72,8 @@ double ThrData::get_time(enum Timer::ttype flag)
 /* ---------------------------------------------------------------------- */
 
 void ThrData::init_force(int nall, double **f, double **torque,
-                         double *erforce, double *de, double *drho)
+                         double *erforce, double *de, double *drho,
+                         int fclean)
 {
   eng_vdwl=eng_coul=eng_bond=eng_angle=eng_dihed=eng_imprp=eng_kspce=0.0;
   memset(virial_pair,0,6*sizeof(double));
@@ -87,7 +88,12 @@ void ThrData::init_force(int nall, double **f, double **torque,
 
   if (nall >= 0 && f) {
     _f = f + _tid*nall;
-    memset(&(_f[0][0]),0,nall*3*sizeof(double));
+
+    // the force reduction zeroes the per-thread copies as it sums them,
+    // so with fclean set only the master copy needs to be cleared
+
+    if (_tid == 0 || !fclean)
+      memset(&(_f[0][0]),0,nall*3*sizeof(double));
   } else _f = NULL;
 
   if (nall >= 0 && torque) {
@@ -301,7 +307,11 @@ void LAMMPS_NS::data_reduce_thr(double *dall, int nall, int nthreads, int ndim,
 #pragma omp barrier
   {
     const int nvals = ndim*nall;
-    const int idelta = nvals/nthreads + 1;
+
+    // align the per-thread slices to multiples of 8 doubles (one cache
+    // line), so the zero-writes of adjacent threads do not false-share
+
+    const int idelta = ((nvals/nthreads + 1) + 7) & ~7;
     const int ifrom = tid*idelta;
     const int ito   = ((ifrom + idelta) > nvals) ? nvals : (ifrom + idelta);
 
@@ -42,7 +42,8 @@ class ThrData {
   double get_time(enum Timer::ttype flag);
 
   // erase accumulator contents and hook up force arrays
-  void init_force(int, double **, double **, double *, double *, double *);
+  void init_force(int, double **, double **, double *, double *, double *,
+                  int fclean=0);
 
   // give access to per-thread offset arrays
   double **get_f() const { return _f; };
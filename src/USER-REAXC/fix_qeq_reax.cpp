@@ -76,8 +76,7 @@ FixQEqReax::FixQEqReax(LAMMPS *lmp, int narg, char **arg) :
   pertype_option = new char[len];
   strcpy(pertype_option,arg[7]);
 
-  // dual CG support only available for USER-OMP variant
-  // check for compatibility is in Fix::post_constructor()
+  // optional dual CG mode solves the s and t systems together
   dual_enabled = 0;
   if (narg == 9) {
     if (strcmp(arg[8],"dual") == 0) dual_enabled = 1;
@@ -162,8 +161,6 @@ FixQEqReax::~FixQEqReax()
 void FixQEqReax::post_constructor()
 {
   pertype_parameters(pertype_option);
-  if (dual_enabled)
-    error->all(FLERR,"Dual keyword only supported with fix qeq/reax/omp");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -507,9 +504,13 @@ void FixQEqReax::pre_force(int /*vflag*/)
 
   init_matvec();
 
-  matvecs_s = CG(b_s, s);       // CG on s - parallel
-  matvecs_t = CG(b_t, t);       // CG on t - parallel
-  matvecs = matvecs_s + matvecs_t;
+  if (dual_enabled) {
+    matvecs = dual_CG(b_s, b_t, s, t);  // fused CG on s & t - parallel
+  } else {
+    matvecs_s = CG(b_s, s);     // CG on s - parallel
+    matvecs_t = CG(b_t, t);     // CG on t - parallel
+    matvecs = matvecs_s + matvecs_t;
+  }
 
   calculate_Q();
 
@@ -786,6 +787,268 @@ void FixQEqReax::sparse_matvec( sparse_matrix *A, double *x, double *b)
 
 }
 
+/* ----------------------------------------------------------------------
+   fused dual-RHS CG, enabled via the dual keyword
+   iterates the s and t systems together, so each iteration traverses
+   the H matrix once, exchanges ghost values once, and issues half the
+   global reductions of two sequential solves
+   when one system converges first, the other is finished with CG()
+------------------------------------------------------------------------- */
+
+int FixQEqReax::dual_CG( double *b1, double *b2, double *x1, double *x2)
+{
+  int i, ii, jj, imax, indxI;
+  double alpha_s, alpha_t, beta_s, beta_t, b_norm_s, b_norm_t;
+  double sig_old_s, sig_old_t, sig_new_s, sig_new_t;
+  double my_buf[4], buf[4];
+
+  int nn;
+  int *ilist;
+  if (reaxc) {
+    nn = reaxc->list->inum;
+    ilist = reaxc->list->ilist;
+  } else {
+    nn = list->inum;
+    ilist = list->ilist;
+  }
+
+  imax = 200;
+
+  pack_flag = 5; // forward 2x d and reverse 2x q
+  dual_sparse_matvec( &H, x1, x2, q );
+  comm->reverse_comm_fix(this); //Coll_Vector( q );
+
+  my_buf[0] = my_buf[1] = my_buf[2] = my_buf[3] = 0.0;
+
+  for (jj = 0; jj < nn; ++jj) {
+    ii = ilist[jj];
+    if (atom->mask[ii] & groupbit) {
+      indxI = 2 * ii;
+      r[indxI  ] = b1[ii] - q[indxI  ];
+      r[indxI+1] = b2[ii] - q[indxI+1];
+
+      d[indxI  ] = r[indxI  ] * Hdia_inv[ii]; //pre-condition
+      d[indxI+1] = r[indxI+1] * Hdia_inv[ii];
+
+      my_buf[0] += b1[ii] * b1[ii];
+      my_buf[1] += b2[ii] * b2[ii];
+      my_buf[2] += r[indxI  ] * d[indxI  ];
+      my_buf[3] += r[indxI+1] * d[indxI+1];
+    }
+  }
+
+  MPI_Allreduce(&my_buf,&buf,4,MPI_DOUBLE,MPI_SUM,world);
+
+  b_norm_s = sqrt(buf[0]);
+  b_norm_t = sqrt(buf[1]);
+  sig_new_s = buf[2];
+  sig_new_t = buf[3];
+
+  for (i = 1; i < imax; ++i) {
+    comm->forward_comm_fix(this); //Dist_vector( d );
+    dual_sparse_matvec( &H, d, q );
+    comm->reverse_comm_fix(this); //Coll_vector( q );
+
+    my_buf[0] = my_buf[1] = 0.0;
+
+    for (jj = 0; jj < nn; ++jj) {
+      ii = ilist[jj];
+      if (atom->mask[ii] & groupbit) {
+        indxI = 2 * ii;
+        my_buf[0] += d[indxI  ] * q[indxI  ];
+        my_buf[1] += d[indxI+1] * q[indxI+1];
+      }
+    }
+
+    MPI_Allreduce(&my_buf,&buf,2,MPI_DOUBLE,MPI_SUM,world);
+
+    alpha_s = sig_new_s / buf[0];
+    alpha_t = sig_new_t / buf[1];
+
+    my_buf[0] = my_buf[1] = 0.0;
+
+    for (jj = 0; jj < nn; ++jj) {
+      ii = ilist[jj];
+      if (atom->mask[ii] & groupbit) {
+        indxI = 2 * ii;
+        x1[ii] += alpha_s * d[indxI  ];
+        x2[ii] += alpha_t * d[indxI+1];
+
+        r[indxI  ] -= alpha_s * q[indxI  ];
+        r[indxI+1] -= alpha_t * q[indxI+1];
+
+        // pre-conditioning
+        p[indxI  ] = r[indxI  ] * Hdia_inv[ii];
+        p[indxI+1] = r[indxI+1] * Hdia_inv[ii];
+
+        my_buf[0] += r[indxI  ] * p[indxI  ];
+        my_buf[1] += r[indxI+1] * p[indxI+1];
+      }
+    }
+
+    sig_old_s = sig_new_s;
+    sig_old_t = sig_new_t;
+
+    MPI_Allreduce(&my_buf,&buf,2,MPI_DOUBLE,MPI_SUM,world);
+
+    sig_new_s = buf[0];
+    sig_new_t = buf[1];
+
+    if (sqrt(sig_new_s)/b_norm_s <= tolerance
+        || sqrt(sig_new_t)/b_norm_t <= tolerance) break;
+
+    beta_s = sig_new_s / sig_old_s;
+    beta_t = sig_new_t / sig_old_t;
+
+    for (jj = 0; jj < nn; ++jj) {
+      ii = ilist[jj];
+      if (atom->mask[ii] & groupbit) {
+        indxI = 2 * ii;
+        d[indxI  ] = p[indxI  ] + beta_s * d[indxI  ];
+        d[indxI+1] = p[indxI+1] + beta_t * d[indxI+1];
+      }
+    }
+  }
+
+  i++;
+  matvecs_s = matvecs_t = i;
+
+  // if one system has not yet converged, finish it with regular CG
+
+  if (sqrt(sig_new_s)/b_norm_s > tolerance) {
+    pack_flag = 2;
+    comm->forward_comm_fix(this); // x1 => s
+
+    i += CG(b1, x1);
+    matvecs_s = i;
+  } else if (sqrt(sig_new_t)/b_norm_t > tolerance) {
+    pack_flag = 3;
+    comm->forward_comm_fix(this); // x2 => t
+
+    i += CG(b2, x2);
+    matvecs_t = i;
+  }
+
+  if (i >= imax && comm->me == 0) {
+    char str[128];
+    sprintf(str,"Fix qeq/reax dual CG convergence failed after %d iterations "
+            "at " BIGINT_FORMAT " step",i,update->ntimestep);
+    error->warning(FLERR,str);
+  }
+
+  return i;
+}
+
+/* ----------------------------------------------------------------------
+   matvec of H against two unpacked vectors x1,x2
+   results interleaved in b as {b1,b2} pairs indexed by 2*atom
+------------------------------------------------------------------------- */
+
+void FixQEqReax::dual_sparse_matvec( sparse_matrix *A, double *x1, double *x2,
+                                     double *b)
+{
+  int i, j, itr_j, indxI, indxJ;
+  int nn, NN, ii;
+  int *ilist;
+
+  if (reaxc) {
+    nn = reaxc->list->inum;
+    NN = reaxc->list->inum + reaxc->list->gnum;
+    ilist = reaxc->list->ilist;
+  } else {
+    nn = list->inum;
+    NN = list->inum + list->gnum;
+    ilist = list->ilist;
+  }
+
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      indxI = 2 * i;
+      b[indxI  ] = eta[ atom->type[i] ] * x1[i];
+      b[indxI+1] = eta[ atom->type[i] ] * x2[i];
+    }
+  }
+
+  for (ii = nn; ii < NN; ++ii) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      indxI = 2 * i;
+      b[indxI  ] = 0;
+      b[indxI+1] = 0;
+    }
+  }
+
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      indxI = 2 * i;
+      for (itr_j=A->firstnbr[i]; itr_j<A->firstnbr[i]+A->numnbrs[i]; itr_j++) {
+        j = A->jlist[itr_j];
+        indxJ = 2 * j;
+        b[indxI  ] += A->val[itr_j] * x1[j];
+        b[indxI+1] += A->val[itr_j] * x2[j];
+        b[indxJ  ] += A->val[itr_j] * x1[i];
+        b[indxJ+1] += A->val[itr_j] * x2[i];
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   matvec of H against one interleaved dual vector x
+------------------------------------------------------------------------- */
+
+void FixQEqReax::dual_sparse_matvec( sparse_matrix *A, double *x, double *b)
+{
+  int i, j, itr_j, indxI, indxJ;
+  int nn, NN, ii;
+  int *ilist;
+
+  if (reaxc) {
+    nn = reaxc->list->inum;
+    NN = reaxc->list->inum + reaxc->list->gnum;
+    ilist = reaxc->list->ilist;
+  } else {
+    nn = list->inum;
+    NN = list->inum + list->gnum;
+    ilist = list->ilist;
+  }
+
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      indxI = 2 * i;
+      b[indxI  ] = eta[ atom->type[i] ] * x[indxI  ];
+      b[indxI+1] = eta[ atom->type[i] ] * x[indxI+1];
+    }
+  }
+
+  for (ii = nn; ii < NN; ++ii) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      indxI = 2 * i;
+      b[indxI  ] = 0;
+      b[indxI+1] = 0;
+    }
+  }
+
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      indxI = 2 * i;
+      for (itr_j=A->firstnbr[i]; itr_j<A->firstnbr[i]+A->numnbrs[i]; itr_j++) {
+        j = A->jlist[itr_j];
+        indxJ = 2 * j;
+        b[indxI  ] += A->val[itr_j] * x[indxJ  ];
+        b[indxI+1] += A->val[itr_j] * x[indxJ+1];
+        b[indxJ  ] += A->val[itr_j] * x[indxI  ];
+        b[indxJ+1] += A->val[itr_j] * x[indxI+1];
+      }
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixQEqReax::calculate_Q()
@@ -119,8 +119,11 @@ class FixQEqReax : public Fix {
   virtual void calculate_Q();
 
   virtual int CG(double*,double*);
+  virtual int dual_CG(double*,double*,double*,double*);
   //int GMRES(double*,double*);
   virtual void sparse_matvec(sparse_matrix*,double*,double*);
+  virtual void dual_sparse_matvec(sparse_matrix*,double*,double*,double*);
+  virtual void dual_sparse_matvec(sparse_matrix*,double*,double*);
 
   virtual int pack_forward_comm(int, int *, double *, int, int *);
   virtual void unpack_forward_comm(int, int, double *);
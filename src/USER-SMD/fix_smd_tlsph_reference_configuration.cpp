@@ -65,6 +65,8 @@ FixSMD_TLSPH_ReferenceConfiguration::FixSMD_TLSPH_ReferenceConfiguration(LAMMPS
         wf_list = NULL;
         energy_per_bond = NULL;
         degradation_ij = NULL;
+        r0_list = NULL;
+        dx0_list = NULL;
         grow_arrays(atom->nmax);
         atom->add_callback(0);
 
@@ -92,6 +94,8 @@ FixSMD_TLSPH_ReferenceConfiguration::~FixSMD_TLSPH_ReferenceConfiguration() {
         memory->destroy(wf_list);
         memory->destroy(degradation_ij);
         memory->destroy(energy_per_bond);
+        memory->destroy(r0_list);
+        memory->destroy(dx0_list);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -271,6 +275,10 @@ void FixSMD_TLSPH_ReferenceConfiguration::setup(int /*vflag*/) {
                         wf_list[i][jj] = 0.0;
                         degradation_ij[i][jj] = 0.0;
                         energy_per_bond[i][jj] = 0.0;
+                        r0_list[i][jj] = 0.0;
+                        dx0_list[i][3 * jj] = 0.0;
+                        dx0_list[i][3 * jj + 1] = 0.0;
+                        dx0_list[i][3 * jj + 2] = 0.0;
                 }
         }
 
@@ -297,14 +305,28 @@ void FixSMD_TLSPH_ReferenceConfiguration::setup(int /*vflag*/) {
                         if (r < h) {
                                 spiky_kernel_and_derivative(h, r, domain->dimension, wf, wfd);
 
+                                // cache reference-configuration geometry per pair;
+                                // it is constant in total-Lagrangian form.
+                                // the neighbor list already resolves periodic images,
+                                // so dx is the minimum-image reference vector.
+                                // stored vectors point from the owning atom to its partner
+
                                 partner[i][npartner[i]] = tag[j];
                                 wfd_list[i][npartner[i]] = wfd;
                                 wf_list[i][npartner[i]] = wf;
+                                r0_list[i][npartner[i]] = r;
+                                dx0_list[i][3 * npartner[i]] = -dx(0);
+                                dx0_list[i][3 * npartner[i] + 1] = -dx(1);
+                                dx0_list[i][3 * npartner[i] + 2] = -dx(2);
                                 npartner[i]++;
                                 if (j < nlocal) {
                                         partner[j][npartner[j]] = tag[i];
                                         wfd_list[j][npartner[j]] = wfd;
                                         wf_list[j][npartner[j]] = wf;
+                                        r0_list[j][npartner[j]] = r;
+                                        dx0_list[j][3 * npartner[j]] = dx(0);
+                                        dx0_list[j][3 * npartner[j] + 1] = dx(1);
+                                        dx0_list[j][3 * npartner[j] + 2] = dx(2);
                                         npartner[j]++;
                                 }
                         }
@@ -359,6 +381,8 @@ double FixSMD_TLSPH_ReferenceConfiguration::memory_usage() {
         bytes += nmax * maxpartner * sizeof(float); // wf_list
         bytes += nmax * maxpartner * sizeof(float); // wfd_list
         bytes += nmax * maxpartner * sizeof(float); // damage_per_interaction array
+        bytes += nmax * maxpartner * sizeof(float); // r0_list
+        bytes += nmax * maxpartner * 3 * sizeof(float); // dx0_list
         bytes += nmax * sizeof(int); // npartner array
         return bytes;
 
@@ -376,6 +400,8 @@ void FixSMD_TLSPH_ReferenceConfiguration::grow_arrays(int nmax) {
         memory->grow(wf_list, nmax, maxpartner, "tlsph_refconfig_neigh:wf");
         memory->grow(degradation_ij, nmax, maxpartner, "tlsph_refconfig_neigh:degradation_ij");
         memory->grow(energy_per_bond, nmax, maxpartner, "tlsph_refconfig_neigh:damage_onset_strain");
+        memory->grow(r0_list, nmax, maxpartner, "tlsph_refconfig_neigh:r0");
+        memory->grow(dx0_list, nmax, 3 * maxpartner, "tlsph_refconfig_neigh:dx0");
 }
 
 /* ----------------------------------------------------------------------
@@ -390,6 +416,10 @@ void FixSMD_TLSPH_ReferenceConfiguration::copy_arrays(int i, int j, int /*delfla
                 wf_list[j][m] = wf_list[i][m];
                 degradation_ij[j][m] = degradation_ij[i][m];
                 energy_per_bond[j][m] = energy_per_bond[i][m];
+                r0_list[j][m] = r0_list[i][m];
+                dx0_list[j][3 * m] = dx0_list[i][3 * m];
+                dx0_list[j][3 * m + 1] = dx0_list[i][3 * m + 1];
+                dx0_list[j][3 * m + 2] = dx0_list[i][3 * m + 2];
         }
 }
 
@@ -411,6 +441,10 @@ int FixSMD_TLSPH_ReferenceConfiguration::pack_exchange(int i, double *buf) {
                 buf[m++] = wf_list[i][n];
                 buf[m++] = degradation_ij[i][n];
                 buf[m++] = energy_per_bond[i][n];
+                buf[m++] = r0_list[i][n];
+                buf[m++] = dx0_list[i][3 * n];
+                buf[m++] = dx0_list[i][3 * n + 1];
+                buf[m++] = dx0_list[i][3 * n + 2];
         }
         return m;
 
@@ -440,6 +474,10 @@ int FixSMD_TLSPH_ReferenceConfiguration::unpack_exchange(int nlocal, double *buf
                 wf_list[nlocal][n] = static_cast<float>(buf[m++]);
                 degradation_ij[nlocal][n] = static_cast<float>(buf[m++]);
                 energy_per_bond[nlocal][n] = static_cast<float>(buf[m++]);
+                r0_list[nlocal][n] = static_cast<float>(buf[m++]);
+                dx0_list[nlocal][3 * n] = static_cast<float>(buf[m++]);
+                dx0_list[nlocal][3 * n + 1] = static_cast<float>(buf[m++]);
+                dx0_list[nlocal][3 * n + 2] = static_cast<float>(buf[m++]);
         }
         return m;
 }
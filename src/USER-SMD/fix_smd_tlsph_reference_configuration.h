@@ -73,6 +73,8 @@ protected:
         tagint **partner;             // global atom IDs for the partners
         float **wfd_list, **wf_list, **energy_per_bond;
         float **degradation_ij; // per-pair interaction degradation status
+        float **r0_list;        // cached reference-configuration pair distances
+        float **dx0_list;       // cached reference-configuration pair vectors, 3 per pair
 
         class Pair *pair;
 
@@ -135,7 +135,6 @@ void PairTlsph::PreCompute() {
         tagint *mol = atom->molecule;
         double *vfrac = atom->vfrac;
         double *radius = atom->radius;
-        double **x0 = atom->x0;
         double **x = atom->x;
         double **v = atom->vest; // extrapolated velocities corresponding to current positions
         double **vint = atom->v; // Velocity-Verlet algorithm velocities
@@ -150,11 +149,12 @@ void PairTlsph::PreCompute() {
         float **wfd_list = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->wfd_list;
         float **wf_list = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->wf_list;
         float **degradation_ij = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->degradation_ij;
-        double r0, r0Sq, wf, wfd, h, irad, voli, volj, scale, shepardWeight;
+        float **r0_list = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->r0_list;
+        float **dx0_list = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->dx0_list;
+        double r0, wf, wfd, h, irad, voli, volj, scale, shepardWeight;
         Vector3d dx, dx0, dv, g;
         Matrix3d Ktmp, Ftmp, Fdottmp, L, U, eye;
-        Vector3d vi, vj, vinti, vintj, xi, xj, x0i, x0j, dvint;
-        int periodic = (domain->xperiodic || domain->yperiodic || domain->zperiodic);
+        Vector3d vi, vj, vinti, vintj, xi, xj, dvint;
         bool status;
         Matrix3d F0;
 
@@ -189,7 +189,6 @@ void PairTlsph::PreCompute() {
                         // initialize Eigen data structures from LAMMPS data structures
                         for (idim = 0; idim < 3; idim++) {
                                 xi(idim) = x[i][idim];
-                                x0i(idim) = x0[i][idim];
                                 vi(idim) = v[i][idim];
                                 vinti(idim) = vint[i][idim];
                         }
@@ -215,20 +214,19 @@ void PairTlsph::PreCompute() {
                                 // initialize Eigen data structures from LAMMPS data structures
                                 for (idim = 0; idim < 3; idim++) {
                                         xj(idim) = x[j][idim];
-                                        x0j(idim) = x0[j][idim];
                                         vj(idim) = v[j][idim];
                                         vintj(idim) = vint[j][idim];
                                 }
-                                dx0 = x0j - x0i;
                                 dx = xj - xi;
 
-                                if (periodic)
-                                        domain->minimum_image(dx0(0), dx0(1), dx0(2));
+                                // reference-configuration geometry is constant in
+                                // total-Lagrangian form; use the cached values
 
-                                r0Sq = dx0.squaredNorm();
+                                for (idim = 0; idim < 3; idim++) {
+                                        dx0(idim) = dx0_list[i][3 * jj + idim];
+                                }
+                                r0 = r0_list[i][jj];
                                 h = irad + radius[j];
-
-                                r0 = sqrt(r0Sq);
                                 volj = vfrac[j];
 
                                 // distance vectors in current and reference configuration, velocity difference
@@ -269,7 +267,9 @@ void PairTlsph::PreCompute() {
                         if (JAUMANN) {
                                 R[i].setIdentity(); // for Jaumann stress rate, we do not need a subsequent rotation back into the reference configuration
                         } else {
-                                status = PolDec(Fincr[i], R[i], U, false); // polar decomposition of the deformation gradient, F = R * U
+                                // polar decomposition of the deformation gradient, F = R * U,
+                                // warm-started from the rotation found on the last timestep
+                                status = PolDecWarm(Fincr[i], R[i], U);
                                 if (!status) {
                                         error->message(FLERR, "Polar decomposition of deformation gradient failed.\n");
                                         mol[i] = -1;
@@ -415,7 +415,6 @@ void PairTlsph::ComputeForces(int eflag, int vflag) {
         tagint *mol = atom->molecule;
         double **x = atom->x;
         double **v = atom->vest;
-        double **x0 = atom->x0;
         double **f = atom->f;
         double *vfrac = atom->vfrac;
         double *desph = atom->desph;
@@ -430,9 +429,8 @@ void PairTlsph::ComputeForces(int eflag, int vflag) {
         double delVdotDelR, visc_magnitude, deltaE, mu_ij, hg_err, gamma_dot_dx, delta, scale;
         double strain1d, strain1d_max, softening_strain, shepardWeight;
         char str[128];
-        Vector3d fi, fj, dx0, dx, dv, f_stress, f_hg, dxp_i, dxp_j, gamma, g, gamma_i, gamma_j, x0i, x0j;
+        Vector3d fi, fj, dx0, dx, dv, f_stress, f_hg, dxp_i, dxp_j, gamma, g, gamma_i, gamma_j;
         Vector3d xi, xj, vi, vj, f_visc, sumForces, f_spring;
-        int periodic = (domain->xperiodic || domain->yperiodic || domain->zperiodic);
 
         tagint **partner = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->partner;
         int *npartner = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->npartner;
@@ -440,6 +438,8 @@ void PairTlsph::ComputeForces(int eflag, int vflag) {
         float **wf_list = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->wf_list;
         float **degradation_ij = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->degradation_ij;
         float **energy_per_bond = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->energy_per_bond;
+        float **r0_list = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->r0_list;
+        float **dx0_list = ((FixSMD_TLSPH_ReferenceConfiguration *) modify->fix[ifix_tlsph])->dx0_list;
         Matrix3d eye;
         eye.setIdentity();
 
@@ -470,7 +470,6 @@ void PairTlsph::ComputeForces(int eflag, int vflag) {
                 shepardWeight = wf * voli;
 
                 for (idim = 0; idim < 3; idim++) {
-                        x0i(idim) = x0[i][idim];
                         xi(idim) = x[i][idim];
                         vi(idim) = v[i][idim];
                 }
@@ -498,20 +497,20 @@ void PairTlsph::ComputeForces(int eflag, int vflag) {
                         }
 
                         for (idim = 0; idim < 3; idim++) {
-                                x0j(idim) = x0[j][idim];
                                 xj(idim) = x[j][idim];
                                 vj(idim) = v[j][idim];
                         }
 
-                        if (periodic)
-                                domain->minimum_image(dx0(0), dx0(1), dx0(2));
+                        // reference-configuration geometry is constant in
+                        // total-Lagrangian form; use the cached values
 
-                        // check that distance between i and j (in the reference config) is less than cutoff
-                        dx0 = x0j - x0i;
-                        r0Sq = dx0.squaredNorm();
+                        for (idim = 0; idim < 3; idim++) {
+                                dx0(idim) = dx0_list[i][3 * jj + idim];
+                        }
+                        r0 = r0_list[i][jj];
+                        r0Sq = r0 * r0;
                         h = radius[i] + radius[j];
                         hMin = MIN(hMin, h);
-                        r0 = sqrt(r0Sq);
                         volj = vfrac[j];
 
                         // distance vectors in current and reference configuration, velocity difference
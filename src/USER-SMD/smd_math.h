@@ -98,6 +98,61 @@ static inline bool PolDec(Eigen::Matrix3d M, Eigen::Matrix3d &R, Eigen::Matrix3d
         }
 }
 
+/*
+ * Warm-started polar decomposition M = R * T.
+ *
+ * R passes in a rotation guess (e.g. the rotation found on the previous
+ * timestep) and returns the rotation factor.  The orthogonal factor Q of
+ * Rg^T * M is computed with the Higham iteration X <- 0.5 * (X + X^-T);
+ * because Rg^T * M is nearly symmetric positive definite for a good guess,
+ * the iteration converges quadratically within a few steps, much cheaper
+ * than a full SVD.  The rotation is then R = Rg * Q.  Falls back to the
+ * SVD-based PolDec() whenever the guess is not a proper rotation, M is
+ * inverted, or the iteration fails to converge.
+ */
+
+static inline bool PolDecWarm(const Eigen::Matrix3d M, Eigen::Matrix3d &R, Eigen::Matrix3d &T) {
+
+        Eigen::Matrix3d Rg = R;
+        Eigen::Matrix3d eye;
+        eye.setIdentity();
+
+        if ((M.determinant() <= 0.0) || (fabs(Rg.determinant() - 1.0) > 1.0e-3)
+                        || ((Rg * Rg.transpose() - eye).norm() > 1.0e-6)) {
+                return PolDec(M, R, T, false);
+        }
+
+        Eigen::Matrix3d X = Rg.transpose() * M;
+        Eigen::Matrix3d Xnew;
+        bool converged = false;
+
+        for (int k = 0; k < 8; k++) {
+                if (fabs(X.determinant()) < 1.0e-16) {
+                        break;
+                }
+                Xnew = 0.5 * (X + X.inverse().transpose());
+                double delta = (Xnew - X).norm();
+                X = Xnew;
+                if (delta < 1.0e-12) {
+                        converged = true;
+                        break;
+                }
+        }
+
+        if (!converged) {
+                return PolDec(M, R, T, false);
+        }
+
+        R = Rg * X;
+        Eigen::Matrix3d Tsym = R.transpose() * M;
+        T = 0.5 * (Tsym + Tsym.transpose()); // symmetrize the stretch
+
+        if (R.determinant() > 0.0) {
+                return true;
+        }
+        return PolDec(M, R, T, false);
+}
+
 /*
  * Pseudo-inverse via SVD
  */
@@ -55,18 +55,26 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
 {
   natoms = 0;
   nlocal = nghost = nmax = 0;
+  view_epoch = 0;
   ntypes = 0;
   nellipsoids = nlines = ntris = nbodies = 0;
   nbondtypes = nangletypes = ndihedraltypes = nimpropertypes = 0;
   nbonds = nangles = ndihedrals = nimpropers = 0;
 
   firstgroupname = NULL;
+  f_det_flag = 0;
+  f_det_scale = 4294967296.0;        // 32.32 fixed point
+  f_det = NULL;
+  maxdet = 0;
   sortfreq = 1000;
   nextsort = 0;
   userbinsize = 0.0;
+  sortstyle = 0;
   maxbin = maxnext = 0;
   binhead = NULL;
   next = permute = NULL;
+  binorder = NULL;
+  maxbinorder = 0;
 
   // data structure with info on per-atom vectors/arrays
 
@@ -221,6 +229,8 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
   map_style = map_user = 0;
   map_tag_max = -1;
   map_maxarray = map_nhash = map_nbucket = -1;
+  map_nflat = map_flatmask = 0;
+  map_flat = NULL;
 
   max_same = 0;
   sametag = NULL;
@@ -255,6 +265,7 @@ Atom::~Atom()
   memory->destroy(binhead);
   memory->destroy(next);
   memory->destroy(permute);
+  memory->destroy(binorder);
 
   memory->destroy(tag);
   memory->destroy(type);
@@ -263,6 +274,7 @@ Atom::~Atom()
   memory->destroy(x);
   memory->destroy(v);
   memory->destroy(f);
+  memory->destroy(f_det);
 
   // delete peratom data struct
 
@@ -328,6 +340,7 @@ void Atom::settings(Atom *old)
   tag_enable = old->tag_enable;
   map_user = old->map_user;
   map_style = old->map_style;
+  f_det_flag = old->f_det_flag;
   sortfreq = old->sortfreq;
   userbinsize = old->userbinsize;
   if (old->firstgroupname) {
@@ -743,6 +756,19 @@ void Atom::init()
       error->all(FLERR,"Could not find atom_modify first group ID");
   } else firstgroup = -1;
 
+  // deterministic force mode is only wired into plain Verlet runs
+  // with brick communication
+
+  if (f_det_flag) {
+    if (comm->style != 0)
+      error->all(FLERR,
+                 "Atom_modify deterministic requires comm_style brick");
+    if (update->whichflag == 2 ||
+        utils::strmatch(update->integrate_style,"^respa"))
+      error->all(FLERR,
+                 "Atom_modify deterministic requires run_style verlet");
+  }
+
   // init AtomVec
 
   avec->init();
@@ -804,6 +830,7 @@ void Atom::modify_params(int narg, char **arg)
       if (strcmp(arg[iarg+1],"array") == 0) map_user = 1;
       else if (strcmp(arg[iarg+1],"hash") == 0) map_user = 2;
       else if (strcmp(arg[iarg+1],"yes") == 0) map_user = 3;
+      else if (strcmp(arg[iarg+1],"flat") == 0) map_user = 4;
       else error->all(FLERR,"Illegal atom_modify command");
       map_style = map_user;
       iarg += 2;
@@ -829,10 +856,56 @@ void Atom::modify_params(int narg, char **arg)
         error->all(FLERR,"Atom_modify sort and first options "
                    "cannot be used together");
       iarg += 3;
+      if (iarg < narg) {
+        if (strcmp(arg[iarg],"bin") == 0) {
+          sortstyle = 0;
+          iarg++;
+        } else if (strcmp(arg[iarg],"sfc") == 0) {
+          sortstyle = 1;
+          iarg++;
+        }
+      }
+    } else if (strcmp(arg[iarg],"deterministic") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal atom_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) f_det_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) f_det_flag = 0;
+      else error->all(FLERR,"Illegal atom_modify command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal atom_modify command");
   }
 }
 
+/* ----------------------------------------------------------------------
+   zero the fixed-point force accumulators for owned + ghost atoms
+   grow them on demand, sized like other per-atom arrays
+------------------------------------------------------------------------- */
+
+void Atom::det_force_clear()
+{
+  int nall = nlocal + nghost;
+  if (nall > maxdet) {
+    memory->destroy(f_det);
+    maxdet = nmax;
+    memory->create(f_det,maxdet,3,"atom:f_det");
+  }
+  if (nall) memset(&f_det[0][0],0,3*nall*sizeof(int64_t));
+}
+
+/* ----------------------------------------------------------------------
+   fold the fixed-point accumulators into f for owned atoms
+   called once per step after the ghost contributions were summed
+------------------------------------------------------------------------- */
+
+void Atom::det_force_sum()
+{
+  double inv_scale = 1.0/f_det_scale;
+  for (int i = 0; i < nlocal; i++) {
+    f[i][0] += f_det[i][0]*inv_scale;
+    f[i][1] += f_det[i][1]*inv_scale;
+    f[i][2] += f_det[i][2]*inv_scale;
+  }
+}
+
 /* ----------------------------------------------------------------------
    check that atom IDs are valid
    error if any atom ID < 0 or atom ID = MAXTAGINT
@@ -1022,7 +1095,8 @@ void Atom::deallocate_topology()
 ------------------------------------------------------------------------- */
 
 void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
-                      int type_offset, int shiftflag, double *shift)
+                      int type_offset, int shiftflag, double *shift,
+                      int anywhere)
 {
   int m,xptr,iptr;
   imageint imagedata;
@@ -1149,9 +1223,14 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
       coord = lamda;
     } else coord = xdata;
 
-    if (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
-        coord[1] >= sublo[1] && coord[1] < subhi[1] &&
-        coord[2] >= sublo[2] && coord[2] < subhi[2]) {
+    // anywhere = 1 if caller routed each line to its owning proc already
+    // then accept unconditionally, an atom misplaced by round-off is
+    // migrated to the neighbor proc by the first comm->exchange()
+
+    if (anywhere ||
+        (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
+         coord[1] >= sublo[1] && coord[1] < subhi[1] &&
+         coord[2] >= sublo[2] && coord[2] < subhi[2])) {
       avec->data_atom(xdata,imagedata,values);
       if (id_offset) tag[nlocal-1] += id_offset;
       if (mol_offset) molecule[nlocal-1] += mol_offset;
@@ -1995,6 +2074,10 @@ void Atom::sort()
 
   nextsort = (update->ntimestep/sortfreq)*sortfreq + sortfreq;
 
+  // atoms are about to be reordered, invalidate external views
+
+  view_epoch++;
+
   // re-setup sort bins if needed
 
   if (domain->box_change) setup_sort_bins();
@@ -2036,9 +2119,11 @@ void Atom::sort()
   // permute = desired permutation of atoms
   // permute[I] = J means Ith new atom will be Jth old atom
 
+  // visit bins in row-major or Morton-curve order
+
   n = 0;
   for (m = 0; m < nbins; m++) {
-    i = binhead[m];
+    i = binhead[(sortstyle == 1) ? binorder[m] : m];
     while (i >= 0) {
       permute[n++] = i;
       i = next[i];
@@ -2192,6 +2277,49 @@ void Atom::setup_sort_bins()
     maxbin = nbins;
     memory->create(binhead,maxbin,"atom:binhead");
   }
+
+  // for sfc sorting, precompute bin visit order along a Morton curve
+  // so spatially close bins stay close in the new atom ordering
+
+  if (sortstyle == 1) {
+    if (nbins > maxbinorder) {
+      memory->destroy(binorder);
+      maxbinorder = nbins;
+      memory->create(binorder,maxbinorder,"atom:binorder");
+    }
+
+    uint64_t *keys;
+    memory->create(keys,nbins,"atom:sortkeys");
+
+    int m = 0;
+    for (int iz = 0; iz < nbinz; iz++)
+      for (int iy = 0; iy < nbiny; iy++)
+        for (int ix = 0; ix < nbinx; ix++) {
+          keys[m] = morton3(ix,iy,iz);
+          binorder[m] = m;
+          m++;
+        }
+
+    std::sort(binorder,binorder+nbins,
+              [keys](int a, int b) { return keys[a] < keys[b]; });
+
+    memory->destroy(keys);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   interleave the low 21 bits of ix,iy,iz into a 63-bit Morton key
+------------------------------------------------------------------------- */
+
+uint64_t Atom::morton3(int ix, int iy, int iz)
+{
+  uint64_t key = 0;
+  for (int b = 0; b < 21; b++) {
+    key |= ((uint64_t) (ix >> b) & 1) << (3*b);
+    key |= ((uint64_t) (iy >> b) & 1) << (3*b + 1);
+    key |= ((uint64_t) (iz >> b) & 1) << (3*b + 2);
+  }
+  return key;
 }
 
 /* ----------------------------------------------------------------------
@@ -2485,6 +2613,8 @@ bigint Atom::memory_usage()
   else if (map_style == 2) {
     bytes += map_nbucket*sizeof(int);
     bytes += map_nhash*sizeof(HashElem);
+  } else if (map_style == 4) {
+    bytes += map_nflat*sizeof(FlatElem);
   }
   if (maxnext) {
     bytes += memory->usage(next,maxnext);
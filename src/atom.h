@@ -33,6 +33,9 @@ class Atom : protected Pointers {
                                 // natoms may not be current if atoms lost
   int nlocal,nghost;            // # of owned and ghost atoms on this proc
   int nmax;                     // max # of owned+ghost in arrays on this proc
+  bigint view_epoch;            // incremented whenever per-atom arrays are
+                                // reallocated, reordered or migrated, so
+                                // external views can detect staleness
   int tag_enable;               // 0/1 if atom ID tags are defined
   int molecular;                // 0 = atomic, 1 = standard molecular system,
                                 // 2 = molecule template system
@@ -252,17 +255,27 @@ class Atom : protected Pointers {
   int nextra_border_max;
   int nextra_store;
 
-  int map_style;                  // style of atom map: 0=none, 1=array, 2=hash
+  int map_style;                  // style of atom map:
+                                  // 0=none, 1=array, 2=hash, 4=flat
   int map_user;                   // user requested map style:
-                                  // 0 = no request, 1=array, 2=hash, 3=yes
+                                  // 0 = no request, 1=array, 2=hash,
+                                  // 3=yes, 4=flat
   tagint map_tag_max;             // max atom ID that map() is setup for
   std::set<tagint> *unique_tags;  // set to ensure that bodies have unique tags
 
+  // deterministic fixed-point force accumulation
+
+  int f_det_flag;           // 1 if forces accumulate into fixed-point f_det
+  double f_det_scale;       // fixed-point units per force unit
+  int64_t **f_det;          // per-atom fixed-point force accumulators
+  int maxdet;               // allocated # of rows in f_det
+
   // spatial sorting of atoms
 
   int sortfreq;             // sort atoms every this many steps, 0 = off
   bigint nextsort;          // next timestep to sort on
   double userbinsize;       // requested sort bin size
+  int sortstyle;            // 0 = row-major bin order, 1 = Morton curve
 
   // indices of atoms with same ID
 
@@ -292,6 +305,9 @@ class Atom : protected Pointers {
   void init();
   void setup();
 
+  void det_force_clear();
+  void det_force_sum();
+
   class AtomVec *style_match(const char *);
   void modify_params(int, char **);
   void tag_check();
@@ -304,7 +320,7 @@ class Atom : protected Pointers {
 
   void deallocate_topology();
 
-  void data_atoms(int, char *, tagint, tagint, int, int, double *);
+  void data_atoms(int, char *, tagint, tagint, int, int, double *, int anywhere = 0);
   void data_vels(int, char *, tagint);
   void data_bonds(int, char *, int *, tagint, int);
   void data_angles(int, char *, int *, tagint, int);
@@ -346,6 +362,18 @@ class Atom : protected Pointers {
 
   void *extract(char *);
 
+  // flat views of per-atom coordinate/velocity/force storage
+  // 2d arrays from memory->create/grow are a single contiguous data
+  //   block, so row 0 spans 3*nmax doubles as x0 y0 z0 x1 y1 z1 ...
+  // owned atoms occupy rows [0,nlocal), ghost atoms are packed into
+  //   rows [nlocal,nlocal+nghost) with no holes after borders
+  // kernels may rely on this layout for unit-stride vector loads
+  //   w/out a row-pointer dereference per atom
+
+  inline double *x_flat() {return x ? &x[0][0] : NULL;};
+  inline double *v_flat() {return v ? &v[0][0] : NULL;};
+  inline double *f_flat() {return f ? &f[0][0] : NULL;};
+
   inline int* get_map_array() {return map_array;};
   inline int get_map_size() {return map_tag_max+1;};
   inline int get_max_same() {return max_same;};
@@ -363,6 +391,7 @@ class Atom : protected Pointers {
   inline int map(tagint global) {
     if (map_style == 1) return map_array[global];
     else if (map_style == 2) return map_find_hash(global);
+    else if (map_style == 4) return map_find_flat(global);
     else return -1;
   };
 
@@ -373,6 +402,8 @@ class Atom : protected Pointers {
   int map_style_set();
   void map_delete();
   int map_find_hash(tagint);
+  int map_find_flat(tagint);
+  void map_find_owners(int, tagint *, int *);
 
  protected:
 
@@ -381,18 +412,44 @@ class Atom : protected Pointers {
   int *map_array;       // direct map via array that holds map_tag_max
   int map_maxarray;     // allocated size of map_array (1 larger than this)
 
+  // one datum in the rendezvous comm of map_find_owners()
+
+  struct OwnerRvous {
+    tagint ID;          // atom ID being declared or queried
+    int proc;           // owning proc, or querying proc for a query
+    int index;          // index in the querying proc's list, -1 = owner
+  };
+
+  static int rendezvous_owners(int, char *, int &, int *&, char *&, void *);
+
   struct HashElem {     // hashed map
     tagint global;      // key to search on = global ID
     int local;          // value associated with key = local index
     int next;           // next entry in this bucket, -1 if last
   };
-  int map_nhash;        // # of entries hash table can hold
+  int map_nhash;        // # of entries hash or flat table can hold
   int map_nused;        // # of actual entries in hash table
   int map_free;         // ptr to 1st unused entry in hash table
   int map_nbucket;      // # of hash buckets
   int *map_bucket;      // ptr to 1st entry in each bucket
   HashElem *map_hash;   // hash table
 
+  struct FlatElem {     // open-addressing map, tag/value interleaved
+    tagint global;      // key to search on = global ID, -1 if slot empty
+    int local;          // value associated with key = local index
+  };
+  int map_nflat;        // # of slots in flat table, power of 2
+  int map_flatmask;     // map_nflat-1, masks hash to a slot index
+  FlatElem *map_flat;   // flat table, probed linearly from hashed slot
+
+  // multiplicative hash of global ID to initial slot in flat table
+  // Fibonacci constant scatters clustered IDs, mask keeps top-bit entropy
+
+  inline int map_bin_flat(tagint global) {
+    uint64_t h = (uint64_t) global * 0x9E3779B97F4A7C15ULL;
+    return (int) ((h >> 32) & map_flatmask);
+  };
+
   int max_same;         // allocated size of sametag
 
   // spatial sorting of atoms
@@ -404,11 +461,14 @@ class Atom : protected Pointers {
   int *binhead;                   // 1st atom in each bin
   int *next;                      // next atom in bin
   int *permute;                   // permutation vector
+  int *binorder;                  // bin visit order for Morton-curve sort
+  int maxbinorder;                // allocated size of binorder
   double bininvx,bininvy,bininvz; // inverse actual bin sizes
   double bboxlo[3],bboxhi[3];     // bounding box of my sub-domain
 
   void set_atomflag_defaults();
   void setup_sort_bins();
+  static uint64_t morton3(int, int, int);
   int next_prime(int);
 
  private:
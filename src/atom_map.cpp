@@ -14,6 +14,7 @@
 #include "atom.h"
 #include <mpi.h>
 #include <cmath>
+#include <map>
 #include "comm.h"
 #include "memory.h"
 #include "error.h"
@@ -22,6 +23,8 @@ using namespace LAMMPS_NS;
 
 #define EXTRA 1000
 
+#define RVOUS 1   // 0 for irregular, 1 for all2all
+
 /* ----------------------------------------------------------------------
    allocate and initialize array or hash table for global -> local map
    for array option:
@@ -31,6 +34,10 @@ using namespace LAMMPS_NS;
      map_nhash = length of hash table
      map_nbucket = # of hash buckets, prime larger than map_nhash * 2
        so buckets will only be filled with 0 or 1 atoms on average
+   for flat option:
+     single open-addressing table with interleaved ID/index pairs
+     map_nflat = # of slots, power of 2 at least twice map_nhash
+       so linear probes from the hashed slot stay short
 ------------------------------------------------------------------------- */
 
 void Atom::map_init(int check)
@@ -45,20 +52,25 @@ void Atom::map_init(int check)
 
   if (map_style == 1 && map_tag_max > map_maxarray) recreate = 1;
   else if (map_style == 2 && nlocal+nghost > map_nhash) recreate = 1;
+  else if (map_style == 4 && nlocal+nghost > map_nhash) recreate = 1;
 
   // if not recreating:
   // for array, initialize current map_tag_max values
   // for hash, set all buckets to empty, put all entries in free list
+  // for flat, set all slots to empty
 
   if (!recreate) {
     if (map_style == 1) {
       for (int i = 0; i <= map_tag_max; i++) map_array[i] = -1;
-    } else {
+    } else if (map_style == 2) {
       for (int i = 0; i < map_nbucket; i++) map_bucket[i] = -1;
       map_nused = 0;
       map_free = 0;
       for (int i = 0; i < map_nhash; i++) map_hash[i].next = i+1;
       if (map_nhash > 0) map_hash[map_nhash-1].next = -1;
+    } else {
+      for (int i = 0; i < map_nflat; i++) map_flat[i].global = -1;
+      map_nused = 0;
     }
 
   // recreating: delete old map and create new one for array or hash
@@ -83,24 +95,41 @@ void Atom::map_init(int check)
       map_nhash *= 2;
       map_nhash = MAX(map_nhash,1000);
 
-      // map_nbucket = prime just larger than map_nhash
-      // next_prime() should be fast enough,
-      //   about 10% of odd integers are prime above 1M
+      if (map_style == 2) {
 
-      map_nbucket = next_prime(map_nhash);
+        // map_nbucket = prime just larger than map_nhash
+        // next_prime() should be fast enough,
+        //   about 10% of odd integers are prime above 1M
 
-      // set all buckets to empty
-      // set hash to map_nhash in length
-      // put all hash entries in free list and point them to each other
+        map_nbucket = next_prime(map_nhash);
 
-      map_bucket = new int[map_nbucket];
-      for (int i = 0; i < map_nbucket; i++) map_bucket[i] = -1;
+        // set all buckets to empty
+        // set hash to map_nhash in length
+        // put all hash entries in free list and point them to each other
 
-      map_hash = new HashElem[map_nhash];
-      map_nused = 0;
-      map_free = 0;
-      for (int i = 0; i < map_nhash; i++) map_hash[i].next = i+1;
-      map_hash[map_nhash-1].next = -1;
+        map_bucket = new int[map_nbucket];
+        for (int i = 0; i < map_nbucket; i++) map_bucket[i] = -1;
+
+        map_hash = new HashElem[map_nhash];
+        map_nused = 0;
+        map_free = 0;
+        for (int i = 0; i < map_nhash; i++) map_hash[i].next = i+1;
+        map_hash[map_nhash-1].next = -1;
+
+      } else {
+
+        // map_nflat = power of 2 >= 2*map_nhash
+        //   so table is at most half full and probe runs stay O(1)
+        // set all slots to empty
+
+        map_nflat = 1;
+        while (map_nflat < 2*map_nhash) map_nflat *= 2;
+        map_flatmask = map_nflat - 1;
+
+        map_flat = new FlatElem[map_nflat];
+        for (int i = 0; i < map_nflat; i++) map_flat[i].global = -1;
+        map_nused = 0;
+      }
     }
   }
 }
@@ -109,6 +138,8 @@ void Atom::map_init(int check)
    clear global -> local map for all of my own and ghost atoms
    for hash table option:
      global ID may not be in table if image atom was already cleared
+   for flat option:
+     reset the whole table, since open addressing cannot delete keys
 ------------------------------------------------------------------------- */
 
 void Atom::map_clear()
@@ -120,6 +151,17 @@ void Atom::map_clear()
       map_array[tag[i]] = -1;
     }
 
+  } else if (map_style == 4) {
+
+    // wipe entire flat table rather than deleting per-key
+    // open addressing cannot remove keys w/out disturbing probe runs
+    // table is only 2x larger than # of keys, so wipe is cheap
+
+    int nall = nlocal + nghost;
+    for (int i = 0; i < nall; i++) sametag[i] = -1;
+    for (int i = 0; i < map_nflat; i++) map_flat[i].global = -1;
+    map_nused = 0;
+
   } else {
     int previous,ibucket,index;
     tagint global;
@@ -184,6 +226,38 @@ void Atom::map_set()
       map_array[tag[i]] = i;
     }
 
+  } else if (map_style == 4) {
+
+    // if this proc has more atoms than flat table is sized for,
+    //   call map_init() as for hash style below
+
+    if (nall > map_nhash) map_init(0);
+    if (nall > max_same) {
+      max_same = nall + EXTRA;
+      memory->destroy(sametag);
+      memory->create(sametag,max_same,"atom:sametag");
+    }
+
+    int ibin;
+    tagint global;
+
+    for (int i = nall-1; i >= 0 ; i--) {
+      sametag[i] = map_find_flat(tag[i]);
+
+      // probe linearly from hashed slot for key or 1st empty slot
+      // if found key, just overwrite local value with index
+
+      global = tag[i];
+      ibin = map_bin_flat(global);
+      while (map_flat[ibin].global >= 0 && map_flat[ibin].global != global)
+        ibin = (ibin+1) & map_flatmask;
+      if (map_flat[ibin].global < 0) {
+        map_flat[ibin].global = global;
+        map_nused++;
+      }
+      map_flat[ibin].local = i;
+    }
+
   } else {
 
     // if this proc has more atoms than hash table size, call map_init()
@@ -247,7 +321,21 @@ void Atom::map_set()
 void Atom::map_one(tagint global, int local)
 {
   if (map_style == 1) map_array[global] = local;
-  else {
+  else if (map_style == 4) {
+
+    // probe linearly from hashed slot for key or 1st empty slot
+    // if found key, just overwrite local value with index
+
+    int ibin = map_bin_flat(global);
+    while (map_flat[ibin].global >= 0 && map_flat[ibin].global != global)
+      ibin = (ibin+1) & map_flatmask;
+    if (map_flat[ibin].global < 0) {
+      map_flat[ibin].global = global;
+      map_nused++;
+    }
+    map_flat[ibin].local = local;
+
+  } else {
     // search for key
     // if found it, just overwrite local value with index
 
@@ -304,7 +392,7 @@ int Atom::map_style_set()
   // else use array
 
   int map_style_old = map_style;
-  if (map_user == 1 || map_user == 2) map_style = map_user;
+  if (map_user == 1 || map_user == 2 || map_user == 4) map_style = map_user;
   else if (map_tag_max > 1000000 && !lmp->kokkos) map_style = 2;
   else map_style = 1;
 
@@ -328,6 +416,13 @@ void Atom::map_delete()
   if (map_style == 1) {
     memory->destroy(map_array);
     map_array = NULL;
+  } else if (map_style == 4) {
+    if (map_nflat) {
+      delete [] map_flat;
+      map_flat = NULL;
+    }
+    map_nflat = map_flatmask = 0;
+    map_nhash = 0;
   } else {
     if (map_nhash) {
       delete [] map_bucket;
@@ -358,6 +453,24 @@ int Atom::map_find_hash(tagint global)
   return local;
 }
 
+/* ----------------------------------------------------------------------
+   lookup global ID in flat open-addressing table, return local index
+   linear probe from hashed slot, ends at key or 1st empty slot
+   table is at most half full, so probe runs are short and contiguous
+     in memory, typically 1 cache line per lookup
+   called by map() in atom.h
+------------------------------------------------------------------------- */
+
+int Atom::map_find_flat(tagint global)
+{
+  int ibin = map_bin_flat(global);
+  while (map_flat[ibin].global >= 0) {
+    if (map_flat[ibin].global == global) return map_flat[ibin].local;
+    ibin = (ibin+1) & map_flatmask;
+  }
+  return -1;
+}
+
 /* ----------------------------------------------------------------------
    return next prime larger than n
 ------------------------------------------------------------------------- */
@@ -379,3 +492,105 @@ int Atom::next_prime(int n)
 
   return MAXSMALLINT;
 }
+
+/* ----------------------------------------------------------------------
+   distributed tag directory query: find the owning proc of N atom IDs
+   the local map only covers local+ghost atoms, so resolving arbitrary
+     remote IDs otherwise needs a P-stage ring over all procs
+   each ID is routed to a director proc chosen by hashing the ID, which
+     matches it against ownership records sent by all procs and replies
+     to the requesting proc = two comm stages independent of proc count
+   owner[i] = rank of the proc owning ids[i], -1 if no such atom
+   collective: all procs must call this, even with n = 0
+------------------------------------------------------------------------- */
+
+void Atom::map_find_owners(int n, tagint *ids, int *owner)
+{
+  int i;
+  int me = comm->me;
+  int nprocs = comm->nprocs;
+
+  // one ownership record per owned atom + one query record per ID
+
+  int nsend = nlocal + n;
+  int *proclist;
+  memory->create(proclist,nsend,"atom:proclist");
+  OwnerRvous *inbuf = (OwnerRvous *)
+    memory->smalloc((bigint) nsend*sizeof(OwnerRvous),"atom:inbuf");
+
+  for (i = 0; i < nlocal; i++) {
+    proclist[i] = tag[i] % nprocs;
+    inbuf[i].ID = tag[i];
+    inbuf[i].proc = me;
+    inbuf[i].index = -1;
+  }
+
+  for (i = 0; i < n; i++) {
+    proclist[nlocal+i] = ids[i] % nprocs;
+    inbuf[nlocal+i].ID = ids[i];
+    inbuf[nlocal+i].proc = me;
+    inbuf[nlocal+i].index = i;
+  }
+
+  // perform rendezvous operation
+  // each returned datum = the owner of one of my queried IDs
+
+  char *buf;
+  int nreturn = comm->rendezvous(RVOUS,nsend,(char *) inbuf,
+                                 sizeof(OwnerRvous),0,proclist,
+                                 rendezvous_owners,0,buf,
+                                 sizeof(OwnerRvous),(void *) this);
+  OwnerRvous *outbuf = (OwnerRvous *) buf;
+
+  memory->destroy(proclist);
+  memory->sfree(inbuf);
+
+  for (i = 0; i < n; i++) owner[i] = -1;
+  for (i = 0; i < nreturn; i++) owner[outbuf[i].index] = outbuf[i].proc;
+  memory->sfree(outbuf);
+}
+
+/* ----------------------------------------------------------------------
+   callback from rendezvous operation in map_find_owners()
+   inbuf = list of datums: ownership records and query records
+   build hash of ID -> owner from the ownership records,
+     answer each query record with a reply routed to the requester
+------------------------------------------------------------------------- */
+
+int Atom::rendezvous_owners(int n, char *inbuf, int &flag, int *&proclist,
+                            char *&outbuf, void *ptr)
+{
+  Atom *aptr = (Atom *) ptr;
+  Memory *memory = aptr->memory;
+
+  OwnerRvous *in = (OwnerRvous *) inbuf;
+
+  std::map<tagint,int> hash;
+  int nquery = 0;
+  for (int i = 0; i < n; i++) {
+    if (in[i].index < 0) hash[in[i].ID] = in[i].proc;
+    else nquery++;
+  }
+
+  memory->create(proclist,nquery,"atom:proclist");
+  OwnerRvous *out = (OwnerRvous *)
+    memory->smalloc((bigint) nquery*sizeof(OwnerRvous),"atom:outbuf");
+
+  nquery = 0;
+  for (int i = 0; i < n; i++) {
+    if (in[i].index < 0) continue;
+    proclist[nquery] = in[i].proc;
+    out[nquery].ID = in[i].ID;
+    std::map<tagint,int>::iterator pos = hash.find(in[i].ID);
+    if (pos == hash.end()) out[nquery].proc = -1;
+    else out[nquery].proc = pos->second;
+    out[nquery].index = in[i].index;
+    nquery++;
+  }
+
+  // flag = 2: new outbuf
+
+  outbuf = (char *) out;
+  flag = 2;
+  return nquery;
+}
@@ -241,6 +241,7 @@ void AtomVec::grow(int n)
   if (n == 0) grow_nmax();
   else nmax = n;
   atom->nmax = nmax;
+  atom->view_epoch++;
   if (nmax < 0 || nmax > MAXSMALLINT)
     error->one(FLERR,"Per-processor system is too big");
 
@@ -302,6 +303,8 @@ void AtomVec::copy(int i, int j, int delflag)
   int m,n,datatype,cols,collength,ncols;
   void *pdata,*plength;
 
+  atom->view_epoch++;
+
   tag[j] = tag[i];
   type[j] = type[i];
   mask[j] = mask[i];
@@ -407,11 +410,18 @@ int AtomVec::pack_comm(int n, int *list, double *buf,
       dy = pbc[1]*domain->yprd + pbc[3]*domain->yz;
       dz = pbc[2]*domain->zprd;
     }
+    // gather coords first, then apply shift in one vectorizable sweep
+
     for (i = 0; i < n; i++) {
       j = list[i];
-      buf[m++] = x[j][0] + dx;
-      buf[m++] = x[j][1] + dy;
-      buf[m++] = x[j][2] + dz;
+      buf[m++] = x[j][0];
+      buf[m++] = x[j][1];
+      buf[m++] = x[j][2];
+    }
+    for (i = 0; i < m; i += 3) {
+      buf[i] += dx;
+      buf[i+1] += dy;
+      buf[i+2] += dz;
     }
   }
 
@@ -602,13 +612,16 @@ void AtomVec::unpack_comm(int n, int first, double *buf)
   int i,m,last,mm,nn,datatype,cols;
   void *pdata;
 
+  if (n == 0) return;
+
+  // x and per-atom double arrays are allocated contiguously,
+  // so copies over a contiguous range of atoms are single memcpy spans
+  // int/bigint fields still need per-value ubuf conversion
+
   m = 0;
   last = first + n;
-  for (i = first; i < last; i++) {
-    x[i][0] = buf[m++];
-    x[i][1] = buf[m++];
-    x[i][2] = buf[m++];
-  }
+  memcpy(&x[first][0],&buf[m],3*n*sizeof(double));
+  m += 3*n;
 
   if (ncomm) {
     for (nn = 0; nn < ncomm; nn++) {
@@ -618,13 +631,12 @@ void AtomVec::unpack_comm(int n, int first, double *buf)
       if (datatype == Atom::DOUBLE) {
         if (cols == 0) {
           double *vec = *((double **) pdata);
-          for (i = first; i < last; i++)
-            vec[i] = buf[m++];
+          memcpy(&vec[first],&buf[m],n*sizeof(double));
+          m += n;
         } else {
           double **array = *((double ***) pdata);
-          for (i = first; i < last; i++)
-            for (mm = 0; mm < cols; mm++)
-              array[i][mm] = buf[m++];
+          memcpy(&array[first][0],&buf[m],n*cols*sizeof(double));
+          m += n*cols;
         }
       } else if (datatype == Atom::INT) {
         if (cols == 0) {
@@ -662,6 +674,8 @@ void AtomVec::unpack_comm_vel(int n, int first, double *buf)
   int i,m,last,mm,nn,datatype,cols;
   void *pdata;
 
+  if (n == 0) return;
+
   m = 0;
   last = first + n;
   for (i = first; i < last; i++) {
@@ -681,13 +695,12 @@ void AtomVec::unpack_comm_vel(int n, int first, double *buf)
       if (datatype == Atom::DOUBLE) {
         if (cols == 0) {
           double *vec = *((double **) pdata);
-          for (i = first; i < last; i++)
-            vec[i] = buf[m++];
+          memcpy(&vec[first],&buf[m],n*sizeof(double));
+          m += n;
         } else {
           double **array = *((double ***) pdata);
-          for (i = first; i < last; i++)
-            for (mm = 0; mm < cols; mm++)
-              array[i][mm] = buf[m++];
+          memcpy(&array[first][0],&buf[m],n*cols*sizeof(double));
+          m += n*cols;
         }
       } else if (datatype == Atom::INT) {
         if (cols == 0) {
@@ -725,13 +738,12 @@ int AtomVec::pack_reverse(int n, int first, double *buf)
   int i,m,last,mm,nn,datatype,cols;
   void *pdata;
 
+  if (n == 0) return 0;
+
   m = 0;
   last = first + n;
-  for (i = first; i < last; i++) {
-    buf[m++] = f[i][0];
-    buf[m++] = f[i][1];
-    buf[m++] = f[i][2];
-  }
+  memcpy(&buf[m],&f[first][0],3*n*sizeof(double));
+  m += 3*n;
 
   if (nreverse) {
     for (nn = 0; nn < nreverse; nn++) {
@@ -741,15 +753,12 @@ int AtomVec::pack_reverse(int n, int first, double *buf)
       if (datatype == Atom::DOUBLE) {
         if (cols == 0) {
           double *vec = *((double **) pdata);
-          for (i = first; i < last; i++) {
-            buf[m++] = vec[i];
-          }
+          memcpy(&buf[m],&vec[first],n*sizeof(double));
+          m += n;
         } else {
           double **array = *((double ***) pdata);
-          for (i = first; i < last; i++) {
-            for (mm = 0; mm < cols; mm++)
-              buf[m++] = array[i][mm];
-          }
+          memcpy(&buf[m],&array[first][0],n*cols*sizeof(double));
+          m += n*cols;
         }
       } else if (datatype == Atom::INT) {
         if (cols == 0) {
@@ -1098,6 +1107,8 @@ void AtomVec::unpack_border(int n, int first, double *buf)
   int i,m,last,mm,nn,datatype,cols;
   void *pdata;
 
+  if (n == 0) return;
+
   m = 0;
   last = first + n;
   while (last > nmax) grow(0);
@@ -1119,13 +1130,12 @@ void AtomVec::unpack_border(int n, int first, double *buf)
       if (datatype == Atom::DOUBLE) {
         if (cols == 0) {
           double *vec = *((double **) pdata);
-          for (i = first; i < last; i++)
-            vec[i] = buf[m++];
+          memcpy(&vec[first],&buf[m],n*sizeof(double));
+          m += n;
         } else {
           double **array = *((double ***) pdata);
-          for (i = first; i < last; i++)
-            for (mm = 0; mm < cols; mm++)
-              array[i][mm] = buf[m++];
+          memcpy(&array[first][0],&buf[m],n*cols*sizeof(double));
+          m += n*cols;
         }
       } else if (datatype == Atom::INT) {
         if (cols == 0) {
@@ -1168,6 +1178,8 @@ void AtomVec::unpack_border_vel(int n, int first, double *buf)
   int i,m,last,mm,nn,datatype,cols;
   void *pdata;
 
+  if (n == 0) return;
+
   m = 0;
   last = first + n;
   while (last > nmax) grow(0);
@@ -1192,13 +1204,12 @@ void AtomVec::unpack_border_vel(int n, int first, double *buf)
       if (datatype == Atom::DOUBLE) {
         if (cols == 0) {
           double *vec = *((double **) pdata);
-          for (i = first; i < last; i++)
-            vec[i] = buf[m++];
+          memcpy(&vec[first],&buf[m],n*sizeof(double));
+          m += n;
         } else {
           double **array = *((double ***) pdata);
-          for (i = first; i < last; i++)
-            for (mm = 0; mm < cols; mm++)
-              array[i][mm] = buf[m++];
+          memcpy(&array[first][0],&buf[m],n*cols*sizeof(double));
+          m += n*cols;
         }
       } else if (datatype == Atom::INT) {
         if (cols == 0) {
@@ -1335,6 +1346,7 @@ int AtomVec::unpack_exchange(double *buf)
 
   int nlocal = atom->nlocal;
   if (nlocal == nmax) grow(0);
+  atom->view_epoch++;
 
   int m = 1;
   x[nlocal][0] = buf[m++];
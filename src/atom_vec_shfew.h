@@ -20,34 +20,20 @@ AtomStyle(shfewnc,AtomVecShfew)
 #ifndef LMP_ATOM_VEC_SHFEWNC_H
 #define LMP_ATOM_VEC_SHFEWNC_H
 
-#include "atom_vec.h"
+#include "atom_vec_shperatom.h"
 
 namespace LAMMPS_NS {
 
-class AtomVecShfew : public AtomVec {
+// variant of atom_style shperatom with the expansion coefficients kept
+// only in the per-type table read by process_args(); per-atom storage
+// and communication is reduced to the shape type and the quaternion
+
+class AtomVecShfew : public AtomVecShperatom {
  public:
   AtomVecShfew(class LAMMPS *);
-  void process_args(int, char **);
-  void init();
 
-  void grow_pointers();
   void create_atom_post(int);
-  void data_atom_post(int);
-  void pack_data_pre(int);
-  void pack_data_post(int);
-
- private:
-  double *radius,*rmass;
-  double **omega;
-  int *shtype;                  // spherical harmonic type used
-  double **angmom;
-  double **quat;
-  double **inertia;
-
-  int radvary;
-  double radius_one,rmass_one;
-  int me;                       // proc ID
-
+  void set_properties(int);
 };
 
 }
@@ -24,6 +24,7 @@
 #include "utils.h"
 #include "gaussquad_const.h"
 #include "math_extra.h"
+#include "math_spherharm.h"
 #include "fmt/format.h"
 
 using namespace LAMMPS_NS;
@@ -37,6 +38,7 @@ AtomVecShperatom::AtomVecShperatom(LAMMPS *lmp) : AtomVec(lmp)
 {
 
   MPI_Comm_rank(world,&me);
+  MPI_Comm_size(world,&nprocs);
   maxline = maxcopy = 0;
   line = copy = work = NULL;
   if (me == 0) {
@@ -49,10 +51,23 @@ AtomVecShperatom::AtomVecShperatom(LAMMPS *lmp) : AtomVec(lmp)
   larg = NULL;
   curfile = curentry = 0;
   maxshexpan = 20;
+  ncoeff = 2*(maxshexpan+1)*(maxshexpan+1);
+
+  maxrad_bytype = NULL;
+  halfext_bytype = NULL;
+  pnm_quad = NULL;
+  nprefilter = nreject_sphere = nreject_extent = 0;
 
   mass_type = 0;
   molecular = 0;
 
+  // coefficient vectors go to ghosts through the border bonus pack:
+  // 1 flag plus the vector as float32 pairs bit-packed two per double
+
+  bonus_flag = 1;
+  size_forward_bonus = 0;
+  size_border_bonus = 1 + ncoeff/2;
+
   atom->sphere_flag = 1; // <- JUST FOR TESTING, NEED TO DELETE LATER
   atom->spherharm_flag = 1;
   atom->radius_flag = atom->rmass_flag = atom->omega_flag =
@@ -69,7 +84,7 @@ AtomVecShperatom::AtomVecShperatom(LAMMPS *lmp) : AtomVec(lmp)
   fields_comm_vel = (char *) "omega angmom";
   fields_reverse = (char *) "torque";
   fields_border = (char *) "radius rmass shtype";
-  fields_border_vel = (char *) "radius rmass omega shtype angmom shcoeffs";
+  fields_border_vel = (char *) "radius rmass omega shtype angmom";
   fields_exchange = (char *) "radius rmass omega shtype angmom shcoeffs";
   fields_restart = (char *) "radius rmass omega shtype angmom shcoeffs";
   fields_create = (char *) "radius rmass omega shtype angmom shcoeffs";
@@ -90,6 +105,9 @@ AtomVecShperatom::~AtomVecShperatom()
   memory->sfree(angles);
   memory->sfree(weights);
   memory->sfree(quad_rads);
+  memory->destroy(maxrad_bytype);
+  memory->destroy(halfext_bytype);
+  memory->destroy(pnm_quad);
 }
 
 /* ----------------------------------------------------------------------
@@ -130,17 +148,57 @@ void AtomVecShperatom::process_args(int narg, char **arg) {
     curfile++;
   }
   curfile--;
-  if (me==0){
+
+  MPI_Bcast(&(shcoeffs_bytype[0][0]), nshtypes * 2 * (maxshexpan + 1) * (maxshexpan + 1), MPI_DOUBLE, 0, world);
+
+  setup_quadrature();
+
+  // shape-derived quantities: reuse the on-disk cache when the same
+  // shape library was processed before; on a miss each rank evaluates
+  // an interleaved subset of the shape types and the partial results
+  // are summed across ranks
+
+  if (!read_shape_cache()) {
     get_quadrature_values();
     getI();
+    MPI_Allreduce(MPI_IN_PLACE, &(quad_rads[0][0]), nshtypes * num_quad2,
+                  MPI_DOUBLE, MPI_SUM, world);
+    MPI_Allreduce(MPI_IN_PLACE, &(pinertia_bytype[0][0]), nshtypes * 3,
+                  MPI_DOUBLE, MPI_SUM, world);
+    MPI_Allreduce(MPI_IN_PLACE, &(orient_bytype[0][0]), nshtypes * 9,
+                  MPI_DOUBLE, MPI_SUM, world);
+    write_shape_cache();
   }
 
-  MPI_Bcast(&(angles[0][0]), 2 * num_quad2, MPI_DOUBLE, 0, world);
-  MPI_Bcast(&(weights[0]), num_quadrature, MPI_DOUBLE, 0, world);
-  MPI_Bcast(&(quad_rads[0][0]), nshtypes * num_quad2, MPI_DOUBLE, 0, world);
-  MPI_Bcast(&(pinertia_bytype[0][0]), nshtypes * 3, MPI_DOUBLE, 0, world);
-  MPI_Bcast(&(orient_bytype[0][0]), nshtypes * 9, MPI_DOUBLE, 0, world);
-  MPI_Bcast(&(shcoeffs_bytype[0][0]), nshtypes * 2 * (maxshexpan + 1) * (maxshexpan + 1), MPI_DOUBLE, 0, world);
+  // per-type bounding volumes for the contact pre-filter: a bounding
+  // sphere radius and body-frame half extents, both taken from the
+  // sampled surface radii with a small safety factor for surface
+  // maxima falling between quadrature points
+
+  memory->create(maxrad_bytype, nshtypes, "AtomVecShperatom:maxrad");
+  memory->create(halfext_bytype, nshtypes, 3, "AtomVecShperatom:halfext");
+
+  const double safety = 1.01;
+  for (int sht = 0; sht < nshtypes; sht++) {
+    double rmax = 0.0;
+    double hx = 0.0, hy = 0.0, hz = 0.0;
+    for (int k = 0; k < num_quad2; k++) {
+      double theta = angles[0][k];
+      double phi = angles[1][k];
+      double r = quad_rads[sht][k];
+      if (r > rmax) rmax = r;
+      double px = fabs(r*sin(theta)*cos(phi));
+      double py = fabs(r*sin(theta)*sin(phi));
+      double pz = fabs(r*cos(theta));
+      if (px > hx) hx = px;
+      if (py > hy) hy = py;
+      if (pz > hz) hz = pz;
+    }
+    maxrad_bytype[sht] = safety*rmax;
+    halfext_bytype[sht][0] = safety*hx;
+    halfext_bytype[sht][1] = safety*hy;
+    halfext_bytype[sht][2] = safety*hz;
+  }
 
 //  std::cout << me << std::endl;
 //  if (me != 0) {
@@ -212,11 +270,69 @@ void AtomVecShperatom::create_atom_post(int ilocal)
   inertia[ilocal][0] = 0.0;
   inertia[ilocal][1] = 0.0;
   inertia[ilocal][2] = 0.0;
-  for (int i=0; i<=882; i++){
+  for (int i=0; i<ncoeff; i++){
     shcoeffs[ilocal][i] = 0.0;
   }
 }
 
+/* ----------------------------------------------------------------------
+   pack coefficient vectors for border atoms
+   an atom whose vector still matches its per-type table entry needs no
+   payload: the receiving rank holds the same table and copies locally;
+   modified vectors go out as float32 pairs bit-packed two per double,
+   halving the wire volume while owned copies stay full precision
+------------------------------------------------------------------------- */
+
+int AtomVecShperatom::pack_border_bonus(int n, int *list, double *buf)
+{
+  int i,j,k,m;
+  union {double d; float f[2];} pair;
+
+  m = 0;
+  for (k = 0; k < n; k++) {
+    j = list[k];
+    int sht = shtype[j];
+    if (sht >= 0 &&
+        memcmp(shcoeffs[j],shcoeffs_bytype[sht],ncoeff*sizeof(double)) == 0)
+      buf[m++] = 0.0;
+    else {
+      buf[m++] = 1.0;
+      for (i = 0; i < ncoeff; i += 2) {
+        pair.f[0] = (float) shcoeffs[j][i];
+        pair.f[1] = (float) shcoeffs[j][i+1];
+        buf[m++] = pair.d;
+      }
+    }
+  }
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   unpack coefficient vectors for border atoms
+   the regular border fields, including shtype, are unpacked first
+------------------------------------------------------------------------- */
+
+int AtomVecShperatom::unpack_border_bonus(int n, int first, double *buf)
+{
+  int i,k,m,last;
+  union {double d; float f[2];} pair;
+
+  m = 0;
+  last = first + n;
+  for (i = first; i < last; i++) {
+    if (buf[m++] == 0.0)
+      memcpy(shcoeffs[i],shcoeffs_bytype[shtype[i]],ncoeff*sizeof(double));
+    else {
+      for (k = 0; k < ncoeff; k += 2) {
+        pair.d = buf[m++];
+        shcoeffs[i][k] = pair.f[0];
+        shcoeffs[i][k+1] = pair.f[1];
+      }
+    }
+  }
+  return m;
+}
+
 /* ----------------------------------------------------------------------
    modify what AtomVec::data_atom() just unpacked
    or initialize other atom quantities
@@ -297,6 +413,198 @@ int AtomVecShperatom::num_sh_types()
   return nshtypes;
 }
 
+/* ----------------------------------------------------------------------
+   bounding-volume pre-filter for a candidate contact pair, cheapest
+   test first: the bounding spheres, then the directional support of
+   the oriented body-frame extents along the line of centers
+   i,j are a closest-image pair from the neighbor list
+   returns 0 if the two surfaces cannot touch, 1 otherwise
+------------------------------------------------------------------------- */
+
+int AtomVecShperatom::contact_possible(int i, int j)
+{
+  double **x = atom->x;
+
+  double delx = x[j][0] - x[i][0];
+  double dely = x[j][1] - x[i][1];
+  double delz = x[j][2] - x[i][2];
+  double rsq = delx*delx + dely*dely + delz*delz;
+
+  nprefilter++;
+
+  double radsum = maxrad_bytype[shtype[i]] + maxrad_bytype[shtype[j]];
+  if (rsq > radsum*radsum) {
+    nreject_sphere++;
+    return 0;
+  }
+
+  double r = sqrt(rsq);
+  if (r == 0.0) return 1;
+
+  double nhat[3];
+  nhat[0] = delx/r;
+  nhat[1] = dely/r;
+  nhat[2] = delz/r;
+
+  if (r > support_extent(i,nhat) + support_extent(j,nhat)) {
+    nreject_extent++;
+    return 0;
+  }
+
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   support of the body-frame half extents of atom i in direction nhat
+------------------------------------------------------------------------- */
+
+double AtomVecShperatom::support_extent(int i, const double *nhat)
+{
+  double rot[3][3],nbody[3];
+
+  MathExtra::quat_to_mat(quat[i],rot);
+  MathExtra::transpose_matvec(rot,nhat,nbody);
+
+  double *h = halfext_bytype[shtype[i]];
+  return h[0]*fabs(nbody[0]) + h[1]*fabs(nbody[1]) + h[2]*fabs(nbody[2]);
+}
+
+/* ----------------------------------------------------------------------
+   warm-started contact search between atoms i and j
+   chist = CONTACT_HISTORY doubles of per-pair state from the caller's
+   fix neigh/history entry: the body-frame surface coordinates of the
+   last contact point on each particle, with theta stored shifted by
+   +1 so the all-zero state of a new pair reads as a cold start
+   on return cpoint = contact point, overlap = penetration depth along
+   the line of centers; returns 1 on contact, 0 otherwise
+------------------------------------------------------------------------- */
+
+int AtomVecShperatom::contact_search(int i, int j, double *chist,
+                                     double *cpoint, double &overlap)
+{
+  double **x = atom->x;
+
+  double delx = x[j][0] - x[i][0];
+  double dely = x[j][1] - x[i][1];
+  double delz = x[j][2] - x[i][2];
+  double r = sqrt(delx*delx + dely*dely + delz*delz);
+  if (r == 0.0) return 0;
+
+  double nhat[3],nneg[3];
+  nhat[0] = delx/r;
+  nhat[1] = dely/r;
+  nhat[2] = delz/r;
+  nneg[0] = -nhat[0];
+  nneg[1] = -nhat[1];
+  nneg[2] = -nhat[2];
+
+  int warm_i = (chist[0] != 0.0);
+  int warm_j = (chist[2] != 0.0);
+  double theta_i = chist[0] - 1.0;
+  double phi_i = chist[1];
+  double theta_j = chist[2] - 1.0;
+  double phi_j = chist[3];
+
+  // extreme surface point of each particle toward the other
+
+  double pi[3],pj[3];
+  support_point(i,nhat,theta_i,phi_i,warm_i,pi);
+  support_point(j,nneg,theta_j,phi_j,warm_j,pj);
+
+  chist[0] = theta_i + 1.0;
+  chist[1] = phi_i;
+  chist[2] = theta_j + 1.0;
+  chist[3] = phi_j;
+
+  overlap = (pi[0]-pj[0])*nhat[0] + (pi[1]-pj[1])*nhat[1] +
+    (pi[2]-pj[2])*nhat[2];
+  if (overlap <= 0.0) return 0;
+
+  cpoint[0] = 0.5*(pi[0]+pj[0]);
+  cpoint[1] = 0.5*(pi[1]+pj[1]);
+  cpoint[2] = 0.5*(pi[2]+pj[2]);
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   extreme surface point of atom i in space-frame direction nhat
+   theta,phi = body-frame surface coordinates, updated in place; they
+   seed the search when warm is set, otherwise the search starts from
+   the radial direction closest to nhat
+   Newton iteration on the support objective with a finite-difference
+   stencil evaluated through the blocked expansion kernel; a warm seed
+   from the previous step converges in 1-2 iterations
+------------------------------------------------------------------------- */
+
+double AtomVecShperatom::support_point(int i, const double *nhat,
+                                       double &theta, double &phi,
+                                       int warm, double *point)
+{
+  const double step = 1.0e-4;
+  const double tol = 1.0e-8;
+  const double maxmove = 0.5;
+
+  double rot[3][3],nb[3];
+  MathExtra::quat_to_mat(quat[i],rot);
+  MathExtra::transpose_matvec(rot,nhat,nb);
+
+  if (!warm) {
+    theta = acos(nb[2]);
+    phi = atan2(nb[1],nb[0]);
+  }
+
+  double *coeffs = shcoeffs_bytype[shtype[i]];
+  int maxit = warm ? 4 : 12;
+
+  for (int it = 0; it < maxit; it++) {
+    double th[5],ph[5],rr[5],f[5];
+    th[0] = theta; ph[0] = phi;
+    th[1] = theta-step; ph[1] = phi;
+    th[2] = theta+step; ph[2] = phi;
+    th[3] = theta; ph[3] = phi-step;
+    th[4] = theta; ph[4] = phi+step;
+    MathSpherharm::expand_radius_block(5,maxshexpan,coeffs,th,ph,rr);
+    for (int k = 0; k < 5; k++) {
+      double st = sin(th[k]);
+      f[k] = rr[k]*(st*cos(ph[k])*nb[0] + st*sin(ph[k])*nb[1] +
+                    cos(th[k])*nb[2]);
+    }
+
+    double gt = (f[2]-f[1])/(2.0*step);
+    double gp = (f[4]-f[3])/(2.0*step);
+    if (fabs(gt) < tol && fabs(gp) < tol) break;
+
+    // Newton step where the curvature is usable, ascent step otherwise
+
+    double htt = (f[2]-2.0*f[0]+f[1])/(step*step);
+    double hpp = (f[4]-2.0*f[0]+f[3])/(step*step);
+    double dt = (htt < 0.0) ? -gt/htt : gt;
+    double dp = (hpp < 0.0) ? -gp/hpp : gp;
+    if (dt > maxmove) dt = maxmove;
+    if (dt < -maxmove) dt = -maxmove;
+    if (dp > maxmove) dp = maxmove;
+    if (dp < -maxmove) dp = -maxmove;
+    theta += dt;
+    phi += dp;
+  }
+
+  double rfin;
+  MathSpherharm::expand_radius_block(1,maxshexpan,coeffs,&theta,&phi,&rfin);
+
+  double st = sin(theta);
+  double sbody[3],sspace[3];
+  sbody[0] = rfin*st*cos(phi);
+  sbody[1] = rfin*st*sin(phi);
+  sbody[2] = rfin*cos(theta);
+  MathExtra::matvec(rot,sbody,sspace);
+
+  point[0] = atom->x[i][0] + sspace[0];
+  point[1] = atom->x[i][1] + sspace[1];
+  point[2] = atom->x[i][2] + sspace[2];
+
+  return sspace[0]*nhat[0] + sspace[1]*nhat[1] + sspace[2]*nhat[2];
+}
+
 /* ----------------------------------------------------------------------
    following methods are used for reading in files that contain the
    sh coefficients
@@ -819,8 +1127,16 @@ void AtomVecShperatom::getI() {
 
   static const double EPSILON   = 1.0e-7;
 
+  // each rank integrates an interleaved subset of the shape types and
+  // the partial per-type arrays are summed across ranks by the caller
+
+  memset(&pinertia_bytype[0][0], 0, nshtypes*3*sizeof(double));
+  memset(&orient_bytype[0][0], 0, nshtypes*9*sizeof(double));
+
   for (int sht = 0; sht < nshtypes; sht++) {
 
+    if (sht % nprocs != me) continue;
+
     itensor.clear();
     count=0;
     i11 = i22 = i33 = i12 = i23 = i13 = fact = vol = 0.0;
@@ -877,9 +1193,11 @@ void AtomVecShperatom::getI() {
     tensor[0][2] = tensor[2][0] = itensor[4];
     tensor[0][1] = tensor[1][0] = itensor[3];
 
+    // error->one: only this rank handles sht, others never see it
+
     ierror = MathExtra::jacobi(tensor, inertia, evectors);
     if (ierror)
-      error->all(FLERR,
+      error->one(FLERR,
                  "Insufficient Jacobi rotations for rigid body");
 
     ex[0] = evectors[0][0];
@@ -936,7 +1254,7 @@ void AtomVecShperatom::getI() {
 }
 
 
-void AtomVecShperatom::get_quadrature_values() {
+void AtomVecShperatom::setup_quadrature() {
 
   // Fixed properties
   double abscissa[num_quadrature];
@@ -958,77 +1276,126 @@ void AtomVecShperatom::get_quadrature_values() {
     }
   }
 
+}
+
+/* ----------------------------------------------------------------------
+   surface radii at the quadrature points for this rank's interleaved
+   subset of the shape types; entries of other ranks are left zero and
+   the caller sums the partial arrays across ranks
+------------------------------------------------------------------------- */
+
+void AtomVecShperatom::get_quadrature_values() {
+
+  memset(&quad_rads[0][0], 0, nshtypes*num_quad2*sizeof(double));
 
-  double theta, phi;
-  int nloc, loc;
-  double rad_val;
-  double P_n_m, x_val, mphi, Pnm_nn;
-  std::vector<double> Pnm_m2, Pnm_m1;
-  Pnm_m2.resize(maxshexpan+1, 0.0);
-  Pnm_m1.resize(maxshexpan+1, 0.0);
+  // cache the Legendre basis once per unique theta node; each column
+  // is reused for every phi on its grid row, every shape type and any
+  // later invocation, leaving only the phi-dependent work per point
+
+  int nbasis = MathSpherharm::basis_count(maxshexpan);
+  if (pnm_quad == NULL) {
+    memory->create(pnm_quad, num_quadrature*nbasis, "AtomVecShperatom:pnm");
+    for (int i = 0; i < num_quadrature; i++)
+      MathSpherharm::plegendre_table(maxshexpan,
+                                     cos(angles[0][i*num_quadrature]),
+                                     &pnm_quad[i*nbasis]);
+  }
 
   for (int sht = 0; sht < nshtypes; sht++) {
-    for (int k = 0; k < num_quad2; k++) {
-      theta = angles[0][k];
-      phi = angles[1][k];
-      x_val = std::cos(theta);
-      rad_val = shcoeffs_bytype[sht][0] * std::sqrt(1.0 / (4.0 * MY_PI));
-      Pnm_m2.clear();
-      Pnm_m1.clear();
-      for (int n = 1; n <= maxshexpan; n++) {
-        nloc = n * (n + 1);
-        if (n == 1) {
-          P_n_m = plegendre(1, 0, x_val);
-          Pnm_m2[0] = P_n_m;
-          rad_val += shcoeffs_bytype[sht][4] * P_n_m;
-          P_n_m = plegendre(1, 1, x_val);
-          Pnm_m2[1] = P_n_m;
-          mphi = 1.0 * phi;
-          rad_val += (shcoeffs_bytype[sht][2] * cos(mphi) - shcoeffs_bytype[sht][3] * sin(mphi)) * 2.0 * P_n_m;
-        } else if (n == 2) {
-          P_n_m = plegendre(2, 0, x_val);
-          Pnm_m1[0] = P_n_m;
-          rad_val += shcoeffs_bytype[sht][10] * P_n_m;
-          for (int m = 2; m >= 1; m--) {
-            P_n_m = plegendre(2, m, x_val);
-            Pnm_m1[m] = P_n_m;
-            mphi = (double) m * phi;
-            rad_val += (shcoeffs_bytype[sht][nloc] * cos(mphi) - shcoeffs_bytype[sht][nloc + 1] * sin(mphi)) * 2.0 * P_n_m;
-            nloc += 2;
-          }
-          Pnm_nn = Pnm_m1[2];
-        } else {
-          P_n_m = plegendre_recycle(n, 0, x_val, Pnm_m1[0], Pnm_m2[0]);
-          Pnm_m2[0] = Pnm_m1[0];
-          Pnm_m1[0] = P_n_m;
-          loc = (n + 1) * (n + 2) - 2;
-          rad_val += shcoeffs_bytype[sht][loc] * P_n_m;
-          loc -= 2;
-          for (int m = 1; m < n - 1; m++) {
-            P_n_m = plegendre_recycle(n, m, x_val, Pnm_m1[m], Pnm_m2[m]);
-            Pnm_m2[m] = Pnm_m1[m];
-            Pnm_m1[m] = P_n_m;
-            mphi = (double) m * phi;
-            rad_val += (shcoeffs_bytype[sht][loc] * cos(mphi) - shcoeffs_bytype[sht][loc + 1] * sin(mphi)) * 2.0 * P_n_m;
-            loc -= 2;
-          }
-
-          P_n_m = x_val * std::sqrt((2.0 * ((double) n - 1.0)) + 3.0) * Pnm_nn;
-          Pnm_m2[n - 1] = Pnm_m1[n - 1];
-          Pnm_m1[n - 1] = P_n_m;
-          mphi = (double) (n - 1) * phi;
-          rad_val += (shcoeffs_bytype[sht][loc] * cos(mphi) - shcoeffs_bytype[sht][loc + 1] * sin(mphi)) * 2.0 * P_n_m;
-          loc -= 2;
-
-          P_n_m = plegendre_nn(n, x_val, Pnm_nn);
-          Pnm_nn = P_n_m;
-          Pnm_m1[n] = P_n_m;
-          mphi = (double) n * phi;
-          rad_val += (shcoeffs_bytype[sht][loc] * cos(mphi) - shcoeffs_bytype[sht][loc + 1] * sin(mphi)) * 2.0 * P_n_m;
-        }
+    if (sht % nprocs != me) continue;
+    for (int i = 0; i < num_quadrature; i++) {
+      int krow = i*num_quadrature;
+      for (int k = 0; k < num_quadrature; k += MathSpherharm::SHBLOCK) {
+        int np = num_quadrature - k;
+        if (np > MathSpherharm::SHBLOCK) np = MathSpherharm::SHBLOCK;
+        MathSpherharm::expand_radius_row(maxshexpan, shcoeffs_bytype[sht],
+                                         &pnm_quad[i*nbasis], np,
+                                         &angles[1][krow+k],
+                                         &quad_rads[sht][krow+k]);
       }
-      quad_rads[sht][k] = rad_val;
     }
   }
 
 }
+
+/* ----------------------------------------------------------------------
+   FNV-1a hash over the coefficient table and quadrature parameters,
+   used as the key for the on-disk cache of shape-derived quantities
+------------------------------------------------------------------------- */
+
+unsigned long long AtomVecShperatom::shape_hash() {
+
+  unsigned long long hash = 14695981039346656037ULL;
+
+  auto mix = [&hash](const void *data, size_t nbytes) {
+    const unsigned char *bytes = (const unsigned char *) data;
+    for (size_t i = 0; i < nbytes; i++) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+    }
+  };
+
+  mix(&nshtypes, sizeof(int));
+  mix(&maxshexpan, sizeof(int));
+  mix(&num_quadrature, sizeof(int));
+  mix(&(shcoeffs_bytype[0][0]), nshtypes*ncoeff*sizeof(double));
+
+  return hash;
+}
+
+/* ----------------------------------------------------------------------
+   load quad_rads, pinertia_bytype and orient_bytype from a cache file
+   written by an earlier run with the same shape library and quadrature;
+   rank 0 reads and broadcasts; return 1 on a hit, 0 on a miss
+------------------------------------------------------------------------- */
+
+int AtomVecShperatom::read_shape_cache() {
+
+  int success = 0;
+  char filename[64];
+  snprintf(filename, 64, "shperatom_shapes_%016llx.bin", shape_hash());
+
+  if (me == 0) {
+    FILE *fp = fopen(filename, "rb");
+    if (fp) {
+      size_t nread = 0;
+      nread += fread(&(quad_rads[0][0]), sizeof(double),
+                     nshtypes*num_quad2, fp);
+      nread += fread(&(pinertia_bytype[0][0]), sizeof(double),
+                     nshtypes*3, fp);
+      nread += fread(&(orient_bytype[0][0]), sizeof(double),
+                     nshtypes*9, fp);
+      if (nread == (size_t) nshtypes*(num_quad2+12)) success = 1;
+      fclose(fp);
+    }
+  }
+
+  MPI_Bcast(&success, 1, MPI_INT, 0, world);
+  if (!success) return 0;
+
+  MPI_Bcast(&(quad_rads[0][0]), nshtypes*num_quad2, MPI_DOUBLE, 0, world);
+  MPI_Bcast(&(pinertia_bytype[0][0]), nshtypes*3, MPI_DOUBLE, 0, world);
+  MPI_Bcast(&(orient_bytype[0][0]), nshtypes*9, MPI_DOUBLE, 0, world);
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   write the shape-derived quantities to the cache file; rank 0 only;
+   a failure to open the file is not an error, the cache is optional
+------------------------------------------------------------------------- */
+
+void AtomVecShperatom::write_shape_cache() {
+
+  if (me != 0) return;
+
+  char filename[64];
+  snprintf(filename, 64, "shperatom_shapes_%016llx.bin", shape_hash());
+
+  FILE *fp = fopen(filename, "wb");
+  if (!fp) return;
+
+  fwrite(&(quad_rads[0][0]), sizeof(double), nshtypes*num_quad2, fp);
+  fwrite(&(pinertia_bytype[0][0]), sizeof(double), nshtypes*3, fp);
+  fwrite(&(orient_bytype[0][0]), sizeof(double), nshtypes*9, fp);
+  fclose(fp);
+}
@@ -37,11 +37,51 @@ class AtomVecShperatom : public AtomVec {
   void pack_data_pre(int);
   void pack_data_post(int);
 
+  // compressed border communication of the coefficient vectors:
+  // ghosts receive them float32 on the wire, or no payload at all when
+  // the receiving rank can copy them from its own per-type table;
+  // owned-atom exchange and restarts keep exact doubles
+
+  int pack_border_bonus(int, int *, double *);
+  int unpack_border_bonus(int, int, double *);
+
   ~AtomVecShperatom();     // Destructor
-  void set_properties(int);
+  virtual void set_properties(int);
   int num_sh_types();
 
- private:
+  // bounding-volume pre-filter for contact detection, applied before
+  // any surface-point evaluation; returns 0 if the two surfaces cannot
+  // touch, 1 if a full contact evaluation is needed
+
+  int contact_possible(int, int);
+  void prefilter_stats(bigint &ncall, bigint &nsphere, bigint &nextent) const
+  {
+    ncall = nprefilter;
+    nsphere = nreject_sphere;
+    nextent = nreject_extent;
+  }
+
+  // warm-started iterative contact search; the per-pair state is the
+  // body-frame surface coordinates of the last contact point for both
+  // particles, stored by the caller via fix neigh/history
+
+  static const int CONTACT_HISTORY = 4;   // # of cached doubles per pair
+
+  int contact_search(int, int, double *, double *, double &);
+
+ protected:
+
+  double support_point(int, const double *, double &, double &, int,
+                       double *);
+
+  double *maxrad_bytype;        // bounding sphere radius per sh type
+  double **halfext_bytype;      // body-frame half extents per sh type
+  double *pnm_quad;             // cached Legendre values at the theta nodes
+  bigint nprefilter;            // # of pre-filter tests
+  bigint nreject_sphere;        // # rejected by the bounding spheres
+  bigint nreject_extent;        // # rejected by the oriented extents
+
+  double support_extent(int, const double *);
 
   double *radius,*rmass;
   double **omega;
@@ -57,6 +97,7 @@ class AtomVecShperatom : public AtomVec {
   double **pinertia_bytype;
   double **orient_bytype;
   int maxshexpan;
+  int ncoeff;                   // doubles per coefficient vector
   int nfile,maxfile;            // current # and max # of open input files
   int curfile,curentry;         // current # and max # of open input files
   FILE **infiles;               // list of open input file
@@ -76,6 +117,7 @@ class AtomVecShperatom : public AtomVec {
   int radvary;
   double radius_one,rmass_one;
   int me;                       // proc ID
+  int nprocs;                   // # of procs
 
 
   //----- Trying to integrate fastgl -------//
@@ -100,9 +142,17 @@ class AtomVecShperatom : public AtomVec {
   double besselj1squared(int);
   QuadPair GLPairS(size_t, size_t);
   QuadPair GLPairTabulated(size_t, size_t);
+  void setup_quadrature();
   void get_quadrature_values();
   void getI();
 
+  // on-disk cache of the shape-derived quantities, keyed by a hash of
+  // the coefficient table and quadrature parameters
+
+  unsigned long long shape_hash();
+  int read_shape_cache();
+  void write_shape_cache();
+
   void read_coeffs(char *);// process an input file
   void read_coeffs();      // process all input
   void parse();                          // parse an input text line
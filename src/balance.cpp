@@ -35,6 +35,7 @@
 #include "imbalance_group.h"
 #include "imbalance_time.h"
 #include "imbalance_neigh.h"
+#include "imbalance_contact.h"
 #include "imbalance_store.h"
 #include "imbalance_var.h"
 #include "memory.h"
@@ -446,6 +447,10 @@ void Balance::options(int iarg, int narg, char **arg)
         imb = new ImbalanceNeigh(lmp);
         nopt = imb->options(narg-iarg,arg+iarg+2);
         imbalances[nimbalance++] = imb;
+      } else if (strcmp(arg[iarg+1],"contact") == 0) {
+        imb = new ImbalanceContact(lmp);
+        nopt = imb->options(narg-iarg,arg+iarg+2);
+        imbalances[nimbalance++] = imb;
       } else if (strcmp(arg[iarg+1],"var") == 0) {
         varflag = 1;
         imb = new ImbalanceVar(lmp);
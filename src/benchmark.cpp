@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "benchmark.h"
+#include <mpi.h>
+#include <cctype>
+#include <cstring>
+#include "domain.h"
+#include "error.h"
+#include "force.h"
+#include "integrate.h"
+#include "neigh_list.h"
+#include "pair.h"
+#include "update.h"
+#include "fmt/format.h"
+
+using namespace LAMMPS_NS;
+
+// streaming traffic model, bytes per list row and per neighbor:
+// row: x[i] + type[i] reads, f[i] read-modify-write = 24 + 4 + 48
+// neighbor: index + x[j] + type[j] reads = 4 + 24 + 4
+// newton f[j] updates are assumed cache resident and not counted
+
+#define ROW_BYTES 76.0
+#define NEIGH_BYTES 32.0
+
+// default arithmetic cost per neighbor pair: distance and cutoff test
+// (9 flops) plus a generic lj/cut-like kernel (14 flops).  override with
+// the flops keyword when modeling a different potential
+
+#define DEFAULT_FLOPS 23.0
+
+/* ---------------------------------------------------------------------- */
+
+Benchmark::Benchmark(LAMMPS *lmp) : Pointers(lmp) {}
+
+/* ---------------------------------------------------------------------- */
+
+void Benchmark::command(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR,"Illegal benchmark command");
+
+  if (domain->box_exist == 0)
+    error->all(FLERR,"Benchmark command before simulation box is defined");
+
+  if (strcmp(arg[0],"pair") == 0) {
+    int niter = 1000;
+    double flops = DEFAULT_FLOPS;
+    int iarg = 1;
+    if (iarg < narg && isdigit(arg[iarg][0])) {
+      niter = force->inumeric(FLERR,arg[iarg]);
+      iarg++;
+    }
+    while (iarg < narg) {
+      if (strcmp(arg[iarg],"flops") == 0) {
+        if (iarg+2 > narg) error->all(FLERR,"Illegal benchmark command");
+        flops = force->numeric(FLERR,arg[iarg+1]);
+        iarg += 2;
+      } else error->all(FLERR,"Illegal benchmark command");
+    }
+    if (niter <= 0 || flops <= 0.0)
+      error->all(FLERR,"Illegal benchmark command");
+    benchmark_pair(niter,flops);
+  } else error->all(FLERR,"Illegal benchmark command");
+}
+
+/* ----------------------------------------------------------------------
+   time repeated invocations of the current pair style's compute() on the
+   neighbor lists of the current configuration and report achieved pair
+   rate, modeled memory traffic and flops, and arithmetic intensity
+------------------------------------------------------------------------- */
+
+void Benchmark::benchmark_pair(int niter, double flops)
+{
+  if (force->pair == NULL)
+    error->all(FLERR,"Benchmark pair requires a pair style be defined");
+
+  // initialize system and build neighbor lists as a zero-step run would
+
+  update->whichflag = 1;
+  update->nsteps = 0;
+  update->firststep = update->laststep = update->ntimestep;
+  update->beginstep = update->endstep = update->ntimestep;
+
+  lmp->init();
+  update->integrate->setup(0);
+
+  Pair *pair = force->pair;
+
+  // count interactions in the style's standard list, summed over procs
+  // styles without one (e.g. hybrid parents) get timing only
+
+  bigint npairs = 0;
+  NeighList *list = pair->list;
+  if (list) {
+    int inum = list->inum;
+    int *ilist = list->ilist;
+    int *numneigh = list->numneigh;
+    for (int ii = 0; ii < inum; ii++) npairs += numneigh[ilist[ii]];
+  }
+  bigint inum_all = list ? list->inum : 0;
+  bigint npairs_all,nrows_all;
+  MPI_Allreduce(&npairs,&npairs_all,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  MPI_Allreduce(&inum_all,&nrows_all,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+  // warm-up invocation, then timed loop
+  // slowest rank defines the achieved rate
+
+  pair->compute(0,0);
+  MPI_Barrier(world);
+  double start = MPI_Wtime();
+  for (int iter = 0; iter < niter; iter++) pair->compute(0,0);
+  MPI_Barrier(world);
+  double elapsed = MPI_Wtime() - start;
+
+  update->whichflag = 0;
+  update->firststep = update->laststep = 0;
+  update->beginstep = update->endstep = 0;
+  update->integrate->cleanup();
+
+  int me,nprocs;
+  MPI_Comm_rank(world,&me);
+  MPI_Comm_size(world,&nprocs);
+  if (me != 0) return;
+
+  double titer = elapsed/niter;
+  std::string mesg =
+    fmt::format("Pair style benchmark: {} on {} procs, {} iterations\n",
+                force->pair_style,nprocs,niter);
+  mesg += fmt::format("  Time/iteration: {:.6g} seconds\n",titer);
+
+  if (npairs_all && titer > 0.0) {
+    double bytes = nrows_all*ROW_BYTES + npairs_all*NEIGH_BYTES;
+    double fiter = npairs_all*flops;
+    mesg += fmt::format("  Neighbor pairs/iteration: {}\n",npairs_all);
+    mesg += fmt::format("  Pair rate: {:.4g} Gpairs/sec\n",
+                        npairs_all/titer*1.0e-9);
+    mesg += fmt::format("  Modeled traffic: {:.4g} Mbyte/iteration, "
+                        "{:.4g} Gbyte/sec\n",
+                        bytes*1.0e-6,bytes/titer*1.0e-9);
+    mesg += fmt::format("  Modeled compute ({:.4g} flops/pair): "
+                        "{:.4g} Gflop/sec\n",flops,fiter/titer*1.0e-9);
+    mesg += fmt::format("  Arithmetic intensity: {:.4g} flop/byte\n",
+                        fiter/bytes);
+  } else {
+    mesg += "  Pair style has no standard neighbor list, timing only\n";
+  }
+
+  if (screen) fputs(mesg.c_str(),screen);
+  if (logfile) fputs(mesg.c_str(),logfile);
+}
@@ -61,6 +61,18 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   cutghostuser = 0.0;
   cutusermulti = NULL;
   ghost_velocity = 0;
+  ghostprune = 0;
+  persistent = 0;
+  shmflag = 0;
+  collectiveflag = 0;
+  exchadaptive = 0;
+  exchmigrate[0] = exchmigrate[1] = exchmigrate[2] = 0;
+  exchskip[0] = exchskip[1] = exchskip[2] = 0;
+
+  ncoalesce = maxcoalesce = 0;
+  coalesce_pairs = NULL;
+  coalesce_fixes = NULL;
+  coalesce_sizes = NULL;
 
   user_procgrid[0] = user_procgrid[1] = user_procgrid[2] = 0;
   coregrid[0] = coregrid[1] = coregrid[2] = 1;
@@ -121,6 +133,10 @@ Comm::~Comm()
   memory->destroy(cutusermulti);
   delete [] customfile;
   delete [] outfile;
+
+  memory->sfree(coalesce_pairs);
+  memory->sfree(coalesce_fixes);
+  memory->destroy(coalesce_sizes);
 }
 
 /* ----------------------------------------------------------------------
@@ -334,10 +350,133 @@ void Comm::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) ghost_velocity = 0;
       else error->all(FLERR,"Illegal comm_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"prune") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) ghostprune = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) ghostprune = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"persistent") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) persistent = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) persistent = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"shm") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) shmflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) shmflag = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"collective") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) collectiveflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) collectiveflag = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"adaptive") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) exchadaptive = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) exchadaptive = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal comm_modify command");
   }
 }
 
+/* ----------------------------------------------------------------------
+   coalesced forward comm: queue several Pairs/Fixes whose per-atom data
+     are independent, then exchange them all with one message per swap
+   caller brackets the queue calls with coalesce_begin/coalesce_flush
+   each producer must pack a fixed # of datums per atom, since the fused
+     message is split by size on the receiving side
+------------------------------------------------------------------------- */
+
+void Comm::coalesce_begin()
+{
+  ncoalesce = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Comm::coalesce_pair(Pair *pair)
+{
+  if (ncoalesce == maxcoalesce) {
+    maxcoalesce += 8;
+    coalesce_pairs = (Pair **)
+      memory->srealloc(coalesce_pairs,maxcoalesce*sizeof(Pair *),
+                       "comm:coalesce_pairs");
+    coalesce_fixes = (Fix **)
+      memory->srealloc(coalesce_fixes,maxcoalesce*sizeof(Fix *),
+                       "comm:coalesce_fixes");
+    memory->grow(coalesce_sizes,maxcoalesce,"comm:coalesce_sizes");
+  }
+
+  coalesce_pairs[ncoalesce] = pair;
+  coalesce_fixes[ncoalesce] = NULL;
+  coalesce_sizes[ncoalesce] = pair->comm_forward;
+  ncoalesce++;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Comm::coalesce_fix(Fix *fix, int size)
+{
+  if (ncoalesce == maxcoalesce) {
+    maxcoalesce += 8;
+    coalesce_pairs = (Pair **)
+      memory->srealloc(coalesce_pairs,maxcoalesce*sizeof(Pair *),
+                       "comm:coalesce_pairs");
+    coalesce_fixes = (Fix **)
+      memory->srealloc(coalesce_fixes,maxcoalesce*sizeof(Fix *),
+                       "comm:coalesce_fixes");
+    memory->grow(coalesce_sizes,maxcoalesce,"comm:coalesce_sizes");
+  }
+
+  coalesce_pairs[ncoalesce] = NULL;
+  coalesce_fixes[ncoalesce] = fix;
+  if (size) coalesce_sizes[ncoalesce] = size;
+  else coalesce_sizes[ncoalesce] = fix->comm_forward;
+  ncoalesce++;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Comm::coalesce_flush()
+{
+  if (ncoalesce) forward_comm_coalesced();
+  ncoalesce = 0;
+}
+
+/* ----------------------------------------------------------------------
+   default fused exchange: one forward comm per queued producer
+   comm styles which can fuse the messages override this
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_coalesced()
+{
+  for (int i = 0; i < ncoalesce; i++) {
+    if (coalesce_pairs[i]) forward_comm_pair(coalesce_pairs[i]);
+    else forward_comm_fix(coalesce_fixes[i],coalesce_sizes[i]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   default split pair forward comm: perform the entire blocking comm
+   and report that no ghost data is left in flight
+   comm styles which can leave their final swap pending override this
+------------------------------------------------------------------------- */
+
+int Comm::forward_comm_pair_start(Pair *pair)
+{
+  forward_comm_pair(pair);
+  return atom->nlocal + atom->nghost;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Comm::forward_comm_pair_finish(Pair * /*pair*/) {}
+
 /* ----------------------------------------------------------------------
    set dimensions for 3d grid of processors, and associated flags
    invoked from input script by processors command
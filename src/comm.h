@@ -30,6 +30,21 @@ class Comm : protected Pointers {
 
   int me,nprocs;                    // proc info
   int ghost_velocity;               // 1 if ghost atoms have velocity, 0 if not
+  int ghostprune;                   // 1 to drop ghosts beyond the Euclidean
+                                    //   ghost cutoff of the receiving subdomain
+  int persistent;                   // 1 to use persistent MPI requests for
+                                    //   forward/reverse comm, re-armed on
+                                    //   every reneighboring
+  int shmflag;                      // 1 to let on-node partners read packed
+                                    //   forward comm data from a shared
+                                    //   memory window instead of messaging
+  int collectiveflag;               // 1 to exchange each pair of direction
+                                    //   swaps with a neighborhood collective
+                                    //   on a topology-aware graph comm
+  int exchadaptive;                 // 1 to skip exchange() in dims where
+                                    //   no proc has a migrating atom
+  bigint exchmigrate[3];            // # of atoms I migrated, per dim
+  bigint exchskip[3];               // # of exchanges skipped, per dim
   double cutghost[3];               // cutoffs used for acquiring ghost atoms
   double cutghostuser;              // user-specified ghost cutoff (mode == 0)
   double *cutusermulti;            // per type user ghost cutoff (mode == 1)
@@ -73,13 +88,29 @@ class Comm : protected Pointers {
 
   virtual void setup() = 0;                      // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0) = 0;  // forward comm of atom coords
+  virtual void forward_comm_start(int dummy = 0) {forward_comm(dummy);}
+                                                 // begin forward comm, may
+                                                 //   leave receives pending
+  virtual void forward_comm_finish() {}          // complete pending swaps
   virtual void reverse_comm() = 0;               // reverse comm of forces
+  virtual void reverse_comm_start() {reverse_comm();}
+                                                 // begin reverse comm, may
+                                                 //   leave receives pending
+  virtual void reverse_comm_finish() {}          // complete pending swaps
+  virtual void reverse_comm_det() = 0;           // reverse comm of f_det
   virtual void exchange() = 0;                   // move atoms to new procs
   virtual void borders() = 0;                    // setup list of atoms to comm
 
   // forward/reverse comm from a Pair, Fix, Compute, Dump
 
   virtual void forward_comm_pair(class Pair *) = 0;
+  virtual int forward_comm_pair_start(class Pair *);
+                                                 // begin pair forward comm,
+                                                 //   may leave final swap in
+                                                 //   flight, returns index of
+                                                 //   first ghost still pending
+  virtual void forward_comm_pair_finish(class Pair *);
+                                                 // complete pending swap
   virtual void reverse_comm_pair(class Pair *) = 0;
   virtual void forward_comm_fix(class Fix *, int size=0) = 0;
   virtual void reverse_comm_fix(class Fix *, int size=0) = 0;
@@ -89,6 +120,15 @@ class Comm : protected Pointers {
   virtual void forward_comm_dump(class Dump *) = 0;
   virtual void reverse_comm_dump(class Dump *) = 0;
 
+  // coalesced forward comm of several Pairs/Fixes in one message per swap
+  // queue producers between begin and flush, flush performs the exchange
+  // producers must pack/unpack a fixed # of datums per atom
+
+  void coalesce_begin();
+  void coalesce_pair(class Pair *);
+  void coalesce_fix(class Fix *, int size = 0);
+  void coalesce_flush();
+
   // forward comm of an array
   // exchange of info on neigh stencil
   // set processor mapping options
@@ -139,6 +179,16 @@ class Comm : protected Pointers {
   int bufextra;                 // augment send buf size for an exchange atom
 
 
+  int ncoalesce,maxcoalesce;        // # of queued forward comm producers
+  class Pair **coalesce_pairs;      // queued Pair, NULL if entry is a Fix
+  class Fix **coalesce_fixes;       // queued Fix, NULL if entry is a Pair
+  int *coalesce_sizes;              // # of datums per atom for each entry
+
+  // style-specific fused exchange of all queued producers
+  // default issues one forward comm per producer, i.e. no fusion
+
+  virtual void forward_comm_coalesced();
+
   int gridflag;                     // option for creating 3d grid
   int mapflag;                      // option for mapping procs to 3d grid
   char xyz[4];                      // xyz mapping of procs to 3d grid
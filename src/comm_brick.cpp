@@ -71,6 +71,23 @@ CommBrick::~CommBrick()
 
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
+
+  free_persistent();
+  memory->destroy(buf_persist);
+
+  free_shm();
+  if (shmwin != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(shmwin);
+    MPI_Win_free(&shmwin);
+  }
+  if (nodesize) {
+    MPI_Comm_free(&nodecomm);
+    memory->destroy(noderanks);
+  }
+
+  if (graph_ready)
+    for (int dim = 0; dim < 3; dim++)
+      if (graphcomm[dim] != MPI_COMM_NULL) MPI_Comm_free(&graphcomm[dim]);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -100,12 +117,39 @@ void CommBrick::init_buffers()
   multilo = multihi = NULL;
   cutghostmulti = NULL;
 
+  persist_ready = 0;
+  npersist = 0;
+  maxpersist = 0;
+  persist_offset = NULL;
+  buf_persist = NULL;
+  persistfwd_send = persistfwd_recv = NULL;
+  persistrev_send = persistrev_recv = NULL;
+
+  graphcomm[0] = graphcomm[1] = graphcomm[2] = MPI_COMM_NULL;
+  graph_ready = 0;
+
+  nodesize = 0;
+  noderanks = NULL;
+  shmwin = MPI_WIN_NULL;
+  shmbuf = NULL;
+  maxshm = 0;
+  shm_ready = 0;
+  nshm = 0;
+  sendnode = recvnode = NULL;
+  shmoffset = NULL;
+  shmptr = NULL;
+  shmpending = NULL;
+  shmack = NULL;
+
   buf_send = buf_recv = NULL;
   maxsend = maxrecv = BUFMIN;
   grow_send(maxsend,2);
   memory->create(buf_recv,maxrecv,"comm:buf_recv");
 
   nswap = 0;
+  nstart = -1;
+  nrstart = -1;
+  pairswap_pending = -1;
   maxswap = 6;
   allocate_swap(maxswap);
 
@@ -127,6 +171,25 @@ void CommBrick::init()
   init_exchange();
   if (bufextra > bufextra_old) grow_send(maxsend+bufextra,2);
 
+  // persistent requests exchange coords and forces in place,
+  // which requires an x-only forward comm and f-only reverse comm
+
+  if (persistent && (!comm_x_only || !comm_f_only) && me == 0)
+    error->warning(FLERR,"Comm_modify persistent requires sending only "
+                   "coords and forces and will be ignored");
+
+  // shm replaces forward comm messages with shared-memory reads,
+  // which persistent mode would bypass
+
+  if (shmflag && persistent)
+    error->all(FLERR,"Comm_modify shm and persistent cannot be combined");
+  if (shmflag) setup_node();
+
+  if (collectiveflag && (persistent || shmflag))
+    error->all(FLERR,"Comm_modify collective cannot be combined with "
+               "persistent or shm");
+  if (collectiveflag) setup_graphs();
+
   // memory for multi-style communication
 
   if (mode == Comm::MULTI && multilo == NULL) {
@@ -166,6 +229,18 @@ void CommBrick::setup()
     error->warning(FLERR,"Communication cutoff is 0.0. No ghost atoms "
                    "will be generated. Atoms may get lost.");
 
+  // ghost pruning needs isotropic cutoffs in box coords
+  // for multi mode the per-type cutoffs are used instead
+
+  if (ghostprune) {
+    if (triclinic)
+      error->all(FLERR,"Comm_modify prune is not compatible with "
+                 "triclinic boxes");
+    if (atom->molecular && me == 0)
+      error->warning(FLERR,"Comm_modify prune requires all bonded partners "
+                     "within the communication cutoff distance");
+  }
+
   if (triclinic == 0) {
     prd = domain->prd;
     sublo = domain->sublo;
@@ -456,6 +531,182 @@ void CommBrick::forward_comm(int /*dummy*/)
   double **x = atom->x;
   double *buf;
 
+  // persistent requests armed by borders(): just pack and MPI_Start
+  // receives were armed on x[firstrecv] directly, so nothing to unpack
+
+  if (persist_ready) {
+    for (int iswap = 0; iswap < nswap; iswap++) {
+      if (sendproc[iswap] != me) {
+        if (size_forward_recv[iswap]) MPI_Start(&persistfwd_recv[iswap]);
+        if (sendnum[iswap]) {
+          avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                          &buf_persist[persist_offset[iswap]],
+                          pbc_flag[iswap],pbc[iswap]);
+          MPI_Start(&persistfwd_send[iswap]);
+        }
+        if (size_forward_recv[iswap])
+          MPI_Wait(&persistfwd_recv[iswap],MPI_STATUS_IGNORE);
+        if (sendnum[iswap])
+          MPI_Wait(&persistfwd_send[iswap],MPI_STATUS_IGNORE);
+      } else if (sendnum[iswap])
+        avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                        x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+    }
+    return;
+  }
+
+  // on-node partners read my packed data from the shared-memory window
+  //   after a zero-count ready message; the receiver's ack keeps the
+  //   segment from being repacked while still being read
+  // off-node partners exchange through the normal buffers
+
+  if (shm_ready) {
+    MPI_Request notifyreq;
+    int notifyflag;
+
+    for (int iswap = 0; iswap < nswap; iswap++) {
+      if (sendproc[iswap] == me) {
+        if (comm_x_only) {
+          if (sendnum[iswap])
+            avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                            x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+        } else if (ghost_velocity) {
+          avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                              buf_send,pbc_flag[iswap],pbc[iswap]);
+          avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],buf_send);
+        } else {
+          avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                          buf_send,pbc_flag[iswap],pbc[iswap]);
+          avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf_send);
+        }
+        continue;
+      }
+
+      // post receives first: ready message if on-node, data if off-node
+
+      notifyflag = 0;
+      if (size_forward_recv[iswap]) {
+        if (recvnode[iswap] >= 0) {
+          MPI_Irecv(&shmdummy,0,MPI_INT,recvproc[iswap],0,world,&notifyreq);
+          notifyflag = 1;
+        } else {
+          if (comm_x_only) buf = x[firstrecv[iswap]];
+          else buf = buf_recv;
+          MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
+                    recvproc[iswap],0,world,&request);
+        }
+      }
+
+      // pack into my window segment and notify if receiver is on-node,
+      //   waiting first for its ack of the previous exchange
+      // else pack and send through buf_send as usual
+
+      if (sendnum[iswap]) {
+        if (sendnode[iswap] >= 0) {
+          if (shmpending[iswap]) {
+            MPI_Wait(&shmack[iswap],MPI_STATUS_IGNORE);
+            shmpending[iswap] = 0;
+          }
+          if (ghost_velocity)
+            avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                                &shmbuf[shmoffset[iswap]],
+                                pbc_flag[iswap],pbc[iswap]);
+          else
+            avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                            &shmbuf[shmoffset[iswap]],
+                            pbc_flag[iswap],pbc[iswap]);
+          MPI_Win_sync(shmwin);
+          MPI_Send(&shmdummy,0,MPI_INT,sendproc[iswap],0,world);
+          MPI_Irecv(&shmdummy,0,MPI_INT,sendproc[iswap],1,world,
+                    &shmack[iswap]);
+          shmpending[iswap] = 1;
+        } else {
+          if (ghost_velocity)
+            n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                                    buf_send,pbc_flag[iswap],pbc[iswap]);
+          else
+            n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                                buf_send,pbc_flag[iswap],pbc[iswap]);
+          if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+        }
+      }
+
+      // complete receive: copy or unpack straight out of the sending
+      //   proc's segment if on-node, then ack
+
+      if (size_forward_recv[iswap]) {
+        if (recvnode[iswap] >= 0) {
+          if (notifyflag) MPI_Wait(&notifyreq,MPI_STATUS_IGNORE);
+          MPI_Win_sync(shmwin);
+          if (comm_x_only)
+            memcpy(x[firstrecv[iswap]],shmptr[iswap],
+                   size_forward_recv[iswap]*sizeof(double));
+          else if (ghost_velocity)
+            avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],
+                                  shmptr[iswap]);
+          else
+            avec->unpack_comm(recvnum[iswap],firstrecv[iswap],
+                              shmptr[iswap]);
+          MPI_Send(&shmdummy,0,MPI_INT,recvproc[iswap],1,world);
+        } else {
+          MPI_Wait(&request,MPI_STATUS_IGNORE);
+          if (ghost_velocity)
+            avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],buf_recv);
+          else if (!comm_x_only)
+            avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf_recv);
+        }
+      }
+    }
+    return;
+  }
+
+  // neighborhood collectives: the two direction swaps of each hop of a
+  //   dim have sendlists which exclude each other's arrivals, so they
+  //   are independent and can go out as one MPI_Neighbor_alltoallv on
+  //   the dim's graph communicator
+  // their ghosts arrive back to back, so the recv lands in x directly
+
+  if (collectiveflag && graph_ready && comm_x_only) {
+    int iswap = 0;
+    int sendcounts[2],sdispls[2],recvcounts[2],rdispls[2];
+
+    for (int dim = 0; dim < 3; dim++) {
+      int twoneed = 2*maxneed[dim];
+      for (int ineed = 0; ineed < twoneed; ineed += 2, iswap += 2) {
+        int iswap0 = iswap;
+        int iswap1 = iswap+1;
+
+        if (sendproc[iswap0] == me) {
+          for (int is = iswap0; is <= iswap1; is++)
+            if (sendnum[is])
+              avec->pack_comm(sendnum[is],sendlist[is],
+                              x[firstrecv[is]],pbc_flag[is],pbc[is]);
+          continue;
+        }
+
+        sendcounts[0] = avec->pack_comm(sendnum[iswap0],sendlist[iswap0],
+                                        buf_send,
+                                        pbc_flag[iswap0],pbc[iswap0]);
+        sendcounts[1] = avec->pack_comm(sendnum[iswap1],sendlist[iswap1],
+                                        &buf_send[sendcounts[0]],
+                                        pbc_flag[iswap1],pbc[iswap1]);
+        sdispls[0] = 0;
+        sdispls[1] = sendcounts[0];
+        recvcounts[0] = size_forward_recv[iswap0];
+        recvcounts[1] = size_forward_recv[iswap1];
+        rdispls[0] = 0;
+        rdispls[1] = recvcounts[0];
+        if (recvcounts[0] + recvcounts[1]) buf = x[firstrecv[iswap0]];
+        else buf = buf_recv;
+
+        MPI_Neighbor_alltoallv(buf_send,sendcounts,sdispls,MPI_DOUBLE,
+                               buf,recvcounts,rdispls,MPI_DOUBLE,
+                               graphcomm[dim]);
+      }
+    }
+    return;
+  }
+
   // exchange data with another proc
   // if other proc is self, just copy
   // if comm_x_only set, exchange or copy directly to x, don't unpack
@@ -510,6 +761,107 @@ void CommBrick::forward_comm(int /*dummy*/)
   }
 }
 
+/* ----------------------------------------------------------------------
+   begin forward communication, leaving receives outstanding
+   the leading swaps of the first communicated dim send only owned atoms,
+     so they do not depend on data from each other and can all be posted
+     before any wait; all procs post receives first, so the blocking
+     sends cannot deadlock
+   only x-only exchanges qualify, since their receives land directly in
+     atom->x; anything else falls back to a blocking forward_comm()
+   caller may do work that does not touch coords, then must call
+     forward_comm_finish() which waits and runs the dependent swaps
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_start(int dummy)
+{
+  int iswap,n;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double *buf;
+
+  nstart = 0;
+  if (comm_x_only && !persist_ready && !shm_ready &&
+      !(collectiveflag && graph_ready))
+    for (int dim = 0; dim < 3; dim++)
+      if (maxneed[dim]) {
+        nstart = MIN(2,2*maxneed[dim]);
+        break;
+      }
+
+  if (nstart == 0) {
+    forward_comm(dummy);
+    nstart = -1;
+    return;
+  }
+
+  for (iswap = 0; iswap < nstart; iswap++) {
+    startpending[iswap] = 0;
+    if (sendproc[iswap] != me && size_forward_recv[iswap]) {
+      buf = x[firstrecv[iswap]];
+      MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
+                recvproc[iswap],0,world,&startrequest[iswap]);
+      startpending[iswap] = 1;
+    }
+  }
+
+  for (iswap = 0; iswap < nstart; iswap++) {
+    if (sendproc[iswap] != me) {
+      n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                          buf_send,pbc_flag[iswap],pbc[iswap]);
+      if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+    } else {
+      if (sendnum[iswap])
+        avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                        x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   complete a forward communication begun by forward_comm_start()
+   wait on the outstanding receives, then perform remaining swaps,
+     which may forward coords received by the leading swaps
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_finish()
+{
+  int iswap,n;
+  MPI_Request request;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double *buf;
+
+  if (nstart <= 0) return;
+
+  for (iswap = 0; iswap < nstart; iswap++)
+    if (startpending[iswap])
+      MPI_Wait(&startrequest[iswap],MPI_STATUS_IGNORE);
+
+  // remaining swaps, same as in forward_comm()
+  // comm_x_only is guaranteed set, else forward_comm_start() fell back
+
+  for (iswap = nstart; iswap < nswap; iswap++) {
+    if (sendproc[iswap] != me) {
+      if (size_forward_recv[iswap]) {
+        buf = x[firstrecv[iswap]];
+        MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&request);
+      }
+      n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                          buf_send,pbc_flag[iswap],pbc[iswap]);
+      if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+      if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    } else {
+      if (sendnum[iswap])
+        avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                        x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+    }
+  }
+
+  nstart = -1;
+}
+
 /* ----------------------------------------------------------------------
    reverse communication of forces on atoms every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -523,6 +875,75 @@ void CommBrick::reverse_comm()
   double **f = atom->f;
   double *buf;
 
+  // persistent requests armed by borders(): just MPI_Start
+  // sends were armed on f[firstrecv] directly, so nothing to pack
+
+  if (persist_ready) {
+    for (int iswap = nswap-1; iswap >= 0; iswap--) {
+      if (sendproc[iswap] != me) {
+        if (size_reverse_recv[iswap]) MPI_Start(&persistrev_recv[iswap]);
+        if (size_reverse_send[iswap]) MPI_Start(&persistrev_send[iswap]);
+        if (size_reverse_recv[iswap])
+          MPI_Wait(&persistrev_recv[iswap],MPI_STATUS_IGNORE);
+        if (size_reverse_send[iswap])
+          MPI_Wait(&persistrev_send[iswap],MPI_STATUS_IGNORE);
+        avec->unpack_reverse(sendnum[iswap],sendlist[iswap],buf_recv);
+      } else if (sendnum[iswap])
+        avec->unpack_reverse(sendnum[iswap],sendlist[iswap],
+                             f[firstrecv[iswap]]);
+    }
+    return;
+  }
+
+  // neighborhood collectives: process hop pairs in reverse order
+  // within a pair the swaps are independent (see forward_comm), and
+  //   the f data each one returns lives back to back in f
+  // graph destination order is {procneigh 0, procneigh 1}: the reverse
+  //   send of swap iswap0 goes to recvproc[iswap0] = procneigh 1, so
+  //   the pair's slots are exchanged relative to forward comm
+
+  if (collectiveflag && graph_ready && comm_f_only) {
+    int iswap = nswap;
+    int sendcounts[2],sdispls[2],recvcounts[2],rdispls[2];
+
+    for (int dim = 2; dim >= 0; dim--) {
+      int twoneed = 2*maxneed[dim];
+      for (int ineed = 0; ineed < twoneed; ineed += 2) {
+        iswap -= 2;
+        int iswap0 = iswap;
+        int iswap1 = iswap+1;
+
+        if (sendproc[iswap0] == me) {
+          for (int is = iswap1; is >= iswap0; is--)
+            if (sendnum[is])
+              avec->unpack_reverse(sendnum[is],sendlist[is],
+                                   f[firstrecv[is]]);
+          continue;
+        }
+
+        sendcounts[0] = size_reverse_send[iswap1];
+        sdispls[0] = size_reverse_send[iswap0];
+        sendcounts[1] = size_reverse_send[iswap0];
+        sdispls[1] = 0;
+        recvcounts[0] = size_reverse_recv[iswap1];
+        recvcounts[1] = size_reverse_recv[iswap0];
+        rdispls[0] = 0;
+        rdispls[1] = recvcounts[0];
+        if (sendcounts[0] + sendcounts[1]) buf = f[firstrecv[iswap0]];
+        else buf = buf_send;
+
+        MPI_Neighbor_alltoallv(buf,sendcounts,sdispls,MPI_DOUBLE,
+                               buf_recv,recvcounts,rdispls,MPI_DOUBLE,
+                               graphcomm[dim]);
+
+        avec->unpack_reverse(sendnum[iswap1],sendlist[iswap1],buf_recv);
+        avec->unpack_reverse(sendnum[iswap0],sendlist[iswap0],
+                             &buf_recv[recvcounts[0]]);
+      }
+    }
+    return;
+  }
+
   // exchange data with another proc
   // if other proc is self, just copy
   // if comm_f_only set, exchange or copy directly from f, don't pack
@@ -562,6 +983,175 @@ void CommBrick::reverse_comm()
   }
 }
 
+/* ----------------------------------------------------------------------
+   begin reverse communication, leaving receives outstanding
+   the trailing swaps of the last communicated dim are processed first
+     in reverse comm and are independent of each other (their sendlists
+     exclude each other's arrivals), so both can be posted before any
+     wait; all procs post receives first, so the blocking sends cannot
+     deadlock
+   only f-only exchanges qualify, since their sends come directly from
+     atom->f; anything else falls back to a blocking reverse_comm()
+   caller may do work that only accumulates into owned forces, then
+     must call reverse_comm_finish()
+------------------------------------------------------------------------- */
+
+void CommBrick::reverse_comm_start()
+{
+  int k,iswap;
+  AtomVec *avec = atom->avec;
+  double **f = atom->f;
+
+  nrstart = 0;
+  if (comm_f_only && !persist_ready && !(collectiveflag && graph_ready))
+    for (int dim = 2; dim >= 0; dim--)
+      if (maxneed[dim]) {
+        nrstart = MIN(2,2*maxneed[dim]);
+        break;
+      }
+
+  // both receives must fit in buf_recv at once
+
+  if (nrstart == 2 &&
+      size_reverse_recv[nswap-1] + size_reverse_recv[nswap-2] > maxrecv)
+    nrstart = 0;
+
+  if (nrstart == 0) {
+    reverse_comm();
+    nrstart = -1;
+    return;
+  }
+
+  int offset = 0;
+  for (k = 0; k < nrstart; k++) {
+    iswap = nswap-1-k;
+    revpending[k] = 0;
+    revoffset[k] = offset;
+    if (sendproc[iswap] != me && size_reverse_recv[iswap]) {
+      MPI_Irecv(&buf_recv[offset],size_reverse_recv[iswap],MPI_DOUBLE,
+                sendproc[iswap],0,world,&revrequest[k]);
+      revpending[k] = 1;
+      offset += size_reverse_recv[iswap];
+    }
+  }
+
+  for (k = 0; k < nrstart; k++) {
+    iswap = nswap-1-k;
+    if (sendproc[iswap] != me) {
+      if (size_reverse_send[iswap])
+        MPI_Send(f[firstrecv[iswap]],size_reverse_send[iswap],MPI_DOUBLE,
+                 recvproc[iswap],0,world);
+    } else if (sendnum[iswap])
+      avec->unpack_reverse(sendnum[iswap],sendlist[iswap],
+                           f[firstrecv[iswap]]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   complete a reverse communication begun by reverse_comm_start()
+   wait on the outstanding receives, accumulate them, then perform the
+     remaining swaps, which forward contributions received above
+------------------------------------------------------------------------- */
+
+void CommBrick::reverse_comm_finish()
+{
+  int k,iswap;
+  MPI_Request request;
+  AtomVec *avec = atom->avec;
+  double **f = atom->f;
+  double *buf;
+
+  if (nrstart <= 0) return;
+
+  for (k = 0; k < nrstart; k++)
+    if (revpending[k])
+      MPI_Wait(&revrequest[k],MPI_STATUS_IGNORE);
+
+  for (k = 0; k < nrstart; k++) {
+    iswap = nswap-1-k;
+    if (sendproc[iswap] != me)
+      avec->unpack_reverse(sendnum[iswap],sendlist[iswap],
+                           &buf_recv[revoffset[k]]);
+  }
+
+  // remaining swaps, same as in reverse_comm()
+  // comm_f_only is guaranteed set, else reverse_comm_start() fell back
+
+  for (iswap = nswap-1-nrstart; iswap >= 0; iswap--) {
+    if (sendproc[iswap] != me) {
+      if (size_reverse_recv[iswap])
+        MPI_Irecv(buf_recv,size_reverse_recv[iswap],MPI_DOUBLE,
+                  sendproc[iswap],0,world,&request);
+      if (size_reverse_send[iswap]) {
+        buf = f[firstrecv[iswap]];
+        MPI_Send(buf,size_reverse_send[iswap],MPI_DOUBLE,
+                 recvproc[iswap],0,world);
+      }
+      if (size_reverse_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+      avec->unpack_reverse(sendnum[iswap],sendlist[iswap],buf_recv);
+    } else {
+      if (sendnum[iswap])
+        avec->unpack_reverse(sendnum[iswap],sendlist[iswap],
+                             f[firstrecv[iswap]]);
+    }
+  }
+
+  nrstart = -1;
+}
+
+/* ----------------------------------------------------------------------
+   reverse communication of the fixed-point force accumulators
+   the 64-bit integers travel bit-copied in the double buffers (ubuf)
+   and are summed in integer arithmetic, so the reduction is exact and
+   independent of swap and rank ordering
+------------------------------------------------------------------------- */
+
+void CommBrick::reverse_comm_det()
+{
+  int i,j,m,n,iswap,last;
+  double *buf;
+  MPI_Request request;
+
+  int64_t **f_det = atom->f_det;
+
+  for (iswap = nswap-1; iswap >= 0; iswap--) {
+
+    // pack buffer
+
+    m = 0;
+    last = firstrecv[iswap] + recvnum[iswap];
+    for (i = firstrecv[iswap]; i < last; i++) {
+      buf_send[m++] = ubuf(f_det[i][0]).d;
+      buf_send[m++] = ubuf(f_det[i][1]).d;
+      buf_send[m++] = ubuf(f_det[i][2]).d;
+    }
+    n = m;
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      if (sendnum[iswap])
+        MPI_Irecv(buf_recv,3*sendnum[iswap],MPI_DOUBLE,sendproc[iswap],0,
+                  world,&request);
+      if (recvnum[iswap])
+        MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
+      if (sendnum[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer with integer adds
+
+    m = 0;
+    for (i = 0; i < sendnum[iswap]; i++) {
+      j = sendlist[iswap][i];
+      f_det[j][0] += (int64_t) ubuf(buf[m++]).i;
+      f_det[j][1] += (int64_t) ubuf(buf[m++]).i;
+      f_det[j][2] += (int64_t) ubuf(buf[m++]).i;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    exchange: move atoms to correct processors
    atoms exchanged with all 6 stencil neighbors
@@ -615,7 +1205,37 @@ void CommBrick::exchange()
 
   int dimension = domain->dimension;
 
+  // adaptive mode = skip dims in which no proc has a migrating atom
+  // scan is local, one small allreduce insures all procs agree on skips
+  // saves the per-dim message exchanges on quiet steps
+
+  int skipdim[3];
+  skipdim[0] = skipdim[1] = skipdim[2] = 0;
+
+  if (exchadaptive && nprocs > 1) {
+    int haslocal[3],hasany[3];
+    x = atom->x;
+    nlocal = atom->nlocal;
+    for (int dim = 0; dim < dimension; dim++) {
+      haslocal[dim] = 0;
+      lo = sublo[dim];
+      hi = subhi[dim];
+      for (i = 0; i < nlocal; i++)
+        if (x[i][dim] < lo || x[i][dim] >= hi) {
+          haslocal[dim] = 1;
+          break;
+        }
+    }
+    MPI_Allreduce(haslocal,hasany,dimension,MPI_INT,MPI_MAX,world);
+    for (int dim = 0; dim < dimension; dim++)
+      if (!hasany[dim]) {
+        skipdim[dim] = 1;
+        exchskip[dim]++;
+      }
+  }
+
   for (int dim = 0; dim < dimension; dim++) {
+    if (skipdim[dim]) continue;
 
     // fill buffer with atoms leaving my box, using < and >=
     // when atom is deleted, fill it in with last atom
@@ -632,6 +1252,7 @@ void CommBrick::exchange()
         nsend += avec->pack_exchange(i,&buf_send[nsend]);
         avec->copy(nlocal-1,i,1);
         nlocal--;
+        exchmigrate[dim]++;
       } else i++;
     }
     atom->nlocal = nlocal;
@@ -756,6 +1377,8 @@ void CommBrick::borders()
           if (mode == Comm::SINGLE) {
             for (i = nfirst; i < nlast; i++)
               if (x[i][dim] >= lo && x[i][dim] <= hi) {
+                if (ghostprune && i >= atom->nlocal &&
+                    prune_ghost(i,dim,ineed % 2)) continue;
                 if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
                 sendlist[iswap][nsend++] = i;
               }
@@ -763,6 +1386,8 @@ void CommBrick::borders()
             for (i = nfirst; i < nlast; i++) {
               itype = type[i];
               if (x[i][dim] >= mlo[itype] && x[i][dim] <= mhi[itype]) {
+                if (ghostprune && i >= atom->nlocal &&
+                    prune_ghost(i,dim,ineed % 2)) continue;
                 if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
                 sendlist[iswap][nsend++] = i;
               }
@@ -779,6 +1404,7 @@ void CommBrick::borders()
               }
             for (i = atom->nlocal; i < nlast; i++)
               if (x[i][dim] >= lo && x[i][dim] <= hi) {
+                if (ghostprune && prune_ghost(i,dim,ineed % 2)) continue;
                 if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
                 sendlist[iswap][nsend++] = i;
               }
@@ -794,6 +1420,7 @@ void CommBrick::borders()
             for (i = atom->nlocal; i < nlast; i++) {
               itype = type[i];
               if (x[i][dim] >= mlo[itype] && x[i][dim] <= mhi[itype]) {
+                if (ghostprune && prune_ghost(i,dim,ineed % 2)) continue;
                 if (nsend == maxsendlist[iswap]) grow_list(iswap,nsend);
                 sendlist[iswap][nsend++] = i;
               }
@@ -864,6 +1491,321 @@ void CommBrick::borders()
   // reset global->local map
 
   if (map_style) atom->map_set();
+
+  // collective exchange packs/receives both swaps of a hop pair at
+  // once, which can exceed the single-swap sizing done above
+
+  if (collectiveflag && graph_ready) {
+    int needs = 0;
+    int needr = 0;
+    for (int is = 0; is+1 < nswap; is += 2) {
+      needs = MAX(needs,size_forward*(sendnum[is]+sendnum[is+1]));
+      needr = MAX(needr,size_reverse*(sendnum[is]+sendnum[is+1]));
+    }
+    if (needs > maxsend) grow_send(needs,0);
+    if (needr > maxrecv) grow_recv(needr);
+  }
+
+  // re-arm persistent requests or the shared-memory window
+  // for the new swap partners and sizes
+
+  if (persistent) arm_persistent();
+  if (shmflag) arm_shm();
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if ghost atom i cannot be within the ghost cutoff of the
+   subdomain of any receiver of a border swap in dim
+   dir = 0/1 for sending toward the lower/upper neighbor procs
+   receivers share my subdomain extent in the other dims (regular grid)
+   and lie no closer than my own boundary in the swap dim, so the
+   distance computed here is a lower bound on the true distance
+   for multi mode, test against the cutoff for the type of atom i,
+     matching the per-type slab test that selected it
+   only called for orthogonal boxes
+------------------------------------------------------------------------- */
+
+int CommBrick::prune_ghost(int i, int dim, int dir)
+{
+  int d;
+  double cut,delta,dsq;
+
+  double *coord = atom->x[i];
+  double *sublo = domain->sublo;
+  double *subhi = domain->subhi;
+
+  if (mode == Comm::SINGLE) cut = cutghost[dim];
+  else cut = cutghostmulti[atom->type[i]][dim];
+
+  if (dir == 0) dsq = MAX(0.0,coord[dim] - sublo[dim]);
+  else dsq = MAX(0.0,subhi[dim] - coord[dim]);
+  dsq *= dsq;
+
+  for (d = 0; d < 3; d++) {
+    if (d == dim) continue;
+    delta = MAX(sublo[d] - coord[d],coord[d] - subhi[d]);
+    if (delta > 0.0) dsq += delta*delta;
+  }
+
+  return dsq > cut*cut;
+}
+
+/* ----------------------------------------------------------------------
+   create persistent MPI requests for every forward and reverse swap
+   called at end of borders(), when partners, counts, and the recv
+     locations in atom->x and send locations in atom->f are fixed
+     until the next reneighboring
+   forward sends pack into per-swap regions of buf_persist so each
+     message buffer belongs to exactly one request
+   requires comm_x_only and comm_f_only, so coords and forces are
+     exchanged in place with no unpack/pack of buf_recv/buf_send
+------------------------------------------------------------------------- */
+
+void CommBrick::arm_persistent()
+{
+  int iswap,offset;
+  double **x = atom->x;
+  double **f = atom->f;
+
+  free_persistent();
+
+  if (!comm_x_only || !comm_f_only) return;
+
+  npersist = nswap;
+  persistfwd_send = new MPI_Request[nswap];
+  persistfwd_recv = new MPI_Request[nswap];
+  persistrev_send = new MPI_Request[nswap];
+  persistrev_recv = new MPI_Request[nswap];
+  memory->create(persist_offset,nswap,"comm:persist_offset");
+
+  offset = 0;
+  for (iswap = 0; iswap < nswap; iswap++)
+    if (sendproc[iswap] != me) offset += size_forward*sendnum[iswap];
+  if (offset > maxpersist) {
+    maxpersist = offset;
+    memory->destroy(buf_persist);
+    memory->create(buf_persist,maxpersist,"comm:buf_persist");
+  }
+
+  offset = 0;
+  for (iswap = 0; iswap < nswap; iswap++) {
+    persistfwd_send[iswap] = persistfwd_recv[iswap] = MPI_REQUEST_NULL;
+    persistrev_send[iswap] = persistrev_recv[iswap] = MPI_REQUEST_NULL;
+    if (sendproc[iswap] == me) continue;
+
+    persist_offset[iswap] = offset;
+    if (size_forward_recv[iswap])
+      MPI_Recv_init(x[firstrecv[iswap]],size_forward_recv[iswap],MPI_DOUBLE,
+                    recvproc[iswap],0,world,&persistfwd_recv[iswap]);
+    if (sendnum[iswap])
+      MPI_Send_init(&buf_persist[offset],size_forward*sendnum[iswap],
+                    MPI_DOUBLE,sendproc[iswap],0,world,
+                    &persistfwd_send[iswap]);
+    if (size_reverse_recv[iswap])
+      MPI_Recv_init(buf_recv,size_reverse_recv[iswap],MPI_DOUBLE,
+                    sendproc[iswap],0,world,&persistrev_recv[iswap]);
+    if (size_reverse_send[iswap])
+      MPI_Send_init(f[firstrecv[iswap]],size_reverse_send[iswap],MPI_DOUBLE,
+                    recvproc[iswap],0,world,&persistrev_send[iswap]);
+    offset += size_forward*sendnum[iswap];
+  }
+
+  persist_ready = 1;
+}
+
+/* ----------------------------------------------------------------------
+   free persistent requests and mark them not armed
+------------------------------------------------------------------------- */
+
+void CommBrick::free_persistent()
+{
+  if (persistfwd_send == NULL) return;
+
+  for (int iswap = 0; iswap < npersist; iswap++) {
+    if (persistfwd_send[iswap] != MPI_REQUEST_NULL)
+      MPI_Request_free(&persistfwd_send[iswap]);
+    if (persistfwd_recv[iswap] != MPI_REQUEST_NULL)
+      MPI_Request_free(&persistfwd_recv[iswap]);
+    if (persistrev_send[iswap] != MPI_REQUEST_NULL)
+      MPI_Request_free(&persistrev_send[iswap]);
+    if (persistrev_recv[iswap] != MPI_REQUEST_NULL)
+      MPI_Request_free(&persistrev_recv[iswap]);
+  }
+
+  delete [] persistfwd_send;
+  delete [] persistfwd_recv;
+  delete [] persistrev_send;
+  delete [] persistrev_recv;
+  persistfwd_send = persistfwd_recv = NULL;
+  persistrev_send = persistrev_recv = NULL;
+  memory->destroy(persist_offset);
+  persist_offset = NULL;
+
+  npersist = 0;
+  persist_ready = 0;
+}
+
+/* ----------------------------------------------------------------------
+   create the communicator of procs sharing my physical node and record
+     their world ranks, so swap partners can be classified on/off-node
+   called once from init() when comm_modify shm is set
+------------------------------------------------------------------------- */
+
+void CommBrick::setup_node()
+{
+  if (nodesize) return;
+
+  MPI_Comm_split_type(world,MPI_COMM_TYPE_SHARED,me,MPI_INFO_NULL,&nodecomm);
+  MPI_Comm_size(nodecomm,&nodesize);
+  memory->create(noderanks,nodesize,"comm:noderanks");
+  MPI_Allgather(&me,1,MPI_INT,noderanks,1,MPI_INT,nodecomm);
+}
+
+/* ----------------------------------------------------------------------
+   node rank of world rank proc, -1 if proc is not on my node
+------------------------------------------------------------------------- */
+
+int CommBrick::node_rank(int proc)
+{
+  for (int i = 0; i < nodesize; i++)
+    if (noderanks[i] == proc) return i;
+  return -1;
+}
+
+/* ----------------------------------------------------------------------
+   arm the shared-memory forward comm path for the current swaps
+   called at end of borders(), collectively across all procs
+   lays out per-swap regions of my window segment, reallocates the
+     window if any node proc outgrew its segment (window operations are
+     collective over the node, and all procs reach borders together),
+     and tells each on-node receiver where its message will be packed
+   swap indices align across procs because maxneed is a global max,
+     so swap i of my receive partner produces my swap i message
+------------------------------------------------------------------------- */
+
+void CommBrick::arm_shm()
+{
+  int iswap,roff,dispunit;
+  MPI_Aint winsize;
+  MPI_Request request;
+  double *base;
+
+  free_shm();
+
+  nshm = nswap;
+  memory->create(sendnode,nswap,"comm:sendnode");
+  memory->create(recvnode,nswap,"comm:recvnode");
+  memory->create(shmoffset,nswap,"comm:shmoffset");
+  memory->create(shmpending,nswap,"comm:shmpending");
+  shmptr = (double **) memory->smalloc(nswap*sizeof(double *),"comm:shmptr");
+  shmack = new MPI_Request[nswap];
+
+  // classify partners and lay out my window segment
+
+  int offset = 0;
+  for (iswap = 0; iswap < nswap; iswap++) {
+    shmpending[iswap] = 0;
+    shmptr[iswap] = NULL;
+    shmoffset[iswap] = offset;
+    if (sendproc[iswap] == me) {
+      sendnode[iswap] = recvnode[iswap] = -1;
+      continue;
+    }
+    sendnode[iswap] = node_rank(sendproc[iswap]);
+    recvnode[iswap] = node_rank(recvproc[iswap]);
+    if (sendnode[iswap] >= 0) offset += size_forward*sendnum[iswap];
+  }
+
+  // reallocate window if any node proc outgrew its segment
+
+  int grow = offset > maxshm;
+  int growany;
+  MPI_Allreduce(&grow,&growany,1,MPI_INT,MPI_MAX,nodecomm);
+  if (growany) {
+    if (shmwin != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(shmwin);
+      MPI_Win_free(&shmwin);
+    }
+    maxshm = MAX(static_cast<int> (BUFFACTOR*offset),BUFMIN);
+    MPI_Win_allocate_shared((MPI_Aint) maxshm*sizeof(double),sizeof(double),
+                            MPI_INFO_NULL,nodecomm,&shmbuf,&shmwin);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK,shmwin);
+  }
+
+  // tell each on-node receiver where in my segment I pack its message
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+    if (recvnode[iswap] >= 0)
+      MPI_Irecv(&roff,1,MPI_INT,recvproc[iswap],0,world,&request);
+    if (sendnode[iswap] >= 0)
+      MPI_Send(&shmoffset[iswap],1,MPI_INT,sendproc[iswap],0,world);
+    if (recvnode[iswap] >= 0) {
+      MPI_Wait(&request,MPI_STATUS_IGNORE);
+      MPI_Win_shared_query(shmwin,recvnode[iswap],&winsize,&dispunit,&base);
+      shmptr[iswap] = base + roff;
+    }
+  }
+
+  shm_ready = 1;
+}
+
+/* ----------------------------------------------------------------------
+   create one 2-neighbor distributed graph communicator per dimension,
+     describing the left/right swap partners of that dim
+   giving MPI the communication graph lets the library schedule the
+     exchanges by network topology
+   called once from init() when comm_modify collective is set
+   source order {procneigh 1, procneigh 0} matches the receive sides
+     of the two direction swaps in forward comm
+------------------------------------------------------------------------- */
+
+void CommBrick::setup_graphs()
+{
+  if (graph_ready) return;
+
+  int sources[2],destinations[2];
+
+  for (int dim = 0; dim < 3; dim++) {
+    graphcomm[dim] = MPI_COMM_NULL;
+    if (procgrid[dim] == 1) continue;
+    sources[0] = procneigh[dim][1];
+    sources[1] = procneigh[dim][0];
+    destinations[0] = procneigh[dim][0];
+    destinations[1] = procneigh[dim][1];
+    MPI_Dist_graph_create_adjacent(world,2,sources,MPI_UNWEIGHTED,
+                                   2,destinations,MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL,0,&graphcomm[dim]);
+  }
+
+  graph_ready = 1;
+}
+
+/* ----------------------------------------------------------------------
+   wait on outstanding receiver acks and free per-swap shm arrays
+   the window itself is kept until it must grow or CommBrick dies
+------------------------------------------------------------------------- */
+
+void CommBrick::free_shm()
+{
+  if (sendnode == NULL) return;
+
+  for (int iswap = 0; iswap < nshm; iswap++)
+    if (shmpending[iswap]) MPI_Wait(&shmack[iswap],MPI_STATUS_IGNORE);
+
+  memory->destroy(sendnode);
+  memory->destroy(recvnode);
+  memory->destroy(shmoffset);
+  memory->destroy(shmpending);
+  memory->sfree(shmptr);
+  delete [] shmack;
+  sendnode = recvnode = NULL;
+  shmoffset = NULL;
+  shmpending = NULL;
+  shmptr = NULL;
+  shmack = NULL;
+
+  nshm = 0;
+  shm_ready = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -905,6 +1847,149 @@ void CommBrick::forward_comm_pair(Pair *pair)
   }
 }
 
+/* ----------------------------------------------------------------------
+   forward communication from a Pair with the final swap left in flight
+   all swaps but the last are performed as in forward_comm_pair(),
+   the last inter-proc exchange is posted but not waited on so the
+   caller can overlap work that does not read its ghost atoms
+   returns index of the first ghost atom whose data is still pending,
+   nlocal+nghost if nothing was left in flight
+   caller must invoke forward_comm_pair_finish() before any other
+   communication and before reading the pending ghost data
+------------------------------------------------------------------------- */
+
+int CommBrick::forward_comm_pair_start(Pair *pair)
+{
+  int iswap,n;
+  double *buf;
+  MPI_Request request;
+
+  int nsize = pair->comm_forward;
+  pairswap_pending = -1;
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+
+    // pack buffer
+
+    n = pair->pack_forward_comm(sendnum[iswap],sendlist[iswap],
+                                buf_send,pbc_flag[iswap],pbc[iswap]);
+
+    // post the final inter-proc exchange and return with it in flight
+    // earlier swaps cannot be left pending since their arrivals can be
+    // forwarded again by later swaps
+
+    if (iswap == nswap-1 && sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(buf_recv,nsize*recvnum[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&pairswap_request);
+      if (sendnum[iswap])
+        MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+      pairswap_pending = iswap;
+      return firstrecv[iswap];
+    }
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(buf_recv,nsize*recvnum[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&request);
+      if (sendnum[iswap])
+        MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+      if (recvnum[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer
+
+    pair->unpack_forward_comm(recvnum[iswap],firstrecv[iswap],buf);
+  }
+
+  return atom->nlocal + atom->nghost;
+}
+
+/* ----------------------------------------------------------------------
+   complete a pair forward comm begun by forward_comm_pair_start()
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_pair_finish(Pair *pair)
+{
+  if (pairswap_pending < 0) return;
+  int iswap = pairswap_pending;
+  pairswap_pending = -1;
+
+  if (recvnum[iswap]) MPI_Wait(&pairswap_request,MPI_STATUS_IGNORE);
+  pair->unpack_forward_comm(recvnum[iswap],firstrecv[iswap],buf_recv);
+}
+
+/* ----------------------------------------------------------------------
+   fused forward communication of all queued Pairs/Fixes
+   all producers pack into one send buffer per swap, so each swap
+     exchanges a single message instead of one message per producer
+   recv buffer is split by each producer's per-atom size, so producers
+     must pack exactly that many datums per atom
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_coalesced()
+{
+  int i,iswap,n,offset;
+  double *buf;
+  MPI_Request request;
+
+  // insure buffers can hold the fused message, which may exceed
+  // the maxforward sizing done for single-producer exchanges
+
+  int nsize = 0;
+  for (i = 0; i < ncoalesce; i++) nsize += coalesce_sizes[i];
+  if (nsize*smax > maxsend) grow_send(nsize*smax,0);
+  if (nsize*rmax > maxrecv) grow_recv(nsize*rmax);
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+
+    // pack buffer, all producers consecutively
+
+    offset = 0;
+    for (i = 0; i < ncoalesce; i++) {
+      if (coalesce_pairs[i])
+        n = coalesce_pairs[i]->
+          pack_forward_comm(sendnum[iswap],sendlist[iswap],
+                            &buf_send[offset],pbc_flag[iswap],pbc[iswap]);
+      else
+        n = coalesce_fixes[i]->
+          pack_forward_comm(sendnum[iswap],sendlist[iswap],
+                            &buf_send[offset],pbc_flag[iswap],pbc[iswap]);
+      offset += n;
+    }
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(buf_recv,nsize*recvnum[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&request);
+      if (sendnum[iswap])
+        MPI_Send(buf_send,offset,MPI_DOUBLE,sendproc[iswap],0,world);
+      if (recvnum[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer, each producer from its own segment
+
+    offset = 0;
+    for (i = 0; i < ncoalesce; i++) {
+      if (coalesce_pairs[i])
+        coalesce_pairs[i]->
+          unpack_forward_comm(recvnum[iswap],firstrecv[iswap],&buf[offset]);
+      else
+        coalesce_fixes[i]->
+          unpack_forward_comm(recvnum[iswap],firstrecv[iswap],&buf[offset]);
+      offset += coalesce_sizes[i]*recvnum[iswap];
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    reverse communication invoked by a Pair
    nsize used only to set recv buffer limit
@@ -1366,6 +2451,11 @@ void CommBrick::grow_send(int n, int flag)
 
 void CommBrick::grow_recv(int n)
 {
+  // persistent reverse requests receive into buf_recv: disarm them,
+  // borders() will re-arm on the new buffer
+
+  free_persistent();
+
   maxrecv = static_cast<int> (BUFFACTOR * n);
   memory->destroy(buf_recv);
   memory->create(buf_recv,maxrecv,"comm:buf_recv");
@@ -1506,5 +2596,7 @@ bigint CommBrick::memory_usage()
     bytes += memory->usage(sendlist[i],maxsendlist[i]);
   bytes += memory->usage(buf_send,maxsend+bufextra);
   bytes += memory->usage(buf_recv,maxrecv);
+  bytes += memory->usage(buf_persist,maxpersist);
+  bytes += (bigint) maxshm * sizeof(double);    // shared-memory window
   return bytes;
 }
@@ -27,11 +27,20 @@ class CommBrick : public Comm {
   virtual void init();
   virtual void setup();                        // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0);    // forward comm of atom coords
+  virtual void forward_comm_start(int dummy = 0);  // post independent swaps
+  virtual void forward_comm_finish();          // wait, do dependent swaps
   virtual void reverse_comm();                 // reverse comm of forces
+  virtual void reverse_comm_det();             // reverse comm of f_det
+  virtual void reverse_comm_start();           // post independent swaps
+  virtual void reverse_comm_finish();          // wait, accumulate, finish
   virtual void exchange();                     // move atoms to new procs
   virtual void borders();                      // setup list of atoms to comm
 
   virtual void forward_comm_pair(class Pair *);    // forward comm from a Pair
+  virtual int forward_comm_pair_start(class Pair *);
+                                     // as above but final swap left in flight
+  virtual void forward_comm_pair_finish(class Pair *);
+                                     // wait on and unpack the final swap
   virtual void reverse_comm_pair(class Pair *);    // reverse comm from a Pair
   virtual void forward_comm_fix(class Fix *, int size=0);
                                                    // forward comm from a Fix
@@ -80,6 +89,64 @@ class CommBrick : public Comm {
   void init_buffers();
 
   int updown(int, int, int, double, int, double *);
+  int prune_ghost(int, int, int);   // 1 if ghost out of Euclidean range
+
+  int nstart;                       // # of swaps posted by forward_comm_start
+                                    //   -1 if it fell back to forward_comm
+  int startpending[2];              // 1 if a receive is still outstanding
+  MPI_Request startrequest[2];      // requests for the outstanding receives
+
+  int nrstart;                      // # of swaps posted by reverse_comm_start
+                                    //   -1 if it fell back to reverse_comm
+  int revpending[2];                // 1 if a receive is still outstanding
+  int revoffset[2];                 // recv region of each swap in buf_recv
+  MPI_Request revrequest[2];        // requests for the outstanding receives
+
+  int pairswap_pending;             // swap left in flight by
+                                    //   forward_comm_pair_start, -1 if none
+  MPI_Request pairswap_request;     // request for its outstanding receive
+
+  int persist_ready;                // 1 if persistent requests are armed
+  int npersist;                     // # of swaps requests are armed for
+  int maxpersist;                   // allocated size of buf_persist
+  int *persist_offset;              // offset of each swap in buf_persist
+  double *buf_persist;              // per-swap send regions, stay valid
+                                    //   until each persistent send completes
+  MPI_Request *persistfwd_send,*persistfwd_recv;  // forward comm requests
+  MPI_Request *persistrev_send,*persistrev_recv;  // reverse comm requests
+
+  void arm_persistent();            // create persistent requests for all swaps
+  void free_persistent();           // free persistent requests
+
+  MPI_Comm nodecomm;                // procs sharing my physical node
+  int nodesize;                     // # of procs in nodecomm, 0 before setup
+  int *noderanks;                   // world rank of each nodecomm proc
+  MPI_Win shmwin;                   // window holding my packed forward data
+  double *shmbuf;                   // base of my window segment
+  int maxshm;                       // # of doubles allocated in my segment
+  int shm_ready;                    // 1 if shared-memory path is armed
+  int nshm;                         // # of swaps shm arrays are sized for
+  int *sendnode,*recvnode;          // node rank of send/recv partner per
+                                    //   swap, -1 if off-node or self
+  int *shmoffset;                   // where each swap packs into shmbuf
+  double **shmptr;                  // where each swap's incoming message
+                                    //   lives in the sending proc's segment
+  int *shmpending;                  // 1 if receiver ack still outstanding
+  MPI_Request *shmack;              // requests for the outstanding acks
+  int shmdummy;                     // recv target for zero-count messages
+
+  void setup_node();                // create nodecomm, identify node procs
+  int node_rank(int);               // node rank of a world rank, -1 if off
+  void arm_shm();                   // size window, exchange pack offsets
+  void free_shm();                  // wait on acks, free per-swap arrays
+
+  MPI_Comm graphcomm[3];            // per-dim 2-neighbor graph communicator
+                                    //   MPI_COMM_NULL if dim has one proc
+  int graph_ready;                  // 1 if graph comms are created
+
+  void setup_graphs();              // create per-dim graph communicators
+
+  virtual void forward_comm_coalesced();  // fused comm of queued producers
                                             // compare cutoff to procs
   virtual void grow_send(int, int);         // reallocate send buffer
   virtual void grow_recv(int);              // free/allocate recv buffer
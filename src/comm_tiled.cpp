@@ -132,6 +132,17 @@ void CommTiled::setup()
 {
   int i,j,n;
 
+  if (ghostprune)
+    error->all(FLERR,"Comm_modify prune is not supported by comm style tiled");
+  if (persistent)
+    error->all(FLERR,
+               "Comm_modify persistent is not supported by comm style tiled");
+  if (shmflag)
+    error->all(FLERR,"Comm_modify shm is not supported by comm style tiled");
+  if (collectiveflag)
+    error->all(FLERR,
+               "Comm_modify collective is not supported by comm style tiled");
+
   // domain properties used in setup method and methods it calls
 
   dimension = domain->dimension;
@@ -752,6 +763,17 @@ void CommTiled::reverse_comm()
   }
 }
 
+/* ----------------------------------------------------------------------
+   reverse communication of the fixed-point force accumulators
+   not supported by tiled decomposition, Atom::init() errors out first
+------------------------------------------------------------------------- */
+
+void CommTiled::reverse_comm_det()
+{
+  error->all(FLERR,"Comm_style tiled does not support "
+             "deterministic force accumulation");
+}
+
 /* ----------------------------------------------------------------------
    exchange: move atoms to correct processors
    atoms exchanged with procs that touch sub-box in each of 3 dims
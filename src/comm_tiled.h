@@ -28,6 +28,7 @@ class CommTiled : public Comm {
   void setup();                        // setup comm pattern
   virtual void forward_comm(int dummy = 0);    // forward comm of atom coords
   virtual void reverse_comm();                 // reverse comm of forces
+  virtual void reverse_comm_det();             // reverse comm of f_det
   virtual void exchange();                     // move atoms to new procs
   virtual void borders();                      // setup list of atoms to comm
 
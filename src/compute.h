@@ -74,6 +74,7 @@ class Compute : protected Pointers {
   bigint *tlist;      // list of timesteps the Compute is called on
 
   int invoked_flag;       // non-zero if invoked or accessed this step, 0 if not
+  double time_detail;     // accumulated wall time, for timer detail
   bigint invoked_scalar;  // last timestep on which compute_scalar() was invoked
   bigint invoked_vector;  // ditto for compute_vector()
   bigint invoked_array;   // ditto for compute_array()
@@ -40,7 +40,7 @@ using namespace LAMMPS_NS;
 
 ComputeAggregateAtom::ComputeAggregateAtom(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
-  aggregateID(NULL)
+  aggregateID(NULL), parent(NULL)
 {
   if (narg != 4) error->all(FLERR,"Illegal compute aggregate/atom command");
 
@@ -63,6 +63,7 @@ ComputeAggregateAtom::ComputeAggregateAtom(LAMMPS *lmp, int narg, char **arg) :
 ComputeAggregateAtom::~ComputeAggregateAtom()
 {
   memory->destroy(aggregateID);
+  memory->destroy(parent);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -112,12 +113,14 @@ void ComputeAggregateAtom::compute_peratom()
 
   invoked_peratom = update->ntimestep;
 
-  // grow aggregateID array if necessary
+  // grow aggregateID and union-find arrays if necessary
 
   if (atom->nmax > nmax) {
     memory->destroy(aggregateID);
+    memory->destroy(parent);
     nmax = atom->nmax;
     memory->create(aggregateID,nmax,"aggregate/atom:aggregateID");
+    memory->create(parent,nmax,"aggregate/atom:parent");
     vector_atom = aggregateID;
   }
 
@@ -148,22 +151,72 @@ void ComputeAggregateAtom::compute_peratom()
   int **firstneigh = list->firstneigh;
   double **x = atom->x;
 
-  for (i = 0; i < nlocal + atom->nghost; i++)
+  int nall = nlocal + atom->nghost;
+
+  for (i = 0; i < nall; i++)
     if (mask[i] & groupbit) aggregateID[i] = tag[i];
     else aggregateID[i] = 0;
 
+  // build union-find over local topology in a single pass,
+  //   first over bonds of my atoms, then over neighbors within the cutoff
+  // edges do not change between iterations, only labels do,
+  //   so connectivity is resolved once up front
+  // my atoms come first in parent, so the root of any component
+  //   containing one of my atoms is always one of my atoms
+
+  for (i = 0; i < nall; i++) parent[i] = i;
+
+  for (i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+
+    for (j = 0; j < num_bond[i]; j++) {
+      if (bond_type[i][j] == 0) continue;
+      k = atom->map(bond_atom[i][j]);
+      if (k < 0) continue;
+      if (!(mask[k] & groupbit)) continue;
+
+      int ri = find_root(i);
+      int rk = find_root(k);
+      if (ri != rk) parent[MAX(ri,rk)] = MIN(ri,rk);
+    }
+  }
+
+  for (int ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+
+    for (int jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      if (!(mask[j] & groupbit)) continue;
+
+      const double delx = xtmp - x[j][0];
+      const double dely = ytmp - x[j][1];
+      const double delz = ztmp - x[j][2];
+      const double rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq < cutsq) {
+        int ri = find_root(i);
+        int rj = find_root(j);
+        if (ri != rj) parent[MAX(ri,rj)] = MIN(ri,rj);
+      }
+    }
+  }
+
   // loop until no more changes on any proc:
   // acquire aggregateIDs of ghost atoms
-  // loop over my atoms, and check atoms bound to it
-  // if both atoms are in aggregate, assign lowest aggregateID to both
-  // then loop over my atoms, checking distance to neighbors
-  // if both atoms are in cluster, assign lowest clusterID to both
-  // iterate until no changes in my atoms
-  // then check if any proc made changes
+  // pull the lowest aggregateID in each local component onto its root,
+  //   then push it back out to every atom of the component
+  // check if any proc assigned a lower ID to one of its own atoms
 
   commflag = 1;
 
-  int change,done,anychange;
+  int change,anychange;
 
   while (1) {
     comm->forward_comm_compute(this);
@@ -174,52 +227,21 @@ void ComputeAggregateAtom::compute_peratom()
       comm->reverse_comm_compute(this);
 
     change = 0;
-    while (1) {
-      done = 1;
-      for (i = 0; i < nlocal; i++) {
-        if (!(mask[i] & groupbit)) continue;
-
-        for (j = 0; j < num_bond[i]; j++) {
-          if (bond_type[i][j] == 0) continue;
-          k = atom->map(bond_atom[i][j]);
-          if (k < 0) continue;
-          if (!(mask[k] & groupbit)) continue;
-          if (aggregateID[i] == aggregateID[k]) continue;
-
-          aggregateID[i] = aggregateID[k] = MIN(aggregateID[i],aggregateID[k]);
-          done = 0;
-        }
+    for (i = 0; i < nall; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      j = find_root(i);
+      if (aggregateID[i] < aggregateID[j]) {
+        aggregateID[j] = aggregateID[i];
+        if (j < nlocal) change = 1;
       }
-
-      for (int ii = 0; ii < inum; ii++) {
-        i = ilist[ii];
-        if (!(mask[i] & groupbit)) continue;
-
-        const double xtmp = x[i][0];
-        const double ytmp = x[i][1];
-        const double ztmp = x[i][2];
-        int *jlist = firstneigh[i];
-        const int jnum = numneigh[i];
-
-        for (int jj = 0; jj < jnum; jj++) {
-          j = jlist[jj];
-          j &= NEIGHMASK;
-          if (!(mask[j] & groupbit)) continue;
-          if (aggregateID[i] == aggregateID[j]) continue;
-
-          const double delx = xtmp - x[j][0];
-          const double dely = ytmp - x[j][1];
-          const double delz = ztmp - x[j][2];
-          const double rsq = delx*delx + dely*dely + delz*delz;
-          if (rsq < cutsq) {
-            aggregateID[i] = aggregateID[j]
-              = MIN(aggregateID[i],aggregateID[j]);
-            done = 0;
-          }
-        }
+    }
+    for (i = 0; i < nall; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      j = find_root(i);
+      if (aggregateID[i] != aggregateID[j]) {
+        if (i < nlocal) change = 1;
+        aggregateID[i] = aggregateID[j];
       }
-      if (!done) change = 1;
-      if (done) break;
     }
 
     // stop if all procs are done
@@ -229,6 +251,19 @@ void ComputeAggregateAtom::compute_peratom()
   }
 }
 
+/* ----------------------------------------------------------------------
+   union-find root lookup with path halving
+------------------------------------------------------------------------- */
+
+int ComputeAggregateAtom::find_root(int i)
+{
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int ComputeAggregateAtom::pack_forward_comm(int n, int *list, double *buf,
@@ -313,5 +348,6 @@ void ComputeAggregateAtom::unpack_reverse_comm(int n, int *list, double *buf)
 double ComputeAggregateAtom::memory_usage()
 {
   double bytes = nmax * sizeof(double);
+  bytes += nmax * sizeof(int);
   return bytes;
 }
@@ -42,6 +42,9 @@ class ComputeAggregateAtom : public Compute {
   double cutsq;
   class NeighList *list;
   double *aggregateID;
+  int *parent;             // union-find parent for local+ghost atoms
+
+  int find_root(int);
 };
 
 }
@@ -39,7 +39,8 @@ enum{DIST,VELVIB,OMEGA,ENGTRANS,ENGVIB,ENGROT,ENGPOT,FORCE,FX,FY,FZ,VARIABLE};
 
 ComputeBondLocal::ComputeBondLocal(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
-  bstyle(NULL), vvar(NULL), dstr(NULL), vstr(NULL), vlocal(NULL), alocal(NULL)
+  bstyle(NULL), vvar(NULL), dstr(NULL), vstr(NULL), vlocal(NULL), alocal(NULL),
+  dbuf(NULL), bmap(NULL)
 {
   if (narg < 4) error->all(FLERR,"Illegal compute bond/local command");
 
@@ -159,6 +160,8 @@ ComputeBondLocal::~ComputeBondLocal()
 
   memory->destroy(vlocal);
   memory->destroy(alocal);
+  memory->destroy(dbuf);
+  memory->destroy(bmap);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -290,146 +293,163 @@ int ComputeBondLocal::compute_bonds(int flag)
       if (newton_bond == 0 && tag[atom1] > tag[atom2]) continue;
       if (btype == 0) continue;
 
-      if (!flag) {
-        m++;
-        continue;
+      if (flag) {
+        dbuf[m][0] = x[atom1][0] - x[atom2][0];
+        dbuf[m][1] = x[atom1][1] - x[atom2][1];
+        dbuf[m][2] = x[atom1][2] - x[atom2][2];
+        bmap[m][0] = atom1;
+        bmap[m][1] = atom2;
+        bmap[m][2] = btype;
       }
 
-      dx = x[atom1][0] - x[atom2][0];
-      dy = x[atom1][1] - x[atom2][1];
-      dz = x[atom1][2] - x[atom2][2];
-      domain->minimum_image(dx,dy,dz);
-      rsq = dx*dx + dy*dy + dz*dz;
+      m++;
+    }
+  }
 
-      if (btype == 0) {
-        engpot = fbond = 0.0;
-        engvib = engrot = engtrans = omegasq = vvib = 0.0;
-      } else {
+  if (!flag) return m;
+
+  // apply minimum image convention to all bond deltas in one batched call
 
-        if (singleflag) engpot = bond->single(btype,rsq,atom1,atom2,fbond);
+  domain->minimum_image(m,dbuf);
 
-        if (velflag) {
-          if (rmass) {
-            mass1 = rmass[atom1];
-            mass2 = rmass[atom2];
-          }
-          else {
-            mass1 = mass[type[atom1]];
-            mass2 = mass[type[atom2]];
-          }
-          masstotal = mass1+mass2;
-          invmasstotal = 1.0 / (masstotal);
-          xcm[0] = (mass1*x[atom1][0] + mass2*x[atom2][0]) * invmasstotal;
-          xcm[1] = (mass1*x[atom1][1] + mass2*x[atom2][1]) * invmasstotal;
-          xcm[2] = (mass1*x[atom1][2] + mass2*x[atom2][2]) * invmasstotal;
-          vcm[0] = (mass1*v[atom1][0] + mass2*v[atom2][0]) * invmasstotal;
-          vcm[1] = (mass1*v[atom1][1] + mass2*v[atom2][1]) * invmasstotal;
-          vcm[2] = (mass1*v[atom1][2] + mass2*v[atom2][2]) * invmasstotal;
+  // compute requested info for each counted bond
 
-          engtrans = 0.5 * masstotal * MathExtra::lensq3(vcm);
+  for (int mb = 0; mb < m; mb++) {
+    atom1 = bmap[mb][0];
+    atom2 = bmap[mb][1];
+    btype = bmap[mb][2];
 
-          // r12 = unit bond vector from atom1 to atom2
+    dx = dbuf[mb][0];
+    dy = dbuf[mb][1];
+    dz = dbuf[mb][2];
+    rsq = dx*dx + dy*dy + dz*dz;
 
-          MathExtra::sub3(x[atom2],x[atom1],r12);
-          MathExtra::norm3(r12);
+    if (btype == 0) {
+      engpot = fbond = 0.0;
+      engvib = engrot = engtrans = omegasq = vvib = 0.0;
+    } else {
 
-          // delr = vector from COM to each atom
-          // delv = velocity of each atom relative to COM
+      if (singleflag) engpot = bond->single(btype,rsq,atom1,atom2,fbond);
 
-          MathExtra::sub3(x[atom1],xcm,delr1);
-          MathExtra::sub3(x[atom2],xcm,delr2);
-          MathExtra::sub3(v[atom1],vcm,delv1);
-          MathExtra::sub3(v[atom2],vcm,delv2);
+      if (velflag) {
+        if (rmass) {
+          mass1 = rmass[atom1];
+          mass2 = rmass[atom2];
+        }
+        else {
+          mass1 = mass[type[atom1]];
+          mass2 = mass[type[atom2]];
+        }
+        masstotal = mass1+mass2;
+        invmasstotal = 1.0 / (masstotal);
+        xcm[0] = (mass1*x[atom1][0] + mass2*x[atom2][0]) * invmasstotal;
+        xcm[1] = (mass1*x[atom1][1] + mass2*x[atom2][1]) * invmasstotal;
+        xcm[2] = (mass1*x[atom1][2] + mass2*x[atom2][2]) * invmasstotal;
+        vcm[0] = (mass1*v[atom1][0] + mass2*v[atom2][0]) * invmasstotal;
+        vcm[1] = (mass1*v[atom1][1] + mass2*v[atom2][1]) * invmasstotal;
+        vcm[2] = (mass1*v[atom1][2] + mass2*v[atom2][2]) * invmasstotal;
 
-          // vpar = component of delv parallel to bond vector
+        engtrans = 0.5 * masstotal * MathExtra::lensq3(vcm);
 
-          vpar1 = MathExtra::dot3(delv1,r12);
-          vpar2 = MathExtra::dot3(delv2,r12);
-          engvib = 0.5 * (mass1*vpar1*vpar1 + mass2*vpar2*vpar2);
+        // r12 = unit bond vector from atom1 to atom2
 
-          // vvib = relative velocity of 2 atoms along bond direction
-          // vvib < 0 for 2 atoms moving towards each other
-          // vvib > 0 for 2 atoms moving apart
+        MathExtra::sub3(x[atom2],x[atom1],r12);
+        MathExtra::norm3(r12);
 
-          vvib = vpar2 - vpar1;
+        // delr = vector from COM to each atom
+        // delv = velocity of each atom relative to COM
 
-          // vrotsq = tangential speed squared of atom1 only
-          // omegasq = omega squared, and is the same for atom1 and atom2
+        MathExtra::sub3(x[atom1],xcm,delr1);
+        MathExtra::sub3(x[atom2],xcm,delr2);
+        MathExtra::sub3(v[atom1],vcm,delv1);
+        MathExtra::sub3(v[atom2],vcm,delv2);
 
-          inertia = mass1*MathExtra::lensq3(delr1) +
-            mass2*MathExtra::lensq3(delr2);
-          vrotsq = MathExtra::lensq3(delv1) - vpar1*vpar1;
-          omegasq = vrotsq / MathExtra::lensq3(delr1);
+        // vpar = component of delv parallel to bond vector
 
-          engrot = 0.5 * inertia * omegasq;
+        vpar1 = MathExtra::dot3(delv1,r12);
+        vpar2 = MathExtra::dot3(delv2,r12);
+        engvib = 0.5 * (mass1*vpar1*vpar1 + mass2*vpar2*vpar2);
 
-          // sanity check: engtotal = engtrans + engvib + engrot
+        // vvib = relative velocity of 2 atoms along bond direction
+        // vvib < 0 for 2 atoms moving towards each other
+        // vvib > 0 for 2 atoms moving apart
 
-          //engtot = 0.5 * (mass1*MathExtra::lensq3(v[atom1]) +
-          //                mass2*MathExtra::lensq3(v[atom2]));
-          //if (fabs(engtot-engtrans-engvib-engrot) > EPSILON)
-          //  error->one(FLERR,"Sanity check on 3 energy components failed");
+        vvib = vpar2 - vpar1;
 
-          // scale energies by units
+        // vrotsq = tangential speed squared of atom1 only
+        // omegasq = omega squared, and is the same for atom1 and atom2
 
-          mvv2e = force->mvv2e;
-          engtrans *= mvv2e;
-          engvib *= mvv2e;
-          engrot *= mvv2e;
-        }
+        inertia = mass1*MathExtra::lensq3(delr1) +
+          mass2*MathExtra::lensq3(delr2);
+        vrotsq = MathExtra::lensq3(delv1) - vpar1*vpar1;
+        omegasq = vrotsq / MathExtra::lensq3(delr1);
 
-        if (nvalues == 1) ptr = &vlocal[m];
-        else ptr = alocal[m];
+        engrot = 0.5 * inertia * omegasq;
 
-        if (nvar) {
-          ivar = 0;
-          if (dstr) input->variable->internal_set(dvar,sqrt(rsq));
-        }
+        // sanity check: engtotal = engtrans + engvib + engrot
 
-        for (n = 0; n < nvalues; n++) {
-          switch (bstyle[n]) {
-          case DIST:
-            ptr[n] = sqrt(rsq);
-            break;
-          case ENGPOT:
-            ptr[n] = engpot;
-            break;
-          case FORCE:
-            ptr[n] = sqrt(rsq)*fbond;
-            break;
-          case FX:
-            ptr[n] = dx*fbond;
-            break;
-          case FY:
-            ptr[n] = dy*fbond;
-            break;
-          case FZ:
-            ptr[n] = dz*fbond;
-            break;
-          case ENGVIB:
-            ptr[n] = engvib;
-            break;
-          case ENGROT:
-            ptr[n] = engrot;
-            break;
-          case ENGTRANS:
-            ptr[n] = engtrans;
-            break;
-          case OMEGA:
-            ptr[n] = sqrt(omegasq);
-            break;
-          case VELVIB:
-            ptr[n] = vvib;
-            break;
-          case VARIABLE:
-            ptr[n] = input->variable->compute_equal(vvar[ivar]);
-            ivar++;
-            break;
-          }
-        }
+        //engtot = 0.5 * (mass1*MathExtra::lensq3(v[atom1]) +
+        //                mass2*MathExtra::lensq3(v[atom2]));
+        //if (fabs(engtot-engtrans-engvib-engrot) > EPSILON)
+        //  error->one(FLERR,"Sanity check on 3 energy components failed");
+
+        // scale energies by units
+
+        mvv2e = force->mvv2e;
+        engtrans *= mvv2e;
+        engvib *= mvv2e;
+        engrot *= mvv2e;
       }
 
-      m++;
+      if (nvalues == 1) ptr = &vlocal[mb];
+      else ptr = alocal[mb];
+
+      if (nvar) {
+        ivar = 0;
+        if (dstr) input->variable->internal_set(dvar,sqrt(rsq));
+      }
+
+      for (n = 0; n < nvalues; n++) {
+        switch (bstyle[n]) {
+        case DIST:
+          ptr[n] = sqrt(rsq);
+          break;
+        case ENGPOT:
+          ptr[n] = engpot;
+          break;
+        case FORCE:
+          ptr[n] = sqrt(rsq)*fbond;
+          break;
+        case FX:
+          ptr[n] = dx*fbond;
+          break;
+        case FY:
+          ptr[n] = dy*fbond;
+          break;
+        case FZ:
+          ptr[n] = dz*fbond;
+          break;
+        case ENGVIB:
+          ptr[n] = engvib;
+          break;
+        case ENGROT:
+          ptr[n] = engrot;
+          break;
+        case ENGTRANS:
+          ptr[n] = engtrans;
+          break;
+        case OMEGA:
+          ptr[n] = sqrt(omegasq);
+          break;
+        case VELVIB:
+          ptr[n] = vvib;
+          break;
+        case VARIABLE:
+          ptr[n] = input->variable->compute_equal(vvar[ivar]);
+          ivar++;
+          break;
+        }
+      }
     }
   }
 
@@ -490,6 +510,11 @@ void ComputeBondLocal::reallocate(int n)
     memory->create(alocal,nmax,nvalues,"bond/local:array_local");
     array_local = alocal;
   }
+
+  memory->destroy(dbuf);
+  memory->destroy(bmap);
+  memory->create(dbuf,nmax,3,"bond/local:dbuf");
+  memory->create(bmap,nmax,3,"bond/local:bmap");
 }
 
 /* ----------------------------------------------------------------------
@@ -499,5 +524,7 @@ void ComputeBondLocal::reallocate(int n)
 double ComputeBondLocal::memory_usage()
 {
   double bytes = nmax*nvalues * sizeof(double);
+  bytes += nmax*3 * sizeof(double);
+  bytes += nmax*3 * sizeof(int);
   return bytes;
 }
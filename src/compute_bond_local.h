@@ -46,6 +46,8 @@ class ComputeBondLocal : public Compute {
   int nmax;
   double *vlocal;
   double **alocal;
+  double **dbuf;           // bond deltas for batched minimum image
+  int **bmap;              // atom1,atom2,btype of each counted bond
 
   int compute_bonds(int);
   void reallocate(int);
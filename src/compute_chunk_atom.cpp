@@ -472,12 +472,17 @@ ComputeChunkAtom::ComputeChunkAtom(LAMMPS *lmp, int narg, char **arg) :
   invoked_setup = -1;
   invoked_ichunk = -1;
 
+  binsetupflag = 0;
+
   id_fix = NULL;
   fixstore = NULL;
 
   if (compress) hash = new std::map<tagint,int>();
   else hash = NULL;
 
+  nlistprev = -1;
+  listprev = NULL;
+
   maxvar = 0;
   varatom = NULL;
 
@@ -507,6 +512,7 @@ ComputeChunkAtom::~ComputeChunkAtom()
   delete [] idregion;
   delete [] cfvid;
   delete hash;
+  memory->destroy(listprev);
 
   memory->destroy(varatom);
 }
@@ -738,23 +744,27 @@ void ComputeChunkAtom::compute_ichunk()
   int nlocal = atom->nlocal;
 
   if (compress) {
+    std::map<tagint,int>::iterator pos;
     if (binflag) {
       for (i = 0; i < nlocal; i++) {
         if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end()) exclude[i] = 1;
-        else ichunk[i] = hash->find(ichunk[i])->second;
+        pos = hash->find(ichunk[i]);
+        if (pos == hash->end()) exclude[i] = 1;
+        else ichunk[i] = pos->second;
       }
     } else if (discard == NODISCARD) {
       for (i = 0; i < nlocal; i++) {
         if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end()) ichunk[i] = nchunk;
-        else ichunk[i] = hash->find(ichunk[i])->second;
+        pos = hash->find(ichunk[i]);
+        if (pos == hash->end()) ichunk[i] = nchunk;
+        else ichunk[i] = pos->second;
       }
     } else {
       for (i = 0; i < nlocal; i++) {
         if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end()) exclude[i] = 1;
-        else ichunk[i] = hash->find(ichunk[i])->second;
+        pos = hash->find(ichunk[i]);
+        if (pos == hash->end()) exclude[i] = 1;
+        else ichunk[i] = pos->second;
       }
     }
 
@@ -837,11 +847,32 @@ int ComputeChunkAtom::setup_chunks()
   // IDs are needed to scan for max ID and for compress()
 
   if (binflag) {
-    if (which == BIN1D || which == BIN2D || which == BIN3D)
-      nchunk = setup_xyz_bins();
-    else if (which == BINSPHERE) nchunk = setup_sphere_bins();
-    else if (which == BINCYLINDER) nchunk = setup_cylinder_bins();
-    bin_volumes();
+
+    // bin extents, coords, volumes depend only on the box dimensions
+    // only rebuild them if the box changed since the last bin setup
+
+    if (binsetupflag &&
+        domain->boxlo[0] == binboxlo[0] && domain->boxhi[0] == binboxhi[0] &&
+        domain->boxlo[1] == binboxlo[1] && domain->boxhi[1] == binboxhi[1] &&
+        domain->boxlo[2] == binboxlo[2] && domain->boxhi[2] == binboxhi[2] &&
+        domain->xy == bintilt[0] && domain->xz == bintilt[1] &&
+        domain->yz == bintilt[2]) {
+      nchunk = nchunkbin;
+    } else {
+      if (which == BIN1D || which == BIN2D || which == BIN3D)
+        nchunk = setup_xyz_bins();
+      else if (which == BINSPHERE) nchunk = setup_sphere_bins();
+      else if (which == BINCYLINDER) nchunk = setup_cylinder_bins();
+      bin_volumes();
+      binsetupflag = 1;
+      nchunkbin = nchunk;
+      binboxlo[0] = domain->boxlo[0]; binboxhi[0] = domain->boxhi[0];
+      binboxlo[1] = domain->boxlo[1]; binboxhi[1] = domain->boxhi[1];
+      binboxlo[2] = domain->boxlo[2]; binboxhi[2] = domain->boxhi[2];
+      bintilt[0] = domain->xy;
+      bintilt[1] = domain->xz;
+      bintilt[2] = domain->yz;
+    }
   } else {
     chunk_volume_scalar = domain->xprd * domain->yprd;
     if (domain->dimension == 3) chunk_volume_scalar *= domain->zprd;
@@ -1031,34 +1062,64 @@ void ComputeChunkAtom::assign_chunk_ids()
 
 void ComputeChunkAtom::compress_chunk_ids()
 {
-  hash->clear();
-
-  // put my IDs into hash
+  // build sorted list of my populated IDs, using lhash to unique them
+  // do not clear the global hash yet, it may be reusable from last setup
 
+  std::map<tagint,int> lhash;
   int nlocal = atom->nlocal;
   for (int i = 0; i < nlocal; i++) {
     if (exclude[i]) continue;
-    if (hash->find(ichunk[i]) == hash->end()) (*hash)[ichunk[i]] = 0;
+    lhash[ichunk[i]] = 0;
   }
 
-  // n = # of my populated IDs
-  // nall = n summed across all procs
-
-  int n = hash->size();
-  bigint nbone = n;
-  bigint nball;
-  MPI_Allreduce(&nbone,&nball,1,MPI_LMP_BIGINT,MPI_SUM,world);
-
-  // create my list of populated IDs
-
+  int n = lhash.size();
   int *list = NULL;
   memory->create(list,n,"chunk/atom:list");
 
   n = 0;
   std::map<tagint,int>::iterator pos;
-  for (pos = hash->begin(); pos != hash->end(); ++pos)
+  for (pos = lhash.begin(); pos != lhash.end(); ++pos)
     list[n++] = pos->first;
 
+  // if no proc's list changed since the last compression, the global
+  //   union of IDs is also unchanged, so hash, chunkID, nchunk still apply
+  // makes the expensive gather of all IDs event-driven
+  //   rather than once per invocation
+
+  int change = 1;
+  if (n == nlistprev) {
+    change = 0;
+    for (int i = 0; i < n; i++)
+      if (list[i] != listprev[i]) {
+        change = 1;
+        break;
+      }
+  }
+  int changeany;
+  MPI_Allreduce(&change,&changeany,1,MPI_INT,MPI_MAX,world);
+
+  if (!changeany) {
+    memory->destroy(list);
+    nchunk = hash->size();
+    return;
+  }
+
+  // keep my list for the comparison at the next compression
+
+  memory->destroy(listprev);
+  listprev = list;
+  nlistprev = n;
+
+  // put my IDs into hash
+  // nall = n summed across all procs
+
+  hash->clear();
+  for (int i = 0; i < n; i++) (*hash)[list[i]] = 0;
+
+  bigint nbone = n;
+  bigint nball;
+  MPI_Allreduce(&nbone,&nball,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
   // if nall < 1M, just allgather all ID lists on every proc
   // else perform ring comm
   // add IDs from all procs to my hash
@@ -1099,8 +1160,6 @@ void ComputeChunkAtom::compress_chunk_ids()
     comm->ring(n,sizeof(int),list,1,idring,NULL,(void *)this,0);
   }
 
-  memory->destroy(list);
-
   // nchunk = length of hash containing populated IDs from all procs
 
   nchunk = hash->size();
@@ -108,6 +108,13 @@ class ComputeChunkAtom : public Compute {
   int *exclude;              // 1 if atom is not assigned to any chunk
   std::map<tagint,int> *hash;   // store original chunks IDs before compression
 
+  int binsetupflag;          // 1 if bin geometry is current for stored box
+  int nchunkbin;             // # of bins from last bin geometry setup
+  double binboxlo[3],binboxhi[3];  // box bounds when bins were last setup
+  double bintilt[3];               // box tilt factors likewise
+  int nlistprev;             // # of my populated IDs at last compression
+  int *listprev;             // my list of populated IDs at last compression
+
   // callback function for ring communication
 
   static void idring(int, char *, void *);
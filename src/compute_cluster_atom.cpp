@@ -37,7 +37,7 @@ enum{CLUSTER,MASK,COORDS};
 
 ComputeClusterAtom::ComputeClusterAtom(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
-  clusterID(NULL)
+  clusterID(NULL), parent(NULL)
 {
   if (narg != 4) error->all(FLERR,"Illegal compute cluster/atom command");
 
@@ -56,6 +56,7 @@ ComputeClusterAtom::ComputeClusterAtom(LAMMPS *lmp, int narg, char **arg) :
 ComputeClusterAtom::~ComputeClusterAtom()
 {
   memory->destroy(clusterID);
+  memory->destroy(parent);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -104,12 +105,14 @@ void ComputeClusterAtom::compute_peratom()
 
   invoked_peratom = update->ntimestep;
 
-  // grow clusterID array if necessary
+  // grow clusterID and union-find arrays if necessary
 
   if (atom->nmax > nmax) {
     memory->destroy(clusterID);
+    memory->destroy(parent);
     nmax = atom->nmax;
     memory->create(clusterID,nmax,"cluster/atom:clusterID");
+    memory->create(parent,nmax,"cluster/atom:parent");
     vector_atom = clusterID;
   }
 
@@ -144,6 +147,8 @@ void ComputeClusterAtom::compute_peratom()
 
   tagint *tag = atom->tag;
   int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
@@ -151,52 +156,71 @@ void ComputeClusterAtom::compute_peratom()
     else clusterID[i] = 0;
   }
 
-  // loop until no more changes on any proc:
-  // acquire clusterIDs of ghost atoms
-  // loop over my atoms, checking distance to neighbors
-  // if both atoms are in cluster, assign lowest clusterID to both
-  // iterate until no changes in my atoms
-  // then check if any proc made changes
+  // build union-find over local topology in a single pass
+  // edges do not change between iterations, only labels do,
+  //   so connectivity is resolved once up front
+  // my atoms come first in parent, so the root of any component
+  //   containing one of my atoms is always one of my atoms
 
   commflag = CLUSTER;
   double **x = atom->x;
 
-  int change,done,anychange;
+  for (i = 0; i < nall; i++) parent[i] = i;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      if (!(mask[j] & groupbit)) continue;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq < cutsq) {
+        int ri = find_root(i);
+        int rj = find_root(j);
+        if (ri != rj) parent[MAX(ri,rj)] = MIN(ri,rj);
+      }
+    }
+  }
+
+  // loop until no more changes on any proc:
+  // acquire clusterIDs of ghost atoms
+  // pull the lowest clusterID in each local component onto its root,
+  //   then push it back out to every atom of the component
+  // check if any proc assigned a lower ID to one of its own atoms
+
+  int change,anychange;
 
   while (1) {
     comm->forward_comm_compute(this);
 
     change = 0;
-    while (1) {
-      done = 1;
-      for (ii = 0; ii < inum; ii++) {
-        i = ilist[ii];
-        if (!(mask[i] & groupbit)) continue;
-
-        xtmp = x[i][0];
-        ytmp = x[i][1];
-        ztmp = x[i][2];
-        jlist = firstneigh[i];
-        jnum = numneigh[i];
-
-        for (jj = 0; jj < jnum; jj++) {
-          j = jlist[jj];
-          j &= NEIGHMASK;
-          if (!(mask[j] & groupbit)) continue;
-          if (clusterID[i] == clusterID[j]) continue;
-
-          delx = xtmp - x[j][0];
-          dely = ytmp - x[j][1];
-          delz = ztmp - x[j][2];
-          rsq = delx*delx + dely*dely + delz*delz;
-          if (rsq < cutsq) {
-            clusterID[i] = clusterID[j] = MIN(clusterID[i],clusterID[j]);
-            done = 0;
-          }
-        }
+    for (i = 0; i < nall; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      j = find_root(i);
+      if (clusterID[i] < clusterID[j]) {
+        clusterID[j] = clusterID[i];
+        if (j < nlocal) change = 1;
+      }
+    }
+    for (i = 0; i < nall; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      j = find_root(i);
+      if (clusterID[i] != clusterID[j]) {
+        if (i < nlocal) change = 1;
+        clusterID[i] = clusterID[j];
       }
-      if (!done) change = 1;
-      if (done) break;
     }
 
     // stop if all procs are done
@@ -206,6 +230,19 @@ void ComputeClusterAtom::compute_peratom()
   }
 }
 
+/* ----------------------------------------------------------------------
+   union-find root lookup with path halving
+------------------------------------------------------------------------- */
+
+int ComputeClusterAtom::find_root(int i)
+{
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int ComputeClusterAtom::pack_forward_comm(int n, int *list, double *buf,
@@ -268,5 +305,6 @@ void ComputeClusterAtom::unpack_forward_comm(int n, int first, double *buf)
 double ComputeClusterAtom::memory_usage()
 {
   double bytes = nmax * sizeof(double);
+  bytes += nmax * sizeof(int);
   return bytes;
 }
@@ -40,6 +40,9 @@ class ComputeClusterAtom : public Compute {
   double cutsq;
   class NeighList *list;
   double *clusterID;
+  int *parent;             // union-find parent for local+ghost atoms
+
+  int find_root(int);
 };
 
 }
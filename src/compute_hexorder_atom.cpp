@@ -18,7 +18,7 @@
 #include "compute_hexorder_atom.h"
 #include <cmath>
 #include <cstring>
-#include <complex>
+#include "math_spherharm.h"
 #include "atom.h"
 #include "update.h"
 #include "modify.h"
@@ -243,16 +243,15 @@ void ComputeHexOrderAtom::compute_peratom()
   }
 }
 
-// calculate order parameter using std::complex::pow function
+// calculate order parameter by integer power of the unit bond vector
+// binary exponentiation from the shared spherical-harmonic helpers,
+// cheaper than std::complex::pow which goes through log/exp
 
 inline void ComputeHexOrderAtom::calc_qn_complex(double delx, double dely, double &u, double &v) {
   double rinv = 1.0/sqrt(delx*delx+dely*dely);
   double x = delx*rinv;
   double y = dely*rinv;
-  std::complex<double> z(x, y);
-  std::complex<double> zn = pow(z, ndegree);
-  u = real(zn);
-  v = imag(zn);
+  MathSpherharm::cpow_unit(x, y, ndegree, u, v);
 }
 
 // calculate order parameter using trig functions
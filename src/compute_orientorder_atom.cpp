@@ -32,6 +32,7 @@
 #include "memory.h"
 #include "error.h"
 #include "math_const.h"
+#include "math_spherharm.h"
 #include "fmt/format.h"
 
 using namespace LAMMPS_NS;
@@ -51,7 +52,7 @@ using namespace std;
 ComputeOrientOrderAtom::ComputeOrientOrderAtom(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
   qlist(NULL), distsq(NULL), nearest(NULL), rlist(NULL),
-  qnarray(NULL), qnm_r(NULL), qnm_i(NULL), cglist(NULL)
+  qnarray(NULL), qnm_r(NULL), qnm_i(NULL), pnmtable(NULL), cglist(NULL)
 {
   if (narg < 3 ) error->all(FLERR,"Illegal compute orientorder/atom command");
 
@@ -180,6 +181,7 @@ ComputeOrientOrderAtom::~ComputeOrientOrderAtom()
   memory->destroy(qlist);
   memory->destroy(qnm_r);
   memory->destroy(qnm_i);
+  memory->destroy(pnmtable);
   memory->destroy(cglist);
 }
 
@@ -197,6 +199,9 @@ void ComputeOrientOrderAtom::init()
 
   memory->create(qnm_r,nqlist,2*qmax+1,"orientorder/atom:qnm_r");
   memory->create(qnm_i,nqlist,2*qmax+1,"orientorder/atom:qnm_i");
+  memory->destroy(pnmtable);
+  memory->create(pnmtable,MathSpherharm::basis_count(qmax),
+                 "orientorder/atom:pnmtable");
 
   // need an occasional full neighbor list
 
@@ -464,19 +469,26 @@ void ComputeOrientOrderAtom::calc_boop(double **rlist,
       expphi_i *= rxymaginv;
     }
 
+    // one normalized Legendre column P_l^m(costheta) for all
+    // 0 <= m <= l <= qmax from the shared engine, reused by every
+    // requested l instead of one from-scratch recurrence per (l,m)
+
+    MathSpherharm::plegendre_table(qmax,costheta,pnmtable);
+
     for (int il = 0; il < nqlist; il++) {
       int l = qlist[il];
+      const double * const plm = pnmtable + MathSpherharm::basis_index(l,0);
 
       // calculate spherical harmonics
       // Ylm, -l <= m <= l
       // sign convention: sign(Yll(0,0)) = (-1)^l
 
-      qnm_r[il][l] += polar_prefactor(l, 0, costheta);
+      qnm_r[il][l] += plm[0];
       double expphim_r = expphi_r;
       double expphim_i = expphi_i;
       for(int m = 1; m <= +l; m++) {
 
-        double prefactor = polar_prefactor(l, m, costheta);
+        double prefactor = plm[m];
         double ylm_r = prefactor * expphim_r;
         double ylm_i = prefactor * expphim_i;
         qnm_r[il][m+l] += ylm_r;
@@ -598,54 +610,6 @@ double ComputeOrientOrderAtom::dist(const double r[])
   return sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
 }
 
-/* ----------------------------------------------------------------------
-   polar prefactor for spherical harmonic Y_l^m, where
-   Y_l^m (theta, phi) = prefactor(l, m, cos(theta)) * exp(i*m*phi)
-------------------------------------------------------------------------- */
-
-double ComputeOrientOrderAtom::polar_prefactor(int l, int m, double costheta)
-{
-  const int mabs = abs(m);
-
-  double prefactor = 1.0;
-  for (int i=l-mabs+1; i < l+mabs+1; ++i)
-    prefactor *= static_cast<double>(i);
-
-  prefactor = sqrt(static_cast<double>(2*l+1)/(MY_4PI*prefactor))
-    * associated_legendre(l,mabs,costheta);
-
-  if ((m < 0) && (m % 2)) prefactor = -prefactor;
-
-  return prefactor;
-}
-
-/* ----------------------------------------------------------------------
-   associated legendre polynomial
-   sign convention: P(l,l) = (2l-1)!!(-sqrt(1-x^2))^l
-------------------------------------------------------------------------- */
-
-double ComputeOrientOrderAtom::associated_legendre(int l, int m, double x)
-{
-  if (l < m) return 0.0;
-
-  double p(1.0), pm1(0.0), pm2(0.0);
-
-  if (m != 0) {
-    const double msqx = -sqrt(1.0-x*x);
-    for (int i=1; i < m+1; ++i)
-      p *= static_cast<double>(2*i-1) * msqx;
-  }
-
-  for (int i=m+1; i < l+1; ++i) {
-    pm2 = pm1;
-    pm1 = p;
-    p = (static_cast<double>(2*i-1)*x*pm1
-         - static_cast<double>(i+m-1)*pm2) / static_cast<double>(i-m);
-  }
-
-  return p;
-}
-
 /* ----------------------------------------------------------------------
    assign Clebsch-Gordan coefficients
    using the quasi-binomial formula VMK 8.2.1(3)
@@ -47,15 +47,13 @@ class ComputeOrientOrderAtom : public Compute {
   double **qnarray;
   double **qnm_r;
   double **qnm_i;
+  double *pnmtable;         // normalized Legendre column for one neighbor
 
   void select3(int, int, double *, int *, double **);
   void calc_boop(double **rlist, int numNeighbors,
                  double qn[], int nlist[], int nnlist);
   double dist(const double r[]);
 
-  double polar_prefactor(int, int, double);
-  double associated_legendre(int, int, double);
-
   static const int nmaxfactorial = 167;
   static const double nfac_table[];
   double factorial(int);
@@ -136,6 +136,7 @@ ComputePressure::ComputePressure(LAMMPS *lmp, int narg, char **arg) :
   vector = new double[size_vector];
   nvirial = 0;
   vptr = NULL;
+  vsum_step = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -221,6 +222,10 @@ void ComputePressure::init()
 
   if (kspaceflag && force->kspace) kspace_virial = force->kspace->virial;
   else kspace_virial = NULL;
+
+  // contributor list may have changed, discard any cached sum
+
+  vsum_step = -1;
 }
 
 /* ----------------------------------------------------------------------
@@ -320,20 +325,36 @@ void ComputePressure::virial_compute(int n, int ndiag)
   int i,j;
   double v[6],*vcomponent;
 
-  for (i = 0; i < n; i++) v[i] = 0.0;
-
   // sum contributions to virial from forces and fixes
+  // the summed and reduced result is cached for the current timestep,
+  // so a second consumer on the same step (e.g. thermo after fix npt,
+  // or compute_vector() after compute_scalar()) reuses it instead of
+  // re-walking the contributors and re-reducing
+  // all 6 components are always reduced so either caller can hit
+  // minimization evaluates forces many times per timestep, so the
+  // per-step key would serve stale sums to every line-search
+  // evaluation after the first; never cache while minimizing
+
+  if (update->whichflag == 2) vsum_step = -1;
+
+  if (vsum_step != update->ntimestep) {
+    for (i = 0; i < 6; i++) v[i] = 0.0;
+    for (j = 0; j < nvirial; j++) {
+      vcomponent = vptr[j];
+      for (i = 0; i < 6; i++) v[i] += vcomponent[i];
+    }
 
-  for (j = 0; j < nvirial; j++) {
-    vcomponent = vptr[j];
-    for (i = 0; i < n; i++) v[i] += vcomponent[i];
-  }
+    // sum virial across procs
 
-  // sum virial across procs
+    MPI_Allreduce(v,vsum,6,MPI_DOUBLE,MPI_SUM,world);
+    if (update->whichflag != 2) vsum_step = update->ntimestep;
+  }
 
-  MPI_Allreduce(v,virial,n,MPI_DOUBLE,MPI_SUM,world);
+  for (i = 0; i < n; i++) virial[i] = vsum[i];
 
   // KSpace virial contribution is already summed across procs
+  // added from the live KSpace array each time, so inner respa steps
+  // reuse the outer-level values without invalidating the cached sum
 
   if (kspace_virial)
     for (i = 0; i < n; i++) virial[i] += kspace_virial[i];
@@ -41,6 +41,16 @@ class ComputePressure : public Compute {
   Compute *temperature;
   char *id_temp;
   double virial[6];
+
+  // cached sum of the per-proc force/fix virial contributions,
+  // valid for the timestep in vsum_step; lets every consumer of the
+  // pressure on one step share a single pass over vptr and a single
+  // MPI reduction; reset in init() when the contributor set changes
+  // and disabled during minimization, which re-evaluates forces
+  // many times within one timestep
+
+  double vsum[6];
+  bigint vsum_step;
   int pairhybridflag;
   class Pair *pairhybrid;
   int keflag,pairflag,bondflag,angleflag,dihedralflag,improperflag;
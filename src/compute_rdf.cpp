@@ -266,7 +266,7 @@ void ComputeRDF::init_norm()
 void ComputeRDF::compute_array()
 {
   int i,j,m,ii,jj,inum,jnum,itype,jtype,ipair,jpair,ibin,ihisto;
-  double xtmp,ytmp,ztmp,delx,dely,delz,r;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
   int *ilist,*jlist,*numneigh,**firstneigh;
   double factor_lj,factor_coul;
 
@@ -313,6 +313,12 @@ void ComputeRDF::compute_array()
   double *special_lj = force->special_lj;
   int newton_pair = force->newton_pair;
 
+  // cutsq = squared distance of outermost bin edge
+  // used to reject pairs on r^2 w/out computing a sqrt
+
+  double cutoff_bin = nbin*delr;
+  double cutsq = cutoff_bin*cutoff_bin;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     if (!(mask[i] & groupbit)) continue;
@@ -344,8 +350,9 @@ void ComputeRDF::compute_array()
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
       delz = ztmp - x[j][2];
-      r = sqrt(delx*delx + dely*dely + delz*delz);
-      ibin = static_cast<int> (r*delrinv);
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq >= cutsq) continue;
+      ibin = static_cast<int> (sqrt(rsq)*delrinv);
       if (ibin >= nbin) continue;
 
       for (ihisto = 0; ihisto < ipair; ihisto++) {
@@ -394,46 +394,43 @@ void ComputeReduce::compute_vector()
       indices[m] = index;
     }
 
+  // reduce all values in one combined allreduce per mode
+  //   instead of one collective call per value
+
   if (mode == SUM || mode == SUMSQ) {
-    for (int m = 0; m < nvalues; m++)
-      MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_SUM,world);
+    MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_SUM,world);
 
-  } else if (mode == MINN) {
+  } else if (mode == MINN || mode == MAXX) {
     if (!replace) {
-      for (int m = 0; m < nvalues; m++)
-        MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_MIN,world);
+      if (mode == MINN)
+        MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_MIN,world);
+      else
+        MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_MAX,world);
 
     } else {
-      for (int m = 0; m < nvalues; m++)
-        if (replace[m] < 0) {
-          pairme.value = onevec[m];
-          pairme.proc = me;
-          MPI_Allreduce(&pairme,&pairall,1,MPI_DOUBLE_INT,MPI_MINLOC,world);
-          vector[m] = pairall.value;
-          owner[m] = pairall.proc;
-        }
-      for (int m = 0; m < nvalues; m++)
-        if (replace[m] >= 0) {
-          if (me == owner[replace[m]])
-            vector[m] = compute_one(m,indices[replace[m]]);
-          MPI_Bcast(&vector[m],1,MPI_DOUBLE,owner[replace[m]],world);
-        }
-    }
 
-  } else if (mode == MAXX) {
-    if (!replace) {
-      for (int m = 0; m < nvalues; m++)
-        MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_MAX,world);
+      // replaced values do not participate in the loc reduction,
+      //   their slots are filled with the identity value for the mode
 
-    } else {
+      Pair *pairsme = new Pair[nvalues];
+      Pair *pairsall = new Pair[nvalues];
+      for (int m = 0; m < nvalues; m++) {
+        if (replace[m] < 0) pairsme[m].value = onevec[m];
+        else pairsme[m].value = (mode == MINN) ? BIG : -BIG;
+        pairsme[m].proc = me;
+      }
+      if (mode == MINN)
+        MPI_Allreduce(pairsme,pairsall,nvalues,MPI_DOUBLE_INT,MPI_MINLOC,world);
+      else
+        MPI_Allreduce(pairsme,pairsall,nvalues,MPI_DOUBLE_INT,MPI_MAXLOC,world);
       for (int m = 0; m < nvalues; m++)
         if (replace[m] < 0) {
-          pairme.value = onevec[m];
-          pairme.proc = me;
-          MPI_Allreduce(&pairme,&pairall,1,MPI_DOUBLE_INT,MPI_MAXLOC,world);
-          vector[m] = pairall.value;
-          owner[m] = pairall.proc;
+          vector[m] = pairsall[m].value;
+          owner[m] = pairsall[m].proc;
         }
+      delete [] pairsme;
+      delete [] pairsall;
+
       for (int m = 0; m < nvalues; m++)
         if (replace[m] >= 0) {
           if (me == owner[replace[m]])
@@ -443,9 +440,20 @@ void ComputeReduce::compute_vector()
     }
 
   } else if (mode == AVE || mode == AVESQ) {
+    MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_SUM,world);
+
+    // count is the group (or group+region) atom count for every
+    //   per-atom value, so its collective is only done once
+
+    bigint ncount_peratom = -1;
     for (int m = 0; m < nvalues; m++) {
-      MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_SUM,world);
-      bigint n = count(m);
+      bigint n;
+      if ((which[m] == COMPUTE || which[m] == FIX) && flavor[m] == LOCAL)
+        n = count(m);
+      else {
+        if (ncount_peratom < 0) ncount_peratom = count(m);
+        n = ncount_peratom;
+      }
       if (n) vector[m] /= n;
     }
   }
@@ -50,7 +50,6 @@ class ComputeReduce : public Compute {
     double value;
     int proc;
   };
-  Pair pairme,pairall;
 
   virtual double compute_one(int, int);
   virtual bigint count(int);
@@ -68,6 +68,7 @@ class ComputeShcoeff : public Compute {
 
   double **angles;
   double *weights;
+  double *pnm_quad;            // cached Legendre values at the theta nodes
   double *quad_rads;
 
 
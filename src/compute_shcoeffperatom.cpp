@@ -26,6 +26,7 @@
 #include <iostream>
 #include <iomanip>
 #include "math_const.h"
+#include "math_spherharm.h"
 #include "math_extra.h"
 #include <complex>
 
@@ -55,6 +56,7 @@ ComputeShcoeffperatom::ComputeShcoeffperatom(LAMMPS *lmp, int narg, char **arg)
   lnarg = maxarg = 0;
   larg = NULL;
   curfile = curentry = 0;
+  pnm_quad = NULL;
 
   array_flag = 1;
   extarray = 0;
@@ -109,6 +111,7 @@ ComputeShcoeffperatom::~ComputeShcoeffperatom()
 
   memory->sfree(angles);
   memory->sfree(weights);
+  memory->destroy(pnm_quad);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -776,75 +779,31 @@ void ComputeShcoeffperatom::get_quadrature_values(int num_quadrature, int maxshe
   }
 
 
-  double theta, phi;
-  int nloc, loc;
-  double rad_val;
-  double P_n_m, x_val, mphi, Pnm_nn;
-  std::vector<double> Pnm_m2, Pnm_m1;
-  Pnm_m2.resize(maxshexpan+1, 0.0);
-  Pnm_m1.resize(maxshexpan+1, 0.0);
+  // cache the Legendre basis once per unique theta node; each column
+  // is reused for every phi on its grid row, every shape type and any
+  // later invocation, leaving only the phi-dependent work per point
 
-  for (int sht = 0; sht < numshtypes; sht++) {
-    for (int k = 0; k < num_quad2; k++) {
-      theta = angles[0][k];
-      phi = angles[1][k];
-      x_val = std::cos(theta);
-      rad_val = array[sht][0] * std::sqrt(1.0 / (4.0 * MY_PI));
-      Pnm_m2.clear();
-      Pnm_m1.clear();
-      for (int n = 1; n <= maxshexpan; n++) {
-        nloc = n * (n + 1);
-        if (n == 1) {
-          P_n_m = plegendre(1, 0, x_val);
-          Pnm_m2[0] = P_n_m;
-          rad_val += array[sht][4] * P_n_m;
-          P_n_m = plegendre(1, 1, x_val);
-          Pnm_m2[1] = P_n_m;
-          mphi = 1.0 * phi;
-          rad_val += (array[sht][2] * cos(mphi) - array[sht][3] * sin(mphi)) * 2.0 * P_n_m;
-        } else if (n == 2) {
-          P_n_m = plegendre(2, 0, x_val);
-          Pnm_m1[0] = P_n_m;
-          rad_val += array[sht][10] * P_n_m;
-          for (int m = 2; m >= 1; m--) {
-            P_n_m = plegendre(2, m, x_val);
-            Pnm_m1[m] = P_n_m;
-            mphi = (double) m * phi;
-            rad_val += (array[sht][nloc] * cos(mphi) - array[sht][nloc + 1] * sin(mphi)) * 2.0 * P_n_m;
-            nloc += 2;
-          }
-          Pnm_nn = Pnm_m1[2];
-        } else {
-          P_n_m = plegendre_recycle(n, 0, x_val, Pnm_m1[0], Pnm_m2[0]);
-          Pnm_m2[0] = Pnm_m1[0];
-          Pnm_m1[0] = P_n_m;
-          loc = (n + 1) * (n + 2) - 2;
-          rad_val += array[sht][loc] * P_n_m;
-          loc -= 2;
-          for (int m = 1; m < n - 1; m++) {
-            P_n_m = plegendre_recycle(n, m, x_val, Pnm_m1[m], Pnm_m2[m]);
-            Pnm_m2[m] = Pnm_m1[m];
-            Pnm_m1[m] = P_n_m;
-            mphi = (double) m * phi;
-            rad_val += (array[sht][loc] * cos(mphi) - array[sht][loc + 1] * sin(mphi)) * 2.0 * P_n_m;
-            loc -= 2;
-          }
+  int nbasis = MathSpherharm::basis_count(maxshexpan);
+  if (pnm_quad == NULL) {
+    memory->create(pnm_quad, num_quadrature*nbasis,
+                   "ComputeShcoeffperatom:pnm");
+    for (int i = 0; i < num_quadrature; i++)
+      MathSpherharm::plegendre_table(maxshexpan,
+                                     cos(angles[0][i*num_quadrature]),
+                                     &pnm_quad[i*nbasis]);
+  }
 
-          P_n_m = x_val * std::sqrt((2.0 * ((double) n - 1.0)) + 3.0) * Pnm_nn;
-          Pnm_m2[n - 1] = Pnm_m1[n - 1];
-          Pnm_m1[n - 1] = P_n_m;
-          mphi = (double) (n - 1) * phi;
-          rad_val += (array[sht][loc] * cos(mphi) - array[sht][loc + 1] * sin(mphi)) * 2.0 * P_n_m;
-          loc -= 2;
-
-          P_n_m = plegendre_nn(n, x_val, Pnm_nn);
-          Pnm_nn = P_n_m;
-          Pnm_m1[n] = P_n_m;
-          mphi = (double) n * phi;
-          rad_val += (array[sht][loc] * cos(mphi) - array[sht][loc + 1] * sin(mphi)) * 2.0 * P_n_m;
-        }
+  for (int sht = 0; sht < numshtypes; sht++) {
+    for (int i = 0; i < num_quadrature; i++) {
+      int krow = i*num_quadrature;
+      for (int k = 0; k < num_quadrature; k += MathSpherharm::SHBLOCK) {
+        int np = num_quadrature - k;
+        if (np > MathSpherharm::SHBLOCK) np = MathSpherharm::SHBLOCK;
+        MathSpherharm::expand_radius_row(maxshexpan, array[sht],
+                                         &pnm_quad[i*nbasis], np,
+                                         &angles[1][krow+k],
+                                         &quad_rads[sht][krow+k]);
       }
-      quad_rads[sht][k] = rad_val;
     }
   }
 
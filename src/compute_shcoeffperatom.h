@@ -71,6 +71,7 @@ class ComputeShcoeffperatom : public Compute {
 
   double **angles;
   double *weights;
+  double *pnm_quad;            // cached Legendre values at the theta nodes
   double **quad_rads;
   double **pinertia;
   double **orient;
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "compute_time_atom.h"
+#include <cstring>
+#include "atom.h"
+#include "update.h"
+#include "modify.h"
+#include "comm.h"
+#include "neighbor.h"
+#include "neigh_request.h"
+#include "neigh_list.h"
+#include "timer.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ----------------------------------------------------------------------
+   estimate per-atom computational cost in seconds
+   the pair + neighbor wall time accumulated by this rank during the
+   current run is distributed over its owned atoms in proportion to
+   their neighbor counts, so the cost field sums to the measured rank
+   time and renders as a load-imbalance heatmap when dumped
+------------------------------------------------------------------------- */
+
+ComputeTimeAtom::ComputeTimeAtom(LAMMPS *lmp, int narg, char **arg) :
+  Compute(lmp, narg, arg),
+  cost(NULL)
+{
+  if (narg != 3) error->all(FLERR,"Illegal compute time/atom command");
+
+  peratom_flag = 1;
+  size_peratom_cols = 0;
+
+  nmax = 0;
+  did_warn = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+ComputeTimeAtom::~ComputeTimeAtom()
+{
+  memory->destroy(cost);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeTimeAtom::init()
+{
+  int count = 0;
+  for (int i = 0; i < modify->ncompute; i++)
+    if (strcmp(modify->compute[i]->style,"time/atom") == 0) count++;
+  if (count > 1 && comm->me == 0)
+    error->warning(FLERR,"More than one compute time/atom");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeTimeAtom::compute_peratom()
+{
+  int i,req;
+
+  invoked_peratom = update->ntimestep;
+
+  // grow cost array if necessary
+
+  if (atom->nmax > nmax) {
+    memory->destroy(cost);
+    nmax = atom->nmax;
+    memory->create(cost,nmax,"time/atom:cost");
+    vector_atom = cost;
+  }
+
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  for (i = 0; i < nlocal; i++) cost[i] = 0.0;
+
+  // rank time to distribute = pair + neighbor wall time this run
+
+  double rank_time = timer->get_wall(Timer::PAIR) +
+    timer->get_wall(Timer::NEIGH);
+  if (rank_time <= 0.0 || nlocal == 0) return;
+
+  // find a suitable conventional half neighbor list
+  // same discovery as balance weight neigh, so no extra list is built
+
+  for (req = 0; req < neighbor->old_nrequest; ++req) {
+    if (neighbor->old_requests[req]->half &&
+        neighbor->old_requests[req]->skip == 0 &&
+        neighbor->lists[req] && neighbor->lists[req]->numneigh) break;
+  }
+
+  // no list: spread the rank time uniformly over owned atoms
+
+  if (req >= neighbor->old_nrequest || neighbor->ago < 0) {
+    if (comm->me == 0 && !did_warn)
+      error->warning(FLERR,
+                     "Compute time/atom found no neighbor list, "
+                     "assigning uniform cost");
+    did_warn = 1;
+    double peratom = rank_time/nlocal;
+    for (i = 0; i < nlocal; i++)
+      if (mask[i] & groupbit) cost[i] = peratom;
+    return;
+  }
+
+  // distribute the rank time proportionally to per-atom neighbor counts
+
+  NeighList *list = neighbor->lists[req];
+  const int inum = list->inum;
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+
+  bigint neighsum = 0;
+  for (i = 0; i < inum; ++i) neighsum += numneigh[ilist[i]];
+  if (neighsum == 0) {
+    double peratom = rank_time/nlocal;
+    for (i = 0; i < nlocal; i++)
+      if (mask[i] & groupbit) cost[i] = peratom;
+    return;
+  }
+
+  const double scale = rank_time/neighsum;
+  for (i = 0; i < inum; ++i) {
+    const int j = ilist[i];
+    if (j < nlocal && (mask[j] & groupbit))
+      cost[j] = scale*numneigh[j];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local atom-based array
+------------------------------------------------------------------------- */
+
+double ComputeTimeAtom::memory_usage()
+{
+  double bytes = nmax * sizeof(double);
+  return bytes;
+}
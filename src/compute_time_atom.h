@@ -0,0 +1,64 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef COMPUTE_CLASS
+
+ComputeStyle(time/atom,ComputeTimeAtom)
+
+#else
+
+#ifndef LMP_COMPUTE_TIME_ATOM_H
+#define LMP_COMPUTE_TIME_ATOM_H
+
+#include "compute.h"
+
+namespace LAMMPS_NS {
+
+class ComputeTimeAtom : public Compute {
+ public:
+  ComputeTimeAtom(class LAMMPS *, int, char **);
+  ~ComputeTimeAtom();
+  void init();
+  void compute_peratom();
+  double memory_usage();
+
+ private:
+  int nmax;
+  int did_warn;
+  double *cost;
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+W: More than one compute time/atom
+
+It is not efficient to use compute time/atom more than once.
+
+W: Compute time/atom found no neighbor list, assigning uniform cost
+
+No conventional half neighbor list exists, e.g. because no pair style
+is defined, so the pair and neighbor time of each rank is spread
+uniformly over its atoms instead of proportionally to neighbor counts.
+
+*/
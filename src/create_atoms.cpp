@@ -870,16 +870,89 @@ void CreateAtoms::add_lattice()
 ------------------------------------------------------------------------- */
 
 void CreateAtoms::loop_lattice(int action)
+{
+  nlatt = 0;
+
+  // for a static region, recursively subdivide the lattice loop bounds
+  //   and prune sub-boxes the region provably cannot reach, so sparse
+  //   regions in a large box only visit candidate sites
+  // both passes (COUNT, INSERT*) recurse identically, so the site
+  //   ordering the subset selection relies on is preserved
+
+  if (style == REGION && !domain->regions[nregion]->dynamic_check())
+    loop_lattice_subbox(action,ilo,ihi,jlo,jhi,klo,khi);
+  else
+    loop_lattice_cells(action,ilo,ihi,jlo,jhi,klo,khi);
+}
+
+/* ----------------------------------------------------------------------
+   octree-style refinement of the lattice loop bounds against the region
+   compute the box-coords bounding box of the lattice index sub-box and
+     skip it entirely when the region cannot overlap it
+   otherwise split the longest dimension and recurse,
+     visiting small sub-boxes site by site
+------------------------------------------------------------------------- */
+
+void CreateAtoms::loop_lattice_subbox(int action, int il, int ih,
+                                      int jl, int jh, int kl, int kh)
+{
+  // small sub-box: visit its sites directly
+
+  if ((bigint) (ih-il+1) * (jh-jl+1) * (kh-kl+1) <= 512) {
+    loop_lattice_cells(action,il,ih,jl,jh,kl,kh);
+    return;
+  }
+
+  // bounding box of the sub-box in box coords from its 8 corners
+  // hi corners at index+1 so whole unit cells incl basis are covered
+
+  double blo[3],bhi[3];
+  blo[0] = blo[1] = blo[2] = BIG;
+  bhi[0] = bhi[1] = bhi[2] = -BIG;
+
+  for (int corner = 0; corner < 8; corner++) {
+    double x = (corner & 1) ? ih+1.0 : il;
+    double y = (corner & 2) ? jh+1.0 : jl;
+    double z = (corner & 4) ? kh+1.0 : kl;
+    domain->lattice->lattice2box(x,y,z);
+    blo[0] = MIN(blo[0],x); bhi[0] = MAX(bhi[0],x);
+    blo[1] = MIN(blo[1],y); bhi[1] = MAX(bhi[1],y);
+    blo[2] = MIN(blo[2],z); bhi[2] = MAX(bhi[2],z);
+  }
+
+  if (!domain->regions[nregion]->bbox_overlap(blo,bhi)) return;
+
+  // split the longest dimension in half and recurse
+
+  if (ih-il >= jh-jl && ih-il >= kh-kl) {
+    int mid = il + (ih-il)/2;
+    loop_lattice_subbox(action,il,mid,jl,jh,kl,kh);
+    loop_lattice_subbox(action,mid+1,ih,jl,jh,kl,kh);
+  } else if (jh-jl >= kh-kl) {
+    int mid = jl + (jh-jl)/2;
+    loop_lattice_subbox(action,il,ih,jl,mid,kl,kh);
+    loop_lattice_subbox(action,il,ih,mid+1,jh,kl,kh);
+  } else {
+    int mid = kl + (kh-kl)/2;
+    loop_lattice_subbox(action,il,ih,jl,jh,kl,mid);
+    loop_lattice_subbox(action,il,ih,jl,jh,mid+1,kh);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   visit every lattice site within the given loop bounds
+------------------------------------------------------------------------- */
+
+void CreateAtoms::loop_lattice_cells(int action, int il, int ih,
+                                     int jl, int jh, int kl, int kh)
 {
   int i,j,k,m;
 
   const double * const * const basis = domain->lattice->basis;
 
-  nlatt = 0;
-
-  for (k = klo; k <= khi; k++) {
-    for (j = jlo; j <= jhi; j++) {
-      for (i = ilo; i <= ihi; i++) {
+  for (k = kl; k <= kh; k++) {
+    for (j = jl; j <= jh; j++) {
+      for (i = il; i <= ih; i++) {
         for (m = 0; m < nbasis; m++) {
           double *coord;
           double x[3],lamda[3];
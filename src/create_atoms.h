@@ -62,6 +62,8 @@ class CreateAtoms : protected Pointers {
   void add_random();
   void add_lattice();
   void loop_lattice(int);
+  void loop_lattice_subbox(int, int, int, int, int, int, int);
+  void loop_lattice_cells(int, int, int, int, int, int, int);
   void add_molecule(double *, double * = NULL);
   int vartest(double *);      // evaluate a variable with new atom position
 };
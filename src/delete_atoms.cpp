@@ -42,6 +42,8 @@
 
 using namespace LAMMPS_NS;
 
+#define RVOUS 1   // 0 for irregular, 1 for all2all
+
 /* ---------------------------------------------------------------------- */
 
 DeleteAtoms::DeleteAtoms(LAMMPS *lmp) : Pointers(lmp) {}
@@ -457,29 +459,103 @@ void DeleteAtoms::delete_porosity(int narg, char **arg)
 
 void DeleteAtoms::delete_bond()
 {
-  // hash = for atom IDs being deleted by one processor
-  // list of these IDs is sent around ring
-  // at each stage of ring pass, hash is re-populated with received IDs
+  int i,j;
+
+  // hash = set of unique partner atom IDs in my topology lists
 
   hash = new std::map<tagint,int>();
 
-  // list = set of unique molecule IDs from which I deleted atoms
-  // pass list to all other procs via comm->ring()
+  int *num_bond = atom->num_bond;
+  int *num_angle = atom->num_angle;
+  int *num_dihedral = atom->num_dihedral;
+  int *num_improper = atom->num_improper;
+  int nlocal = atom->nlocal;
+
+  for (i = 0; i < nlocal; i++) {
+    if (num_bond)
+      for (j = 0; j < num_bond[i]; j++)
+        (*hash)[atom->bond_atom[i][j]] = 1;
+    if (num_angle)
+      for (j = 0; j < num_angle[i]; j++) {
+        (*hash)[atom->angle_atom1[i][j]] = 1;
+        (*hash)[atom->angle_atom2[i][j]] = 1;
+        (*hash)[atom->angle_atom3[i][j]] = 1;
+      }
+    if (num_dihedral)
+      for (j = 0; j < num_dihedral[i]; j++) {
+        (*hash)[atom->dihedral_atom1[i][j]] = 1;
+        (*hash)[atom->dihedral_atom2[i][j]] = 1;
+        (*hash)[atom->dihedral_atom3[i][j]] = 1;
+        (*hash)[atom->dihedral_atom4[i][j]] = 1;
+      }
+    if (num_improper)
+      for (j = 0; j < num_improper[i]; j++) {
+        (*hash)[atom->improper_atom1[i][j]] = 1;
+        (*hash)[atom->improper_atom2[i][j]] = 1;
+        (*hash)[atom->improper_atom3[i][j]] = 1;
+        (*hash)[atom->improper_atom4[i][j]] = 1;
+      }
+  }
+
+  // rendezvous comm instead of a ring pass of all deleted IDs:
+  // route each deleted atom ID and each unique partner ID to a proc
+  //   chosen by ID, which replies to the querying procs with the
+  //   partner IDs that are deleted
+  // datum with me = -1 declares its ID deleted, else it is a query
 
+  int me = comm->me;
+  int nprocs = comm->nprocs;
   tagint *tag = atom->tag;
-  int nlocal = atom->nlocal;
 
-  int n = 0;
-  for (int i = 0; i < nlocal; i++)
-    if (dlist[i]) n++;
-  tagint *list;
-  memory->create(list,n,"delete_atoms:list");
+  int nsend = 0;
+  for (i = 0; i < nlocal; i++)
+    if (dlist[i]) nsend++;
+  nsend += (int) hash->size();
+
+  int *proclist;
+  memory->create(proclist,nsend,"delete_atoms:proclist");
+  QueryRvous *inbuf = (QueryRvous *)
+    memory->smalloc((bigint) nsend*sizeof(QueryRvous),"delete_atoms:inbuf");
+
+  nsend = 0;
+  for (i = 0; i < nlocal; i++) {
+    if (!dlist[i]) continue;
+    proclist[nsend] = tag[i] % nprocs;
+    inbuf[nsend].me = -1;
+    inbuf[nsend].ID = tag[i];
+    nsend++;
+  }
 
-  n = 0;
-  for (int i = 0; i < nlocal; i++)
-    if (dlist[i]) list[n++] = tag[i];
+  std::map<tagint,int>::iterator pos;
+  for (pos = hash->begin(); pos != hash->end(); ++pos) {
+    proclist[nsend] = pos->first % nprocs;
+    inbuf[nsend].me = me;
+    inbuf[nsend].ID = pos->first;
+    nsend++;
+  }
+
+  // perform rendezvous operation
+  // each returned datum = a partner ID of mine that is deleted
+
+  char *buf;
+  int nreturn = comm->rendezvous(RVOUS,nsend,(char *) inbuf,
+                                 sizeof(QueryRvous),0,proclist,
+                                 rendezvous_query,0,buf,
+                                 sizeof(QueryRvous),(void *) this);
+  QueryRvous *outbuf = (QueryRvous *) buf;
 
-  comm->ring(n,sizeof(tagint),list,1,bondring,NULL,(void *)this);
+  memory->destroy(proclist);
+  memory->sfree(inbuf);
+
+  // delete all topology interactions that include a returned ID
+  // one pass over the local lists via the same scan the ring version used
+
+  tagint *list;
+  memory->create(list,nreturn,"delete_atoms:list");
+  for (i = 0; i < nreturn; i++) list[i] = outbuf[i].ID;
+  memory->sfree(outbuf);
+
+  bondring(nreturn,(char *) list,(void *) this);
 
   delete hash;
   memory->destroy(list);
@@ -493,31 +569,74 @@ void DeleteAtoms::delete_bond()
 
 void DeleteAtoms::delete_molecule()
 {
-  // hash = unique molecule IDs from which I deleted atoms
+  int i;
+
+  // hash = set of unique molecule IDs of all my atoms, molID 0 excluded
 
   hash = new std::map<tagint,int>();
 
   tagint *molecule = atom->molecule;
   int nlocal = atom->nlocal;
 
-  for (int i = 0; i < nlocal; i++) {
-    if (molecule[i] == 0) continue;
-    if (dlist[i] && hash->find(molecule[i]) == hash->end())
-      (*hash)[molecule[i]] = 1;
+  for (i = 0; i < nlocal; i++)
+    if (molecule[i]) (*hash)[molecule[i]] = 1;
+
+  // rendezvous comm instead of a ring pass of all deleted mol IDs:
+  // same scheme as delete_bond(), keyed on molecule IDs
+  // datum with me = -1 declares a molecule I deleted an atom from,
+  //   else it queries one of my molecule IDs
+
+  int me = comm->me;
+  int nprocs = comm->nprocs;
+
+  int nsend = 0;
+  for (i = 0; i < nlocal; i++)
+    if (dlist[i] && molecule[i]) nsend++;
+  nsend += (int) hash->size();
+
+  int *proclist;
+  memory->create(proclist,nsend,"delete_atoms:proclist");
+  QueryRvous *inbuf = (QueryRvous *)
+    memory->smalloc((bigint) nsend*sizeof(QueryRvous),"delete_atoms:inbuf");
+
+  nsend = 0;
+  for (i = 0; i < nlocal; i++) {
+    if (!dlist[i] || !molecule[i]) continue;
+    proclist[nsend] = molecule[i] % nprocs;
+    inbuf[nsend].me = -1;
+    inbuf[nsend].ID = molecule[i];
+    nsend++;
   }
 
-  // list = set of unique molecule IDs from which I deleted atoms
-  // pass list to all other procs via comm->ring()
+  std::map<tagint,int>::iterator pos;
+  for (pos = hash->begin(); pos != hash->end(); ++pos) {
+    proclist[nsend] = pos->first % nprocs;
+    inbuf[nsend].me = me;
+    inbuf[nsend].ID = pos->first;
+    nsend++;
+  }
 
-  int n = hash->size();
-  tagint *list;
-  memory->create(list,n,"delete_atoms:list");
+  // perform rendezvous operation
+  // each returned datum = a molecule ID of mine with deleted atoms
 
-  n = 0;
-  std::map<tagint,int>::iterator pos;
-  for (pos = hash->begin(); pos != hash->end(); ++pos) list[n++] = pos->first;
+  char *buf;
+  int nreturn = comm->rendezvous(RVOUS,nsend,(char *) inbuf,
+                                 sizeof(QueryRvous),0,proclist,
+                                 rendezvous_query,0,buf,
+                                 sizeof(QueryRvous),(void *) this);
+  QueryRvous *outbuf = (QueryRvous *) buf;
+
+  memory->destroy(proclist);
+  memory->sfree(inbuf);
+
+  // mark all my atoms in a returned molecule ID for deletion
 
-  comm->ring(n,sizeof(tagint),list,1,molring,NULL,(void *)this);
+  tagint *list;
+  memory->create(list,nreturn,"delete_atoms:list");
+  for (i = 0; i < nreturn; i++) list[i] = outbuf[i].ID;
+  memory->sfree(outbuf);
+
+  molring(nreturn,(char *) list,(void *) this);
 
   delete hash;
   memory->destroy(list);
@@ -586,7 +705,52 @@ void DeleteAtoms::recount_topology()
 }
 
 /* ----------------------------------------------------------------------
-   callback from comm->ring() in delete_bond()
+   process IDs routed to me in rendezvous decomposition
+   inbuf = list of N QueryRvous datums
+   datum with me = -1 declares its ID deleted/altered
+   every other datum queries an ID on behalf of its sending proc
+   outbuf = queried IDs found in the declared set, routed back to queriers
+------------------------------------------------------------------------- */
+
+int DeleteAtoms::rendezvous_query(int n, char *inbuf, int &flag,
+                                  int *&proclist, char *&outbuf, void *ptr)
+{
+  DeleteAtoms *daptr = (DeleteAtoms *) ptr;
+  Memory *memory = daptr->memory;
+
+  QueryRvous *in = (QueryRvous *) inbuf;
+
+  std::map<tagint,int> dhash;
+  for (int i = 0; i < n; i++)
+    if (in[i].me < 0) dhash[in[i].ID] = 1;
+
+  int nout = 0;
+  for (int i = 0; i < n; i++)
+    if (in[i].me >= 0 && dhash.find(in[i].ID) != dhash.end()) nout++;
+
+  memory->create(proclist,nout,"delete_atoms:proclist");
+  QueryRvous *out = (QueryRvous *)
+    memory->smalloc((bigint) nout*sizeof(QueryRvous),"delete_atoms:outbuf");
+
+  nout = 0;
+  for (int i = 0; i < n; i++)
+    if (in[i].me >= 0 && dhash.find(in[i].ID) != dhash.end()) {
+      proclist[nout] = in[i].me;
+      out[nout].me = in[i].me;
+      out[nout].ID = in[i].ID;
+      nout++;
+    }
+  outbuf = (char *) out;
+
+  // flag = 2: new outbuf was allocated here
+
+  flag = 2;
+  return nout;
+}
+
+/* ----------------------------------------------------------------------
+   scan my topology lists, delete any interaction with an atom ID in cbuf
+   called with the deleted-ID list returned by rendezvous in delete_bond()
 ------------------------------------------------------------------------- */
 
 void DeleteAtoms::bondring(int nbuf, char *cbuf, void *ptr)
@@ -703,7 +867,8 @@ void DeleteAtoms::bondring(int nbuf, char *cbuf, void *ptr)
 }
 
 /* ----------------------------------------------------------------------
-   callback from comm->ring() in delete_molecule()
+   mark my atoms whose molecule ID is in cbuf for deletion
+   called with the mol-ID list returned by rendezvous in delete_molecule()
 ------------------------------------------------------------------------- */
 
 void DeleteAtoms::molring(int n, char *cbuf, void *ptr)
@@ -35,6 +35,14 @@ class DeleteAtoms : protected Pointers {
   int allflag,compress_flag,bond_flag,mol_flag;
   std::map<tagint,int> *hash;
 
+  // one datum in rendezvous comm for delete_bond() and delete_molecule()
+  // me = -1 declares ID deleted, me >= 0 queries ID for sending proc me
+
+  struct QueryRvous {
+    int me;
+    tagint ID;
+  };
+
   void delete_group(int, char **);
   void delete_region(int, char **);
   void delete_overlap(int, char **);
@@ -49,7 +57,11 @@ class DeleteAtoms : protected Pointers {
     return j >> SBBITS & 3;
   }
 
-  // callback functions for ring communication
+  // callback function for rendezvous communication
+
+  static int rendezvous_query(int, char *, int &, int *&, char *&, void *);
+
+  // local scans over the deleted-ID lists returned by rendezvous
 
   static void bondring(int, char *, void *);
   static void molring(int, char *, void *);
@@ -101,6 +101,9 @@ Domain::Domain(LAMMPS *lmp) : Pointers(lmp)
   nregion = maxregion = 0;
   regions = NULL;
 
+  pbcflags = NULL;
+  maxpbc = 0;
+
   copymode = 0;
 
   region_map = new RegionCreatorMap();
@@ -123,6 +126,8 @@ Domain::~Domain()
   for (int i = 0; i < nregion; i++) delete regions[i];
   memory->sfree(regions);
 
+  memory->destroy(pbcflags);
+
   delete region_map;
 }
 
@@ -524,6 +529,9 @@ void Domain::reset_box()
    for triclinic, atoms must be in lamda coords (0-1) before pbc is called
    image = 10 or 20 bits for each dimension depending on sizeof(imageint)
    increment/decrement in wrap-around fashion
+   done in 2 passes: 1st remaps coords of all atoms with blended conditions
+     so the loop can vectorize, storing per-atom flag bits for which wraps
+     occurred, 2nd adjusts image flags and velocities for flagged atoms only
 ------------------------------------------------------------------------- */
 
 void Domain::pbc()
@@ -560,87 +568,132 @@ void Domain::pbc()
     period = prd_lamda;
   }
 
-  // apply PBC to each owned atom
+  if (nlocal > maxpbc) {
+    memory->destroy(pbcflags);
+    maxpbc = atom->nmax;
+    memory->create(pbcflags,maxpbc,"domain:pbcflags");
+  }
+
+  // 1st pass: remap coords of all owned atoms
+  // wrap conditions are computed as 0/1 values and blended into the coords
+  //   instead of branched on, since only atoms near a boundary ever wrap
+  // re-test after an up wrap since roundoff can land the coord on hi,
+  //   in which case it is wrapped back down with no net image change
+
+  const double lo0 = lo[0], lo1 = lo[1], lo2 = lo[2];
+  const double hi0 = hi[0], hi1 = hi[1], hi2 = hi[2];
+  const double p0 = period[0], p1 = period[1], p2 = period[2];
+  const int px = xperiodic, py = yperiodic, pz = zperiodic;
+
+  int anywrap = 0;
 
   for (i = 0; i < nlocal; i++) {
-    if (xperiodic) {
-      if (x[i][0] < lo[0]) {
-        x[i][0] += period[0];
-        if (deform_vremap && mask[i] & deform_groupbit) v[i][0] += h_rate[0];
-        idim = image[i] & IMGMASK;
-        otherdims = image[i] ^ idim;
-        idim--;
-        idim &= IMGMASK;
-        image[i] = otherdims | idim;
-      }
-      if (x[i][0] >= hi[0]) {
-        x[i][0] -= period[0];
-        x[i][0] = MAX(x[i][0],lo[0]);
-        if (deform_vremap && mask[i] & deform_groupbit) v[i][0] -= h_rate[0];
-        idim = image[i] & IMGMASK;
-        otherdims = image[i] ^ idim;
-        idim++;
-        idim &= IMGMASK;
-        image[i] = otherdims | idim;
-      }
+    double xx = x[i][0];
+    double yy = x[i][1];
+    double zz = x[i][2];
+
+    const int xup = px & (xx < lo0);
+    const int xdn = px & (xx >= hi0);
+    xx += p0 * (xup - xdn);
+    const int xre = xup & (xx >= hi0);
+    xx -= p0 * xre;
+    xx = ((xdn | xre) && xx < lo0) ? lo0 : xx;
+
+    const int yup = py & (yy < lo1);
+    const int ydn = py & (yy >= hi1);
+    yy += p1 * (yup - ydn);
+    const int yre = yup & (yy >= hi1);
+    yy -= p1 * yre;
+    yy = ((ydn | yre) && yy < lo1) ? lo1 : yy;
+
+    const int zup = pz & (zz < lo2);
+    const int zdn = pz & (zz >= hi2);
+    zz += p2 * (zup - zdn);
+    const int zre = zup & (zz >= hi2);
+    zz -= p2 * zre;
+    zz = ((zdn | zre) && zz < lo2) ? lo2 : zz;
+
+    x[i][0] = xx;
+    x[i][1] = yy;
+    x[i][2] = zz;
+
+    const int f = (xup ^ xre) | (xdn << 1) | ((yup ^ yre) << 2) |
+      (ydn << 3) | ((zup ^ zre) << 4) | (zdn << 5);
+    pbcflags[i] = f;
+    anywrap |= f;
+  }
+
+  if (!anywrap) return;
+
+  // 2nd pass: update image flags and remapped velocities of wrapped atoms
+
+  for (i = 0; i < nlocal; i++) {
+    const int f = pbcflags[i];
+    if (!f) continue;
+
+    if (f & 1) {
+      if (deform_vremap && mask[i] & deform_groupbit) v[i][0] += h_rate[0];
+      idim = image[i] & IMGMASK;
+      otherdims = image[i] ^ idim;
+      idim--;
+      idim &= IMGMASK;
+      image[i] = otherdims | idim;
+    }
+    if (f & 2) {
+      if (deform_vremap && mask[i] & deform_groupbit) v[i][0] -= h_rate[0];
+      idim = image[i] & IMGMASK;
+      otherdims = image[i] ^ idim;
+      idim++;
+      idim &= IMGMASK;
+      image[i] = otherdims | idim;
     }
 
-    if (yperiodic) {
-      if (x[i][1] < lo[1]) {
-        x[i][1] += period[1];
-        if (deform_vremap && mask[i] & deform_groupbit) {
-          v[i][0] += h_rate[5];
-          v[i][1] += h_rate[1];
-        }
-        idim = (image[i] >> IMGBITS) & IMGMASK;
-        otherdims = image[i] ^ (idim << IMGBITS);
-        idim--;
-        idim &= IMGMASK;
-        image[i] = otherdims | (idim << IMGBITS);
+    if (f & 4) {
+      if (deform_vremap && mask[i] & deform_groupbit) {
+        v[i][0] += h_rate[5];
+        v[i][1] += h_rate[1];
       }
-      if (x[i][1] >= hi[1]) {
-        x[i][1] -= period[1];
-        x[i][1] = MAX(x[i][1],lo[1]);
-        if (deform_vremap && mask[i] & deform_groupbit) {
-          v[i][0] -= h_rate[5];
-          v[i][1] -= h_rate[1];
-        }
-        idim = (image[i] >> IMGBITS) & IMGMASK;
-        otherdims = image[i] ^ (idim << IMGBITS);
-        idim++;
-        idim &= IMGMASK;
-        image[i] = otherdims | (idim << IMGBITS);
+      idim = (image[i] >> IMGBITS) & IMGMASK;
+      otherdims = image[i] ^ (idim << IMGBITS);
+      idim--;
+      idim &= IMGMASK;
+      image[i] = otherdims | (idim << IMGBITS);
+    }
+    if (f & 8) {
+      if (deform_vremap && mask[i] & deform_groupbit) {
+        v[i][0] -= h_rate[5];
+        v[i][1] -= h_rate[1];
       }
+      idim = (image[i] >> IMGBITS) & IMGMASK;
+      otherdims = image[i] ^ (idim << IMGBITS);
+      idim++;
+      idim &= IMGMASK;
+      image[i] = otherdims | (idim << IMGBITS);
     }
 
-    if (zperiodic) {
-      if (x[i][2] < lo[2]) {
-        x[i][2] += period[2];
-        if (deform_vremap && mask[i] & deform_groupbit) {
-          v[i][0] += h_rate[4];
-          v[i][1] += h_rate[3];
-          v[i][2] += h_rate[2];
-        }
-        idim = image[i] >> IMG2BITS;
-        otherdims = image[i] ^ (idim << IMG2BITS);
-        idim--;
-        idim &= IMGMASK;
-        image[i] = otherdims | (idim << IMG2BITS);
+    if (f & 16) {
+      if (deform_vremap && mask[i] & deform_groupbit) {
+        v[i][0] += h_rate[4];
+        v[i][1] += h_rate[3];
+        v[i][2] += h_rate[2];
       }
-      if (x[i][2] >= hi[2]) {
-        x[i][2] -= period[2];
-        x[i][2] = MAX(x[i][2],lo[2]);
-        if (deform_vremap && mask[i] & deform_groupbit) {
-          v[i][0] -= h_rate[4];
-          v[i][1] -= h_rate[3];
-          v[i][2] -= h_rate[2];
-        }
-        idim = image[i] >> IMG2BITS;
-        otherdims = image[i] ^ (idim << IMG2BITS);
-        idim++;
-        idim &= IMGMASK;
-        image[i] = otherdims | (idim << IMG2BITS);
+      idim = image[i] >> IMG2BITS;
+      otherdims = image[i] ^ (idim << IMG2BITS);
+      idim--;
+      idim &= IMGMASK;
+      image[i] = otherdims | (idim << IMG2BITS);
+    }
+    if (f & 32) {
+      if (deform_vremap && mask[i] & deform_groupbit) {
+        v[i][0] -= h_rate[4];
+        v[i][1] -= h_rate[3];
+        v[i][2] -= h_rate[2];
       }
+      idim = image[i] >> IMG2BITS;
+      otherdims = image[i] ^ (idim << IMG2BITS);
+      idim++;
+      idim &= IMGMASK;
+      image[i] = otherdims | (idim << IMG2BITS);
     }
   }
 }
@@ -1103,6 +1156,57 @@ void Domain::minimum_image(double *delta)
   }
 }
 
+/* ----------------------------------------------------------------------
+   minimum image convention in periodic dimensions for a list of n deltas
+   same convention as minimum_image() for a single delta, but each delta
+     is reduced by its nearest image count in one step instead of by
+     iterated shifts, so the loop is branch-free and can vectorize
+   for triclinic, also add/subtract tilt factors in other dims as needed
+------------------------------------------------------------------------- */
+
+void Domain::minimum_image(int n, double **delta)
+{
+  int i;
+
+  const double fx = xperiodic ? 1.0 : 0.0;
+  const double fy = yperiodic ? 1.0 : 0.0;
+  const double fz = zperiodic ? 1.0 : 0.0;
+  const double invx = 1.0/xprd;
+  const double invy = 1.0/yprd;
+  const double invz = 1.0/zprd;
+
+  if (triclinic == 0) {
+    for (i = 0; i < n; i++) {
+      delta[i][0] -= xprd * (fx * rint(delta[i][0]*invx));
+      delta[i][1] -= yprd * (fy * rint(delta[i][1]*invy));
+      delta[i][2] -= zprd * (fz * rint(delta[i][2]*invz));
+    }
+
+  } else {
+    for (i = 0; i < n; i++) {
+      double dx = delta[i][0];
+      double dy = delta[i][1];
+      double dz = delta[i][2];
+
+      const double nz = fz * rint(dz*invz);
+      dz -= zprd*nz;
+      dy -= yz*nz;
+      dx -= xz*nz;
+
+      const double ny = fy * rint(dy*invy);
+      dy -= yprd*ny;
+      dx -= xy*ny;
+
+      const double nx = fx * rint(dx*invx);
+      dx -= xprd*nx;
+
+      delta[i][0] = dx;
+      delta[i][1] = dy;
+      delta[i][2] = dz;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    minimum image convention in periodic dimensions
    use 1/2 of box size as test
@@ -113,6 +113,7 @@ class Domain : protected Pointers {
   void subbox_too_small_check(double);
   void minimum_image(double &, double &, double &);
   void minimum_image(double *);
+  void minimum_image(int, double **);
   void minimum_image_once(double *);
   int closest_image(int, int);
   int closest_image(const double * const, int);
@@ -162,6 +163,9 @@ class Domain : protected Pointers {
  protected:
   double small[3];                  // fractions of box lengths
 
+  int *pbcflags;                    // per-atom wrap flags from 1st pbc() pass
+  int maxpbc;                       // allocated size of pbcflags
+
  private:
   template <typename T> static Region *region_creator(LAMMPS *,int,char**);
 };
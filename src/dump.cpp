@@ -14,6 +14,8 @@
 #include "dump.h"
 #include <mpi.h>
 #include <cstring>
+#include <cstdlib>
+#include <thread>
 #include "atom.h"
 #include "irregular.h"
 #include "update.h"
@@ -41,6 +43,22 @@ Dump *Dump::dumpptr;
 
 enum{ASCEND,DESCEND};
 
+// snapshot staged for the helper I/O thread when dump_modify async is on
+// the snapshot bytes are captured via a memory stream,
+//   so the thread touches no dump state beyond the blob and target file
+
+struct Dump::AsyncFrame {
+  std::thread thread;      // helper thread writing the previous snapshot
+  FILE *realfp;            // actual dump file the snapshot goes to
+  char *blob;              // snapshot bytes captured via memory stream
+  size_t blobsize;         // # of bytes in blob
+  int pending;             // 1 if helper thread still owns realfp
+  int closeflag;           // 1 if helper thread closes realfp when done
+
+  AsyncFrame() : realfp(NULL), blob(NULL), blobsize(0),
+                 pending(0), closeflag(0) {}
+};
+
 /* ---------------------------------------------------------------------- */
 
 Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) : Pointers(lmp)
@@ -92,6 +110,11 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) : Pointers(lmp)
   unit_count = 0;
   delay_flag = 0;
 
+  compress_cmd = NULL;
+
+  async_flag = 0;
+  async = NULL;
+
   maxfiles = -1;
   numfiles = 0;
   fileidx = 0;
@@ -130,6 +153,8 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) : Pointers(lmp)
   if (me == 0) filewriter = 1;
   fileproc = 0;
   multiname = NULL;
+  aggregate_flag = 0;
+  aggcurrent = NULL;
 
   char *ptr;
   if ((ptr = strchr(filename,'%'))) {
@@ -159,10 +184,19 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) : Pointers(lmp)
 
 Dump::~Dump()
 {
+  // drain helper thread before closing the file it writes to
+
+  async_wait();
+  if (async) {
+    free(async->blob);
+    delete async;
+  }
+
   delete [] id;
   delete [] style;
   delete [] filename;
   delete [] multiname;
+  delete [] aggcurrent;
 
   delete [] format;
   delete [] format_default;
@@ -172,6 +206,7 @@ Dump::~Dump()
   delete [] format_bigint_user;
 
   delete [] refresh;
+  delete [] compress_cmd;
 
   // format_column_user is deallocated by child classes that use it
 
@@ -191,7 +226,7 @@ Dump::~Dump()
     memory->destroy(imagepbc);
   }
 
-  if (multiproc) MPI_Comm_free(&clustercomm);
+  if (multiproc || aggregate_flag) MPI_Comm_free(&clustercomm);
 
   // delete storage for caching file names
 
@@ -219,6 +254,17 @@ void Dump::init()
 {
   init_style();
 
+  // aggregation mode writes disjoint byte ranges of one shared file
+  // requires buffered string output so writers know byte counts in advance
+
+  if (aggregate_flag) {
+    if (binary || compressed || buffer_allow == 0 || buffer_flag == 0)
+      error->all(FLERR,"Dump file aggregation requires buffered text output");
+    if (async_flag)
+      error->all(FLERR,
+                 "Dump file aggregation is incompatible with dump_modify async");
+  }
+
   if (!sort_flag) {
     memory->destroy(bufsort);
     memory->destroy(ids);
@@ -339,6 +385,10 @@ void Dump::write()
 
   if (delay_flag && update->ntimestep < delaystep) return;
 
+  // wait for helper thread to finish previous snapshot before reusing fp
+
+  if (async_flag) async_wait();
+
   // if file per timestep, open new file
 
   if (multifile) openfile();
@@ -386,7 +436,22 @@ void Dump::write()
   if (multiproc)
     MPI_Allreduce(&bnme,&nheader,1,MPI_LMP_BIGINT,MPI_SUM,clustercomm);
 
-  if (filewriter) write_header(nheader);
+  // if async, redirect this snapshot into a memory stream
+  // the helper thread writes the captured bytes to the real file
+
+  if (async_flag && filewriter) {
+    async->realfp = fp;
+    free(async->blob);
+    async->blob = NULL;
+    async->blobsize = 0;
+    fp = open_memstream(&async->blob,&async->blobsize);
+    if (fp == NULL)
+      error->one(FLERR,"Cannot open memory stream for dump");
+  }
+
+  // for aggregation mode, only proc 0 writes the snapshot header
+
+  if (filewriter && (aggregate_flag == 0 || me == 0)) write_header(nheader);
 
   // insure buf is sized for packing and communicating
   // use nmax to insure filewriter proc can receive info from others
@@ -458,6 +523,40 @@ void Dump::write()
     }
   }
 
+  // for aggregation mode, each cluster writes a disjoint byte range of
+  //   one shared file = large sequential writes without per-proc files
+  //   or funneling everything through proc 0
+  // compute each proc's byte offset within the snapshot via scan of the
+  //   buffered string lengths, cluster range starts at its writer's offset
+  // proc 0 wrote the snapshot header, its file position = start of data
+  // writer procs other than 0 re-open the shared file at their range
+
+  bigint aggbase = 0;
+  bigint aggoffset = 0;
+  bigint aggtotal = 0;
+
+  if (aggregate_flag) {
+    bigint bchars = nsme;
+    MPI_Scan(&bchars,&aggoffset,1,MPI_LMP_BIGINT,MPI_SUM,world);
+    aggoffset -= bchars;
+    MPI_Allreduce(&bchars,&aggtotal,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+    if (me == 0) {
+      fflush(fp);
+      aggbase = ftell(fp);
+    }
+    MPI_Bcast(&aggbase,1,MPI_LMP_BIGINT,0,world);
+
+    if (filewriter) {
+      if (me) {
+        fp = fopen(aggcurrent,"rb+");
+        if (fp == NULL) error->one(FLERR,"Cannot open dump file");
+      }
+      if (fseek(fp,static_cast<long> (aggbase+aggoffset),SEEK_SET))
+        error->one(FLERR,"Cannot seek in dump file");
+    }
+  }
+
   // filewriter = 1 = this proc writes to file
   // ping each proc in my cluster, receive its data, write data to file
   // else wait for ping from fileproc, send my data to fileproc
@@ -510,6 +609,24 @@ void Dump::write()
     }
   }
 
+  // aggregation mode: proc 0 repositions to the snapshot end so appended
+  // snapshots start there, other writers close their handle on the file
+
+  if (aggregate_flag && filewriter) {
+    if (me == 0) {
+      if (fseek(fp,static_cast<long> (aggbase+aggtotal),SEEK_SET))
+        error->one(FLERR,"Cannot seek in dump file");
+    } else if (multifile == 0) {
+      fclose(fp);
+      fp = NULL;
+    }
+  }
+
+  // hand completed snapshot to helper thread
+  // it flushes and, for file per timestep, closes the file
+
+  if (async_flag && filewriter) async_launch(multifile);
+
   // restore original x,v,image unaltered by PBC
 
   if (pbcflag) {
@@ -535,6 +652,51 @@ void Dump::write()
   }
 }
 
+/* ----------------------------------------------------------------------
+   finalize the memory stream and hand its bytes to the helper thread
+   closeflag = 1 if the thread also closes the target file (file per step)
+   only called by filewriter procs with async_flag set
+------------------------------------------------------------------------- */
+
+void Dump::async_launch(int closeflag)
+{
+  fclose(fp);
+  fp = NULL;
+
+  async->closeflag = closeflag;
+  async->pending = 1;
+  async->thread = std::thread(&Dump::async_write,this);
+}
+
+/* ----------------------------------------------------------------------
+   helper thread: write staged snapshot bytes to the real dump file
+------------------------------------------------------------------------- */
+
+void Dump::async_write()
+{
+  if (async->blobsize)
+    fwrite(async->blob,1,async->blobsize,async->realfp);
+
+  if (async->closeflag) {
+    if (compressed) pclose(async->realfp);
+    else fclose(async->realfp);
+  } else if (flush_flag) fflush(async->realfp);
+}
+
+/* ----------------------------------------------------------------------
+   block until the helper thread has drained the previous snapshot
+------------------------------------------------------------------------- */
+
+void Dump::async_wait()
+{
+  if (async == NULL || !async->pending) return;
+
+  async->thread.join();
+  async->pending = 0;
+  if (!async->closeflag) fp = async->realfp;
+  async->realfp = NULL;
+}
+
 /* ----------------------------------------------------------------------
    generic opening of a dump file
    ASCII or binary or gzipped
@@ -585,10 +747,32 @@ void Dump::openfile()
     }
   }
 
+  // for aggregation mode, remember current file name so writer procs
+  // other than 0 can re-open it at their own offset, only proc 0 creates it
+
+  if (aggregate_flag) {
+    delete [] aggcurrent;
+    aggcurrent = new char[strlen(filecurrent) + 1];
+    strcpy(aggcurrent,filecurrent);
+  }
+
   // each proc with filewriter = 1 opens a file
 
-  if (filewriter) {
-    if (compressed) {
+  if (filewriter && (aggregate_flag == 0 || me == 0)) {
+    if (compressed && compress_cmd) {
+
+      // pipe through user-specified filter, e.g. a parallel compressor
+
+      char *cmd = new char[strlen(compress_cmd) + strlen(filecurrent) + 8];
+      sprintf(cmd,"%s > %s",compress_cmd,filecurrent);
+#ifdef _WIN32
+      fp = _popen(cmd,"wb");
+#else
+      fp = popen(cmd,"w");
+#endif
+      delete [] cmd;
+
+    } else if (compressed) {
 #ifdef LAMMPS_GZIP
       char gzip[128];
       sprintf(gzip,"gzip -6 > %s",filecurrent);
@@ -927,6 +1111,19 @@ void Dump::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal dump_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) async_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) async_flag = 0;
+      else error->all(FLERR,"Illegal dump_modify command");
+#if defined(_WIN32)
+      if (async_flag)
+        error->all(FLERR,"Dump_modify async is not supported on Windows");
+#endif
+      if (async_flag && async == NULL) async = new AsyncFrame();
+      if (!async_flag) async_wait();
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"buffer") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) buffer_flag = 1;
@@ -936,6 +1133,25 @@ void Dump::modify_params(int narg, char **arg)
         error->all(FLERR,"Dump_modify buffer yes not allowed for this style");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"compress_cmd") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (singlefile_opened)
+        error->all(FLERR,"Cannot use dump_modify compress_cmd "
+                   "once dump file is opened");
+      delete [] compress_cmd;
+      compress_cmd = NULL;
+      if (strcmp(arg[iarg+1],"none") == 0) {
+        char *suffix = filename + strlen(filename) - strlen(".gz");
+        if (suffix > filename && strcmp(suffix,".gz") == 0) compressed = 1;
+        else compressed = 0;
+      } else {
+        int n = strlen(arg[iarg+1]) + 1;
+        compress_cmd = new char[n];
+        strcpy(compress_cmd,arg[iarg+1]);
+        compressed = 1;
+      }
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"delay") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
       delaystep = force->bnumeric(FLERR,arg[iarg+1]);
@@ -964,14 +1180,20 @@ void Dump::modify_params(int narg, char **arg)
 
     } else if (strcmp(arg[iarg],"fileper") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
-      if (!multiproc)
-        error->all(FLERR,"Cannot use dump_modify fileper "
-                   "without % in dump file name");
       int nper = force->inumeric(FLERR,arg[iarg+1]);
       if (nper <= 0) error->all(FLERR,"Illegal dump_modify command");
 
-      multiproc = nprocs/nper;
-      if (nprocs % nper) multiproc++;
+      // without % in filename, clusters aggregate into one shared file
+
+      if (!multiproc) {
+        if (aggregate_flag) MPI_Comm_free(&clustercomm);
+        aggregate_flag = 1;
+      } else {
+        multiproc = nprocs/nper;
+        if (nprocs % nper) multiproc++;
+        MPI_Comm_free(&clustercomm);
+      }
+
       fileproc = me/nper * nper;
       int fileprocnext = MIN(fileproc+nper,nprocs);
       nclusterprocs = fileprocnext - fileproc;
@@ -979,15 +1201,16 @@ void Dump::modify_params(int narg, char **arg)
       else filewriter = 0;
       int icluster = fileproc/nper;
 
-      MPI_Comm_free(&clustercomm);
       MPI_Comm_split(world,icluster,0,&clustercomm);
 
-      delete [] multiname;
-      multiname = new char[strlen(filename) + 16];
-      char *ptr = strchr(filename,'%');
-      *ptr = '\0';
-      sprintf(multiname,"%s%d%s",filename,icluster,ptr+1);
-      *ptr = '%';
+      if (multiproc) {
+        delete [] multiname;
+        multiname = new char[strlen(filename) + 16];
+        char *ptr = strchr(filename,'%');
+        *ptr = '\0';
+        sprintf(multiname,"%s%d%s",filename,icluster,ptr+1);
+        *ptr = '%';
+      }
       iarg += 2;
 
     } else if (strcmp(arg[iarg],"first") == 0) {
@@ -1060,14 +1283,17 @@ void Dump::modify_params(int narg, char **arg)
       iarg += 2;
     } else if (strcmp(arg[iarg],"nfile") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
-      if (!multiproc)
-        error->all(FLERR,"Cannot use dump_modify nfile "
-                   "without % in dump file name");
       int nfile = force->inumeric(FLERR,arg[iarg+1]);
       if (nfile <= 0) error->all(FLERR,"Illegal dump_modify command");
       nfile = MIN(nfile,nprocs);
 
-      multiproc = nfile;
+      // without % in filename, clusters aggregate into one shared file
+
+      if (!multiproc) {
+        if (aggregate_flag) MPI_Comm_free(&clustercomm);
+        aggregate_flag = 1;
+      } else multiproc = nfile;
+
       int icluster = static_cast<int> ((bigint) me * nfile/nprocs);
       fileproc = static_cast<int> ((bigint) icluster * nprocs/nfile);
       int fcluster = static_cast<int> ((bigint) fileproc * nfile/nprocs);
@@ -1080,15 +1306,17 @@ void Dump::modify_params(int narg, char **arg)
       if (me == fileproc) filewriter = 1;
       else filewriter = 0;
 
-      MPI_Comm_free(&clustercomm);
+      if (multiproc) MPI_Comm_free(&clustercomm);
       MPI_Comm_split(world,icluster,0,&clustercomm);
 
-      delete [] multiname;
-      multiname = new char[strlen(filename) + 16];
-      char *ptr = strchr(filename,'%');
-      *ptr = '\0';
-      sprintf(multiname,"%s%d%s",filename,icluster,ptr+1);
-      *ptr = '%';
+      if (multiproc) {
+        delete [] multiname;
+        multiname = new char[strlen(filename) + 16];
+        char *ptr = strchr(filename,'%');
+        *ptr = '\0';
+        sprintf(multiname,"%s%d%s",filename,icluster,ptr+1);
+        *ptr = '%';
+      }
       iarg += 2;
 
     } else if (strcmp(arg[iarg],"pad") == 0) {
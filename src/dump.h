@@ -62,6 +62,8 @@ class Dump : protected Pointers {
   int fileproc;              // ID of proc in my cluster who writes to file
   char *multiname;           // filename with % converted to cluster ID
   MPI_Comm clustercomm;      // MPI communicator within my cluster of procs
+  int aggregate_flag;        // 1 if clusters write ranges of one shared file
+  char *aggcurrent;          // name of current shared file for aggregation
 
   int header_flag;           // 0 = item, 2 = xyz
   int flush_flag;            // 0 if no flush, 1 if flush every dump
@@ -81,6 +83,13 @@ class Dump : protected Pointers {
   int delay_flag;            // 1 if delay output until delaystep
   bigint delaystep;
 
+  char *compress_cmd;        // external filter for compressed output
+                             // NULL = use gzip
+
+  int async_flag;            // 1 if snapshot bytes written by helper thread
+  struct AsyncFrame;         // snapshot handed off to the helper thread
+  AsyncFrame *async;
+
   int refreshflag;           // 1 if dump_modify refresh specified
   char *refresh;             // compute ID to invoke refresh() on
   int irefresh;              // index of compute
@@ -148,6 +157,10 @@ class Dump : protected Pointers {
   void pbc_allocate();
   double compute_time();
 
+  void async_launch(int);
+  void async_write();
+  void async_wait();
+
   void sort();
 #if defined(LMP_QSORT)
   static int idcompare(const void *, const void *);
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "dump_columnar.h"
+#include <cstring>
+#include "domain.h"
+#include "update.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+DumpColumnar::DumpColumnar(LAMMPS *lmp, int narg, char **arg) :
+  DumpCustom(lmp, narg, arg)
+{
+  if (compressed)
+    error->all(FLERR,"Dump columnar cannot write gzipped files");
+
+  // frames are emitted directly with bulk binary writes,
+  // never via the text conversion buffer
+
+  binary = 1;
+  buffer_allow = 0;
+  buffer_flag = 0;
+
+  colbuf = NULL;
+  maxcolbuf = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpColumnar::~DumpColumnar()
+{
+  memory->destroy(colbuf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpColumnar::init_style()
+{
+  DumpCustom::init_style();
+
+  // write_header() and write_data() are overridden wholesale,
+  // so the header/write choices set by DumpCustom are not used
+}
+
+/* ----------------------------------------------------------------------
+   write frame header: timestep, atom count, box, column labels/types,
+   and the number of data chunks that follow
+------------------------------------------------------------------------- */
+
+void DumpColumnar::write_header(bigint ndump)
+{
+  if (multiproc == 0 && me) return;
+
+  fwrite(&update->ntimestep,sizeof(bigint),1,fp);
+  fwrite(&ndump,sizeof(bigint),1,fp);
+  fwrite(&domain->triclinic,sizeof(int),1,fp);
+  fwrite(&domain->boundary[0][0],6*sizeof(int),1,fp);
+  fwrite(&boxxlo,sizeof(double),1,fp);
+  fwrite(&boxxhi,sizeof(double),1,fp);
+  fwrite(&boxylo,sizeof(double),1,fp);
+  fwrite(&boxyhi,sizeof(double),1,fp);
+  fwrite(&boxzlo,sizeof(double),1,fp);
+  fwrite(&boxzhi,sizeof(double),1,fp);
+  if (domain->triclinic) {
+    fwrite(&boxxy,sizeof(double),1,fp);
+    fwrite(&boxxz,sizeof(double),1,fp);
+    fwrite(&boxyz,sizeof(double),1,fp);
+  }
+
+  fwrite(&size_one,sizeof(int),1,fp);
+  fwrite(vtype,sizeof(int),size_one,fp);
+  int len = strlen(columns);
+  fwrite(&len,sizeof(int),1,fp);
+  fwrite(columns,sizeof(char),len,fp);
+
+  if (multiproc) fwrite(&nclusterprocs,sizeof(int),1,fp);
+  else fwrite(&nprocs,sizeof(int),1,fp);
+}
+
+/* ----------------------------------------------------------------------
+   write one chunk of n atoms as size_one contiguous columns
+   integer-typed columns are run-length encoded when that shrinks them
+------------------------------------------------------------------------- */
+
+void DumpColumnar::write_data(int n, double *mybuf)
+{
+  fwrite(&n,sizeof(int),1,fp);
+
+  if (n > maxcolbuf) {
+    memory->destroy(colbuf);
+    maxcolbuf = n;
+    memory->create(colbuf,maxcolbuf,"dump:colbuf");
+  }
+
+  for (int j = 0; j < size_one; j++) {
+
+    // transpose column j out of the row-major pack buffer
+
+    double *src = &mybuf[j];
+    for (int i = 0; i < n; i++) colbuf[i] = src[(bigint) i * size_one];
+
+    // integer columns (id, type, proc, image flags) often carry long
+    // runs of identical values, especially after sorting
+    // encode as runs when that beats the raw payload:
+    //   raw = 8n bytes, RLE = 4 + 12*nruns bytes
+
+    int codec = 0;
+    int nruns = 0;
+    if (vtype[j] == Dump::INT && n > 0) {
+      nruns = 1;
+      for (int i = 1; i < n; i++)
+        if (colbuf[i] != colbuf[i-1]) nruns++;
+      if (4 + 12*nruns < 8*n) codec = 1;
+    }
+    fwrite(&codec,sizeof(int),1,fp);
+
+    if (codec == 0) {
+      fwrite(colbuf,sizeof(double),n,fp);
+    } else {
+      fwrite(&nruns,sizeof(int),1,fp);
+      int start = 0;
+      for (int i = 1; i <= n; i++) {
+        if (i == n || colbuf[i] != colbuf[start]) {
+          int count = i - start;
+          fwrite(&count,sizeof(int),1,fp);
+          fwrite(&colbuf[start],sizeof(double),1,fp);
+          start = i;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,74 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(columnar,DumpColumnar)
+
+#else
+
+#ifndef LMP_DUMP_COLUMNAR_H
+#define LMP_DUMP_COLUMNAR_H
+
+#include "dump_custom.h"
+
+namespace LAMMPS_NS {
+
+// binary columnar variant of dump custom
+// each frame stores every field as one contiguous column, so a frame
+// is a single bulk write per column instead of per-atom text formatting
+//
+// frame layout (native endianness):
+//   bigint ntimestep, bigint natoms
+//   int triclinic, int boundary[6]
+//   6 doubles box bounds, +3 doubles tilt if triclinic
+//   int nfield, int vtype[nfield]
+//   int len, char columns[len]   (space-separated column labels)
+//   int nchunks
+// then per chunk:
+//   int nrows
+//   per field: int codec, payload
+//     codec 0 = raw: nrows doubles
+//     codec 1 = RLE: int nruns, nruns * (int count, double value)
+
+class DumpColumnar : public DumpCustom {
+ public:
+  DumpColumnar(class LAMMPS *, int, char **);
+  virtual ~DumpColumnar();
+
+ protected:
+  double *colbuf;            // scratch for one transposed column
+  int maxcolbuf;             // allocated length of colbuf
+
+  virtual void init_style();
+  virtual void write_header(bigint);
+  virtual void write_data(int, double *);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Dump columnar cannot write gzipped files
+
+The columnar format is written with bulk binary writes which do not
+go through the compression pipe.
+
+E: Dump columnar does not support buffering
+
+UNDOCUMENTED
+
+*/
@@ -0,0 +1,223 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "dump_ring.h"
+#include <cstring>
+#include "domain.h"
+#include "update.h"
+#include "force.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+#define DEFAULTFRAMES 10
+
+/* ----------------------------------------------------------------------
+   in-memory trajectory ring buffer
+   selects and packs atoms exactly like dump custom, but stores the
+     packed per-proc values in a ring of frames instead of writing a file
+   no inter-proc communication is performed, so taking a frame does not
+     synchronize the procs, a coupled code reads each proc's frames
+     through the library interface (lammps_extract_frame)
+   the file name argument of the dump command is accepted but unused
+------------------------------------------------------------------------- */
+
+DumpRing::DumpRing(LAMMPS *lmp, int narg, char **arg) :
+  DumpCustom(lmp, narg, arg)
+{
+  nframes = 0;
+  nstored = 0;
+  first = 0;
+  frames = NULL;
+
+  callback = NULL;
+  callback_caller = NULL;
+
+  allocate_frames(DEFAULTFRAMES);
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpRing::~DumpRing()
+{
+  deallocate_frames();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpRing::init_style()
+{
+  DumpCustom::init_style();
+
+  if (sort_flag) error->all(FLERR,"Dump ring cannot be used with sorting");
+}
+
+/* ----------------------------------------------------------------------
+   take a snapshot into the ring, overwriting the oldest frame when full
+------------------------------------------------------------------------- */
+
+void DumpRing::write()
+{
+  if (delay_flag && update->ntimestep < delaystep) return;
+
+  // select atoms and size buf, same pack path as dump custom
+
+  nme = count();
+
+  if (nme > maxbuf) {
+    if ((bigint) nme * size_one > MAXSMALLINT)
+      error->all(FLERR,"Too much per-proc info for dump");
+    maxbuf = nme;
+    memory->destroy(buf);
+    memory->create(buf,maxbuf*size_one,"dump:buf");
+  }
+
+  pack(NULL);
+
+  // claim the next ring slot
+
+  int islot = (first + nstored) % nframes;
+  if (nstored == nframes) first = (first + 1) % nframes;
+  else nstored++;
+
+  Frame *f = &frames[islot];
+  f->ntimestep = update->ntimestep;
+  f->nrows = nme;
+
+  f->box[0] = domain->boxlo[0];
+  f->box[1] = domain->boxlo[1];
+  f->box[2] = domain->boxlo[2];
+  f->box[3] = domain->boxhi[0];
+  f->box[4] = domain->boxhi[1];
+  f->box[5] = domain->boxhi[2];
+  f->box[6] = domain->xy;
+  f->box[7] = domain->xz;
+  f->box[8] = domain->yz;
+
+  bigint ndata = (bigint) nme * size_one;
+  if (ndata > f->maxdata) {
+    memory->destroy(f->data);
+    memory->create(f->data,ndata,"dump:framedata");
+    f->maxdata = ndata;
+  }
+  if (ndata) memcpy(f->data,buf,ndata*sizeof(double));
+
+  // in-situ analysis hook: the frame is a stable side-buffer copy, so
+  // the callback can analyze it, or hand it to its own worker, while
+  // the run proceeds; it stays valid until the slot is overwritten,
+  // i.e. for nframes more snapshots
+
+  if (callback) callback(callback_caller,f->ntimestep,nstored-1);
+}
+
+/* ----------------------------------------------------------------------
+   register the in-situ analysis callback, or unregister with NULL
+   called through the library interface
+------------------------------------------------------------------------- */
+
+void DumpRing::set_callback(FrameFnPtr caller_callback, void *caller)
+{
+  callback = caller_callback;
+  callback_caller = caller;
+}
+
+/* ----------------------------------------------------------------------
+   # of frames currently buffered on this proc
+------------------------------------------------------------------------- */
+
+int DumpRing::frame_count()
+{
+  return nstored;
+}
+
+/* ----------------------------------------------------------------------
+   return ptr to this proc's packed data for buffered frame iframe
+   iframe = 0 for oldest buffered frame, up to frame_count()-1 for newest
+   also return its timestep, # of rows, and # of columns
+   ptr is valid until the frame is overwritten or the dump is deleted
+------------------------------------------------------------------------- */
+
+double *DumpRing::frame_data(int iframe, bigint *step, int *nrows, int *ncols)
+{
+  if (iframe < 0 || iframe >= nstored) return NULL;
+  Frame *f = &frames[(first + iframe) % nframes];
+
+  *step = f->ntimestep;
+  *nrows = f->nrows;
+  *ncols = size_one;
+  return f->data;
+}
+
+/* ----------------------------------------------------------------------
+   return ptr to 9 box values of buffered frame iframe
+   boxlo xyz, boxhi xyz, xy xz yz tilt
+------------------------------------------------------------------------- */
+
+double *DumpRing::frame_box(int iframe)
+{
+  if (iframe < 0 || iframe >= nstored) return NULL;
+  return frames[(first + iframe) % nframes].box;
+}
+
+/* ----------------------------------------------------------------------
+   discard all buffered frames, called after a consumer has read them
+------------------------------------------------------------------------- */
+
+void DumpRing::frame_clear()
+{
+  nstored = 0;
+  first = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DumpRing::modify_param(int narg, char **arg)
+{
+  if (strcmp(arg[0],"frames") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal dump_modify command");
+    int n = force->inumeric(FLERR,arg[1]);
+    if (n <= 0) error->all(FLERR,"Illegal dump_modify command");
+    deallocate_frames();
+    allocate_frames(n);
+    return 2;
+  }
+
+  return DumpCustom::modify_param(narg,arg);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpRing::allocate_frames(int n)
+{
+  nframes = n;
+  nstored = 0;
+  first = 0;
+  frames = new Frame[nframes];
+  for (int i = 0; i < nframes; i++) {
+    frames[i].ntimestep = -1;
+    frames[i].nrows = 0;
+    frames[i].data = NULL;
+    frames[i].maxdata = 0;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpRing::deallocate_frames()
+{
+  for (int i = 0; i < nframes; i++) memory->destroy(frames[i].data);
+  delete [] frames;
+  frames = NULL;
+  nframes = 0;
+}
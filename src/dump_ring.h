@@ -0,0 +1,100 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(ring,DumpRing)
+
+#else
+
+#ifndef LMP_DUMP_RING_H
+#define LMP_DUMP_RING_H
+
+#include "dump_custom.h"
+
+namespace LAMMPS_NS {
+
+class DumpRing : public DumpCustom {
+ public:
+  DumpRing(class LAMMPS *, int, char **);
+  virtual ~DumpRing();
+  virtual void write();
+
+  // access to buffered frames, used by library interface
+
+  int frame_count();
+  double *frame_data(int, bigint *, int *, int *);
+  double *frame_box(int);
+  void frame_clear();
+
+  // optional in-situ analysis hook, fired from inside the run loop
+  // right after a snapshot is buffered; args are the registered caller,
+  // the timestep and the frame index to pass to frame_data()
+
+  typedef void (*FrameFnPtr)(void *, bigint, int);
+  void set_callback(FrameFnPtr, void *);
+
+ protected:
+
+  // one buffered snapshot of this proc's packed atom data
+
+  struct Frame {
+    bigint ntimestep;        // timestep the snapshot was taken on
+    int nrows;               // # of atom lines this proc packed
+    double box[9];           // boxlo xyz, boxhi xyz, xy xz yz tilt
+    double *data;            // packed values, nrows x size_one doubles
+    bigint maxdata;          // allocated length of data
+  };
+
+  int nframes;               // ring capacity in frames
+  int nstored;               // # of frames currently buffered
+  int first;                 // ring index of oldest buffered frame
+  Frame *frames;             // the ring of per-proc frames
+
+  FrameFnPtr callback;       // in-situ analysis callback or NULL
+  void *callback_caller;     // opaque handle passed back to the callback
+
+  virtual void init_style();
+  virtual void openfile() {}
+  virtual void write_header(bigint) {}
+  virtual void write_data(int, double *) {}
+  virtual int modify_param(int, char **);
+
+  void allocate_frames(int);
+  void deallocate_frames();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Dump ring cannot be used with sorting
+
+The frames hold each proc's own atoms in packed order, sorting across
+procs would require the communication this style avoids.
+
+E: Too much per-proc info for dump
+
+Number of local atoms times number of columns must fit in a 32-bit
+integer for dump.
+
+*/
@@ -25,7 +25,14 @@
 #include "kspace.h"
 #include "update.h"
 #include "min.h"
+#include "modify.h"
+#include "fix.h"
+#include "compute.h"
+#include "pair.h"
+#include "pair_hybrid.h"
 #include "neighbor.h"
+#include "output.h"
+#include "thermo.h"
 #include "neigh_list.h"
 #include "neigh_request.h"
 #include "memory.h"
@@ -36,7 +43,6 @@
 #include "fmt/format.h"
 
 #ifdef LMP_USER_OMP
-#include "modify.h"
 #include "fix_omp.h"
 #include "thr_data.h"
 #endif
@@ -49,6 +55,19 @@ static void mpi_timings(const char *label, Timer *t, enum Timer::ttype tt,
                         MPI_Comm world, const int nprocs, const int nthreads,
                         const int me, double time_loop, FILE *scr, FILE *log);
 
+static void detail_timings(const char *label, double time, MPI_Comm world,
+                           const int nprocs, const int me, double time_loop,
+                           FILE *scr, FILE *log);
+
+static void perf_counts(const char *label, Timer *t, enum Timer::ttype tt,
+                        MPI_Comm world, const int nprocs, const int me,
+                        FILE *scr, FILE *log);
+
+static void imbalance_cost(const char *label, Timer *t, enum Timer::ttype tt,
+                           MPI_Comm world, const int nprocs, const int me,
+                           double time_loop, FILE *scr, FILE *log,
+                           double *lost_total);
+
 #ifdef LMP_USER_OMP
 static void omp_times(FixOMP *fix, const char *label, enum Timer::ttype which,
                       const int nthreads,FILE *scr, FILE *log);
@@ -75,6 +94,10 @@ void Finish::end(int flag)
 
   const int nthreads = comm->nthreads;
 
+  // ensure any asynchronously queued thermo lines precede the summary
+
+  output->thermo->wait_async();
+
   // recompute natoms in case atoms have been lost
 
   bigint nblocal = atom->nlocal;
@@ -370,6 +393,112 @@ void Finish::end(int flag)
     }
   }
 
+  // imbalance cost per section: max - avg time is what the other ranks
+  // lose waiting on the slowest rank, and shows up as Comm/Kspace time
+
+  if (timeflag && timer->has_normal() && nprocs > 1) {
+
+    if (me == 0)
+      utils::logmesg(lmp,"\nImbalance cost (time lost waiting on slowest "
+                     "rank):\nSection |  lost time | %loop | straggler\n"
+                     "------------------------------------------\n");
+
+    double lost_total = 0.0;
+
+    imbalance_cost("Pair",timer,Timer::PAIR,world,nprocs,me,
+                   time_loop,screen,logfile,&lost_total);
+    if (atom->molecular)
+      imbalance_cost("Bond",timer,Timer::BOND,world,nprocs,me,
+                     time_loop,screen,logfile,&lost_total);
+    if (force->kspace)
+      imbalance_cost("Kspace",timer,Timer::KSPACE,world,nprocs,me,
+                     time_loop,screen,logfile,&lost_total);
+    imbalance_cost("Neigh",timer,Timer::NEIGH,world,nprocs,me,
+                   time_loop,screen,logfile,&lost_total);
+    imbalance_cost("Output",timer,Timer::OUTPUT,world,nprocs,me,
+                   time_loop,screen,logfile,&lost_total);
+    imbalance_cost("Modify",timer,Timer::MODIFY,world,nprocs,me,
+                   time_loop,screen,logfile,&lost_total);
+
+    if (me == 0)
+      utils::logmesg(lmp,fmt::format("Total   | {:<10.4g} |{:6.2f} |\n",
+                                     lost_total,
+                                     lost_total/time_loop*100.0));
+  }
+
+  // per-style timing breakdown, enabled via the timer detail option
+  // entries which accumulated no time on any rank are suppressed
+
+  if (timeflag && timer->has_normal() && timer->has_detail()) {
+
+    if (me == 0)
+      utils::logmesg(lmp,"\nDetailed timing breakdown:\nSection             "
+                     "    |  min time  |  avg time  |  max time  | %total\n"
+                     "------------------------------------------------------"
+                     "----------------\n");
+
+    std::string label;
+
+    for (i = 0; i < modify->nfix; i++) {
+      label = fmt::format("Fix {} {}",modify->fix[i]->id,
+                          modify->fix[i]->style);
+      detail_timings(label.c_str(),modify->fix[i]->time_detail,
+                     world,nprocs,me,time_loop,screen,logfile);
+    }
+
+    for (i = 0; i < modify->ncompute; i++) {
+      label = fmt::format("Compute {} {}",modify->compute[i]->id,
+                          modify->compute[i]->style);
+      detail_timings(label.c_str(),modify->compute[i]->time_detail,
+                     world,nprocs,me,time_loop,screen,logfile);
+    }
+
+    if (force->pair && utils::strmatch(force->pair_style,"^hybrid")) {
+      PairHybrid *hybrid = (PairHybrid *) force->pair;
+      for (i = 0; i < hybrid->nstyles; i++) {
+        label = fmt::format("Pair {}",hybrid->keywords[i]);
+        detail_timings(label.c_str(),hybrid->time_detail[i],
+                       world,nprocs,me,time_loop,screen,logfile);
+      }
+    }
+
+    detail_timings("Neigh bin",neighbor->time_detail_bin,
+                   world,nprocs,me,time_loop,screen,logfile);
+    detail_timings("Neigh stencil",neighbor->time_detail_stencil,
+                   world,nprocs,me,time_loop,screen,logfile);
+    for (i = 0; i < neighbor->nlist; i++) {
+      label = fmt::format("Neigh list {}",i+1);
+      detail_timings(label.c_str(),neighbor->time_detail_build[i],
+                     world,nprocs,me,time_loop,screen,logfile);
+    }
+  }
+
+  // hardware counter breakdown, enabled via the timer perf option
+  // counts are summed over the run and averaged across MPI ranks
+
+  if (timeflag && timer->has_normal() && timer->has_perf()) {
+
+    if (me == 0)
+      utils::logmesg(lmp,"\nHardware counter breakdown (avg per MPI rank):"
+                     "\nSection |   cycles   |   insns    |  IPC  | miss%"
+                     " |stall%\n--------------------------------------------"
+                     "---------------\n");
+
+    perf_counts("Pair",timer,Timer::PAIR,world,nprocs,me,screen,logfile);
+    if (atom->molecular)
+      perf_counts("Bond",timer,Timer::BOND,world,nprocs,me,screen,logfile);
+    if (force->kspace)
+      perf_counts("Kspace",timer,Timer::KSPACE,world,nprocs,me,screen,logfile);
+    perf_counts("Neigh",timer,Timer::NEIGH,world,nprocs,me,screen,logfile);
+    perf_counts("Comm",timer,Timer::COMM,world,nprocs,me,screen,logfile);
+    perf_counts("Output",timer,Timer::OUTPUT,world,nprocs,me,screen,logfile);
+    perf_counts("Modify",timer,Timer::MODIFY,world,nprocs,me,screen,logfile);
+  }
+
+  // write out buffered timeline events, enabled via the timer trace option
+
+  if (timer->has_trace()) timer->trace_flush();
+
 #ifdef LMP_USER_OMP
   int ifix = modify->find_fix("package_omp");
 
@@ -696,6 +825,116 @@ void mpi_timings(const char *label, Timer *t, enum Timer::ttype tt,
   }
 }
 
+/* ----------------------------------------------------------------------
+   print min/avg/max across ranks for one entry of the detailed breakdown
+   all ranks must call this: it performs collective reductions
+------------------------------------------------------------------------- */
+
+void detail_timings(const char *label, double time, MPI_Comm world,
+                    const int nprocs, const int me, double time_loop,
+                    FILE *scr, FILE *log)
+{
+  double tmp,time_min,time_max;
+
+  MPI_Allreduce(&time,&time_min,1,MPI_DOUBLE,MPI_MIN,world);
+  MPI_Allreduce(&time,&time_max,1,MPI_DOUBLE,MPI_MAX,world);
+  MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+  time = tmp/nprocs;
+
+  if (time_max == 0.0) return;
+
+  if (me == 0) {
+    std::string mesg =
+      fmt::format("{:<24s}| {:<10.5g} | {:<10.5g} | {:<10.5g} |{:6.2f}\n",
+                  label,time_min,time,time_max,time/time_loop*100.0);
+    if (scr) fputs(mesg.c_str(),scr);
+    if (log) fputs(mesg.c_str(),log);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   print the imbalance cost of one timing category: the max - avg wall
+   time across ranks is the time all other ranks spend blocked in the
+   next collective or wait, and the straggler column names the rank
+   holding everyone up.  rows that lose less than 0.1% of the loop time
+   are suppressed.  all ranks must call this: reductions are collective
+------------------------------------------------------------------------- */
+
+void imbalance_cost(const char *label, Timer *t, enum Timer::ttype tt,
+                    MPI_Comm world, const int nprocs, const int me,
+                    double time_loop, FILE *scr, FILE *log,
+                    double *lost_total)
+{
+  double tmp;
+  double time = t->get_wall(tt);
+
+  struct { double value; int rank; } mine,top;
+
+  MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+  const double time_avg = tmp/nprocs;
+
+  mine.value = time;
+  mine.rank = me;
+  MPI_Allreduce(&mine,&top,1,MPI_DOUBLE_INT,MPI_MAXLOC,world);
+
+  const double lost = top.value - time_avg;
+  *lost_total += lost;
+
+  if (lost/time_loop < 0.001) return;
+
+  if (me == 0) {
+    std::string mesg =
+      fmt::format("{:<8s}| {:<10.4g} |{:6.2f} | {}\n",
+                  label,lost,lost/time_loop*100.0,top.rank);
+    if (scr) fputs(mesg.c_str(),scr);
+    if (log) fputs(mesg.c_str(),log);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   print hardware counter statistics for one timing category
+   IPC = instructions per cycle, miss% = LLC misses per cache reference,
+   stall% = backend-stalled cycles per cycle, n/a if the counter could
+   not be opened on this machine
+------------------------------------------------------------------------- */
+
+void perf_counts(const char *label, Timer *t, enum Timer::ttype tt,
+                 MPI_Comm world, const int nprocs, const int me,
+                 FILE *scr, FILE *log)
+{
+  double vals[Timer::NUM_COUNTER],tmp[Timer::NUM_COUNTER];
+
+  for (int i = 0; i < Timer::NUM_COUNTER; i++)
+    vals[i] = t->get_counter(tt,i);
+  MPI_Allreduce(vals,tmp,Timer::NUM_COUNTER,MPI_DOUBLE,MPI_SUM,world);
+  for (int i = 0; i < Timer::NUM_COUNTER; i++)
+    vals[i] = tmp[i]/nprocs;
+
+  if (me == 0) {
+    const double cycles = vals[Timer::CNT_CYCLES];
+    const double insns  = vals[Timer::CNT_INSNS];
+    const double ipc = (cycles > 0.0) ? insns/cycles : 0.0;
+
+    std::string missbuf = "  n/a";
+    if (t->has_counter(Timer::CNT_CACHEMISS) &&
+        vals[Timer::CNT_CACHEREF] > 0.0)
+      missbuf = fmt::format("{:5.1f}",
+                            100.0*vals[Timer::CNT_CACHEMISS]/
+                            vals[Timer::CNT_CACHEREF]);
+
+    std::string stallbuf = "  n/a";
+    if (t->has_counter(Timer::CNT_STALL) && cycles > 0.0)
+      stallbuf = fmt::format("{:5.1f}",
+                             100.0*vals[Timer::CNT_STALL]/cycles);
+
+    std::string mesg =
+      fmt::format("{:<8s}| {:<10.4g} | {:<10.4g} |{:6.2f} | {} | {}\n",
+                  label,cycles,insns,ipc,missbuf,stallbuf);
+    if (scr) fputs(mesg.c_str(),scr);
+    if (log) fputs(mesg.c_str(),log);
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 #ifdef LMP_USER_OMP
@@ -81,6 +81,7 @@ Fix::Fix(LAMMPS *lmp, int /*narg*/, char **arg) :
   maxexchange_dynamic = 0;
   pre_exchange_migrate = 0;
   stores_ids = 0;
+  post_force_overlap = 0;
 
   scalar_flag = vector_flag = array_flag = 0;
   peratom_flag = local_flag = 0;
@@ -89,6 +90,7 @@ Fix::Fix(LAMMPS *lmp, int /*narg*/, char **arg) :
 
   comm_forward = comm_reverse = comm_border = 0;
   restart_reset = 0;
+  time_detail = 0.0;
 
   // reasonable defaults
   // however, each fix that uses these values should explicitly set them
@@ -65,6 +65,9 @@ class Fix : protected Pointers {
   int maxexchange_dynamic;       // 1 if fix sets maxexchange dynamically
   int pre_exchange_migrate;      // 1 if fix migrates atoms in pre_exchange()
   int stores_ids;                 // 1 if fix stores atom IDs
+  int post_force_overlap;        // 1 if post_force() only accumulates into f
+                                 //   and never reads it, so it may run while
+                                 //   reverse comm accumulates ghost forces
 
   int scalar_flag;               // 0/1 if compute_scalar() function exists
   int vector_flag;               // 0/1 if compute_vector() function exists
@@ -102,6 +105,8 @@ class Fix : protected Pointers {
   double virial[6];              // accumulated virial
   double *eatom,**vatom;         // accumulated per-atom energy/virial
 
+  double time_detail;            // accumulated wall time, for timer detail
+
   int restart_reset;             // 1 if restart just re-initialized fix
 
   // KOKKOS host/device flag and data masks
@@ -20,6 +20,7 @@
 #include "update.h"
 #include "modify.h"
 #include "domain.h"
+#include "group.h"
 #include "region.h"
 #include "respa.h"
 #include "input.h"
@@ -236,10 +237,8 @@ void FixAddForce::post_force(int vflag)
 {
   double **x = atom->x;
   double **f = atom->f;
-  int *mask = atom->mask;
   imageint *image = atom->image;
   double v[6];
-  int nlocal = atom->nlocal;
 
   if (update->ntimestep % nevery) return;
 
@@ -274,32 +273,38 @@ void FixAddForce::post_force(int vflag)
   foriginal[0] = foriginal[1] = foriginal[2] = foriginal[3] = 0.0;
   force_flag = 0;
 
+  // iterate cached list of group members
+  // avoids scanning all nlocal atoms when the group is small
+
+  int nmember;
+  int *mlist = group->member_list(igroup,nmember);
+
   // constant force
   // potential energy = - x dot f in unwrapped coords
 
   if (varflag == CONSTANT) {
     double unwrap[3];
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        if (region && !region->match(x[i][0],x[i][1],x[i][2])) continue;
-        domain->unmap(x[i],image[i],unwrap);
-        foriginal[0] -= xvalue*unwrap[0] + yvalue*unwrap[1] + zvalue*unwrap[2];
-        foriginal[1] += f[i][0];
-        foriginal[2] += f[i][1];
-        foriginal[3] += f[i][2];
-        f[i][0] += xvalue;
-        f[i][1] += yvalue;
-        f[i][2] += zvalue;
-        if (evflag) {
-          v[0] = xvalue * unwrap[0];
-          v[1] = yvalue * unwrap[1];
-          v[2] = zvalue * unwrap[2];
-          v[3] = xvalue * unwrap[1];
-          v[4] = xvalue * unwrap[2];
-          v[5] = yvalue * unwrap[2];
-          v_tally(i,v);
-        }
+    for (int m = 0; m < nmember; m++) {
+      int i = mlist[m];
+      if (region && !region->match(x[i][0],x[i][1],x[i][2])) continue;
+      domain->unmap(x[i],image[i],unwrap);
+      foriginal[0] -= xvalue*unwrap[0] + yvalue*unwrap[1] + zvalue*unwrap[2];
+      foriginal[1] += f[i][0];
+      foriginal[2] += f[i][1];
+      foriginal[3] += f[i][2];
+      f[i][0] += xvalue;
+      f[i][1] += yvalue;
+      f[i][2] += zvalue;
+      if (evflag) {
+        v[0] = xvalue * unwrap[0];
+        v[1] = yvalue * unwrap[1];
+        v[2] = zvalue * unwrap[2];
+        v[3] = xvalue * unwrap[1];
+        v[4] = xvalue * unwrap[2];
+        v[5] = yvalue * unwrap[2];
+        v_tally(i,v);
       }
+    }
 
   // variable force, wrap with clear/add
   // potential energy = evar if defined, else 0.0
@@ -324,37 +329,36 @@ void FixAddForce::post_force(int vflag)
 
     modify->addstep_compute(update->ntimestep + 1);
 
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        if (region && !region->match(x[i][0],x[i][1],x[i][2])) continue;
-        domain->unmap(x[i],image[i],unwrap);
-        if (xstyle == ATOM) xvalue = sforce[i][0];
-        if (ystyle == ATOM) yvalue = sforce[i][1];
-        if (zstyle == ATOM) zvalue = sforce[i][2];
-
-        if (estyle == ATOM) {
-          foriginal[0] += sforce[i][3];
-        } else {
-          if (xstyle) foriginal[0] -= xvalue*unwrap[0];
-          if (ystyle) foriginal[0] -= yvalue*unwrap[1];
-          if (zstyle) foriginal[0] -= zvalue*unwrap[2];
-        }
-        foriginal[1] += f[i][0];
-        foriginal[2] += f[i][1];
-        foriginal[3] += f[i][2];
-
-        if (xstyle) f[i][0] += xvalue;
-        if (ystyle) f[i][1] += yvalue;
-        if (zstyle) f[i][2] += zvalue;
-        if (evflag) {
-          v[0] = xstyle ? xvalue*unwrap[0] : 0.0;
-          v[1] = ystyle ? yvalue*unwrap[1] : 0.0;
-          v[2] = zstyle ? zvalue*unwrap[2] : 0.0;
-          v[3] = xstyle ? xvalue*unwrap[1] : 0.0;
-          v[4] = xstyle ? xvalue*unwrap[2] : 0.0;
-          v[5] = ystyle ? yvalue*unwrap[2] : 0.0;
-          v_tally(i, v);
-        }
+    for (int m = 0; m < nmember; m++) {
+      int i = mlist[m];
+      if (region && !region->match(x[i][0],x[i][1],x[i][2])) continue;
+      domain->unmap(x[i],image[i],unwrap);
+      if (xstyle == ATOM) xvalue = sforce[i][0];
+      if (ystyle == ATOM) yvalue = sforce[i][1];
+      if (zstyle == ATOM) zvalue = sforce[i][2];
+
+      if (estyle == ATOM) {
+        foriginal[0] += sforce[i][3];
+      } else {
+        if (xstyle) foriginal[0] -= xvalue*unwrap[0];
+        if (ystyle) foriginal[0] -= yvalue*unwrap[1];
+        if (zstyle) foriginal[0] -= zvalue*unwrap[2];
+      }
+      foriginal[1] += f[i][0];
+      foriginal[2] += f[i][1];
+      foriginal[3] += f[i][2];
+
+      if (xstyle) f[i][0] += xvalue;
+      if (ystyle) f[i][1] += yvalue;
+      if (zstyle) f[i][2] += zvalue;
+      if (evflag) {
+        v[0] = xstyle ? xvalue*unwrap[0] : 0.0;
+        v[1] = ystyle ? yvalue*unwrap[1] : 0.0;
+        v[2] = zstyle ? zvalue*unwrap[2] : 0.0;
+        v[3] = xstyle ? xvalue*unwrap[1] : 0.0;
+        v[4] = xstyle ? xvalue*unwrap[2] : 0.0;
+        v[5] = ystyle ? yvalue*unwrap[2] : 0.0;
+        v_tally(i, v);
       }
     }
   }
@@ -560,67 +560,94 @@ void FixAveCorrelate::end_of_step()
 
 void FixAveCorrelate::accumulate()
 {
-  int i,j,k,m,n,ipair;
+  int i,j,k,m,ipair;
+  double *vm,*ck;
+  double vmi;
 
   for (k = 0; k < nsample; k++) count[k]++;
 
+  // hoist the row ptrs for the newest sample and each correlation window
+  // out of the pair loops, so the inner updates can vectorize
+
+  double *vn = values[lastindex];
+
   if (type == AUTO) {
-    m = n = lastindex;
+    m = lastindex;
     for (k = 0; k < nsample; k++) {
-      ipair = 0;
-      for (i = 0; i < nvalues; i++) {
-        corr[k][ipair++] += values[m][i]*values[n][i];
-      }
+      vm = values[m];
+      ck = corr[k];
+      for (i = 0; i < nvalues; i++)
+        ck[i] += vm[i]*vn[i];
       m--;
       if (m < 0) m = nrepeat-1;
     }
   } else if (type == UPPER) {
-    m = n = lastindex;
+    m = lastindex;
     for (k = 0; k < nsample; k++) {
+      vm = values[m];
+      ck = corr[k];
       ipair = 0;
-      for (i = 0; i < nvalues; i++)
+      for (i = 0; i < nvalues; i++) {
+        vmi = vm[i];
         for (j = i+1; j < nvalues; j++)
-          corr[k][ipair++] += values[m][i]*values[n][j];
+          ck[ipair++] += vmi*vn[j];
+      }
       m--;
       if (m < 0) m = nrepeat-1;
     }
   } else if (type == LOWER) {
-    m = n = lastindex;
+    m = lastindex;
     for (k = 0; k < nsample; k++) {
+      vm = values[m];
+      ck = corr[k];
       ipair = 0;
-      for (i = 0; i < nvalues; i++)
+      for (i = 0; i < nvalues; i++) {
+        vmi = vm[i];
         for (j = 0; j < i; j++)
-          corr[k][ipair++] += values[m][i]*values[n][j];
+          ck[ipair++] += vmi*vn[j];
+      }
       m--;
       if (m < 0) m = nrepeat-1;
     }
   } else if (type == AUTOUPPER) {
-    m = n = lastindex;
+    m = lastindex;
     for (k = 0; k < nsample; k++) {
+      vm = values[m];
+      ck = corr[k];
       ipair = 0;
-      for (i = 0; i < nvalues; i++)
+      for (i = 0; i < nvalues; i++) {
+        vmi = vm[i];
         for (j = i; j < nvalues; j++)
-          corr[k][ipair++] += values[m][i]*values[n][j];
+          ck[ipair++] += vmi*vn[j];
+      }
       m--;
       if (m < 0) m = nrepeat-1;
     }
   } else if (type == AUTOLOWER) {
-    m = n = lastindex;
+    m = lastindex;
     for (k = 0; k < nsample; k++) {
+      vm = values[m];
+      ck = corr[k];
       ipair = 0;
-      for (i = 0; i < nvalues; i++)
+      for (i = 0; i < nvalues; i++) {
+        vmi = vm[i];
         for (j = 0; j <= i; j++)
-          corr[k][ipair++] += values[m][i]*values[n][j];
+          ck[ipair++] += vmi*vn[j];
+      }
       m--;
       if (m < 0) m = nrepeat-1;
     }
   } else if (type == FULL) {
-    m = n = lastindex;
+    m = lastindex;
     for (k = 0; k < nsample; k++) {
+      vm = values[m];
+      ck = corr[k];
       ipair = 0;
-      for (i = 0; i < nvalues; i++)
+      for (i = 0; i < nvalues; i++) {
+        vmi = vm[i];
         for (j = 0; j < nvalues; j++)
-          corr[k][ipair++] += values[m][i]*values[n][j];
+          ck[ipair++] += vmi*vn[j];
+      }
       m--;
       if (m < 0) m = nrepeat-1;
     }
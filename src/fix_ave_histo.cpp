@@ -915,11 +915,46 @@ void FixAveHisto::bin_one(double value)
 
 void FixAveHisto::bin_vector(int n, double *values, int stride)
 {
+  // keep stats and histogram params in local vars across the loop
+  // so each value only updates memory via its bin count
+
+  double vmin = stats[2];
+  double vmax = stats[3];
+  double ncount = 0.0;
+  double nignore = 0.0;
+  double value;
+  int ibin;
+
   int m = 0;
-  for (int i = 0; i < n; i++) {
-    bin_one(values[m]);
-    m += stride;
+  for (int i = 0; i < n; i++, m += stride) {
+    value = values[m];
+    vmin = MIN(vmin,value);
+    vmax = MAX(vmax,value);
+
+    if (value < lo) {
+      if (beyond == IGNORE) {
+        nignore += 1.0;
+        continue;
+      } else bin[0] += 1.0;
+    } else if (value > hi) {
+      if (beyond == IGNORE) {
+        nignore += 1.0;
+        continue;
+      } else bin[nbins-1] += 1.0;
+    } else {
+      ibin = static_cast<int> ((value-lo)*bininv);
+      ibin = MIN(ibin,nbins-1);
+      if (beyond == EXTRA) ibin++;
+      bin[ibin] += 1.0;
+    }
+
+    ncount += 1.0;
   }
+
+  stats[0] += ncount;
+  stats[1] += nignore;
+  stats[2] = vmin;
+  stats[3] = vmax;
 }
 
 /* ----------------------------------------------------------------------
@@ -932,11 +967,46 @@ void FixAveHisto::bin_atoms(double *values, int stride)
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
 
+  // same local accumulation of stats as in bin_vector()
+
+  double vmin = stats[2];
+  double vmax = stats[3];
+  double ncount = 0.0;
+  double nignore = 0.0;
+  double value;
+  int ibin;
+
   int m = 0;
-  for (int i = 0; i < nlocal; i++) {
-    if (mask[i] & groupbit) bin_one(values[m]);
-    m += stride;
+  for (int i = 0; i < nlocal; i++, m += stride) {
+    if (!(mask[i] & groupbit)) continue;
+    value = values[m];
+    vmin = MIN(vmin,value);
+    vmax = MAX(vmax,value);
+
+    if (value < lo) {
+      if (beyond == IGNORE) {
+        nignore += 1.0;
+        continue;
+      } else bin[0] += 1.0;
+    } else if (value > hi) {
+      if (beyond == IGNORE) {
+        nignore += 1.0;
+        continue;
+      } else bin[nbins-1] += 1.0;
+    } else {
+      ibin = static_cast<int> ((value-lo)*bininv);
+      ibin = MIN(ibin,nbins-1);
+      if (beyond == EXTRA) ibin++;
+      bin[ibin] += 1.0;
+    }
+
+    ncount += 1.0;
   }
+
+  stats[0] += ncount;
+  stats[1] += nignore;
+  stats[2] = vmin;
+  stats[3] = vmax;
 }
 
 /* ----------------------------------------------------------------------
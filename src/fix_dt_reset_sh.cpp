@@ -0,0 +1,260 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "fix_dt_reset_sh.h"
+#include <mpi.h>
+#include <cmath>
+#include <cstring>
+#include "atom.h"
+#include "atom_vec_shperatom.h"
+#include "update.h"
+#include "integrate.h"
+#include "domain.h"
+#include "lattice.h"
+#include "force.h"
+#include "pair.h"
+#include "modify.h"
+#include "fix.h"
+#include "fix_neigh_history.h"
+#include "neigh_list.h"
+#include "output.h"
+#include "dump.h"
+#include "comm.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+#define BIG 1.0e20
+
+/* ---------------------------------------------------------------------- */
+
+FixDtResetSh::FixDtResetSh(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg)
+{
+  if (narg < 8) error->all(FLERR,"Illegal fix dt/reset/sh command");
+
+  // set time_depend, else elapsed time accumulation can be messed up
+
+  time_depend = 1;
+  scalar_flag = 1;
+  global_freq = 1;
+  extscalar = 0;
+  dynamic_group_allow = 1;
+
+  nevery = force->inumeric(FLERR,arg[3]);
+  if (nevery <= 0) error->all(FLERR,"Illegal fix dt/reset/sh command");
+
+  minbound = maxbound = 1;
+  tmin = tmax = 0.0;
+  if (strcmp(arg[4],"NULL") == 0) minbound = 0;
+  else tmin = force->numeric(FLERR,arg[4]);
+  if (strcmp(arg[5],"NULL") == 0) maxbound = 0;
+  else tmax = force->numeric(FLERR,arg[5]);
+  xmax = force->numeric(FLERR,arg[6]);
+  cfrac = force->numeric(FLERR,arg[7]);
+
+  if (minbound && tmin < 0.0)
+    error->all(FLERR,"Illegal fix dt/reset/sh command");
+  if (maxbound && tmax < 0.0)
+    error->all(FLERR,"Illegal fix dt/reset/sh command");
+  if (minbound && maxbound && tmin >= tmax)
+    error->all(FLERR,"Illegal fix dt/reset/sh command");
+  if (xmax <= 0.0) error->all(FLERR,"Illegal fix dt/reset/sh command");
+  if (cfrac <= 0.0 || cfrac > 1.0)
+    error->all(FLERR,"Illegal fix dt/reset/sh command");
+
+  int scaleflag = 1;
+
+  int iarg = 8;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"units") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix dt/reset/sh command");
+      if (strcmp(arg[iarg+1],"box") == 0) scaleflag = 0;
+      else if (strcmp(arg[iarg+1],"lattice") == 0) scaleflag = 1;
+      else error->all(FLERR,"Illegal fix dt/reset/sh command");
+      iarg += 2;
+    } else error->all(FLERR,"Illegal fix dt/reset/sh command");
+  }
+
+  // setup scaling, based on xlattice parameter
+
+  if (scaleflag) xmax *= domain->lattice->xlattice;
+
+  // initializations
+
+  laststep = update->ntimestep;
+  avec = NULL;
+  fix_history = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixDtResetSh::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixDtResetSh::init()
+{
+  avec = (AtomVecShperatom *) atom->style_match("shperatom");
+  if (!avec) avec = (AtomVecShperatom *) atom->style_match("shfewnc");
+  if (!avec)
+    error->all(FLERR,
+               "Fix dt/reset/sh requires atom style shperatom or shfewnc");
+
+  // the contact state is read from the granular history fix
+
+  fix_history = NULL;
+  for (int i = 0; i < modify->nfix; i++)
+    if (strcmp(modify->fix[i]->style,"NEIGH_HISTORY") == 0)
+      fix_history = (FixNeighHistory *) modify->fix[i];
+  if (!fix_history)
+    error->all(FLERR,"Fix dt/reset/sh requires a neighbor history fix");
+
+  // set rRESPA flag
+
+  respaflag = 0;
+  if (strstr(update->integrate_style,"respa")) respaflag = 1;
+
+  // check for DCD or XTC dumps
+
+  for (int i = 0; i < output->ndump; i++)
+    if ((strcmp(output->dump[i]->style,"dcd") == 0 ||
+        strcmp(output->dump[i]->style,"xtc") == 0) && comm->me == 0)
+      error->warning(FLERR,
+                     "Dump dcd/xtc timestamp may be wrong with "
+                     "fix dt/reset/sh");
+
+  ftm2v = force->ftm2v;
+  dt = update->dt;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixDtResetSh::setup(int /*vflag*/)
+{
+  end_of_step();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixDtResetSh::end_of_step()
+{
+  double dtv,dtf,dtsq;
+  double vsq,fsq,massinv;
+  double delx,dely,delz,delr;
+
+  double **v = atom->v;
+  double **f = atom->f;
+  double *rmass = atom->rmass;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  double dtmin = BIG;
+
+  // free-flight bound: max displacement of any atom per step,
+  // identical to the criterion of fix dt/reset
+
+  for (int i = 0; i < nlocal; i++)
+    if (mask[i] & groupbit) {
+      massinv = 1.0/rmass[i];
+      vsq = v[i][0]*v[i][0] + v[i][1]*v[i][1] + v[i][2]*v[i][2];
+      fsq = f[i][0]*f[i][0] + f[i][1]*f[i][1] + f[i][2]*f[i][2];
+      dtv = dtf = BIG;
+      if (vsq > 0.0) dtv = xmax/sqrt(vsq);
+      if (fsq > 0.0) dtf = sqrt(2.0*xmax/(ftm2v*sqrt(fsq)*massinv));
+      dt = MIN(dtv,dtf);
+      dtsq = dt*dt;
+      delx = dt*v[i][0] + 0.5*dtsq*massinv*f[i][0] * ftm2v;
+      dely = dt*v[i][1] + 0.5*dtsq*massinv*f[i][1] * ftm2v;
+      delz = dt*v[i][2] + 0.5*dtsq*massinv*f[i][2] * ftm2v;
+      delr = sqrt(delx*delx + dely*dely + delz*delz);
+      if (delr > xmax) dt *= xmax/delr;
+      dtmin = MIN(dtmin,dt);
+    }
+
+  // contact bound: for each active contact in the history fix,
+  // re-evaluate the overlap with the warm-started surface search and
+  // estimate the instantaneous contact stiffness as force/overlap;
+  // the stability limit of a linear contact spring is 2*sqrt(m/k) and
+  // cfrac is the safety fraction applied to it
+  // a first history value of 0.0 marks a pair that never touched,
+  // ghost forces are not valid after reverse comm so the owned-atom
+  // force magnitude serves as the contact force proxy
+
+  const int nhist = AtomVecShperatom::CONTACT_HISTORY;
+  int **firstflag = fix_history->firstflag;
+  double **firstvalue = fix_history->firstvalue;
+
+  if (fix_history->pair && fix_history->pair->list) {
+    NeighList *list = fix_history->pair->list;
+    int inum = list->inum;
+    int *ilist = list->ilist;
+    int *numneigh = list->numneigh;
+    int **firstneigh = list->firstneigh;
+
+    double cpoint[3],overlap,meff,fmag,keff,dtc;
+
+    for (int ii = 0; ii < inum; ii++) {
+      int i = ilist[ii];
+      if (!(mask[i] & groupbit)) continue;
+      int *jlist = firstneigh[i];
+      int jnum = numneigh[i];
+      for (int jj = 0; jj < jnum; jj++) {
+        if (!firstflag[i][jj]) continue;
+        if (firstvalue[i][nhist*jj] == 0.0) continue;
+        int j = jlist[jj] & NEIGHMASK;
+        if (!avec->contact_search(i,j,&firstvalue[i][nhist*jj],
+                                  cpoint,overlap)) continue;
+        fsq = f[i][0]*f[i][0] + f[i][1]*f[i][1] + f[i][2]*f[i][2];
+        fmag = sqrt(fsq);
+        if (fmag == 0.0) continue;
+        keff = fmag/overlap;
+        meff = rmass[i]*rmass[j]/(rmass[i]+rmass[j]);
+        dtc = cfrac * 2.0*sqrt(meff*ftm2v/keff);
+        dtmin = MIN(dtmin,dtc);
+      }
+    }
+  }
+
+  MPI_Allreduce(&dtmin,&dt,1,MPI_DOUBLE,MPI_MIN,world);
+
+  if (minbound) dt = MAX(dt,tmin);
+  if (maxbound) dt = MIN(dt,tmax);
+
+  // if timestep didn't change, just return
+  // else reset update->dt and other classes that depend on it
+  // rRESPA, pair style, fixes
+
+  if (dt == update->dt) return;
+
+  laststep = update->ntimestep;
+
+  update->update_time();
+  update->dt = dt;
+  if (respaflag) update->integrate->reset_dt();
+  if (force->pair) force->pair->reset_dt();
+  for (int i = 0; i < modify->nfix; i++) modify->fix[i]->reset_dt();
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixDtResetSh::compute_scalar()
+{
+  return (double) laststep;
+}
@@ -0,0 +1,77 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(dt/reset/sh,FixDtResetSh)
+
+#else
+
+#ifndef LMP_FIX_DT_RESET_SH_H
+#define LMP_FIX_DT_RESET_SH_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixDtResetSh : public Fix {
+ public:
+  FixDtResetSh(class LAMMPS *, int, char **);
+  ~FixDtResetSh() {}
+  int setmask();
+  void init();
+  void setup(int);
+  void end_of_step();
+  double compute_scalar();
+
+ private:
+  bigint laststep;
+  int minbound,maxbound;
+  double tmin,tmax,xmax,cfrac;
+  double ftm2v;
+  double dt;
+  int respaflag;
+
+  class AtomVecShperatom *avec;
+  class FixNeighHistory *fix_history;
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Fix dt/reset/sh requires atom style shperatom or shfewnc
+
+Self-explanatory.
+
+E: Fix dt/reset/sh requires a neighbor history fix
+
+The contact state used for the stability estimate is tracked by a
+fix of style NEIGH_HISTORY, which none of the defined pair styles
+or fixes created.
+
+W: Dump dcd/xtc timestamp may be wrong with fix dt/reset/sh
+
+If the fix changes the timestep, the dump dcd file will not
+reflect the change.
+
+*/
@@ -38,13 +38,27 @@ FixExternal::FixExternal(LAMMPS *lmp, int narg, char **arg) :
   thermo_virial = 1;
   extscalar = 1;
 
+  nbatch = 1;
+
   if (strcmp(arg[3],"pf/callback") == 0) {
-    if (narg != 6) error->all(FLERR,"Illegal fix external command");
+    if (narg < 6) error->all(FLERR,"Illegal fix external command");
     mode = PF_CALLBACK;
     ncall = force->inumeric(FLERR,arg[4]);
     napply = force->inumeric(FLERR,arg[5]);
     if (ncall <= 0 || napply <= 0)
       error->all(FLERR,"Illegal fix external command");
+
+    // optional batching of callback invocations
+
+    int iarg = 6;
+    while (iarg < narg) {
+      if (strcmp(arg[iarg],"batch") == 0) {
+        if (iarg+2 > narg) error->all(FLERR,"Illegal fix external command");
+        nbatch = force->inumeric(FLERR,arg[iarg+1]);
+        if (nbatch <= 0) error->all(FLERR,"Illegal fix external command");
+        iarg += 2;
+      } else error->all(FLERR,"Illegal fix external command");
+    }
   } else if (strcmp(arg[3],"pf/array") == 0) {
     if (narg != 5) error->all(FLERR,"Illegal fix external command");
     mode = PF_ARRAY;
@@ -54,6 +68,17 @@ FixExternal::FixExternal(LAMMPS *lmp, int narg, char **arg) :
 
   callback = NULL;
 
+  fexternal_epoch = 0;
+  xstage = NULL;
+  stage_steps = NULL;
+  stage_stride = 0;
+  nstaged = 0;
+  stage_nlocal = -1;
+  if (nbatch > 1) {
+    stage_steps = new bigint[nbatch];
+    for (int i = 0; i < nbatch; i++) stage_steps[i] = -1;
+  }
+
   // perform initial allocation of atom-based array
   // register with Atom class
 
@@ -77,6 +102,8 @@ FixExternal::~FixExternal()
   atom->delete_callback(id,0);
 
   memory->destroy(fexternal);
+  memory->destroy(xstage);
+  delete [] stage_steps;
   delete [] caller_vector;
 }
 
@@ -143,10 +170,22 @@ void FixExternal::post_force(int vflag)
 
   // invoke the callback in driver program
   // it will fill fexternal with forces
-
-  if (mode == PF_CALLBACK && ntimestep % ncall == 0)
-    (this->callback)(ptr_caller,update->ntimestep,
-                     atom->nlocal,atom->tag,atom->x,fexternal);
+  // in batching mode, stage a coordinate snapshot instead and only
+  // cross into the driver once the window holds nbatch snapshots,
+  // passing the staged window in place of the current coords
+
+  if (mode == PF_CALLBACK && ntimestep % ncall == 0) {
+    if (nbatch > 1) {
+      stage_snapshot();
+      if (nstaged == nbatch) {
+        (this->callback)(ptr_caller,update->ntimestep,
+                         atom->nlocal,atom->tag,xstage,fexternal);
+        nstaged = 0;
+      }
+    } else
+      (this->callback)(ptr_caller,update->ntimestep,
+                       atom->nlocal,atom->tag,atom->x,fexternal);
+  }
 
   // add forces from fexternal to atoms in group
 
@@ -164,6 +203,39 @@ void FixExternal::post_force(int vflag)
   }
 }
 
+/* ----------------------------------------------------------------------
+   copy current owned-atom coords into the next slot of the staging
+   window; slots are stage_stride rows apart in xstage and tagged with
+   their timestep in stage_steps
+   if the local atom count changed since the window started, the older
+   snapshots no longer describe the same atoms: restart the window
+------------------------------------------------------------------------- */
+
+void FixExternal::stage_snapshot()
+{
+  int nlocal = atom->nlocal;
+
+  if (nstaged > 0 && nlocal != stage_nlocal) nstaged = 0;
+  stage_nlocal = nlocal;
+
+  if (atom->nmax > stage_stride) {
+    stage_stride = atom->nmax;
+    memory->grow(xstage,nbatch*stage_stride,3,"external:xstage");
+    fexternal_epoch++;
+    nstaged = 0;
+  }
+
+  double **x = atom->x;
+  double **dest = &xstage[nstaged*stage_stride];
+  for (int i = 0; i < nlocal; i++) {
+    dest[i][0] = x[i][0];
+    dest[i][1] = x[i][1];
+    dest[i][2] = x[i][2];
+  }
+  stage_steps[nstaged] = update->ntimestep;
+  nstaged++;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixExternal::min_post_force(int vflag)
@@ -286,6 +358,7 @@ double FixExternal::compute_vector(int n)
 double FixExternal::memory_usage()
 {
   double bytes = 3*atom->nmax * sizeof(double);
+  if (nbatch > 1) bytes += 3.0*nbatch*stage_stride * sizeof(double);
   return bytes;
 }
 
@@ -296,6 +369,7 @@ double FixExternal::memory_usage()
 void FixExternal::grow_arrays(int nmax)
 {
   memory->grow(fexternal,nmax,3,"external:fexternal");
+  fexternal_epoch++;
 }
 
 /* ----------------------------------------------------------------------
@@ -307,6 +381,7 @@ void FixExternal::copy_arrays(int i, int j, int /*delflag*/)
   fexternal[j][0] = fexternal[i][0];
   fexternal[j][1] = fexternal[i][1];
   fexternal[j][2] = fexternal[i][2];
+  fexternal_epoch++;
 }
 
 /* ----------------------------------------------------------------------
@@ -330,6 +405,7 @@ int FixExternal::unpack_exchange(int nlocal, double *buf)
   fexternal[nlocal][0] = buf[0];
   fexternal[nlocal][1] = buf[1];
   fexternal[nlocal][2] = buf[2];
+  fexternal_epoch++;
   return 3;
 }
 
@@ -28,6 +28,22 @@ class FixExternal : public Fix {
  public:
   double **fexternal;
 
+  // persistent coupling buffer contract for drivers:
+  // fexternal is registered once and filled in place; fexternal_epoch
+  // increments whenever the buffer is reallocated or its rows are
+  // reordered/migrated, so a driver only has to re-acquire pointers
+  // or tag maps when the epoch it cached goes stale
+
+  bigint fexternal_epoch;
+
+  // batching mode (pf/callback with batch N > 1): coordinate
+  // snapshots of the staging window, one slot of stage_stride rows
+  // per staged call, with the timestep of each slot in stage_steps
+
+  double **xstage;
+  bigint *stage_steps;
+  int stage_stride;
+
   FixExternal(class LAMMPS *, int, char **);
   ~FixExternal();
   int setmask();
@@ -59,10 +75,13 @@ class FixExternal : public Fix {
 
  private:
   int mode,ncall,napply,eflag_caller;
+  int nbatch,nstaged,stage_nlocal;
   FnPtr callback;
   void *ptr_caller;
   double user_energy;
   double *caller_vector;
+
+  void stage_snapshot();
 };
 
 }
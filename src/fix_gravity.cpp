@@ -48,6 +48,7 @@ FixGravity::FixGravity(LAMMPS *lmp, int narg, char **arg) :
   extscalar = 1;
   respa_level_support = 1;
   ilevel_respa = 0;
+  post_force_overlap = 1;
 
   mstr = vstr = pstr = tstr = xstr = ystr = zstr = NULL;
   mstyle = vstyle = pstyle = tstyle = xstyle = ystyle = zstyle = CONSTANT;
@@ -241,10 +241,16 @@ void FixGroup::set_group()
   int *mask = atom->mask;
   int inflag;
 
+  int *rflags = NULL;
+  if (regionflag) {
+    memory->create(rflags,nlocal,"group:rflags");
+    region->match_all(nlocal,x,rflags);
+  }
+
   for (int i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
       inflag = 1;
-      if (regionflag && !region->match(x[i][0],x[i][1],x[i][2])) inflag = 0;
+      if (regionflag && !rflags[i]) inflag = 0;
       if (varflag && var[i] == 0.0) inflag = 0;
       if (propflag && !typeflag && ivector[i] == 0) inflag = 0;
       if (propflag && typeflag && dvector[i] == 0) inflag = 0;
@@ -254,6 +260,7 @@ void FixGroup::set_group()
     else mask[i] &= gbitinverse;
   }
 
+  if (regionflag) memory->destroy(rflags);
   if (varflag) memory->destroy(var);
 }
 
@@ -35,6 +35,7 @@
 #include "input.h"
 #include "variable.h"
 #include "random_mars.h"
+#include "random_philox.h"
 #include "memory.h"
 #include "error.h"
 #include "group.h"
@@ -54,7 +55,8 @@ enum{CONSTANT,EQUAL,ATOM};
 FixLangevin::FixLangevin(LAMMPS *lmp, int narg, char **arg) :
   Fix(lmp, narg, arg),
   gjfflag(0), gfactor1(NULL), gfactor2(NULL), ratio(NULL), tstr(NULL),
-  flangevin(NULL), tforce(NULL), franprev(NULL), lv(NULL), id_temp(NULL), random(NULL)
+  flangevin(NULL), tforce(NULL), franprev(NULL), lv(NULL), id_temp(NULL),
+  random(NULL), randomc(NULL)
 {
   if (narg < 7) error->all(FLERR,"Illegal fix langevin command");
 
@@ -101,6 +103,7 @@ FixLangevin::FixLangevin(LAMMPS *lmp, int narg, char **arg) :
   tallyflag = 0;
   zeroflag = 0;
   osflag = 0;
+  philoxflag = 0;
 
   int iarg = 7;
   while (iarg < narg) {
@@ -151,9 +154,24 @@ FixLangevin::FixLangevin(LAMMPS *lmp, int narg, char **arg) :
       else if (strcmp(arg[iarg+1],"yes") == 0) zeroflag = 1;
       else error->all(FLERR,"Illegal fix langevin command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"rng") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix langevin command");
+      if (strcmp(arg[iarg+1],"mars") == 0) philoxflag = 0;
+      else if (strcmp(arg[iarg+1],"philox") == 0) philoxflag = 1;
+      else error->all(FLERR,"Illegal fix langevin command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal fix langevin command");
   }
 
+  // counter-based RNG keyed on (seed,tag,step), same on every proc,
+  // thus the thermostat forces do not depend on the decomposition
+
+  if (philoxflag) {
+    if (atom->tag_enable == 0)
+      error->all(FLERR,"Fix langevin rng philox requires atom IDs");
+    randomc = new RanPhilox(lmp,seed);
+  }
+
   // set temperature = NULL, user can override via fix_modify if wants bias
 
   id_temp = NULL;
@@ -200,6 +218,7 @@ FixLangevin::FixLangevin(LAMMPS *lmp, int narg, char **arg) :
 FixLangevin::~FixLangevin()
 {
   delete random;
+  delete randomc;
   delete [] tstr;
   delete [] gfactor1;
   delete [] gfactor2;
@@ -593,7 +612,10 @@ void FixLangevin::post_force_templated()
   double *rmass = atom->rmass;
   int *type = atom->type;
   int *mask = atom->mask;
+  tagint *tag = atom->tag;
   int nlocal = atom->nlocal;
+  bigint ntimestep = update->ntimestep;
+  double rr[3];
 
   // apply damping and thermostat to atoms in group
 
@@ -664,13 +686,25 @@ void FixLangevin::post_force_templated()
       }
 
       if (Tp_GJF) {
-        fran[0] = gamma2*random->gaussian();
-        fran[1] = gamma2*random->gaussian();
-        fran[2] = gamma2*random->gaussian();
+        if (philoxflag) randomc->gaussian3(tag[i],ntimestep,0,rr);
+        else {
+          rr[0] = random->gaussian();
+          rr[1] = random->gaussian();
+          rr[2] = random->gaussian();
+        }
+        fran[0] = gamma2*rr[0];
+        fran[1] = gamma2*rr[1];
+        fran[2] = gamma2*rr[2];
       } else {
-        fran[0] = gamma2*(random->uniform()-0.5);
-        fran[1] = gamma2*(random->uniform()-0.5);
-        fran[2] = gamma2*(random->uniform()-0.5);
+        if (philoxflag) randomc->uniform3(tag[i],ntimestep,0,rr);
+        else {
+          rr[0] = random->uniform();
+          rr[1] = random->uniform();
+          rr[2] = random->uniform();
+        }
+        fran[0] = gamma2*(rr[0]-0.5);
+        fran[1] = gamma2*(rr[1]-0.5);
+        fran[2] = gamma2*(rr[2]-0.5);
       }
 
       if (Tp_BIAS) {
@@ -845,7 +879,7 @@ void FixLangevin::omega_thermostat()
   // gives correct rotational diffusivity behavior
 
   double tendivthree = 10.0/3.0;
-  double tran[3];
+  double tran[3],rr[3];
   double inertiaone;
 
   for (int i = 0; i < nlocal; i++) {
@@ -856,9 +890,15 @@ void FixLangevin::omega_thermostat()
       gamma2 = sqrt(inertiaone) * sqrt(80.0*boltz/t_period/dt/mvv2e) / ftm2v;
       gamma1 *= 1.0/ratio[type[i]];
       gamma2 *= 1.0/sqrt(ratio[type[i]]) * tsqrt;
-      tran[0] = gamma2*(random->uniform()-0.5);
-      tran[1] = gamma2*(random->uniform()-0.5);
-      tran[2] = gamma2*(random->uniform()-0.5);
+      if (philoxflag) randomc->uniform3(atom->tag[i],update->ntimestep,1,rr);
+      else {
+        rr[0] = random->uniform();
+        rr[1] = random->uniform();
+        rr[2] = random->uniform();
+      }
+      tran[0] = gamma2*(rr[0]-0.5);
+      tran[1] = gamma2*(rr[1]-0.5);
+      tran[2] = gamma2*(rr[2]-0.5);
       torque[i][0] += gamma1*omega[i][0] + tran[0];
       torque[i][1] += gamma1*omega[i][1] + tran[1];
       torque[i][2] += gamma1*omega[i][2] + tran[2];
@@ -893,7 +933,7 @@ void FixLangevin::angmom_thermostat()
   // gives correct rotational diffusivity behavior if (nearly) spherical
   // any value will be incorrect for rotational diffusivity if aspherical
 
-  double inertia[3],omega[3],tran[3];
+  double inertia[3],omega[3],tran[3],rr[3];
   double *shape,*quat;
 
   for (int i = 0; i < nlocal; i++) {
@@ -910,9 +950,15 @@ void FixLangevin::angmom_thermostat()
       gamma2 = sqrt(ascale*24.0*boltz/t_period/dt/mvv2e) / ftm2v;
       gamma1 *= 1.0/ratio[type[i]];
       gamma2 *= 1.0/sqrt(ratio[type[i]]) * tsqrt;
-      tran[0] = sqrt(inertia[0])*gamma2*(random->uniform()-0.5);
-      tran[1] = sqrt(inertia[1])*gamma2*(random->uniform()-0.5);
-      tran[2] = sqrt(inertia[2])*gamma2*(random->uniform()-0.5);
+      if (philoxflag) randomc->uniform3(atom->tag[i],update->ntimestep,2,rr);
+      else {
+        rr[0] = random->uniform();
+        rr[1] = random->uniform();
+        rr[2] = random->uniform();
+      }
+      tran[0] = sqrt(inertia[0])*gamma2*(rr[0]-0.5);
+      tran[1] = sqrt(inertia[1])*gamma2*(rr[1]-0.5);
+      tran[2] = sqrt(inertia[2])*gamma2*(rr[2]-0.5);
       torque[i][0] += inertia[0]*gamma1*omega[0] + tran[0];
       torque[i][1] += inertia[1]*gamma1*omega[1] + tran[1];
       torque[i][2] += inertia[2]*gamma1*omega[2] + tran[2];
@@ -48,6 +48,7 @@ class FixLangevin : public Fix {
 
  protected:
   int gjfflag,nvalues,osflag,oflag,tallyflag,zeroflag,tbiasflag;
+  int philoxflag;
   int flangevin_allocated;
   double ascale;
   double t_start,t_stop,t_period,t_target;
@@ -71,6 +72,7 @@ class FixLangevin : public Fix {
 
   int nlevels_respa;
   class RanMars *random;
+  class RanPhilox *randomc;
   int seed;
 
   template < int Tp_TSTYLEATOM, int Tp_GJF, int Tp_TALLY,
@@ -571,7 +571,7 @@ void FixNeighHistory::min_pre_exchange()
 
 void FixNeighHistory::post_neighbor()
 {
-  int i,j,m,ii,jj,nn,np,inum,jnum,rflag;
+  int i,j,m,ii,jj,nn,np,mcur,mmatch,inum,jnum,rflag;
   tagint jtag;
   int *ilist,*jlist,*numneigh,**firstneigh;
   int *allflags;
@@ -618,6 +618,7 @@ void FixNeighHistory::post_neighbor()
     firstvalue[i] = allvalues = dpage_neigh->get(jnum*dnum);
     np = npartner[i];
     nn = 0;
+    mcur = 0;
 
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
@@ -628,14 +629,29 @@ void FixNeighHistory::post_neighbor()
       // rflag = 1 if r < radsum in npair_size() method
       // preserve neigh history info if tag[j] is in old-neigh partner list
       // this test could be more geometrically precise for two sphere/line/tri
+      // partners were stored in old-list order, which the new list mostly
+      //   preserves, so resume the scan at the last match instead of
+      //   the list start, with the full scan as fallback
 
       if (rflag) {
         jtag = tag[j];
-        for (m = 0; m < np; m++)
-          if (partner[i][m] == jtag) break;
-        if (m < np) {
+        mmatch = np;
+        for (m = mcur; m < np; m++)
+          if (partner[i][m] == jtag) {
+            mmatch = m;
+            break;
+          }
+        if (mmatch == np)
+          for (m = 0; m < mcur; m++)
+            if (partner[i][m] == jtag) {
+              mmatch = m;
+              break;
+            }
+        if (mmatch < np) {
           allflags[jj] = 1;
-          memcpy(&allvalues[nn],&valuepartner[i][dnum*m],dnumbytes);
+          memcpy(&allvalues[nn],&valuepartner[i][dnum*mmatch],dnumbytes);
+          mcur = mmatch + 1;
+          if (mcur == np) mcur = 0;
         } else {
           allflags[jj] = 0;
           memcpy(&allvalues[nn],zeroes,dnumbytes);
@@ -1962,46 +1962,49 @@ void FixNH::nhc_press_integrate()
 void FixNH::nh_v_press()
 {
   double factor[3];
-  double **v = atom->v;
-  int *mask = atom->mask;
-  int nlocal = atom->nlocal;
-  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
   factor[0] = exp(-dt4*(omega_dot[0]+mtk_term2));
   factor[1] = exp(-dt4*(omega_dot[1]+mtk_term2));
   factor[2] = exp(-dt4*(omega_dot[2]+mtk_term2));
 
+  // dispatch once to a branch-free per-atom kernel
+
   if (which == NOBIAS) {
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        v[i][0] *= factor[0];
-        v[i][1] *= factor[1];
-        v[i][2] *= factor[2];
-        if (pstyle == TRICLINIC) {
-          v[i][0] += -dthalf*(v[i][1]*omega_dot[5] + v[i][2]*omega_dot[4]);
-          v[i][1] += -dthalf*v[i][2]*omega_dot[3];
-        }
-        v[i][0] *= factor[0];
-        v[i][1] *= factor[1];
-        v[i][2] *= factor[2];
-      }
-    }
+    if (pstyle == TRICLINIC) nh_v_press_kernel<1,0>(factor);
+    else nh_v_press_kernel<0,0>(factor);
   } else if (which == BIAS) {
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        temperature->remove_bias(i,v[i]);
-        v[i][0] *= factor[0];
-        v[i][1] *= factor[1];
-        v[i][2] *= factor[2];
-        if (pstyle == TRICLINIC) {
-          v[i][0] += -dthalf*(v[i][1]*omega_dot[5] + v[i][2]*omega_dot[4]);
-          v[i][1] += -dthalf*v[i][2]*omega_dot[3];
-        }
-        v[i][0] *= factor[0];
-        v[i][1] *= factor[1];
-        v[i][2] *= factor[2];
-        temperature->restore_bias(i,v[i]);
+    if (pstyle == TRICLINIC) nh_v_press_kernel<1,1>(factor);
+    else nh_v_press_kernel<0,1>(factor);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   per-atom loop of nh_v_press() with the triclinic coupling and bias
+   handling resolved at compile time
+------------------------------------------------------------------------- */
+
+template <int TRICLINIC, int BIAS>
+void FixNH::nh_v_press_kernel(const double *factor)
+{
+  double **v = atom->v;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (mask[i] & groupbit) {
+      if (BIAS) temperature->remove_bias(i,v[i]);
+      v[i][0] *= factor[0];
+      v[i][1] *= factor[1];
+      v[i][2] *= factor[2];
+      if (TRICLINIC) {
+        v[i][0] += -dthalf*(v[i][1]*omega_dot[5] + v[i][2]*omega_dot[4]);
+        v[i][1] += -dthalf*v[i][2]*omega_dot[3];
       }
+      v[i][0] *= factor[0];
+      v[i][1] *= factor[1];
+      v[i][2] *= factor[2];
+      if (BIAS) temperature->restore_bias(i,v[i]);
     }
   }
 }
@@ -134,6 +134,13 @@ class FixNH : public Fix {
   virtual void nve_v();
   virtual void nh_v_press();
   virtual void nh_v_temp();
+
+  // per-atom kernel of nh_v_press(), instantiated for each combination
+  // of triclinic cell coupling and temperature bias so the per-atom
+  // loop carries no runtime branches; nh_v_press() picks one at the
+  // call site
+
+  template <int TRICLINIC, int BIAS> void nh_v_press_kernel(const double *);
   virtual void compute_temp_target();
   virtual int size_restart_global();
 
@@ -77,7 +77,22 @@ void FixNVE::initial_integrate(int /*vflag*/)
   int nlocal = atom->nlocal;
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
-  if (rmass) {
+  // dense fast path for group all with a single per-type mass
+  // dtfm is then one constant, so update the flat views of x/v/f
+  //   with one unit-stride vectorizable loop and no mask branch
+
+  if (igroup == 0 && atom->ntypes == 1 && !rmass) {
+    double *xf = atom->x_flat();
+    double *vf = atom->v_flat();
+    double *ff = atom->f_flat();
+    dtfm = dtf / mass[1];
+    int n3 = 3*nlocal;
+    for (int i = 0; i < n3; i++) {
+      vf[i] += dtfm * ff[i];
+      xf[i] += dtv * vf[i];
+    }
+
+  } else if (rmass) {
     for (int i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
         dtfm = dtf / rmass[i];
@@ -120,7 +135,16 @@ void FixNVE::final_integrate()
   int nlocal = atom->nlocal;
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
-  if (rmass) {
+  // dense fast path, same rationale as in initial_integrate()
+
+  if (igroup == 0 && atom->ntypes == 1 && !rmass) {
+    double *vf = atom->v_flat();
+    double *ff = atom->f_flat();
+    dtfm = dtf / mass[1];
+    int n3 = 3*nlocal;
+    for (int i = 0; i < n3; i++) vf[i] += dtfm * ff[i];
+
+  } else if (rmass) {
     for (int i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
         dtfm = dtf / rmass[i];
@@ -20,6 +20,7 @@
 #include "math_extra.h"
 #include "atom.h"
 #include "atom_vec_ellipsoid.h"
+#include "atom_vec_shperatom.h"
 #include "error.h"
 
 using namespace LAMMPS_NS;
@@ -36,9 +37,11 @@ FixNVESh::FixNVESh(LAMMPS *lmp, int narg, char **arg) :
 
 void FixNVESh::init()
 {
-  avec = (AtomVecShfewnc *) atom->style_match("shperatom");
+  avec = (AtomVecShperatom *) atom->style_match("shperatom");
   if (!avec)
-    error->all(FLERR,"Fix nve/sh requires atom style shperatom");
+    avec = (AtomVecShperatom *) atom->style_match("shfewnc");
+  if (!avec)
+    error->all(FLERR,"Fix nve/sh requires atom style shperatom or shfewnc");
 
   // check that all particles are finite-size ellipsoids
   // no point particles allowed, spherical is OK
@@ -60,7 +63,6 @@ void FixNVESh::init()
 void FixNVESh::initial_integrate(int /*vflag*/)
 {
   double dtfm;
-  double omega[3];
 
   double **quat = atom->quat;
   double **inertia = atom->inertia;
@@ -78,6 +80,14 @@ void FixNVESh::initial_integrate(int /*vflag*/)
 
   dtq = 0.5 * dtv;
 
+  // quaternion updates are batched: pointers into the per-atom arrays
+  // are gathered and the block is integrated by one richardson_batch call
+
+  int nbatch = 0;
+  double *qbatch[MathExtra::RICHARDSON_BATCH];
+  double *mbatch[MathExtra::RICHARDSON_BATCH];
+  double *ibatch[MathExtra::RICHARDSON_BATCH];
+
   for (int i = 0; i < nlocal; i++)
     if (mask[i] & groupbit) {
       dtfm = dtf / rmass[i];
@@ -96,11 +106,19 @@ void FixNVESh::initial_integrate(int /*vflag*/)
 
       // compute omega at 1/2 step from angmom at 1/2 step and current q
       // update quaternion a full step via Richardson iteration
-      // returns new normalized quaternion
-
-      MathExtra::mq_to_omega(angmom[i],quat[i],inertia[i],omega);
-      MathExtra::richardson(quat[i],angmom[i],omega,inertia[i],dtq);
+      // stores new normalized quaternion, one block of atoms at a time
+
+      qbatch[nbatch] = quat[i];
+      mbatch[nbatch] = angmom[i];
+      ibatch[nbatch] = inertia[i];
+      nbatch++;
+      if (nbatch == MathExtra::RICHARDSON_BATCH) {
+        MathExtra::richardson_batch(nbatch,qbatch,mbatch,ibatch,dtq);
+        nbatch = 0;
+      }
     }
+
+  if (nbatch) MathExtra::richardson_batch(nbatch,qbatch,mbatch,ibatch,dtq);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -24,7 +24,8 @@ using namespace FixConst;
 
 FixRespa::FixRespa(LAMMPS *lmp, int narg, char **arg) :
   Fix(lmp, narg, arg),
-  store_torque(0), f_level(NULL), t_level(NULL)
+  store_torque(0), store_kspace(0), f_level(NULL), t_level(NULL),
+  f_kspace(NULL)
 {
   // nlevels = # of rRESPA levels
 
@@ -32,9 +33,12 @@ FixRespa::FixRespa(LAMMPS *lmp, int narg, char **arg) :
 
   // optional arguments
   store_torque = 0;
+  store_kspace = 0;
   for (int iarg=4; iarg < narg; ++iarg) {
     if (strcmp(arg[iarg],"torque") == 0)
        store_torque = 1;
+    if (strcmp(arg[iarg],"kspace") == 0)
+       store_kspace = 1;
   }
 
   // perform initial allocation of atom-based arrays
@@ -42,6 +46,7 @@ FixRespa::FixRespa(LAMMPS *lmp, int narg, char **arg) :
 
   f_level = NULL;
   t_level = NULL;
+  f_kspace = NULL;
   grow_arrays(atom->nmax);
   atom->add_callback(0);
 }
@@ -58,6 +63,7 @@ FixRespa::~FixRespa()
 
   memory->destroy(f_level);
   if (store_torque) memory->destroy(t_level);
+  if (store_kspace) memory->destroy(f_kspace);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -75,6 +81,7 @@ double FixRespa::memory_usage()
 {
   double bytes = atom->nmax*nlevels*3 * sizeof(double);
   if (store_torque) bytes += atom->nmax*nlevels*3 * sizeof(double);
+  if (store_kspace) bytes += atom->nmax*3 * sizeof(double);
   return bytes;
 }
 
@@ -86,6 +93,7 @@ void FixRespa::grow_arrays(int nmax)
 {
   memory->grow(f_level,nmax,nlevels,3,"fix_respa:f_level");
   if (store_torque) memory->grow(t_level,nmax,nlevels,3,"fix_respa:t_level");
+  if (store_kspace) memory->grow(f_kspace,nmax,3,"fix_respa:f_kspace");
 }
 
 /* ----------------------------------------------------------------------
@@ -106,6 +114,11 @@ void FixRespa::copy_arrays(int i, int j, int /*delflag*/)
       t_level[j][k][2] = t_level[i][k][2];
     }
   }
+  if (store_kspace) {
+    f_kspace[j][0] = f_kspace[i][0];
+    f_kspace[j][1] = f_kspace[i][1];
+    f_kspace[j][2] = f_kspace[i][2];
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -127,6 +140,11 @@ int FixRespa::pack_exchange(int i, double *buf)
       buf[m++] = t_level[i][k][2];
     }
   }
+  if (store_kspace) {
+    buf[m++] = f_kspace[i][0];
+    buf[m++] = f_kspace[i][1];
+    buf[m++] = f_kspace[i][2];
+  }
   return m;
 }
 
@@ -149,5 +167,10 @@ int FixRespa::unpack_exchange(int nlocal, double *buf)
       t_level[nlocal][k][2] = buf[m++];
     }
   }
+  if (store_kspace) {
+    f_kspace[nlocal][0] = buf[m++];
+    f_kspace[nlocal][1] = buf[m++];
+    f_kspace[nlocal][2] = buf[m++];
+  }
   return m;
 }
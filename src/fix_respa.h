@@ -44,8 +44,10 @@ class FixRespa : public Fix {
  private:
   int nlevels;
   int store_torque;  // 1 if torques should be stored in addition to forces
+  int store_kspace;  // 1 if held kspace forces should be stored
   double ***f_level; // force at each rRESPA level
   double ***t_level; // torque at each rRESPA level
+  double **f_kspace; // kspace force held between evaluations
 };
 
 }
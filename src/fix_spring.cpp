@@ -205,32 +205,33 @@ void FixSpring::spring_tether()
   }
 
   // apply restoring force to atoms in group
+  // iterate cached member list instead of scanning all nlocal atoms
 
   double **f = atom->f;
-  int *mask = atom->mask;
   int *type = atom->type;
   double *mass = atom->mass;
   double *rmass = atom->rmass;
-  int nlocal = atom->nlocal;
 
   double massone;
+  int i,m,nmember;
+  int *mlist = group->member_list(igroup,nmember);
 
   if (rmass) {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        massone = rmass[i];
-        f[i][0] -= fx*massone;
-        f[i][1] -= fy*massone;
-        f[i][2] -= fz*massone;
-      }
+    for (m = 0; m < nmember; m++) {
+      i = mlist[m];
+      massone = rmass[i];
+      f[i][0] -= fx*massone;
+      f[i][1] -= fy*massone;
+      f[i][2] -= fz*massone;
+    }
   } else {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        massone = mass[type[i]];
-        f[i][0] -= fx*massone;
-        f[i][1] -= fy*massone;
-        f[i][2] -= fz*massone;
-      }
+    for (m = 0; m < nmember; m++) {
+      i = mlist[m];
+      massone = mass[type[i]];
+      f[i][0] -= fx*massone;
+      f[i][1] -= fy*massone;
+      f[i][2] -= fz*massone;
+    }
   }
 }
 
@@ -286,47 +287,49 @@ void FixSpring::spring_couple()
     fz /= masstotal;
   } else fx = fy = fz = 0.0;
 
-  // apply restoring force to atoms in group
+  // apply restoring force to atoms in each group
   // f = -k*(r-r0)*mass/masstotal
+  // iterate cached member lists instead of scanning all nlocal atoms
 
   double **f = atom->f;
-  int *mask = atom->mask;
   int *type = atom->type;
   double *mass = atom->mass;
   double *rmass = atom->rmass;
-  int nlocal = atom->nlocal;
 
   double massone;
+  int i,m,nmember,nmember2;
+  int *mlist = group->member_list(igroup,nmember);
+  int *mlist2 = group->member_list(igroup2,nmember2);
 
   if (rmass) {
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        massone = rmass[i];
-        f[i][0] += fx*massone;
-        f[i][1] += fy*massone;
-        f[i][2] += fz*massone;
-      }
-      if (mask[i] & group2bit) {
-        massone = rmass[i];
-        f[i][0] -= fx2*massone;
-        f[i][1] -= fy2*massone;
-        f[i][2] -= fz2*massone;
-      }
+    for (m = 0; m < nmember; m++) {
+      i = mlist[m];
+      massone = rmass[i];
+      f[i][0] += fx*massone;
+      f[i][1] += fy*massone;
+      f[i][2] += fz*massone;
+    }
+    for (m = 0; m < nmember2; m++) {
+      i = mlist2[m];
+      massone = rmass[i];
+      f[i][0] -= fx2*massone;
+      f[i][1] -= fy2*massone;
+      f[i][2] -= fz2*massone;
     }
   } else {
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        massone = mass[type[i]];
-        f[i][0] += fx*massone;
-        f[i][1] += fy*massone;
-        f[i][2] += fz*massone;
-      }
-      if (mask[i] & group2bit) {
-        massone = mass[type[i]];
-        f[i][0] -= fx2*massone;
-        f[i][1] -= fy2*massone;
-        f[i][2] -= fz2*massone;
-      }
+    for (m = 0; m < nmember; m++) {
+      i = mlist[m];
+      massone = mass[type[i]];
+      f[i][0] += fx*massone;
+      f[i][1] += fy*massone;
+      f[i][2] += fz*massone;
+    }
+    for (m = 0; m < nmember2; m++) {
+      i = mlist2[m];
+      massone = mass[type[i]];
+      f[i][0] -= fx2*massone;
+      f[i][1] -= fy2*massone;
+      f[i][2] -= fz2*massone;
     }
   }
 }
@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "fix_tune_neigh.h"
+#include <cmath>
+#include "comm.h"
+#include "update.h"
+#include "force.h"
+#include "neighbor.h"
+#include "timer.h"
+#include "error.h"
+#include "utils.h"
+#include "fmt/format.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+enum{TUNE_SKIN,TUNE_DELAY,DONE};
+
+// stop refining the skin once the trial step drops below 2 percent
+
+#define FACTOR0 1.25
+#define FACTOR_MIN 1.02
+
+// candidate delay settings swept after the skin has converged
+
+static const int delay_cand[] = {0,2,5,10,20};
+static const int ndelay_cand = sizeof(delay_cand)/sizeof(int);
+
+/* ---------------------------------------------------------------------- */
+
+FixTuneNeigh::FixTuneNeigh(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg)
+{
+  if (narg != 4) error->all(FLERR,"Illegal fix tune/neigh command");
+
+  nevery = force->inumeric(FLERR,arg[3]);
+  if (nevery <= 0) error->all(FLERR,"Illegal fix tune/neigh command");
+
+  global_freq = 1;
+  firststep = 0;
+  last_step = 0;
+  last_spcpu = 0.0;
+
+  phase = TUNE_SKIN;
+  have_baseline = 0;
+  best_time = 0.0;
+  factor = FACTOR0;
+  dir = 1;
+  delay_idx = 0;
+  best_delay = 0;
+
+  // set up reneighboring so adjustments happen right before a rebuild
+
+  force_reneighbor = 1;
+  next_reneighbor = update->ntimestep + nevery;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixTuneNeigh::setmask()
+{
+  int mask = 0;
+  mask |= PRE_EXCHANGE;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixTuneNeigh::init()
+{
+  if (neighbor->dist_check == 0)
+    error->all(FLERR,"Cannot use fix tune/neigh with neigh_modify check no");
+
+  skin0 = best_skin = neighbor->skin;
+}
+
+/* ----------------------------------------------------------------------
+   measure throughput of the interval that just completed and adjust
+   the neighbor parameters for the next one
+------------------------------------------------------------------------- */
+
+void FixTuneNeigh::pre_exchange()
+{
+  if (next_reneighbor != update->ntimestep) return;
+  next_reneighbor = update->ntimestep + nevery;
+
+  if (phase == DONE) return;
+
+  double time = get_timing_info();
+  if (time < 0.0) return;
+
+  if (phase == TUNE_SKIN) adjust_skin(time);
+  else if (phase == TUNE_DELAY) adjust_delay(time);
+}
+
+/* ----------------------------------------------------------------------
+   return CPU time per step over the interval since the last call
+   returns -1.0 on the first call, which only primes the counters
+------------------------------------------------------------------------- */
+
+double FixTuneNeigh::get_timing_info()
+{
+  double dvalue;
+  double new_cpu = timer->elapsed(Timer::TOTAL);
+  int new_step = update->ntimestep;
+
+  if (firststep == 0) {
+    firststep = 1;
+    dvalue = -1.0;
+  } else {
+    double cpu_diff = new_cpu - last_spcpu;
+    int step_diff = new_step - last_step;
+    if (step_diff > 0) dvalue = cpu_diff/step_diff;
+    else dvalue = 0.0;
+  }
+
+  last_step = new_step;
+  last_spcpu = new_cpu;
+
+  return dvalue;
+}
+
+/* ----------------------------------------------------------------------
+   apply a new skin distance and re-derive everything that depends on it
+------------------------------------------------------------------------- */
+
+void FixTuneNeigh::set_skin(double skin)
+{
+  neighbor->skin = skin;
+
+  // neighbor cutoffs, then ghost cutoffs and comm pattern
+
+  neighbor->init();
+  comm->init();
+  comm->setup();
+
+  if (comm->me == 0)
+    utils::logmesg(lmp,fmt::format("fix tune/neigh: trying skin {:.4}\n",
+                                   skin));
+}
+
+/* ----------------------------------------------------------------------
+   hill climb on the skin distance with a shrinking multiplicative step
+   time is the CPU cost per step of the setting currently in effect
+------------------------------------------------------------------------- */
+
+void FixTuneNeigh::adjust_skin(double time)
+{
+  // first interval times the user's setting and seeds the climb
+
+  if (!have_baseline) {
+    have_baseline = 1;
+    best_time = time;
+    best_skin = neighbor->skin;
+    set_skin(best_skin*factor);
+    return;
+  }
+
+  if (time < best_time) {
+    best_time = time;
+    best_skin = neighbor->skin;
+  } else {
+    dir = -dir;
+    factor = sqrt(factor);
+  }
+
+  // keep the skin within a sane range around the starting value
+
+  double next = best_skin * pow(factor,(double) dir);
+  next = MAX(next,0.1*skin0);
+  next = MIN(next,4.0*skin0);
+
+  if (factor < FACTOR_MIN) {
+    set_skin(best_skin);
+    if (comm->me == 0)
+      utils::logmesg(lmp,fmt::format("fix tune/neigh: settled on skin "
+                                     "{:.4}\n",best_skin));
+    phase = TUNE_DELAY;
+    delay_idx = 0;
+    best_delay = neighbor->delay;
+    neighbor->delay = delay_cand[0];
+    return;
+  }
+
+  set_skin(next);
+}
+
+/* ----------------------------------------------------------------------
+   sweep the candidate delay settings and keep the fastest
+------------------------------------------------------------------------- */
+
+void FixTuneNeigh::adjust_delay(double time)
+{
+  if (time < best_time) {
+    best_time = time;
+    best_delay = neighbor->delay;
+  }
+
+  delay_idx++;
+  if (delay_idx < ndelay_cand) {
+    neighbor->delay = delay_cand[delay_idx];
+    return;
+  }
+
+  neighbor->delay = best_delay;
+  phase = DONE;
+  if (comm->me == 0)
+    utils::logmesg(lmp,fmt::format("fix tune/neigh: settled on skin {:.4} "
+                                   "delay {}\n",best_skin,best_delay));
+}
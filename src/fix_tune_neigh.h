@@ -0,0 +1,78 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(tune/neigh,FixTuneNeigh)
+
+#else
+
+#ifndef LMP_FIX_TUNE_NEIGH_H
+#define LMP_FIX_TUNE_NEIGH_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixTuneNeigh : public Fix {
+ public:
+  FixTuneNeigh(class LAMMPS *, int, char **);
+  ~FixTuneNeigh() {}
+  int setmask();
+  void init();
+  void pre_exchange();
+
+ private:
+  int nevery;
+
+  int last_step;      // previous timestep when timing info was collected
+  double last_spcpu;  // old elapsed CPU time value
+  int firststep;      // 0 if this is the first time timing info is collected
+
+  int phase;          // which parameter is being tuned
+  int have_baseline;  // 1 once the first measurement interval completed
+
+  double skin0;       // skin at start of tuning
+  double best_time;   // best CPU time per step seen so far
+  double best_skin;   // skin that produced best_time
+  double factor;      // current multiplicative step for skin trials
+  int dir;            // +1/-1 = direction of next skin trial
+
+  int delay_idx;      // index of delay candidate being timed
+  int best_delay;     // delay that produced best_time
+
+  double get_timing_info();
+  void set_skin(double);
+  void adjust_skin(double);
+  void adjust_delay(double);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a command-line
+option when running LAMMPS to see the offending line.
+
+E: Cannot use fix tune/neigh with neigh_modify check no
+
+Tuning the skin distance requires distance checking, otherwise the
+rebuild frequency does not respond to the skin value.
+
+*/
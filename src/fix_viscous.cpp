@@ -29,6 +29,7 @@ FixViscous::FixViscous(LAMMPS *lmp, int narg, char **arg) :
   gamma(NULL)
 {
   dynamic_group_allow = 1;
+  post_force_overlap = 1;
 
   if (narg < 4) error->all(FLERR,"Illegal fix viscous command");
 
@@ -81,11 +81,22 @@ Force::Force(LAMMPS *lmp) : Pointers(lmp)
   strcpy(kspace_style,str);
 
   pair_restart = NULL;
-  create_factories();
+
+  // style maps are built lazily by create_factories() on first use,
+  // so booting and tearing down an instance never touches them
+
+  pair_map = NULL;
+  bond_map = NULL;
+  angle_map = NULL;
+  dihedral_map = NULL;
+  improper_map = NULL;
+  kspace_map = NULL;
 }
 
 void _noopt Force::create_factories()
 {
+  if (pair_map) return;
+
   // fill pair map with pair styles listed in style_pair.h
 
   pair_map = new PairCreatorMap();
@@ -254,6 +265,8 @@ void Force::create_pair(const std::string &style, int trysuffix)
 
 Pair *Force::new_pair(const std::string &style, int trysuffix, int &sflag)
 {
+  create_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->suffix) {
       sflag = 1;
@@ -364,6 +377,8 @@ void Force::create_bond(const std::string &style, int trysuffix)
 
 Bond *Force::new_bond(const std::string &style, int trysuffix, int &sflag)
 {
+  create_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->suffix) {
       sflag = 1;
@@ -441,6 +456,8 @@ void Force::create_angle(const std::string &style, int trysuffix)
 
 Angle *Force::new_angle(const std::string &style, int trysuffix, int &sflag)
 {
+  create_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->suffix) {
       sflag = 1;
@@ -518,6 +535,8 @@ void Force::create_dihedral(const std::string &style, int trysuffix)
 
 Dihedral *Force::new_dihedral(const std::string &style, int trysuffix, int &sflag)
 {
+  create_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->suffix) {
       sflag = 1;
@@ -595,6 +614,8 @@ void Force::create_improper(const std::string &style, int trysuffix)
 
 Improper *Force::new_improper(const std::string &style, int trysuffix, int &sflag)
 {
+  create_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->suffix) {
       sflag = 1;
@@ -676,6 +697,8 @@ void Force::create_kspace(const std::string &style, int trysuffix)
 
 KSpace *Force::new_kspace(const std::string &style, int trysuffix, int &sflag)
 {
+  create_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->suffix) {
       sflag = 1;
@@ -138,9 +138,9 @@ class Force : protected Pointers {
   FILE *open_potential(const char *, int *auto_convert = nullptr);
 
   bigint memory_usage();
+  void create_factories();
 
  private:
-  void create_factories();
   template <typename T> static Pair *pair_creator(LAMMPS *);
   template <typename T> static Bond *bond_creator(LAMMPS *);
   template <typename T> static Angle *angle_creator(LAMMPS *);
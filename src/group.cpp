@@ -19,6 +19,8 @@
 #include <utility>
 #include "domain.h"
 #include "atom.h"
+#include "update.h"
+#include "neighbor.h"
 #include "force.h"
 #include "comm.h"
 #include "region.h"
@@ -65,6 +67,20 @@ Group::Group(LAMMPS *lmp) : Pointers(lmp)
   for (int i = 0; i < MAX_GROUP; i++) inversemask[i] = bitmask[i] ^ ~0;
   for (int i = 0; i < MAX_GROUP; i++) dynamic[i] = 0;
 
+  cachelist = new int*[MAX_GROUP];
+  cachenum = new int[MAX_GROUP];
+  cachemax = new int[MAX_GROUP];
+  cachestep = new bigint[MAX_GROUP];
+  cacheago = new int[MAX_GROUP];
+  cachenlocal = new int[MAX_GROUP];
+
+  for (int i = 0; i < MAX_GROUP; i++) {
+    cachelist[i] = NULL;
+    cachenum[i] = cachemax[i] = 0;
+    cachestep[i] = -1;
+    cacheago[i] = cachenlocal[i] = 0;
+  }
+
   // create "all" group
 
   char *str = (char *) "all";
@@ -85,6 +101,14 @@ Group::~Group()
   delete [] bitmask;
   delete [] inversemask;
   delete [] dynamic;
+
+  for (int i = 0; i < MAX_GROUP; i++) memory->destroy(cachelist[i]);
+  delete [] cachelist;
+  delete [] cachenum;
+  delete [] cachemax;
+  delete [] cachestep;
+  delete [] cacheago;
+  delete [] cachenlocal;
 }
 
 /* ----------------------------------------------------------------------
@@ -99,6 +123,10 @@ void Group::assign(int narg, char **arg)
     error->all(FLERR,"Group command before simulation box is defined");
   if (narg < 2) error->all(FLERR,"Illegal group command");
 
+  // any group command can change membership
+
+  cache_clear();
+
   // delete the group if not being used elsewhere
   // clear mask of each atom assigned to this group
 
@@ -181,9 +209,14 @@ void Group::assign(int narg, char **arg)
     domain->regions[iregion]->init();
     domain->regions[iregion]->prematch();
 
+    int *rflags;
+    memory->create(rflags,nlocal,"group:rflags");
+    domain->regions[iregion]->match_all(nlocal,x,rflags);
+
     for (i = 0; i < nlocal; i++)
-      if (domain->regions[iregion]->match(x[i][0],x[i][1],x[i][2]))
-        mask[i] |= bit;
+      if (rflags[i]) mask[i] |= bit;
+
+    memory->destroy(rflags);
 
   // create an empty group
 
@@ -556,6 +589,8 @@ void Group::create(char *name, int *flag)
 {
   int i;
 
+  cache_clear();
+
   // find group in existing list
   // add a new group if igroup = -1
 
@@ -580,6 +615,61 @@ void Group::create(char *name, int *flag)
     if (flag[i]) mask[i] |= bit;
 }
 
+/* ----------------------------------------------------------------------
+   return cached list of local indices of atoms in igroup, set n to length
+   lets a fix acting on a small group iterate its members directly
+     instead of scanning all nlocal atoms every invocation
+   list is lazily rebuilt when atoms may have been added, deleted, or
+     reordered: a cache is only reused on the timestep it was built on
+     with no reneighboring in between, detected via neighbor->ago
+   dynamic groups are never cached, since fix GROUP can change their
+     membership w/out any reordering
+   returned ptr is valid until the next exchange or group change
+------------------------------------------------------------------------- */
+
+int *Group::member_list(int igroup, int &n)
+{
+  int nlocal = atom->nlocal;
+
+  if (!dynamic[igroup] && cachestep[igroup] == update->ntimestep &&
+      cacheago[igroup] == neighbor->ago && cachenlocal[igroup] == nlocal) {
+    n = cachenum[igroup];
+    return cachelist[igroup];
+  }
+
+  if (nlocal > cachemax[igroup]) {
+    cachemax[igroup] = atom->nmax;
+    memory->destroy(cachelist[igroup]);
+    memory->create(cachelist[igroup],cachemax[igroup],"group:cachelist");
+  }
+
+  int *list = cachelist[igroup];
+  int *mask = atom->mask;
+  int bit = bitmask[igroup];
+
+  int m = 0;
+  for (int i = 0; i < nlocal; i++)
+    if (mask[i] & bit) list[m++] = i;
+
+  cachenum[igroup] = m;
+  cachestep[igroup] = update->ntimestep;
+  cacheago[igroup] = neighbor->ago;
+  cachenlocal[igroup] = nlocal;
+
+  n = m;
+  return list;
+}
+
+/* ----------------------------------------------------------------------
+   discard all cached member lists
+   called whenever a group command may have changed membership
+------------------------------------------------------------------------- */
+
+void Group::cache_clear()
+{
+  for (int i = 0; i < MAX_GROUP; i++) cachestep[i] = -1;
+}
+
 /* ----------------------------------------------------------------------
    return group index if name matches existing group, -1 if no such group
 ------------------------------------------------------------------------- */
@@ -800,9 +890,15 @@ bigint Group::count(int igroup, int iregion)
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
 
+  int *rflags;
+  memory->create(rflags,nlocal,"group:rflags");
+  region->match_all(nlocal,x,rflags);
+
   int n = 0;
   for (int i = 0; i < nlocal; i++)
-    if (mask[i] & groupbit && region->match(x[i][0],x[i][1],x[i][2])) n++;
+    if (mask[i] & groupbit && rflags[i]) n++;
+
+  memory->destroy(rflags);
 
   bigint nsingle = n;
   bigint nall;
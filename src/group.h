@@ -38,6 +38,9 @@ class Group : protected Pointers {
   void write_restart(FILE *);
   void read_restart(FILE *);
 
+  int *member_list(int, int &);      // cached local indices of group members
+  void cache_clear();                // discard all cached member lists
+
   bigint count_all();                      // count atoms in group all
   bigint count(int);                       // count atoms in group
   bigint count(int,int);                   // count atoms in group & region
@@ -69,6 +72,15 @@ class Group : protected Pointers {
   int me;
   std::map<tagint,int> *hash;
 
+  // lazily built member index lists, see member_list()
+
+  int **cachelist;     // per-group cached list of my atom indices
+  int *cachenum;       // # of cached indices per group
+  int *cachemax;       // allocated length of each cached list
+  bigint *cachestep;   // timestep each cache was built on, -1 if never
+  int *cacheago;       // neighbor->ago when built, detects mid-step reneigh
+  int *cachenlocal;    // nlocal when built
+
   int find_unused();
   void add_molecules(int, int);
 
@@ -150,6 +150,9 @@ void Image::buffers()
   memory->create(depthcopy,npixels,"image:depthcopy");
   memory->create(surfacecopy,2*npixels,"image:surfacecopy");
   memory->create(rgbcopy,3*npixels,"image:rgbcopy");
+
+  dirtylo = height;
+  dirtyhi = -1;
 }
 
 /* ----------------------------------------------------------------------
@@ -282,12 +285,20 @@ void Image::clear()
       imageBuffer[iy * width * 3 + ix * 3 + 2] = blue;
       depthBuffer[iy * width + ix] = -1;
     }
+
+  // no rows drawn into yet
+
+  dirtylo = height;
+  dirtyhi = -1;
 }
 
 /* ----------------------------------------------------------------------
    merge image from each processor into one composite image
    done pixel by pixel, respecting depth buffer
    hi procs send to lo procs, cascading down logarithmically
+   only the rows a proc actually drew into are exchanged: with a
+   spatial decomposition each proc's atoms project onto a small
+   screen region, so most of the full-size buffers never move
 ------------------------------------------------------------------------- */
 
 void Image::merge()
@@ -300,32 +311,61 @@ void Image::merge()
 
   while (nhalf) {
     if (me < nhalf && me+nhalf < nprocs) {
-      MPI_Irecv(rgbcopy,npixels*3,MPI_BYTE,me+nhalf,0,world,&requests[0]);
-      MPI_Irecv(depthcopy,npixels,MPI_DOUBLE,me+nhalf,0,world,&requests[1]);
-      if (ssao)
-        MPI_Irecv(surfacecopy,npixels*2,MPI_DOUBLE,
-                  me+nhalf,0,world,&requests[2]);
-      if (ssao) MPI_Waitall(3,requests,MPI_STATUS_IGNORE);
-      else MPI_Waitall(2,requests,MPI_STATUS_IGNORE);
-
-      for (int i = 0; i < npixels; i++) {
-        if (depthBuffer[i] < 0 || (depthcopy[i] >= 0 &&
-                                   depthcopy[i] < depthBuffer[i])) {
-          depthBuffer[i] = depthcopy[i];
-          imageBuffer[i*3+0] = rgbcopy[i*3+0];
-          imageBuffer[i*3+1] = rgbcopy[i*3+1];
-          imageBuffer[i*3+2] = rgbcopy[i*3+2];
-          if (ssao) {
-            surfaceBuffer[i*2+0] = surfacecopy[i*2+0];
-            surfaceBuffer[i*2+1] = surfacecopy[i*2+1];
+
+      // rows[0] = first dirty row of partner, rows[1] = last+1
+
+      int rows[2];
+      MPI_Recv(rows,2,MPI_INT,me+nhalf,0,world,MPI_STATUS_IGNORE);
+      const int n = (rows[1]-rows[0])*width;
+
+      if (n > 0) {
+        MPI_Irecv(rgbcopy,n*3,MPI_BYTE,me+nhalf,0,world,&requests[0]);
+        MPI_Irecv(depthcopy,n,MPI_DOUBLE,me+nhalf,0,world,&requests[1]);
+        if (ssao)
+          MPI_Irecv(surfacecopy,n*2,MPI_DOUBLE,
+                    me+nhalf,0,world,&requests[2]);
+        if (ssao) MPI_Waitall(3,requests,MPI_STATUS_IGNORE);
+        else MPI_Waitall(2,requests,MPI_STATUS_IGNORE);
+
+        const int offset = rows[0]*width;
+        for (int i = 0; i < n; i++) {
+          const int ib = offset + i;
+          if (depthBuffer[ib] < 0 || (depthcopy[i] >= 0 &&
+                                      depthcopy[i] < depthBuffer[ib])) {
+            depthBuffer[ib] = depthcopy[i];
+            imageBuffer[ib*3+0] = rgbcopy[i*3+0];
+            imageBuffer[ib*3+1] = rgbcopy[i*3+1];
+            imageBuffer[ib*3+2] = rgbcopy[i*3+2];
+            if (ssao) {
+              surfaceBuffer[ib*2+0] = surfacecopy[i*2+0];
+              surfaceBuffer[ib*2+1] = surfacecopy[i*2+1];
+            }
           }
         }
+
+        // this proc's image now also covers the partner's rows
+
+        if (rows[0] < dirtylo) dirtylo = rows[0];
+        if (rows[1]-1 > dirtyhi) dirtyhi = rows[1]-1;
       }
 
     } else if (me >= nhalf && me < 2*nhalf) {
-      MPI_Send(imageBuffer,npixels*3,MPI_BYTE,me-nhalf,0,world);
-      MPI_Send(depthBuffer,npixels,MPI_DOUBLE,me-nhalf,0,world);
-      if (ssao) MPI_Send(surfaceBuffer,npixels*2,MPI_DOUBLE,me-nhalf,0,world);
+      int rows[2];
+      if (dirtyhi < dirtylo) rows[0] = rows[1] = 0;
+      else {
+        rows[0] = dirtylo;
+        rows[1] = dirtyhi+1;
+      }
+      MPI_Send(rows,2,MPI_INT,me-nhalf,0,world);
+
+      const int n = (rows[1]-rows[0])*width;
+      if (n > 0) {
+        const int offset = rows[0]*width;
+        MPI_Send(imageBuffer+offset*3,n*3,MPI_BYTE,me-nhalf,0,world);
+        MPI_Send(depthBuffer+offset,n,MPI_DOUBLE,me-nhalf,0,world);
+        if (ssao)
+          MPI_Send(surfaceBuffer+offset*2,n*2,MPI_DOUBLE,me-nhalf,0,world);
+      }
     }
 
     nhalf /= 2;
@@ -825,6 +865,9 @@ void Image::draw_pixel(int ix, int iy, double depth,
                     depth >= depthBuffer[ix + iy*width])) return;
   depthBuffer[ix + iy*width] = depth;
 
+  if (iy < dirtylo) dirtylo = iy;
+  if (iy > dirtyhi) dirtyhi = iy;
+
   // store only the tangent relative to the camera normal (0,0,-1)
 
   surfaceBuffer[0 + ix * 2 + iy*width * 2] = surface[1];
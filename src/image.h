@@ -65,6 +65,7 @@ class Image : protected Pointers {
  private:
   int me,nprocs;
   int npixels;
+  int dirtylo,dirtyhi;          // range of image rows this proc drew into
 
   class ColorMap **maps;
   int nmap;
@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "imbalance_contact.h"
+#include <mpi.h>
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "memory.h"
+#include "neighbor.h"
+#include "neigh_request.h"
+#include "neigh_list.h"
+#include "error.h"
+#include "fmt/format.h"
+
+using namespace LAMMPS_NS;
+
+#define BIG 1.0e20
+
+/* -------------------------------------------------------------------- */
+
+ImbalanceContact::ImbalanceContact(LAMMPS *lmp) : Imbalance(lmp)
+{
+  did_warn = 0;
+}
+
+/* -------------------------------------------------------------------- */
+
+int ImbalanceContact::options(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR,"Illegal balance weight command");
+  factor = force->numeric(FLERR,arg[0]);
+  if (factor <= 0.0) error->all(FLERR,"Illegal balance weight command");
+  return 1;
+}
+
+/* -------------------------------------------------------------------- */
+
+void ImbalanceContact::compute(double *weight)
+{
+  int req;
+
+  if (factor == 0.0) return;
+
+  // requires per-atom radii to detect touching pairs
+
+  if (!atom->radius) {
+    if (comm->me == 0 && !did_warn)
+      error->warning(FLERR,"Balance weight contact requires per-atom radii");
+    did_warn = 1;
+    return;
+  }
+
+  // find suitable neighbor list
+  // can only use certain conventional neighbor lists
+
+  for (req = 0; req < neighbor->old_nrequest; ++req) {
+    if (neighbor->old_requests[req]->half &&
+        neighbor->old_requests[req]->skip == 0 &&
+        neighbor->lists[req] && neighbor->lists[req]->numneigh) break;
+  }
+
+  if (req >= neighbor->old_nrequest || neighbor->ago < 0) {
+    if (comm->me == 0 && !did_warn)
+      error->warning(FLERR,"Balance weight contact skipped b/c no list found");
+    did_warn = 1;
+    return;
+  }
+
+  // count touching contacts of each owned atom
+  // tally each touching pair to both partners so the count does not
+  //   depend on which atom the half list stored the pair with
+  // every atom gets a baseline count of 1 for its integration cost
+
+  NeighList *list = neighbor->lists[req];
+  const int inum = list->inum;
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+  int ** const firstneigh = list->firstneigh;
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int nlocal = atom->nlocal;
+
+  double *count;
+  memory->create(count,nlocal,"imbalance:count");
+  for (int i = 0; i < nlocal; i++) count[i] = 1.0;
+
+  int i,j,ii,jj,jnum;
+  int *jlist;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq,radi,radsum;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    radi = radius[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      radsum = radi + radius[j];
+      if (rsq >= radsum*radsum) continue;
+      if (i < nlocal) count[i] += 1.0;
+      if (j < nlocal) count[j] += 1.0;
+    }
+  }
+
+  // localwt = average weight of an owned atom, used for factor scaling
+
+  double contactsum = 0.0;
+  for (i = 0; i < nlocal; i++) contactsum += count[i];
+  double localwt = 0.0;
+  if (nlocal) localwt = contactsum/nlocal;
+
+  if (nlocal && localwt <= 0.0) error->one(FLERR,"Balance weight <= 0.0");
+
+  // apply factor if specified != 1.0
+  // wtlo,wthi = lo/hi values excluding 0.0 due to no atoms on this proc
+  // lo value does not change
+  // newhi = new hi value to give hi/lo ratio factor times larger/smaller
+  // expand/contract all localwt values from lo->hi to lo->newhi
+
+  double scale = 1.0;
+
+  if (factor != 1.0) {
+    double wtlo,wthi;
+    if (localwt == 0.0) localwt = BIG;
+    MPI_Allreduce(&localwt,&wtlo,1,MPI_DOUBLE,MPI_MIN,world);
+    if (localwt == BIG) localwt = 0.0;
+    MPI_Allreduce(&localwt,&wthi,1,MPI_DOUBLE,MPI_MAX,world);
+    if (wtlo == wthi) {
+      memory->destroy(count);
+      return;
+    }
+
+    double newhi = wthi*factor;
+    double newwt = wtlo + ((localwt-wtlo)/(wthi-wtlo)) * (newhi-wtlo);
+    if (localwt > 0.0) scale = newwt/localwt;
+  }
+
+  // unlike weight style neigh, apply each atom's own count as its weight
+  // so the partitioner sees cost variation within a proc
+
+  for (i = 0; i < nlocal; i++) weight[i] *= scale*count[i];
+
+  memory->destroy(count);
+}
+
+/* -------------------------------------------------------------------- */
+
+std::string ImbalanceContact::info()
+{
+  return fmt::format("  contact weight factor: {}\n",factor);
+}
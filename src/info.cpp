@@ -40,6 +40,7 @@
 #include "improper.h"
 #include "group.h"
 #include "input.h"
+#include "memory.h"
 #include "modify.h"
 #include "neighbor.h"
 #include "output.h"
@@ -96,6 +97,7 @@ enum {COMPUTES=1<<0,
       REGION_STYLES=1<<23,
       DUMP_STYLES=1<<24,
       COMMAND_STYLES=1<<25,
+      MEMORY_DETAIL=1<<26,
       ALL=~0};
 
 static const int STYLES = ATOM_STYLES | INTEGRATE_STYLES | MINIMIZE_STYLES
@@ -191,6 +193,10 @@ void Info::command(int narg, char **arg)
     } else if (strncmp(arg[idx],"memory",3) == 0) {
       flags |= MEMORY;
       ++idx;
+      if ((idx < narg) && (strncmp(arg[idx],"detail",3) == 0)) {
+        flags |= MEMORY_DETAIL;
+        ++idx;
+      }
     } else if (strncmp(arg[idx],"variables",3) == 0) {
       flags |= VARIABLES;
       ++idx;
@@ -331,6 +337,39 @@ void Info::command(int narg, char **arg)
       bytes += output->dump[i]->memory_usage();
     double mbytes = bytes/1024.0/1024.0;
     fmt::print(out,"Total dynamically allocated memory: {:.4} Mbyte\n",mbytes);
+    fmt::print(out,"Tallied allocations: {:.4} Mbyte current, "
+               "{:.4} Mbyte peak\n",
+               memory->tallied_current()/1024.0/1024.0,
+               memory->tallied_peak()/1024.0/1024.0);
+
+    if (flags & MEMORY_DETAIL) {
+      std::map<std::string,std::pair<bigint,bigint> > cats =
+        memory->highwater();
+      if (cats.size()) {
+        fputs("Allocations per category: current / peak\n",out);
+        std::map<std::string,std::pair<bigint,bigint> >::const_iterator it;
+        for (it = cats.begin(); it != cats.end(); ++it)
+          fmt::print(out,"  {:<16} {:>10.4} / {:<10.4} Mbyte\n",
+                     it->first,it->second.first/1024.0/1024.0,
+                     it->second.second/1024.0/1024.0);
+      }
+    } else {
+      std::map<std::string,bigint> cats = memory->categories();
+      if (cats.size()) {
+        fputs("Allocations per category:\n",out);
+        std::map<std::string,bigint>::const_iterator it;
+        for (it = cats.begin(); it != cats.end(); ++it)
+          fmt::print(out,"  {:<16} {:.4} Mbyte\n",
+                     it->first,it->second/1024.0/1024.0);
+      }
+    }
+
+    bigint pgalloc,pgused;
+    neighbor->page_stats(pgalloc,pgused);
+    fmt::print(out,"Neighbor list pages: {:.4} Mbyte allocated, "
+               "{:.4} Mbyte in use, {:.4} Mbyte decayed\n",
+               pgalloc/1024.0/1024.0,pgused/1024.0/1024.0,
+               neighbor->pgdecay_freed/1024.0/1024.0);
 
 #if defined(_WIN32)
     HANDLE phandle = GetCurrentProcess();
@@ -383,6 +422,11 @@ void Info::command(int narg, char **arg)
       }
     }
     fmt::print(out,"Nprocs = {},   Nthreads = {}\n",comm->nprocs,comm->nthreads);
+    if (comm->exchadaptive)
+      fmt::print(out,"Atom migrations per dim = {} {} {}\n"
+                 "Skipped exchanges per dim = {} {} {}\n",
+                 comm->exchmigrate[0],comm->exchmigrate[1],comm->exchmigrate[2],
+                 comm->exchskip[0],comm->exchskip[1],comm->exchskip[2]);
     if (domain->box_exist)
       fmt::print(out,"Processor grid = {} x {} x {}\n",comm->procgrid[0],
                  comm->procgrid[1], comm->procgrid[2]);
@@ -669,6 +713,10 @@ void Info::command(int narg, char **arg)
 
 void Info::available_styles(FILE * out, int flags)
 {
+  // the lazily built style maps must exist before they can be listed
+
+  force->create_factories();
+  modify->create_factories();
 
   fputs("\nStyles information:\n",out);
 
@@ -951,6 +999,9 @@ bool Info::is_defined(const char *category, const char *name)
 
 bool Info::has_style(const string & category, const string & name)
 {
+  force->create_factories();
+  modify->create_factories();
+
   if ( category == "atom" ) {
     return find_style(lmp, atom->avec_map, name, false);
   } else if( category == "integrate" ) {
@@ -985,6 +1036,9 @@ bool Info::has_style(const string & category, const string & name)
 
 vector<string> Info::get_available_styles(const string & category)
 {
+  force->create_factories();
+  modify->create_factories();
+
   if ( category == "atom" ) {
     return get_style_names(atom->avec_map);
   } else if( category == "integrate" ) {
@@ -847,14 +847,28 @@ int Input::execute_command()
   else flag = 0;
 
   // return if command was listed above
-
-  if (flag) return 0;
+  // any command that can modify the system invalidates the warm-start
+  // state consulted by "run ... pre auto"; the only commands above that
+  // provably cannot are the input-script control and output ones
+
+  if (flag) {
+    if (strcmp(command,"echo") != 0 && strcmp(command,"if") != 0 &&
+        strcmp(command,"include") != 0 && strcmp(command,"jump") != 0 &&
+        strcmp(command,"label") != 0 && strcmp(command,"log") != 0 &&
+        strcmp(command,"next") != 0 && strcmp(command,"partition") != 0 &&
+        strcmp(command,"print") != 0 && strcmp(command,"shell") != 0)
+      update->setup_dirty = 1;
+    return 0;
+  }
 
   // invoke commands added via style_command.h
+  // all of them except run itself are assumed to modify the system;
+  // run clears the dirty flag itself when it completes
 
   if (command_map->find(command) != command_map->end()) {
     CommandCreator &command_creator = (*command_map)[command];
     command_creator(lmp,narg,arg);
+    if (strcmp(command,"run") != 0) update->setup_dirty = 1;
     return 0;
   }
 
@@ -39,6 +39,8 @@ static int compare_standalone(const int, const int, void *);
 #define BUFMIN 1024
 #define BUFEXTRA 1024
 
+enum{NOPLAN,ATOMPLAN,DATAPLAN};    // values of plan_style
+
 /* ---------------------------------------------------------------------- */
 
 Irregular::Irregular(LAMMPS *lmp) : Pointers(lmp)
@@ -67,6 +69,14 @@ Irregular::Irregular(LAMMPS *lmp) : Pointers(lmp)
   memory->create(work1,nprocs,"irregular:work1");
   memory->create(work2,nprocs,"irregular:work2");
 
+  // plan cache
+
+  plan_style = NOPLAN;
+  reuse_flag = 0;
+  nsave = maxsave = 0;
+  proclist_save = NULL;
+  sizes_save = NULL;
+
   // initialize buffers for migrate atoms, not used for datum comm
   // these can persist for multiple irregular operations
 
@@ -81,6 +91,9 @@ Irregular::Irregular(LAMMPS *lmp) : Pointers(lmp)
 
 Irregular::~Irregular()
 {
+  free_plan();
+  memory->destroy(proclist_save);
+  memory->destroy(sizes_save);
   memory->destroy(mproclist);
   memory->destroy(msizes);
   memory->destroy(dbuf);
@@ -307,6 +320,27 @@ int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
 {
   int i;
 
+  // if my sends match the plan cached by the previous create_atom() on
+  // every proc, then every proc's receives are also unchanged and the
+  // whole plan can be reused, skipping the ReduceScatter + handshake
+  // common when repeated migrations move few or no atoms between procs
+
+  int same = 0;
+  if (reuse_flag && plan_style == ATOMPLAN &&
+      sortflag == sortflag_save && n == nsave) {
+    same = 1;
+    for (i = 0; i < n; i++)
+      if (proclist[i] != proclist_save[i] || sizes[i] != sizes_save[i]) {
+        same = 0;
+        break;
+      }
+  }
+  int sameall;
+  MPI_Allreduce(&same,&sameall,1,MPI_INT,MPI_MIN,world);
+  if (sameall) return nreturn_save;
+
+  free_plan();
+
   // setup for collective comm
   // work1 = 1 for procs I send a message to, not including self
   // work2 = 1 for all procs, used for ReduceScatter
@@ -338,8 +372,6 @@ int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
 
   proc_recv = new int[nrecv_proc];
   length_recv = new int[nrecv_proc];
-  request = new MPI_Request[nrecv_proc];
-  status = new MPI_Status[nrecv_proc];
 
   // nsend_proc = # of messages I send
 
@@ -351,12 +383,15 @@ int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
     if (work1[i]) nsend_proc++;
 
   // allocate send arrays
+  // requests/statuses cover posted recvs and nonblocking sends
 
   proc_send = new int[nsend_proc];
   length_send = new int[nsend_proc];
   num_send = new int[nsend_proc];
   index_send = new int[n];
   offset_send = new int[n];
+  request = new MPI_Request[nrecv_proc+nsend_proc];
+  status = new MPI_Status[nrecv_proc+nsend_proc];
 
   // list still stores size of message for procs I send to
   // proc_send = procs I send to
@@ -462,6 +497,26 @@ int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
 
   MPI_Barrier(world);
 
+  // save inputs so the next create_atom() can detect an unchanged plan
+
+  if (n > maxsave) {
+    memory->destroy(proclist_save);
+    memory->destroy(sizes_save);
+    maxsave = static_cast<int> (BUFFACTOR * n);
+    memory->create(proclist_save,maxsave,"irregular:proclist_save");
+    memory->create(sizes_save,maxsave,"irregular:sizes_save");
+  } else if (sizes_save == NULL)
+    memory->create(sizes_save,maxsave,"irregular:sizes_save");
+  if (n) {
+    memcpy(proclist_save,proclist,n*sizeof(int));
+    memcpy(sizes_save,sizes,n*sizeof(int));
+  }
+  nsave = n;
+  sortflag_save = sortflag;
+  nreturn_save = nrecvsize;
+  plan_style = ATOMPLAN;
+  reuse_flag = 1;
+
   // return size of atom data I will receive
 
   return nrecvsize;
@@ -522,51 +577,47 @@ void Irregular::exchange_atom(double *sendbuf, int *sizes, double *recvbuf)
     offset += length_recv[irecv];
   }
 
-  // reallocate buf for largest send if necessary
+  // reallocate buf to hold all outgoing messages if necessary
+
+  int sendtotal = 0;
+  for (i = 0; i < nsend_proc; i++) sendtotal += length_send[i];
 
-  if (sendmax_proc > maxdbuf) {
+  if (sendtotal > maxdbuf) {
     memory->destroy(dbuf);
-    maxdbuf = sendmax_proc;
+    maxdbuf = sendtotal;
     memory->create(dbuf,maxdbuf,"irregular:dbuf");
   }
 
-  // send each message
-  // pack buf with list of atoms
+  // pack and send each message nonblocking
+  // all messages transit concurrently with the posted recvs
   // m = index of atom in sendbuf
 
   n = 0;
+  offset = 0;
   for (int isend = 0; isend < nsend_proc; isend++) {
-    offset = 0;
+    bigint start = offset;
     count = num_send[isend];
     for (i = 0; i < count; i++) {
       m = index_send[n++];
       memcpy(&dbuf[offset],&sendbuf[offset_send[m]],sizes[m]*sizeof(double));
       offset += sizes[m];
     }
-    MPI_Send(dbuf,length_send[isend],MPI_DOUBLE,proc_send[isend],0,world);
+    MPI_Isend(&dbuf[start],length_send[isend],MPI_DOUBLE,proc_send[isend],
+              0,world,&request[nrecv_proc+isend]);
   }
 
-  // wait on all incoming messages
+  // wait on all incoming and outgoing messages
 
-  if (nrecv_proc) MPI_Waitall(nrecv_proc,request,status);
+  if (nrecv_proc+nsend_proc)
+    MPI_Waitall(nrecv_proc+nsend_proc,request,status);
 }
 
 /* ----------------------------------------------------------------------
-   destroy vectors in communication plan for atoms
+   finish with communication plan for atoms
+   plan arrays are kept for possible reuse by the next create_atom()
 ------------------------------------------------------------------------- */
 
-void Irregular::destroy_atom()
-{
-  delete [] proc_send;
-  delete [] length_send;
-  delete [] num_send;
-  delete [] index_send;
-  delete [] offset_send;
-  delete [] proc_recv;
-  delete [] length_recv;
-  delete [] request;
-  delete [] status;
-}
+void Irregular::destroy_atom() {}
 
 /* ----------------------------------------------------------------------
    create communication plan based on list of datums of uniform size
@@ -580,6 +631,27 @@ int Irregular::create_data(int n, int *proclist, int sortflag)
 {
   int i,m;
 
+  // if my sends match the plan cached by the previous create_data() on
+  // every proc, then every proc's receives are also unchanged and the
+  // whole plan can be reused, skipping the ReduceScatter + handshake
+  // common when successive dump frames redistribute near-identically
+
+  int same = 0;
+  if (reuse_flag && plan_style == DATAPLAN &&
+      sortflag == sortflag_save && n == nsave) {
+    same = 1;
+    for (i = 0; i < n; i++)
+      if (proclist[i] != proclist_save[i]) {
+        same = 0;
+        break;
+      }
+  }
+  int sameall;
+  MPI_Allreduce(&same,&sameall,1,MPI_INT,MPI_MIN,world);
+  if (sameall) return nreturn_save;
+
+  free_plan();
+
   // setup for collective comm
   // work1 = 1 for procs I send a message to, not including self
   // work2 = 1 for all procs, used for ReduceScatter
@@ -611,8 +683,6 @@ int Irregular::create_data(int n, int *proclist, int sortflag)
 
   proc_recv = new int[nrecv_proc];
   num_recv = new int[nrecv_proc];
-  request = new MPI_Request[nrecv_proc];
-  status = new MPI_Status[nrecv_proc];
 
   // work1 = # of datums I send to each proc, including self
   // nsend_proc = # of procs I send messages to, not including self
@@ -626,12 +696,15 @@ int Irregular::create_data(int n, int *proclist, int sortflag)
   if (work1[me]) nsend_proc--;
 
   // allocate send and self arrays
+  // requests/statuses cover posted recvs and nonblocking sends
 
   proc_send = new int[nsend_proc];
   num_send = new int[nsend_proc];
   index_send = new int[n-work1[me]];
   index_self = new int[work1[me]];
   maxindex = n;
+  request = new MPI_Request[nrecv_proc+nsend_proc];
+  status = new MPI_Status[nrecv_proc+nsend_proc];
 
   // proc_send = procs I send to
   // num_send = # of datums I send to each proc
@@ -736,6 +809,22 @@ int Irregular::create_data(int n, int *proclist, int sortflag)
 
   MPI_Barrier(world);
 
+  // save inputs so the next create_data() can detect an unchanged plan
+
+  if (n > maxsave) {
+    memory->destroy(proclist_save);
+    memory->destroy(sizes_save);
+    sizes_save = NULL;
+    maxsave = static_cast<int> (BUFFACTOR * n);
+    memory->create(proclist_save,maxsave,"irregular:proclist_save");
+  }
+  if (n) memcpy(proclist_save,proclist,n*sizeof(int));
+  nsave = n;
+  sortflag_save = sortflag;
+  nreturn_save = nrecvdatum;
+  plan_style = DATAPLAN;
+  reuse_flag = 1;
+
   // return # of datums I will receive
 
   return nrecvdatum;
@@ -753,6 +842,10 @@ int Irregular::create_data_grouped(int n, int *procs, int sortflag)
 {
   int i,j,k,m;
 
+  // grouped plans are not cached, just discard any previous plan
+
+  free_plan();
+
   // setup for collective comm
   // work1 = # of datums I send to each proc, set self to 0
   // work2 = 1 for all procs, used for ReduceScatter
@@ -783,8 +876,6 @@ int Irregular::create_data_grouped(int n, int *procs, int sortflag)
 
   proc_recv = new int[nrecv_proc];
   num_recv = new int[nrecv_proc];
-  request = new MPI_Request[nrecv_proc];
-  status = new MPI_Status[nrecv_proc];
 
   // work1 = # of datums I send to each proc, including self
   // nsend_proc = # of procs I send messages to, not including self
@@ -797,12 +888,15 @@ int Irregular::create_data_grouped(int n, int *procs, int sortflag)
   if (work1[me]) nsend_proc--;
 
   // allocate send and self arrays
+  // requests/statuses cover posted recvs and nonblocking sends
 
   proc_send = new int[nsend_proc];
   num_send = new int[nsend_proc];
   index_send = new int[n-work1[me]];
   index_self = new int[work1[me]];
   maxindex = n;
+  request = new MPI_Request[nrecv_proc+nsend_proc];
+  status = new MPI_Status[nrecv_proc+nsend_proc];
 
   // proc_send = procs I send to
   // num_send = # of datums I send to each proc
@@ -910,6 +1004,9 @@ int Irregular::create_data_grouped(int n, int *procs, int sortflag)
 
   MPI_Barrier(world);
 
+  plan_style = DATAPLAN;
+  reuse_flag = 0;
+
   // return # of datums I will receive
 
   return nrecvdatum;
@@ -937,28 +1034,33 @@ void Irregular::exchange_data(char *sendbuf, int nbytes, char *recvbuf)
     offset += num_recv[irecv]*nbytes;
   }
 
-  // reallocate buf for largest send if necessary
+  // reallocate buf to hold all outgoing messages if necessary
+
+  int sendtotal = 0;
+  for (i = 0; i < nsend_proc; i++) sendtotal += num_send[i];
 
-  if (sendmax_proc*nbytes > maxbuf) {
+  if (sendtotal*nbytes > maxbuf) {
     memory->destroy(buf);
-    maxbuf = sendmax_proc*nbytes;
+    maxbuf = sendtotal*nbytes;
     memory->create(buf,maxbuf,"irregular:buf");
   }
 
-  // send each message
-  // pack buf with list of datums
+  // pack and send each message nonblocking
+  // all messages transit concurrently with the posted recvs
   // m = index of datum in sendbuf
 
   n = 0;
+  dest = buf;
   for (int isend = 0; isend < nsend_proc; isend++) {
+    char *start = dest;
     count = num_send[isend];
-    dest = buf;
     for (i = 0; i < count; i++) {
       m = index_send[n++];
       memcpy(dest,&sendbuf[m*nbytes],nbytes);
       dest += nbytes;
     }
-    MPI_Send(buf,count*nbytes,MPI_CHAR,proc_send[isend],0,world);
+    MPI_Isend(start,count*nbytes,MPI_CHAR,proc_send[isend],0,world,
+              &request[nrecv_proc+isend]);
   }
 
   // copy datums to self, put at beginning of recvbuf
@@ -970,25 +1072,45 @@ void Irregular::exchange_data(char *sendbuf, int nbytes, char *recvbuf)
     dest += nbytes;
   }
 
-  // wait on all incoming messages
+  // wait on all incoming and outgoing messages
 
-  if (nrecv_proc) MPI_Waitall(nrecv_proc,request,status);
+  if (nrecv_proc+nsend_proc)
+    MPI_Waitall(nrecv_proc+nsend_proc,request,status);
 }
 
 /* ----------------------------------------------------------------------
-   destroy vectors in communication plan for datums
+   finish with communication plan for datums
+   plan arrays are kept for possible reuse by the next create_data()
 ------------------------------------------------------------------------- */
 
-void Irregular::destroy_data()
+void Irregular::destroy_data() {}
+
+/* ----------------------------------------------------------------------
+   free plan arrays of whichever style is allocated
+------------------------------------------------------------------------- */
+
+void Irregular::free_plan()
 {
+  if (plan_style == NOPLAN) return;
+
   delete [] proc_send;
   delete [] num_send;
   delete [] index_send;
   delete [] proc_recv;
-  delete [] num_recv;
-  delete [] index_self;
   delete [] request;
   delete [] status;
+
+  if (plan_style == ATOMPLAN) {
+    delete [] length_send;
+    delete [] length_recv;
+    delete [] offset_send;
+  } else {
+    delete [] num_recv;
+    delete [] index_self;
+  }
+
+  plan_style = NOPLAN;
+  reuse_flag = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -1060,5 +1182,6 @@ bigint Irregular::memory_usage()
   bytes += maxbuf;                   // buf
   bytes += 2*maxlocal*sizeof(int);   // mproclist,msizes
   bytes += 2*nprocs*sizeof(int);     // work1,work2
+  bytes += 2*maxsave*sizeof(int);    // proclist_save,sizes_save
   return bytes;
 }
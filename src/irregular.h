@@ -84,11 +84,25 @@ class Irregular : protected Pointers {
   int num_self;              // # of datums to copy to self
   int *index_self;           // list of which datums to copy to self
 
+  // plan cache
+  // plan arrays persist between create() calls and are reused when
+  // no proc's sends changed, skipping the collective handshake
+
+  int plan_style;            // style of plan arrays currently allocated
+  int reuse_flag;            // 1 if plan may be matched by the next create()
+  int nsave;                 // # of sends the cached plan was built for
+  int maxsave;               // allocated size of proclist_save,sizes_save
+  int *proclist_save;        // destinations the cached plan was built for
+  int *sizes_save;           // per-atom sizes for a cached atom plan
+  int sortflag_save;         // sortflag the cached plan was built for
+  int nreturn_save;          // recv size/count the cached plan returned
+
   // private methods
 
   int create_atom(int, int *, int *, int);
   void exchange_atom(double *, int *, double *);
   void destroy_atom();
+  void free_plan();
 
   int binary(double, int, double *);
 
@@ -52,6 +52,10 @@ KSpace::KSpace(LAMMPS *lmp) : Pointers(lmp)
   gewaldflag = 0;
   minorder = 2;
   overlap_allowed = 1;
+  overlap_comm_flag = 0;
+  remap_node_flag = 0;
+  fft_precision_flag = 0;
+  fft_ranks = 1;
   fftbench = 0;
 
   // default to using MPI collectives for FFT/remap only on IBM BlueGene
@@ -542,6 +546,29 @@ void KSpace::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) collective_flag = 0;
       else error->all(FLERR,"Illegal kspace_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"overlap/comm") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) overlap_comm_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) overlap_comm_flag = 0;
+      else error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"remap/node") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) remap_node_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) remap_node_flag = 0;
+      else error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"precision") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      if (strcmp(arg[iarg+1],"single") == 0) fft_precision_flag = 1;
+      else if (strcmp(arg[iarg+1],"double") == 0) fft_precision_flag = 2;
+      else error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"fft/ranks") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      fft_ranks = force->inumeric(FLERR,arg[iarg+1]);
+      if (fft_ranks < 1) error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"diff") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
       if (strcmp(arg[iarg+1],"ad") == 0) differentiation_flag = 1;
@@ -90,6 +90,12 @@ class KSpace : protected Pointers {
   int fftbench;                   // 0 if skip FFT timing
   int collective_flag;            // 1 if use MPI collectives for FFT/remap
   int stagger_flag;               // 1 if using staggered PPPM grids
+  int overlap_comm_flag;          // 1 if overlap grid comm with computation
+  int remap_node_flag;            // 1 if aggregate FFT remap msgs per node
+  int fft_precision_flag;         // requested FFT precision:
+                                  //   0 = build default, 1 = single, 2 = double
+  int fft_ranks;                  // assign FFT pencils to 1 of every
+                                  //   this many procs (1 = all procs)
 
   double splittol;                // tolerance for when to truncate splitting
 
@@ -126,6 +132,11 @@ class KSpace : protected Pointers {
   virtual void pack_reverse(int, FFT_SCALAR *, int, int *) {};
   virtual void unpack_reverse(int, FFT_SCALAR *, int, int *) {};
 
+  // called by GridComm while grid messages are in flight
+  // do a chunk of independent work, return 1 if more work remains
+
+  virtual int overlap_progress() {return 0;}
+
   virtual int timing(int, double &, double &) {return 0;}
   virtual int timing_1d(int, double &) {return 0;}
   virtual int timing_3d(int, double &) {return 0;}
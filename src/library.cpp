@@ -29,6 +29,7 @@
 #include "variable.h"
 #include "modify.h"
 #include "output.h"
+#include "dump_ring.h"
 #include "thermo.h"
 #include "compute.h"
 #include "fix.h"
@@ -42,6 +43,8 @@
 #include "neigh_list.h"
 #include "neigh_request.h"
 #include "fmt/format.h"
+#include <string>
+#include <vector>
 
 #if defined(LAMMPS_EXCEPTIONS)
 #include "exceptions.h"
@@ -478,6 +481,44 @@ void *lammps_extract_atom(void *ptr, char *name)
   return lmp->atom->extract(name);
 }
 
+/* ----------------------------------------------------------------------
+   extract a per-rank view of an internal LAMMPS atom-based entity
+   name = desired quantity, e.g. x or mass
+   nlocal = returned # of owned atoms the view covers
+   epoch = returned validity epoch of the view
+   returns a void pointer to the entity, as lammps_extract_atom() does,
+     but without any copy or communication: the pointer covers only the
+     atoms owned by this rank, in their current order
+   the view remains valid as long as lammps_atom_epoch() returns the
+     same epoch; LAMMPS increments the epoch whenever per-atom arrays
+     are reallocated, reordered or atoms migrate between ranks, so a
+     caller holding a stale view must re-extract instead of reading it
+   returns a NULL if Atom::extract() does not recognize the name
+------------------------------------------------------------------------- */
+
+void *lammps_extract_atom_view(void *ptr, char *name,
+                               int *nlocal, int64_t *epoch)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+  void *view = lmp->atom->extract(name);
+  if (view == NULL) return NULL;
+  *nlocal = lmp->atom->nlocal;
+  *epoch = (int64_t) lmp->atom->view_epoch;
+  return view;
+}
+
+/* ----------------------------------------------------------------------
+   return the current validity epoch of per-atom views
+   a view obtained from lammps_extract_atom_view() is safe to read only
+   while this value equals the epoch returned alongside the view
+------------------------------------------------------------------------- */
+
+int64_t lammps_atom_epoch(void *ptr)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+  return (int64_t) lmp->atom->view_epoch;
+}
+
 /* ----------------------------------------------------------------------
    extract a pointer to an internal LAMMPS compute-based entity
    the compute is invoked if its value(s) is not current
@@ -710,6 +751,192 @@ double lammps_get_thermo(void *ptr, char *name)
   return dval;
 }
 
+/* ----------------------------------------------------------------------
+   prepared gather plans: a coupling code that reads the same set of
+   thermo keywords and global compute/fix values every step can resolve
+   the names to pointers once and then fill one buffer per step,
+   instead of one lookup through Modify per quantity per call
+------------------------------------------------------------------------- */
+
+namespace {
+  struct GatherPlanEntry {
+    int kind;              // 0 = thermo keyword, 1 = compute, 2 = fix
+    int type;              // 0 = global scalar, 1 = global vector
+    int length;            // # of doubles this entry produces
+    std::string name;      // thermo keyword, or compute/fix ID
+    LAMMPS_NS::Compute *compute;
+    LAMMPS_NS::Fix *fix;
+  };
+
+  struct GatherPlan {
+    int total;             // sum of all entry lengths
+    std::vector<GatherPlanEntry> entries;
+  };
+}
+
+/* ----------------------------------------------------------------------
+   build a gather plan for n quantities
+   kinds[i] = "thermo", "compute" or "fix"
+   ids[i] = thermo keyword, compute ID or fix ID
+   types[i] = 0 for a global scalar, 1 for a global vector
+   name lookups and flag checks happen once, here; the returned handle
+     is then passed to lammps_gather_plan_execute() each step
+   returns NULL if any name cannot be resolved or any quantity does not
+     provide the requested scalar/vector
+   the plan caches pointers, so it must be destroyed and rebuilt if a
+     referenced compute or fix is deleted or the plan length changes
+     (e.g. a fix whose vector size depends on the system)
+------------------------------------------------------------------------- */
+
+void *lammps_gather_plan_create(void *ptr, int n, char **kinds,
+                                char **ids, int *types)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  GatherPlan *plan = new GatherPlan;
+  plan->total = 0;
+
+  for (int i = 0; i < n; i++) {
+    GatherPlanEntry entry;
+    entry.type = types[i];
+    entry.name = ids[i];
+    entry.compute = NULL;
+    entry.fix = NULL;
+
+    if (strcmp(kinds[i],"thermo") == 0) {
+      entry.kind = 0;
+      if (entry.type != 0) {
+        delete plan;
+        return NULL;
+      }
+      entry.length = 1;
+
+    } else if (strcmp(kinds[i],"compute") == 0) {
+      entry.kind = 1;
+      int icompute = lmp->modify->find_compute(ids[i]);
+      if (icompute < 0) {
+        delete plan;
+        return NULL;
+      }
+      entry.compute = lmp->modify->compute[icompute];
+      if (entry.type == 0) {
+        if (!entry.compute->scalar_flag) {
+          delete plan;
+          return NULL;
+        }
+        entry.length = 1;
+      } else {
+        if (!entry.compute->vector_flag) {
+          delete plan;
+          return NULL;
+        }
+        entry.length = entry.compute->size_vector;
+      }
+
+    } else if (strcmp(kinds[i],"fix") == 0) {
+      entry.kind = 2;
+      int ifix = lmp->modify->find_fix(ids[i]);
+      if (ifix < 0) {
+        delete plan;
+        return NULL;
+      }
+      entry.fix = lmp->modify->fix[ifix];
+      if (entry.type == 0) {
+        if (!entry.fix->scalar_flag) {
+          delete plan;
+          return NULL;
+        }
+        entry.length = 1;
+      } else {
+        if (!entry.fix->vector_flag) {
+          delete plan;
+          return NULL;
+        }
+        entry.length = entry.fix->size_vector;
+      }
+
+    } else {
+      delete plan;
+      return NULL;
+    }
+
+    plan->total += entry.length;
+    plan->entries.push_back(entry);
+  }
+
+  return (void *) plan;
+}
+
+/* ----------------------------------------------------------------------
+   return the total # of doubles a plan produces per execution
+   callers size the buffer for lammps_gather_plan_execute() with this
+------------------------------------------------------------------------- */
+
+int lammps_gather_plan_size(void *plan_handle)
+{
+  GatherPlan *plan = (GatherPlan *) plan_handle;
+  return plan->total;
+}
+
+/* ----------------------------------------------------------------------
+   execute a gather plan, filling buf with plan-size doubles
+   entries are evaluated in the order they were registered; computes are
+     invoked only if not already invoked on this timestep, exactly as
+     lammps_extract_compute() does
+------------------------------------------------------------------------- */
+
+void lammps_gather_plan_execute(void *ptr, void *plan_handle, double *buf)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+  GatherPlan *plan = (GatherPlan *) plan_handle;
+
+  BEGIN_CAPTURE
+  {
+    int offset = 0;
+    for (size_t i = 0; i < plan->entries.size(); i++) {
+      GatherPlanEntry &entry = plan->entries[i];
+
+      if (entry.kind == 0) {
+        lmp->output->thermo->evaluate_keyword(entry.name.c_str(),
+                                              &buf[offset]);
+
+      } else if (entry.kind == 1) {
+        Compute *compute = entry.compute;
+        if (entry.type == 0) {
+          if (compute->invoked_scalar != lmp->update->ntimestep)
+            compute->compute_scalar();
+          buf[offset] = compute->scalar;
+        } else {
+          if (compute->invoked_vector != lmp->update->ntimestep)
+            compute->compute_vector();
+          memcpy(&buf[offset],compute->vector,
+                 entry.length*sizeof(double));
+        }
+
+      } else {
+        Fix *fix = entry.fix;
+        if (entry.type == 0) buf[offset] = fix->compute_scalar();
+        else
+          for (int m = 0; m < entry.length; m++)
+            buf[offset+m] = fix->compute_vector(m);
+      }
+
+      offset += entry.length;
+    }
+  }
+  END_CAPTURE
+}
+
+/* ----------------------------------------------------------------------
+   free a gather plan created by lammps_gather_plan_create()
+------------------------------------------------------------------------- */
+
+void lammps_gather_plan_destroy(void *plan_handle)
+{
+  GatherPlan *plan = (GatherPlan *) plan_handle;
+  delete plan;
+}
+
 /* ----------------------------------------------------------------------
    return the total number of atoms in the system
    useful before call to lammps_get_atoms() so can pre-allocate vector
@@ -738,6 +965,7 @@ int lammps_set_variable(void *ptr, char *name, char *str)
   BEGIN_CAPTURE
   {
     err = lmp->input->variable->set_string(name,str);
+    lmp->update->setup_dirty = 1;
   }
   END_CAPTURE
 
@@ -770,6 +998,7 @@ void lammps_reset_box(void *ptr, double *boxlo, double *boxhi,
   domain->set_global_box();
   lmp->comm->set_proc_grid();
   domain->set_local_box();
+  lmp->update->setup_dirty = 1;
 }
 
 /* ----------------------------------------------------------------------
@@ -1266,6 +1495,8 @@ void lammps_scatter_atoms(void *ptr, char *name,
   {
     int i,j,m,offset;
 
+    lmp->update->setup_dirty = 1;
+
     // error if tags are not defined or not consecutive or no atom map
     // NOTE: test that name = image or ids is not a 64-bit int in code?
 
@@ -1394,6 +1625,8 @@ void lammps_scatter_atoms_subset(void *ptr, char *name,
 
   BEGIN_CAPTURE
   {
+    lmp->update->setup_dirty = 1;
+
     int i,j,m,offset;
     tagint id;
 
@@ -1490,6 +1723,117 @@ void lammps_scatter_atoms_subset(void *ptr, char *name,
 }
 #endif
 
+/* ----------------------------------------------------------------------
+   helper for the frame buffer functions below
+   find the dump ring instance with the given dump ID, NULL if none
+------------------------------------------------------------------------- */
+
+static DumpRing *find_dump_ring(LAMMPS *lmp, char *id)
+{
+  int idump = lmp->output->find_dump(id);
+  if (idump < 0) return NULL;
+  Dump *dump = lmp->output->dump[idump];
+  if (strcmp(dump->style,"ring") != 0) return NULL;
+  return (DumpRing *) dump;
+}
+
+/* ----------------------------------------------------------------------
+   # of frames currently buffered on this proc by a dump ring command
+   id = ID of the dump ring command
+   return -1 if no dump ring command with that ID exists
+------------------------------------------------------------------------- */
+
+int lammps_frame_count(void *ptr, char *id)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  DumpRing *ring = find_dump_ring(lmp,id);
+  if (ring == NULL) return -1;
+  return ring->frame_count();
+}
+
+/* ----------------------------------------------------------------------
+   return ptr to this proc's packed data for one frame buffered by
+     a dump ring command, NULL if the dump or frame does not exist
+   iframe = 0 for the oldest buffered frame
+   step, nrows, ncols are set to the frame's timestep and dimensions
+   data is nrows x ncols doubles in row-major order, one row per atom,
+     columns as listed in the dump ring command
+   the ptr is a zero-copy view, valid until the frame is overwritten,
+     cleared, or the dump is deleted
+------------------------------------------------------------------------- */
+
+#if defined(LAMMPS_BIGBIG) || defined(LAMMPS_SMALLBIG)
+double *lammps_extract_frame(void *ptr, char *id, int iframe,
+                             int64_t *step, int *nrows, int *ncols)
+#else
+double *lammps_extract_frame(void *ptr, char *id, int iframe,
+                             int *step, int *nrows, int *ncols)
+#endif
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  DumpRing *ring = find_dump_ring(lmp,id);
+  if (ring == NULL) return NULL;
+
+  bigint bstep;
+  double *data = ring->frame_data(iframe,&bstep,nrows,ncols);
+  if (data) *step = bstep;
+  return data;
+}
+
+/* ----------------------------------------------------------------------
+   return ptr to 9 box values of one frame buffered by a dump ring command
+   boxlo x,y,z then boxhi x,y,z then xy,xz,yz tilt factors
+   NULL if the dump or frame does not exist
+------------------------------------------------------------------------- */
+
+double *lammps_extract_frame_box(void *ptr, char *id, int iframe)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  DumpRing *ring = find_dump_ring(lmp,id);
+  if (ring == NULL) return NULL;
+  return ring->frame_box(iframe);
+}
+
+/* ----------------------------------------------------------------------
+   discard all frames buffered by a dump ring command
+   called by a consumer after it has read them
+------------------------------------------------------------------------- */
+
+void lammps_clear_frames(void *ptr, char *id)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  DumpRing *ring = find_dump_ring(lmp,id);
+  if (ring) ring->frame_clear();
+}
+
+/* ----------------------------------------------------------------------
+   register an in-situ analysis callback on a dump ring command
+   the callback fires inside the run loop every time the dump takes a
+     snapshot, i.e. at the dump's own interval, with the caller handle,
+     the timestep and the frame index for lammps_extract_frame()
+   the frame is a side-buffer copy made by the dump pack path, so the
+     callback may analyze it (or queue it for its own worker thread)
+     without stopping the run; it is overwritten after nframes more
+     snapshots
+   pass a NULL callback to unregister
+   returns 0 on success, -1 if id is not a dump ring command
+------------------------------------------------------------------------- */
+
+int lammps_set_frame_callback(void *ptr, char *id, FrameFnPtr callback,
+                              void *caller)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  DumpRing *ring = find_dump_ring(lmp,id);
+  if (ring == NULL) return -1;
+  ring->set_callback((DumpRing::FrameFnPtr) callback,caller);
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    create N atoms and assign them to procs based on coords
    id = atom IDs (optional, NULL will generate 1 to N)
@@ -1520,6 +1864,8 @@ void lammps_create_atoms(void *ptr, int n, tagint *id, int *type,
 
   BEGIN_CAPTURE
   {
+    lmp->update->setup_dirty = 1;
+
     // error if box does not exist or tags not defined
 
     int flag = 0;
@@ -53,6 +53,8 @@ void *lammps_extract_global(void *, char *);
 void lammps_extract_box(void *, double *, double *,
                         double *, double *, double *, int *, int *);
 void *lammps_extract_atom(void *, char *);
+void *lammps_extract_atom_view(void *, char *, int *, int64_t *);
+int64_t lammps_atom_epoch(void *);
 void *lammps_extract_compute(void *, char *, int, int);
 void *lammps_extract_fix(void *, char *, int, int, int, int);
 void *lammps_extract_variable(void *, char *, char *);
@@ -60,6 +62,11 @@ void *lammps_extract_variable(void *, char *, char *);
 double lammps_get_thermo(void *, char *);
 int lammps_get_natoms(void *);
 
+void *lammps_gather_plan_create(void *, int, char **, char **, int *);
+int lammps_gather_plan_size(void *);
+void lammps_gather_plan_execute(void *, void *, double *);
+void lammps_gather_plan_destroy(void *);
+
 int lammps_set_variable(void *, char *, char *);
 void lammps_reset_box(void *, double *, double *, double, double, double);
 
@@ -69,6 +76,24 @@ void lammps_gather_atoms_subset(void *, char *, int, int, int, int *, void *);
 void lammps_scatter_atoms(void *, char *, int, int, void *);
 void lammps_scatter_atoms_subset(void *, char *, int, int, int, int *, void *);
 
+/* access to per-rank frames buffered by a dump ring command */
+
+int lammps_frame_count(void *, char *);
+#if defined(LAMMPS_BIGBIG) || defined(LAMMPS_SMALLBIG)
+double *lammps_extract_frame(void *, char *, int, int64_t *, int *, int *);
+#else
+double *lammps_extract_frame(void *, char *, int, int *, int *, int *);
+#endif
+double *lammps_extract_frame_box(void *, char *, int);
+void lammps_clear_frames(void *, char *);
+
+#if defined(LAMMPS_BIGBIG) || defined(LAMMPS_SMALLBIG)
+typedef void (*FrameFnPtr)(void *, int64_t, int);
+#else
+typedef void (*FrameFnPtr)(void *, int, int);
+#endif
+int lammps_set_frame_callback(void *, char *, FrameFnPtr, void *);
+
 #if defined(LAMMPS_BIGBIG)
 typedef void (*FixExternalFnPtr)(void *, int64_t, int, int64_t *, double **, double **);
 void lammps_set_fix_external_callback(void *, char *, FixExternalFnPtr, void*);
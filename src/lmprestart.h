@@ -15,6 +15,7 @@
 #define LMP_RESTART_H
 
 #define MAGIC_STRING "LammpS RestartT"
+#define DELTA_MAGIC_STRING "LammpS DeltA"
 #define ENDIAN 0x0001
 #define ENDIANSWAP 0x1000
 #define FORMAT_REVISION 2
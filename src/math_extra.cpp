@@ -226,6 +226,140 @@ void richardson(double *q, double *m, double *w, double *moments, double dtq)
   MathExtra::qnormalize(q);
 }
 
+/* ----------------------------------------------------------------------
+   batched form of mq_to_omega + richardson for time integrators
+   q,m,moments hold pointers to the quaternion, angular momentum and
+   principal moments of n atoms; each is updated exactly as the scalar
+   call sequence would, but the per-atom state is staged in unit-stride
+   buffers so the loop over the batch has no carried dependencies and
+   can be vectorized by the compiler
+------------------------------------------------------------------------- */
+
+void richardson_batch(int n, double **q, double **m, double **moments,
+                      double dtq)
+{
+  double qw[RICHARDSON_BATCH],qi[RICHARDSON_BATCH];
+  double qj[RICHARDSON_BATCH],qk[RICHARDSON_BATCH];
+  double mx[RICHARDSON_BATCH],my[RICHARDSON_BATCH],mz[RICHARDSON_BATCH];
+  double i0[RICHARDSON_BATCH],i1[RICHARDSON_BATCH],i2[RICHARDSON_BATCH];
+
+  for (int start = 0; start < n; start += RICHARDSON_BATCH) {
+    int nb = n - start;
+    if (nb > RICHARDSON_BATCH) nb = RICHARDSON_BATCH;
+
+    for (int k = 0; k < nb; k++) {
+      double *qone = q[start+k];
+      qw[k] = qone[0]; qi[k] = qone[1]; qj[k] = qone[2]; qk[k] = qone[3];
+      double *mone = m[start+k];
+      mx[k] = mone[0]; my[k] = mone[1]; mz[k] = mone[2];
+      double *ione = moments[start+k];
+      i0[k] = ione[0]; i1[k] = ione[1]; i2[k] = ione[2];
+    }
+
+    for (int k = 0; k < nb; k++) {
+      double w0 = qw[k], w1 = qi[k], w2 = qj[k], w3 = qk[k];
+
+      // rotation matrix from current quat
+
+      double r00 = w0*w0 + w1*w1 - w2*w2 - w3*w3;
+      double r01 = 2.0 * (w1*w2 - w0*w3);
+      double r02 = 2.0 * (w1*w3 + w0*w2);
+      double r10 = 2.0 * (w1*w2 + w0*w3);
+      double r11 = w0*w0 - w1*w1 + w2*w2 - w3*w3;
+      double r12 = 2.0 * (w2*w3 - w0*w1);
+      double r20 = 2.0 * (w1*w3 - w0*w2);
+      double r21 = 2.0 * (w2*w3 + w0*w1);
+      double r22 = w0*w0 - w1*w1 - w2*w2 + w3*w3;
+
+      // omega in space frame from angmom, as in mq_to_omega
+
+      double wb0 = r00*mx[k] + r10*my[k] + r20*mz[k];
+      double wb1 = r01*mx[k] + r11*my[k] + r21*mz[k];
+      double wb2 = r02*mx[k] + r12*my[k] + r22*mz[k];
+      wb0 = (i0[k] == 0.0) ? 0.0 : wb0/i0[k];
+      wb1 = (i1[k] == 0.0) ? 0.0 : wb1/i1[k];
+      wb2 = (i2[k] == 0.0) ? 0.0 : wb2/i2[k];
+      double wx = r00*wb0 + r01*wb1 + r02*wb2;
+      double wy = r10*wb0 + r11*wb1 + r12*wb2;
+      double wz = r20*wb0 + r21*wb1 + r22*wb2;
+
+      // full update from dq/dt = 1/2 w q
+
+      double wq0 = -wx*w1 - wy*w2 - wz*w3;
+      double wq1 = w0*wx + wy*w3 - wz*w2;
+      double wq2 = w0*wy + wz*w1 - wx*w3;
+      double wq3 = w0*wz + wx*w2 - wy*w1;
+
+      double qf0 = w0 + dtq * wq0;
+      double qf1 = w1 + dtq * wq1;
+      double qf2 = w2 + dtq * wq2;
+      double qf3 = w3 + dtq * wq3;
+      double norm = 1.0 / sqrt(qf0*qf0 + qf1*qf1 + qf2*qf2 + qf3*qf3);
+      qf0 *= norm; qf1 *= norm; qf2 *= norm; qf3 *= norm;
+
+      // 1st half update from dq/dt = 1/2 w q
+
+      double qh0 = w0 + 0.5*dtq * wq0;
+      double qh1 = w1 + 0.5*dtq * wq1;
+      double qh2 = w2 + 0.5*dtq * wq2;
+      double qh3 = w3 + 0.5*dtq * wq3;
+      norm = 1.0 / sqrt(qh0*qh0 + qh1*qh1 + qh2*qh2 + qh3*qh3);
+      qh0 *= norm; qh1 *= norm; qh2 *= norm; qh3 *= norm;
+
+      // re-compute omega at 1/2 step from m at 1/2 step and q at 1/2 step
+
+      r00 = qh0*qh0 + qh1*qh1 - qh2*qh2 - qh3*qh3;
+      r01 = 2.0 * (qh1*qh2 - qh0*qh3);
+      r02 = 2.0 * (qh1*qh3 + qh0*qh2);
+      r10 = 2.0 * (qh1*qh2 + qh0*qh3);
+      r11 = qh0*qh0 - qh1*qh1 + qh2*qh2 - qh3*qh3;
+      r12 = 2.0 * (qh2*qh3 - qh0*qh1);
+      r20 = 2.0 * (qh1*qh3 - qh0*qh2);
+      r21 = 2.0 * (qh2*qh3 + qh0*qh1);
+      r22 = qh0*qh0 - qh1*qh1 - qh2*qh2 + qh3*qh3;
+
+      wb0 = r00*mx[k] + r10*my[k] + r20*mz[k];
+      wb1 = r01*mx[k] + r11*my[k] + r21*mz[k];
+      wb2 = r02*mx[k] + r12*my[k] + r22*mz[k];
+      wb0 = (i0[k] == 0.0) ? 0.0 : wb0/i0[k];
+      wb1 = (i1[k] == 0.0) ? 0.0 : wb1/i1[k];
+      wb2 = (i2[k] == 0.0) ? 0.0 : wb2/i2[k];
+      wx = r00*wb0 + r01*wb1 + r02*wb2;
+      wy = r10*wb0 + r11*wb1 + r12*wb2;
+      wz = r20*wb0 + r21*wb1 + r22*wb2;
+
+      // 2nd half update from dq/dt = 1/2 w q
+
+      wq0 = -wx*qh1 - wy*qh2 - wz*qh3;
+      wq1 = qh0*wx + wy*qh3 - wz*qh2;
+      wq2 = qh0*wy + wz*qh1 - wx*qh3;
+      wq3 = qh0*wz + wx*qh2 - wy*qh1;
+
+      qh0 += 0.5*dtq * wq0;
+      qh1 += 0.5*dtq * wq1;
+      qh2 += 0.5*dtq * wq2;
+      qh3 += 0.5*dtq * wq3;
+      norm = 1.0 / sqrt(qh0*qh0 + qh1*qh1 + qh2*qh2 + qh3*qh3);
+      qh0 *= norm; qh1 *= norm; qh2 *= norm; qh3 *= norm;
+
+      // corrected Richardson update
+
+      qh0 = 2.0*qh0 - qf0;
+      qh1 = 2.0*qh1 - qf1;
+      qh2 = 2.0*qh2 - qf2;
+      qh3 = 2.0*qh3 - qf3;
+      norm = 1.0 / sqrt(qh0*qh0 + qh1*qh1 + qh2*qh2 + qh3*qh3);
+      qw[k] = qh0*norm; qi[k] = qh1*norm;
+      qj[k] = qh2*norm; qk[k] = qh3*norm;
+    }
+
+    for (int k = 0; k < nb; k++) {
+      double *qone = q[start+k];
+      qone[0] = qw[k]; qone[1] = qi[k]; qone[2] = qj[k]; qone[3] = qk[k];
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    apply evolution operators to quat, quat momentum
    Miller et al., J Chem Phys. 116, 8649-8659 (2002)
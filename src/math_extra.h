@@ -89,6 +89,14 @@ namespace MathExtra {
   void rotate(double matrix[3][3], int i, int j, int k, int l,
               double s, double tau);
   void richardson(double *q, double *m, double *w, double *moments, double dtq);
+
+  // batched version of the omega + Richardson update for integrators:
+  // callers gather up to RICHARDSON_BATCH quat/angmom/moments pointers
+  // and the block is processed with unit-stride staging buffers
+
+  static const int RICHARDSON_BATCH = 16;
+  void richardson_batch(int n, double **q, double **m, double **moments,
+                        double dtq);
   void no_squish_rotate(int k, double *p, double *q, double *inertia,
                         double dt);
 
@@ -546,3 +546,90 @@ double MathSpecial::fm_exp(double x)
 #endif
 }
 
+
+/* ----------------------------------------------------------------------
+   array-at-a-time transcendentals
+   the loops below are branch-free: range limits are handled by clamping
+   and the exponent is assembled with shifts instead of the udi_t struct
+   so that compilers can auto-vectorize the whole loop body
+------------------------------------------------------------------------- */
+
+// exp2(x) for x clamped to the normal range, same Pade kernel as exp2_x86
+
+static inline double fm_exp2_nobranch(double x)
+{
+    if (x < -1022.0) x = -1022.0;
+    if (x > 1023.0) x = 1023.0;
+
+    double ipart = floor(x+0.5);
+    double fpart = x - ipart;
+
+    udi_t epart;
+    epart.u = (uint64_t) ((int64_t) ipart + 1023) << 52;
+
+    double z = fpart*fpart;
+
+    double px =       fm_exp2_p[0];
+    px = px*z + fm_exp2_p[1];
+    double qx =   z + fm_exp2_q[0];
+    px = px*z + fm_exp2_p[2];
+    qx = qx*z + fm_exp2_q[1];
+
+    px = px * fpart;
+
+    return epart.f*(1.0 + 2.0*(px/(qx-px)));
+}
+
+// erfc(x)/exp(-x*x) for x >= 0, Abramowitz & Stegun 7.1.26
+
+#define FM_ERFC_P  0.3275911
+#define FM_ERFC_A1 0.254829592
+#define FM_ERFC_A2 -0.284496736
+#define FM_ERFC_A3 1.421413741
+#define FM_ERFC_A4 -1.453152027
+#define FM_ERFC_A5 1.061405429
+
+/* ---------------------------------------------------------------------- */
+
+void MathSpecial::vexp(int n, const double *x, double *y)
+{
+    for (int i = 0; i < n; i++)
+        y[i] = fm_exp2_nobranch(FM_DOUBLE_LOG2OFE * x[i]);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MathSpecial::verfc(int n, const double *x, double *y)
+{
+    for (int i = 0; i < n; i++) {
+        double t = 1.0 / (1.0 + FM_ERFC_P*x[i]);
+        double poly = t * (FM_ERFC_A1 + t*(FM_ERFC_A2 + t*(FM_ERFC_A3 +
+                           t*(FM_ERFC_A4 + t*FM_ERFC_A5))));
+        y[i] = poly * fm_exp2_nobranch(-FM_DOUBLE_LOG2OFE * x[i]*x[i]);
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MathSpecial::vrsqrt(int n, const double *x, double *y)
+{
+    for (int i = 0; i < n; i++) y[i] = 1.0/sqrt(x[i]);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MathSpecial::vewald(int n, double g, const double *rsq,
+                         double *rinv, double *erfc, double *expm2)
+{
+    for (int i = 0; i < n; i++) {
+        double ri = 1.0/sqrt(rsq[i]);
+        double grij = g * rsq[i] * ri;
+        double t = 1.0 / (1.0 + FM_ERFC_P*grij);
+        double poly = t * (FM_ERFC_A1 + t*(FM_ERFC_A2 + t*(FM_ERFC_A3 +
+                           t*(FM_ERFC_A4 + t*FM_ERFC_A5))));
+        double e = fm_exp2_nobranch(-FM_DOUBLE_LOG2OFE * grij*grij);
+        rinv[i] = ri;
+        expm2[i] = e;
+        erfc[i] = poly * e;
+    }
+}
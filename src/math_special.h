@@ -30,6 +30,30 @@ namespace MathSpecial {
 // fast e**x function for little endian CPUs, falls back to libc on other platforms
   extern double fm_exp(double x);
 
+  // array-at-a-time transcendentals for inner kernels
+  // branch-free loops over contiguous data, written so compilers
+  //   auto-vectorize them; safe to call with n = 0
+
+  // y[i] = exp(x[i]), relative error < 4 ulp (Pade 2/2 fraction, exact
+  //   exponent scaling); arguments are clamped to the normal range, so
+  //   the result saturates near 1e-308 / 1e308 instead of 0 / inf
+  extern void vexp(int n, const double *x, double *y);
+
+  // y[i] = erfc(x[i]) for x >= 0, absolute error < 1.5e-7
+  //   (Abramowitz & Stegun 7.1.26, the same fit the coul/long pair
+  //   styles use inline)
+  extern void verfc(int n, const double *x, double *y);
+
+  // y[i] = 1/sqrt(x[i]) for x > 0, error < 1.5 ulp
+  //   (two correctly rounded operations)
+  extern void vrsqrt(int n, const double *x, double *y);
+
+  // fused entry point for the untabulated coul/long inner loop:
+  //   rinv[i] = 1/sqrt(rsq[i]), expm2[i] = exp(-(g*r)^2),
+  //   erfc[i] = erfc(g*r), with the erfc/exp accuracy quoted above
+  extern void vewald(int n, double g, const double *rsq,
+                     double *rinv, double *erfc, double *expm2);
+
   // scaled error function complement exp(x*x)*erfc(x) for coul/long styles
 
   static inline double my_erfcx(const double x)
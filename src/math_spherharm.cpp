@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "math_spherharm.h"
+
+using namespace LAMMPS_NS::MathConst;
+
+/* ----------------------------------------------------------------------
+   batched evaluation of a spherical harmonic radius expansion
+
+   same recurrence structure as the scalar loops in the SPHERICALHARM
+   styles, restructured so that each (n,m) term is applied to all points
+   of the block in a unit-stride inner loop; the per-(n,m) normalization
+   factors depend only on n and m and are hoisted out of the point loops
+------------------------------------------------------------------------- */
+
+void MathSpherharm::expand_radius_block(const int np, const int maxn,
+                                        const double *coeffs,
+                                        const double *theta, const double *phi,
+                                        double *rad)
+{
+  int i,n,m,nloc,loc;
+  double fact;
+
+  double x[SHBLOCK];
+  double cosp[SHBLOCK],sinp[SHBLOCK];
+  double cosm[(SHMAXDEGREE+1)*SHBLOCK],sinm[(SHMAXDEGREE+1)*SHBLOCK];
+  double pnm_m2[(SHMAXDEGREE+1)*SHBLOCK],pnm_m1[(SHMAXDEGREE+1)*SHBLOCK];
+  double pnm_nn[SHBLOCK];
+
+  for (i = 0; i < np; i++) {
+    x[i] = cos(theta[i]);
+    cosp[i] = cos(phi[i]);
+    sinp[i] = sin(phi[i]);
+    cosm[SHBLOCK+i] = cosp[i];
+    sinm[SHBLOCK+i] = sinp[i];
+  }
+
+  // multiples of phi by the angle addition recurrence
+
+  for (m = 2; m <= maxn; m++)
+    for (i = 0; i < np; i++) {
+      cosm[m*SHBLOCK+i] =
+        cosm[(m-1)*SHBLOCK+i]*cosp[i]-sinm[(m-1)*SHBLOCK+i]*sinp[i];
+      sinm[m*SHBLOCK+i] =
+        sinm[(m-1)*SHBLOCK+i]*cosp[i]+cosm[(m-1)*SHBLOCK+i]*sinp[i];
+    }
+
+  for (i = 0; i < np; i++)
+    rad[i] = coeffs[0]*sqrt(1.0/(4.0*MY_PI));
+
+  for (n = 1; n <= maxn; n++) {
+    nloc = n*(n+1);
+    if (n == 1) {
+      for (i = 0; i < np; i++) {
+        pnm_m2[i] = plegendre(1,0,x[i]);
+        rad[i] += coeffs[4]*pnm_m2[i];
+        pnm_m2[SHBLOCK+i] = plegendre(1,1,x[i]);
+        rad[i] += (coeffs[2]*cosm[SHBLOCK+i]-coeffs[3]*sinm[SHBLOCK+i])*
+          2.0*pnm_m2[SHBLOCK+i];
+      }
+    } else if (n == 2) {
+      for (i = 0; i < np; i++) {
+        pnm_m1[i] = plegendre(2,0,x[i]);
+        rad[i] += coeffs[10]*pnm_m1[i];
+      }
+      for (m = 2; m >= 1; m--) {
+        for (i = 0; i < np; i++) {
+          pnm_m1[m*SHBLOCK+i] = plegendre(2,m,x[i]);
+          rad[i] += (coeffs[nloc]*cosm[m*SHBLOCK+i]-
+                     coeffs[nloc+1]*sinm[m*SHBLOCK+i])*2.0*pnm_m1[m*SHBLOCK+i];
+        }
+        nloc += 2;
+      }
+      for (i = 0; i < np; i++)
+        pnm_nn[i] = pnm_m1[2*SHBLOCK+i];
+    } else {
+      loc = (n+1)*(n+2)-2;
+      for (i = 0; i < np; i++) {
+        double p = plegendre_recycle(n,0,x[i],pnm_m1[i],pnm_m2[i]);
+        pnm_m2[i] = pnm_m1[i];
+        pnm_m1[i] = p;
+        rad[i] += coeffs[loc]*p;
+      }
+      loc -= 2;
+      for (m = 1; m < n-1; m++) {
+        for (i = 0; i < np; i++) {
+          double p = plegendre_recycle(n,m,x[i],pnm_m1[m*SHBLOCK+i],
+                                       pnm_m2[m*SHBLOCK+i]);
+          pnm_m2[m*SHBLOCK+i] = pnm_m1[m*SHBLOCK+i];
+          pnm_m1[m*SHBLOCK+i] = p;
+          rad[i] += (coeffs[loc]*cosm[m*SHBLOCK+i]-
+                     coeffs[loc+1]*sinm[m*SHBLOCK+i])*2.0*p;
+        }
+        loc -= 2;
+      }
+
+      fact = sqrt((2.0*((double) n-1.0))+3.0);
+      for (i = 0; i < np; i++) {
+        double p = x[i]*fact*pnm_nn[i];
+        pnm_m2[(n-1)*SHBLOCK+i] = pnm_m1[(n-1)*SHBLOCK+i];
+        pnm_m1[(n-1)*SHBLOCK+i] = p;
+        rad[i] += (coeffs[loc]*cosm[(n-1)*SHBLOCK+i]-
+                   coeffs[loc+1]*sinm[(n-1)*SHBLOCK+i])*2.0*p;
+      }
+      loc -= 2;
+
+      fact = sqrt((2.0*((double) n-1.0)+3.0)/(2.0*((double) n-1.0)+2.0));
+      for (i = 0; i < np; i++) {
+        double p = -sqrt(1.0-(x[i]*x[i]))*fact*pnm_nn[i];
+        pnm_nn[i] = p;
+        pnm_m1[n*SHBLOCK+i] = p;
+        rad[i] += (coeffs[loc]*cosm[n*SHBLOCK+i]-
+                   coeffs[loc+1]*sinm[n*SHBLOCK+i])*2.0*p;
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   fill one basis cache column with P_n^m(x) for all 0 <= m <= n <= maxn
+   seeds each m-diagonal from scratch and walks the degree recurrence up
+------------------------------------------------------------------------- */
+
+void MathSpherharm::plegendre_table(const int maxn, const double x,
+                                    double *pnm)
+{
+  int n,m;
+
+  for (m = 0; m <= maxn; m++) {
+    pnm[basis_index(m,m)] = plegendre(m,m,x);
+    if (m < maxn)
+      pnm[basis_index(m+1,m)] = x*sqrt(2.0*m+3.0)*pnm[basis_index(m,m)];
+    for (n = m+2; n <= maxn; n++)
+      pnm[basis_index(n,m)] =
+        plegendre_recycle(n,m,x,pnm[basis_index(n-1,m)],
+                          pnm[basis_index(n-2,m)]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   radius expansion for a row of np points sharing one theta node
+   the cached Legendre column replaces all recurrence work; the inner
+   loops run over the phi points with unit stride
+------------------------------------------------------------------------- */
+
+void MathSpherharm::expand_radius_row(const int maxn, const double *coeffs,
+                                      const double *pnm, const int np,
+                                      const double *phi, double *rad)
+{
+  int i,n,m;
+
+  double cosp[SHBLOCK],sinp[SHBLOCK];
+  double cosm[(SHMAXDEGREE+1)*SHBLOCK],sinm[(SHMAXDEGREE+1)*SHBLOCK];
+
+  for (i = 0; i < np; i++) {
+    cosp[i] = cos(phi[i]);
+    sinp[i] = sin(phi[i]);
+    cosm[SHBLOCK+i] = cosp[i];
+    sinm[SHBLOCK+i] = sinp[i];
+  }
+  for (m = 2; m <= maxn; m++)
+    for (i = 0; i < np; i++) {
+      cosm[m*SHBLOCK+i] =
+        cosm[(m-1)*SHBLOCK+i]*cosp[i]-sinm[(m-1)*SHBLOCK+i]*sinp[i];
+      sinm[m*SHBLOCK+i] =
+        sinm[(m-1)*SHBLOCK+i]*cosp[i]+cosm[(m-1)*SHBLOCK+i]*sinp[i];
+    }
+
+  for (i = 0; i < np; i++)
+    rad[i] = coeffs[0]*sqrt(1.0/(4.0*LAMMPS_NS::MathConst::MY_PI));
+
+  // within degree n the (real,imag) pair for order m sits at
+  // (n+1)*(n+2)-2-2*m, the walk used by the coefficient files
+
+  for (n = 1; n <= maxn; n++) {
+    int base = (n+1)*(n+2)-2;
+    double p = pnm[basis_index(n,0)];
+    for (i = 0; i < np; i++)
+      rad[i] += coeffs[base]*p;
+    for (m = 1; m <= n; m++) {
+      p = 2.0*pnm[basis_index(n,m)];
+      double cre = coeffs[base-2*m];
+      double cim = coeffs[base-2*m+1];
+      for (i = 0; i < np; i++)
+        rad[i] += (cre*cosm[m*SHBLOCK+i]-cim*sinm[m*SHBLOCK+i])*p;
+    }
+  }
+}
@@ -0,0 +1,174 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_MATH_SPHERHARM_H
+#define LMP_MATH_SPHERHARM_H
+
+#include <cmath>
+#include "math_const.h"
+
+namespace MathSpherharm {
+
+  // width of a block of surface points evaluated together and the
+  // largest supported expansion degree; the associated Legendre
+  // recurrence state for a block is kept in [m][point] order so that
+  // the innermost loops run over points with unit stride and can be
+  // vectorized by the compiler
+
+  enum { SHBLOCK = 16 };
+  enum { SHMAXDEGREE = 32 };
+
+  // normalized associated Legendre polynomials and their recurrences,
+  // same math as the point-by-point routines in the SPHERICALHARM
+  // styles; caller guarantees 0 <= m <= l and |x| <= 1
+
+  inline double plegendre(const int l, const int m, const double x);
+  inline double plegendre_nn(const int l, const double x,
+                             const double Pnm_nn);
+  inline double plegendre_recycle(const int l, const int m, const double x,
+                                  const double pnm_m1, const double pnm_m2);
+
+  // evaluate the radius expansion r(theta,phi) of one shape for a block
+  // of np <= SHBLOCK surface points at once; coeffs is one per-type row
+  // of the degree-ordered coefficient table (real/imaginary pairs packed
+  // contiguously within each degree), maxn <= SHMAXDEGREE is the
+  // expansion degree; cos(m*phi) and sin(m*phi) are built by the angle
+  // addition recurrence instead of per-term libm calls
+
+  void expand_radius_block(const int np, const int maxn,
+                           const double *coeffs,
+                           const double *theta, const double *phi,
+                           double *rad);
+
+  // persistent basis cache for fixed evaluation points: the Legendre
+  // values depend only on theta, so a quadrature grid with nq unique
+  // theta nodes needs only nq cached columns, each reused for every
+  // phi, every shape type and every invocation
+
+  // # of (n,m) pairs for expansion degree maxn
+
+  inline int basis_count(const int maxn)
+  {
+    return ((maxn+1)*(maxn+2))/2;
+  }
+
+  // index of the cached value of P_n^m within a column
+
+  inline int basis_index(const int n, const int m)
+  {
+    return (n*(n+1))/2 + m;
+  }
+
+  // fill one cache column with P_n^m(x) for all 0 <= m <= n <= maxn
+
+  void plegendre_table(const int maxn, const double x, double *pnm);
+
+  // evaluate the radius expansion for np <= SHBLOCK points sharing one
+  // theta node (one cached column pnm) but different phi values
+
+  void expand_radius_row(const int maxn, const double *coeffs,
+                         const double *pnm, const int np,
+                         const double *phi, double *rad);
+
+  /* ----------------------------------------------------------------------
+     normalized associated Legendre polynomial P_l^m(x) from scratch
+  ------------------------------------------------------------------------- */
+
+  inline double plegendre(const int l, const int m, const double x)
+  {
+    int i,ll;
+    double fact,oldfact,pll,pmm,pmmp1,omx2;
+    pll = 0.0;
+    pmm = 1.0;
+    if (m > 0) {
+      omx2 = (1.0-x)*(1.0+x);
+      fact = 1.0;
+      for (i = 1; i <= m; i++) {
+        pmm *= omx2*fact/(fact+1.0);
+        fact += 2.0;
+      }
+    }
+    pmm = sqrt((2.0*m+1.0)*pmm/(4.0*LAMMPS_NS::MathConst::MY_PI));
+    if (m & 1) pmm = -pmm;
+    if (l == m) return pmm;
+    pmmp1 = x*sqrt(2.0*m+3.0)*pmm;
+    if (l == (m+1)) return pmmp1;
+    oldfact = sqrt(2.0*m+3.0);
+    for (ll = m+2; ll <= l; ll++) {
+      fact = sqrt((4.0*ll*ll-1.0)/(ll*ll-m*m));
+      pll = (x*pmmp1-pmm/oldfact)*fact;
+      oldfact = fact;
+      pmm = pmmp1;
+      pmmp1 = pll;
+    }
+    return pll;
+  }
+
+  /* ----------------------------------------------------------------------
+     P_l^l(x) from P_(l-1)^(l-1)(x)
+  ------------------------------------------------------------------------- */
+
+  inline double plegendre_nn(const int l, const double x,
+                             const double Pnm_nn)
+  {
+    double ll,llm1,fact;
+    ll = (double) l;
+    llm1 = 2.0*(ll-1.0);
+    fact = sqrt((llm1+3.0)/(llm1+2.0));
+    return -sqrt(1.0-(x*x))*fact*Pnm_nn;
+  }
+
+  /* ----------------------------------------------------------------------
+     P_l^m(x) from P_(l-1)^m(x) and P_(l-2)^m(x)
+  ------------------------------------------------------------------------- */
+
+  inline double plegendre_recycle(const int l, const int m, const double x,
+                                  const double pnm_m1, const double pnm_m2)
+  {
+    double fact,oldfact,ll,mm;
+    ll = (double) l;
+    mm = (double) m;
+    fact = sqrt((4.0*ll*ll-1.0)/(ll*ll-mm*mm));
+    oldfact = sqrt((4.0*(ll-1.0)*(ll-1.0)-1.0)/((ll-1.0)*(ll-1.0)-mm*mm));
+    return (x*pnm_m1-pnm_m2/oldfact)*fact;
+  }
+
+  /* ----------------------------------------------------------------------
+     (x + i y)^n for a unit vector x + i y = exp(i*phi) by binary
+     exponentiation: cos(n*phi) and sin(n*phi) without transcendentals
+  ------------------------------------------------------------------------- */
+
+  inline void cpow_unit(double x, double y, int n, double &u, double &v)
+  {
+    double ur = 1.0;
+    double vr = 0.0;
+    while (n > 0) {
+      if (n & 1) {
+        const double tmp = ur*x - vr*y;
+        vr = ur*y + vr*x;
+        ur = tmp;
+      }
+      n >>= 1;
+      if (n) {
+        const double tmp = x*x - y*y;
+        y = 2.0*x*y;
+        x = tmp;
+      }
+    }
+    u = ur;
+    v = vr;
+  }
+
+}
+
+#endif
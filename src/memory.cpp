@@ -13,6 +13,7 @@
 
 #include "memory.h"
 #include <cstdlib>
+#include <cstring>
 #include "error.h"
 #include "fmt/format.h"
 
@@ -20,25 +21,35 @@
 #ifndef LMP_INTEL_NO_TBB
 #define LMP_USE_TBB_ALLOCATOR
 #include "tbb/scalable_allocator.h"
-#else
-#include <cstring>
+#endif
+#endif
+
+#if defined(LMP_USER_INTEL) && !defined(LAMMPS_MEMALIGN) && !defined(_WIN32)
+#define LAMMPS_MEMALIGN 64
+#endif
+
+#if defined(LAMMPS_MEMALIGN) && !defined(LMP_USE_TBB_ALLOCATOR)
 #if defined(__APPLE__)
 #include <malloc/malloc.h>
 #else
 #include <malloc.h>
 #endif
 #endif
-#endif
 
-#if defined(LMP_USER_INTEL) && !defined(LAMMPS_MEMALIGN) && !defined(_WIN32)
-#define LAMMPS_MEMALIGN 64
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
 #endif
 
 using namespace LAMMPS_NS;
 
+// advise hugepage backing only for allocations of at least 4 MB
+
+#define HUGEPAGE_THRESH 4194304
+
 /* ---------------------------------------------------------------------- */
 
-Memory::Memory(LAMMPS *lmp) : Pointers(lmp) {}
+Memory::Memory(LAMMPS *lmp) : Pointers(lmp), tally_current(0), tally_peak(0) {}
 
 /* ----------------------------------------------------------------------
    safe malloc
@@ -64,6 +75,8 @@ void *Memory::smalloc(bigint nbytes, const char *name)
   if (ptr == NULL)
     error->one(FLERR,fmt::format("Failed to allocate {} bytes for array {}",
                                  nbytes,name));
+  hugepage_advise(ptr,nbytes);
+  tally(ptr,nbytes,name);
   return ptr;
 }
 
@@ -78,22 +91,27 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
     return NULL;
   }
 
+  untally(ptr);
+
 #if defined(LMP_USE_TBB_ALLOCATOR)
   ptr = scalable_aligned_realloc(ptr, nbytes, LAMMPS_MEMALIGN);
-#elif defined(LMP_INTEL_NO_TBB) && defined(LAMMPS_MEMALIGN) && \
-      defined(__INTEL_COMPILER)
+#elif defined(LAMMPS_MEMALIGN)
+
+  // realloc() does not preserve alignment
+  // if grown copy is misaligned, move it to an aligned allocation
 
   ptr = realloc(ptr, nbytes);
   uintptr_t offset = ((uintptr_t)(const void *)(ptr)) % LAMMPS_MEMALIGN;
   if (offset) {
     void *optr = ptr;
     ptr = smalloc(nbytes, name);
+    untally(ptr);
 #if defined(__APPLE__)
     memcpy(ptr, optr, MIN(nbytes,malloc_size(optr)));
 #elif defined(_WIN32) || defined(__MINGW32__)
     memcpy(ptr, optr, MIN(nbytes,_msize(optr)));
 #else
-    memcpy(ptr, optr, MIN(nbytes,malloc_usable_size(optr)));
+    memcpy(ptr, optr, MIN(nbytes,(bigint) malloc_usable_size(optr)));
 #endif
     free(optr);
   }
@@ -103,6 +121,8 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
   if (ptr == NULL)
     error->one(FLERR,fmt::format("Failed to reallocate {} bytes for array {}",
                                  nbytes,name));
+  hugepage_advise(ptr,nbytes);
+  tally(ptr,nbytes,name);
   return ptr;
 }
 
@@ -113,6 +133,7 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
 void Memory::sfree(void *ptr)
 {
   if (ptr == NULL) return;
+  untally(ptr);
   #if defined(LMP_USE_TBB_ALLOCATOR)
   scalable_aligned_free(ptr);
   #else
@@ -120,6 +141,78 @@ void Memory::sfree(void *ptr)
   #endif
 }
 
+/* ----------------------------------------------------------------------
+   advise kernel to back a large allocation with transparent hugepages
+   reduces TLB pressure for multi-Gbyte per-atom and neighbor arrays
+   advisory only: no-op if THP or madvise() are unavailable
+   madvise() requires a page-aligned range, so shrink range to page bounds
+------------------------------------------------------------------------- */
+
+void Memory::hugepage_advise(void *ptr, bigint nbytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (nbytes < HUGEPAGE_THRESH) return;
+  uintptr_t pagesize = (uintptr_t) sysconf(_SC_PAGESIZE);
+  uintptr_t lo = ((uintptr_t) ptr + pagesize-1) & ~(pagesize-1);
+  uintptr_t hi = ((uintptr_t) ptr + (uintptr_t) nbytes) & ~(pagesize-1);
+  if (hi > lo) madvise((void *) lo,hi-lo,MADV_HUGEPAGE);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   record/erase a live allocation for per-category accounting
+   category = portion of create/grow name before 1st ':', e.g. "atom"
+   also maintain running current/peak byte counts per category and overall
+------------------------------------------------------------------------- */
+
+void Memory::tally(void *ptr, bigint nbytes, const char *name)
+{
+  const char *colon = strchr(name,':');
+  std::string category;
+  if (colon) category.assign(name,colon-name);
+  else category = name;
+  tallies[ptr] = std::make_pair(category,nbytes);
+
+  std::pair<bigint,bigint> &cat = catbytes[category];
+  cat.first += nbytes;
+  if (cat.first > cat.second) cat.second = cat.first;
+  tally_current += nbytes;
+  if (tally_current > tally_peak) tally_peak = tally_current;
+}
+
+void Memory::untally(void *ptr)
+{
+  std::map<void *,std::pair<std::string,bigint> >::iterator it =
+    tallies.find(ptr);
+  if (it == tallies.end()) return;
+  catbytes[it->second.first].first -= it->second.second;
+  tally_current -= it->second.second;
+  tallies.erase(it);
+}
+
+/* ----------------------------------------------------------------------
+   sum live allocations per category, for the info command
+------------------------------------------------------------------------- */
+
+std::map<std::string,bigint> Memory::categories()
+{
+  std::map<std::string,bigint> sums;
+  std::map<std::string,std::pair<bigint,bigint> >::iterator it;
+  for (it = catbytes.begin(); it != catbytes.end(); ++it)
+    if (it->second.first) sums[it->first] = it->second.first;
+  return sums;
+}
+
+/* ----------------------------------------------------------------------
+   per-category (current,peak) byte counts, for the info command
+   categories whose allocations were all freed are retained with current = 0
+------------------------------------------------------------------------- */
+
+std::map<std::string,std::pair<bigint,bigint> > Memory::highwater()
+{
+  return catbytes;
+}
+
 /* ----------------------------------------------------------------------
    erroneous usage of templated create/grow functions
 ------------------------------------------------------------------------- */
@@ -15,6 +15,9 @@
 #define LMP_MEMORY_H
 
 #include "pointers.h"
+#include <map>
+#include <string>
+#include <utility>
 
 namespace LAMMPS_NS {
 
@@ -27,6 +30,28 @@ class Memory : protected Pointers {
   void sfree(void *);
   void fail(const char *);
 
+  std::map<std::string,bigint> categories();
+  std::map<std::string,std::pair<bigint,bigint> > highwater();
+  bigint tallied_current() const {return tally_current;}
+  bigint tallied_peak() const {return tally_peak;}
+
+ private:
+  // live allocations: ptr -> (category,bytes)
+  // category = portion of create/grow name before 1st ':'
+
+  std::map<void *,std::pair<std::string,bigint> > tallies;
+
+  // running per-category (current,peak) byte counts and global totals
+
+  std::map<std::string,std::pair<bigint,bigint> > catbytes;
+  bigint tally_current,tally_peak;
+
+  void tally(void *, bigint, const char *);
+  void untally(void *);
+  void hugepage_advise(void *, bigint);
+
+ public:
+
 /* ----------------------------------------------------------------------
    create/grow/destroy vecs and multidim arrays with contiguous memory blocks
    only use with primitive data types, e.g. 1d vec of ints, 2d array of doubles
@@ -111,6 +136,8 @@ class Memory : protected Pointers {
 
 /* ----------------------------------------------------------------------
    create a 2d array
+   data is allocated as a single contiguous block, so array[0] is a
+     valid flat view of all n1*n2 values, callers may rely on this
 ------------------------------------------------------------------------- */
 
   template <typename TYPE>
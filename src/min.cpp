@@ -85,6 +85,9 @@ Min::Min(LAMMPS *lmp) : Pointers(lmp)
 
   external_force_clear = 0;
 
+  trial_eval = 0;
+  trial_nflag = -1;
+
   kokkosable = 0;
 }
 
@@ -502,8 +505,16 @@ double Min::energy_force(int resetflag)
 {
   // check for reneighboring
   // always communicate since minimizer moved atoms
-
-  int nflag = neighbor->decide();
+  // during backtracking line-search trials the decision from the first
+  //   trial is reused: later trial configs lie between it and the search
+  //   origin, so they cannot trigger a rebuild the first trial did not
+
+  int nflag;
+  if (trial_eval && trial_nflag == 0) nflag = 0;
+  else {
+    nflag = neighbor->decide();
+    if (trial_eval && nflag == 0) trial_nflag = 0;
+  }
 
   if (nflag == 0) {
     timer->stamp();
@@ -541,7 +552,14 @@ double Min::energy_force(int resetflag)
     }
   }
 
-  ev_set(update->ntimestep);
+  // trial evaluations only need the global energy and forces:
+  // skip virial and per-atom tallies regardless of what computes
+  // want on this timestep, the accepted config is re-evaluated if needed
+
+  if (trial_eval) {
+    eflag = 1;
+    vflag = 0;
+  } else ev_set(update->ntimestep);
   force_clear();
 
   timer->stamp();
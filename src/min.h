@@ -27,6 +27,9 @@ class Min : protected Pointers {
   int stop_condition;
   char *stopstr;
   int searchflag;     // 0 if damped dynamics, 1 if sub-cycles on local search
+  int trial_eval;     // 1 during line-search trial evaluations: only the
+                      // global energy and forces are needed, so force styles
+                      // may skip virial and per-atom accumulation
 
   Min(class LAMMPS *);
   virtual ~Min();
@@ -61,6 +64,8 @@ class Min : protected Pointers {
 
  protected:
   int eflag,vflag;            // flags for energy/virial computation
+  int trial_nflag;            // cached reneighbor decision for current
+                              // line search, -1 = not yet decided
   int virial_style;           // compute virial explicitly or implicitly
   int external_force_clear;   // clear forces locally or externally
 
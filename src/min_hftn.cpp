@@ -708,10 +708,17 @@ bool MinHFTN::compute_inner_cg_step_(const double    dTrustRadius,
                        false,
                        dDummyEnergy);
 
-    //---- CALCULATE  d_i^T H d_i AND d_i^T d_i.
+    //---- CALCULATE ALL DOT PRODUCTS THIS ITERATION NEEDS IN ONE FUSED
+    //---- REDUCTION:  d_i^T H d_i, d_i^T d_i, r_i^T H d_i, (H d_i)^T H d_i,
+    //---- AND p_i^T d_i.  THE LAST THREE FEED RECURRENCES FOR |r_i+1|^2
+    //---- AND |p_i+1|^2, REPLACING THE SEPARATE REDUCTIONS FORMERLY MADE
+    //---- AFTER THE VECTOR UPDATES.
     double  dDHD;
     double  dDD;
-    calc_dhd_dd_using_mpi_ (dDHD, dDD);
+    double  dRdotHD;
+    double  dHDdotHD;
+    double  dPdotD;
+    calc_cg_dots_using_mpi_ (dDHD, dDD, dRdotHD, dHDdotHD, dPdotD);
 
     //---- HANDLE NEGATIVE CURVATURE.
     if (dDHD <= (MACHINE_EPS * dDD)) {
@@ -719,7 +726,7 @@ bool MinHFTN::compute_inner_cg_step_(const double    dTrustRadius,
       //---- WHICH MAKES A BETTER PREDICTED REDUCTION.
       //---- p_i^T H(x_k) d_i AND grad_i^T d_i.
 
-      double  dPdotD  = calc_dot_prod_using_mpi_ (VEC_CG_P, VEC_CG_D);
+      //---- p_i^T d_i IS ALREADY KNOWN FROM THE FUSED REDUCTION ABOVE.
       double  dPdotHD = calc_dot_prod_using_mpi_ (VEC_CG_P, VEC_CG_HD);
 
       //---- MOVE TO X_K AND COMPUTE ENERGY AND FORCES.
@@ -777,43 +784,59 @@ bool MinHFTN::compute_inner_cg_step_(const double    dTrustRadius,
     //fprintf (_fpPrint, "     alpha = %11.8f  neval=%4d\n", dAlpha, neval);
 
     //---- p_i+1 = p_i + alpha_i d_i
+    //---- r_i+1 = r_i - alpha_i H d_i
+    //---- FUSED INTO ONE SWEEP OVER EACH SEGMENT.
     //---- (SAVE THE CURRENT p_i IN CASE THE STEP HAS TO BE SHORTENED.)
     if (nextra_global) {
       double *  pGlobal  = _daExtraGlobal[VEC_CG_P];
       double *  dGlobal  = _daExtraGlobal[VEC_CG_D];
       double *  d1Global = _daExtraGlobal[VEC_DIF1];
+      double *  rGlobal  = _daExtraGlobal[VEC_CG_R];
+      double *  hdGlobal = _daExtraGlobal[VEC_CG_HD];
       for (int  i = 0; i < nextra_global; i++) {
         d1Global[i] = pGlobal[i];
         pGlobal[i] += dAlpha * dGlobal[i];
+        rGlobal[i] -= dAlpha * hdGlobal[i];
       }
     }
     for (int  i = 0; i < nvec; i++) {
       _daAVectors[VEC_DIF1][i] = _daAVectors[VEC_CG_P][i];
       _daAVectors[VEC_CG_P][i] += dAlpha * _daAVectors[VEC_CG_D][i];
+      _daAVectors[VEC_CG_R][i] -= dAlpha * _daAVectors[VEC_CG_HD][i];
     }
     if (nextra_atom) {
       for (int  m = 0; m < nextra_atom; m++) {
         double *  pAtom  = _daExtraAtom[VEC_CG_P][m];
         double *  dAtom  = _daExtraAtom[VEC_CG_D][m];
         double *  d1Atom = _daExtraAtom[VEC_DIF1][m];
+        double *  rAtom  = _daExtraAtom[VEC_CG_R][m];
+        double *  hdAtom = _daExtraAtom[VEC_CG_HD][m];
         int  n = extra_nlen[m];
         for (int  i = 0; i < n; i++) {
           d1Atom[i] = pAtom[i];
           pAtom[i] += dAlpha * dAtom[i];
+          rAtom[i] -= dAlpha * hdAtom[i];
         }
       }
     }
 
-    //---- COMPUTE VECTOR PRODUCTS  p_i+1^T p_i+1 AND p_i^T d_i.
-    double  dPnewDotPnew;
-    double  dPoldDotD;
-    calc_ppnew_pdold_using_mpi_ (dPnewDotPnew, dPoldDotD);
+    //---- COMPUTE  p_i+1^T p_i+1 AND r_i+1^T r_i+1 FROM THE FUSED DOT
+    //---- PRODUCTS INSTEAD OF FRESH REDUCTIONS:
+    //----   |p + alpha d|^2 = |p|^2 + 2 alpha p^T d + alpha^2 |d|^2
+    //----   |r - alpha Hd|^2 = |r|^2 - 2 alpha r^T Hd + alpha^2 |Hd|^2
+    //---- THE RECURRENCES CAN DRIFT FROM THE TRUE NORMS IN FINITE
+    //---- PRECISION, BUT THE INNER LOOP IS TRUNCATED AT A LOOSE TOLERANCE
+    //---- AND THE OUTER ITERATION RE-EVALUATES TRUE FORCES AT EVERY STEP.
+    double  dPnewDotPnew = MAX (0.0, dPP + 2.0 * dAlpha * dPdotD
+                                + dAlpha * dAlpha * dDD);
+    double  dPoldDotD = dPdotD;
 
     nStepType = CGSTEP_UNDETERMINED;
 
     //---- IF STEP LENGTH IS TOO LARGE, THEN REDUCE IT AND RETURN.
     double  tau;
-    if (step_exceeds_TR_ (dTrustRadius, dPP, dPoldDotD, dDD, tau)) {
+    if (step_exceeds_TR_ (dTrustRadius, sqrt (dPnewDotPnew),
+                          dPP, dPoldDotD, dDD, tau)) {
       adjust_step_to_tau_ (tau);
       nStepType = CGSTEP_TO_TR;
     }
@@ -828,25 +851,8 @@ bool MinHFTN::compute_inner_cg_step_(const double    dTrustRadius,
 
     dStepLength2 = sqrt (dPnewDotPnew);
 
-    //---- r_i+1 = r_i - alpha * H d_i
-    if (nextra_global) {
-      double *  rGlobal  = _daExtraGlobal[VEC_CG_R];
-      double *  hdGlobal = _daExtraGlobal[VEC_CG_HD];
-      for (int  i = 0; i < nextra_global; i++)
-        rGlobal[i] -= dAlpha * hdGlobal[i];
-    }
-    for (int  i = 0; i < nvec; i++)
-      _daAVectors[VEC_CG_R][i] -= dAlpha * _daAVectors[VEC_CG_HD][i];
-    if (nextra_atom) {
-      for (int  m = 0; m < nextra_atom; m++) {
-        double *  rAtom  = _daExtraAtom[VEC_CG_R][m];
-        double *  hdAtom = _daExtraAtom[VEC_CG_HD][m];
-        int  n = extra_nlen[m];
-        for (int  i = 0; i < n; i++)
-          rAtom[i] -= dAlpha * hdAtom[i];
-      }
-    }
-    double  dRnewDotRnew = calc_dot_prod_using_mpi_ (VEC_CG_R, VEC_CG_R);
+    double  dRnewDotRnew = MAX (0.0, dRR - 2.0 * dAlpha * dRdotHD
+                                + dAlpha * dAlpha * dHDdotHD);
 
     //---- IF RESIDUAL IS SMALL ENOUGH, THEN RETURN THE CURRENT STEP.
     if (sqrt (dRnewDotRnew) < dForceTol * dR0norm2) {
@@ -988,96 +994,76 @@ double MinHFTN::calc_grad_dot_v_using_mpi_(const int  nIx) const
 }
 
 /* ----------------------------------------------------------------------
-   Private method calc_dhd_dd_using_mpi_
+   Private method calc_cg_dots_using_mpi_
+   Compute all dot products one inner CG iteration needs with a single
+   fused reduction:
+     dDHD     = d^T H d
+     dDD      = d^T d
+     dRdotHD  = r^T H d
+     dHDdotHD = (H d)^T (H d)
+     dPdotD   = p^T d
+   The last three feed recurrences for the updated residual and step
+   norms, avoiding separate reductions after the vector updates.
 ------------------------------------------------------------------------- */
 
-void MinHFTN::calc_dhd_dd_using_mpi_(double &  dDHD,
-                                     double &  dDD) const
+void MinHFTN::calc_cg_dots_using_mpi_(double &  dDHD,
+                                      double &  dDD,
+                                      double &  dRdotHD,
+                                      double &  dHDdotHD,
+                                      double &  dPdotD) const
 {
-  double dDHDLocal = 0.0;
-  double dDDLocal  = 0.0;
+  double  daDotsLocal[5];
+  for (int  k = 0; k < 5; k++)
+    daDotsLocal[k] = 0.0;
+
   for (int  i = 0; i < nvec; i++) {
-    dDHDLocal += _daAVectors[VEC_CG_D][i] * _daAVectors[VEC_CG_HD][i];
-    dDDLocal  += _daAVectors[VEC_CG_D][i] * _daAVectors[VEC_CG_D][i];
+    double  dD  = _daAVectors[VEC_CG_D][i];
+    double  dHD = _daAVectors[VEC_CG_HD][i];
+    daDotsLocal[0] += dD * dHD;
+    daDotsLocal[1] += dD * dD;
+    daDotsLocal[2] += _daAVectors[VEC_CG_R][i] * dHD;
+    daDotsLocal[3] += dHD * dHD;
+    daDotsLocal[4] += _daAVectors[VEC_CG_P][i] * dD;
   }
   if (nextra_atom) {
     for (int  m = 0; m < nextra_atom; m++) {
       double *  dAtom  = _daExtraAtom[VEC_CG_D][m];
       double *  hdAtom = _daExtraAtom[VEC_CG_HD][m];
+      double *  rAtom  = _daExtraAtom[VEC_CG_R][m];
+      double *  pAtom  = _daExtraAtom[VEC_CG_P][m];
       int  n = extra_nlen[m];
       for (int  i = 0; i < n; i++) {
-        dDHDLocal += dAtom[i] * hdAtom[i];
-        dDDLocal += dAtom[i] * dAtom[i];
+        daDotsLocal[0] += dAtom[i] * hdAtom[i];
+        daDotsLocal[1] += dAtom[i] * dAtom[i];
+        daDotsLocal[2] += rAtom[i] * hdAtom[i];
+        daDotsLocal[3] += hdAtom[i] * hdAtom[i];
+        daDotsLocal[4] += pAtom[i] * dAtom[i];
       }
     }
   }
 
-  double  daDotsLocal[2];
-  daDotsLocal[0] = dDHDLocal;
-  daDotsLocal[1] = dDDLocal;
-  double  daDots[2];
-  MPI_Allreduce (daDotsLocal, daDots, 2, MPI_DOUBLE, MPI_SUM, world);
+  double  daDots[5];
+  MPI_Allreduce (daDotsLocal, daDots, 5, MPI_DOUBLE, MPI_SUM, world);
 
   if (nextra_global) {
     double *  dGlobal  = _daExtraGlobal[VEC_CG_D];
     double *  hdGlobal = _daExtraGlobal[VEC_CG_HD];
+    double *  rGlobal  = _daExtraGlobal[VEC_CG_R];
+    double *  pGlobal  = _daExtraGlobal[VEC_CG_P];
     for (int  i = 0; i < nextra_global; i++) {
       daDots[0] += dGlobal[i] * hdGlobal[i];
       daDots[1] += dGlobal[i] * dGlobal[i];
+      daDots[2] += rGlobal[i] * hdGlobal[i];
+      daDots[3] += hdGlobal[i] * hdGlobal[i];
+      daDots[4] += pGlobal[i] * dGlobal[i];
     }
   }
-  dDHD = daDots[0];
-  dDD  = daDots[1];
 
-  return;
-}
-
-/* ----------------------------------------------------------------------
-   Private method calc_ppnew_pdold_using_mpi_
-------------------------------------------------------------------------- */
-
-void MinHFTN::calc_ppnew_pdold_using_mpi_(double &  dPnewDotPnew,
-                                          double &  dPoldDotD) const
-{
-  double dPnewDotPnewLocal = 0.0;
-  double dPoldDotDLocal    = 0.0;
-  for (int  i = 0; i < nvec; i++) {
-    dPnewDotPnewLocal
-      += _daAVectors[VEC_CG_P][i] * _daAVectors[VEC_CG_P][i];
-    dPoldDotDLocal
-      += _daAVectors[VEC_DIF1][i] * _daAVectors[VEC_CG_D][i];
-  }
-  if (nextra_atom) {
-    for (int  m = 0; m < nextra_atom; m++) {
-      double *  dAtom  = _daExtraAtom[VEC_CG_D][m];
-      double *  pAtom  = _daExtraAtom[VEC_CG_P][m];
-      double *  d1Atom = _daExtraAtom[VEC_DIF1][m];
-      int  n = extra_nlen[m];
-      for (int  i = 0; i < n; i++) {
-        dPnewDotPnewLocal += pAtom[i] * pAtom[i];
-        dPoldDotDLocal += d1Atom[i] * dAtom[i];
-      }
-    }
-  }
-
-  double  daDotsLocal[2];
-  daDotsLocal[0] = dPnewDotPnewLocal;
-  daDotsLocal[1] = dPoldDotDLocal;
-  double  daDots[2];
-  MPI_Allreduce (daDotsLocal, daDots, 2, MPI_DOUBLE, MPI_SUM, world);
-
-  if (nextra_global) {
-    for (int  i = 0; i < nextra_global; i++) {
-      double *  dGlobal  = _daExtraGlobal[VEC_CG_D];
-      double *  pGlobal  = _daExtraGlobal[VEC_CG_P];
-      double *  d1Global = _daExtraGlobal[VEC_DIF1];
-      daDots[0] += pGlobal[i] * pGlobal[i];
-      daDots[1] += d1Global[i] * dGlobal[i];
-    }
-  }
-
-  dPnewDotPnew = daDots[0];
-  dPoldDotD    = daDots[1];
+  dDHD     = daDots[0];
+  dDD      = daDots[1];
+  dRdotHD  = daDots[2];
+  dHDdotHD = daDots[3];
+  dPdotD   = daDots[4];
 
   return;
 }
@@ -1127,18 +1113,17 @@ void MinHFTN::calc_plengths_using_mpi_(double &  dStepLength2,
 
 /* ----------------------------------------------------------------------
    Private method step_exceeds_TR_
+   The caller passes |p_i+1|_2, already known from the norm recurrence,
+   so no reduction is needed here.
 ------------------------------------------------------------------------- */
 
 bool MinHFTN::step_exceeds_TR_(const double    dTrustRadius,
+                               const double    dPnewNorm2,
                                const double    dPP,
                                const double    dPD,
                                const double    dDD,
                                double &  dTau) const
 {
-  double  dPnewNorm2;
-  double  dPnewNormInf;
-  calc_plengths_using_mpi_ (dPnewNorm2, dPnewNormInf);
-
   if (dPnewNorm2 > dTrustRadius) {
     dTau = compute_to_tr_ (dPP, dPD, dDD, dTrustRadius,
                            false, 0.0, 0.0, 0.0);
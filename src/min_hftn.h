@@ -81,13 +81,15 @@ class MinHFTN : public Min
   double  calc_dot_prod_using_mpi_ (const int  nIx1,
                                     const int  nIx2) const;
   double  calc_grad_dot_v_using_mpi_ (const int  nIx) const;
-  void    calc_dhd_dd_using_mpi_ (double &  dDHD,
-                                  double &  dDD) const;
-  void    calc_ppnew_pdold_using_mpi_ (double &  dPnewDotPnew,
-                                       double &  dPoldDotD) const;
+  void    calc_cg_dots_using_mpi_ (double &  dDHD,
+                                   double &  dDD,
+                                   double &  dRdotHD,
+                                   double &  dHDdotHD,
+                                   double &  dPdotD) const;
   void    calc_plengths_using_mpi_ (double &  dStepLength2,
                                     double &  dStepLengthInf) const;
   bool    step_exceeds_TR_ (const double    dTrustRadius,
+                            const double    dPnewNorm2,
                             const double    dPP,
                             const double    dPD,
                             const double    dDD,
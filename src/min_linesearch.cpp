@@ -30,6 +30,7 @@
 #include "pair.h"
 #include "output.h"
 #include "thermo.h"
+#include "update.h"
 
 using namespace LAMMPS_NS;
 
@@ -250,19 +251,29 @@ int MinLineSearch::linemin_backtrack(double eoriginal, double &alpha)
   // alpha_step(0.0,1);
 
   // backtrack with alpha until energy decrease is sufficient
+  // trial evaluations are energy/force only (no virial or per-atom
+  // tallies) and reuse the reneighbor decision of the first trial,
+  // since later trials lie between it and the search origin
+
+  trial_nflag = -1;
 
   while (1) {
+    trial_eval = 1;
     ecurrent = alpha_step(alpha,1);
+    trial_eval = 0;
 
     // if energy change is better than ideal, exit with success
+    // re-evaluate accepted config in full if this timestep needs
+    // more than the global energy (per-atom energy or any virial)
 
     de_ideal = -BACKTRACK_SLOPE*alpha*fdothall;
     de = ecurrent - eoriginal;
     if (de <= de_ideal) {
-      if (nextra_global) {
-        int itmp = modify->min_reset_ref();
-        if (itmp) ecurrent = energy_force(1);
-      }
+      int fullflag = 0;
+      if (nextra_global && modify->min_reset_ref()) fullflag = 1;
+      ev_set(update->ntimestep);
+      if (eflag != 1 || vflag) fullflag = 1;
+      if (fullflag) ecurrent = energy_force(1);
       return 0;
     }
 
@@ -22,6 +22,7 @@
 #include "compute.h"
 #include "group.h"
 #include "update.h"
+#include "timer.h"
 #include "domain.h"
 #include "region.h"
 #include "input.h"
@@ -47,6 +48,7 @@ Modify::Modify(LAMMPS *lmp) : Pointers(lmp)
   n_pre_exchange = n_pre_neighbor = n_post_neighbor = 0;
   n_pre_force = n_pre_reverse = n_post_force = 0;
   n_final_integrate = n_end_of_step = n_thermo_energy = 0;
+  next_end_of_step = -1;
   n_thermo_energy_atom = 0;
   n_initial_integrate_respa = n_post_integrate_respa = 0;
   n_pre_force_respa = n_post_force_respa = n_final_integrate_respa = 0;
@@ -83,11 +85,16 @@ Modify::Modify(LAMMPS *lmp) : Pointers(lmp)
   ncompute = maxcompute = 0;
   compute = NULL;
 
-  create_factories();
+  // style maps are built lazily by create_factories() on first use
+
+  fix_map = NULL;
+  compute_map = NULL;
 }
 
 void _noopt Modify::create_factories()
 {
+  if (fix_map) return;
+
   // fill map with fixes listed in style_fix.h
 
   fix_map = new FixCreatorMap();
@@ -187,6 +194,7 @@ void Modify::init()
     compute[i]->invoked_array = -1;
     compute[i]->invoked_peratom = -1;
     compute[i]->invoked_local = -1;
+    compute[i]->time_detail = 0.0;
   }
   addstep_compute_all(update->ntimestep);
 
@@ -198,6 +206,10 @@ void Modify::init()
 
   for (i = 0; i < nfix; i++) fix[i]->init();
 
+  // reset per-fix timing accumulators for the new run
+
+  for (i = 0; i < nfix; i++) fix[i]->time_detail = 0.0;
+
   // set global flag if any fix has its restart_pbc flag set
 
   restart_pbc_any = 0;
@@ -217,6 +229,16 @@ void Modify::init()
   list_init(PRE_REVERSE,n_pre_reverse,list_pre_reverse);
   list_init(POST_FORCE,n_post_force,list_post_force);
   list_init(FINAL_INTEGRATE,n_final_integrate,list_final_integrate);
+
+  // post_force fixes which may run during an asynchronous reverse comm:
+  // the maximal leading run with post_force_overlap set, so the
+  // invocation order relative to the remaining fixes is preserved
+
+  n_post_force_overlap = 0;
+  while (n_post_force_overlap < n_post_force &&
+         fix[list_post_force[n_post_force_overlap]]->post_force_overlap)
+    n_post_force_overlap++;
+  n_post_force_fence = n_post_force - n_post_force_overlap;
   list_init_end_of_step(END_OF_STEP,n_end_of_step,list_end_of_step);
   list_init_thermo_energy(THERMO_ENERGY,n_thermo_energy,list_thermo_energy);
   list_init_thermo_energy_atom(n_thermo_energy_atom,list_thermo_energy_atom);
@@ -390,8 +412,17 @@ void Modify::setup_pre_reverse(int eflag, int vflag)
 
 void Modify::initial_integrate(int vflag)
 {
-  for (int i = 0; i < n_initial_integrate; i++)
-    fix[list_initial_integrate[i]]->initial_integrate(vflag);
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_initial_integrate; i++)
+      fix[list_initial_integrate[i]]->initial_integrate(vflag);
+  } else {
+    for (int i = 0; i < n_initial_integrate; i++) {
+      Fix *f = fix[list_initial_integrate[i]];
+      double tstart = MPI_Wtime();
+      f->initial_integrate(vflag);
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -400,8 +431,17 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
-  for (int i = 0; i < n_post_integrate; i++)
-    fix[list_post_integrate[i]]->post_integrate();
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_post_integrate; i++)
+      fix[list_post_integrate[i]]->post_integrate();
+  } else {
+    for (int i = 0; i < n_post_integrate; i++) {
+      Fix *f = fix[list_post_integrate[i]];
+      double tstart = MPI_Wtime();
+      f->post_integrate();
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -410,8 +450,17 @@ void Modify::post_integrate()
 
 void Modify::pre_exchange()
 {
-  for (int i = 0; i < n_pre_exchange; i++)
-    fix[list_pre_exchange[i]]->pre_exchange();
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_pre_exchange; i++)
+      fix[list_pre_exchange[i]]->pre_exchange();
+  } else {
+    for (int i = 0; i < n_pre_exchange; i++) {
+      Fix *f = fix[list_pre_exchange[i]];
+      double tstart = MPI_Wtime();
+      f->pre_exchange();
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -420,8 +469,17 @@ void Modify::pre_exchange()
 
 void Modify::pre_neighbor()
 {
-  for (int i = 0; i < n_pre_neighbor; i++)
-    fix[list_pre_neighbor[i]]->pre_neighbor();
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_pre_neighbor; i++)
+      fix[list_pre_neighbor[i]]->pre_neighbor();
+  } else {
+    for (int i = 0; i < n_pre_neighbor; i++) {
+      Fix *f = fix[list_pre_neighbor[i]];
+      double tstart = MPI_Wtime();
+      f->pre_neighbor();
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -430,8 +488,17 @@ void Modify::pre_neighbor()
 
 void Modify::post_neighbor()
 {
-  for (int i = 0; i < n_post_neighbor; i++)
-    fix[list_post_neighbor[i]]->post_neighbor();
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_post_neighbor; i++)
+      fix[list_post_neighbor[i]]->post_neighbor();
+  } else {
+    for (int i = 0; i < n_post_neighbor; i++) {
+      Fix *f = fix[list_post_neighbor[i]];
+      double tstart = MPI_Wtime();
+      f->post_neighbor();
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -440,8 +507,17 @@ void Modify::post_neighbor()
 
 void Modify::pre_force(int vflag)
 {
-  for (int i = 0; i < n_pre_force; i++)
-    fix[list_pre_force[i]]->pre_force(vflag);
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_pre_force; i++)
+      fix[list_pre_force[i]]->pre_force(vflag);
+  } else {
+    for (int i = 0; i < n_pre_force; i++) {
+      Fix *f = fix[list_pre_force[i]];
+      double tstart = MPI_Wtime();
+      f->pre_force(vflag);
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 /* ----------------------------------------------------------------------
    pre_reverse call, only for relevant fixes
@@ -449,8 +525,17 @@ void Modify::pre_force(int vflag)
 
 void Modify::pre_reverse(int eflag, int vflag)
 {
-  for (int i = 0; i < n_pre_reverse; i++)
-    fix[list_pre_reverse[i]]->pre_reverse(eflag,vflag);
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_pre_reverse; i++)
+      fix[list_pre_reverse[i]]->pre_reverse(eflag,vflag);
+  } else {
+    for (int i = 0; i < n_pre_reverse; i++) {
+      Fix *f = fix[list_pre_reverse[i]];
+      double tstart = MPI_Wtime();
+      f->pre_reverse(eflag,vflag);
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -459,8 +544,56 @@ void Modify::pre_reverse(int eflag, int vflag)
 
 void Modify::post_force(int vflag)
 {
-  for (int i = 0; i < n_post_force; i++)
-    fix[list_post_force[i]]->post_force(vflag);
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_post_force; i++)
+      fix[list_post_force[i]]->post_force(vflag);
+  } else {
+    for (int i = 0; i < n_post_force; i++) {
+      Fix *f = fix[list_post_force[i]];
+      double tstart = MPI_Wtime();
+      f->post_force(vflag);
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   post_force call for the leading fixes which only accumulate into f,
+   invoked while reverse comm of ghost forces is still in flight
+------------------------------------------------------------------------- */
+
+void Modify::post_force_overlap(int vflag)
+{
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_post_force_overlap; i++)
+      fix[list_post_force[i]]->post_force(vflag);
+  } else {
+    for (int i = 0; i < n_post_force_overlap; i++) {
+      Fix *f = fix[list_post_force[i]];
+      double tstart = MPI_Wtime();
+      f->post_force(vflag);
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   post_force call for the remaining fixes, after reverse comm completes
+------------------------------------------------------------------------- */
+
+void Modify::post_force_fence(int vflag)
+{
+  if (!timer->has_detail()) {
+    for (int i = n_post_force_overlap; i < n_post_force; i++)
+      fix[list_post_force[i]]->post_force(vflag);
+  } else {
+    for (int i = n_post_force_overlap; i < n_post_force; i++) {
+      Fix *f = fix[list_post_force[i]];
+      double tstart = MPI_Wtime();
+      f->post_force(vflag);
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -469,8 +602,17 @@ void Modify::post_force(int vflag)
 
 void Modify::final_integrate()
 {
-  for (int i = 0; i < n_final_integrate; i++)
-    fix[list_final_integrate[i]]->final_integrate();
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_final_integrate; i++)
+      fix[list_final_integrate[i]]->final_integrate();
+  } else {
+    for (int i = 0; i < n_final_integrate; i++) {
+      Fix *f = fix[list_final_integrate[i]];
+      double tstart = MPI_Wtime();
+      f->final_integrate();
+      f->time_detail += MPI_Wtime() - tstart;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -480,9 +622,34 @@ void Modify::final_integrate()
 
 void Modify::end_of_step()
 {
+  bigint ntimestep = update->ntimestep;
+
+  // quiet-step short circuit:
+  // next_end_of_step = precomputed next step on which any fix in the
+  // list fires, derived from the same every values the loop tests, so
+  // steps in between skip the loop with a single compare
+
+  if (ntimestep < next_end_of_step) return;
+
+  if (!timer->has_detail()) {
+    for (int i = 0; i < n_end_of_step; i++)
+      if (ntimestep % end_of_step_every[i] == 0)
+        fix[list_end_of_step[i]]->end_of_step();
+  } else {
+    for (int i = 0; i < n_end_of_step; i++)
+      if (ntimestep % end_of_step_every[i] == 0) {
+        Fix *f = fix[list_end_of_step[i]];
+        double tstart = MPI_Wtime();
+        f->end_of_step();
+        f->time_detail += MPI_Wtime() - tstart;
+      }
+  }
+
+  next_end_of_step = MAXBIGINT;
   for (int i = 0; i < n_end_of_step; i++)
-    if (update->ntimestep % end_of_step_every[i] == 0)
-      fix[list_end_of_step[i]]->end_of_step();
+    next_end_of_step = MIN(next_end_of_step,
+                           (ntimestep/end_of_step_every[i] + 1) *
+                           end_of_step_every[i]);
 }
 
 /* ----------------------------------------------------------------------
@@ -788,6 +955,8 @@ int Modify::min_reset_ref()
 
 void Modify::add_fix(int narg, char **arg, int trysuffix)
 {
+  create_factories();
+
   if (narg < 3) error->all(FLERR,"Illegal fix command");
 
   // cannot define fix before box exists unless style is in exception list
@@ -854,6 +1023,10 @@ void Modify::add_fix(int narg, char **arg, int trysuffix)
     delete fix[ifix];
     fix[ifix] = NULL;
 
+    // cached equal-style variable trees may point at the deleted fix
+
+    input->variable->clear_cache();
+
   } else {
     newflag = 1;
     if (nfix == maxfix) {
@@ -937,6 +1110,7 @@ void Modify::add_fix(int narg, char **arg, int trysuffix)
   //   post_constructor() will see updated nfix
 
   if (newflag) nfix++;
+  fix_index[fix[ifix]->id] = ifix;
   fmask[ifix] = fix[ifix]->setmask();
   fix[ifix]->post_constructor();
 }
@@ -978,6 +1152,11 @@ void Modify::replace_fix(const char *replaceID,
   int jfix = find_fix(arg[0]);
   if (jfix >= 0) error->all(FLERR,"Replace_fix ID is already in use");
 
+  // drop the old ID from the cached lookup, it is being renamed away
+  // add_fix() below re-inserts the fix under its new ID
+
+  fix_index.erase(fix[ifix]->id);
+
   delete [] fix[ifix]->id;
   int n = strlen(arg[0]) + 1;
   fix[ifix]->id = new char[n];
@@ -1043,11 +1222,21 @@ void Modify::delete_fix(int ifix)
   if (fix[ifix]) delete fix[ifix];
   atom->update_callback(ifix);
 
+  // cached equal-style variable trees may point at the deleted fix
+
+  input->variable->clear_cache();
+
   // move other Fixes and fmask down in list one slot
 
   for (int i = ifix+1; i < nfix; i++) fix[i-1] = fix[i];
   for (int i = ifix+1; i < nfix; i++) fmask[i-1] = fmask[i];
   nfix--;
+
+  // rebuild the cached ID lookup since indices shifted
+
+  fix_index.clear();
+  for (int i = 0; i < nfix; i++)
+    if (fix[i]) fix_index[fix[i]->id] = i;
 }
 
 /* ----------------------------------------------------------------------
@@ -1058,9 +1247,9 @@ void Modify::delete_fix(int ifix)
 int Modify::find_fix(const std::string &id)
 {
   if (id.empty()) return -1;
-  for (int ifix = 0; ifix < nfix; ifix++)
-    if (id == fix[ifix]->id) return ifix;
-  return -1;
+  auto it = fix_index.find(id);
+  if (it == fix_index.end()) return -1;
+  return it->second;
 }
 
 /* ----------------------------------------------------------------------
@@ -1086,6 +1275,8 @@ int Modify::find_fix_by_style(const char *style)
 
 int Modify::check_package(const char *package_fix_name)
 {
+  create_factories();
+
   if (fix_map->find(package_fix_name) == fix_map->end()) return 0;
   return 1;
 }
@@ -1187,6 +1378,8 @@ int Modify::check_rigid_list_overlap(int *select)
 
 void Modify::add_compute(int narg, char **arg, int trysuffix)
 {
+  create_factories();
+
   if (narg < 3) error->all(FLERR,"Illegal compute command");
 
   // error check
@@ -1240,6 +1433,7 @@ void Modify::add_compute(int narg, char **arg, int trysuffix)
   if (compute[ncompute] == NULL)
     error->all(FLERR,utils::check_packages_for_style("compute",arg[2],lmp));
 
+  compute_index[compute[ncompute]->id] = ncompute;
   ncompute++;
 }
 
@@ -1299,10 +1493,20 @@ void Modify::delete_compute(const std::string &id)
   if (icompute < 0) error->all(FLERR,"Could not find compute ID to delete");
   delete compute[icompute];
 
+  // cached equal-style variable trees may point at the deleted compute
+
+  input->variable->clear_cache();
+
   // move other Computes down in list one slot
 
   for (int i = icompute+1; i < ncompute; i++) compute[i-1] = compute[i];
   ncompute--;
+
+  // rebuild the cached ID lookup since indices shifted
+
+  compute_index.clear();
+  for (int i = 0; i < ncompute; i++)
+    compute_index[compute[i]->id] = i;
 }
 
 /* ----------------------------------------------------------------------
@@ -1313,9 +1517,9 @@ void Modify::delete_compute(const std::string &id)
 int Modify::find_compute(const std::string &id)
 {
   if(id.empty()) return -1;
-  for (int icompute = 0; icompute < ncompute; icompute++)
-    if (id == compute[icompute]->id) return icompute;
-  return -1;
+  auto it = compute_index.find(id);
+  if (it == compute_index.end()) return -1;
+  return it->second;
 }
 
 /* ----------------------------------------------------------------------
@@ -1612,6 +1816,10 @@ void Modify::list_init_end_of_step(int mask, int &n, int *&list)
       list[n] = i;
       end_of_step_every[n++] = fix[i]->nevery;
     }
+
+  // every values may have changed, recompute on next end_of_step()
+
+  next_end_of_step = -1;
 }
 
 /* ----------------------------------------------------------------------
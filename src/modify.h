@@ -17,6 +17,7 @@
 #include "pointers.h"
 #include <map>
 #include <string>
+#include <unordered_map>
 
 namespace LAMMPS_NS {
 
@@ -31,7 +32,12 @@ class Modify : protected Pointers {
   int n_initial_integrate,n_post_integrate,n_pre_exchange;
   int n_pre_neighbor,n_post_neighbor;
   int n_pre_force,n_pre_reverse,n_post_force;
+  int n_post_force_overlap;      // leading post_force fixes which may run
+                                 //   during an asynchronous reverse comm
+  int n_post_force_fence;        // remaining post_force fixes
   int n_final_integrate,n_end_of_step,n_thermo_energy,n_thermo_energy_atom;
+  bigint next_end_of_step;     // next step any end_of_step fix is invoked,
+                               // -1 = not yet computed
   int n_initial_integrate_respa,n_post_integrate_respa;
   int n_pre_force_respa,n_post_force_respa,n_final_integrate_respa;
   int n_min_pre_exchange,n_min_pre_neighbor,n_min_post_neighbor;
@@ -64,6 +70,8 @@ class Modify : protected Pointers {
   virtual void pre_force(int);
   virtual void pre_reverse(int,int);
   virtual void post_force(int);
+  virtual void post_force_overlap(int);
+  virtual void post_force_fence(int);
   virtual void final_integrate();
   virtual void end_of_step();
   virtual double thermo_energy();
@@ -126,6 +134,11 @@ class Modify : protected Pointers {
 
  protected:
 
+  // cached ID -> list index lookups, kept in sync by add/delete
+
+  std::unordered_map<std::string,int> fix_index;
+  std::unordered_map<std::string,int> compute_index;
+
   // lists of fixes to apply at different stages of timestep
 
   int *list_initial_integrate,*list_post_integrate;
@@ -173,8 +186,9 @@ class Modify : protected Pointers {
   typedef std::map<std::string,FixCreator> FixCreatorMap;
   FixCreatorMap *fix_map;
 
- protected:
   void create_factories();
+
+ protected:
   template <typename T> static Compute *compute_creator(LAMMPS *, int, char **);
   template <typename T> static Fix *fix_creator(LAMMPS *, int, char **);
 };
@@ -33,6 +33,7 @@ using namespace LAMMPS_NS;
 #define MAXLINE 256
 #define EPSILON 1.0e-7
 #define BIG 1.0e20
+#define SHARETHRESH 16384       // min # of atoms for node-shared storage
 
 #define SINERTIA 0.4            // moment of inertia prefactor for sphere
 
@@ -144,6 +145,11 @@ Molecule::Molecule(LAMMPS *lmp, int narg, char **arg, int &index) :
   read(1);
   if (me == 0) fclose(fp);
 
+  // for large templates, move per-atom data into node-shared memory
+  // so it is stored once per node instead of once per proc
+
+  share_arrays();
+
   // stats
 
   if (me == 0)
@@ -1517,6 +1523,10 @@ void Molecule::initialize()
   centerflag = massflag = comflag = inertiaflag = 0;
   tag_require = 0;
 
+  shared_flag = 0;
+  nwindow = 0;
+  window = NULL;
+
   x = NULL;
   type = NULL;
   q = NULL;
@@ -1655,6 +1665,65 @@ void Molecule::allocate()
 
 void Molecule::deallocate()
 {
+  // for node-shared storage, the 2d row pointer arrays are plain new []
+  //   arrays and the underlying data is owned by the shared-memory windows
+  // delete and NULL all shared pointers so the destroys below skip them
+
+  if (shared_flag) {
+    delete [] x;
+    delete [] bond_type;
+    delete [] bond_atom;
+    delete [] angle_type;
+    delete [] angle_atom1;
+    delete [] angle_atom2;
+    delete [] angle_atom3;
+    delete [] dihedral_type;
+    delete [] dihedral_atom1;
+    delete [] dihedral_atom2;
+    delete [] dihedral_atom3;
+    delete [] dihedral_atom4;
+    delete [] improper_type;
+    delete [] improper_atom1;
+    delete [] improper_atom2;
+    delete [] improper_atom3;
+    delete [] improper_atom4;
+    delete [] nspecial;
+    delete [] special;
+    delete [] shake_atom;
+    delete [] shake_type;
+    delete [] fragmentmask;
+
+    x = NULL;
+    type = NULL;
+    molecule = NULL;
+    q = NULL;
+    radius = NULL;
+    rmass = NULL;
+    num_bond = num_angle = num_dihedral = num_improper = NULL;
+    bond_type = NULL;
+    bond_atom = NULL;
+    angle_type = NULL;
+    angle_atom1 = angle_atom2 = angle_atom3 = NULL;
+    dihedral_type = NULL;
+    dihedral_atom1 = dihedral_atom2 = dihedral_atom3 = dihedral_atom4 = NULL;
+    improper_type = NULL;
+    improper_atom1 = improper_atom2 = improper_atom3 = improper_atom4 = NULL;
+    nspecial = NULL;
+    special = NULL;
+    shake_flag = NULL;
+    shake_atom = NULL;
+    shake_type = NULL;
+    fragmentmask = NULL;
+
+    for (int i = 0; i < nwindow; i++) {
+      MPI_Win_unlock_all(window[i]);
+      MPI_Win_free(&window[i]);
+    }
+    MPI_Comm_free(&nodecomm);
+  }
+
+  delete [] window;
+
   memory->destroy(x);
   memory->destroy(type);
   memory->destroy(molecule);
@@ -1708,6 +1777,211 @@ void Molecule::deallocate()
   memory->destroy(dbodyparams);
 }
 
+/* ----------------------------------------------------------------------
+   move per-atom arrays of a large template into node-shared memory
+   each array is copied into an MPI shared-memory window allocated on
+     the lowest rank of each node, then all procs on the node free their
+     private copy and point at the one shared copy
+   parsing is unchanged, arrays are shared one at a time so the transient
+     extra memory is at most one array per node
+   no-op for serial runs, one proc per node, or small templates
+------------------------------------------------------------------------- */
+
+void Molecule::share_arrays()
+{
+  int nprocs;
+  MPI_Comm_size(world,&nprocs);
+  if (nprocs == 1 || natoms < SHARETHRESH) return;
+
+  MPI_Comm_split_type(world,MPI_COMM_TYPE_SHARED,me,MPI_INFO_NULL,&nodecomm);
+  MPI_Comm_rank(nodecomm,&noderank);
+  int nodeprocs;
+  MPI_Comm_size(nodecomm,&nodeprocs);
+  if (nodeprocs == 1) {
+    MPI_Comm_free(&nodecomm);
+    return;
+  }
+
+  shared_flag = 1;
+  window = new MPI_Win[40];
+
+  // per-atom 1d arrays
+
+  if (typeflag) {
+    int *inew = (int *) share_bytes(type,(bigint) natoms*sizeof(int));
+    memory->destroy(type);
+    type = inew;
+  }
+  if (moleculeflag) {
+    tagint *tnew =
+      (tagint *) share_bytes(molecule,(bigint) natoms*sizeof(tagint));
+    memory->destroy(molecule);
+    molecule = tnew;
+  }
+  if (qflag) {
+    double *dnew = (double *) share_bytes(q,(bigint) natoms*sizeof(double));
+    memory->destroy(q);
+    q = dnew;
+  }
+  if (radiusflag) {
+    double *dnew =
+      (double *) share_bytes(radius,(bigint) natoms*sizeof(double));
+    memory->destroy(radius);
+    radius = dnew;
+  }
+  if (rmassflag) {
+    double *dnew =
+      (double *) share_bytes(rmass,(bigint) natoms*sizeof(double));
+    memory->destroy(rmass);
+    rmass = dnew;
+  }
+
+  {
+    int *inew = (int *) share_bytes(num_bond,(bigint) natoms*sizeof(int));
+    memory->destroy(num_bond);
+    num_bond = inew;
+    inew = (int *) share_bytes(num_angle,(bigint) natoms*sizeof(int));
+    memory->destroy(num_angle);
+    num_angle = inew;
+    inew = (int *) share_bytes(num_dihedral,(bigint) natoms*sizeof(int));
+    memory->destroy(num_dihedral);
+    num_dihedral = inew;
+    inew = (int *) share_bytes(num_improper,(bigint) natoms*sizeof(int));
+    memory->destroy(num_improper);
+    num_improper = inew;
+  }
+
+  if (shakeflag) {
+    int *inew = (int *) share_bytes(shake_flag,(bigint) natoms*sizeof(int));
+    memory->destroy(shake_flag);
+    shake_flag = inew;
+  }
+
+  // per-atom 2d arrays
+
+  if (xflag) x = share_d2(x,natoms,3);
+
+  nspecial = share_i2(nspecial,natoms,3);
+  if (specialflag) special = share_t2(special,natoms,maxspecial);
+
+  if (bondflag) {
+    bond_type = share_i2(bond_type,natoms,bond_per_atom);
+    bond_atom = share_t2(bond_atom,natoms,bond_per_atom);
+  }
+
+  if (angleflag) {
+    angle_type = share_i2(angle_type,natoms,angle_per_atom);
+    angle_atom1 = share_t2(angle_atom1,natoms,angle_per_atom);
+    angle_atom2 = share_t2(angle_atom2,natoms,angle_per_atom);
+    angle_atom3 = share_t2(angle_atom3,natoms,angle_per_atom);
+  }
+
+  if (dihedralflag) {
+    dihedral_type = share_i2(dihedral_type,natoms,dihedral_per_atom);
+    dihedral_atom1 = share_t2(dihedral_atom1,natoms,dihedral_per_atom);
+    dihedral_atom2 = share_t2(dihedral_atom2,natoms,dihedral_per_atom);
+    dihedral_atom3 = share_t2(dihedral_atom3,natoms,dihedral_per_atom);
+    dihedral_atom4 = share_t2(dihedral_atom4,natoms,dihedral_per_atom);
+  }
+
+  if (improperflag) {
+    improper_type = share_i2(improper_type,natoms,improper_per_atom);
+    improper_atom1 = share_t2(improper_atom1,natoms,improper_per_atom);
+    improper_atom2 = share_t2(improper_atom2,natoms,improper_per_atom);
+    improper_atom3 = share_t2(improper_atom3,natoms,improper_per_atom);
+    improper_atom4 = share_t2(improper_atom4,natoms,improper_per_atom);
+  }
+
+  if (shakeflag) shake_atom = share_t2(shake_atom,natoms,4);
+  if (shakeflag) shake_type = share_i2(shake_type,natoms,3);
+
+  if (fragmentflag) fragmentmask = share_i2(fragmentmask,nfragments,natoms);
+}
+
+/* ----------------------------------------------------------------------
+   copy nbytes of data into a new shared-memory window on nodecomm
+   collective on nodecomm, the window is recorded for later free
+   return ptr to the node-shared copy, valid on all procs of the node
+------------------------------------------------------------------------- */
+
+void *Molecule::share_bytes(void *data, bigint nbytes)
+{
+  MPI_Aint winsize = 0;
+  if (noderank == 0) winsize = (MPI_Aint) nbytes;
+
+  void *base;
+  MPI_Win win;
+  MPI_Win_allocate_shared(winsize,1,MPI_INFO_NULL,nodecomm,&base,&win);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK,win);
+
+  if (noderank == 0) memcpy(base,data,(size_t) nbytes);
+  else {
+    MPI_Aint qsize;
+    int qdisp;
+    MPI_Win_shared_query(win,0,&qsize,&qdisp,&base);
+  }
+
+  MPI_Barrier(nodecomm);
+  MPI_Win_sync(win);
+
+  window[nwindow++] = win;
+  return base;
+}
+
+/* ----------------------------------------------------------------------
+   share the contiguous data of a 2d array created by Memory::create
+   replace the array with plain new [] row pointers into the shared copy
+------------------------------------------------------------------------- */
+
+double **Molecule::share_d2(double **array, int n, int m)
+{
+  double *data = (double *)
+    share_bytes(array ? array[0] : NULL,(bigint) n*m*sizeof(double));
+  memory->destroy(array);
+
+  double **rows = new double*[n];
+  bigint offset = 0;
+  for (int i = 0; i < n; i++) {
+    rows[i] = &data[offset];
+    offset += m;
+  }
+  return rows;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int **Molecule::share_i2(int **array, int n, int m)
+{
+  int *data = (int *)
+    share_bytes(array ? array[0] : NULL,(bigint) n*m*sizeof(int));
+  memory->destroy(array);
+
+  int **rows = new int*[n];
+  bigint offset = 0;
+  for (int i = 0; i < n; i++) {
+    rows[i] = &data[offset];
+    offset += m;
+  }
+  return rows;
+}
+
+/* ---------------------------------------------------------------------- */
+
+tagint **Molecule::share_t2(tagint **array, int n, int m)
+{
+  tagint *data = (tagint *)
+    share_bytes(array ? array[0] : NULL,(bigint) n*m*sizeof(tagint));
+  memory->destroy(array);
+
+  tagint **rows = new tagint*[n];
+  bigint offset = 0;
+  for (int i = 0; i < n; i++) {
+    rows[i] = &data[offset];
+    offset += m;
+  }
+  return rows;
+}
+
 /* ----------------------------------------------------------------------
    open molecule file
 ------------------------------------------------------------------------- */
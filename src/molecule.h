@@ -131,6 +131,12 @@ class Molecule : protected Pointers {
   int me;
   FILE *fp;
   int *count;
+
+  int shared_flag;     // 1 if per-atom arrays live in node-shared memory
+  MPI_Comm nodecomm;   // communicator across the procs on my node
+  int noderank;        // my rank within nodecomm
+  int nwindow;         // # of shared-memory windows in use
+  MPI_Win *window;     // one shared-memory window per shared array
   int toffset,boffset,aoffset,doffset,ioffset;
   int autospecial;
   double sizescale;
@@ -159,6 +165,12 @@ class Molecule : protected Pointers {
   void allocate();
   void deallocate();
 
+  void share_arrays();
+  void *share_bytes(void *, bigint);
+  double **share_d2(double **, int, int);
+  int **share_i2(int **, int, int);
+  tagint **share_t2(tagint **, int, int);
+
   void open(char *);
   void readline(char *);
   void parse_keyword(int, char *, char *);
@@ -15,7 +15,8 @@
 MyPage = templated class for storing chunks of datums in pages
   chunks are not returnable, can only reset and start over
   replaces many small mallocs with a few large mallocs
-  pages are never freed, so can reuse w/out reallocs
+  pages are never freed implicitly, so can reuse w/out reallocs
+  shrink() can return trailing unused pages to the OS
 usage:
   request one datum at a time, repeat, clear
   request chunks of datums in each get() or vget(), repeat, clear
@@ -40,6 +41,10 @@ methods:
      pagedelta = # of pages to allocate at a time, default = 1
      return 1 if bad params
    void reset() = clear pages w/out freeing
+   int npage_used() = # of pages holding live data
+   int npage_allocated() = total # of allocated pages
+   int shrink(nkeep) = free trailing pages down to nkeep
+     never frees a page holding live data, return # of pages freed
    int size() = return total size of allocated pages in bytes
    int status() = return error status
      0 = ok, 1 = chunksize > maxchunk, 2 = allocation error
@@ -182,6 +187,30 @@ class MyPage {
     page = pages[ipage];
   }
 
+  // # of pages holding live data, total # of allocated pages
+
+  int npage_used() const {
+    return ipage+1;
+  }
+
+  int npage_allocated() const {
+    return npage;
+  }
+
+  // free trailing pages down to nkeep, return # of pages freed
+  // never frees a page holding live data
+
+  int shrink(int nkeep) {
+    if (nkeep < ipage+1) nkeep = ipage+1;
+    if (nkeep >= npage) return 0;
+    int nfree = npage - nkeep;
+    for (int i = nkeep; i < npage; i++) free(pages[i]);
+    npage = nkeep;
+    T **newpages = (T **) realloc(pages,npage*sizeof(T *));
+    if (newpages) pages = newpages;
+    return nfree;
+  }
+
   // return total size of allocated pages
 
   int size() const {
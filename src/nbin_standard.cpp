@@ -187,6 +187,8 @@ void NBinStandard::setup_bins(int style)
 
 /* ----------------------------------------------------------------------
    bin owned and ghost atoms
+   two passes: compute per-atom bin indices (thread-parallel with OpenMP),
+     then insert into linked lists serially to preserve list ordering
 ------------------------------------------------------------------------- */
 
 void NBinStandard::bin_atoms()
@@ -206,25 +208,39 @@ void NBinStandard::bin_atoms()
 
   if (includegroup) {
     int bitmask = group->bitmask[includegroup];
+    int nfirst = atom->nfirst;
+
+#if defined(_OPENMP)
+#pragma omp parallel for private(i) schedule(static)
+#endif
+    for (i = nlocal; i < nall; i++)
+      if (mask[i] & bitmask) atom2bin[i] = coord2bin(x[i]);
+#if defined(_OPENMP)
+#pragma omp parallel for private(i) schedule(static)
+#endif
+    for (i = 0; i < nfirst; i++) atom2bin[i] = coord2bin(x[i]);
+
     for (i = nall-1; i >= nlocal; i--) {
       if (mask[i] & bitmask) {
-        ibin = coord2bin(x[i]);
-        atom2bin[i] = ibin;
+        ibin = atom2bin[i];
         bins[i] = binhead[ibin];
         binhead[ibin] = i;
       }
     }
-    for (i = atom->nfirst-1; i >= 0; i--) {
-      ibin = coord2bin(x[i]);
-      atom2bin[i] = ibin;
+    for (i = nfirst-1; i >= 0; i--) {
+      ibin = atom2bin[i];
       bins[i] = binhead[ibin];
       binhead[ibin] = i;
     }
 
   } else {
+#if defined(_OPENMP)
+#pragma omp parallel for private(i) schedule(static)
+#endif
+    for (i = 0; i < nall; i++) atom2bin[i] = coord2bin(x[i]);
+
     for (i = nall-1; i >= 0; i--) {
-      ibin = coord2bin(x[i]);
-      atom2bin[i] = ibin;
+      ibin = atom2bin[i];
       bins[i] = binhead[ibin];
       binhead[ibin] = i;
     }
@@ -19,6 +19,7 @@
 #include "neigh_request.h"
 #include "my_page.h"
 #include "memory.h"
+#include "error.h"
 
 using namespace LAMMPS_NS;
 
@@ -57,10 +58,26 @@ NeighList::NeighList(LAMMPS *lmp) : Pointers(lmp)
   listcopy = NULL;
   listskip = NULL;
   listfull = NULL;
+  listprune = NULL;
 
   fix_bond = NULL;
 
   ipage = NULL;
+  decay_count = 0;
+
+  pack = 0;
+  packneigh = NULL;
+  maxpack = 0;
+
+  cluster = 0;
+  nclusters = 0;
+  cluster_ilist = NULL;
+  cluster_numj = NULL;
+  cluster_firstj = NULL;
+  maxcluster = 0;
+  cpage = NULL;
+  cflag = NULL;
+  maxcflag = 0;
 
   // extra rRESPA lists
 
@@ -101,6 +118,12 @@ NeighList::~NeighList()
     memory->destroy(numneigh);
     memory->sfree(firstneigh);
     delete [] ipage;
+    memory->destroy(packneigh);
+    memory->destroy(cluster_ilist);
+    memory->destroy(cluster_numj);
+    memory->sfree(cluster_firstj);
+    delete [] cpage;
+    memory->destroy(cflag);
   }
 
   if (respainner) {
@@ -127,6 +150,7 @@ NeighList::~NeighList()
    copy -> set listcopy for list to copy from
    skip -> set listskip for list to skip from, create copy of itype,ijtype
    halffull -> set listfull for full list to derive from
+   prune -> set listprune for longer-cutoff list to filter from
    respaouter -> set all 3 outer/middle/inner flags
    bond -> set fix_bond to Fix that made the request
 ------------------------------------------------------------------------- */
@@ -165,7 +189,21 @@ void NeighList::post_constructor(NeighRequest *nq)
   if (nq->halffull)
     listfull = neighbor->lists[nq->halffulllist];
 
+  if (nq->prune)
+    listprune = neighbor->lists[nq->prunelist];
+
   if (nq->bond) fix_bond = (Fix *) nq->requestor;
+
+  // packed block layout only applies to plain page-backed lists
+
+  pack = neighbor->packflag;
+  if (copy || ssa || kokkos || respaouter || respamiddle || respainner)
+    pack = 0;
+
+  // cluster tiles only for plain page-backed lists
+
+  cluster = nq->cluster;
+  if (copy || ssa || kokkos) cluster = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -191,6 +229,11 @@ void NeighList::setup_pages(int pgsize_caller, int oneatom_caller)
     for (int i = 0; i < nmypage; i++)
       ipage_middle[i].init(oneatom,pgsize,PGDELTA);
   }
+
+  if (cluster) {
+    cpage = new MyPage<int>[1];
+    cpage->init(CLUSTER_I*oneatom,pgsize,PGDELTA);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -243,6 +286,130 @@ void NeighList::grow(int nlocal, int nall)
   }
 }
 
+/* ----------------------------------------------------------------------
+   repack ragged page-backed rows into one contiguous aligned buffer
+   each row starts on a PACKWIDTH-int boundary and is padded to a
+     multiple of PACKWIDTH ints, so SIMD consumers can issue full-width
+     aligned loads for every row without a remainder loop faulting
+   pad entries replicate the last real neighbor, numneigh is unchanged
+   called by Neighbor after each build of this list
+------------------------------------------------------------------------- */
+
+#define PACKWIDTH 16
+
+void NeighList::pack_blocks()
+{
+  int i,j,n,npad;
+  int *row;
+
+  int ntotal = inum + gnum;
+
+  // total padded length of all rows
+
+  bigint need = 0;
+  for (i = 0; i < ntotal; i++) {
+    n = numneigh[ilist[i]];
+    need += ((bigint) n + PACKWIDTH-1)/PACKWIDTH * PACKWIDTH;
+  }
+
+  if (need > maxpack) {
+    memory->destroy(packneigh);
+    maxpack = need;
+    memory->create(packneigh,maxpack,"neighlist:packneigh");
+  }
+
+  // copy each row, pad tail with last real neighbor, repoint firstneigh
+
+  bigint offset = 0;
+  for (i = 0; i < ntotal; i++) {
+    const int iatom = ilist[i];
+    n = numneigh[iatom];
+    row = firstneigh[iatom];
+    int *dest = &packneigh[offset];
+    for (j = 0; j < n; j++) dest[j] = row[j];
+    npad = (n + PACKWIDTH-1)/PACKWIDTH * PACKWIDTH;
+    for (j = n; j < npad; j++) dest[j] = n ? dest[n-1] : 0;
+    firstneigh[iatom] = dest;
+    offset += npad;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   derive cluster tiles from the per-atom rows after each build
+   every CLUSTER_I consecutive atoms of ilist form one i-cluster whose
+     j list is the union of their rows, deduplicated and padded to a
+     multiple of CLUSTER_J with the last entry replicated
+   special-bond bits are stripped; the many-body styles that request
+     cluster tiles mask them off anyway
+   a blocked kernel iterates the tile with CLUSTER_I x CLUSTER_J
+     interactions sharing one j gather, and skips pairs beyond the
+     cutoff exactly as it would in the scalar row loop
+------------------------------------------------------------------------- */
+
+void NeighList::build_clusters()
+{
+  int i,j,m,n,jnum,iatom;
+  int *jlist;
+
+  // scratch stamps to deduplicate j atoms shared within a cluster
+
+  if (atom->nmax > maxcflag) {
+    maxcflag = atom->nmax;
+    memory->destroy(cflag);
+    memory->create(cflag,maxcflag,"neighlist:cflag");
+  }
+  for (j = 0; j < maxcflag; j++) cflag[j] = -1;
+
+  nclusters = (inum + CLUSTER_I-1) / CLUSTER_I;
+
+  if (nclusters > maxcluster) {
+    maxcluster = nclusters;
+    memory->destroy(cluster_ilist);
+    memory->destroy(cluster_numj);
+    memory->sfree(cluster_firstj);
+    memory->create(cluster_ilist,maxcluster*CLUSTER_I,
+                   "neighlist:cluster_ilist");
+    memory->create(cluster_numj,maxcluster,"neighlist:cluster_numj");
+    cluster_firstj = (int **) memory->smalloc(maxcluster*sizeof(int *),
+                                              "neighlist:cluster_firstj");
+  }
+
+  cpage->reset();
+
+  for (m = 0; m < nclusters; m++) {
+    n = 0;
+    int *neighptr = cpage->vget();
+
+    for (i = 0; i < CLUSTER_I; i++) {
+      int idx = m*CLUSTER_I + i;
+      if (idx < inum) {
+        iatom = ilist[idx];
+        cluster_ilist[m*CLUSTER_I + i] = iatom;
+
+        jlist = firstneigh[iatom];
+        jnum = numneigh[iatom];
+        for (j = 0; j < jnum; j++) {
+          int jatom = jlist[j] & NEIGHMASK;
+          if (cflag[jatom] == m) continue;
+          cflag[jatom] = m;
+          neighptr[n++] = jatom;
+        }
+      } else cluster_ilist[m*CLUSTER_I + i] = -1;
+    }
+
+    // pad to a multiple of CLUSTER_J with the last real entry
+
+    int npad = (n + CLUSTER_J-1)/CLUSTER_J * CLUSTER_J;
+    for (j = n; j < npad; j++) neighptr[j] = n ? neighptr[n-1] : 0;
+
+    cluster_firstj[m] = neighptr;
+    cluster_numj[m] = n;
+    cpage->vgot(npad);
+    if (cpage->status())
+      error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+  }
+}
+
 /* ----------------------------------------------------------------------
    print attributes of this list and associated request
 ------------------------------------------------------------------------- */
@@ -300,6 +467,14 @@ bigint NeighList::memory_usage()
   bytes += memory->usage(ilist,maxatom);
   bytes += memory->usage(numneigh,maxatom);
   bytes += maxatom * sizeof(int *);
+  bytes += maxpack * sizeof(int);
+
+  if (cluster) {
+    bytes += maxcluster * (CLUSTER_I+1) * sizeof(int);
+    bytes += maxcluster * sizeof(int *);
+    bytes += memory->usage(cflag,maxcflag);
+    if (cpage) bytes += cpage->size();
+  }
 
   int nmypage = comm->nthreads;
 
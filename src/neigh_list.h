@@ -57,6 +57,33 @@ class NeighList : protected Pointers {
   int pgsize;                      // size of each page
   int oneatom;                     // max size for one atom
   MyPage<int> *ipage;              // pages of neighbor indices
+  int decay_count;                 // # of consecutive builds w/ mostly
+                                   //   unused pages, for Neighbor decay
+
+  // packed block layout, enabled by "pack" option of neighbor command
+  // rows are copied out of pages into one aligned buffer after each build
+
+  int pack;                        // 1 if rows repacked into aligned blocks
+  int *packneigh;                  // contiguous storage for packed rows
+  bigint maxpack;                  // allocated length of packneigh
+
+  // cluster (tile) layout built on top of the per-atom rows when the
+  // request sets its cluster flag; groups of CLUSTER_I consecutive list
+  // atoms share one deduplicated j list padded to CLUSTER_J entries,
+  // for blocked many-body kernels; special-bond bits are stripped
+
+  static const int CLUSTER_I = 4;  // i atoms per cluster
+  static const int CLUSTER_J = 8;  // j padding granularity
+
+  int cluster;                     // 1 if tiles built for this list
+  int nclusters;                   // # of i-clusters
+  int *cluster_ilist;              // CLUSTER_I atoms per cluster, -1 padded
+  int *cluster_numj;               // # of j atoms per cluster
+  int **cluster_firstj;            // ptr to 1st j atom of each cluster
+  int maxcluster;                  // size of allocated cluster arrays
+  MyPage<int> *cpage;              // pages of cluster j indices
+  int *cflag;                      // scratch stamps for j deduplication
+  int maxcflag;                    // size of cflag array
 
   // data structs to store rRESPA neighbor pairs I,J and associated values
 
@@ -86,6 +113,8 @@ class NeighList : protected Pointers {
   NeighList *listcopy;          // me = copy list, point to list I copy from
   NeighList *listskip;          // me = skip list, point to list I skip from
   NeighList *listfull;          // me = half list, point to full I derive from
+  NeighList *listprune;         // me = prune list, point to longer-cutoff
+                                //   list I filter by distance
 
   class Fix *fix_bond;          // fix that stores bond info
 
@@ -105,6 +134,8 @@ class NeighList : protected Pointers {
   void post_constructor(class NeighRequest *);
   void setup_pages(int, int);           // setup page data structures
   void grow(int,int);                   // grow all data structs
+  void pack_blocks();                   // repack rows into aligned blocks
+  void build_clusters();                // derive i/j cluster tiles from rows
   void print_attributes();              // debug routine
   int get_maxlocal() {return maxatom;}
   bigint memory_usage();
@@ -65,6 +65,7 @@ NeighRequest::NeighRequest(LAMMPS *lmp) : Pointers(lmp)
   intel = 0;
   kokkos_host = kokkos_device = 0;
   ssa = 0;
+  cluster = 0;
   cut = 0;
   cutoff = 0.0;
 
@@ -86,6 +87,8 @@ NeighRequest::NeighRequest(LAMMPS *lmp) : Pointers(lmp)
   copylist = -1;
   halffull = 0;
   halffulllist = -1;
+  prune = 0;
+  prunelist = -1;
   unique = 0;
 
   // internal settings
@@ -148,6 +151,7 @@ int NeighRequest::identical(NeighRequest *other)
   if (kokkos_host != other->kokkos_host) same = 0;
   if (kokkos_device != other->kokkos_device) same = 0;
   if (ssa != other->ssa) same = 0;
+  if (cluster != other->cluster) same = 0;
   if (copy != other->copy) same = 0;
   if (cutoff != other->cutoff) same = 0;
 
@@ -214,6 +218,7 @@ void NeighRequest::copy_request(NeighRequest *other, int skipflag)
   kokkos_host = other->kokkos_host;
   kokkos_device = other->kokkos_device;
   ssa = other->ssa;
+  cluster = other->cluster;
   cut = other->cut;
   cutoff = other->cutoff;
 
@@ -71,6 +71,8 @@ class NeighRequest : protected Pointers {
   int kokkos_host;       // set by KOKKOS package
   int kokkos_device;
   int ssa;               // set by USER-DPD package, for Shardlow lists
+  int cluster;           // 1 if list also builds i/j cluster tiles,
+                         //   set by many-body styles with blocked kernels
   int cut;               // 1 if use a non-standard cutoff length
   double cutoff;         // special cutoff distance for this list
 
@@ -98,6 +100,10 @@ class NeighRequest : protected Pointers {
   int halffull;          // 1 if half list computed from another full list
   int halffulllist;      // index of full list to derive half from
 
+  int prune;             // 1 if list distance-filtered from a
+                         //   longer-cutoff list
+  int prunelist;         // index of list to prune from
+
   int unique;            // 1 if this list requires its own
                          // NStencil, Nbin class - because of requestor cutoff
 
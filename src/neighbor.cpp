@@ -20,6 +20,7 @@
 #include <cmath>
 #include <cstring>
 #include "neigh_list.h"
+#include "my_page.h"
 #include "neigh_request.h"
 #include "nbin.h"
 #include "nstencil.h"
@@ -41,6 +42,7 @@
 #include "fix.h"
 #include "compute.h"
 #include "update.h"
+#include "timer.h"
 #include "respa.h"
 #include "output.h"
 #include "citeme.h"
@@ -91,6 +93,14 @@ pairclass(NULL), pairnames(NULL), pairmasks(NULL)
   pgsize = 100000;
   oneatom = 2000;
   binsizeflag = 0;
+  packflag = 0;
+  partialflag = 0;
+  pgdecay = 0;
+  pgdecay_freed = 0;
+  partial_ready = 0;
+  nall_hold = 0;
+  pdirty = NULL;
+  maxpdirty = 0;
   build_once = 0;
   cluster_check = 0;
   ago = -1;
@@ -107,6 +117,9 @@ pairclass(NULL), pairnames(NULL), pairmasks(NULL)
   nlist = 0;
   lists = NULL;
 
+  time_detail_bin = time_detail_stencil = 0.0;
+  time_detail_build = NULL;
+
   nbin = 0;
   neigh_bin = NULL;
 
@@ -194,6 +207,7 @@ Neighbor::~Neighbor()
   delete [] neigh_bin;
   delete [] neigh_stencil;
   delete [] neigh_pair;
+  delete [] time_detail_build;
 
   delete [] slist;
   delete [] plist;
@@ -221,6 +235,7 @@ Neighbor::~Neighbor()
   delete neigh_improper;
 
   memory->destroy(xhold);
+  memory->destroy(pdirty);
 
   memory->destroy(ex1_type);
   memory->destroy(ex2_type);
@@ -403,6 +418,15 @@ void Neighbor::init()
     }
   }
 
+  // nospecial_flag = 1 if no list entry can carry sbmask() bits,
+  // i.e. each of 1-2/1-3/1-4 is either pruned from the lists entirely
+  // (flag 0) or included at full weight (flag 1)
+  // pair styles may then skip the per-pair special factor lookup
+
+  if (special_flag[1] <= 1 && special_flag[2] <= 1 && special_flag[3] <= 1)
+    nospecial_flag = 1;
+  else nospecial_flag = 0;
+
   // ------------------------------------------------------------------
   // xhold array
 
@@ -500,6 +524,11 @@ void Neighbor::init()
 
   int same = init_pair();
 
+  // reset per-phase timing accumulators for the new run
+
+  time_detail_bin = time_detail_stencil = 0.0;
+  for (i = 0; i < nlist; i++) time_detail_build[i] = 0.0;
+
   // invoke copy_neighbor_info() in Bin,Stencil,Pair classes
   // copied once per run in case any cutoff, exclusion, special info changed
 
@@ -657,6 +686,7 @@ int Neighbor::init_pair()
   delete [] neigh_bin;
   delete [] neigh_stencil;
   delete [] neigh_pair;
+  delete [] time_detail_build;
 
   // error check on requests
   // do not allow occasional, ghost, bin list
@@ -683,19 +713,21 @@ int Neighbor::init_pair()
   //   (1) unique = create unique lists if cutoff is explicitly set
   //   (2) skip = create any new non-skip lists needed by pair hybrid skip lists
   //   (3) granular = adjust parent and skip lists for granular onesided usage
-  //   (4) h/f = pair up any matching half/full lists
-  //   (5) copy = convert as many lists as possible to copy lists
+  //   (4) prune = derive shorter-cutoff lists from longer-cutoff lists
+  //   (5) h/f = pair up any matching half/full lists
+  //   (6) copy = convert as many lists as possible to copy lists
   // order of morph methods matters:
   //   (3) after (2), b/c it adjusts lists created by (2)
-  //   (4) after (2) and (3),
+  //   (4) and (5) after (2) and (3),
   //       b/c (2) may create new full lists, (3) may change them
-  //   (5) last, after all lists are finalized, so all possible copies found
+  //   (6) last, after all lists are finalized, so all possible copies found
 
   int nrequest_original = nrequest;
 
   morph_unique();
   morph_skip();
   morph_granular();     // this method can change flags set by requestor
+  morph_prune();
   morph_halffull();
   morph_copy();
 
@@ -709,6 +741,7 @@ int Neighbor::init_pair()
   neigh_bin = new NBin*[nrequest];
   neigh_stencil = new NStencil*[nrequest];
   neigh_pair = new NPair*[nrequest];
+  time_detail_build = new double[nrequest];
 
   // allocate new lists
   // pass list ptr back to requestor (except for Command class)
@@ -905,11 +938,12 @@ int Neighbor::init_pair()
   while (!done) {
     done = 1;
     for (i = 0; i < npair_perpetual; i++) {
-      for (k = 0; k < 3; k++) {
+      for (k = 0; k < 4; k++) {
         ptr = NULL;
         if (k == 0) ptr = lists[plist[i]]->listcopy;
         if (k == 1) ptr = lists[plist[i]]->listskip;
         if (k == 2) ptr = lists[plist[i]]->listfull;
+        if (k == 3) ptr = lists[plist[i]]->listprune;
         if (ptr == NULL) continue;
         for (m = 0; m < nrequest; m++)
           if (ptr == lists[m]) break;
@@ -1120,6 +1154,95 @@ void Neighbor::morph_granular()
   }
 }
 
+/* ----------------------------------------------------------------------
+   scan NeighRequests for lists with a shorter custom cutoff that can be
+   derived from a perpetual longer-cutoff list by distance filtering
+   if 2 requests match, prune from the longer list instead of a
+   ground-up bin/stencil build
+------------------------------------------------------------------------- */
+
+void Neighbor::morph_prune()
+{
+  int i,j,inewton,jnewton;
+  NeighRequest *irq,*jrq;
+  double jcutoff;
+
+  for (i = 0; i < nrequest; i++) {
+    irq = requests[i];
+
+    // only prune lists with a shorter requestor-set cutoff
+
+    if (!irq->cut) continue;
+
+    // these lists are created other ways, no need for prune
+
+    if (irq->copy) continue;
+
+    // prune copies parent rows as is, cannot remap these layouts
+
+    if (irq->ghost || irq->size || irq->history || irq->bond) continue;
+    if (irq->respaouter || irq->respamiddle || irq->respainner) continue;
+
+    // check all other lists
+
+    for (j = 0; j < nrequest; j++) {
+      if (i == j) continue;
+      jrq = requests[j];
+
+      // can only derive from a perpetual list that is built directly
+
+      if (jrq->occasional) continue;
+      if (jrq->copy || jrq->halffull || jrq->prune) continue;
+      if (jrq->ghost || jrq->size || jrq->history || jrq->bond) continue;
+      if (jrq->respaouter || jrq->respamiddle || jrq->respainner) continue;
+
+      // parent cutoff must cover the requested cutoff
+      // equal cutoffs are left for morph_copy, which is cheaper
+
+      jcutoff = jrq->cut ? jrq->cutoff : cutneighmax;
+      if (irq->cutoff >= jcutoff) continue;
+
+      // both lists must be half, or both full
+      // both lists must be newton on, or both newton off
+      //   else 2 lists do not store pairs on the same procs
+
+      if (irq->half != jrq->half) continue;
+      if (irq->full != jrq->full) continue;
+
+      inewton = irq->newton;
+      if (inewton == 0) inewton = force->newton_pair ? 1 : 2;
+      jnewton = jrq->newton;
+      if (jnewton == 0) jnewton = force->newton_pair ? 1 : 2;
+      if (inewton != jnewton) continue;
+
+      // these flags must be same, else data structures are different
+
+      if (irq->omp != jrq->omp) continue;
+      if (irq->intel != jrq->intel) continue;
+      if (irq->kokkos_host != jrq->kokkos_host) continue;
+      if (irq->kokkos_device != jrq->kokkos_device) continue;
+      if (irq->ssa != jrq->ssa) continue;
+
+      // skip flag must be same
+      // if both are skip lists, skip info must match
+
+      if (irq->skip != jrq->skip) continue;
+      if (irq->skip && irq->same_skip(jrq) == 0) continue;
+
+      // 2 lists are a match
+
+      break;
+    }
+
+    // if matching list exists, point to it
+
+    if (j < nrequest) {
+      irq->prune = 1;
+      irq->prunelist = j;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    scan NeighRequests for possible half lists to derive from full lists
    if 2 requests match, set half list to derive from full list
@@ -1140,7 +1263,7 @@ void Neighbor::morph_halffull()
     // these lists are created other ways, no need for halffull
     // do want to process skip lists
 
-    if (irq->copy) continue;
+    if (irq->copy || irq->prune) continue;
 
     // check all other lists
 
@@ -1285,6 +1408,8 @@ void Neighbor::morph_copy()
       irq->copy = 1;
       if (jrq->copy) irq->copylist = jrq->copylist;
       else irq->copylist = j;
+      irq->prune = 0;
+      irq->prunelist = -1;
     }
   }
 }
@@ -1498,6 +1623,8 @@ void Neighbor::print_pairwise_info()
 
     if (rq->copy)
       out += fmt::format(", copy from ({})",rq->copylist+1);
+    else if (rq->prune)
+      out += fmt::format(", prune from ({})",rq->prunelist+1);
     else if (rq->halffull)
       out += fmt::format(", half/full from ({})",rq->halffulllist+1);
     else if (rq->skip)
@@ -1603,7 +1730,7 @@ int Neighbor::choose_bin(NeighRequest *rq)
   // no binning needed
 
   if (style == Neighbor::NSQ) return 0;
-  if (rq->skip || rq->copy || rq->halffull) return 0;
+  if (rq->skip || rq->copy || rq->halffull || rq->prune) return 0;
 
   // use request settings to match exactly one NBin class mask
   // checks are bitwise using NeighConst bit masks
@@ -1643,7 +1770,7 @@ int Neighbor::choose_stencil(NeighRequest *rq)
   // no stencil creation needed
 
   if (style == Neighbor::NSQ) return 0;
-  if (rq->skip || rq->copy || rq->halffull) return 0;
+  if (rq->skip || rq->copy || rq->halffull || rq->prune) return 0;
 
   // convert newton request to newtflag = on or off
 
@@ -1824,6 +1951,7 @@ int Neighbor::choose_pair(NeighRequest *rq)
     if (!rq->skip != !(mask & NP_SKIP)) continue;
 
     if (!rq->halffull != !(mask & NP_HALF_FULL)) continue;
+    if (!rq->prune != !(mask & NP_PRUNE)) continue;
     if (!rq->off2on != !(mask & NP_OFF2ON)) continue;
 
     // neighbor style is one of NSQ,BIN,MULTI and must match
@@ -1921,10 +2049,14 @@ void Neighbor::setup_bins()
   // invoke create_setup() and create() for all perpetual NStencil
   // same ops performed for occasional lists in build_one()
 
+  double tstart = 0.0;
+  const int detailflag = timer->has_detail();
+  if (detailflag) tstart = MPI_Wtime();
   for (int i = 0; i < nstencil_perpetual; i++) {
     neigh_stencil[slist[i]]->create_setup();
     neigh_stencil[slist[i]]->create();
   }
+  if (detailflag) time_detail_stencil += MPI_Wtime() - tstart;
 
   last_setup_bins = update->ntimestep;
 }
@@ -1933,6 +2065,8 @@ void Neighbor::setup_bins()
 
 int Neighbor::decide()
 {
+  partial_ready = 0;
+
   if (must_check) {
     bigint n = update->ntimestep;
     if (restart_check && n == output->next_restart) return 1;
@@ -1999,6 +2133,27 @@ int Neighbor::check_distance()
   int nlocal = atom->nlocal;
   if (includegroup) nlocal = atom->nfirst;
 
+  // in partial mode also trigger at 1/4 skin, so rows near movers can be
+  // refreshed while every atom is still well inside its full skin budget
+
+  if (partialflag && !boxcheck && partial_allowed()) {
+    double psq = 0.25*deltasq;
+    int flags[2] = {0,0};
+    for (int i = 0; i < nlocal; i++) {
+      delx = x[i][0] - xhold[i][0];
+      dely = x[i][1] - xhold[i][1];
+      delz = x[i][2] - xhold[i][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq > deltasq) flags[0] = 1;
+      else if (rsq > psq) flags[1] = 1;
+    }
+    int flagsall[2];
+    MPI_Allreduce(flags,flagsall,2,MPI_INT,MPI_MAX,world);
+    if (flagsall[0] && ago == MAX(every,delay)) ndanger++;
+    if (flagsall[1] && !flagsall[0] && nall_hold) partial_ready = 1;
+    return flagsall[0] || flagsall[1];
+  }
+
   int flag = 0;
   for (int i = 0; i < nlocal; i++) {
     delx = x[i][0] - xhold[i][0];
@@ -2046,11 +2201,18 @@ void Neighbor::build(int topoflag)
       memory->destroy(xhold);
       memory->create(xhold,maxhold,3,"neigh:xhold");
     }
-    for (i = 0; i < nlocal; i++) {
+
+    // partial mode holds ghost coords too, for consistent refresh decisions
+
+    int nhold = nlocal;
+    if (partialflag) nhold = nall;
+    for (i = 0; i < nhold; i++) {
       xhold[i][0] = x[i][0];
       xhold[i][1] = x[i][1];
       xhold[i][2] = x[i][2];
     }
+    nall_hold = nall;
+    partial_ready = 0;
     if (boxcheck) {
       if (triclinic == 0) {
         boxlo_hold[0] = bboxlo[0];
@@ -2077,12 +2239,17 @@ void Neighbor::build(int topoflag)
   // if bin then, atoms may have moved outside of proc domain & bin extent,
   //   leading to errors or even a crash
 
+  const int detailflag = timer->has_detail();
+  double tstart = 0.0;
+
   if (style != Neighbor::NSQ) {
     if (last_setup_bins < 0) setup_bins();
+    if (detailflag) tstart = MPI_Wtime();
     for (int i = 0; i < nbin; i++) {
       neigh_bin[i]->bin_atoms_setup(nall);
       neigh_bin[i]->bin_atoms();
     }
+    if (detailflag) time_detail_bin += MPI_Wtime() - tstart;
   }
 
   // build pairwise lists for all perpetual NPair/NeighList
@@ -2093,14 +2260,126 @@ void Neighbor::build(int topoflag)
     if (!lists[i]->copy || lists[i]->kk2cpu)
       lists[m]->grow(nlocal,nall);
     neigh_pair[m]->build_setup();
+    if (detailflag) tstart = MPI_Wtime();
     neigh_pair[m]->build(lists[m]);
+    if (lists[m]->pack) lists[m]->pack_blocks();
+    if (lists[m]->cluster) lists[m]->build_clusters();
+    if (detailflag) time_detail_build[m] += MPI_Wtime() - tstart;
   }
 
+  // optionally return pages that stayed mostly unused to the OS
+
+  if (pgdecay) decay_pages();
+
   // build topology lists for bonds/angles/etc
 
   if (atom->molecular && topoflag) build_topology();
 }
 
+/* ----------------------------------------------------------------------
+   check that a partial rebuild is usable in the current configuration
+   partial rebuilds skip exchange/borders and all re-neighbor fix hooks,
+   so any feature that depends on those forces the full path
+------------------------------------------------------------------------- */
+
+int Neighbor::partial_allowed()
+{
+  if (style == Neighbor::NSQ) return 0;
+  if (includegroup || domain->triclinic || domain->box_change) return 0;
+  if (modify->n_pre_exchange || modify->n_pre_neighbor ||
+      modify->n_post_neighbor) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if the rebuild requested by decide() can be a partial one
+------------------------------------------------------------------------- */
+
+int Neighbor::partial_ok()
+{
+  return partial_ready;
+}
+
+/* ----------------------------------------------------------------------
+   partial rebuild: refresh list rows near atoms that moved > 1/4 skin
+     since the last full build, leaving all other rows untouched
+   caller guarantees no exchange/borders since the last full build and
+     current ghost coords (forward_comm), so local indices are stable
+   all atoms are rebinned (cheap), then each NPair style refreshes only
+     rows whose stencil neighborhood contains a moved atom, appending the
+     new rows to the existing list pages; pages are reclaimed in bulk at
+     the next full build
+   ownership tie-breaks in half lists use the coords held at the last
+     full build so that all procs make identical decisions at all times
+------------------------------------------------------------------------- */
+
+void Neighbor::build_partial()
+{
+  int i,m;
+
+  ago = 0;
+  ncalls++;
+  lastcall = update->ntimestep;
+
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+
+  // fall back to a full build if atom counts changed unexpectedly
+
+  if (nall != nall_hold) {
+    build(1);
+    return;
+  }
+
+  // flag atoms (owned and ghost) that moved > 1/4 skin since last full build
+  // ghost coords mirror their owners, so all procs flag consistently
+
+  if (atom->nmax > maxpdirty) {
+    maxpdirty = atom->nmax;
+    memory->destroy(pdirty);
+    memory->create(pdirty,maxpdirty,"neigh:pdirty");
+  }
+
+  double **x = atom->x;
+  double delx,dely,delz,rsq;
+  double bsq = 0.0625*skin*skin;
+
+  for (i = 0; i < nall; i++) {
+    delx = x[i][0] - xhold[i][0];
+    dely = x[i][1] - xhold[i][1];
+    delz = x[i][2] - xhold[i][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+    pdirty[i] = (rsq > bsq) ? 1 : 0;
+  }
+
+  // rebin all atoms with current coords
+
+  const int detailflag = timer->has_detail();
+  double tstart = 0.0;
+
+  if (detailflag) tstart = MPI_Wtime();
+  for (i = 0; i < nbin; i++) {
+    neigh_bin[i]->bin_atoms_setup(nall);
+    neigh_bin[i]->bin_atoms();
+  }
+  if (detailflag) time_detail_bin += MPI_Wtime() - tstart;
+
+  // refresh rows of perpetual lists
+  // NPair styles without a partial path rebuild their list in full
+
+  for (i = 0; i < npair_perpetual; i++) {
+    m = plist[i];
+    neigh_pair[m]->build_setup();
+    if (detailflag) tstart = MPI_Wtime();
+    neigh_pair[m]->build_partial(lists[m],pdirty,xhold);
+    if (lists[m]->pack) lists[m]->pack_blocks();
+    if (lists[m]->cluster) lists[m]->build_clusters();
+    if (detailflag) time_detail_build[m] += MPI_Wtime() - tstart;
+  }
+
+  // topology lists are index-based and unchanged without an exchange
+}
+
 /* ----------------------------------------------------------------------
    build topology neighbor lists: bond, angle, dihedral, improper
    copy their list info back to Neighbor for access by bond/angle/etc classes
@@ -2169,6 +2448,8 @@ void Neighbor::build_one(class NeighList *mylist, int preflag)
     build_one(mylist->listcopy,preflag);
   if (mylist->listfull && mylist->listfull->occasional)
     build_one(mylist->listfull,preflag);
+  if (mylist->listprune && mylist->listprune->occasional)
+    build_one(mylist->listprune,preflag);
 
   // create stencil if hasn't been created since last setup_bins() call
 
@@ -2184,6 +2465,8 @@ void Neighbor::build_one(class NeighList *mylist, int preflag)
     mylist->grow(atom->nlocal,atom->nlocal+atom->nghost);
   np->build_setup();
   np->build(mylist);
+  if (mylist->pack) mylist->pack_blocks();
+  if (mylist->cluster) mylist->build_clusters();
 }
 
 /* ----------------------------------------------------------------------
@@ -2192,7 +2475,7 @@ void Neighbor::build_one(class NeighList *mylist, int preflag)
 
 void Neighbor::set(int narg, char **arg)
 {
-  if (narg != 2) error->all(FLERR,"Illegal neighbor command");
+  if (narg != 2 && narg != 3) error->all(FLERR,"Illegal neighbor command");
 
   skin = force->numeric(FLERR,arg[0]);
   if (skin < 0.0) error->all(FLERR,"Illegal neighbor command");
@@ -2202,6 +2485,13 @@ void Neighbor::set(int narg, char **arg)
   else if (strcmp(arg[1],"multi") == 0) style = Neighbor::MULTI;
   else error->all(FLERR,"Illegal neighbor command");
 
+  // optional "pack" keyword repacks built lists into aligned blocks
+
+  if (narg == 3) {
+    if (strcmp(arg[2],"pack") == 0) packflag = 1;
+    else error->all(FLERR,"Illegal neighbor command");
+  }
+
   if (style == Neighbor::MULTI && lmp->citeme) lmp->citeme->add(cite_neigh_multi);
 }
 
@@ -2250,6 +2540,14 @@ void Neighbor::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) dist_check = 0;
       else error->all(FLERR,"Illegal neigh_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"partial") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) partialflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) partialflag = 0;
+      else error->all(FLERR,"Illegal neigh_modify command");
+      if (partialflag && dist_check == 0)
+        error->all(FLERR,"Neigh_modify partial requires check yes");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"once") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) build_once = 1;
@@ -2266,6 +2564,11 @@ void Neighbor::modify_params(int narg, char **arg)
       old_oneatom = oneatom;
       oneatom = force->inumeric(FLERR,arg[iarg+1]);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"pgdecay") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      pgdecay = force->inumeric(FLERR,arg[iarg+1]);
+      if (pgdecay < 0) error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"binsize") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       binsize_user = force->numeric(FLERR,arg[iarg+1]);
@@ -2387,6 +2690,71 @@ int Neighbor::exclude_setting()
   return exclude;
 }
 
+/* ----------------------------------------------------------------------
+   return pages that stayed mostly unused back to the OS
+   a list must leave at least half its pages untouched for pgdecay
+   consecutive builds before its arenas are shrunk to what was used
+   pages holding live data are never freed
+------------------------------------------------------------------------- */
+
+void Neighbor::decay_pages()
+{
+  int i,t,used,alloc;
+  bigint nfreed;
+
+  int nthreads = comm->nthreads;
+
+  for (i = 0; i < nlist; i++) {
+    NeighList *list = lists[i];
+    if (!list || list->copy || !list->ipage) continue;
+
+    used = alloc = 0;
+    for (t = 0; t < nthreads; t++) {
+      used += list->ipage[t].npage_used();
+      alloc += list->ipage[t].npage_allocated();
+    }
+
+    if (2*used <= alloc) list->decay_count++;
+    else list->decay_count = 0;
+    if (list->decay_count < pgdecay) continue;
+
+    nfreed = 0;
+    for (t = 0; t < nthreads; t++)
+      nfreed += list->ipage[t].shrink(list->ipage[t].npage_used());
+    if (list->respainner && list->ipage_inner)
+      for (t = 0; t < nthreads; t++)
+        nfreed += list->ipage_inner[t].shrink(list->ipage_inner[t].npage_used());
+    if (list->respamiddle && list->ipage_middle)
+      for (t = 0; t < nthreads; t++)
+        nfreed += list->ipage_middle[t].shrink(list->ipage_middle[t].npage_used());
+
+    pgdecay_freed += nfreed * ((bigint) list->pgsize) * sizeof(int);
+    list->decay_count = 0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   tally allocated and used bytes of all neighbor list page arenas
+------------------------------------------------------------------------- */
+
+void Neighbor::page_stats(bigint &allocated, bigint &used)
+{
+  int i,t;
+
+  allocated = used = 0;
+  int nthreads = comm->nthreads;
+
+  for (i = 0; i < nlist; i++) {
+    NeighList *list = lists[i];
+    if (!list || list->copy || !list->ipage) continue;
+    bigint pgbytes = ((bigint) list->pgsize) * sizeof(int);
+    for (t = 0; t < nthreads; t++) {
+      allocated += list->ipage[t].npage_allocated() * pgbytes;
+      used += list->ipage[t].npage_used() * pgbytes;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    return # of bytes of allocated memory
 ------------------------------------------------------------------------- */
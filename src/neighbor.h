@@ -45,6 +45,11 @@ class Neighbor : protected Pointers {
 
   int binsizeflag;                 // user-chosen bin size
   double binsize_user;             // set externally by some accelerator pkgs
+  int packflag;                    // 1 if lists repacked into aligned blocks
+  int partialflag;                 // 1 if partial list rebuilds are enabled
+  int pgdecay;                     // free mostly-unused list pages after
+                                   //   this many consecutive builds, 0 = off
+  bigint pgdecay_freed;            // bytes of pages returned to the OS
 
   bigint ncalls;                   // # of times build has been called
   bigint ndanger;                  // # of dangerous builds
@@ -76,6 +81,7 @@ class Neighbor : protected Pointers {
   // special info, used by NeighPair
 
   int special_flag[4];             // flags for 1-2, 1-3, 1-4 neighbors
+  int nospecial_flag;              // 1 if no list entry carries sbmask() bits
 
   // cluster setting, used by NeighTopo
 
@@ -91,6 +97,12 @@ class Neighbor : protected Pointers {
   class NeighRequest **requests;       // from Pair,Fix,Compute,Command classes
   class NeighRequest **old_requests;   // copy of requests to compare to
 
+  // per-phase wall-time accumulators, for timer detail
+
+  double time_detail_bin;              // time spent binning atoms
+  double time_detail_stencil;          // time spent creating stencils
+  double *time_detail_build;           // per-list time spent building
+
   // data from topology neighbor lists
 
   int nbondlist;                   // list of bonds to compute
@@ -112,6 +124,8 @@ class Neighbor : protected Pointers {
   virtual int check_distance();     // check max distance moved since last build
   void setup_bins();                // setup bins based on box and cutoff
   virtual void build(int);          // build all perpetual neighbor lists
+  int partial_ok();                 // can a partial rebuild replace a full one
+  void build_partial();             // refresh list rows near moved atoms only
   virtual void build_topology();    // pairwise topology neighbor lists
   void build_one(class NeighList *list, int preflag=0);
                                     // create a one-time pairwise neigh list
@@ -124,8 +138,9 @@ class Neighbor : protected Pointers {
   class NeighRequest *find_request(void *);  // find a neighbor request
 
   bigint memory_usage();
+  void page_stats(bigint &, bigint &);  // allocated/used bytes of list pages
 
-  bigint last_setup_bins;          // step of last neighbor::setup_bins() call
+  bigint last_setup_bins;         // step of last neighbor::setup_bins() call
 
  protected:
   int me,nprocs;
@@ -145,6 +160,13 @@ class Neighbor : protected Pointers {
   double **xhold;                      // atom coords at last neighbor build
   int maxhold;                         // size of xhold array
 
+  int partial_allowed();           // partial rebuild prerequisites hold
+  void decay_pages();              // return mostly-unused list pages to OS
+  int partial_ready;               // 1 if last check found only small moves
+  int nall_hold;                   // # of owned+ghost atoms at last full build
+  int *pdirty;                     // which atoms moved > 1/4 skin since then
+  int maxpdirty;                   // size of pdirty array
+
   int boxcheck;                        // 1 if need to store box size
   double boxlo_hold[3],boxhi_hold[3];  // box size at last neighbor build
   double corners_hold[8][3];           // box corners at last neighbor build
@@ -206,6 +228,7 @@ class Neighbor : protected Pointers {
   void morph_unique();
   void morph_skip();
   void morph_granular();
+  void morph_prune();
   void morph_halffull();
   void morph_copy();
 
@@ -278,6 +301,7 @@ namespace NeighConst {
   static const int NP_SKIP          = 1<<22;
   static const int NP_HALF_FULL     = 1<<23;
   static const int NP_OFF2ON        = 1<<24;
+  static const int NP_PRUNE         = 1<<25;
 }
 
 }
@@ -34,6 +34,8 @@ NPair::NPair(LAMMPS *lmp)
   molecular = atom->molecular;
   copymode = 0;
   execution_space = Host;
+  dirtybin = NULL;
+  maxdirtybin = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -43,6 +45,7 @@ NPair::~NPair()
   if (copymode) return;
 
   memory->destroy(mycutneighsq);
+  memory->destroy(dirtybin);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -148,6 +151,7 @@ void NPair::copy_stencil_info()
   nstencil_multi = ns->nstencil_multi;
   stencil_multi = ns->stencil_multi;
   distsq_multi = ns->distsq_multi;
+  ncut_multi = ns->ncut_multi;
 }
 
 /* ----------------------------------------------------------------------
@@ -164,6 +168,27 @@ void NPair::build_setup()
   last_build = update->ntimestep;
 }
 
+/* ----------------------------------------------------------------------
+   flag each bin that holds an atom that moved > 1/4 skin since the
+   last full build, for use by partial rebuilds
+   caller must have rebinned all atoms first
+------------------------------------------------------------------------- */
+
+void NPair::mark_dirty_bins(const int *dirty)
+{
+  if (mbins > maxdirtybin) {
+    maxdirtybin = mbins;
+    memory->destroy(dirtybin);
+    memory->create(dirtybin,maxdirtybin,"npair:dirtybin");
+  }
+
+  for (int i = 0; i < mbins; i++) dirtybin[i] = 0;
+
+  int nall = atom->nlocal + atom->nghost;
+  for (int i = 0; i < nall; i++)
+    if (dirty[i]) dirtybin[atom2bin[i]] = 1;
+}
+
 /* ----------------------------------------------------------------------
    test if atom pair i,j is excluded from neighbor list
    due to type, group, molecule settings from neigh_modify command
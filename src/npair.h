@@ -34,6 +34,12 @@ class NPair : protected Pointers {
   void build_setup();
   virtual void build(class NeighList *) = 0;
 
+  // partial rebuild: refresh rows near moved atoms only
+  // styles without a specialized path rebuild the whole list
+
+  virtual void build_partial(class NeighList *list, const int * /*dirty*/,
+                             double ** /*xhold*/) {build(list);}
+
  protected:
   double **mycutneighsq;         // per-type cutoffs when user specified
 
@@ -87,15 +93,20 @@ class NPair : protected Pointers {
   int *nstencil_multi;
   int **stencil_multi;
   double **distsq_multi;
+  int **ncut_multi;
 
   // data common to all NPair variants
 
   int molecular;
 
+  int *dirtybin;                // bins holding a moved atom, partial rebuilds
+  int maxdirtybin;              // size of dirtybin array
+
   // methods for all NPair variants
 
   virtual void copy_bin_info();
   virtual void copy_stencil_info();
+  void mark_dirty_bins(const int *);  // flag bins holding moved atoms
 
   int exclusion(int, int, int,
                 int, int *, tagint *) const;   // test for pair exclusion
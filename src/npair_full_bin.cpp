@@ -18,8 +18,13 @@
 #include "molecule.h"
 #include "domain.h"
 #include "my_page.h"
+#include "comm.h"
 #include "error.h"
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -29,9 +34,134 @@ NPairFullBin::NPairFullBin(LAMMPS *lmp) : NPair(lmp) {}
 /* ----------------------------------------------------------------------
    binned neighbor list construction for all neighbors
    every neighbor pair appears in list of both atoms i and j
+   thread-parallel over owned atoms when compiled with OpenMP,
+     each thread pages from its own arena in list->ipage
 ------------------------------------------------------------------------- */
 
 void NPairFullBin::build(NeighList *list)
+{
+  int moltemplate;
+
+  double **x = atom->x;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  tagint *tag = atom->tag;
+  tagint *molecule = atom->molecule;
+  tagint **special = atom->special;
+  int **nspecial = atom->nspecial;
+  int nlocal = atom->nlocal;
+  if (includegroup) nlocal = atom->nfirst;
+
+  int *molindex = atom->molindex;
+  int *molatom = atom->molatom;
+  Molecule **onemols = atom->avec->onemols;
+  if (molecular == 2) moltemplate = 1;
+  else moltemplate = 0;
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  int overflow = 0;
+
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(comm->nthreads) reduction(+:overflow)
+#endif
+  {
+  int i,j,k,n,itype,jtype,ibin,which,imol,iatom;
+  tagint tagprev;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  int *neighptr;
+
+  // each thread works on a contiguous chunk of atoms with its own page arena
+
+  int tid = 0;
+  int nthreads = 1;
+#if defined(_OPENMP)
+  tid = omp_get_thread_num();
+  nthreads = omp_get_num_threads();
+#endif
+  const int ifrom = (int) ((bigint) tid * nlocal / nthreads);
+  const int ito = (int) ((bigint) (tid+1) * nlocal / nthreads);
+
+  MyPage<int> *ipage = &list->ipage[tid];
+  ipage->reset();
+
+  for (i = ifrom; i < ito; i++) {
+    n = 0;
+    neighptr = ipage->vget();
+
+    itype = type[i];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    if (moltemplate) {
+      imol = molindex[i];
+      iatom = molatom[i];
+      tagprev = tag[i] - iatom - 1;
+    }
+
+    // loop over all atoms in surrounding bins in stencil including self
+    // skip i = j
+
+    ibin = atom2bin[i];
+
+    for (k = 0; k < nstencil; k++) {
+      for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
+        if (i == j) continue;
+
+        jtype = type[j];
+        if (exclude && exclusion(i,j,itype,jtype,mask,molecule)) continue;
+
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+
+        if (rsq <= cutneighsq[itype][jtype]) {
+          if (molecular) {
+            if (!moltemplate)
+              which = find_special(special[i],nspecial[i],tag[j]);
+            else if (imol >= 0)
+              which = find_special(onemols[imol]->special[iatom],
+                                   onemols[imol]->nspecial[iatom],
+                                   tag[j]-tagprev);
+            else which = 0;
+            if (which == 0) neighptr[n++] = j;
+            else if (domain->minimum_image_check(delx,dely,delz))
+              neighptr[n++] = j;
+            else if (which > 0) neighptr[n++] = j ^ (which << SBBITS);
+          } else neighptr[n++] = j;
+        }
+      }
+    }
+
+    ilist[i] = i;
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status()) overflow++;
+  }
+  }
+
+  if (overflow)
+    error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+
+  list->inum = nlocal;
+  list->gnum = 0;
+}
+
+/* ----------------------------------------------------------------------
+   partial variant: refresh only rows whose stencil bins hold an atom
+     that moved > 1/4 skin since the last full build
+   new rows are appended to the existing pages without a reset, so
+     untouched rows remain valid; pages are reclaimed at next full build
+   full lists store every pair on both atoms, so no ownership tie-break
+     is involved and held coords are not needed
+------------------------------------------------------------------------- */
+
+void NPairFullBin::build_partial(NeighList *list, const int *dirty,
+                                 double ** /*xhold*/)
 {
   int i,j,k,n,itype,jtype,ibin,which,imol,iatom,moltemplate;
   tagint tagprev;
@@ -46,7 +176,6 @@ void NPairFullBin::build(NeighList *list)
   tagint **special = atom->special;
   int **nspecial = atom->nspecial;
   int nlocal = atom->nlocal;
-  if (includegroup) nlocal = atom->nfirst;
 
   int *molindex = atom->molindex;
   int *molatom = atom->molatom;
@@ -54,15 +183,24 @@ void NPairFullBin::build(NeighList *list)
   if (molecular == 2) moltemplate = 1;
   else moltemplate = 0;
 
-  int *ilist = list->ilist;
   int *numneigh = list->numneigh;
   int **firstneigh = list->firstneigh;
   MyPage<int> *ipage = list->ipage;
 
-  int inum = 0;
-  ipage->reset();
+  mark_dirty_bins(dirty);
 
   for (i = 0; i < nlocal; i++) {
+
+    // skip atoms with no moved atom in reach of their stencil
+    // full stencil includes the central bin
+
+    ibin = atom2bin[i];
+    int refresh = dirty[i];
+    if (!refresh)
+      for (k = 0; k < nstencil; k++)
+        if (dirtybin[ibin+stencil[k]]) {refresh = 1; break;}
+    if (!refresh) continue;
+
     n = 0;
     neighptr = ipage->vget();
 
@@ -79,8 +217,6 @@ void NPairFullBin::build(NeighList *list)
     // loop over all atoms in surrounding bins in stencil including self
     // skip i = j
 
-    ibin = atom2bin[i];
-
     for (k = 0; k < nstencil; k++) {
       for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
         if (i == j) continue;
@@ -111,14 +247,10 @@ void NPairFullBin::build(NeighList *list)
       }
     }
 
-    ilist[inum++] = i;
     firstneigh[i] = neighptr;
     numneigh[i] = n;
     ipage->vgot(n);
     if (ipage->status())
       error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
   }
-
-  list->inum = inum;
-  list->gnum = 0;
 }
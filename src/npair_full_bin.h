@@ -32,6 +32,7 @@ class NPairFullBin : public NPair {
   NPairFullBin(class LAMMPS *);
   ~NPairFullBin() {}
   void build(class NeighList *);
+  void build_partial(class NeighList *, const int *, double **);
 };
 
 }
@@ -37,8 +37,7 @@ void NPairFullMulti::build(NeighList *list)
   int i,j,k,n,itype,jtype,ibin,which,ns,imol,iatom,moltemplate;
   tagint tagprev;
   double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
-  int *neighptr,*s;
-  double *cutsq,*distsq;
+  int *neighptr,*s,*ncut;
 
   double **x = atom->x;
   int *type = atom->type;
@@ -79,18 +78,18 @@ void NPairFullMulti::build(NeighList *list)
     }
 
     // loop over all atoms in other bins in stencil, including self
-    // skip if i,j neighbor cutoff is less than bin distance
+    // stencil bins are sorted by distance: only the first ncut[jtype]
+    // bins can hold atoms of type jtype within the i,j cutoff
     // skip i = j
 
     ibin = atom2bin[i];
     s = stencil_multi[itype];
-    distsq = distsq_multi[itype];
-    cutsq = cutneighsq[itype];
+    ncut = ncut_multi[itype];
     ns = nstencil_multi[itype];
     for (k = 0; k < ns; k++) {
       for (j = binhead[ibin+s[k]]; j >= 0; j = bins[j]) {
         jtype = type[j];
-        if (cutsq[jtype] < distsq[k]) continue;
+        if (k >= ncut[jtype]) continue;
         if (i == j) continue;
 
         if (exclude && exclusion(i,j,itype,jtype,mask,molecule)) continue;
@@ -18,8 +18,13 @@
 #include "molecule.h"
 #include "domain.h"
 #include "my_page.h"
+#include "comm.h"
 #include "error.h"
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -30,14 +35,13 @@ NPairHalfBinNewton::NPairHalfBinNewton(LAMMPS *lmp) : NPair(lmp) {}
    binned neighbor list construction with full Newton's 3rd law
    each owned atom i checks its own bin and other bins in Newton stencil
    every pair stored exactly once by some processor
+   thread-parallel over owned atoms when compiled with OpenMP,
+     each thread pages from its own arena in list->ipage
 ------------------------------------------------------------------------- */
 
 void NPairHalfBinNewton::build(NeighList *list)
 {
-  int i,j,k,n,itype,jtype,ibin,which,imol,iatom,moltemplate;
-  tagint tagprev;
-  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
-  int *neighptr;
+  int moltemplate;
 
   double **x = atom->x;
   int *type = atom->type;
@@ -58,12 +62,33 @@ void NPairHalfBinNewton::build(NeighList *list)
   int *ilist = list->ilist;
   int *numneigh = list->numneigh;
   int **firstneigh = list->firstneigh;
-  MyPage<int> *ipage = list->ipage;
 
-  int inum = 0;
+  int overflow = 0;
+
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(comm->nthreads) reduction(+:overflow)
+#endif
+  {
+  int i,j,k,n,itype,jtype,ibin,which,imol,iatom;
+  tagint tagprev;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  int *neighptr;
+
+  // each thread works on a contiguous chunk of atoms with its own page arena
+
+  int tid = 0;
+  int nthreads = 1;
+#if defined(_OPENMP)
+  tid = omp_get_thread_num();
+  nthreads = omp_get_num_threads();
+#endif
+  const int ifrom = (int) ((bigint) tid * nlocal / nthreads);
+  const int ito = (int) ((bigint) (tid+1) * nlocal / nthreads);
+
+  MyPage<int> *ipage = &list->ipage[tid];
   ipage->reset();
 
-  for (i = 0; i < nlocal; i++) {
+  for (i = ifrom; i < ito; i++) {
     n = 0;
     neighptr = ipage->vget();
 
@@ -148,13 +173,155 @@ void NPairHalfBinNewton::build(NeighList *list)
       }
     }
 
-    ilist[inum++] = i;
+    ilist[i] = i;
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status()) overflow++;
+  }
+  }
+
+  if (overflow)
+    error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+
+  list->inum = nlocal;
+}
+
+/* ----------------------------------------------------------------------
+   partial variant: refresh only rows whose own bin or stencil bins hold
+     an atom that moved > 1/4 skin since the last full build
+   new rows are appended to the existing pages without a reset, so
+     untouched rows remain valid; pages are reclaimed at next full build
+   ownership tie-breaks for in-bin ghosts use the coords held at the last
+     full build (xhold) so every proc keeps making the same decision for
+     a pair regardless of when its rows were last refreshed
+------------------------------------------------------------------------- */
+
+void NPairHalfBinNewton::build_partial(NeighList *list, const int *dirty,
+                                       double **xhold)
+{
+  int i,j,k,n,itype,jtype,ibin,which,imol,iatom,moltemplate;
+  tagint tagprev;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  int *neighptr;
+
+  double **x = atom->x;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  tagint *tag = atom->tag;
+  tagint *molecule = atom->molecule;
+  tagint **special = atom->special;
+  int **nspecial = atom->nspecial;
+  int nlocal = atom->nlocal;
+
+  int *molindex = atom->molindex;
+  int *molatom = atom->molatom;
+  Molecule **onemols = atom->avec->onemols;
+  if (molecular == 2) moltemplate = 1;
+  else moltemplate = 0;
+
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  MyPage<int> *ipage = list->ipage;
+
+  mark_dirty_bins(dirty);
+
+  for (i = 0; i < nlocal; i++) {
+
+    // skip atoms with no moved atom in reach of their half stencil
+
+    ibin = atom2bin[i];
+    int refresh = dirty[i] | dirtybin[ibin];
+    if (!refresh)
+      for (k = 0; k < nstencil; k++)
+        if (dirtybin[ibin+stencil[k]]) {refresh = 1; break;}
+    if (!refresh) continue;
+
+    n = 0;
+    neighptr = ipage->vget();
+
+    itype = type[i];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    if (moltemplate) {
+      imol = molindex[i];
+      iatom = molatom[i];
+      tagprev = tag[i] - iatom - 1;
+    }
+
+    // loop over rest of atoms in i's bin, ghosts are at end of linked list
+    // held coords decide which side of a ghost pair stores it
+
+    for (j = bins[i]; j >= 0; j = bins[j]) {
+      if (j >= nlocal) {
+        if (xhold[j][2] < xhold[i][2]) continue;
+        if (xhold[j][2] == xhold[i][2]) {
+          if (xhold[j][1] < xhold[i][1]) continue;
+          if (xhold[j][1] == xhold[i][1] && xhold[j][0] < xhold[i][0])
+            continue;
+        }
+      }
+
+      jtype = type[j];
+      if (exclude && exclusion(i,j,itype,jtype,mask,molecule)) continue;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+
+      if (rsq <= cutneighsq[itype][jtype]) {
+        if (molecular) {
+          if (!moltemplate)
+            which = find_special(special[i],nspecial[i],tag[j]);
+          else if (imol >= 0)
+            which = find_special(onemols[imol]->special[iatom],
+                                 onemols[imol]->nspecial[iatom],
+                                 tag[j]-tagprev);
+          else which = 0;
+          if (which == 0) neighptr[n++] = j;
+          else if (domain->minimum_image_check(delx,dely,delz))
+            neighptr[n++] = j;
+          else if (which > 0) neighptr[n++] = j ^ (which << SBBITS);
+        } else neighptr[n++] = j;
+      }
+    }
+
+    // loop over all atoms in other bins in stencil, store every pair
+
+    for (k = 0; k < nstencil; k++) {
+      for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
+        jtype = type[j];
+        if (exclude && exclusion(i,j,itype,jtype,mask,molecule)) continue;
+
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+
+        if (rsq <= cutneighsq[itype][jtype]) {
+          if (molecular) {
+            if (!moltemplate)
+              which = find_special(special[i],nspecial[i],tag[j]);
+            else if (imol >= 0)
+              which = find_special(onemols[imol]->special[iatom],
+                                   onemols[imol]->nspecial[iatom],
+                                   tag[j]-tagprev);
+            else which = 0;
+            if (which == 0) neighptr[n++] = j;
+            else if (domain->minimum_image_check(delx,dely,delz))
+              neighptr[n++] = j;
+            else if (which > 0) neighptr[n++] = j ^ (which << SBBITS);
+          } else neighptr[n++] = j;
+        }
+      }
+    }
+
     firstneigh[i] = neighptr;
     numneigh[i] = n;
     ipage->vgot(n);
     if (ipage->status())
       error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
   }
-
-  list->inum = inum;
 }
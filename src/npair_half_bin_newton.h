@@ -31,6 +31,7 @@ class NPairHalfBinNewton : public NPair {
   NPairHalfBinNewton(class LAMMPS *);
   ~NPairHalfBinNewton() {}
   void build(class NeighList *);
+  void build_partial(class NeighList *, const int *, double **);
 };
 
 }
@@ -38,8 +38,7 @@ void NPairHalfMultiNewtonTri::build(NeighList *list)
   int i,j,k,n,itype,jtype,ibin,which,ns,imol,iatom,moltemplate;
   tagint tagprev;
   double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
-  int *neighptr,*s;
-  double *cutsq,*distsq;
+  int *neighptr,*s,*ncut;
 
   double **x = atom->x;
   int *type = atom->type;
@@ -80,7 +79,8 @@ void NPairHalfMultiNewtonTri::build(NeighList *list)
     }
 
     // loop over all atoms in bins, including self, in stencil
-    // skip if i,j neighbor cutoff is less than bin distance
+    // stencil bins are sorted by distance: only the first ncut[jtype]
+    // bins can hold atoms of type jtype within the i,j cutoff
     // bins below self are excluded from stencil
     // pairs for atoms j "below" i are excluded
     // below = lower z or (equal z and lower y) or (equal zy and lower x)
@@ -89,13 +89,12 @@ void NPairHalfMultiNewtonTri::build(NeighList *list)
 
     ibin = atom2bin[i];
     s = stencil_multi[itype];
-    distsq = distsq_multi[itype];
-    cutsq = cutneighsq[itype];
+    ncut = ncut_multi[itype];
     ns = nstencil_multi[itype];
     for (k = 0; k < ns; k++) {
       for (j = binhead[ibin+s[k]]; j >= 0; j = bins[j]) {
         jtype = type[j];
-        if (cutsq[jtype] < distsq[k]) continue;
+        if (k >= ncut[jtype]) continue;
         if (x[j][2] < ztmp) continue;
         if (x[j][2] == ztmp) {
           if (x[j][1] < ytmp) continue;
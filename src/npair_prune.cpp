@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "npair_prune.h"
+#include "neigh_list.h"
+#include "atom.h"
+#include "my_page.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+NPairPrune::NPairPrune(LAMMPS *lmp) : NPair(lmp) {}
+
+/* ----------------------------------------------------------------------
+   build list with the requestor cutoff from a longer-cutoff parent list
+   keep each parent pair whose current distance is within the cutoff
+   half/full, newton, and skip properties are inherited from the parent,
+   which was matched by Neighbor::morph_prune()
+------------------------------------------------------------------------- */
+
+void NPairPrune::build(NeighList *list)
+{
+  int i,j,ii,jj,n,jnum,joriginal;
+  int *neighptr,*jlist;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+
+  double **x = atom->x;
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  MyPage<int> *ipage = list->ipage;
+
+  int *ilist_prune = list->listprune->ilist;
+  int *numneigh_prune = list->listprune->numneigh;
+  int **firstneigh_prune = list->listprune->firstneigh;
+  int inum_prune = list->listprune->inum;
+
+  double cutsq = cutoff_custom * cutoff_custom;
+
+  int inum = 0;
+  ipage->reset();
+
+  // loop over parent list, keep pairs within my shorter cutoff
+
+  for (ii = 0; ii < inum_prune; ii++) {
+    n = 0;
+    neighptr = ipage->vget();
+
+    i = ilist_prune[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+
+    jlist = firstneigh_prune[i];
+    jnum = numneigh_prune[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      joriginal = jlist[jj];
+      j = joriginal & NEIGHMASK;
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq <= cutsq) neighptr[n++] = joriginal;
+    }
+
+    ilist[inum++] = i;
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status())
+      error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+  }
+
+  list->inum = inum;
+}
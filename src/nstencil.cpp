@@ -50,6 +50,9 @@ using namespace LAMMPS_NS;
      create one stencil for each atom type
      stencil follows same rules for half/full, newton on/off, triclinic
      cutoff is not cutneighmaxsq, but max cutoff for that atom type
+     each stencil is sorted by bin distance so scans touch near bins first
+     ncut_multi[itype][jtype] = # of leading bins within itype/jtype cutoff
+       so per-type scans skip far bins without a distance test
      no versions that allow ghost on (any need for it?)
 ------------------------------------------------------------------------- */
 
@@ -64,6 +67,7 @@ NStencil::NStencil(LAMMPS *lmp) : Pointers(lmp)
   nstencil_multi = NULL;
   stencil_multi = NULL;
   distsq_multi = NULL;
+  ncut_multi = NULL;
 
   dimension = domain->dimension;
 }
@@ -81,10 +85,12 @@ NStencil::~NStencil()
   for (int i = 1; i <= n; i++) {
     memory->destroy(stencil_multi[i]);
     memory->destroy(distsq_multi[i]);
+    memory->destroy(ncut_multi[i]);
   }
   delete [] nstencil_multi;
   delete [] stencil_multi;
   delete [] distsq_multi;
+  delete [] ncut_multi;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -105,6 +111,7 @@ void NStencil::copy_neighbor_info()
   cutneighmax = neighbor->cutneighmax;
   cutneighmaxsq = neighbor->cutneighmaxsq;
   cuttypesq = neighbor->cuttypesq;
+  cutneighsq = neighbor->cutneighsq;
 
   // overwrite Neighbor cutoff with custom value set by requestor
   // only works for style = BIN (checked by Neighbor class)
@@ -177,10 +184,12 @@ void NStencil::create_setup()
       nstencil_multi = new int[n+1];
       stencil_multi = new int*[n+1];
       distsq_multi = new double*[n+1];
+      ncut_multi = new int*[n+1];
       for (i = 1; i <= n; i++) {
         nstencil_multi[i] = 0;
         stencil_multi[i] = NULL;
         distsq_multi[i] = NULL;
+        memory->create(ncut_multi[i],n+1,"neighstencil:ncut_multi");
       }
     }
     if (smax > maxstencil_multi) {
@@ -220,6 +229,46 @@ double NStencil::bin_distance(int i, int j, int k)
   return (delx*delx + dely*dely + delz*delz);
 }
 
+/* ----------------------------------------------------------------------
+   sort stencil of atom type itype by distance to central bin, nearest first
+   then tabulate ncut_multi[itype][jtype] =
+     # of leading bins within the itype/jtype neighbor cutoff
+   lets per-type scans stop at an index instead of testing each bin distance
+------------------------------------------------------------------------- */
+
+void NStencil::sort_multi(int itype)
+{
+  int k,m,soffset;
+  double rsq,cutsq;
+
+  int *s = stencil_multi[itype];
+  double *distsq = distsq_multi[itype];
+  int n = nstencil_multi[itype];
+
+  // insertion sort, stencils are small and nearly ordered already
+
+  for (k = 1; k < n; k++) {
+    rsq = distsq[k];
+    soffset = s[k];
+    m = k - 1;
+    while (m >= 0 && distsq[m] > rsq) {
+      distsq[m+1] = distsq[m];
+      s[m+1] = s[m];
+      m--;
+    }
+    distsq[m+1] = rsq;
+    s[m+1] = soffset;
+  }
+
+  int ntypes = atom->ntypes;
+  for (int jtype = 1; jtype <= ntypes; jtype++) {
+    cutsq = cutneighsq[itype][jtype];
+    k = 0;
+    while (k < n && distsq[k] <= cutsq) k++;
+    ncut_multi[itype][jtype] = k;
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 bigint NStencil::memory_usage()
@@ -231,6 +280,7 @@ bigint NStencil::memory_usage()
   } else if (neighstyle == Neighbor::MULTI) {
     bytes += atom->ntypes*maxstencil_multi * sizeof(int);
     bytes += atom->ntypes*maxstencil_multi * sizeof(double);
+    bytes += atom->ntypes*(atom->ntypes+1) * sizeof(int);
   }
   return bytes;
 }
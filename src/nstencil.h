@@ -30,6 +30,8 @@ class NStencil : protected Pointers {
   int *nstencil_multi;             // # bins in each type-based multi stencil
   int **stencil_multi;             // list of bin offsets in each stencil
   double **distsq_multi;           // sq distances to bins in each stencil
+  int **ncut_multi;                // # of leading bins of itype stencil
+                                   //   within itype/jtype cutoff
   int sx,sy,sz;                    // extent of stencil in each dim
 
   double cutoff_custom;            // cutoff set by requestor
@@ -53,6 +55,7 @@ class NStencil : protected Pointers {
   double cutneighmax;
   double cutneighmaxsq;
   double *cuttypesq;
+  double **cutneighsq;
 
   // data from NBin class
 
@@ -72,6 +75,7 @@ class NStencil : protected Pointers {
 
   void copy_bin_info();                     // copy info from NBin class
   double bin_distance(int, int, int);       // distance between bin corners
+  void sort_multi(int);                     // sort one multi stencil by distance
 };
 
 }
@@ -46,5 +46,6 @@ void NStencilFullMulti2d::create()
         }
       }
     nstencil_multi[itype] = n;
+    sort_multi(itype);
   }
 }
@@ -47,5 +47,6 @@ void NStencilFullMulti3d::create()
           }
         }
     nstencil_multi[itype] = n;
+    sort_multi(itype);
   }
 }
@@ -47,5 +47,6 @@ void NStencilHalfMulti2dNewtoff::create()
         }
       }
     nstencil_multi[itype] = n;
+    sort_multi(itype);
   }
 }
@@ -48,5 +48,6 @@ void NStencilHalfMulti2dNewton::create()
           }
         }
     nstencil_multi[itype] = n;
+    sort_multi(itype);
   }
 }
@@ -47,5 +47,6 @@ void NStencilHalfMulti2dNewtonTri::create()
         }
       }
     nstencil_multi[itype] = n;
+    sort_multi(itype);
   }
 }
@@ -48,5 +48,6 @@ void NStencilHalfMulti3dNewtoff::create()
           }
         }
     nstencil_multi[itype] = n;
+    sort_multi(itype);
   }
 }
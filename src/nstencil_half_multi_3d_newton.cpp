@@ -49,5 +49,6 @@ void NStencilHalfMulti3dNewton::create()
             }
           }
     nstencil_multi[itype] = n;
+    sort_multi(itype);
   }
 }
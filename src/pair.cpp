@@ -93,6 +93,7 @@ Pair::Pair(LAMMPS *lmp) : Pointers(lmp)
   tabinner = sqrt(2.0);
   tabinner_disp = sqrt(2.0);
   ftable = NULL;
+  tabpacked = NULL;
   fdisptable = NULL;
 
   allocated = 0;
@@ -103,6 +104,9 @@ Pair::Pair(LAMMPS *lmp) : Pointers(lmp)
   vatom = NULL;
   cvatom = NULL;
 
+  maxxtype = 0;
+  xtype = NULL;
+
   num_tally_compute = 0;
   list_tally_compute = NULL;
 
@@ -131,6 +135,7 @@ Pair::~Pair()
   memory->destroy(eatom);
   memory->destroy(vatom);
   memory->destroy(cvatom);
+  memory->destroy(xtype);
 }
 
 /* ----------------------------------------------------------------------
@@ -320,6 +325,31 @@ void Pair::init_list(int /*which*/, NeighList *ptr)
   list = ptr;
 }
 
+/* ----------------------------------------------------------------------
+   shared Coulomb table registry
+   hybrid sub-styles with the same cutoff/precision/kspace parameters
+   each used to build an identical table set; now the first builder
+   registers its arrays here and later styles alias them, so one copy
+   sits in cache regardless of the number of sub-styles
+   entries are refcounted, free_tables() releases a reference
+------------------------------------------------------------------------- */
+
+namespace {
+  struct CoulTableSet {
+    int bits,msmflag,respaflag;
+    double tabinner,cut_coul,g_ewald,qqrd2e;
+    double respa_inner,respa_outer;
+    void *kspace;                  // disambiguates msm gamma functions
+    double tabinnersq;             // final (adjusted) inner cutoff
+    double *r,*dr,*f,*df,*c,*dc,*e,*de;
+    double *v,*dv,*p,*dp;
+    double *packed;
+    int refcount;
+    CoulTableSet *next;
+  };
+  CoulTableSet *coul_tables = NULL;
+}
+
 /* ----------------------------------------------------------------------
    setup Coulomb force tables used in compute routines
 ------------------------------------------------------------------------- */
@@ -349,6 +379,29 @@ void Pair::init_tables(double cut_coul, double *cut_respa)
 
   if (ftable) free_tables();
 
+  // alias an identical table set from the registry if one exists
+
+  for (CoulTableSet *set = coul_tables; set; set = set->next) {
+    if (set->bits != ncoultablebits || set->msmflag != msmflag) continue;
+    if (set->tabinner != tabinner || set->cut_coul != cut_coul) continue;
+    if (set->g_ewald != g_ewald || set->qqrd2e != qqrd2e) continue;
+    if (msmflag && set->kspace != (void *) force->kspace) continue;
+    if (set->respaflag != (cut_respa != NULL)) continue;
+    if (cut_respa && (set->respa_inner != cut_respa[2] ||
+                      set->respa_outer != cut_respa[3])) continue;
+
+    tabinnersq = set->tabinnersq;
+    rtable = set->r; drtable = set->dr;
+    ftable = set->f; dftable = set->df;
+    ctable = set->c; dctable = set->dc;
+    etable = set->e; detable = set->de;
+    vtable = set->v; dvtable = set->dv;
+    ptable = set->p; dptable = set->dp;
+    tabpacked = set->packed;
+    set->refcount++;
+    return;
+  }
+
   memory->create(rtable,ntable,"pair:rtable");
   memory->create(ftable,ntable,"pair:ftable");
   memory->create(ctable,ntable,"pair:ctable");
@@ -530,6 +583,46 @@ void Pair::init_tables(double cut_coul, double *cut_respa)
       dptable[itablemax] = p_tmp - ptable[itablemax];
     }
   }
+
+  // interleaved copy: the 8 doubles a non-respa lookup reads are one
+  // cacheline instead of lines from 8 separate arrays
+
+  memory->create(tabpacked,8*ntable,"pair:tabpacked");
+  for (int i = 0; i < ntable; i++) {
+    tabpacked[8*i  ] = rtable[i];
+    tabpacked[8*i+1] = drtable[i];
+    tabpacked[8*i+2] = ftable[i];
+    tabpacked[8*i+3] = dftable[i];
+    tabpacked[8*i+4] = ctable[i];
+    tabpacked[8*i+5] = dctable[i];
+    tabpacked[8*i+6] = etable[i];
+    tabpacked[8*i+7] = detable[i];
+  }
+
+  // register this table set for sharing
+
+  CoulTableSet *set = new CoulTableSet;
+  set->bits = ncoultablebits;
+  set->msmflag = msmflag;
+  set->respaflag = (cut_respa != NULL);
+  set->tabinner = tabinner;
+  set->cut_coul = cut_coul;
+  set->g_ewald = g_ewald;
+  set->qqrd2e = qqrd2e;
+  set->respa_inner = cut_respa ? cut_respa[2] : 0.0;
+  set->respa_outer = cut_respa ? cut_respa[3] : 0.0;
+  set->kspace = (void *) force->kspace;
+  set->tabinnersq = tabinnersq;
+  set->r = rtable; set->dr = drtable;
+  set->f = ftable; set->df = dftable;
+  set->c = ctable; set->dc = dctable;
+  set->e = etable; set->de = detable;
+  set->v = vtable; set->dv = dvtable;
+  set->p = ptable; set->dp = dptable;
+  set->packed = tabpacked;
+  set->refcount = 1;
+  set->next = coul_tables;
+  coul_tables = set;
 }
 
 /* ----------------------------------------------------------------------
@@ -640,18 +733,37 @@ void Pair::init_tables_disp(double cut_lj_global)
 
 void Pair::free_tables()
 {
-  memory->destroy(rtable);
-  memory->destroy(drtable);
-  memory->destroy(ftable);
-  memory->destroy(dftable);
-  memory->destroy(ctable);
-  memory->destroy(dctable);
-  memory->destroy(etable);
-  memory->destroy(detable);
-  memory->destroy(vtable);
-  memory->destroy(dvtable);
-  memory->destroy(ptable);
-  memory->destroy(dptable);
+  // release our reference on the shared table set,
+  // the arrays are freed once the last style referencing them lets go
+
+  CoulTableSet *prev = NULL;
+  for (CoulTableSet *set = coul_tables; set; prev = set, set = set->next) {
+    if (set->f != ftable) continue;
+    if (--set->refcount == 0) {
+      if (prev) prev->next = set->next;
+      else coul_tables = set->next;
+      memory->destroy(set->r);
+      memory->destroy(set->dr);
+      memory->destroy(set->f);
+      memory->destroy(set->df);
+      memory->destroy(set->c);
+      memory->destroy(set->dc);
+      memory->destroy(set->e);
+      memory->destroy(set->de);
+      memory->destroy(set->v);
+      memory->destroy(set->dv);
+      memory->destroy(set->p);
+      memory->destroy(set->dp);
+      memory->destroy(set->packed);
+      delete set;
+    }
+    break;
+  }
+
+  rtable = drtable = ftable = dftable = NULL;
+  ctable = dctable = etable = detable = NULL;
+  vtable = dvtable = ptable = dptable = NULL;
+  tabpacked = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -1600,6 +1712,26 @@ void Pair::virial_fdotr_compute()
     }
   }
 
+  // in deterministic mode this style's contributions live in the
+  // fixed-point accumulators, not yet in f, so tally them here too
+
+  if (atom->f_det_flag) {
+    int64_t **f_det = atom->f_det;
+    double inv_scale = 1.0/atom->f_det_scale;
+    int nall = atom->nlocal + atom->nghost;
+    for (int i = 0; i < nall; i++) {
+      double fx = f_det[i][0]*inv_scale;
+      double fy = f_det[i][1]*inv_scale;
+      double fz = f_det[i][2]*inv_scale;
+      virial[0] += fx*x[i][0];
+      virial[1] += fy*x[i][1];
+      virial[2] += fz*x[i][2];
+      virial[3] += fy*x[i][0];
+      virial[4] += fz*x[i][0];
+      virial[5] += fz*x[i][1];
+    }
+  }
+
   // prevent multiple calls to update the virial
   // when a hybrid pair style uses both a gpu and non-gpu pair style
   // or when respa is used with gpu pair styles
@@ -1829,6 +1961,35 @@ void Pair::hessian_twobody(double fforce, double dfac, double delr[3], double ph
     }
   }
 }
+/* ----------------------------------------------------------------------
+   refresh the packed {x,y,z,type} mirror of the local+ghost atoms
+   each record is 32 bytes (type stored via ubuf), so an inner pair loop
+   reading the mirror touches one cache line per neighbor instead of one
+   line each from atom->x and atom->type
+   styles which read the mirror call this at the top of compute()
+------------------------------------------------------------------------- */
+
+void Pair::build_xtype_cache()
+{
+  int nall = atom->nlocal + atom->nghost;
+
+  if (nall > maxxtype) {
+    memory->destroy(xtype);
+    maxxtype = atom->nmax;
+    memory->create(xtype,maxxtype,4,"pair:xtype");
+  }
+
+  double **x = atom->x;
+  int *type = atom->type;
+
+  for (int i = 0; i < nall; i++) {
+    xtype[i][0] = x[i][0];
+    xtype[i][1] = x[i][1];
+    xtype[i][2] = x[i][2];
+    xtype[i][3] = ubuf(type[i]).d;
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 double Pair::memory_usage()
@@ -1836,6 +1997,7 @@ double Pair::memory_usage()
   double bytes = comm->nthreads*maxeatom * sizeof(double);
   bytes += comm->nthreads*maxvatom*6 * sizeof(double);
   bytes += comm->nthreads*maxcvatom*9 * sizeof(double);
+  bytes += maxxtype*4 * sizeof(double);
   return bytes;
 }
 
@@ -87,6 +87,8 @@ class Pair : protected Pointers {
   double tabinnerdispsq;
   double *rtable,*drtable,*ftable,*dftable,*ctable,*dctable;
   double *etable,*detable,*ptable,*dptable,*vtable,*dvtable;
+  double *tabpacked;             // interleaved [r,dr,f,df,c,dc,e,de] per
+                                 // entry, one cacheline per lookup
   double *rdisptable, *drdisptable, *fdisptable, *dfdisptable;
   double *edisptable, *dedisptable;
   int ncoulshiftbits,ncoulmask;
@@ -242,6 +244,11 @@ class Pair : protected Pointers {
   int copymode;   // if set, do not deallocate during destruction
                   // required when classes are used as functors by Kokkos
 
+  double **xtype;              // packed {x,y,z,type} per-atom mirror
+  int maxxtype;                // allocated # of rows in xtype
+
+  void build_xtype_cache();    // refresh mirror for local+ghost atoms
+
   void ev_init(int eflag, int vflag, int alloc = 1) {
     if (eflag||vflag) ev_setup(eflag, vflag, alloc);
     else ev_unset();
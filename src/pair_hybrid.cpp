@@ -20,8 +20,10 @@
 #include "force.h"
 #include "pair.h"
 #include "neighbor.h"
+#include "neigh_list.h"
 #include "neigh_request.h"
 #include "update.h"
+#include "timer.h"
 #include "comm.h"
 #include "memory.h"
 #include "error.h"
@@ -36,13 +38,18 @@ using namespace LAMMPS_NS;
 
 PairHybrid::PairHybrid(LAMMPS *lmp) : Pair(lmp),
   styles(NULL), keywords(NULL), multiple(NULL), nmap(NULL),
-  map(NULL), special_lj(NULL), special_coul(NULL), compute_tally(NULL)
+  map(NULL), special_lj(NULL), special_coul(NULL), compute_tally(NULL),
+  time_detail(NULL)
 {
   nstyles = 0;
 
   outerflag = 0;
   respaflag = 0;
 
+  fusedflag = 0;
+  fusedmap = NULL;
+  nfusedtally = 0;
+
   // assume pair hybrid always supports centroid atomic stress,
   // so that cflag_atom gets set when needed
   centroidstressflag = 2;
@@ -67,6 +74,12 @@ PairHybrid::~PairHybrid()
   delete [] special_lj;
   delete [] special_coul;
   delete [] compute_tally;
+  delete [] time_detail;
+
+  if (fusedmap) {
+    delete [] fusedmap[0];
+    delete [] fusedmap;
+  }
 
   delete [] svector;
 
@@ -123,6 +136,23 @@ void PairHybrid::compute(int eflag, int vflag)
     if (respa->nhybrid_styles > 0) respaflag = 1;
   }
 
+  // fused one-sweep dispatch across all sub-styles if enabled and usable
+  // fall back to sequential sub-style calls under r-RESPA, under
+  // compute_outer(), while tally computes are registered, or if any
+  // sub-style has been switched off via pair_modify compute no
+
+  if (fusedflag && !respaflag && !outerflag && !nfusedtally) {
+    int ok = 1;
+    for (m = 0; m < nstyles; m++)
+      if (styles[m]->compute_flag == 0) ok = 0;
+    if (ok) {
+      compute_fused();
+      delete [] saved_special;
+      if (vflag_fdotr) virial_fdotr_compute();
+      return;
+    }
+  }
+
   for (m = 0; m < nstyles; m++) {
 
     set_special(m);
@@ -133,9 +163,13 @@ void PairHybrid::compute(int eflag, int vflag)
       // outerflag is set and sub-style has a compute_outer() method
 
       if (styles[m]->compute_flag == 0) continue;
+      double tstart = 0.0;
+      const int detailflag = timer->has_detail();
+      if (detailflag) tstart = MPI_Wtime();
       if (outerflag && styles[m]->respa_enable)
         styles[m]->compute_outer(eflag,vflag_substyle);
       else styles[m]->compute(eflag,vflag_substyle);
+      if (detailflag) time_detail[m] += MPI_Wtime() - tstart;
     }
 
     restore_special(saved_special);
@@ -193,11 +227,114 @@ void PairHybrid::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   fused execution path enabled via pair_modify fused yes
+   one sweep over the union neighbor list dispatches each pair to the
+   single() of the sub-style owning its type pair, read from the
+   precomputed fusedmap table, so each coordinate is loaded once
+   instead of once per sub-style
+   energy and virial are tallied by hybrid itself, the vdwl/coul split
+   of sub-style energies is not preserved, all energy tallies as vdwl
+------------------------------------------------------------------------- */
+
+void PairHybrid::compute_fused()
+{
+  int i,j,ii,jj,inum,jnum,itype,jtype;
+  double xtmp,ytmp,ztmp,delx,dely,delz,eng,fpair;
+  double rsq,factor_coul,factor_lj;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+  Pair *sub;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+  double *special_coul = force->special_coul;
+  int newton_pair = force->newton_pair;
+
+  inum = list->inum;
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  // loop over neighbors of my atoms
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    itype = type[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      factor_lj = special_lj[sbmask(j)];
+      factor_coul = special_coul[sbmask(j)];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      jtype = type[j];
+
+      sub = fusedmap[itype][jtype];
+      if (sub && rsq < sub->cutsq[itype][jtype]) {
+        eng = sub->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+
+        f[i][0] += delx*fpair;
+        f[i][1] += dely*fpair;
+        f[i][2] += delz*fpair;
+        if (newton_pair || j < nlocal) {
+          f[j][0] -= delx*fpair;
+          f[j][1] -= dely*fpair;
+          f[j][2] -= delz*fpair;
+        }
+
+        if (evflag) ev_tally(i,j,nlocal,newton_pair,
+                             eng,0.0,fpair,delx,dely,delz);
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   build the type pair -> sub-style dispatch table for compute_fused()
+   called from setup() so mixing in init_one() has assigned all pairs
+------------------------------------------------------------------------- */
+
+void PairHybrid::build_fused_table()
+{
+  int ntypes = atom->ntypes;
+
+  // allocate by hand: Memory::create() cannot allocate arrays of pointers
+
+  if (fusedmap == NULL) {
+    fusedmap = new Pair**[ntypes+1];
+    fusedmap[0] = new Pair*[(ntypes+1)*(ntypes+1)];
+    for (int itype = 1; itype <= ntypes; itype++)
+      fusedmap[itype] = &fusedmap[0][itype*(ntypes+1)];
+  }
+
+  for (int itype = 1; itype <= ntypes; itype++)
+    for (int jtype = 1; jtype <= ntypes; jtype++) {
+      fusedmap[itype][jtype] = NULL;
+      if (nmap[itype][jtype] == 1)
+        fusedmap[itype][jtype] = styles[map[itype][jtype][0]];
+      else if (nmap[itype][jtype] > 1)
+        error->all(FLERR,"Pair_modify fused requires one sub-style "
+                   "per type pair");
+    }
+}
 
 /* ---------------------------------------------------------------------- */
 
 void PairHybrid::add_tally_callback(Compute *ptr)
 {
+  nfusedtally++;
   for (int m = 0; m < nstyles; m++)
     if (compute_tally[m]) styles[m]->add_tally_callback(ptr);
 }
@@ -206,6 +343,7 @@ void PairHybrid::add_tally_callback(Compute *ptr)
 
 void PairHybrid::del_tally_callback(Compute *ptr)
 {
+  if (nfusedtally) nfusedtally--;
   for (int m = 0; m < nstyles; m++)
     if (compute_tally[m]) styles[m]->del_tally_callback(ptr);
 }
@@ -285,6 +423,7 @@ void PairHybrid::settings(int narg, char **arg)
     delete[] special_lj;
     delete[] special_coul;
     delete[] compute_tally;
+    delete[] time_detail;
   }
 
   if (allocated) {
@@ -305,6 +444,8 @@ void PairHybrid::settings(int narg, char **arg)
   special_lj = new double*[narg];
   special_coul = new double*[narg];
   compute_tally = new int[narg];
+  time_detail = new double[narg];
+  for (int m = 0; m < narg; m++) time_detail[m] = 0.0;
 
   // allocate each sub-style
   // allocate uses suffix, but don't store suffix version in keywords,
@@ -524,6 +665,10 @@ void PairHybrid::init_style()
 {
   int i,m,itype,jtype,used,istyle,skip;
 
+  // reset per sub-style timing accumulators for the new run
+
+  for (m = 0; m < nstyles; m++) time_detail[m] = 0.0;
+
   // error if a sub-style is not used
 
   int ntypes = atom->ntypes;
@@ -560,15 +705,33 @@ void PairHybrid::init_style()
     }
   }
 
+  // fused dispatch requires single() support and uniform special settings,
+  // since one sweep applies the global exclusion factors to every pair
+  // hybrid also needs its own union neighbor list for the sweep
+
+  if (fusedflag) {
+    for (istyle = 0; istyle < nstyles; istyle++) {
+      if (styles[istyle]->single_enable == 0)
+        error->all(FLERR,"Pair_modify fused requires sub-styles "
+                   "which support single calls");
+      if (special_lj[istyle] || special_coul[istyle])
+        error->all(FLERR,"Pair_modify fused does not support "
+                   "per sub-style special bond values");
+    }
+    neighbor->request(this,instance_me);
+  }
+
   // each sub-style makes its neighbor list request(s)
 
   for (istyle = 0; istyle < nstyles; istyle++) styles[istyle]->init_style();
 
   // create skip lists inside each pair neigh request
   // any kind of list can have its skip flag set in this loop
+  // hybrid's own request for the fused sweep keeps the full union list
 
   for (i = 0; i < neighbor->nrequest; i++) {
     if (!neighbor->requests[i]->pair) continue;
+    if (neighbor->requests[i]->requestor == this) continue;
 
     // istyle = associated sub-style for the request
 
@@ -685,6 +848,7 @@ double PairHybrid::init_one(int i, int j)
 void PairHybrid::setup()
 {
   for (int m = 0; m < nstyles; m++) styles[m]->setup();
+  if (fusedflag) build_fused_table();
 }
 
 /* ----------------------------------------------------------------------
@@ -733,6 +897,7 @@ void PairHybrid::read_restart(FILE *fp)
   delete[] special_lj;
   delete[] special_coul;
   delete[] compute_tally;
+  delete[] time_detail;
 
   styles = new Pair*[nstyles];
   keywords = new char*[nstyles];
@@ -741,6 +906,8 @@ void PairHybrid::read_restart(FILE *fp)
   special_lj = new double*[nstyles];
   special_coul = new double*[nstyles];
   compute_tally = new int[nstyles];
+  time_detail = new double[nstyles];
+  for (int m = 0; m < nstyles; m++) time_detail[m] = 0.0;
 
   // each sub-style is created via new_pair()
   // each reads its settings, but no coeff info
@@ -852,6 +1019,18 @@ void PairHybrid::modify_params(int narg, char **arg)
 {
   if (narg == 0) error->all(FLERR,"Illegal pair_modify command");
 
+  // if 1st keyword is fused, toggle the fused one-sweep dispatch
+  // and process any remaining keywords as usual
+
+  if (strcmp(arg[0],"fused") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal pair_modify command");
+    if (strcmp(arg[1],"yes") == 0) fusedflag = 1;
+    else if (strcmp(arg[1],"no") == 0) fusedflag = 0;
+    else error->all(FLERR,"Illegal pair_modify command");
+    if (narg > 2) modify_params(narg-2,&arg[2]);
+    return;
+  }
+
   // if 1st keyword is pair, apply other keywords to one sub-style
 
   if (strcmp(arg[0],"pair") == 0) {
@@ -1067,6 +1246,7 @@ double PairHybrid::memory_usage()
   double bytes = maxeatom * sizeof(double);
   bytes += maxvatom*6 * sizeof(double);
   bytes += maxcvatom*9 * sizeof(double);
+  if (fusedmap) bytes += (atom->ntypes+1)*(atom->ntypes+1) * sizeof(Pair *);
   for (int m = 0; m < nstyles; m++) bytes += styles[m]->memory_usage();
   return bytes;
 }
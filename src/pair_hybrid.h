@@ -32,6 +32,7 @@ class PairHybrid : public Pair {
   friend class Neighbor;
   friend class Respa;
   friend class Info;
+  friend class Finish;
   friend class PairDeprecated;
  public:
   PairHybrid(class LAMMPS *);
@@ -74,6 +75,15 @@ class PairHybrid : public Pair {
   double **special_lj;          // list of per style LJ exclusion factors
   double **special_coul;        // list of per style Coulomb exclusion factors
   int *compute_tally;           // list of on/off flags for tally computes
+  double *time_detail;          // per sub-style wall time, for timer detail
+
+  int fusedflag;                // 1 if fused one-sweep dispatch is enabled
+  Pair ***fusedmap;             // sub-style owning each type pair, or NULL
+  int nfusedtally;              // # of registered tally computes, the fused
+                                //   path falls back while any are active
+
+  void compute_fused();
+  void build_fused_table();
 
   void allocate();
   void flags();
@@ -66,6 +66,53 @@ PairLJCut::~PairLJCut()
 /* ---------------------------------------------------------------------- */
 
 void PairLJCut::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  // refresh the packed coordinate+type mirror read by eval()
+
+  build_xtype_cache();
+
+  // dispatch to a compile-time specialization of the inner loop,
+  // integrate->ev_set() only raises evflag on steps with a consumer,
+  // so the common no-tally case runs with no per-pair branches
+  // when the lists cannot carry special-bond bits (each of 1-2/1-3/1-4
+  // either pruned from the lists or included at full weight), also drop
+  // the per-pair sbmask()/special factor lookup
+
+  if (neighbor->nospecial_flag) {
+    if (evflag) {
+      if (eflag) {
+        if (force->newton_pair) eval<1,1,1,0>();
+        else eval<1,1,0,0>();
+      } else {
+        if (force->newton_pair) eval<1,0,1,0>();
+        else eval<1,0,0,0>();
+      }
+    } else {
+      if (force->newton_pair) eval<0,0,1,0>();
+      else eval<0,0,0,0>();
+    }
+  } else {
+    if (evflag) {
+      if (eflag) {
+        if (force->newton_pair) eval<1,1,1,1>();
+        else eval<1,1,0,1>();
+      } else {
+        if (force->newton_pair) eval<1,0,1,1>();
+        else eval<1,0,0,1>();
+      }
+    } else {
+      if (force->newton_pair) eval<0,0,1,1>();
+      else eval<0,0,0,1>();
+    }
+  }
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR, int SPECIAL>
+void PairLJCut::eval()
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
@@ -73,14 +120,15 @@ void PairLJCut::compute(int eflag, int vflag)
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   evdwl = 0.0;
-  ev_init(eflag,vflag);
 
-  double **x = atom->x;
+  double **xt = xtype;
   double **f = atom->f;
-  int *type = atom->type;
   int nlocal = atom->nlocal;
   double *special_lj = force->special_lj;
-  int newton_pair = force->newton_pair;
+
+  int detflag = atom->f_det_flag;
+  int64_t **f_det = atom->f_det;
+  double detscale = atom->f_det_scale;
 
   inum = list->inum;
   ilist = list->ilist;
@@ -88,26 +136,29 @@ void PairLJCut::compute(int eflag, int vflag)
   firstneigh = list->firstneigh;
 
   // loop over neighbors of my atoms
+  // coords and types come from the packed mirror, one cache line per atom
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
+    xtmp = xt[i][0];
+    ytmp = xt[i][1];
+    ztmp = xt[i][2];
+    itype = (int) ubuf(xt[i][3]).i;
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
-      factor_lj = special_lj[sbmask(j)];
-      j &= NEIGHMASK;
-
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
+      if (SPECIAL) {
+        factor_lj = special_lj[sbmask(j)];
+        j &= NEIGHMASK;
+      } else factor_lj = 1.0;
+
+      delx = xtmp - xt[j][0];
+      dely = ytmp - xt[j][1];
+      delz = ztmp - xt[j][2];
       rsq = delx*delx + dely*dely + delz*delz;
-      jtype = type[j];
+      jtype = (int) ubuf(xt[j][3]).i;
 
       if (rsq < cutsq[itype][jtype]) {
         r2inv = 1.0/rsq;
@@ -115,28 +166,44 @@ void PairLJCut::compute(int eflag, int vflag)
         forcelj = r6inv * (lj1[itype][jtype]*r6inv - lj2[itype][jtype]);
         fpair = factor_lj*forcelj*r2inv;
 
-        f[i][0] += delx*fpair;
-        f[i][1] += dely*fpair;
-        f[i][2] += delz*fpair;
-        if (newton_pair || j < nlocal) {
-          f[j][0] -= delx*fpair;
-          f[j][1] -= dely*fpair;
-          f[j][2] -= delz*fpair;
+        if (detflag) {
+
+          // round each pair contribution once, so the integer sums
+          // are independent of summation order
+
+          int64_t fdx = (int64_t) llround(delx*fpair*detscale);
+          int64_t fdy = (int64_t) llround(dely*fpair*detscale);
+          int64_t fdz = (int64_t) llround(delz*fpair*detscale);
+          f_det[i][0] += fdx;
+          f_det[i][1] += fdy;
+          f_det[i][2] += fdz;
+          if (NEWTON_PAIR || j < nlocal) {
+            f_det[j][0] -= fdx;
+            f_det[j][1] -= fdy;
+            f_det[j][2] -= fdz;
+          }
+        } else {
+          f[i][0] += delx*fpair;
+          f[i][1] += dely*fpair;
+          f[i][2] += delz*fpair;
+          if (NEWTON_PAIR || j < nlocal) {
+            f[j][0] -= delx*fpair;
+            f[j][1] -= dely*fpair;
+            f[j][2] -= delz*fpair;
+          }
         }
 
-        if (eflag) {
+        if (EFLAG) {
           evdwl = r6inv*(lj3[itype][jtype]*r6inv-lj4[itype][jtype]) -
             offset[itype][jtype];
           evdwl *= factor_lj;
         }
 
-        if (evflag) ev_tally(i,j,nlocal,newton_pair,
+        if (EVFLAG) ev_tally(i,j,nlocal,NEWTON_PAIR,
                              evdwl,0.0,fpair,delx,dely,delz);
       }
     }
   }
-
-  if (vflag_fdotr) virial_fdotr_compute();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -47,6 +47,8 @@ class PairLJCut : public Pair {
   void compute_outer(int, int);
 
  protected:
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR, int SPECIAL> void eval();
+
   double cut_global;
   double **cut;
   double **epsilon,**sigma;
@@ -61,6 +61,31 @@ PairLJCutCoulCut::~PairLJCutCoulCut()
 /* ---------------------------------------------------------------------- */
 
 void PairLJCutCoulCut::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  // dispatch to a compile-time specialization of the inner loop,
+  // integrate->ev_set() only raises evflag on steps with a consumer,
+  // so the common no-tally case runs with no per-pair branches
+
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1>();
+      else eval<1,1,0>();
+    } else {
+      if (force->newton_pair) eval<1,0,1>();
+      else eval<1,0,0>();
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1>();
+    else eval<0,0,0>();
+  }
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+void PairLJCutCoulCut::eval()
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double qtmp,xtmp,ytmp,ztmp,delx,dely,delz,evdwl,ecoul,fpair;
@@ -68,7 +93,6 @@ void PairLJCutCoulCut::compute(int eflag, int vflag)
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   evdwl = ecoul = 0.0;
-  ev_init(eflag,vflag);
 
   double **x = atom->x;
   double **f = atom->f;
@@ -77,7 +101,6 @@ void PairLJCutCoulCut::compute(int eflag, int vflag)
   int nlocal = atom->nlocal;
   double *special_coul = force->special_coul;
   double *special_lj = force->special_lj;
-  int newton_pair = force->newton_pair;
   double qqrd2e = force->qqrd2e;
 
   inum = list->inum;
@@ -126,13 +149,13 @@ void PairLJCutCoulCut::compute(int eflag, int vflag)
         f[i][0] += delx*fpair;
         f[i][1] += dely*fpair;
         f[i][2] += delz*fpair;
-        if (newton_pair || j < nlocal) {
+        if (NEWTON_PAIR || j < nlocal) {
           f[j][0] -= delx*fpair;
           f[j][1] -= dely*fpair;
           f[j][2] -= delz*fpair;
         }
 
-        if (eflag) {
+        if (EFLAG) {
           if (rsq < cut_coulsq[itype][jtype])
             ecoul = factor_coul * qqrd2e * qtmp*q[j]*sqrt(r2inv);
           else ecoul = 0.0;
@@ -143,13 +166,11 @@ void PairLJCutCoulCut::compute(int eflag, int vflag)
           } else evdwl = 0.0;
         }
 
-        if (evflag) ev_tally(i,j,nlocal,newton_pair,
+        if (EVFLAG) ev_tally(i,j,nlocal,NEWTON_PAIR,
                              evdwl,ecoul,fpair,delx,dely,delz);
       }
     }
   }
-
-  if (vflag_fdotr) virial_fdotr_compute();
 }
 
 /* ----------------------------------------------------------------------
@@ -49,6 +49,7 @@ class PairLJCutCoulCut : public Pair {
   double **epsilon,**sigma;
   double **lj1,**lj2,**lj3,**lj4,**offset;
 
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void eval();
   virtual void allocate();
 };
 
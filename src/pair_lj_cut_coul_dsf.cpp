@@ -74,6 +74,31 @@ PairLJCutCoulDSF::~PairLJCutCoulDSF()
 /* ---------------------------------------------------------------------- */
 
 void PairLJCutCoulDSF::compute(int eflag, int vflag)
+{
+  ev_init(eflag,vflag);
+
+  // dispatch to a compile-time specialization of the inner loop,
+  // integrate->ev_set() only raises evflag on steps with a consumer,
+  // so the common no-tally case runs with no per-pair branches
+
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1>();
+      else eval<1,1,0>();
+    } else {
+      if (force->newton_pair) eval<1,0,1>();
+      else eval<1,0,0>();
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1>();
+    else eval<0,0,0>();
+  }
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+void PairLJCutCoulDSF::eval()
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double qtmp,xtmp,ytmp,ztmp,delx,dely,delz,evdwl,ecoul,fpair;
@@ -82,7 +107,6 @@ void PairLJCutCoulDSF::compute(int eflag, int vflag)
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   evdwl = ecoul = 0.0;
-  ev_init(eflag,vflag);
 
   double **x = atom->x;
   double **f = atom->f;
@@ -91,7 +115,6 @@ void PairLJCutCoulDSF::compute(int eflag, int vflag)
   int nlocal = atom->nlocal;
   double *special_lj = force->special_lj;
   double *special_coul = force->special_coul;
-  int newton_pair = force->newton_pair;
   double qqrd2e = force->qqrd2e;
 
   inum = list->inum;
@@ -111,7 +134,7 @@ void PairLJCutCoulDSF::compute(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
-    if (eflag) {
+    if (EFLAG) {
       double e_self = -(e_shift/2.0 + alpha/MY_PIS) * qtmp*qtmp*qqrd2e;
       ev_tally(i,i,nlocal,0,0.0,e_self,0.0,0.0,0.0,0.0);
     }
@@ -151,13 +174,13 @@ void PairLJCutCoulDSF::compute(int eflag, int vflag)
         f[i][0] += delx*fpair;
         f[i][1] += dely*fpair;
         f[i][2] += delz*fpair;
-        if (newton_pair || j < nlocal) {
+        if (NEWTON_PAIR || j < nlocal) {
           f[j][0] -= delx*fpair;
           f[j][1] -= dely*fpair;
           f[j][2] -= delz*fpair;
         }
 
-        if (eflag) {
+        if (EFLAG) {
           if (rsq < cut_ljsq[itype][jtype]) {
             evdwl = r6inv*(lj3[itype][jtype]*r6inv-lj4[itype][jtype]) -
                     offset[itype][jtype];
@@ -170,13 +193,11 @@ void PairLJCutCoulDSF::compute(int eflag, int vflag)
           } else ecoul = 0.0;
         }
 
-        if (evflag) ev_tally(i,j,nlocal,newton_pair,
+        if (EVFLAG) ev_tally(i,j,nlocal,NEWTON_PAIR,
                              evdwl,ecoul,fpair,delx,dely,delz);
       }
     }
   }
-
-  if (vflag_fdotr) virial_fdotr_compute();
 }
 
 /* ----------------------------------------------------------------------
@@ -50,6 +50,7 @@ class PairLJCutCoulDSF : public Pair {
   double alpha;
   double f_shift,e_shift;
 
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void eval();
   virtual void allocate();
 };
 
@@ -47,6 +47,7 @@ class PairLJCutCoulWolf : public Pair {
   double **lj1,**lj2,**lj3,**lj4,**offset;
   double cut_coul,cut_coulsq,alf;
 
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void eval();
   virtual void allocate();
 };
 
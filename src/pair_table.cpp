@@ -71,12 +71,14 @@ void PairTable::compute(int eflag, int vflag)
   double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
   double rsq,factor_lj,fraction,value,a,b;
   int *ilist,*jlist,*numneigh,**firstneigh;
+  const double *quad;
   Table *tb;
 
   union_int_float_t rsq_lookup;
   int tlm1 = tablength - 1;
 
   evdwl = 0.0;
+  quad = NULL;
   ev_init(eflag,vflag);
 
   double **x = atom->x;
@@ -129,8 +131,9 @@ void PairTable::compute(int eflag, int vflag)
           if (itable >= tlm1)
             error->one(FLERR,fmt::format("Pair distance > table outer cutoff: "
                                          "ijtype {} {} dist {}",itype,jtype,sqrt(rsq)));
-          fraction = (rsq - tb->rsq[itable]) * tb->invdelta;
-          value = tb->f[itable] + fraction*tb->df[itable];
+          quad = &tb->fede[itable << 2];
+          fraction = (rsq - (tb->innersq + itable*tb->delta)) * tb->invdelta;
+          value = quad[0] + fraction*quad[1];
           fpair = factor_lj * value;
         } else if (tabstyle == SPLINE) {
           itable = static_cast<int> ((rsq - tb->innersq) * tb->invdelta);
@@ -147,8 +150,9 @@ void PairTable::compute(int eflag, int vflag)
           rsq_lookup.f = rsq;
           itable = rsq_lookup.i & tb->nmask;
           itable >>= tb->nshiftbits;
+          quad = &tb->fede[itable << 2];
           fraction = (rsq_lookup.f - tb->rsq[itable]) * tb->drsq[itable];
-          value = tb->f[itable] + fraction*tb->df[itable];
+          value = quad[0] + fraction*quad[1];
           fpair = factor_lj * value;
         }
 
@@ -165,7 +169,7 @@ void PairTable::compute(int eflag, int vflag)
           if (tabstyle == LOOKUP)
             evdwl = tb->e[itable];
           else if (tabstyle == LINEAR || tabstyle == BITMAP)
-            evdwl = tb->e[itable] + fraction*tb->de[itable];
+            evdwl = quad[2] + fraction*quad[3];
           else
             evdwl = a * tb->e[itable] + b * tb->e[itable+1] +
               ((a*a*a-a)*tb->e2[itable] + (b*b*b-b)*tb->e2[itable+1]) *
@@ -307,24 +311,40 @@ void PairTable::coeff(int narg, char **arg)
   if (tb->rflag == BMP && tb->match == 0)
     error->all(FLERR,"Bitmapped table in file does not match requested table");
 
-  // spline read-in values and compute r,e,f vectors within table
+  // if an identical section was already read in for an earlier type pair,
+  // share that table instead of splining and storing a second copy
+  // multi-species CG mixtures commonly reuse one section for many pairs,
+  // and sharing keeps the working set of table loads small
 
-  if (tb->match == 0) spline_table(tb);
-  compute_table(tb);
+  int itable = ntables;
+  for (int m = 0; m < ntables; m++)
+    if (same_table_input(&tables[m],tb)) {
+      itable = m;
+      break;
+    }
+
+  if (itable < ntables) free_table(tb);
+  else {
+
+    // spline read-in values and compute r,e,f vectors within table
+
+    if (tb->match == 0) spline_table(tb);
+    compute_table(tb);
+    ntables++;
+  }
 
   // store ptr to table in tabindex
 
   int count = 0;
   for (int i = ilo; i <= ihi; i++) {
     for (int j = MAX(jlo,i); j <= jhi; j++) {
-      tabindex[i][j] = ntables;
+      tabindex[i][j] = itable;
       setflag[i][j] = 1;
       count++;
     }
   }
 
   if (count == 0) error->all(FLERR,"Illegal pair_coeff command");
-  ntables++;
 }
 
 /* ----------------------------------------------------------------------
@@ -513,6 +533,28 @@ void PairTable::bcast_table(Table *tb)
   }
 }
 
+/* ----------------------------------------------------------------------
+   check if two tables were built from identical file values and cutoff
+   if so, all derived vectors are identical and the tables can be shared
+   only compares fields set by read_table() and the cutoff, so must be
+   called before spline_table() and compute_table()
+------------------------------------------------------------------------- */
+
+int PairTable::same_table_input(Table *t1, Table *t2)
+{
+  if (t1->ninput != t2->ninput) return 0;
+  if (t1->rflag != t2->rflag || t1->fpflag != t2->fpflag) return 0;
+  if (t1->rflag && (t1->rlo != t2->rlo || t1->rhi != t2->rhi)) return 0;
+  if (t1->fpflag && (t1->fplo != t2->fplo || t1->fphi != t2->fphi)) return 0;
+  if (t1->cut != t2->cut) return 0;
+  for (int i = 0; i < t1->ninput; i++) {
+    if (t1->rfile[i] != t2->rfile[i]) return 0;
+    if (t1->efile[i] != t2->efile[i]) return 0;
+    if (t1->ffile[i] != t2->ffile[i]) return 0;
+  }
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    build spline representation of e,f over entire range of read-in table
    this function sets these values in Table: e2file,f2file
@@ -650,6 +692,18 @@ void PairTable::compute_table(Table *tb)
       tb->de[i] = tb->e[i+1] - tb->e[i];
       tb->df[i] = tb->f[i+1] - tb->f[i];
     }
+
+    // interleaved [f,df,e,de] quad per bin
+    // one contiguous (and with LAMMPS_MEMALIGN=64, cache-aligned)
+    // block per lookup in the compute loop
+
+    memory->create(tb->fede,4*tlm1,"pair:fede");
+    for (int i = 0; i < tlm1; i++) {
+      tb->fede[4*i] = tb->f[i];
+      tb->fede[4*i+1] = tb->df[i];
+      tb->fede[4*i+2] = tb->e[i];
+      tb->fede[4*i+3] = tb->de[i];
+    }
   }
 
   // cubic spline tables
@@ -817,6 +871,16 @@ void PairTable::compute_table(Table *tb)
         tb->drsq[itablemax] = 1.0/(rsq_lookup.f - tb->rsq[itablemax]);
       }
     }
+
+    // interleaved [f,df,e,de] quad per bin, as for linear tables
+
+    memory->create(tb->fede,4*ntable,"pair:fede");
+    for (int i = 0; i < ntable; i++) {
+      tb->fede[4*i] = tb->f[i];
+      tb->fede[4*i+1] = tb->df[i];
+      tb->fede[4*i+2] = tb->e[i];
+      tb->fede[4*i+3] = tb->de[i];
+    }
   }
 }
 
@@ -830,6 +894,7 @@ void PairTable::null_table(Table *tb)
   tb->e2file = tb->f2file = NULL;
   tb->rsq = tb->drsq = tb->e = tb->de = NULL;
   tb->f = tb->df = tb->e2 = tb->f2 = NULL;
+  tb->fede = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -852,6 +917,7 @@ void PairTable::free_table(Table *tb)
   memory->destroy(tb->df);
   memory->destroy(tb->e2);
   memory->destroy(tb->f2);
+  memory->destroy(tb->fede);
 }
 
 /* ----------------------------------------------------------------------
@@ -52,6 +52,7 @@ class PairTable : public Pair {
     double *e2file,*f2file;
     double innersq,delta,invdelta,deltasq6;
     double *rsq,*drsq,*e,*de,*f,*df,*e2,*f2;
+    double *fede;               // interleaved [f,df,e,de] quad per bin
   };
   int ntables;
   Table *tables;
@@ -62,6 +63,7 @@ class PairTable : public Pair {
   void read_table(Table *, char *, char *);
   void param_extract(Table *, char *);
   void bcast_table(Table *);
+  int same_table_input(Table *, Table *);
   void spline_table(Table *);
   virtual void compute_table(Table *);
   void null_table(Table *);
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "plugin.h"
+#include <cstring>
+#include <string>
+#include <vector>
+#include "comm.h"
+#include "error.h"
+#include "force.h"
+#include "modify.h"
+#include "utils.h"
+#include "fmt/format.h"
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+// plugin load file1.so file2.so ...
+// plugin unload file1.so ...
+// plugin list
+// plugin clear
+//
+// each shared object must export a C function
+//   void lammpsplugin_init(void *lmp);
+// which is called with the LAMMPS instance; compiled against the
+// LAMMPS headers it can insert creator functions into the public
+// style maps (force->pair_map, modify->fix_map, ...), after which the
+// styles are usable like built-in ones
+//
+// unloading requires the plugin to also export
+//   void lammpsplugin_unload(void *lmp);
+// which must remove every style the plugin registered; only then is
+// the handle dlclosed, since instances of plugin-provided styles can
+// outlive the command and the code must stay mapped while any exist
+//
+// the registry of loaded plugins is process-wide, like the dlopen
+// handles themselves
+
+typedef void (*lammpsplugin_initfn)(void *);
+typedef void (*lammpsplugin_unloadfn)(void *);
+
+static std::vector<std::string> pluginfiles;
+static std::vector<void *> pluginhandles;
+
+/* ---------------------------------------------------------------------- */
+
+Plugin::Plugin(LAMMPS *lmp) : Pointers(lmp) {}
+
+/* ---------------------------------------------------------------------- */
+
+void Plugin::command(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR,"Illegal plugin command");
+
+#ifdef _WIN32
+  error->all(FLERR,"Plugin loading not supported on this platform");
+#else
+
+  if (strcmp(arg[0],"load") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal plugin command");
+    for (int iarg = 1; iarg < narg; iarg++) load(arg[iarg]);
+
+  } else if (strcmp(arg[0],"unload") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal plugin command");
+    for (int iarg = 1; iarg < narg; iarg++) unload(arg[iarg]);
+
+  } else if (strcmp(arg[0],"list") == 0) {
+    if (narg != 1) error->all(FLERR,"Illegal plugin command");
+    if (comm->me == 0) {
+      utils::logmesg(lmp,fmt::format("Loaded plugins: {}\n",
+                                     pluginfiles.size()));
+      for (std::size_t i = 0; i < pluginfiles.size(); i++)
+        utils::logmesg(lmp,fmt::format("  {}: {}\n",i+1,pluginfiles[i]));
+    }
+
+  } else if (strcmp(arg[0],"clear") == 0) {
+    if (narg != 1) error->all(FLERR,"Illegal plugin command");
+    while (pluginfiles.size()) unload(pluginfiles.back().c_str());
+
+  } else error->all(FLERR,"Illegal plugin command");
+#endif
+}
+
+#ifndef _WIN32
+
+/* ----------------------------------------------------------------------
+   dlopen one plugin file and invoke its init entry point
+------------------------------------------------------------------------- */
+
+void Plugin::load(const char *file)
+{
+  for (std::size_t i = 0; i < pluginfiles.size(); i++)
+    if (pluginfiles[i] == file) {
+      if (comm->me == 0)
+        error->warning(FLERR,fmt::format("Ignoring already loaded "
+                                         "plugin {}",file).c_str());
+      return;
+    }
+
+  // the lazily built style maps must exist before a plugin adds to them
+
+  force->create_factories();
+  modify->create_factories();
+
+  void *handle = dlopen(file,RTLD_NOW|RTLD_GLOBAL);
+  if (handle == NULL) {
+    char str[512];
+    snprintf(str,512,"Could not open plugin file: %s",dlerror());
+    error->all(FLERR,str);
+  }
+
+  lammpsplugin_initfn initfn =
+    (lammpsplugin_initfn) dlsym(handle,"lammpsplugin_init");
+  if (initfn == NULL) {
+    dlclose(handle);
+    error->all(FLERR,"Plugin has no lammpsplugin_init entry point");
+  }
+
+  (*initfn)((void *) lmp);
+
+  pluginfiles.push_back(file);
+  pluginhandles.push_back(handle);
+
+  if (comm->me == 0)
+    utils::logmesg(lmp,fmt::format("Loaded plugin {}\n",file));
+}
+
+/* ----------------------------------------------------------------------
+   invoke the unload entry point of one plugin and dlclose it
+   the plugin must deregister its styles; the caller is responsible for
+   no longer using any style instance the plugin created
+------------------------------------------------------------------------- */
+
+void Plugin::unload(const char *file)
+{
+  std::size_t i;
+  for (i = 0; i < pluginfiles.size(); i++)
+    if (pluginfiles[i] == file) break;
+  if (i == pluginfiles.size())
+    error->all(FLERR,"Plugin to unload is not loaded");
+
+  lammpsplugin_unloadfn unloadfn =
+    (lammpsplugin_unloadfn) dlsym(pluginhandles[i],"lammpsplugin_unload");
+  if (unloadfn == NULL)
+    error->all(FLERR,"Plugin has no lammpsplugin_unload entry point");
+
+  (*unloadfn)((void *) lmp);
+
+  dlclose(pluginhandles[i]);
+  pluginfiles.erase(pluginfiles.begin()+i);
+  pluginhandles.erase(pluginhandles.begin()+i);
+
+  if (comm->me == 0)
+    utils::logmesg(lmp,fmt::format("Unloaded plugin {}\n",file));
+}
+
+#endif
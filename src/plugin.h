@@ -0,0 +1,75 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef COMMAND_CLASS
+
+CommandStyle(plugin,Plugin)
+
+#else
+
+#ifndef LMP_PLUGIN_H
+#define LMP_PLUGIN_H
+
+#include "pointers.h"
+
+namespace LAMMPS_NS {
+
+class Plugin : protected Pointers {
+ public:
+  Plugin(class LAMMPS *);
+  void command(int, char **);
+
+ private:
+  void load(const char *);
+  void unload(const char *);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal plugin command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.
+
+E: Plugin loading not supported on this platform
+
+The plugin command requires dlopen(), which this platform does not
+provide.
+
+E: Could not open plugin file: %s
+
+The shared object could not be loaded.  The message includes the
+reason reported by the dynamic linker, e.g. a missing file or an
+unresolved symbol.
+
+E: Plugin has no lammpsplugin_init entry point
+
+A LAMMPS plugin must export a C function named lammpsplugin_init
+which registers its styles.
+
+E: Plugin to unload is not loaded
+
+The file given to the plugin unload command does not match any
+currently loaded plugin.  Use plugin list to see what is loaded.
+
+E: Plugin has no lammpsplugin_unload entry point
+
+Unloading requires the plugin to export a C function named
+lammpsplugin_unload which deregisters the styles it added.
+
+*/
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "random_philox.h"
+#include <cmath>
+#include "error.h"
+#include "math_const.h"
+
+using namespace LAMMPS_NS;
+using namespace MathConst;
+
+// Philox 4x32-10 counter-based generator (Salmon et al, SC 2011)
+// the random values are a pure function of (seed, atom tag, timestep),
+//   so a draw for an atom does not depend on which proc owns it, on how
+//   many procs there are, or on draws made for other atoms
+// consumers pass the tag and timestep per call, there is no stream state
+// the stream arg separates independent uses within one timestep,
+//   e.g. a force draw and a torque draw for the same atom
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+#define TWO_M32 2.3283064365386963e-10     // 2^-32
+
+/* ---------------------------------------------------------------------- */
+
+RanPhilox::RanPhilox(LAMMPS *lmp, int seed) : Pointers(lmp)
+{
+  if (seed <= 0) error->all(FLERR,"Invalid seed for Philox random # generator");
+
+  // expand the seed into the 64-bit key by one round of integer mixing
+
+  uint64_t z = (uint64_t) seed * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  key0 = (uint32_t) z;
+  key1 = (uint32_t) (z >> 32);
+}
+
+/* ----------------------------------------------------------------------
+   3 uniform RNs in (0,1), determined by (seed,tag,step,stream)
+------------------------------------------------------------------------- */
+
+void RanPhilox::uniform3(tagint tag, bigint step, int stream, double *u)
+{
+  uint32_t c[4];
+  counters(tag,step,stream,c);
+  philox(c);
+  u[0] = (c[0] + 0.5) * TWO_M32;
+  u[1] = (c[1] + 0.5) * TWO_M32;
+  u[2] = (c[2] + 0.5) * TWO_M32;
+}
+
+/* ----------------------------------------------------------------------
+   3 gaussian RNs, determined by (seed,tag,step,stream)
+   Box-Muller on the 4 counter words, no rejection, so branch-free
+------------------------------------------------------------------------- */
+
+void RanPhilox::gaussian3(tagint tag, bigint step, int stream, double *r)
+{
+  uint32_t c[4];
+  counters(tag,step,stream,c);
+  philox(c);
+
+  double u0 = (c[0] + 0.5) * TWO_M32;
+  double u1 = (c[1] + 0.5) * TWO_M32;
+  double u2 = (c[2] + 0.5) * TWO_M32;
+  double u3 = (c[3] + 0.5) * TWO_M32;
+
+  double f0 = sqrt(-2.0*log(u0));
+  double f2 = sqrt(-2.0*log(u2));
+  r[0] = f0*cos(MY_2PI*u1);
+  r[1] = f0*sin(MY_2PI*u1);
+  r[2] = f2*cos(MY_2PI*u3);
+}
+
+/* ----------------------------------------------------------------------
+   load the 128-bit counter: tag in the low words, step+stream on top
+------------------------------------------------------------------------- */
+
+void RanPhilox::counters(tagint tag, bigint step, int stream, uint32_t *c)
+{
+  uint64_t t = (uint64_t) tag;
+  uint64_t s = (uint64_t) step;
+  c[0] = (uint32_t) t;
+  c[1] = (uint32_t) (t >> 32);
+  c[2] = (uint32_t) s;
+  c[3] = (uint32_t) (s >> 32) ^ ((uint32_t) stream << 24);
+}
+
+/* ----------------------------------------------------------------------
+   10 rounds of the Philox 4x32 bijection, counter -> random words
+------------------------------------------------------------------------- */
+
+void RanPhilox::philox(uint32_t *c)
+{
+  uint32_t k0 = key0;
+  uint32_t k1 = key1;
+
+  for (int round = 0; round < 10; round++) {
+    uint64_t p0 = (uint64_t) PHILOX_M0 * c[0];
+    uint64_t p1 = (uint64_t) PHILOX_M1 * c[2];
+    uint32_t n0 = (uint32_t) (p1 >> 32) ^ c[1] ^ k0;
+    uint32_t n1 = (uint32_t) p1;
+    uint32_t n2 = (uint32_t) (p0 >> 32) ^ c[3] ^ k1;
+    uint32_t n3 = (uint32_t) p0;
+    c[0] = n0;
+    c[1] = n1;
+    c[2] = n2;
+    c[3] = n3;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+}
@@ -0,0 +1,46 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_RANPHILOX_H
+#define LMP_RANPHILOX_H
+
+#include "pointers.h"
+#include <stdint.h>
+
+namespace LAMMPS_NS {
+
+class RanPhilox : protected Pointers {
+ public:
+  RanPhilox(class LAMMPS *, int);
+  void uniform3(tagint, bigint, int, double *);
+  void gaussian3(tagint, bigint, int, double *);
+
+ private:
+  uint32_t key0,key1;      // per-run key derived from the user seed
+
+  void counters(tagint, bigint, int, uint32_t *);
+  void philox(uint32_t *);
+};
+
+}
+
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Invalid seed for Philox random # generator
+
+The initial seed for this random number generator must be a positive
+integer.
+
+*/
@@ -28,7 +28,9 @@ using namespace LAMMPS_NS;
 void box_merge(void *, void *, int *, MPI_Datatype *);
 void median_merge(void *, void *, int *, MPI_Datatype *);
 
-// NOTE: if want to have reuse flag, need to sum Tree across procs
+// reuse flag seeds each median search with the cut from the previous
+// invocation, recorded by every proc in the partition, so no Tree summation
+// across procs is needed
 
 /* ---------------------------------------------------------------------- */
 
@@ -49,7 +51,12 @@ RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
   maxrecv = maxsend = 0;
   recvproc = recvindex = sendproc = sendindex = NULL;
 
-  tree = NULL;
+  // tree of cuts from the last invocation, seeds the next median search
+  // entry for each proc, dim = -1 signals no stored cut yet
+
+  tree = (Tree *) memory->smalloc(nprocs*sizeof(Tree),"RCB:tree");
+  for (int i = 0; i < nprocs; i++) tree[i].dim = -1;
+
   irregular = NULL;
 
   // create MPI data and function types for box and median AllReduce ops
@@ -62,7 +69,7 @@ RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
   MPI_Op_create(box_merge,1,&box_op);
   MPI_Op_create(median_merge,1,&med_op);
 
-  reuse = 0;
+  reuse = 1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -492,12 +499,18 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
 
     // found median
     // store cut info only if I am procmid
+    // all procs in partition save cut in tree to seed the next invocation
+    //   every proc records it locally, since the recursion path of each
+    //   proc is fixed for a fixed proc count, so no comm is needed
 
     if (me == procmid) {
       cut = valuehalf;
       cutdim = dim;
     }
 
+    tree[procmid].cut = valuehalf;
+    tree[procmid].dim = dim;
+
     // use cut to shrink my RCB bounding box
 
     if (me < procmid) hi[dim] = valuehalf;
@@ -984,12 +997,18 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
 
     // found median
     // store cut info only if I am procmid
+    // all procs in partition save cut in tree to seed the next invocation
+    //   every proc records it locally, since the recursion path of each
+    //   proc is fixed for a fixed proc count, so no comm is needed
 
     if (me == procmid) {
       cut = valuehalf;
       cutdim = dim;
     }
 
+    tree[procmid].cut = valuehalf;
+    tree[procmid].dim = dim;
+
     // use cut to shrink my RCB bounding box
 
     if (me < procmid) hi[dim] = valuehalf;
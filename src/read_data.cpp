@@ -124,6 +124,8 @@ void ReadData::command(int narg, char **arg)
 
   addflag = NONE;
   coeffflag = 1;
+  parallelflag = 0;
+  datafile = arg[0];
   id_offset = mol_offset = 0;
   offsetflag = shiftflag = 0;
   toffset = boffset = aoffset = doffset = ioffset = 0;
@@ -183,6 +185,12 @@ void ReadData::command(int narg, char **arg)
       if (domain->dimension == 2 && shift[2] != 0.0)
         error->all(FLERR,"Non-zero read_data shift z value for 2d simulation");
       iarg += 4;
+    } else if (strcmp(arg[iarg],"parallel") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal read_data command");
+      if (strcmp(arg[iarg+1],"yes") == 0) parallelflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) parallelflag = 0;
+      else error->all(FLERR,"Illegal read_data command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"nocoeff") == 0) {
       coeffflag = 0;
       iarg ++;
@@ -521,6 +529,13 @@ void ReadData::command(int narg, char **arg)
         if (firstpass) velocities();
         else skip_lines(natoms);
 
+      } else if (strcmp(keyword,"Atoms Binary") == 0) {
+        atomflag = 1;
+        if (firstpass && me == 0 && !style_match(style,atom->atom_style))
+          error->warning(FLERR,"Atom style in data file differs "
+                         "from currently defined atom style");
+        atoms_binary(firstpass);
+
       } else if (strcmp(keyword,"Bonds") == 0) {
         topoflag = bondflag = 1;
         if (nbonds == 0)
@@ -1201,14 +1216,22 @@ void ReadData::atoms()
 
   if (me == 0) utils::logmesg(lmp,"  reading atoms ...\n");
 
-  bigint nread = 0;
+  // parallel mode: all procs read/parse disjoint slices of the section
+  // requires an uncompressed file every proc can open and seek in
 
-  while (nread < natoms) {
-    nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_atoms(nchunk,buffer,id_offset,mol_offset,toffset,shiftflag,shift);
-    nread += nchunk;
+  if (parallelflag && !compressed && comm->nprocs > 1) atoms_parallel();
+
+  else {
+    bigint nread = 0;
+
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      atom->data_atoms(nchunk,buffer,id_offset,mol_offset,toffset,
+                       shiftflag,shift);
+      nread += nchunk;
+    }
   }
 
   // check that all atoms were assigned correctly
@@ -1239,6 +1262,364 @@ void ReadData::atoms()
   }
 }
 
+/* ----------------------------------------------------------------------
+   read Atoms section with all procs in parallel
+   proc 0 scans the section once to find its byte extent,
+     which leaves fp positioned at the next section keyword
+   each proc then reads/parses the slice of lines starting in its
+     byte range and routes each line to its owning proc via Irregular
+   data_atoms() is invoked with anywhere = 1 since lines arrive routed
+------------------------------------------------------------------------- */
+
+void ReadData::atoms_parallel()
+{
+  int nprocs = comm->nprocs;
+
+  // find byte extent of the section on proc 0
+
+  bigint offsets[2];
+  if (me == 0) {
+    offsets[0] = (bigint) ftell(fp);
+    for (bigint i = 0; i < natoms; i++)
+      if (fgets(line,MAXLINE,fp) == NULL)
+        error->one(FLERR,"Unexpected end of data file");
+    offsets[1] = (bigint) ftell(fp);
+  }
+  MPI_Bcast(offsets,2,MPI_LMP_BIGINT,0,world);
+
+  // open my own stream on the file and position it at the first line
+  // starting at or after my slice boundary
+  // a line straddling the boundary belongs to the previous proc
+
+  FILE *pfp = fopen(datafile,"r");
+  if (pfp == NULL) error->one(FLERR,"Cannot open data file for parallel read");
+
+  bigint lo = offsets[0] + (offsets[1]-offsets[0])*me/nprocs;
+  bigint hi = offsets[0] + (offsets[1]-offsets[0])*(me+1)/nprocs;
+
+  if (me == 0) fseek(pfp,(long) lo,SEEK_SET);
+  else {
+    fseek(pfp,(long) (lo-1),SEEK_SET);
+    int c = getc(pfp);
+    while (c != EOF && c != '\n') c = getc(pfp);
+  }
+
+  // read my lines, compute each line's owner from its remapped coords
+
+  int triclinic = domain->triclinic;
+  int xptr = atom->avec->xcol_data - 1;
+
+  int nmine = 0;
+  int maxlen = 0;
+  int maxmine = 0;
+  int *proclist = NULL;
+  int *linelen = NULL;
+  bigint nbytes = 0;
+  bigint maxbytes = 0;
+  char *mylines = NULL;
+
+  int m,igx,igy,igz;
+  double xdata[3],lamda[3];
+  double *coord;
+
+  bigint pos = (bigint) ftell(pfp);
+
+  while (pos < hi) {
+    if (fgets(line,MAXLINE,pfp) == NULL)
+      error->one(FLERR,"Unexpected end of data file");
+    int len = strlen(line);
+    if (line[len-1] != '\n') {
+      if (len >= MAXLINE-1)
+        error->one(FLERR,"Too long a line in data file");
+      line[len++] = '\n';
+      line[len] = '\0';
+    }
+    pos += len;
+
+    // tokenize a scratch copy to extract x,y,z
+    // the original line text is shipped to the owner
+
+    strcpy(buffer,line);
+    char *word = strtok(buffer," \t\n\r\f");
+    for (m = 0; m < xptr && word; m++) word = strtok(NULL," \t\n\r\f");
+    for (m = 0; m < 3; m++) {
+      if (word == NULL)
+        error->one(FLERR,"Incorrect atom format in data file");
+      xdata[m] = atof(word);
+      word = strtok(NULL," \t\n\r\f");
+    }
+
+    if (shiftflag) {
+      xdata[0] += shift[0];
+      xdata[1] += shift[1];
+      xdata[2] += shift[2];
+    }
+
+    domain->remap(xdata);
+    if (triclinic) {
+      domain->x2lamda(xdata,lamda);
+      coord = lamda;
+    } else coord = xdata;
+
+    if (nmine == maxmine) {
+      maxmine += CHUNK;
+      memory->grow(proclist,maxmine,"read_data:proclist");
+      memory->grow(linelen,maxmine,"read_data:linelen");
+    }
+    if (nbytes + len > maxbytes) {
+      maxbytes += (bigint) CHUNK*128;
+      memory->grow(mylines,maxbytes,"read_data:mylines");
+    }
+
+    proclist[nmine] = comm->coord2proc(coord,igx,igy,igz);
+    linelen[nmine] = len;
+    memcpy(&mylines[nbytes],line,len);
+    nbytes += len;
+    maxlen = MAX(maxlen,len);
+    nmine++;
+  }
+
+  fclose(pfp);
+
+  // pad each line to the globally longest so exchanged datums
+  // are fixed width, lines stay NUL-terminated
+
+  int width;
+  MPI_Allreduce(&maxlen,&width,1,MPI_INT,MPI_MAX,world);
+  width++;
+
+  char *sendbuf;
+  memory->create(sendbuf,(bigint) nmine*width,"read_data:sendbuf");
+  memset(sendbuf,0,(bigint) nmine*width);
+
+  nbytes = 0;
+  for (m = 0; m < nmine; m++) {
+    memcpy(&sendbuf[(bigint) m*width],&mylines[nbytes],linelen[m]);
+    nbytes += linelen[m];
+  }
+
+  memory->destroy(mylines);
+  memory->destroy(linelen);
+
+  // route each line to the proc owning its atom
+
+  Irregular *irregular = new Irregular(lmp);
+  int nrecv = irregular->create_data(nmine,proclist);
+  char *recvbuf;
+  memory->create(recvbuf,(bigint) nrecv*width,"read_data:recvbuf");
+  irregular->exchange_data(sendbuf,width,recvbuf);
+  irregular->destroy_data();
+  delete irregular;
+
+  memory->destroy(sendbuf);
+  memory->destroy(proclist);
+
+  // compact received lines into one contiguous buffer and store them
+
+  char *parsebuf;
+  memory->create(parsebuf,(bigint) nrecv*width + 1,"read_data:parsebuf");
+  nbytes = 0;
+  for (m = 0; m < nrecv; m++) {
+    int len = strlen(&recvbuf[(bigint) m*width]);
+    memcpy(&parsebuf[nbytes],&recvbuf[(bigint) m*width],len);
+    nbytes += len;
+  }
+  parsebuf[nbytes] = '\0';
+  memory->destroy(recvbuf);
+
+  if (nrecv)
+    atom->data_atoms(nrecv,parsebuf,id_offset,mol_offset,toffset,
+                     shiftflag,shift,1);
+  memory->destroy(parsebuf);
+}
+
+/* ----------------------------------------------------------------------
+   read Atoms Binary section written by write_data binary
+   fixed-width records (data + velocity columns as raw doubles) let
+   every proc fread an equal share directly at its computed offset,
+   route records to owners via Irregular, and re-render only its own
+   records as text for the standard data_atoms()/data_vels() parsers
+   readflag = 0 on topology scan pass, then just seek past the records
+------------------------------------------------------------------------- */
+
+void ReadData::atoms_binary(int readflag)
+{
+  int i;
+  int nprocs = comm->nprocs;
+
+  // proc 0 reads the text metadata line preceding the records
+
+  bigint nrows;
+  int ncola,ncolv;
+  if (me == 0) {
+    if (fgets(line,MAXLINE,fp) == NULL)
+      error->one(FLERR,"Unexpected end of data file");
+    if (sscanf(line,BIGINT_FORMAT " %d %d",&nrows,&ncola,&ncolv) != 3)
+      error->one(FLERR,"Incorrect format of Atoms Binary section");
+  }
+  MPI_Bcast(&nrows,1,MPI_LMP_BIGINT,0,world);
+  MPI_Bcast(&ncola,1,MPI_INT,0,world);
+  MPI_Bcast(&ncolv,1,MPI_INT,0,world);
+  int ncol = ncola + ncolv;
+
+  // byte extent of the records, proc 0 seeks past them
+
+  bigint offset;
+  if (me == 0) {
+    offset = (bigint) ftell(fp);
+    fseek(fp,(long) (offset + nrows*ncol*(bigint) sizeof(double)),SEEK_SET);
+  }
+  MPI_Bcast(&offset,1,MPI_LMP_BIGINT,0,world);
+
+  if (!readflag) return;
+
+#if defined(_WIN32)
+  error->all(FLERR,"Reading Atoms Binary sections is not supported on Windows");
+#endif
+
+  if (me == 0) utils::logmesg(lmp,"  reading binary atoms ...\n");
+
+  if (compressed)
+    error->all(FLERR,"Cannot read Atoms Binary section from gzipped file");
+  if (nrows != natoms)
+    error->all(FLERR,"Incorrect format of Atoms Binary section");
+  if (ncola != atom->avec->size_data_atom + 3 ||
+      ncolv != atom->avec->size_velocity + 1)
+    error->all(FLERR,"Atom style in data file is incompatible "
+               "with Atoms Binary section");
+
+  // every proc freads an equal share of records at its own offset
+
+  bigint rlo = natoms*me/nprocs;
+  bigint rhi = natoms*(me+1)/nprocs;
+  int nmine = static_cast<int> (rhi-rlo);
+
+  double **rows;
+  memory->create(rows,MAX(1,nmine),ncol,"read_data:rows");
+
+  FILE *pfp = fopen(datafile,"rb");
+  if (pfp == NULL) error->one(FLERR,"Cannot open data file for parallel read");
+  fseek(pfp,(long) (offset + rlo*ncol*(bigint) sizeof(double)),SEEK_SET);
+  if ((bigint) fread(&rows[0][0],sizeof(double),(bigint) nmine*ncol,pfp) !=
+      (bigint) nmine*ncol)
+    error->one(FLERR,"Unexpected end of data file");
+  fclose(pfp);
+
+  // route each record to the proc owning its remapped coords
+
+  int triclinic = domain->triclinic;
+  int xptr = atom->avec->xcol_data - 1;
+
+  int *proclist;
+  memory->create(proclist,MAX(1,nmine),"read_data:proclist");
+
+  int igx,igy,igz;
+  double xdata[3],lamda[3];
+  double *coord;
+
+  for (i = 0; i < nmine; i++) {
+    xdata[0] = rows[i][xptr];
+    xdata[1] = rows[i][xptr+1];
+    xdata[2] = rows[i][xptr+2];
+    if (shiftflag) {
+      xdata[0] += shift[0];
+      xdata[1] += shift[1];
+      xdata[2] += shift[2];
+    }
+    domain->remap(xdata);
+    if (triclinic) {
+      domain->x2lamda(xdata,lamda);
+      coord = lamda;
+    } else coord = xdata;
+    proclist[i] = comm->coord2proc(coord,igx,igy,igz);
+  }
+
+  Irregular *irregular = new Irregular(lmp);
+  int nrecv = irregular->create_data(nmine,proclist);
+  double **recvrows;
+  memory->create(recvrows,MAX(1,nrecv),ncol,"read_data:recvrows");
+  irregular->exchange_data((char *) &rows[0][0],ncol*sizeof(double),
+                           (char *) &recvrows[0][0]);
+  irregular->destroy_data();
+  delete irregular;
+
+  memory->destroy(rows);
+  memory->destroy(proclist);
+
+  // split records back into data and velocity columns
+
+  double **bufa,**bufv;
+  memory->create(bufa,MAX(1,nrecv),ncola,"read_data:bufa");
+  memory->create(bufv,MAX(1,nrecv),ncolv,"read_data:bufv");
+  for (i = 0; i < nrecv; i++) {
+    memcpy(bufa[i],recvrows[i],ncola*sizeof(double));
+    memcpy(bufv[i],&recvrows[i][ncola],ncolv*sizeof(double));
+  }
+  memory->destroy(recvrows);
+
+  // re-render my records as data file text via the avec formatter,
+  // then store them with the standard parser
+  // lines arrive routed, so data_atoms() accepts them anywhere
+
+  char *blob = NULL;
+  size_t blobsize = 0;
+  FILE *ms = open_memstream(&blob,&blobsize);
+  if (ms == NULL) error->one(FLERR,"Cannot open memory stream for read_data");
+  atom->avec->write_data(ms,nrecv,bufa);
+  fclose(ms);
+  if (nrecv)
+    atom->data_atoms(nrecv,blob,id_offset,mol_offset,toffset,
+                     shiftflag,shift,1);
+  free(blob);
+  memory->destroy(bufa);
+
+  // same correctness checks as the text Atoms section
+
+  bigint n = atom->nlocal;
+  bigint sum;
+  MPI_Allreduce(&n,&sum,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  bigint nassign = sum - (atom->natoms - natoms);
+
+  if (me == 0) utils::logmesg(lmp,fmt::format("  {} atoms\n",nassign));
+
+  if (sum != atom->natoms)
+    error->all(FLERR,"Did not assign all atoms correctly");
+
+  atom->tag_check();
+  atom->bonus_check();
+
+  if (atom->map_style) {
+    atom->map_init();
+    atom->map_set();
+  }
+
+  // assign velocities, via a temporary atom map if none is defined
+
+  int mapflag = 0;
+  if (atom->map_style == 0) {
+    mapflag = 1;
+    atom->map_init();
+    atom->map_set();
+  }
+
+  blob = NULL;
+  blobsize = 0;
+  ms = open_memstream(&blob,&blobsize);
+  if (ms == NULL) error->one(FLERR,"Cannot open memory stream for read_data");
+  atom->avec->write_vel(ms,nrecv,bufv);
+  fclose(ms);
+  if (nrecv) atom->data_vels(nrecv,blob,id_offset);
+  free(blob);
+  memory->destroy(bufv);
+
+  if (mapflag) {
+    atom->map_delete();
+    atom->map_style = 0;
+  }
+
+  if (me == 0) utils::logmesg(lmp,fmt::format("  {} velocities\n",natoms));
+}
+
 /* ----------------------------------------------------------------------
    read all velocities
    to find atoms, must build atom map if not a molecular system
@@ -64,6 +64,8 @@ class ReadData : protected Pointers {
   // optional args
 
   int addflag,offsetflag,shiftflag,coeffflag;
+  int parallelflag;
+  char *datafile;
   tagint addvalue;
   int toffset,boffset,aoffset,doffset,ioffset;
   double shift[3];
@@ -88,6 +90,8 @@ class ReadData : protected Pointers {
   int style_match(const char *, const char *);
 
   void atoms();
+  void atoms_parallel();
+  void atoms_binary(int);
   void velocities();
 
   void bonds(int);
@@ -40,6 +40,7 @@
 using namespace LAMMPS_NS;
 
 #define CHUNK 16384
+#define NSTAGE 8          // length of prefetched atom chunk ring
 
 // also in reader_native.cpp
 
@@ -77,12 +78,27 @@ ReadDump::ReadDump(LAMMPS *lmp) : Pointers(lmp)
   clustercomm = MPI_COMM_NULL;
   filereader = 0;
   parallel = 0;
+
+  irregular = NULL;
+
+  prefetcher = NULL;
+  prefetch_armed = 0;
+  stage_ready = stage_valid = 0;
+  stage_chunk = new double**[NSTAGE];
+  for (int i = 0; i < NSTAGE; i++) stage_chunk[i] = NULL;
+  stage_count = new int[NSTAGE];
+  stage_head = stage_tail = stage_nchunk = 0;
 }
 
 /* ---------------------------------------------------------------------- */
 
 ReadDump::~ReadDump()
 {
+  prefetch_finish();
+  for (int i = 0; i < NSTAGE; i++) memory->destroy(stage_chunk[i]);
+  delete [] stage_chunk;
+  delete [] stage_count;
+
   for (int i = 0; i < nfile; i++) delete [] files[i];
   delete [] files;
   for (int i = 0; i < nfield; i++) delete [] fieldlabel[i];
@@ -96,6 +112,7 @@ ReadDump::~ReadDump()
   for (int i = 0; i < nreader; i++) delete readers[i];
   delete [] readers;
   delete [] nsnapatoms;
+  delete irregular;
 
   MPI_Comm_free(&clustercomm);
 }
@@ -278,6 +295,11 @@ bigint ReadDump::seek(bigint nrequest, int exact)
   int ifile,eofflag;
   bigint ntimestep;
 
+  // discard any scan-ahead state, the file position is being reset
+
+  prefetch_finish();
+  prefetch_armed = 0;
+
   // proc 0 finds the timestep in its first reader
 
   if (me == 0 || parallel) {
@@ -367,9 +389,27 @@ bigint ReadDump::next(bigint ncurrent, bigint nlast, int nevery, int nskip)
   int ifile,eofflag;
   bigint ntimestep;
 
+  // if the prefetch thread already scanned ahead, consume its result
+  // header() and read_atoms() will consume the rest of the staged snapshot
+
+  if (prefetcher) {
+    if (ncurrent != prefetch_ncurrent || nlast != prefetch_nlast ||
+        nevery != prefetch_nevery || nskip != prefetch_nskip)
+      error->one(FLERR,"Rerun prefetch match criteria changed "
+                 "between snapshots");
+
+    std::unique_lock<std::mutex> lock(stage_mutex);
+    while (!stage_ready) stage_cond.wait(lock);
+    lock.unlock();
+
+    ntimestep = stage_ntimestep;
+    currentfile = stage_currentfile;
+    if (ntimestep < 0) prefetch_join();
+    else stage_valid = 1;
+
   // proc 0 finds the timestep in its first reader
 
-  if (me == 0 || parallel) {
+  } else if (me == 0 || parallel) {
 
     // exit file loop when dump timestep matches all criteria
     // or files exhausted
@@ -452,6 +492,15 @@ bigint ReadDump::next(bigint ncurrent, bigint nlast, int nevery, int nskip)
     }
   }
 
+  // save match criteria for the scan-ahead thread
+  // it is launched once this snapshot's atoms have been read
+
+  prefetch_ncurrent = ntimestep;
+  prefetch_nlast = nlast;
+  prefetch_nevery = nevery;
+  prefetch_nskip = nskip;
+  prefetch_armed = 1;
+
   return ntimestep;
 }
 
@@ -466,11 +515,28 @@ void ReadDump::header(int fieldinfo)
   int fieldflag,xflag,yflag,zflag;
 
   if (filereader) {
-    for (int i = 0; i < nreader; i++)
-      nsnapatoms[i] = readers[i]->read_header(box,boxinfo,triclinic_snap,fieldinfo,
-                                              nfield,fieldtype,fieldlabel,
-                                              scaleflag,wrapflag,fieldflag,
-                                              xflag,yflag,zflag);
+    if (stage_valid) {
+
+      // header was already parsed by the prefetch thread
+      // it does not stage field info, but rerun only requests
+      // field info for the first snapshot, before any prefetch
+
+      if (fieldinfo)
+        error->one(FLERR,"Read dump field info requested "
+                   "for prefetched snapshot");
+      nsnapatoms[0] = stage_nsnap;
+      memcpy(&box[0][0],&stage_box[0][0],9*sizeof(double));
+      boxinfo = stage_boxinfo;
+      triclinic_snap = stage_triclinic;
+
+    } else {
+      for (int i = 0; i < nreader; i++)
+        nsnapatoms[i] = readers[i]->read_header(box,boxinfo,triclinic_snap,
+                                                fieldinfo,
+                                                nfield,fieldtype,fieldlabel,
+                                                scaleflag,wrapflag,fieldflag,
+                                                xflag,yflag,zflag);
+    }
   }
 
   if (!parallel) {
@@ -720,10 +786,24 @@ void ReadDump::read_atoms()
         memory->create(fields,maxnew,nfield,"read_dump:fields");
       }
 
+      // each chunk is either parsed here or popped from the ring of
+      // chunks the prefetch thread parsed during the previous snapshot
+
+      double **chunk;
+
       ntotal = 0;
       while (ntotal < nsnap) {
-        nread = MIN(CHUNK,nsnap-ntotal);
-        readers[0]->read_atoms(nread,nfield,buf);
+        if (stage_valid) {
+          std::unique_lock<std::mutex> lock(stage_mutex);
+          while (stage_nchunk == 0) stage_cond.wait(lock);
+          lock.unlock();
+          chunk = stage_chunk[stage_head];
+          nread = stage_count[stage_head];
+        } else {
+          nread = MIN(CHUNK,nsnap-ntotal);
+          readers[0]->read_atoms(nread,nfield,buf);
+          chunk = buf;
+        }
         rfirst = ntotal;
         rlast = ntotal + nread;
 
@@ -732,10 +812,10 @@ void ReadDump::read_atoms()
           lo = MAX(ofirst,rfirst);
           hi = MIN(olast,rlast);
           if (otherproc)    // send to otherproc or copy to self
-            MPI_Send(&buf[nsend][0],(hi-lo)*nfield,MPI_DOUBLE,
+            MPI_Send(&chunk[nsend][0],(hi-lo)*nfield,MPI_DOUBLE,
                      otherproc,0,clustercomm);
           else
-            memcpy(&fields[rfirst][0],&buf[nsend][0],
+            memcpy(&fields[rfirst][0],&chunk[nsend][0],
                    (hi-lo)*nfield*sizeof(double));
           nsend += hi-lo;
           if (hi == olast) {
@@ -745,9 +825,22 @@ void ReadDump::read_atoms()
           }
         }
 
+        if (stage_valid) {
+          std::unique_lock<std::mutex> lock(stage_mutex);
+          stage_head = (stage_head+1) % NSTAGE;
+          stage_nchunk--;
+          lock.unlock();
+          stage_cond.notify_all();
+        }
+
         ntotal += nread;
       }
 
+      if (stage_valid) {
+        prefetch_join();
+        stage_valid = 0;
+      }
+
     } else {
       ofirst = (bigint) me_cluster * nsnap/nprocs_cluster;
       olast = (bigint) (me_cluster+1) * nsnap/nprocs_cluster;
@@ -803,6 +896,156 @@ void ReadDump::read_atoms()
       nnew += nsnap;
     }
   }
+
+  // the reader's file is now idle until the next snapshot is requested:
+  // start scanning ahead for it while this one is processed
+
+  prefetch_start();
+}
+
+/* ----------------------------------------------------------------------
+   launch the scan-ahead thread on the reading proc
+   only for rerun (armed by next) on a single non-parallel dump file
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_start()
+{
+  if (!prefetch_armed || me || multiproc || parallel) return;
+  prefetch_armed = 0;
+
+  if (stage_chunk[0] == NULL)
+    for (int i = 0; i < NSTAGE; i++)
+      memory->create(stage_chunk[i],CHUNK,nfield,"read_dump:stage_chunk");
+
+  stage_ready = 0;
+  stage_head = stage_tail = stage_nchunk = 0;
+  stage_currentfile = currentfile;
+  prefetcher = new std::thread(&ReadDump::prefetch_scan,this);
+}
+
+/* ----------------------------------------------------------------------
+   body of the scan-ahead thread
+   replicate the scan loop in next() with the saved match criteria,
+   then parse the matching snapshot's header and atom chunks
+   makes no MPI calls: all results are only staged for the main thread
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_scan()
+{
+  int ifile,eofflag;
+  bigint ntimestep;
+  int iskip = 0;
+
+  for (ifile = stage_currentfile; ifile < nfile; ifile++) {
+    ntimestep = -1;
+    if (ifile != stage_currentfile) readers[0]->open_file(files[ifile]);
+
+    while (1) {
+      eofflag = readers[0]->read_time(ntimestep);
+      if (eofflag) break;
+      if (ntimestep > prefetch_nlast) break;
+      if (ntimestep <= prefetch_ncurrent) {
+        readers[0]->skip();
+        continue;
+      }
+      if (iskip == prefetch_nskip) iskip = 0;
+      iskip++;
+      if (prefetch_nevery && ntimestep % prefetch_nevery) readers[0]->skip();
+      else if (iskip < prefetch_nskip) readers[0]->skip();
+      else break;
+    }
+
+    if (eofflag) readers[0]->close_file();
+    else break;
+  }
+
+  stage_currentfile = ifile;
+  if (eofflag) ntimestep = -1;
+  if (ntimestep <= prefetch_ncurrent) ntimestep = -1;
+  if (ntimestep > prefetch_nlast) ntimestep = -1;
+  stage_ntimestep = ntimestep;
+
+  if (ntimestep >= 0) {
+    int fieldflag,xflag,yflag,zflag;
+    stage_nsnap = readers[0]->read_header(stage_box,stage_boxinfo,
+                                          stage_triclinic,0,
+                                          nfield,fieldtype,fieldlabel,
+                                          scaleflag,wrapflag,fieldflag,
+                                          xflag,yflag,zflag);
+  }
+
+  // publish scan and header results so next() can proceed
+
+  {
+    std::unique_lock<std::mutex> lock(stage_mutex);
+    stage_ready = 1;
+  }
+  stage_cond.notify_all();
+
+  if (ntimestep < 0) return;
+
+  // parse atom chunks into the ring until the snapshot is exhausted
+  // blocks when the ring is full, i.e. NSTAGE chunks ahead of read_atoms
+
+  bigint ntotal = 0;
+  while (ntotal < stage_nsnap) {
+    std::unique_lock<std::mutex> lock(stage_mutex);
+    while (stage_nchunk == NSTAGE) stage_cond.wait(lock);
+    lock.unlock();
+
+    int nread = MIN(CHUNK,stage_nsnap-ntotal);
+    readers[0]->read_atoms(nread,nfield,stage_chunk[stage_tail]);
+    stage_count[stage_tail] = nread;
+
+    lock.lock();
+    stage_tail = (stage_tail+1) % NSTAGE;
+    stage_nchunk++;
+    lock.unlock();
+    stage_cond.notify_all();
+
+    ntotal += nread;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   join the scan-ahead thread after its output has been consumed
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_join()
+{
+  prefetcher->join();
+  delete prefetcher;
+  prefetcher = NULL;
+}
+
+/* ----------------------------------------------------------------------
+   discard a prefetched snapshot that will not be consumed
+   drain the chunk ring so the thread can run to completion, then join
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_finish()
+{
+  if (!prefetcher) return;
+
+  std::unique_lock<std::mutex> lock(stage_mutex);
+  while (!stage_ready) stage_cond.wait(lock);
+  lock.unlock();
+
+  if (stage_ntimestep >= 0) {
+    bigint ndrain = 0;
+    while (ndrain < stage_nsnap) {
+      lock.lock();
+      while (stage_nchunk == 0) stage_cond.wait(lock);
+      ndrain += stage_count[stage_head];
+      stage_head = (stage_head+1) % NSTAGE;
+      stage_nchunk--;
+      lock.unlock();
+      stage_cond.notify_all();
+    }
+  }
+
+  prefetch_join();
+  stage_valid = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -1082,9 +1325,8 @@ void ReadDump::migrate_old_atoms()
   for (int i = 0; i < nlocal; i++)
     procassign[i] = tag[i] % nprocs;
 
-  Irregular *irregular = new Irregular(lmp);
+  if (!irregular) irregular = new Irregular(lmp);
   irregular->migrate_atoms(1,1,procassign);
-  delete irregular;
 
   memory->destroy(procassign);
 }
@@ -1105,7 +1347,7 @@ void ReadDump::migrate_new_atoms()
     procassign[i] = mtag % nprocs;
   }
 
-  Irregular *irregular = new Irregular(lmp);
+  if (!irregular) irregular = new Irregular(lmp);
   int nrecv = irregular->create_data(nnew,procassign,1);
   int newmaxnew = MAX(nrecv,maxnew);
   newmaxnew = MAX(newmaxnew,1);    // avoid NULL ptr
@@ -1113,7 +1355,6 @@ void ReadDump::migrate_new_atoms()
   irregular->exchange_data((char *) &fields[0][0],nfield*sizeof(double),
                            (char *) &newfields[0][0]);
   irregular->destroy_data();
-  delete irregular;
 
   memory->destroy(fields);
   memory->destroy(procassign);
@@ -1142,9 +1383,8 @@ void ReadDump::migrate_atoms_by_coords()
 
   if (triclinic) domain->x2lamda(atom->nlocal);
   domain->reset_box();
-  Irregular *irregular = new Irregular(lmp);
+  if (!irregular) irregular = new Irregular(lmp);
   irregular->migrate_atoms(1);
-  delete irregular;
   if (triclinic) domain->lamda2x(atom->nlocal);
 }
 
@@ -24,6 +24,10 @@ CommandStyle(read_dump,ReadDump)
 
 #include "pointers.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace LAMMPS_NS {
 
 class ReadDump : protected Pointers {
@@ -97,6 +101,41 @@ private:
                             // nreader-length list of readers if proc reads
                             //   from multiple parallel dump files
 
+  class Irregular *irregular;  // irregular comm for atom migration, kept
+                               //   across snapshots so its plan cache can
+                               //   be reused for near-identical frames
+
+  // prefetch pipeline for rerun on a single (non-parallel) dump file
+  // a thread on the reading proc scans ahead to the next matching
+  // snapshot and parses its header and atom chunks while the current
+  // snapshot is processed and its forces are computed
+
+  std::thread *prefetcher;     // scan-ahead thread, NULL when not running
+  int prefetch_armed;          // 1 if criteria for the next scan are saved
+  bigint prefetch_ncurrent;    // match criteria saved by last next() call
+  bigint prefetch_nlast;
+  int prefetch_nevery,prefetch_nskip;
+
+  std::mutex stage_mutex;              // guards staged results below
+  std::condition_variable stage_cond;
+  int stage_ready;             // 1 when scan and header results are staged
+  int stage_valid;             // 1 when header()/read_atoms() should
+                               //   consume staged results, reader proc only
+  bigint stage_ntimestep;      // staged scan result, -1 if no match
+  int stage_currentfile;
+  bigint stage_nsnap;          // staged header info
+  double stage_box[3][3];
+  int stage_boxinfo,stage_triclinic;
+  double ***stage_chunk;       // ring of staged atom chunk buffers
+  int *stage_count;            // # of atoms parsed into each ring slot
+  int stage_head,stage_tail;   // next ring slot to consume/fill
+  int stage_nchunk;            // # of filled ring slots
+
+  void prefetch_start();
+  void prefetch_scan();
+  void prefetch_join();
+  void prefetch_finish();
+
   void read_atoms();
   void process_atoms();
   void migrate_old_atoms();
@@ -50,7 +50,7 @@ ReadRestart::ReadRestart(LAMMPS *lmp) : Pointers(lmp) {}
 
 void ReadRestart::command(int narg, char **arg)
 {
-  if (narg != 1 && narg != 2) error->all(FLERR,"Illegal read_restart command");
+  if (narg < 1) error->all(FLERR,"Illegal read_restart command");
 
   if (domain->box_exist)
     error->all(FLERR,"Cannot read_restart after simulation box is defined");
@@ -61,12 +61,21 @@ void ReadRestart::command(int narg, char **arg)
   MPI_Comm_rank(world,&me);
   MPI_Comm_size(world,&nprocs);
 
-  // check for remap option
+  // check for remap and delta options
 
   int remapflag = 0;
-  if (narg == 2) {
-    if (strcmp(arg[1],"remap") == 0) remapflag = 1;
-    else error->all(FLERR,"Illegal read_restart command");
+  char *deltafile = NULL;
+
+  int iarg = 1;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"remap") == 0) {
+      remapflag = 1;
+      iarg++;
+    } else if (strcmp(arg[iarg],"delta") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal read_restart command");
+      deltafile = arg[iarg+1];
+      iarg += 2;
+    } else error->all(FLERR,"Illegal read_restart command");
   }
 
   // if filename contains "*", search dir for latest restart file
@@ -499,6 +508,10 @@ void ReadRestart::command(int narg, char **arg)
     atom->map_set();
   }
 
+  // replay a delta restart file on top of the base state just read
+
+  if (deltafile) replay_delta(deltafile,nextra);
+
   // create special bond lists for molecular systems
 
   if (atom->molecular == 1) {
@@ -515,6 +528,204 @@ void ReadRestart::command(int narg, char **arg)
                                    MPI_Wtime()-time1));
 }
 
+/* ----------------------------------------------------------------------
+   replay a delta restart file written by write_restart delta
+     on top of the full base restart that was just read
+   overwrites timestep, box, and tag-matched per-atom dynamic state
+     (image, x, v, + omega if stored), then migrates atoms to new owners
+   per-atom state held by fixes is not in the delta file and keeps
+     its value from the base file
+------------------------------------------------------------------------- */
+
+void ReadRestart::replay_delta(char *deltafile, int nextra)
+{
+  bigint ntimestep,dnatoms;
+  int omega_flag,triclinic;
+  double boxlo[3],boxhi[3],tilt[3];
+
+  // proc 0 opens delta file and reads + checks magic string and header
+
+  if (me == 0) {
+    utils::logmesg(lmp,fmt::format("  replaying delta restart file {} ...\n",
+                                   deltafile));
+    fp = fopen(deltafile,"rb");
+    if (fp == NULL)
+      error->one(FLERR,fmt::format("Cannot open restart file {}: {}",
+                                   deltafile, utils::getsyserror()));
+
+    const char magic[] = DELTA_MAGIC_STRING;
+    int n = strlen(magic) + 1;
+    char *str = new char[n];
+    utils::sfread(FLERR,str,sizeof(char),n,fp,NULL,error);
+    if (strcmp(str,magic) != 0)
+      error->one(FLERR,"Invalid LAMMPS delta restart file");
+    delete [] str;
+
+    utils::sfread(FLERR,&ntimestep,sizeof(bigint),1,fp,NULL,error);
+    utils::sfread(FLERR,&dnatoms,sizeof(bigint),1,fp,NULL,error);
+    utils::sfread(FLERR,&omega_flag,sizeof(int),1,fp,NULL,error);
+    utils::sfread(FLERR,&triclinic,sizeof(int),1,fp,NULL,error);
+    utils::sfread(FLERR,boxlo,sizeof(double),3,fp,NULL,error);
+    utils::sfread(FLERR,boxhi,sizeof(double),3,fp,NULL,error);
+    utils::sfread(FLERR,tilt,sizeof(double),3,fp,NULL,error);
+  }
+
+  MPI_Bcast(&ntimestep,1,MPI_LMP_BIGINT,0,world);
+  MPI_Bcast(&dnatoms,1,MPI_LMP_BIGINT,0,world);
+  MPI_Bcast(&omega_flag,1,MPI_INT,0,world);
+  MPI_Bcast(&triclinic,1,MPI_INT,0,world);
+  MPI_Bcast(boxlo,3,MPI_DOUBLE,0,world);
+  MPI_Bcast(boxhi,3,MPI_DOUBLE,0,world);
+  MPI_Bcast(tilt,3,MPI_DOUBLE,0,world);
+
+  if (dnatoms != atom->natoms)
+    error->all(FLERR,"Delta restart file atom count does not match base file");
+  if (triclinic != domain->triclinic)
+    error->all(FLERR,"Delta restart file box does not match base file");
+  if (omega_flag && !atom->omega_flag)
+    error->all(FLERR,"Delta restart file stores omega but atom style does not");
+
+  // overwrite simulation box with delta box and reassign procs to it
+
+  domain->boxlo[0] = boxlo[0];
+  domain->boxlo[1] = boxlo[1];
+  domain->boxlo[2] = boxlo[2];
+  domain->boxhi[0] = boxhi[0];
+  domain->boxhi[1] = boxhi[1];
+  domain->boxhi[2] = boxhi[2];
+  if (triclinic) {
+    domain->xy = tilt[0];
+    domain->xz = tilt[1];
+    domain->yz = tilt[2];
+  }
+
+  domain->set_initial_box();
+  domain->set_global_box();
+  comm->set_proc_grid(0);
+  domain->set_local_box();
+
+  update->ntimestep = ntimestep;
+
+  // need an atom map to match delta records to owned atoms
+  // create a temporary one if the atom style has none
+
+  int mapflag = 0;
+  if (atom->map_style == 0) {
+    mapflag = 1;
+    atom->map_init();
+    atom->map_set();
+  }
+
+  // each chunk = per-atom records from one proc that wrote the delta file
+  // proc 0 reads and bcasts each chunk, all procs update atoms they own
+
+  int nper = 8;
+  if (omega_flag) nper += 3;
+
+  int n;
+  int maxbuf = 0;
+  double *buf = NULL;
+  bigint nmatch = 0;
+
+  while (1) {
+    if (me == 0) utils::sfread(FLERR,&n,sizeof(int),1,fp,NULL,error);
+    MPI_Bcast(&n,1,MPI_INT,0,world);
+    if (n < 0) break;
+
+    if (n > maxbuf) {
+      maxbuf = n;
+      memory->destroy(buf);
+      memory->create(buf,maxbuf,"read_restart:buf");
+    }
+    if (me == 0) utils::sfread(FLERR,buf,sizeof(double),n,fp,NULL,error);
+    MPI_Bcast(buf,n,MPI_DOUBLE,0,world);
+
+    double **x = atom->x;
+    double **v = atom->v;
+    double **omega = atom->omega;
+    imageint *image = atom->image;
+    int nlocal = atom->nlocal;
+
+    for (int m = 0; m < n; m += nper) {
+      tagint tag = (tagint) ubuf(buf[m]).i;
+      int i = atom->map(tag);
+      if (i < 0 || i >= nlocal) continue;
+      image[i] = (imageint) ubuf(buf[m+1]).i;
+      x[i][0] = buf[m+2];
+      x[i][1] = buf[m+3];
+      x[i][2] = buf[m+4];
+      v[i][0] = buf[m+5];
+      v[i][1] = buf[m+6];
+      v[i][2] = buf[m+7];
+      if (omega_flag) {
+        omega[i][0] = buf[m+8];
+        omega[i][1] = buf[m+9];
+        omega[i][2] = buf[m+10];
+      }
+      nmatch++;
+    }
+  }
+
+  if (me == 0) {
+    fclose(fp);
+    fp = NULL;
+  }
+
+  memory->destroy(buf);
+
+  bigint nmatch_all;
+  MPI_Allreduce(&nmatch,&nmatch_all,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  if (nmatch_all != atom->natoms)
+    error->all(FLERR,"Delta restart file atoms do not match base file");
+
+  if (mapflag) {
+    atom->map_delete();
+    atom->map_style = 0;
+  }
+
+  // updated coords may place atoms in other procs' sub-domains
+  // hold extra per-atom fix info in a temporary fix across the migration
+  // then migrate atoms to new owners based on coords, as in read_dump
+
+  if (nextra)
+    modify->add_fix(fmt::format("_read_restart all READ_RESTART {} {}",
+                                nextra,modify->nfix_restart_peratom));
+
+  double **x = atom->x;
+  imageint *image = atom->image;
+  int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++) domain->remap(x[i],image[i]);
+
+  if (triclinic) domain->x2lamda(atom->nlocal);
+  domain->reset_box();
+  Irregular *irregular = new Irregular(lmp);
+  irregular->migrate_atoms(1);
+  delete irregular;
+  if (triclinic) domain->lamda2x(atom->nlocal);
+
+  if (nextra) {
+    memory->destroy(atom->extra);
+    memory->create(atom->extra,atom->nmax,nextra,"atom:extra");
+    int ifix = modify->find_fix("_read_restart");
+    FixReadRestart *fix = (FixReadRestart *) modify->fix[ifix];
+    int *count = fix->count;
+    double **extra = fix->extra;
+    double **atom_extra = atom->extra;
+    nlocal = atom->nlocal;
+    for (int i = 0; i < nlocal; i++)
+      for (int j = 0; j < count[i]; j++)
+        atom_extra[i][j] = extra[i][j];
+    modify->delete_fix("_read_restart");
+  }
+
+  // rebuild permanent atom map since migrate_atoms() cleared it
+
+  if (atom->map_style) {
+    atom->map_init();
+    atom->map_set();
+  }
+}
+
 /* ----------------------------------------------------------------------
    inpfile contains a "*"
    search for all files which match the inpfile pattern
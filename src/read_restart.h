@@ -47,6 +47,7 @@ class ReadRestart : protected Pointers {
   MPI_Offset assignedChunkOffset,headerOffset;
 
   void file_search(char *, char *);
+  void replay_delta(char *, int);
   void header();
   void type_arrays();
   void force_fields();
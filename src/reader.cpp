@@ -38,12 +38,14 @@ void Reader::open_file(const char *file)
   if (fp != NULL) close_file();
 
   compressed = 0;
-  const char *suffix = file + strlen(file) - 3;
-  if (suffix > file && strcmp(suffix,".gz") == 0) compressed = 1;
+  if (utils::strmatch(file,"\\.gz$")) compressed = 1;
+  else if (utils::strmatch(file,"\\.zst$")) compressed = 2;
   if (!compressed) fp = fopen(file,"r");
   else {
 #ifdef LAMMPS_GZIP
-    std::string gunzip = fmt::format("gzip -c -d {}",file);
+    std::string gunzip;
+    if (compressed == 2) gunzip = fmt::format("zstd -c -d -q {}",file);
+    else gunzip = fmt::format("gzip -c -d {}",file);
 #ifdef _WIN32
     fp = _popen(gunzip.c_str(),"rb");
 #else
@@ -0,0 +1,405 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "reader_columnar.h"
+#include <cstring>
+#include "memory.h"
+#include "error.h"
+#include "utils.h"
+
+using namespace LAMMPS_NS;
+
+// same as in read_dump.cpp and reader_native.cpp
+
+enum{ID,TYPE,X,Y,Z,VX,VY,VZ,Q,IX,IY,IZ,FX,FY,FZ};
+enum{UNSET,NOSCALE_NOWRAP,NOSCALE_WRAP,SCALE_NOWRAP,SCALE_WRAP};
+
+/* ---------------------------------------------------------------------- */
+
+ReaderColumnar::ReaderColumnar(LAMMPS *lmp) : Reader(lmp)
+{
+  fieldindex = NULL;
+  labelstr = NULL;
+  coldata = NULL;
+  maxcoldata = 0;
+  nchunks = nrows = irow = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+ReaderColumnar::~ReaderColumnar()
+{
+  memory->destroy(fieldindex);
+  memory->destroy(coldata);
+  delete [] labelstr;
+}
+
+/* ----------------------------------------------------------------------
+   read and return time stamp from dump file
+   if first read reaches end-of-file, return 1 so caller can open next file
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+int ReaderColumnar::read_time(bigint &ntimestep)
+{
+  if (fread(&ntimestep,sizeof(bigint),1,fp) != 1) return 1;
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   skip snapshot from timestamp onward
+   reads the file sequentially, no seeking, so gzipped pipes also work
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+void ReaderColumnar::skip()
+{
+  double box[3][3];
+  int triclinic,nfield;
+  read_box(box,triclinic,nfield,nchunks);
+
+  int nrows_chunk,codec,nruns;
+  for (int ichunk = 0; ichunk < nchunks; ichunk++) {
+    read_buf(&nrows_chunk,sizeof(int),1);
+    for (int j = 0; j < nfield; j++) {
+      read_buf(&codec,sizeof(int),1);
+      if (codec == 0) skip_buf((bigint) nrows_chunk * sizeof(double));
+      else {
+        read_buf(&nruns,sizeof(int),1);
+        skip_buf((bigint) nruns * (sizeof(int) + sizeof(double)));
+      }
+    }
+  }
+  nchunks = 0;
+}
+
+/* ----------------------------------------------------------------------
+   read remaining header info:
+     return natoms
+     box bounds, triclinic, fieldflag (1 if any fields not found),
+     xyz flags = UNSET (not a requested field), SCALE/WRAP as in enum
+   if fieldflag set:
+     match Nfield fields to per-atom column labels stored in the frame
+     allocate and set fieldindex = which column each field maps to
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+bigint ReaderColumnar::read_header(double box[3][3], int &boxinfo,
+                                   int &triclinic, int fieldinfo, int nfield,
+                                   int *fieldtype, char **fieldlabel,
+                                   int scaleflag, int wrapflag, int &fieldflag,
+                                   int &xflag, int &yflag, int &zflag)
+{
+  read_box(box,triclinic,nwords,nchunks);
+  boxinfo = 1;
+  nrows = irow = 0;
+
+  bigint natoms = file_natoms;
+
+  // if no field info requested, just return
+
+  if (!fieldinfo) return natoms;
+
+  // tokenize stored column labels and match to requested fields
+
+  char **labels = new char*[nwords];
+  labels[0] = strtok(labelstr," \t\n\r\f");
+  if (labels[0] == NULL) {
+    delete[] labels;
+    return 1;
+  }
+  for (int m = 1; m < nwords; m++) {
+    labels[m] = strtok(NULL," \t\n\r\f");
+    if (labels[m] == NULL) {
+      delete[] labels;
+      return 1;
+    }
+  }
+
+  // match each field with a column of per-atom data
+  // if fieldlabel set, match with explicit column
+  // else infer one or more column matches from fieldtype
+  // xyz flag set by scaleflag + wrapflag (if fieldlabel set) or column label
+
+  memory->create(fieldindex,nfield,"read_dump:fieldindex");
+
+  int s_index,u_index,su_index;
+  xflag = UNSET;
+  yflag = UNSET;
+  zflag = UNSET;
+
+  for (int i = 0; i < nfield; i++) {
+    if (fieldlabel[i]) {
+      fieldindex[i] = find_label(fieldlabel[i],nwords,labels);
+      if (fieldtype[i] == X) xflag = 2*scaleflag + wrapflag + 1;
+      else if (fieldtype[i] == Y) yflag = 2*scaleflag + wrapflag + 1;
+      else if (fieldtype[i] == Z) zflag = 2*scaleflag + wrapflag + 1;
+    }
+
+    else if (fieldtype[i] == ID)
+      fieldindex[i] = find_label("id",nwords,labels);
+    else if (fieldtype[i] == TYPE)
+      fieldindex[i] = find_label("type",nwords,labels);
+
+    else if (fieldtype[i] == X) {
+      fieldindex[i] = find_label("x",nwords,labels);
+      xflag = NOSCALE_WRAP;
+      if (fieldindex[i] < 0) {
+        fieldindex[i] = nwords;
+        s_index = find_label("xs",nwords,labels);
+        u_index = find_label("xu",nwords,labels);
+        su_index = find_label("xsu",nwords,labels);
+        if (s_index >= 0 && s_index < fieldindex[i]) {
+          fieldindex[i] = s_index;
+          xflag = SCALE_WRAP;
+        }
+        if (u_index >= 0 && u_index < fieldindex[i]) {
+          fieldindex[i] = u_index;
+          xflag = NOSCALE_NOWRAP;
+        }
+        if (su_index >= 0 && su_index < fieldindex[i]) {
+          fieldindex[i] = su_index;
+          xflag = SCALE_NOWRAP;
+        }
+      }
+      if (fieldindex[i] == nwords) fieldindex[i] = -1;
+
+    } else if (fieldtype[i] == Y) {
+      fieldindex[i] = find_label("y",nwords,labels);
+      yflag = NOSCALE_WRAP;
+      if (fieldindex[i] < 0) {
+        fieldindex[i] = nwords;
+        s_index = find_label("ys",nwords,labels);
+        u_index = find_label("yu",nwords,labels);
+        su_index = find_label("ysu",nwords,labels);
+        if (s_index >= 0 && s_index < fieldindex[i]) {
+          fieldindex[i] = s_index;
+          yflag = SCALE_WRAP;
+        }
+        if (u_index >= 0 && u_index < fieldindex[i]) {
+          fieldindex[i] = u_index;
+          yflag = NOSCALE_NOWRAP;
+        }
+        if (su_index >= 0 && su_index < fieldindex[i]) {
+          fieldindex[i] = su_index;
+          yflag = SCALE_NOWRAP;
+        }
+      }
+      if (fieldindex[i] == nwords) fieldindex[i] = -1;
+
+    } else if (fieldtype[i] == Z) {
+      fieldindex[i] = find_label("z",nwords,labels);
+      zflag = NOSCALE_WRAP;
+      if (fieldindex[i] < 0) {
+        fieldindex[i] = nwords;
+        s_index = find_label("zs",nwords,labels);
+        u_index = find_label("zu",nwords,labels);
+        su_index = find_label("zsu",nwords,labels);
+        if (s_index >= 0 && s_index < fieldindex[i]) {
+          fieldindex[i] = s_index;
+          zflag = SCALE_WRAP;
+        }
+        if (u_index >= 0 && u_index < fieldindex[i]) {
+          fieldindex[i] = u_index;
+          zflag = NOSCALE_NOWRAP;
+        }
+        if (su_index >= 0 && su_index < fieldindex[i]) {
+          fieldindex[i] = su_index;
+          zflag = SCALE_NOWRAP;
+        }
+      }
+      if (fieldindex[i] == nwords) fieldindex[i] = -1;
+
+    } else if (fieldtype[i] == VX)
+      fieldindex[i] = find_label("vx",nwords,labels);
+    else if (fieldtype[i] == VY)
+      fieldindex[i] = find_label("vy",nwords,labels);
+    else if (fieldtype[i] == VZ)
+      fieldindex[i] = find_label("vz",nwords,labels);
+
+    else if (fieldtype[i] == FX)
+      fieldindex[i] = find_label("fx",nwords,labels);
+    else if (fieldtype[i] == FY)
+      fieldindex[i] = find_label("fy",nwords,labels);
+    else if (fieldtype[i] == FZ)
+      fieldindex[i] = find_label("fz",nwords,labels);
+
+    else if (fieldtype[i] == Q)
+      fieldindex[i] = find_label("q",nwords,labels);
+
+    else if (fieldtype[i] == IX)
+      fieldindex[i] = find_label("ix",nwords,labels);
+    else if (fieldtype[i] == IY)
+      fieldindex[i] = find_label("iy",nwords,labels);
+    else if (fieldtype[i] == IZ)
+      fieldindex[i] = find_label("iz",nwords,labels);
+  }
+
+  delete [] labels;
+
+  // set fieldflag = -1 if any unfound fields
+
+  fieldflag = 0;
+  for (int i = 0; i < nfield; i++)
+    if (fieldindex[i] < 0) fieldflag = -1;
+
+  return natoms;
+}
+
+/* ----------------------------------------------------------------------
+   read N atoms worth of fields, decoding one chunk at a time
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+void ReaderColumnar::read_atoms(int n, int nfield, double **fields)
+{
+  int i,m;
+
+  for (i = 0; i < n; i++) {
+    if (irow == nrows) read_chunk();
+    for (m = 0; m < nfield; m++)
+      fields[i][m] = coldata[(bigint) fieldindex[m]*nrows + irow];
+    irow++;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   read frame header from natoms onward: box, column labels, chunk count
+   leaves the file positioned at the first chunk
+------------------------------------------------------------------------- */
+
+void ReaderColumnar::read_box(double box[3][3], int &triclinic,
+                              int &nfield, int &nchunk)
+{
+  int boundary[6];
+
+  read_buf(&file_natoms,sizeof(bigint),1);
+  read_buf(&triclinic,sizeof(int),1);
+  read_buf(boundary,sizeof(int),6);
+
+  box[0][2] = box[1][2] = box[2][2] = 0.0;
+  read_buf(&box[0][0],sizeof(double),1);
+  read_buf(&box[0][1],sizeof(double),1);
+  read_buf(&box[1][0],sizeof(double),1);
+  read_buf(&box[1][1],sizeof(double),1);
+  read_buf(&box[2][0],sizeof(double),1);
+  read_buf(&box[2][1],sizeof(double),1);
+  if (triclinic) {
+    read_buf(&box[0][2],sizeof(double),1);
+    read_buf(&box[1][2],sizeof(double),1);
+    read_buf(&box[2][2],sizeof(double),1);
+  }
+
+  read_buf(&nfield,sizeof(int),1);
+  if (nfield <= 0) error->one(FLERR,"Dump file is incorrectly formatted");
+
+  // per-column type codes are not needed for reading, skip them
+
+  skip_buf((bigint) nfield * sizeof(int));
+
+  int len;
+  read_buf(&len,sizeof(int),1);
+  if (len <= 0) error->one(FLERR,"Dump file is incorrectly formatted");
+  delete [] labelstr;
+  labelstr = new char[len+1];
+  read_buf(labelstr,sizeof(char),len);
+  labelstr[len] = '\0';
+
+  read_buf(&nchunk,sizeof(int),1);
+}
+
+/* ----------------------------------------------------------------------
+   read and decode next chunk of the current frame into coldata
+   coldata is column-major: nwords columns of nrows values
+------------------------------------------------------------------------- */
+
+void ReaderColumnar::read_chunk()
+{
+  if (nchunks == 0) error->one(FLERR,"Unexpected end of dump file");
+  nchunks--;
+
+  read_buf(&nrows,sizeof(int),1);
+  if (nrows < 0) error->one(FLERR,"Dump file is incorrectly formatted");
+
+  bigint nvalues = (bigint) nwords * nrows;
+  if (nvalues > maxcoldata) {
+    memory->destroy(coldata);
+    maxcoldata = nvalues;
+    memory->create(coldata,maxcoldata,"read_dump:coldata");
+  }
+
+  int codec,nruns,count;
+  double value;
+
+  for (int j = 0; j < nwords; j++) {
+    double *col = &coldata[(bigint) j * nrows];
+
+    read_buf(&codec,sizeof(int),1);
+
+    if (codec == 0) {
+      read_buf(col,sizeof(double),nrows);
+
+    } else if (codec == 1) {
+      read_buf(&nruns,sizeof(int),1);
+      int m = 0;
+      for (int irun = 0; irun < nruns; irun++) {
+        read_buf(&count,sizeof(int),1);
+        read_buf(&value,sizeof(double),1);
+        if (count < 0 || m + count > nrows)
+          error->one(FLERR,"Dump file is incorrectly formatted");
+        for (int k = 0; k < count; k++) col[m++] = value;
+      }
+      if (m != nrows)
+        error->one(FLERR,"Dump file is incorrectly formatted");
+
+    } else error->one(FLERR,"Dump file is incorrectly formatted");
+  }
+
+  irow = 0;
+}
+
+/* ----------------------------------------------------------------------
+   read count items of given size from dump file, error on short read
+------------------------------------------------------------------------- */
+
+void ReaderColumnar::read_buf(void *ptr, size_t size, size_t count)
+{
+  if (fread(ptr,size,count,fp) != count)
+    error->one(FLERR,"Unexpected end of dump file");
+}
+
+/* ----------------------------------------------------------------------
+   skip nbytes of the dump file by reading, so pipes also work
+------------------------------------------------------------------------- */
+
+void ReaderColumnar::skip_buf(bigint nbytes)
+{
+  char junk[4096];
+  while (nbytes > 0) {
+    size_t nread = MIN(nbytes,(bigint) sizeof(junk));
+    read_buf(junk,1,nread);
+    nbytes -= nread;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   match label to any of N labels
+   return index of match or -1 if no match
+------------------------------------------------------------------------- */
+
+int ReaderColumnar::find_label(const char *label, int n, char **labels)
+{
+  for (int i = 0; i < n; i++)
+    if (strcmp(label,labels[i]) == 0) return i;
+  return -1;
+}
@@ -0,0 +1,72 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef READER_CLASS
+
+ReaderStyle(columnar,ReaderColumnar)
+
+#else
+
+#ifndef LMP_READER_COLUMNAR_H
+#define LMP_READER_COLUMNAR_H
+
+#include "reader.h"
+
+namespace LAMMPS_NS {
+
+class ReaderColumnar : public Reader {
+ public:
+  ReaderColumnar(class LAMMPS *);
+  ~ReaderColumnar();
+
+  int read_time(bigint &);
+  void skip();
+  bigint read_header(double [3][3], int &, int &, int, int, int *, char **,
+                     int, int, int &, int &, int &, int &);
+  void read_atoms(int, int, double **);
+
+private:
+  int nwords;              // # of per-atom columns in dump file
+  int *fieldindex;         // which column each requested field maps to
+  char *labelstr;          // column labels of current frame
+  bigint file_natoms;      // atom count of current frame
+
+  int nchunks;             // # of data chunks remaining in current frame
+  int nrows;               // # of rows in current decoded chunk
+  int irow;                // next row of current chunk to serve
+  double *coldata;         // current chunk, column-major: nwords x nrows
+  bigint maxcoldata;       // allocated length of coldata
+
+  void read_buf(void *, size_t, size_t);
+  void skip_buf(bigint);
+  void read_box(double [3][3], int &, int &, int &);
+  void read_chunk();
+  int find_label(const char *, int, char **);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Dump file is incorrectly formatted
+
+Self-explanatory.
+
+E: Unexpected end of dump file
+
+A read operation from the file failed.
+
+*/
@@ -141,6 +141,35 @@ int Region::match(double x, double y, double z)
   return !(inside(x,y,z) ^ interior);
 }
 
+/* ----------------------------------------------------------------------
+   batched match() of N points, results stored in flags
+   caller is responsible for invoking prematch() first, as for match()
+   simple static regions override this with a loop that inlines their
+     inside test so the compiler can vectorize it
+------------------------------------------------------------------------- */
+
+void Region::match_all(int n, double **x, int *flags)
+{
+  for (int i = 0; i < n; i++)
+    flags[i] = match(x[i][0],x[i][1],x[i][2]);
+}
+
+/* ----------------------------------------------------------------------
+   conservative test whether region can contain any point of box blo:bhi
+   return 0 only if no point in the box can match the region
+   default: compare against region bounding box when one exists
+   union/intersect override this to recurse into their sub-regions
+------------------------------------------------------------------------- */
+
+int Region::bbox_overlap(double *blo, double *bhi)
+{
+  if (!bboxflag) return 1;
+  if (bhi[0] < extent_xlo || blo[0] > extent_xhi ||
+      bhi[1] < extent_ylo || blo[1] > extent_yhi ||
+      bhi[2] < extent_zlo || blo[2] > extent_zhi) return 0;
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    generate list of contact points for interior or exterior regions
    if region has variable shape, invoke shape_update() once per timestep
@@ -77,7 +77,9 @@ class Region : protected Pointers {
 
   void prematch();
   int match(double, double, double);
+  virtual void match_all(int, double **, int *);
   int surface(double, double, double, double);
+  virtual int bbox_overlap(double *, double *);
 
   virtual void set_velocity();
   void velocity_contact(double *, double *, int);
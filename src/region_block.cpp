@@ -190,6 +190,26 @@ RegBlock::~RegBlock()
   delete [] contact;
 }
 
+/* ----------------------------------------------------------------------
+   batched match() with the inside test inlined so the loop vectorizes
+   fall back to generic version for moving/rotating or open blocks
+------------------------------------------------------------------------- */
+
+void RegBlock::match_all(int n, double **x, int *flags)
+{
+  if (dynamic || openflag) {
+    Region::match_all(n,x,flags);
+    return;
+  }
+
+  for (int i = 0; i < n; i++) {
+    const int ins = (x[i][0] >= xlo) & (x[i][0] <= xhi) &
+      (x[i][1] >= ylo) & (x[i][1] <= yhi) &
+      (x[i][2] >= zlo) & (x[i][2] <= zhi);
+    flags[i] = !(ins ^ interior);
+  }
+}
+
 /* ----------------------------------------------------------------------
    inside = 1 if x,y,z is inside or on surface
    inside = 0 if x,y,z is outside and not on surface
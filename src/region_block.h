@@ -30,6 +30,7 @@ class RegBlock : public Region {
  public:
   RegBlock(class LAMMPS *, int, char **);
   ~RegBlock();
+  void match_all(int, double **, int *);
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
@@ -31,6 +31,7 @@ class RegCylinder : public Region {
   RegCylinder(class LAMMPS *, int, char **);
   ~RegCylinder();
   void init();
+  void match_all(int, double **, int *);
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
@@ -153,6 +153,19 @@ int RegIntersect::inside(double x, double y, double z)
   return 0;
 }
 
+/* ----------------------------------------------------------------------
+   box overlaps the intersection only if it overlaps every sub-region
+------------------------------------------------------------------------- */
+
+int RegIntersect::bbox_overlap(double *blo, double *bhi)
+{
+  if (!interior) return 1;
+  Region **regions = domain->regions;
+  for (int ilist = 0; ilist < nregion; ilist++)
+    if (!regions[list[ilist]]->bbox_overlap(blo,bhi)) return 0;
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    compute contacts with interior of intersection of sub-regions
    (1) compute contacts in each sub-region
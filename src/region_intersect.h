@@ -30,6 +30,7 @@ class RegIntersect : public Region {
   ~RegIntersect();
   void init();
   int inside(double, double, double);
+  int bbox_overlap(double *, double *);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
   void shape_update();
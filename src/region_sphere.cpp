@@ -125,6 +125,29 @@ void RegSphere::init()
   if (varshape) variable_check();
 }
 
+/* ----------------------------------------------------------------------
+   batched match() with the inside test inlined so the loop vectorizes
+   compare squared distances to avoid the sqrt in inside()
+   fall back to generic version for moving or open spheres
+------------------------------------------------------------------------- */
+
+void RegSphere::match_all(int n, double **x, int *flags)
+{
+  if (dynamic || openflag) {
+    Region::match_all(n,x,flags);
+    return;
+  }
+
+  for (int i = 0; i < n; i++) {
+    const double delx = x[i][0] - xc;
+    const double dely = x[i][1] - yc;
+    const double delz = x[i][2] - zc;
+    const int ins =
+      (delx*delx + dely*dely + delz*delz <= radius*radius);
+    flags[i] = !(ins ^ interior);
+  }
+}
+
 /* ----------------------------------------------------------------------
    inside = 1 if x,y,z is inside or on surface
    inside = 0 if x,y,z is outside and not on surface
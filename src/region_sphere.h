@@ -29,6 +29,7 @@ class RegSphere : public Region {
   RegSphere(class LAMMPS *, int, char **);
   ~RegSphere();
   void init();
+  void match_all(int, double **, int *);
   int inside(double, double, double);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
@@ -147,6 +147,21 @@ int RegUnion::inside(double x, double y, double z)
   return 1;
 }
 
+/* ----------------------------------------------------------------------
+   box overlaps the union if it overlaps any sub-region
+   recursing into the sub-regions prunes boxes inside the union's
+   overall bounding box but between its scattered sub-regions
+------------------------------------------------------------------------- */
+
+int RegUnion::bbox_overlap(double *blo, double *bhi)
+{
+  if (!interior) return 1;
+  Region **regions = domain->regions;
+  for (int ilist = 0; ilist < nregion; ilist++)
+    if (regions[list[ilist]]->bbox_overlap(blo,bhi)) return 1;
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    compute contacts with interior of union of sub-regions
    (1) compute contacts in each sub-region
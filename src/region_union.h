@@ -30,6 +30,7 @@ class RegUnion : public Region {
   ~RegUnion();
   void init();
   int inside(double, double, double);
+  int bbox_overlap(double *, double *);
   int surface_interior(double *, double);
   int surface_exterior(double *, double);
   void shape_update();
@@ -58,8 +58,12 @@ void Replicate::command(int narg, char **arg)
   int nrep = nx*ny*nz;
 
   int bbox_flag = 0;
-  if (narg == 4)
+  int dist_flag = 0;
+  if (narg == 4) {
     if (strcmp(arg[3],"bbox") == 0) bbox_flag = 1;
+    else if (strcmp(arg[3],"dist") == 0) dist_flag = 1;
+    else error->all(FLERR,"Illegal replicate command");
+  }
 
   // error and warning checks
 
@@ -332,7 +336,216 @@ void Replicate::command(int narg, char **arg)
   double *coord;
   int tag_enable = atom->tag_enable;
 
-  if (bbox_flag) {
+  if (dist_flag) {
+
+    // distributed scatter:
+    // each proc computes which proc's sub-domain every (replica,atom) pair
+    // of its own atoms lands in and sends each replicated atom only to
+    // its owner, so no proc ever stages more than its own share
+    // of the replicated system
+
+    comm->coord2proc_setup();
+
+    // pack my atoms once, record where each atom's data starts in buf
+
+    n = 0;
+    for (i = 0; i < old->nlocal; i++) n += old_avec->pack_restart(i,&buf[n]);
+
+    int *offset;
+    memory->create(offset,old->nlocal,"replicate:offset");
+    m = 0;
+    for (i = 0; i < old->nlocal; i++) {
+      offset[i] = m;
+      m += static_cast<int> (buf[m]);
+    }
+
+    // first pass: count doubles each proc will receive from me
+    // each record is sent prefixed by one double = its replica index
+
+    int proc,igx,igy,igz;
+    int *sendcount,*sdispl,*recvcount,*rdispl;
+    memory->create(sendcount,nprocs,"replicate:sendcount");
+    memory->create(sdispl,nprocs,"replicate:sdispl");
+    memory->create(recvcount,nprocs,"replicate:recvcount");
+    memory->create(rdispl,nprocs,"replicate:rdispl");
+    for (i = 0; i < nprocs; i++) sendcount[i] = 0;
+
+    for (ix = 0; ix < nx; ix++)
+      for (iy = 0; iy < ny; iy++)
+        for (iz = 0; iz < nz; iz++)
+          for (i = 0; i < old->nlocal; i++) {
+            m = offset[i];
+            image = ((imageint) IMGMAX << IMG2BITS) |
+              ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+            if (triclinic == 0) {
+              x[0] = buf[m+1] + ix*old_xprd;
+              x[1] = buf[m+2] + iy*old_yprd;
+              x[2] = buf[m+3] + iz*old_zprd;
+            } else {
+              x[0] = buf[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
+              x[1] = buf[m+2] + iy*old_yprd + iz*old_yz;
+              x[2] = buf[m+3] + iz*old_zprd;
+            }
+            domain->remap(x,image);
+            if (triclinic) {
+              domain->x2lamda(x,lamda);
+              coord = lamda;
+            } else coord = x;
+            proc = comm->coord2proc(coord,igx,igy,igz);
+            sendcount[proc] += static_cast<int> (buf[m]) + 1;
+          }
+
+    bigint bsend = 0;
+    for (i = 0; i < nprocs; i++) bsend += sendcount[i];
+    if (bsend > MAXSMALLINT)
+      error->one(FLERR,"Replicate dist send buffer is too large for a proc");
+
+    sdispl[0] = 0;
+    for (i = 1; i < nprocs; i++) sdispl[i] = sdispl[i-1] + sendcount[i-1];
+
+    double *sendbuf;
+    memory->create(sendbuf,MAX(static_cast<int> (bsend),1),
+                   "replicate:sendbuf");
+
+    // second pass: copy each replicated record to its destination
+    // sdispl is advanced per record, recomputed below for the Alltoallv
+
+    for (ix = 0; ix < nx; ix++)
+      for (iy = 0; iy < ny; iy++)
+        for (iz = 0; iz < nz; iz++)
+          for (i = 0; i < old->nlocal; i++) {
+            m = offset[i];
+            image = ((imageint) IMGMAX << IMG2BITS) |
+              ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+            if (triclinic == 0) {
+              x[0] = buf[m+1] + ix*old_xprd;
+              x[1] = buf[m+2] + iy*old_yprd;
+              x[2] = buf[m+3] + iz*old_zprd;
+            } else {
+              x[0] = buf[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
+              x[1] = buf[m+2] + iy*old_yprd + iz*old_yz;
+              x[2] = buf[m+3] + iz*old_zprd;
+            }
+            domain->remap(x,image);
+            if (triclinic) {
+              domain->x2lamda(x,lamda);
+              coord = lamda;
+            } else coord = x;
+            proc = comm->coord2proc(coord,igx,igy,igz);
+            int size = static_cast<int> (buf[m]);
+            sendbuf[sdispl[proc]] = ((double) iz*ny + iy)*nx + ix;
+            memcpy(&sendbuf[sdispl[proc]+1],&buf[m],size*sizeof(double));
+            sdispl[proc] += size + 1;
+          }
+
+    sdispl[0] = 0;
+    for (i = 1; i < nprocs; i++) sdispl[i] = sdispl[i-1] + sendcount[i-1];
+
+    // exchange counts, then scatter the records to their owners
+
+    MPI_Alltoall(sendcount,1,MPI_INT,recvcount,1,MPI_INT,world);
+
+    bigint brecv = 0;
+    for (i = 0; i < nprocs; i++) brecv += recvcount[i];
+    if (brecv > MAXSMALLINT)
+      error->one(FLERR,"Replicate dist recv buffer is too large for a proc");
+    int nrecv = static_cast<int> (brecv);
+
+    rdispl[0] = 0;
+    for (i = 1; i < nprocs; i++) rdispl[i] = rdispl[i-1] + recvcount[i-1];
+
+    double *recvbuf;
+    memory->create(recvbuf,MAX(nrecv,1),"replicate:recvbuf");
+
+    MPI_Alltoallv(sendbuf,sendcount,sdispl,MPI_DOUBLE,
+                  recvbuf,recvcount,rdispl,MPI_DOUBLE,world);
+
+    bigint ball;
+    MPI_Allreduce(&bsend,&ball,1,MPI_LMP_BIGINT,MPI_SUM,world);
+    if (me == 0)
+      utils::logmesg(lmp,fmt::format("  distributed replicate comm = "
+                                     "{:.2f} MB avg per proc\n",
+                                     (double)ball*sizeof(double)/
+                                     1024/1024/nprocs));
+
+    memory->destroy(sendbuf);
+    memory->destroy(offset);
+    memory->destroy(sendcount);
+    memory->destroy(sdispl);
+    memory->destroy(recvcount);
+    memory->destroy(rdispl);
+
+    // unpack every received record, all are mine by construction
+
+    m = 0;
+    while (m < nrecv) {
+      int ireplica = static_cast<int> (recvbuf[m++]);
+      ix = ireplica % nx;
+      iy = (ireplica/nx) % ny;
+      iz = ireplica / (nx*ny);
+
+      image = ((imageint) IMGMAX << IMG2BITS) |
+        ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+      if (triclinic == 0) {
+        x[0] = recvbuf[m+1] + ix*old_xprd;
+        x[1] = recvbuf[m+2] + iy*old_yprd;
+        x[2] = recvbuf[m+3] + iz*old_zprd;
+      } else {
+        x[0] = recvbuf[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
+        x[1] = recvbuf[m+2] + iy*old_yprd + iz*old_yz;
+        x[2] = recvbuf[m+3] + iz*old_zprd;
+      }
+      domain->remap(x,image);
+
+      m += avec->unpack_restart(&recvbuf[m]);
+
+      i = atom->nlocal - 1;
+      if (tag_enable)
+        atom_offset = iz*ny*nx*maxtag + iy*nx*maxtag + ix*maxtag;
+      else atom_offset = 0;
+      mol_offset = iz*ny*nx*maxmol + iy*nx*maxmol + ix*maxmol;
+
+      atom->x[i][0] = x[0];
+      atom->x[i][1] = x[1];
+      atom->x[i][2] = x[2];
+
+      atom->tag[i] += atom_offset;
+      atom->image[i] = image;
+
+      if (atom->molecular) {
+        if (atom->molecule[i] > 0)
+          atom->molecule[i] += mol_offset;
+        if (atom->molecular == 1) {
+          if (atom->avec->bonds_allow)
+            for (j = 0; j < atom->num_bond[i]; j++)
+              atom->bond_atom[i][j] += atom_offset;
+          if (atom->avec->angles_allow)
+            for (j = 0; j < atom->num_angle[i]; j++) {
+              atom->angle_atom1[i][j] += atom_offset;
+              atom->angle_atom2[i][j] += atom_offset;
+              atom->angle_atom3[i][j] += atom_offset;
+            }
+          if (atom->avec->dihedrals_allow)
+            for (j = 0; j < atom->num_dihedral[i]; j++) {
+              atom->dihedral_atom1[i][j] += atom_offset;
+              atom->dihedral_atom2[i][j] += atom_offset;
+              atom->dihedral_atom3[i][j] += atom_offset;
+              atom->dihedral_atom4[i][j] += atom_offset;
+            }
+          if (atom->avec->impropers_allow)
+            for (j = 0; j < atom->num_improper[i]; j++) {
+              atom->improper_atom1[i][j] += atom_offset;
+              atom->improper_atom2[i][j] += atom_offset;
+              atom->improper_atom3[i][j] += atom_offset;
+              atom->improper_atom4[i][j] += atom_offset;
+            }
+        }
+      }
+    }
+
+    memory->destroy(recvbuf);
+
+  } else if (bbox_flag) {
 
     // allgather size of buf on each proc
 
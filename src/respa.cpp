@@ -76,6 +76,8 @@ Respa::Respa(LAMMPS *lmp, int narg, char **arg) :
   nhybrid_styles = 0;
   tally_global = 1;
   pair_compute = 1;
+  kspace_every = 1;
+  kspace_hold_counter = 0;
 
   int iarg = nlevels;
   while (iarg < narg) {
@@ -119,6 +121,12 @@ Respa::Respa(LAMMPS *lmp, int narg, char **arg) :
       if (iarg+2 > narg) error->all(FLERR,"Illegal run_style respa command");
       level_kspace = force->inumeric(FLERR,arg[iarg+1]) - 1;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"kspace_every") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal run_style respa command");
+      kspace_every = force->inumeric(FLERR,arg[iarg+1]);
+      if (kspace_every <= 0)
+        error->all(FLERR,"Illegal run_style respa command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"hybrid") == 0) {
       // the hybrid keyword requires a hybrid pair style
       if (!utils::strmatch(force->pair_style,"^hybrid"))
@@ -300,10 +308,15 @@ void Respa::init()
   // create fix needed for storing atom-based respa level forces
   // will delete it at end of run
   // if supported, we also store torques on a per-level basis
+  // if kspace is only evaluated every few steps, also store its held force
+
+  if (kspace_every > 1 && force->kspace == NULL)
+    error->all(FLERR,"Respa kspace_every requires a kspace style");
 
   std::string cmd = fmt::format("RESPA all RESPA {}",nlevels);
-  if (atom->torque_flag) modify->add_fix(cmd + " torque");
-  else modify->add_fix(cmd);
+  if (atom->torque_flag) cmd += " torque";
+  if (kspace_every > 1) cmd += " kspace";
+  modify->add_fix(cmd);
   fix_respa = (FixRespa *) modify->fix[modify->nfix-1];
 
   // insure respa inner/middle/outer is using Pair class that supports it
@@ -448,7 +461,10 @@ void Respa::setup(int flag)
       force->improper->compute(eflag,vflag);
     if (level_kspace == ilevel && force->kspace) {
       force->kspace->setup();
-      if (kspace_compute_flag) force->kspace->compute(eflag,vflag);
+      if (kspace_compute_flag) {
+        if (kspace_every == 1) force->kspace->compute(eflag,vflag);
+        else kspace_eval_hold();
+      }
     }
 
     modify->setup_pre_reverse(eflag,vflag);
@@ -525,7 +541,10 @@ void Respa::setup_minimal(int flag)
       force->improper->compute(eflag,vflag);
     if (level_kspace == ilevel && force->kspace) {
       force->kspace->setup();
-      if (kspace_compute_flag) force->kspace->compute(eflag,vflag);
+      if (kspace_compute_flag) {
+        if (kspace_every == 1) force->kspace->compute(eflag,vflag);
+        else kspace_eval_hold();
+      }
     }
 
     modify->setup_pre_reverse(eflag,vflag);
@@ -718,7 +737,22 @@ void Respa::recurse(int ilevel)
       timer->stamp(Timer::BOND);
     }
     if (level_kspace == ilevel && kspace_compute_flag) {
-      force->kspace->compute(eflag,vflag);
+      if (kspace_every == 1) force->kspace->compute(eflag,vflag);
+      else if (kspace_hold_counter == 0 || eflag || vflag) kspace_eval_hold();
+      else {
+
+        // re-apply the held kspace force from the last evaluation
+
+        double **f = atom->f;
+        double **f_kspace = fix_respa->f_kspace;
+        int nlocal = atom->nlocal;
+        for (int i = 0; i < nlocal; i++) {
+          f[i][0] += f_kspace[i][0];
+          f[i][1] += f_kspace[i][1];
+          f[i][2] += f_kspace[i][2];
+        }
+        kspace_hold_counter--;
+      }
       timer->stamp(Timer::KSPACE);
     }
 
@@ -741,6 +775,35 @@ void Respa::recurse(int ilevel)
   copy_f_flevel(ilevel);
 }
 
+/* ----------------------------------------------------------------------
+   evaluate kspace and capture its per-atom force contribution,
+   so the next kspace_every-1 steps at this level can re-apply it
+   without a solve
+------------------------------------------------------------------------- */
+
+void Respa::kspace_eval_hold()
+{
+  double **f = atom->f;
+  double **f_kspace = fix_respa->f_kspace;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    f_kspace[i][0] = -f[i][0];
+    f_kspace[i][1] = -f[i][1];
+    f_kspace[i][2] = -f[i][2];
+  }
+
+  force->kspace->compute(eflag,vflag);
+
+  for (int i = 0; i < nlocal; i++) {
+    f_kspace[i][0] += f[i][0];
+    f_kspace[i][1] += f[i][1];
+    f_kspace[i][2] += f[i][2];
+  }
+
+  kspace_hold_counter = kspace_every - 1;
+}
+
 /* ----------------------------------------------------------------------
    clear force on own & ghost atoms
    clear other arrays as needed
@@ -44,6 +44,7 @@ class Respa : public Integrate {
   int *hybrid_compute;    // selects whether to compute sub-style forces
   int tally_global;       // 1 if pair style should tally global accumulators
   int pair_compute;       // 1 if pair force need to be computed
+  int kspace_every;       // evaluate kspace every this many steps at its level
 
   Respa(class LAMMPS *, int, char **);
   virtual ~Respa();
@@ -63,8 +64,10 @@ class Respa : public Integrate {
 
   int *newton;                      // newton flag at each level
   class FixRespa *fix_respa;        // Fix to store the force level array
+  int kspace_hold_counter;          // kspace-level steps until next evaluation
 
   virtual void recurse(int);
+  void kspace_eval_hold();
   void force_clear(int);
   void sum_flevel_f();
   void set_compute_flags(int ilevel);
@@ -79,6 +79,7 @@ void Run::command(int narg, char **arg)
       if (iarg+2 > narg) error->all(FLERR,"Illegal run command");
       if (strcmp(arg[iarg+1],"no") == 0) preflag = 0;
       else if (strcmp(arg[iarg+1],"yes") == 0) preflag = 1;
+      else if (strcmp(arg[iarg+1],"auto") == 0) preflag = -1;
       else error->all(FLERR,"Illegal run command");
       iarg += 2;
     } else if (strcmp(arg[iarg],"post") == 0) {
@@ -136,6 +137,22 @@ void Run::command(int narg, char **arg)
   if (!preflag && strstr(update->integrate_style,"respa"))
     error->all(FLERR,"Run flag 'pre no' not compatible with r-RESPA");
 
+  // pre auto = verified warm start:
+  // skip setup like "pre no" only when no command since the end of the
+  // previous run could have modified the system, else do the full setup
+  // re-resolved before every iteration of a multi-run, since the
+  // interleaved commands may modify the system
+  // r-RESPA always needs the full setup
+
+  int autopre = 0;
+  if (preflag < 0) {
+    if (strstr(update->integrate_style,"respa")) preflag = 1;
+    else {
+      autopre = 1;
+      preflag = (update->first_update == 0 || update->setup_dirty);
+    }
+  }
+
   // if nevery, make copies of arg strings that are commands
   // required because re-parsing commands via input->one() will wipe out args
 
@@ -183,6 +200,7 @@ void Run::command(int narg, char **arg)
     timer->barrier_stop();
 
     update->integrate->cleanup();
+    update->setup_dirty = 0;
 
     Finish finish(lmp);
     finish.end(postflag);
@@ -213,6 +231,8 @@ void Run::command(int narg, char **arg)
       if (stopflag) update->endstep = stop;
       else update->endstep = update->laststep;
 
+      if (autopre && iter > 0) preflag = update->setup_dirty;
+
       if (preflag || iter == 0) {
         lmp->init();
         update->integrate->setup(1);
@@ -224,6 +244,7 @@ void Run::command(int narg, char **arg)
       timer->barrier_stop();
 
       update->integrate->cleanup();
+      update->setup_dirty = 0;
 
       Finish finish(lmp);
       if (postflag || nleft <= nsteps) finish.end(1);
@@ -80,6 +80,7 @@ void Set::command(int narg, char **arg)
   id = new char[n];
   strcpy(id,arg[1]);
   select = NULL;
+  topo_init_flag = 0;
   selection(atom->nlocal);
 
   // loop over keyword/value pairs
@@ -87,7 +88,15 @@ void Set::command(int narg, char **arg)
 
   if (comm->me == 0) utils::logmesg(lmp,"Setting atom values ...\n");
 
-  int allcount,origarg;
+  // counts of settings made per keyword are accumulated locally
+  // and summed with a single allreduce after all keywords are applied
+
+  int naction = 0;
+  int *counts,*origargs;
+  memory->create(counts,narg,"set:counts");
+  memory->create(origargs,narg,"set:origargs");
+
+  int origarg;
 
   int iarg = 2;
   while (iarg < narg) {
@@ -642,23 +651,37 @@ void Set::command(int narg, char **arg)
 
     } else error->all(FLERR,"Illegal set command");
 
-    // statistics
-    // for CC option, include species index
+    // save local count for deferred statistics
+
+    counts[naction] = count;
+    origargs[naction] = origarg;
+    naction++;
+  }
 
-    MPI_Allreduce(&count,&allcount,1,MPI_INT,MPI_SUM,world);
+  // statistics, one allreduce for all keywords
+  // for CC option, include species index
 
-    if (comm->me == 0) {
+  int *allcounts;
+  memory->create(allcounts,naction,"set:allcounts");
+  MPI_Allreduce(counts,allcounts,naction,MPI_INT,MPI_SUM,world);
+
+  if (comm->me == 0) {
+    for (int m = 0; m < naction; m++) {
+      origarg = origargs[m];
       if (strcmp(arg[origarg],"cc") == 0)
         utils::logmesg(lmp,fmt::format("  {} settings made for {} index {}\n",
-                       allcount,arg[origarg],arg[origarg+1]));
+                       allcounts[m],arg[origarg],arg[origarg+1]));
       else
         utils::logmesg(lmp,fmt::format("  {} settings made for {}\n",
-                       allcount,arg[origarg]));
+                       allcounts[m],arg[origarg]));
     }
   }
 
   // free local memory
 
+  memory->destroy(counts);
+  memory->destroy(origargs);
+  memory->destroy(allcounts);
   delete [] id;
   delete [] select;
 }
@@ -734,6 +757,10 @@ void Set::selection(int n)
 
 void Set::set(int keyword)
 {
+  // atom properties may change: force topology() to redo ghosts/selection
+
+  topo_init_flag = 0;
+
   // evaluate atom-style variable(s) if necessary
 
   vec1 = vec2 = vec3 = vec4 = NULL;
@@ -1029,6 +1056,8 @@ void Set::set(int keyword)
     else if (keyword == SH_TYPE) {
 
       auto *avec_shperatom = (AtomVecShperatom *) atom->style_match("shperatom");
+      if (!avec_shperatom)
+        avec_shperatom = (AtomVecShperatom *) atom->style_match("shfewnc");
       int nshtypes = avec_shperatom->num_sh_types();
       if (ivalue <= 0 || ivalue > nshtypes)
         error->one(FLERR,"Invalid value in set command");
@@ -1086,6 +1115,10 @@ void Set::set(int keyword)
 
 void Set::setrandom(int keyword)
 {
+  // atom properties may change: force topology() to redo ghosts/selection
+
+  topo_init_flag = 0;
+
   int i;
 
   AtomVecEllipsoid *avec_ellipsoid =
@@ -1379,21 +1412,25 @@ void Set::topology(int keyword)
   // enforce PBC before in case atoms are outside box
   // init entire system since comm->exchange is done
   // comm::init needs neighbor::init needs pair::init needs kspace::init, etc
-
-  if (comm->me == 0) utils::logmesg(lmp,"  system init for set ...\n");
-  lmp->init();
-
-  if (domain->triclinic) domain->x2lamda(atom->nlocal);
-  domain->pbc();
-  domain->reset_box();
-  comm->setup();
-  comm->exchange();
-  comm->borders();
-  if (domain->triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
-
-  // select both owned and ghost atoms
-
-  selection(atom->nlocal + atom->nghost);
+  // then select both owned and ghost atoms
+  // all of this is reused by consecutive topology keywords, since only
+  //   bond/angle/etc types change between them, not atoms or positions
+
+  if (!topo_init_flag) {
+    if (comm->me == 0) utils::logmesg(lmp,"  system init for set ...\n");
+    lmp->init();
+
+    if (domain->triclinic) domain->x2lamda(atom->nlocal);
+    domain->pbc();
+    domain->reset_box();
+    comm->setup();
+    comm->exchange();
+    comm->borders();
+    if (domain->triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
+
+    selection(atom->nlocal + atom->nghost);
+    topo_init_flag = 1;
+  }
 
   // for BOND, each of 2 atoms must be in group
 
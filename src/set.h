@@ -38,6 +38,9 @@ class Set : protected Pointers {
   bigint nsubset;
   double dvalue,xvalue,yvalue,zvalue,wvalue,fraction;
 
+  int topo_init_flag;      // 1 if ghost info + selection are current
+                           //   across consecutive topology keywords
+
   int varflag,varflag1,varflag2,varflag3,varflag4;
   int ivar1,ivar2,ivar3,ivar4;
   double *vec1,*vec2,*vec3,*vec4;
@@ -79,6 +79,10 @@ enum{SCALAR,VECTOR,ARRAY};
 
 #define DELTA 8
 
+// max snapshots buffered for the async writer before producer blocks
+
+#define ASYNC_MAXQUEUE 1024
+
 /* ---------------------------------------------------------------------- */
 
 Thermo::Thermo(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
@@ -97,6 +101,10 @@ Thermo::Thermo(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   lostflag = lostbond = Thermo::ERROR;
   lostbefore = 0;
   flushflag = 0;
+  cacheflag = 0;
+  asyncflag = 0;
+  writer = NULL;
+  async_busy = async_exit = 0;
 
   // set style and corresponding lineflag
   // custom style builds its own line of keywords, including wildcard expansion
@@ -189,6 +197,8 @@ Thermo::Thermo(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
 
 Thermo::~Thermo()
 {
+  async_stop();
+
   delete [] style;
   delete [] line;
 
@@ -208,6 +218,10 @@ void Thermo::init()
 {
   int i,n;
 
+  // discard cached fields, formats or box may have changed since last run
+
+  cache_clear();
+
   // set normvalue to default setting unless user has specified it
 
   if (normuserflag) normvalue = normuser;
@@ -219,7 +233,7 @@ void Thermo::init()
 
   nfield = nfield_initial;
   if (domain->box_change && strcmp(style,"custom") != 0)
-    addfield("Volume",&Thermo::compute_vol,FLOAT);
+    addfield("Volume",&Thermo::compute_vol,FLOAT,BOXDIM);
 
   // set format string for each field
   // include keyword if lineflag = MULTILINE
@@ -312,6 +326,8 @@ void Thermo::init()
 
 void Thermo::header()
 {
+  wait_async();
+
   if (lineflag == MULTILINE) return;
 
   std::string hdr;
@@ -338,7 +354,11 @@ void Thermo::compute(int flag)
 
   // invoke Compute methods needed for thermo keywords
 
-  for (i = 0; i < ncompute; i++)
+  const int detailflag = timer->has_detail();
+  double tstart = 0.0;
+
+  for (i = 0; i < ncompute; i++) {
+    if (detailflag) tstart = MPI_Wtime();
     if (compute_which[i] == SCALAR) {
       if (!(computes[i]->invoked_flag & INVOKED_SCALAR)) {
         computes[i]->compute_scalar();
@@ -355,6 +375,41 @@ void Thermo::compute(int flag)
         computes[i]->invoked_flag |= INVOKED_ARRAY;
       }
     }
+    if (detailflag) computes[i]->time_detail += MPI_Wtime() - tstart;
+  }
+
+  // async mode: evaluate fields on all procs (some involve collectives),
+  // snapshot the typed values on proc 0 and let the writer thread do the
+  // formatting and file I/O off the timestepping critical path
+
+  if (asyncflag) {
+    ThermoSnap snap;
+    snap.ntimestep = ntimestep;
+    if (flag) snap.cpu = timer->elapsed(Timer::TOTAL);
+    else snap.cpu = 0.0;
+    snap.ivals.resize(nfield);
+    snap.dvals.resize(nfield);
+    snap.bvals.resize(nfield);
+
+    for (ifield = 0; ifield < nfield; ifield++) {
+      (this->*vfunc[ifield])();
+      if (vtype[ifield] == FLOAT) snap.dvals[ifield] = dvalue;
+      else if (vtype[ifield] == INT) snap.ivals[ifield] = ivalue;
+      else snap.bvals[ifield] = bivalue;
+    }
+
+    if (me == 0) {
+      if (!writer) async_start();
+      std::unique_lock<std::mutex> lock(async_mutex);
+      while ((int) async_queue.size() >= ASYNC_MAXQUEUE)
+        async_cond.wait(lock);
+      async_queue.push_back(snap);
+      async_cond.notify_all();
+    }
+
+    firststep = 1;
+    return;
+  }
 
   // if lineflag = MULTILINE, prepend step/cpu header line
 
@@ -367,15 +422,50 @@ void Thermo::compute(int flag)
   }
 
   // add each thermo value to line with its specific format
+  // if caching enabled, skip recompute of a field that depends only on
+  //   box geometry when the box cannot change during this run,
+  //   and skip reformat of any field whose value did not change
 
   for (ifield = 0; ifield < nfield; ifield++) {
+
+    if (cacheflag && cache_len[ifield] >= 0 &&
+        vdepend[ifield] == BOXDIM && domain->box_change == 0) {
+      memcpy(&line[loc],cache_str[ifield],cache_len[ifield]+1);
+      loc += cache_len[ifield];
+      continue;
+    }
+
     (this->*vfunc[ifield])();
+
+    int same = 0;
+    if (cacheflag && cache_len[ifield] >= 0) {
+      if (vtype[ifield] == FLOAT) same = (dvalue == cache_dvalue[ifield]);
+      else if (vtype[ifield] == INT) same = (ivalue == cache_bvalue[ifield]);
+      else same = (bivalue == cache_bvalue[ifield]);
+    }
+
+    if (same) {
+      memcpy(&line[loc],cache_str[ifield],cache_len[ifield]+1);
+      loc += cache_len[ifield];
+      continue;
+    }
+
+    int nchunk;
     if (vtype[ifield] == FLOAT)
-      loc += sprintf(&line[loc],format[ifield],dvalue);
+      nchunk = sprintf(&line[loc],format[ifield],dvalue);
     else if (vtype[ifield] == INT)
-      loc += sprintf(&line[loc],format[ifield],ivalue);
-    else if (vtype[ifield] == BIGINT)
-      loc += sprintf(&line[loc],format[ifield],bivalue);
+      nchunk = sprintf(&line[loc],format[ifield],ivalue);
+    else
+      nchunk = sprintf(&line[loc],format[ifield],bivalue);
+
+    if (cacheflag && nchunk < 64) {
+      memcpy(cache_str[ifield],&line[loc],nchunk+1);
+      cache_len[ifield] = nchunk;
+      if (vtype[ifield] == FLOAT) cache_dvalue[ifield] = dvalue;
+      else if (vtype[ifield] == INT) cache_bvalue[ifield] = ivalue;
+      else cache_bvalue[ifield] = bivalue;
+    } else cache_len[ifield] = -1;
+    loc += nchunk;
   }
 
   // print line to screen and logfile
@@ -401,6 +491,91 @@ void Thermo::call_vfunc(int ifield_in)
   (this->*vfunc[ifield])();
 }
 
+/* ----------------------------------------------------------------------
+   async writer thread: format queued snapshots and write them to the
+   screen and logfile, preserving submission order
+   makes no MPI calls, so any MPI thread support level is sufficient
+------------------------------------------------------------------------- */
+
+void Thermo::writer_main()
+{
+  int n = nfield*64 + 256;
+  char *buf = new char[n];
+
+  std::unique_lock<std::mutex> lock(async_mutex);
+  while (1) {
+    while (async_queue.empty() && !async_exit) async_cond.wait(lock);
+    if (async_queue.empty()) break;
+    ThermoSnap snap = async_queue.front();
+    async_queue.pop_front();
+    async_busy = 1;
+    lock.unlock();
+
+    int loc = 0;
+    if (lineflag == MULTILINE)
+      loc = sprintf(&buf[loc],format_multi,snap.ntimestep,snap.cpu);
+    for (int i = 0; i < nfield; i++) {
+      if (vtype[i] == FLOAT)
+        loc += sprintf(&buf[loc],format[i],snap.dvals[i]);
+      else if (vtype[i] == INT)
+        loc += sprintf(&buf[loc],format[i],snap.ivals[i]);
+      else
+        loc += sprintf(&buf[loc],format[i],snap.bvals[i]);
+    }
+
+    if (screen) fputs(buf,screen);
+    if (logfile) {
+      fputs(buf,logfile);
+      if (flushflag) fflush(logfile);
+    }
+
+    lock.lock();
+    async_busy = 0;
+    async_cond.notify_all();
+  }
+
+  delete [] buf;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Thermo::async_start()
+{
+  async_exit = 0;
+  writer = new std::thread(&Thermo::writer_main,this);
+}
+
+/* ----------------------------------------------------------------------
+   drain the queue and join the writer thread
+------------------------------------------------------------------------- */
+
+void Thermo::async_stop()
+{
+  if (!writer) return;
+  {
+    std::unique_lock<std::mutex> lock(async_mutex);
+    async_exit = 1;
+    async_cond.notify_all();
+  }
+  writer->join();
+  delete writer;
+  writer = NULL;
+  async_exit = 0;
+}
+
+/* ----------------------------------------------------------------------
+   block until all queued lines have been written
+   called wherever output ordering must be guaranteed,
+   e.g. before the run-end timing summary or the next run's header
+------------------------------------------------------------------------- */
+
+void Thermo::wait_async()
+{
+  if (!writer) return;
+  std::unique_lock<std::mutex> lock(async_mutex);
+  while (!async_queue.empty() || async_busy) async_cond.wait(lock);
+}
+
 /* ----------------------------------------------------------------------
    check for lost atoms, return current number of atoms
 ------------------------------------------------------------------------- */
@@ -449,6 +624,8 @@ void Thermo::modify_params(int narg, char **arg)
 {
   if (narg == 0) error->all(FLERR,"Illegal thermo_modify command");
 
+  wait_async();
+
   modified = 1;
 
   int iarg = 0;
@@ -549,6 +726,23 @@ void Thermo::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal thermo_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal thermo_modify command");
+      if (strcmp(arg[iarg+1],"no") == 0) {
+        async_stop();
+        asyncflag = 0;
+      } else if (strcmp(arg[iarg+1],"yes") == 0) asyncflag = 1;
+      else error->all(FLERR,"Illegal thermo_modify command");
+      iarg += 2;
+
+    } else if (strcmp(arg[iarg],"cache") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal thermo_modify command");
+      if (strcmp(arg[iarg+1],"no") == 0) cacheflag = 0;
+      else if (strcmp(arg[iarg+1],"yes") == 0) cacheflag = 1;
+      else error->all(FLERR,"Illegal thermo_modify command");
+      cache_clear();
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"line") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal thermo_modify command");
       if (strcmp(arg[iarg+1],"one") == 0) lineflag = ONELINE;
@@ -636,6 +830,16 @@ void Thermo::allocate()
   for (int i = 0; i < n; i++) keyword[i] = NULL;
   vfunc = new FnPtr[n];
   vtype = new int[n];
+  vdepend = new int[n];
+
+  // cached chunks sized to the 64-char per-arg max assumed for line
+
+  cache_dvalue = new double[n];
+  cache_bvalue = new bigint[n];
+  cache_str = new char*[n];
+  for (int i = 0; i < n; i++) cache_str[i] = new char[64];
+  cache_len = new int[n];
+  for (int i = 0; i < n; i++) cache_len[i] = -1;
 
   format = new char*[n];
   for (int i = 0; i < n; i++) format[i] = new char[32];
@@ -674,6 +878,13 @@ void Thermo::deallocate()
   delete [] keyword;
   delete [] vfunc;
   delete [] vtype;
+  delete [] vdepend;
+
+  delete [] cache_dvalue;
+  delete [] cache_bvalue;
+  for (int i = 0; i < n; i++) delete [] cache_str[i];
+  delete [] cache_str;
+  delete [] cache_len;
 
   for (int i = 0; i < n; i++) delete [] format[i];
   delete [] format;
@@ -698,6 +909,16 @@ void Thermo::deallocate()
   delete [] variables;
 }
 
+/* ----------------------------------------------------------------------
+   invalidate all cached formatted fields
+------------------------------------------------------------------------- */
+
+void Thermo::cache_clear()
+{
+  int n = nfield_initial + 1;
+  for (int i = 0; i < n; i++) cache_len[i] = -1;
+}
+
 /* ----------------------------------------------------------------------
    parse list of thermo keywords from str
    set compute flags (temp, press, pe, etc)
@@ -791,42 +1012,42 @@ void Thermo::parse_fields(char *str)
       index_pe = add_compute(id_pe,SCALAR);
 
     } else if (strcmp(word,"vol") == 0) {
-      addfield("Volume",&Thermo::compute_vol,FLOAT);
+      addfield("Volume",&Thermo::compute_vol,FLOAT,BOXDIM);
     } else if (strcmp(word,"density") == 0) {
       addfield("Density",&Thermo::compute_density,FLOAT);
     } else if (strcmp(word,"lx") == 0) {
-      addfield("Lx",&Thermo::compute_lx,FLOAT);
+      addfield("Lx",&Thermo::compute_lx,FLOAT,BOXDIM);
     } else if (strcmp(word,"ly") == 0) {
-      addfield("Ly",&Thermo::compute_ly,FLOAT);
+      addfield("Ly",&Thermo::compute_ly,FLOAT,BOXDIM);
     } else if (strcmp(word,"lz") == 0) {
-      addfield("Lz",&Thermo::compute_lz,FLOAT);
+      addfield("Lz",&Thermo::compute_lz,FLOAT,BOXDIM);
 
     } else if (strcmp(word,"xlo") == 0) {
-      addfield("Xlo",&Thermo::compute_xlo,FLOAT);
+      addfield("Xlo",&Thermo::compute_xlo,FLOAT,BOXDIM);
     } else if (strcmp(word,"xhi") == 0) {
-      addfield("Xhi",&Thermo::compute_xhi,FLOAT);
+      addfield("Xhi",&Thermo::compute_xhi,FLOAT,BOXDIM);
     } else if (strcmp(word,"ylo") == 0) {
-      addfield("Ylo",&Thermo::compute_ylo,FLOAT);
+      addfield("Ylo",&Thermo::compute_ylo,FLOAT,BOXDIM);
     } else if (strcmp(word,"yhi") == 0) {
-      addfield("Yhi",&Thermo::compute_yhi,FLOAT);
+      addfield("Yhi",&Thermo::compute_yhi,FLOAT,BOXDIM);
     } else if (strcmp(word,"zlo") == 0) {
-      addfield("Zlo",&Thermo::compute_zlo,FLOAT);
+      addfield("Zlo",&Thermo::compute_zlo,FLOAT,BOXDIM);
     } else if (strcmp(word,"zhi") == 0) {
-      addfield("Zhi",&Thermo::compute_zhi,FLOAT);
+      addfield("Zhi",&Thermo::compute_zhi,FLOAT,BOXDIM);
 
     } else if (strcmp(word,"xy") == 0) {
-      addfield("Xy",&Thermo::compute_xy,FLOAT);
+      addfield("Xy",&Thermo::compute_xy,FLOAT,BOXDIM);
     } else if (strcmp(word,"xz") == 0) {
-      addfield("Xz",&Thermo::compute_xz,FLOAT);
+      addfield("Xz",&Thermo::compute_xz,FLOAT,BOXDIM);
     } else if (strcmp(word,"yz") == 0) {
-      addfield("Yz",&Thermo::compute_yz,FLOAT);
+      addfield("Yz",&Thermo::compute_yz,FLOAT,BOXDIM);
 
     } else if (strcmp(word,"xlat") == 0) {
-      addfield("Xlat",&Thermo::compute_xlat,FLOAT);
+      addfield("Xlat",&Thermo::compute_xlat,FLOAT,BOXDIM);
     } else if (strcmp(word,"ylat") == 0) {
-      addfield("Ylat",&Thermo::compute_ylat,FLOAT);
+      addfield("Ylat",&Thermo::compute_ylat,FLOAT,BOXDIM);
     } else if (strcmp(word,"zlat") == 0) {
-      addfield("Zlat",&Thermo::compute_zlat,FLOAT);
+      addfield("Zlat",&Thermo::compute_zlat,FLOAT,BOXDIM);
 
     } else if (strcmp(word,"bonds") == 0) {
       addfield("Bonds",&Thermo::compute_bonds,BIGINT);
@@ -867,17 +1088,17 @@ void Thermo::parse_fields(char *str)
       addfield("Ndanger",&Thermo::compute_ndanger,BIGINT);
 
     } else if (strcmp(word,"cella") == 0) {
-      addfield("Cella",&Thermo::compute_cella,FLOAT);
+      addfield("Cella",&Thermo::compute_cella,FLOAT,BOXDIM);
     } else if (strcmp(word,"cellb") == 0) {
-      addfield("Cellb",&Thermo::compute_cellb,FLOAT);
+      addfield("Cellb",&Thermo::compute_cellb,FLOAT,BOXDIM);
     } else if (strcmp(word,"cellc") == 0) {
-      addfield("Cellc",&Thermo::compute_cellc,FLOAT);
+      addfield("Cellc",&Thermo::compute_cellc,FLOAT,BOXDIM);
     } else if (strcmp(word,"cellalpha") == 0) {
-      addfield("CellAlpha",&Thermo::compute_cellalpha,FLOAT);
+      addfield("CellAlpha",&Thermo::compute_cellalpha,FLOAT,BOXDIM);
     } else if (strcmp(word,"cellbeta") == 0) {
-      addfield("CellBeta",&Thermo::compute_cellbeta,FLOAT);
+      addfield("CellBeta",&Thermo::compute_cellbeta,FLOAT,BOXDIM);
     } else if (strcmp(word,"cellgamma") == 0) {
-      addfield("CellGamma",&Thermo::compute_cellgamma,FLOAT);
+      addfield("CellGamma",&Thermo::compute_cellgamma,FLOAT,BOXDIM);
 
     // compute value = c_ID, fix value = f_ID, variable value = v_ID
     // count trailing [] and store int arguments
@@ -990,7 +1211,7 @@ void Thermo::parse_fields(char *str)
    add field to list of quantities to print
 ------------------------------------------------------------------------- */
 
-void Thermo::addfield(const char *key, FnPtr func, int typeflag)
+void Thermo::addfield(const char *key, FnPtr func, int typeflag, int depend)
 {
   int n = strlen(key) + 1;
   delete[] keyword[nfield];
@@ -998,6 +1219,7 @@ void Thermo::addfield(const char *key, FnPtr func, int typeflag)
   strcpy(keyword[nfield],key);
   vfunc[nfield] = func;
   vtype[nfield] = typeflag;
+  vdepend[nfield] = depend;
   nfield++;
 }
 
@@ -15,6 +15,11 @@
 #define LMP_THERMO_H
 
 #include "pointers.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace LAMMPS_NS {
 
@@ -39,12 +44,16 @@ class Thermo : protected Pointers {
   void modify_params(int, char **);
   void header();
   void compute(int);
+  void wait_async();
   int evaluate_keyword(const char *, double *);
 
  private:
+  enum {DYNAMIC,BOXDIM};       // what a field value depends on, for caching
+
   char *line;
   char **keyword;
   int *vtype;
+  int *vdepend;                // DYNAMIC or BOXDIM per field
 
   int nfield,nfield_initial;
   int me;
@@ -67,6 +76,33 @@ class Thermo : protected Pointers {
   int lostbefore;
   int flushflag,lineflag;
 
+  int cacheflag;               // 1 if reusing unchanged column values
+
+  int asyncflag;               // 1 if formatting/writing moved off-step
+
+  // snapshot of one line's values, handed to the writer thread
+  // per-field slot used depends on vtype
+
+  struct ThermoSnap {
+    bigint ntimestep;
+    double cpu;
+    std::vector<int> ivals;
+    std::vector<double> dvals;
+    std::vector<bigint> bvals;
+  };
+
+  std::thread *writer;         // async writer thread, NULL when not running
+  std::mutex async_mutex;
+  std::condition_variable async_cond;
+  std::deque<ThermoSnap> async_queue;
+  int async_busy;              // 1 while writer formats a popped snapshot
+  int async_exit;              // tells the writer to drain and return
+
+  double *cache_dvalue;        // last formatted value per field (FLOAT)
+  bigint *cache_bvalue;        // last formatted value per field (INT/BIGINT)
+  char **cache_str;            // last formatted chunk per field
+  int *cache_len;              // length of cached chunk, -1 if not reusable
+
   double last_tpcpu,last_spcpu;
   double last_time;
   bigint last_step;
@@ -107,6 +143,11 @@ class Thermo : protected Pointers {
 
   void allocate();
   void deallocate();
+  void cache_clear();
+
+  void writer_main();
+  void async_start();
+  void async_stop();
 
   void parse_fields(char *);
   int add_compute(const char *, int);
@@ -114,7 +155,7 @@ class Thermo : protected Pointers {
   int add_variable(const char *);
 
   typedef void (Thermo::*FnPtr)();
-  void addfield(const char *, FnPtr, int);
+  void addfield(const char *, FnPtr, int, int = DYNAMIC);
   FnPtr *vfunc;                // list of ptrs to functions
   void call_vfunc(int ifield);
 
@@ -18,6 +18,7 @@
 #include "comm.h"
 #include "error.h"
 #include "force.h"
+#include "memory.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -29,6 +30,12 @@
 
 #include <ctime>
 
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 // convert a timespec ([[HH:]MM:]SS) to seconds
@@ -94,6 +101,14 @@ Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
 {
   _level = NORMAL;
   _sync  = OFF;
+  _detail = 0;
+  _perf = 0;
+  for (int i = 0; i < NUM_COUNTER; i++) perf_fd[i] = -1;
+  _trace = 0;
+  tracefile = NULL;
+  ntrace = maxtrace = 0;
+  trace_start = trace_stop = NULL;
+  trace_which = NULL;
   _timeout = -1;
   _s_timeout = -1;
   _checkfreq = 10;
@@ -103,12 +118,26 @@ Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
 
 /* ---------------------------------------------------------------------- */
 
+Timer::~Timer()
+{
+  if (_trace) trace_flush();
+  delete [] tracefile;
+  memory->destroy(trace_start);
+  memory->destroy(trace_stop);
+  memory->destroy(trace_which);
+  perf_close();
+}
+
+/* ---------------------------------------------------------------------- */
+
 void Timer::init()
 {
   for (int i = 0; i < NUM_TIMER; i++) {
     cpu_array[i] = 0.0;
     wall_array[i] = 0.0;
+    for (int j = 0; j < NUM_COUNTER; j++) counter_array[i][j] = 0.0;
   }
+  for (int j = 0; j < NUM_COUNTER; j++) previous_counter[j] = 0.0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -116,9 +145,11 @@ void Timer::init()
 void Timer::_stamp(enum ttype which)
 {
   double current_cpu=0.0, current_wall=0.0;
+  double current_counter[NUM_COUNTER];
 
   if (_level > NORMAL) current_cpu = CPU_Time();
   current_wall = MPI_Wtime();
+  if (_perf) perf_read(current_counter);
 
   if ((which > TOTAL) && (which < NUM_TIMER)) {
     const double delta_cpu = current_cpu - previous_cpu;
@@ -128,10 +159,22 @@ void Timer::_stamp(enum ttype which)
     wall_array[which] += delta_wall;
     cpu_array[ALL]    += delta_cpu;
     wall_array[ALL]   += delta_wall;
+
+    if (_trace) trace_record(which,previous_wall,current_wall);
+
+    if (_perf)
+      for (int i = 0; i < NUM_COUNTER; i++) {
+        const double delta = current_counter[i] - previous_counter[i];
+        counter_array[which][i] += delta;
+        counter_array[ALL][i]   += delta;
+      }
   }
 
   previous_cpu  = current_cpu;
   previous_wall = current_wall;
+  if (_perf)
+    for (int i = 0; i < NUM_COUNTER; i++)
+      previous_counter[i] = current_counter[i];
 
   if (which == RESET) {
     this->init();
@@ -146,8 +189,10 @@ void Timer::_stamp(enum ttype which)
 
     cpu_array[SYNC]  += current_cpu - previous_cpu;
     wall_array[SYNC] += current_wall - previous_wall;
+    if (_trace) trace_record(SYNC,previous_wall,current_wall);
     previous_cpu  = current_cpu;
     previous_wall = current_wall;
+    if (_perf) perf_read(previous_counter);
   }
 }
 
@@ -271,12 +316,135 @@ double Timer::get_timeout_remain()
   return (_timeout < 0.0) ? 0.0 : _timeout + timeout_start - MPI_Wtime();
 }
 
+/* ----------------------------------------------------------------------
+   open one perf_event fd per hardware counter for the calling process
+   counters that the kernel or hardware do not support stay at fd = -1
+   and are reported as unavailable; if even the cycle counter cannot be
+   opened the perf option is disabled with a warning
+------------------------------------------------------------------------- */
+
+void Timer::perf_open()
+{
+#if defined(__linux__)
+  static const unsigned long long cnt_config[NUM_COUNTER] =
+    { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_HW_STALLED_CYCLES_BACKEND };
+
+  struct perf_event_attr attr;
+
+  for (int i = 0; i < NUM_COUNTER; i++) {
+    if (perf_fd[i] >= 0) continue;
+    memset(&attr,0,sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = cnt_config[i];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    perf_fd[i] = syscall(__NR_perf_event_open,&attr,0,-1,-1,0);
+  }
+
+  if (perf_fd[CNT_CYCLES] < 0) {
+    perf_close();
+    _perf = 0;
+    if (comm->me == 0)
+      error->warning(FLERR,"Cannot open hardware performance counters, "
+                     "disabling the timer perf option");
+  }
+#else
+  _perf = 0;
+  if (comm->me == 0)
+    error->warning(FLERR,"The timer perf option requires Linux perf_event "
+                   "support, disabling it");
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Timer::perf_close()
+{
+#if defined(__linux__)
+  for (int i = 0; i < NUM_COUNTER; i++) {
+    if (perf_fd[i] >= 0) close(perf_fd[i]);
+    perf_fd[i] = -1;
+  }
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   read current value of all open hardware counters
+   unavailable counters read as 0, so their deltas stay 0
+------------------------------------------------------------------------- */
+
+void Timer::perf_read(double *current)
+{
+  for (int i = 0; i < NUM_COUNTER; i++) {
+    current[i] = 0.0;
+#if defined(__linux__)
+    unsigned long long value;
+    if (perf_fd[i] >= 0)
+      if (read(perf_fd[i],&value,sizeof(value)) == sizeof(value))
+        current[i] = (double) value;
+#endif
+  }
+}
+
+/* ----------------------------------------------------------------------
+   append one [start,stop] slice for a timer category to the trace buffer
+------------------------------------------------------------------------- */
+
+void Timer::trace_record(enum ttype which, double start, double stop)
+{
+  if (ntrace == maxtrace) {
+    maxtrace = maxtrace ? 2*maxtrace : 16384;
+    memory->grow(trace_start,maxtrace,"timer:trace_start");
+    memory->grow(trace_stop,maxtrace,"timer:trace_stop");
+    memory->grow(trace_which,maxtrace,"timer:trace_which");
+  }
+  trace_start[ntrace] = start;
+  trace_stop[ntrace] = stop;
+  trace_which[ntrace] = which;
+  ntrace++;
+}
+
+/* ----------------------------------------------------------------------
+   write all buffered trace events to a per-rank binary file and reset
+   the buffer, appending if the file exists from an earlier run
+   format: magic line, then one 20-byte record per event:
+   int32 category, float64 start, float64 stop (native endianness)
+------------------------------------------------------------------------- */
+
+void Timer::trace_flush()
+{
+  if (!tracefile || ntrace == 0) return;
+
+  char fname[256];
+  snprintf(fname,256,"%s.%d",tracefile,comm->me);
+
+  FILE *fp = fopen(fname,"ab");
+  if (fp == NULL)
+    error->one(FLERR,"Cannot open timer trace file");
+
+  long pos = ftell(fp);
+  if (pos == 0) fprintf(fp,"LMPTRACE 1 %d\n",comm->me);
+
+  for (bigint i = 0; i < ntrace; i++) {
+    int which = trace_which[i];
+    fwrite(&which,sizeof(int),1,fp);
+    fwrite(&trace_start[i],sizeof(double),1,fp);
+    fwrite(&trace_stop[i],sizeof(double),1,fp);
+  }
+  fclose(fp);
+
+  ntrace = 0;
+}
+
 /* ----------------------------------------------------------------------
    modify parameters of the Timer class
 ------------------------------------------------------------------------- */
 static const char *timer_style[] = { "off", "loop", "normal", "full" };
 static const char *timer_mode[]  = { "nosync", "(dummy)", "sync" };
-static const char  timer_fmt[]   = "New timer settings: style=%s  mode=%s  timeout=%s\n";
+static const char  timer_fmt[]   = "New timer settings: style=%s  mode=%s  detail=%s  timeout=%s\n";
 
 void Timer::modify_params(int narg, char **arg)
 {
@@ -294,6 +462,28 @@ void Timer::modify_params(int narg, char **arg)
       _sync  = OFF;
     } else if (strcmp(arg[iarg],timer_mode[NORMAL])  == 0) {
       _sync  = NORMAL;
+    } else if (strcmp(arg[iarg],"detail") == 0) {
+      _detail = 1;
+    } else if (strcmp(arg[iarg],"nodetail") == 0) {
+      _detail = 0;
+    } else if (strcmp(arg[iarg],"perf") == 0) {
+      _perf = 1;
+      perf_open();
+    } else if (strcmp(arg[iarg],"noperf") == 0) {
+      _perf = 0;
+      perf_close();
+    } else if (strcmp(arg[iarg],"trace") == 0) {
+      ++iarg;
+      if (iarg < narg) {
+        delete [] tracefile;
+        int n = strlen(arg[iarg]) + 1;
+        tracefile = new char[n];
+        strcpy(tracefile,arg[iarg]);
+        _trace = 1;
+      } else error->all(FLERR,"Illegal timers command");
+    } else if (strcmp(arg[iarg],"notrace") == 0) {
+      if (_trace) trace_flush();
+      _trace = 0;
     } else if (strcmp(arg[iarg],"timeout") == 0) {
       ++iarg;
       if (iarg < narg) {
@@ -322,9 +512,12 @@ void Timer::modify_params(int narg, char **arg)
       strftime(timebuf,32,"%H:%M:%S",tm);
     }
 
+    const char *detailbuf = _detail ? "on" : "off";
     if (screen)
-      fprintf(screen,timer_fmt,timer_style[_level],timer_mode[_sync],timebuf);
+      fprintf(screen,timer_fmt,timer_style[_level],timer_mode[_sync],
+              detailbuf,timebuf);
     if (logfile)
-      fprintf(logfile,timer_fmt,timer_style[_level],timer_mode[_sync],timebuf);
+      fprintf(logfile,timer_fmt,timer_style[_level],timer_mode[_sync],
+              detailbuf,timebuf);
   }
 }
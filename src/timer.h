@@ -26,9 +26,11 @@ class Timer : protected Pointers {
                MODIFY,OUTPUT,SYNC,ALL,DEPHASE,DYNAMICS,QUENCH,NEB,REPCOMM,
                REPOUT,NUM_TIMER};
   enum tlevel {OFF=0,LOOP,NORMAL,FULL};
+  enum tcounter {CNT_CYCLES=0,CNT_INSNS,CNT_CACHEREF,CNT_CACHEMISS,
+                 CNT_STALL,NUM_COUNTER};
 
   Timer(class LAMMPS *);
-  ~Timer() {};
+  ~Timer();
   void init();
 
   // inline function to reduce overhead if we want no detailed timings
@@ -46,6 +48,10 @@ class Timer : protected Pointers {
   bool has_normal() const { return (_level >= NORMAL); }
   bool has_full()   const { return (_level >= FULL); }
   bool has_sync()   const { return (_sync  != OFF); }
+  bool has_detail() const { return (_detail != 0); }
+  bool has_perf()   const { return (_perf != 0); }
+  bool has_trace()  const { return (_trace != 0); }
+  int  has_counter(int i) const { return (perf_fd[i] >= 0); }
 
   // flag if wallclock time is expired
   bool is_timeout() const { return (_timeout == 0.0); }
@@ -57,6 +63,8 @@ class Timer : protected Pointers {
     return cpu_array[which]; };
   double get_wall(enum ttype which) const {
     return wall_array[which]; };
+  double get_counter(enum ttype which, int i) const {
+    return counter_array[which][i]; };
 
   void set_wall(enum ttype, double);
 
@@ -85,14 +93,29 @@ class Timer : protected Pointers {
 
   void modify_params(int, char **);
 
+  // write buffered trace events to the per-rank trace file
+
+  void trace_flush();
+
  private:
   double cpu_array[NUM_TIMER];
   double wall_array[NUM_TIMER];
+  double counter_array[NUM_TIMER][NUM_COUNTER];
   double previous_cpu;
   double previous_wall;
+  double previous_counter[NUM_COUNTER];
   double timeout_start;
   int _level;     // level of detail: off=0,loop=1,normal=2,full=3
   int _sync;      // if nonzero, synchronize tasks before setting the timer
+  int _detail;    // if nonzero, accumulate per-style timings for Finish
+  int _perf;      // if nonzero, sample hardware counters at category stamps
+  int perf_fd[NUM_COUNTER];  // perf_event fd per counter, -1 if unavailable
+  int _trace;     // if nonzero, buffer begin/end events for each section
+  char *tracefile;       // base name of per-rank trace files
+  bigint ntrace,maxtrace;   // # of buffered trace events and buffer size
+  double *trace_start;   // wall clock at start of each traced slice
+  double *trace_stop;    // wall clock at end of each traced slice
+  int *trace_which;      // timer category of each traced slice
   int _timeout;   // max allowed wall time in seconds. infinity if negative
   int _s_timeout; // copy of timeout for restoring after a forced timeout
   int _checkfreq; // frequency of timeout checking
@@ -101,6 +124,14 @@ class Timer : protected Pointers {
   // update one specific timer array
   void _stamp(enum ttype);
 
+  // manage linux perf_event hardware counters
+  void perf_open();
+  void perf_close();
+  void perf_read(double *);
+
+  // append one slice to the trace buffer
+  void trace_record(enum ttype, double, double);
+
   // check for timeout
   bool _check_timeout();
 };
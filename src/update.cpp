@@ -37,6 +37,7 @@ Update::Update(LAMMPS *lmp) : Pointers(lmp)
   atime = 0.0;
   atimestep = 0;
   first_update = 0;
+  setup_dirty = 1;
 
   whichflag = 0;
   firststep = laststep = 0;
@@ -496,6 +497,10 @@ void Update::reset_timestep(bigint newstep)
   for (int i = 0; i < modify->ncompute; i++)
     if (modify->compute[i]->timeflag) modify->compute[i]->clearstep();
 
+  // clear precomputed end-of-step schedule, timestep may have moved back
+
+  modify->next_end_of_step = -1;
+
   // Neighbor Bin/Stencil/Pair classes store timestamps that need to be cleared
 
   neighbor->reset_timestep(ntimestep);
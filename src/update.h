@@ -32,6 +32,9 @@ class Update : protected Pointers {
   bigint firststep,laststep;      // 1st & last step of this run
   bigint beginstep,endstep;       // 1st and last step of multiple runs
   int first_update;               // 0 before initial update, 1 after
+  int setup_dirty;                // 1 if a command since the last completed
+                                  // run may have modified the system,
+                                  // consulted by "run ... pre auto"
   int max_eval;                   // max force evaluations for minimizer
   int restrict_output;            // 1 if output should not write dump/restart
   int setupflag;                  // set when setup() is computing forces
@@ -69,7 +69,8 @@ enum{DONE,ADD,SUBTRACT,MULTIPLY,DIVIDE,CARAT,MODULO,UNARY,
      RANDOM,NORMAL,CEIL,FLOOR,ROUND,RAMP,STAGGER,LOGFREQ,LOGFREQ2,
      LOGFREQ3,STRIDE,STRIDE2,VDISPLACE,SWIGGLE,CWIGGLE,GMASK,RMASK,
      GRMASK,IS_ACTIVE,IS_DEFINED,IS_AVAILABLE,
-     VALUE,ATOMARRAY,TYPEARRAY,INTARRAY,BIGINTARRAY,VECTORARRAY};
+     VALUE,ATOMARRAY,TYPEARRAY,INTARRAY,BIGINTARRAY,VECTORARRAY,
+     CSCALAR,CVECELEM,CARRELEM,FSCALAR,FVECELEM,FARRELEM,VARREF,THERMOKW};
 
 // customize by adding a special function
 
@@ -101,6 +102,9 @@ Variable::Variable(LAMMPS *lmp) : Pointers(lmp)
 
   eval_in_progress = NULL;
 
+  ctree = NULL;
+  cflag = NULL;
+
   randomequal = NULL;
   randomatom = NULL;
 
@@ -128,6 +132,7 @@ Variable::~Variable()
     else for (int j = 0; j < num[i]; j++) delete [] data[i][j];
     delete [] data[i];
     if (style[i] == VECTOR) memory->destroy(vecs[i].values);
+    if (ctree[i]) free_tree(ctree[i]);
   }
   memory->sfree(names);
   memory->destroy(style);
@@ -141,6 +146,9 @@ Variable::~Variable()
 
   memory->destroy(eval_in_progress);
 
+  memory->sfree(ctree);
+  memory->destroy(cflag);
+
   delete randomequal;
   delete randomatom;
 
@@ -525,8 +533,12 @@ void Variable::set(int narg, char **arg)
 
   // set name of variable, if not replacing one flagged with replaceflag
   // name must be all alphanumeric chars or underscores
+  // redefinition invalidates cached trees which may reference the variable
 
-  if (replaceflag) return;
+  if (replaceflag) {
+    clear_cache();
+    return;
+  }
 
   int n = strlen(arg[0]) + 1;
   names[nvar] = new char[n];
@@ -967,8 +979,30 @@ double Variable::compute_equal(int ivar)
 
   eval_in_progress[ivar] = 1;
 
+  // for EQUAL style, compile the formula into a parse tree on first
+  //   evaluation, then re-use the tree to avoid re-parsing the string
+  // compile marks uncacheable if the formula contains an element which
+  //   must be evaluated eagerly at parse time, e.g. a group function,
+  //   then every evaluation falls back to string parsing as before
+
   double value = 0.0;
-  if (style[ivar] == EQUAL) value = evaluate(data[ivar][0],NULL,ivar);
+  if (style[ivar] == EQUAL) {
+    if (cflag[ivar] == 0) {
+      Tree *tree = NULL;
+      treetype = EQUAL;
+      uncacheable = 0;
+      evaluate(data[ivar][0],&tree,ivar);
+      if (uncacheable) {
+        free_tree(tree);
+        cflag[ivar] = -1;
+      } else {
+        ctree[ivar] = tree;
+        cflag[ivar] = 1;
+      }
+    }
+    if (cflag[ivar] == 1) value = eval_tree(ctree[ivar],0);
+    else value = evaluate(data[ivar][0],NULL,ivar);
+  }
   else if (style[ivar] == INTERNAL) value = dvalue[ivar];
   else if (style[ivar] == PYTHON) {
     int ifunc = python->find(data[ivar][0]);
@@ -1134,6 +1168,10 @@ void Variable::internal_set(int ivar, double value)
 
 void Variable::remove(int n)
 {
+  // removal shifts variable indices, which cached trees refer to
+
+  clear_cache();
+
   delete [] names[n];
   if (style[n] == LOOP || style[n] == ULOOP) delete [] data[n][0];
   else for (int i = 0; i < num[n]; i++) delete [] data[n][i];
@@ -1153,6 +1191,23 @@ void Variable::remove(int n)
   nvar--;
 }
 
+/* ----------------------------------------------------------------------
+   discard all cached equal-style parse trees
+   must be called whenever a variable, compute, or fix is added or removed,
+   since cached trees store variable indices and Compute/Fix pointers
+------------------------------------------------------------------------- */
+
+void Variable::clear_cache()
+{
+  for (int i = 0; i < nvar; i++) {
+    if (ctree[i]) {
+      free_tree(ctree[i]);
+      ctree[i] = NULL;
+    }
+    cflag[i] = 0;
+  }
+}
+
 /* ----------------------------------------------------------------------
   make space in arrays for new variable
 ------------------------------------------------------------------------- */
@@ -1183,6 +1238,11 @@ void Variable::grow()
 
   memory->grow(eval_in_progress,maxvar,"var:eval_in_progress");
   for (int i = 0; i < maxvar; i++) eval_in_progress[i] = 0;
+
+  ctree = (Tree **) memory->srealloc(ctree,maxvar*sizeof(Tree *),"var:ctree");
+  for (int i = old; i < maxvar; i++) ctree[i] = NULL;
+  memory->grow(cflag,maxvar,"var:cflag");
+  for (int i = old; i < maxvar; i++) cflag[i] = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -1378,91 +1438,127 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         if (nbracket == 0 && compute->scalar_flag && lowercase) {
 
-          if (update->whichflag == 0) {
-            if (compute->invoked_scalar != update->ntimestep)
-              print_var_error(FLERR,"Compute used in variable between "
-                              "runs is not current",ivar);
-          } else if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-            compute->compute_scalar();
-            compute->invoked_flag |= INVOKED_SCALAR;
-          }
+          // for a cached equal-style tree, defer invocation to eval_tree()
 
-          value1 = compute->scalar;
-          if (tree) {
+          if (tree && treetype == EQUAL) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            newtree->type = CSCALAR;
+            newtree->vptr = (void *) compute;
             treestack[ntreestack++] = newtree;
-          } else argstack[nargstack++] = value1;
+
+          } else {
+
+            if (update->whichflag == 0) {
+              if (compute->invoked_scalar != update->ntimestep)
+                print_var_error(FLERR,"Compute used in variable between "
+                                "runs is not current",ivar);
+            } else if (!(compute->invoked_flag & INVOKED_SCALAR)) {
+              compute->compute_scalar();
+              compute->invoked_flag |= INVOKED_SCALAR;
+            }
+
+            value1 = compute->scalar;
+            if (tree) {
+              Tree *newtree = new Tree();
+              newtree->type = VALUE;
+              newtree->value = value1;
+              newtree->first = newtree->second = NULL;
+              newtree->nextra = 0;
+              treestack[ntreestack++] = newtree;
+            } else argstack[nargstack++] = value1;
+          }
 
         // c_ID[i] = scalar from global vector, must be lowercase
 
         } else if (nbracket == 1 && compute->vector_flag && lowercase) {
 
-          if (index1 > compute->size_vector &&
-              compute->size_vector_variable == 0)
-            print_var_error(FLERR,"Variable formula compute vector "
-                            "is accessed out-of-range",ivar,0);
-          if (update->whichflag == 0) {
-            if (compute->invoked_vector != update->ntimestep)
-              print_var_error(FLERR,"Compute used in variable between runs "
-                              "is not current",ivar);
-          } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
-            compute->invoked_flag |= INVOKED_VECTOR;
-          }
+          // for a cached equal-style tree, defer invocation to eval_tree()
 
-          if (compute->size_vector_variable &&
-              index1 > compute->size_vector) value1 = 0.0;
-          else value1 = compute->vector[index1-1];
-          if (tree) {
+          if (tree && treetype == EQUAL) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            newtree->type = CVECELEM;
+            newtree->vptr = (void *) compute;
+            newtree->ivalue1 = index1;
             treestack[ntreestack++] = newtree;
-          } else argstack[nargstack++] = value1;
+
+          } else {
+
+            if (index1 > compute->size_vector &&
+                compute->size_vector_variable == 0)
+              print_var_error(FLERR,"Variable formula compute vector "
+                              "is accessed out-of-range",ivar,0);
+            if (update->whichflag == 0) {
+              if (compute->invoked_vector != update->ntimestep)
+                print_var_error(FLERR,"Compute used in variable between runs "
+                                "is not current",ivar);
+            } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+              compute->compute_vector();
+              compute->invoked_flag |= INVOKED_VECTOR;
+            }
+
+            if (compute->size_vector_variable &&
+                index1 > compute->size_vector) value1 = 0.0;
+            else value1 = compute->vector[index1-1];
+            if (tree) {
+              Tree *newtree = new Tree();
+              newtree->type = VALUE;
+              newtree->value = value1;
+              newtree->first = newtree->second = NULL;
+              newtree->nextra = 0;
+              treestack[ntreestack++] = newtree;
+            } else argstack[nargstack++] = value1;
+          }
 
         // c_ID[i][j] = scalar from global array, must be lowercase
 
         } else if (nbracket == 2 && compute->array_flag && lowercase) {
 
-          if (index1 > compute->size_array_rows &&
-              compute->size_array_rows_variable == 0)
-            print_var_error(FLERR,"Variable formula compute array "
-                            "is accessed out-of-range",ivar,0);
-          if (index2 > compute->size_array_cols)
-            print_var_error(FLERR,"Variable formula compute array "
-                            "is accessed out-of-range",ivar,0);
-          if (update->whichflag == 0) {
-            if (compute->invoked_array != update->ntimestep)
-              print_var_error(FLERR,"Compute used in variable between runs "
-                              "is not current",ivar);
-          } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-            compute->compute_array();
-            compute->invoked_flag |= INVOKED_ARRAY;
-          }
+          // for a cached equal-style tree, defer invocation to eval_tree()
 
-          if (compute->size_array_rows_variable &&
-              index1 > compute->size_array_rows) value1 = 0.0;
-          else value1 = compute->array[index1-1][index2-1];
-          if (tree) {
+          if (tree && treetype == EQUAL) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            newtree->type = CARRELEM;
+            newtree->vptr = (void *) compute;
+            newtree->ivalue1 = index1;
+            newtree->ivalue2 = index2;
             treestack[ntreestack++] = newtree;
-          } else argstack[nargstack++] = value1;
+
+          } else {
+
+            if (index1 > compute->size_array_rows &&
+                compute->size_array_rows_variable == 0)
+              print_var_error(FLERR,"Variable formula compute array "
+                              "is accessed out-of-range",ivar,0);
+            if (index2 > compute->size_array_cols)
+              print_var_error(FLERR,"Variable formula compute array "
+                              "is accessed out-of-range",ivar,0);
+            if (update->whichflag == 0) {
+              if (compute->invoked_array != update->ntimestep)
+                print_var_error(FLERR,"Compute used in variable between runs "
+                                "is not current",ivar);
+            } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
+              compute->compute_array();
+              compute->invoked_flag |= INVOKED_ARRAY;
+            }
+
+            if (compute->size_array_rows_variable &&
+                index1 > compute->size_array_rows) value1 = 0.0;
+            else value1 = compute->array[index1-1][index2-1];
+            if (tree) {
+              Tree *newtree = new Tree();
+              newtree->type = VALUE;
+              newtree->value = value1;
+              newtree->first = newtree->second = NULL;
+              newtree->nextra = 0;
+              treestack[ntreestack++] = newtree;
+            } else argstack[nargstack++] = value1;
+          }
 
         // c_ID = vector from global vector, lowercase or uppercase
 
         } else if (nbracket == 0 && compute->vector_flag) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Compute global vector in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -1494,7 +1590,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 1 && compute->array_flag) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Compute global vector in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -1570,7 +1666,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 0 && compute->peratom_flag &&
                    compute->size_peratom_cols == 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom compute in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1599,7 +1695,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 1 && compute->peratom_flag &&
                    compute->size_peratom_cols > 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom compute in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1680,66 +1776,102 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         if (nbracket == 0 && fix->scalar_flag && lowercase) {
 
-          if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
-            print_var_error(FLERR,"Fix in variable not computed "
-                            "at a compatible time",ivar);
+          // for a cached equal-style tree, defer invocation to eval_tree()
 
-          value1 = fix->compute_scalar();
-          if (tree) {
+          if (tree && treetype == EQUAL) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            newtree->type = FSCALAR;
+            newtree->vptr = (void *) fix;
             treestack[ntreestack++] = newtree;
-          } else argstack[nargstack++] = value1;
+
+          } else {
+
+            if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
+              print_var_error(FLERR,"Fix in variable not computed "
+                              "at a compatible time",ivar);
+
+            value1 = fix->compute_scalar();
+            if (tree) {
+              Tree *newtree = new Tree();
+              newtree->type = VALUE;
+              newtree->value = value1;
+              newtree->first = newtree->second = NULL;
+              newtree->nextra = 0;
+              treestack[ntreestack++] = newtree;
+            } else argstack[nargstack++] = value1;
+          }
 
         // f_ID[i] = scalar from global vector, must be lowercase
 
         } else if (nbracket == 1 && fix->vector_flag && lowercase) {
 
-          if (index1 > fix->size_vector &&
-              fix->size_vector_variable == 0)
-            print_var_error(FLERR,"Variable formula fix vector is "
-                            "accessed out-of-range",ivar,0);
-          if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
-            print_var_error(FLERR,"Fix in variable not computed "
-                            "at a compatible time",ivar);
+          // for a cached equal-style tree, defer invocation to eval_tree()
 
-          value1 = fix->compute_vector(index1-1);
-          if (tree) {
+          if (tree && treetype == EQUAL) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            newtree->type = FVECELEM;
+            newtree->vptr = (void *) fix;
+            newtree->ivalue1 = index1;
             treestack[ntreestack++] = newtree;
-          } else argstack[nargstack++] = value1;
+
+          } else {
+
+            if (index1 > fix->size_vector &&
+                fix->size_vector_variable == 0)
+              print_var_error(FLERR,"Variable formula fix vector is "
+                              "accessed out-of-range",ivar,0);
+            if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
+              print_var_error(FLERR,"Fix in variable not computed "
+                              "at a compatible time",ivar);
+
+            value1 = fix->compute_vector(index1-1);
+            if (tree) {
+              Tree *newtree = new Tree();
+              newtree->type = VALUE;
+              newtree->value = value1;
+              newtree->first = newtree->second = NULL;
+              newtree->nextra = 0;
+              treestack[ntreestack++] = newtree;
+            } else argstack[nargstack++] = value1;
+          }
 
         // f_ID[i][j] = scalar from global array, must be lowercase
 
         } else if (nbracket == 2 && fix->array_flag && lowercase) {
 
-          if (index1 > fix->size_array_rows &&
-              fix->size_array_rows_variable == 0)
-            print_var_error(FLERR,"Variable formula fix array is "
-                            "accessed out-of-range",ivar,0);
-          if (index2 > fix->size_array_cols)
-            print_var_error(FLERR,"Variable formula fix array is "
-                            "accessed out-of-range",ivar,0);
-          if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
-            print_var_error(FLERR,"Fix in variable not computed at a "
-                            "compatible time",ivar);
+          // for a cached equal-style tree, defer invocation to eval_tree()
 
-          value1 = fix->compute_array(index1-1,index2-1);
-          if (tree) {
+          if (tree && treetype == EQUAL) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            newtree->type = FARRELEM;
+            newtree->vptr = (void *) fix;
+            newtree->ivalue1 = index1;
+            newtree->ivalue2 = index2;
             treestack[ntreestack++] = newtree;
-          } else argstack[nargstack++] = value1;
+
+          } else {
+
+            if (index1 > fix->size_array_rows &&
+                fix->size_array_rows_variable == 0)
+              print_var_error(FLERR,"Variable formula fix array is "
+                              "accessed out-of-range",ivar,0);
+            if (index2 > fix->size_array_cols)
+              print_var_error(FLERR,"Variable formula fix array is "
+                              "accessed out-of-range",ivar,0);
+            if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
+              print_var_error(FLERR,"Fix in variable not computed at a "
+                              "compatible time",ivar);
+
+            value1 = fix->compute_array(index1-1,index2-1);
+            if (tree) {
+              Tree *newtree = new Tree();
+              newtree->type = VALUE;
+              newtree->value = value1;
+              newtree->first = newtree->second = NULL;
+              newtree->nextra = 0;
+              treestack[ntreestack++] = newtree;
+            } else argstack[nargstack++] = value1;
+          }
 
         // f_ID = vector from global vector, lowercase or uppercase
 
@@ -1748,7 +1880,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
           if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
             print_var_error(FLERR,"Fix in variable not computed at "
                             "compatible time",ivar);
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Fix global vector in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -1781,7 +1913,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
           if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
             print_var_error(FLERR,"Fix in variable not computed "
                             "at a compatible time",ivar);
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Fix global vector in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -1847,7 +1979,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 0 && fix->peratom_flag &&
                    fix->size_peratom_cols == 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom fix in "
                             "equal-style variable formula",ivar);
           if (update->whichflag > 0 &&
@@ -1869,7 +2001,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 1 && fix->peratom_flag &&
                    fix->size_peratom_cols > 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom fix in "
                             "equal-style variable formula",ivar);
           if (index1 > fix->size_peratom_cols)
@@ -1930,10 +2062,13 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
           value1 = dvalue[ivar];
           if (tree) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            if (treetype == EQUAL) {
+              newtree->type = VARREF;
+              newtree->ivalue1 = ivar;
+            } else {
+              newtree->type = VALUE;
+              newtree->value = value1;
+            }
             treestack[ntreestack++] = newtree;
           } else argstack[nargstack++] = value1;
 
@@ -1943,25 +2078,38 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 0 && style[ivar] != ATOM &&
                    style[ivar] != ATOMFILE && style[ivar] != VECTOR) {
 
-          char *var = retrieve(word+2);
-          if (var == NULL)
-            print_var_error(FLERR,"Invalid variable evaluation in "
-                            "variable formula",ivar);
-          if (tree) {
+          // equal-style reference becomes a deferred leaf in a cached tree,
+          // other styles change value without notice, so cannot be cached
+
+          if (tree && treetype == EQUAL && style[ivar] == EQUAL) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = atof(var);
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            newtree->type = VARREF;
+            newtree->ivalue1 = ivar;
             treestack[ntreestack++] = newtree;
-          } else argstack[nargstack++] = atof(var);
+
+          } else {
+
+            if (tree && treetype == EQUAL) uncacheable = 1;
+            char *var = retrieve(word+2);
+            if (var == NULL)
+              print_var_error(FLERR,"Invalid variable evaluation in "
+                              "variable formula",ivar);
+            if (tree) {
+              Tree *newtree = new Tree();
+              newtree->type = VALUE;
+              newtree->value = atof(var);
+              newtree->first = newtree->second = NULL;
+              newtree->nextra = 0;
+              treestack[ntreestack++] = newtree;
+            } else argstack[nargstack++] = atof(var);
+          }
 
         // v_name = per-atom vector from atom-style variable
         // evaluate the atom-style variable as newtree
 
         } else if (nbracket == 0 && style[ivar] == ATOM) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Atom-style variable in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1976,7 +2124,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 0 && style[ivar] == ATOMFILE) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Atomfile-style variable in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1997,7 +2145,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 0 && style[ivar] == VECTOR) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Vector-style variable in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -2023,9 +2171,13 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket && style[ivar] == ATOM) {
 
+          // compute_atom() resets treetype, restore it for ongoing parse
+
+          int savetreetype = treetype;
           double *result;
           memory->create(result,atom->nlocal,"variable:result");
           compute_atom(ivar,0,result,1,0);
+          treetype = savetreetype;
           peratom2global(1,NULL,result,1,index,
                          tree,treestack,ntreestack,argstack,nargstack);
           memory->destroy(result);
@@ -2042,8 +2194,14 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket && style[ivar] == VECTOR) {
 
+          // compute_vector() resets treetype, restore it for ongoing parse
+          // value obtained at parse time, cannot be part of a cached tree
+
+          if (tree && treetype == EQUAL) uncacheable = 1;
+          int savetreetype = treetype;
           double *vec;
           int nvec = compute_vector(ivar,&vec);
+          treetype = savetreetype;
           if (index <= 0 || index > nvec)
             print_var_error(FLERR,"Invalid index into "
                             "vector-style variable",ivar);
@@ -2145,10 +2303,15 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
                                               "variable formula",word),ivar);
           if (tree) {
             Tree *newtree = new Tree();
-            newtree->type = VALUE;
-            newtree->value = value1;
-            newtree->first = newtree->second = NULL;
-            newtree->nextra = 0;
+            if (treetype == EQUAL) {
+              newtree->type = THERMOKW;
+              int n = strlen(word) + 1;
+              newtree->sstr = new char[n];
+              strcpy(newtree->sstr,word);
+            } else {
+              newtree->type = VALUE;
+              newtree->value = value1;
+            }
             treestack[ntreestack++] = newtree;
           } else argstack[nargstack++] = value1;
         }
@@ -3214,6 +3377,103 @@ double Variable::eval_tree(Tree *tree, int i)
     else return 0.0;
   }
 
+  // deferred leaves of a cached equal-style variable tree
+  // invoke and error check the same way evaluate() does for eager leaves
+
+  if (tree->type == CSCALAR) {
+    Compute *compute = (Compute *) tree->vptr;
+    if (update->whichflag == 0) {
+      if (compute->invoked_scalar != update->ntimestep)
+        error->all(FLERR,
+                   "Compute used in variable between runs is not current");
+    } else if (!(compute->invoked_flag & INVOKED_SCALAR)) {
+      compute->compute_scalar();
+      compute->invoked_flag |= INVOKED_SCALAR;
+    }
+    return compute->scalar;
+  }
+
+  if (tree->type == CVECELEM) {
+    Compute *compute = (Compute *) tree->vptr;
+    if (tree->ivalue1 > compute->size_vector &&
+        compute->size_vector_variable == 0)
+      error->all(FLERR,
+                 "Variable formula compute vector is accessed out-of-range");
+    if (update->whichflag == 0) {
+      if (compute->invoked_vector != update->ntimestep)
+        error->all(FLERR,
+                   "Compute used in variable between runs is not current");
+    } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+      compute->compute_vector();
+      compute->invoked_flag |= INVOKED_VECTOR;
+    }
+    if (compute->size_vector_variable &&
+        tree->ivalue1 > compute->size_vector) return 0.0;
+    return compute->vector[tree->ivalue1-1];
+  }
+
+  if (tree->type == CARRELEM) {
+    Compute *compute = (Compute *) tree->vptr;
+    if (tree->ivalue1 > compute->size_array_rows &&
+        compute->size_array_rows_variable == 0)
+      error->all(FLERR,
+                 "Variable formula compute array is accessed out-of-range");
+    if (tree->ivalue2 > compute->size_array_cols)
+      error->all(FLERR,
+                 "Variable formula compute array is accessed out-of-range");
+    if (update->whichflag == 0) {
+      if (compute->invoked_array != update->ntimestep)
+        error->all(FLERR,
+                   "Compute used in variable between runs is not current");
+    } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
+      compute->compute_array();
+      compute->invoked_flag |= INVOKED_ARRAY;
+    }
+    if (compute->size_array_rows_variable &&
+        tree->ivalue1 > compute->size_array_rows) return 0.0;
+    return compute->array[tree->ivalue1-1][tree->ivalue2-1];
+  }
+
+  if (tree->type == FSCALAR) {
+    Fix *fix = (Fix *) tree->vptr;
+    if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
+      error->all(FLERR,"Fix in variable not computed at a compatible time");
+    return fix->compute_scalar();
+  }
+
+  if (tree->type == FVECELEM) {
+    Fix *fix = (Fix *) tree->vptr;
+    if (tree->ivalue1 > fix->size_vector && fix->size_vector_variable == 0)
+      error->all(FLERR,"Variable formula fix vector is accessed out-of-range");
+    if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
+      error->all(FLERR,"Fix in variable not computed at a compatible time");
+    return fix->compute_vector(tree->ivalue1-1);
+  }
+
+  if (tree->type == FARRELEM) {
+    Fix *fix = (Fix *) tree->vptr;
+    if (tree->ivalue1 > fix->size_array_rows &&
+        fix->size_array_rows_variable == 0)
+      error->all(FLERR,"Variable formula fix array is accessed out-of-range");
+    if (tree->ivalue2 > fix->size_array_cols)
+      error->all(FLERR,"Variable formula fix array is accessed out-of-range");
+    if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
+      error->all(FLERR,"Fix in variable not computed at a compatible time");
+    return fix->compute_array(tree->ivalue1-1,tree->ivalue2-1);
+  }
+
+  if (tree->type == VARREF) {
+    int jvar = tree->ivalue1;
+    if (style[jvar] == INTERNAL) return dvalue[jvar];
+    return compute_equal(jvar);
+  }
+
+  if (tree->type == THERMOKW) {
+    if (output->thermo->evaluate_keyword(tree->sstr,&arg))
+      error->all(FLERR,"Invalid thermo keyword in variable formula");
+    return arg;
+  }
+
   return 0.0;
 }
 
@@ -3265,6 +3525,7 @@ void Variable::free_tree(Tree *tree)
   }
 
   if (tree->selfalloc) memory->destroy(tree->array);
+  delete [] tree->sstr;
   delete tree;
 }
 
@@ -3531,7 +3792,14 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
   } else if (strcmp(word,"random") == 0) {
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
-    if (tree) newtree->type = RANDOM;
+    if (tree) {
+      newtree->type = RANDOM;
+
+      // eval_tree() draws from the per-proc atom RNG stream, which would
+      // desynchronize procs for an equal-style result, so do not cache
+
+      if (treetype == EQUAL) uncacheable = 1;
+    }
     else {
       if (randomequal == NULL) {
         int seed = static_cast<int> (values[0]);
@@ -3544,7 +3812,10 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
   } else if (strcmp(word,"normal") == 0) {
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
-    if (tree) newtree->type = NORMAL;
+    if (tree) {
+      newtree->type = NORMAL;
+      if (treetype == EQUAL) uncacheable = 1;   // same reason as random()
+    }
     else {
       if (value2 < 0.0)
         print_var_error(FLERR,"Invalid math function in variable formula",ivar);
@@ -3823,6 +4094,10 @@ int Variable::group_function(char *word, char *contents, Tree **tree,
       strcmp(word,"omega"))
     return 0;
 
+  // group functions evaluate at parse time, cannot be part of a cached tree
+
+  if (tree && treetype == EQUAL) uncacheable = 1;
+
   // parse contents for comma-separated args
   // narg = number of args, args = strings between commas
 
@@ -4087,6 +4362,11 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
       strcmp(word,"is_available"))
     return 0;
 
+  // special functions evaluate at parse time or have side effects,
+  // e.g. next(), so cannot be part of a cached tree
+
+  if (tree && treetype == EQUAL) uncacheable = 1;
+
   // parse contents for comma-separated args
   // narg = number of args, args = strings between commas
 
@@ -4331,7 +4611,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
   // mask special functions
 
   } else if (strcmp(word,"gmask") == 0) {
-    if (tree == NULL)
+    if (tree == NULL || treetype == EQUAL)
       print_var_error(FLERR,"Gmask function in equal-style "
                       "variable formula",ivar);
     if (narg != 1)
@@ -4349,7 +4629,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
     treestack[ntreestack++] = newtree;
 
   } else if (strcmp(word,"rmask") == 0) {
-    if (tree == NULL)
+    if (tree == NULL || treetype == EQUAL)
       print_var_error(FLERR,"Rmask function in equal-style "
                       "variable formula",ivar);
     if (narg != 1)
@@ -4366,7 +4646,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
     treestack[ntreestack++] = newtree;
 
   } else if (strcmp(word,"grmask") == 0) {
-    if (tree == NULL)
+    if (tree == NULL || treetype == EQUAL)
       print_var_error(FLERR,"Grmask function in equal-style "
                       "variable formula",ivar);
     if (narg != 2)
@@ -4422,7 +4702,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
     // set selfalloc = 1 so result will be deleted by free_tree() after eval
 
     } else if (style[ivar] == ATOMFILE) {
-      if (tree == NULL)
+      if (tree == NULL || treetype == EQUAL)
         print_var_error(FLERR,"Atomfile variable in "
                         "equal-style variable formula",ivar);
 
@@ -4525,6 +4805,10 @@ void Variable::peratom2global(int flag, char *word,
                               Tree **tree, Tree **treestack, int &ntreestack,
                               double *argstack, int &nargstack)
 {
+  // global value is obtained at parse time, cannot be part of a cached tree
+
+  if (tree && treetype == EQUAL) uncacheable = 1;
+
   // error check for ID larger than any atom
   // int_between_brackets() already checked for ID <= 0
 
@@ -4625,7 +4909,7 @@ int Variable::is_atom_vector(char *word)
 void Variable::atom_vector(char *word, Tree **tree,
                            Tree **treestack, int &ntreestack)
 {
-  if (tree == NULL)
+  if (tree == NULL || treetype == EQUAL)
     error->all(FLERR,"Atom vector in equal-style variable formula");
 
   Tree *newtree = new Tree();
@@ -5088,6 +5372,7 @@ VarReader::VarReader(LAMMPS *lmp, char *name, char *file, int flag) :
   fixstore = NULL;
   id_fix = NULL;
   buffer = NULL;
+  pairs = NULL;
 
   if (style == ATOMFILE) {
     if (atom->map_style == 0)
@@ -5102,7 +5387,8 @@ VarReader::VarReader(LAMMPS *lmp, char *name, char *file, int flag) :
     modify->add_fix(cmd);
     fixstore = (FixStore *) modify->fix[modify->nfix-1];
 
-    buffer = new char[CHUNK*MAXLINE];
+    buffer = new char[MAXLINE];
+    memory->create(pairs,2*CHUNK,"varreader:pairs");
   }
 }
 
@@ -5121,6 +5407,7 @@ VarReader::~VarReader()
     if (modify) modify->delete_fix(id_fix);
     delete [] id_fix;
     delete [] buffer;
+    memory->destroy(pairs);
   }
 }
 
@@ -5160,6 +5447,8 @@ int VarReader::read_scalar(char *str)
 /* ----------------------------------------------------------------------
    read snapshot of per-atom values from file
    into str for atomfile-style variable
+   proc 0 parses the text once and bcasts packed binary (ID,value) pairs,
+     each proc only performs map lookups on the binary pairs
    return 0 if successful, 1 if end-of-file
 ------------------------------------------------------------------------- */
 
@@ -5167,7 +5456,7 @@ int VarReader::read_peratom()
 {
   int i,m,n,nchunk,eof;
   tagint tag;
-  char *ptr,*next;
+  char *ptr;
   double value;
 
   // set all per-atom values to 0.0
@@ -5204,18 +5493,29 @@ int VarReader::read_peratom()
   bigint nread = 0;
   while (nread < nlines) {
     nchunk = MIN(nlines-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+
+    eof = 0;
+    if (me == 0) {
+      for (i = 0; i < nchunk; i++) {
+        if (fgets(buffer,MAXLINE,fp) == NULL) {
+          eof = 1;
+          break;
+        }
+        int rv = sscanf(buffer,TAGINT_FORMAT " %lg",&tag,&value);
+        if (tag <= 0 || tag > map_tag_max || rv != 2)
+          error->one(FLERR,"Invalid atom ID in variable file");
+        pairs[2*i] = ubuf(tag).d;
+        pairs[2*i+1] = value;
+      }
+    }
+
+    MPI_Bcast(&eof,1,MPI_INT,0,world);
     if (eof) return 1;
+    MPI_Bcast(pairs,2*nchunk,MPI_DOUBLE,0,world);
 
-    char *buf = buffer;
     for (i = 0; i < nchunk; i++) {
-      next = strchr(buf,'\n');
-      *next = '\0';
-      int rv = sscanf(buf,TAGINT_FORMAT " %lg",&tag,&value);
-      if (tag <= 0 || tag > map_tag_max || rv != 2)
-        error->one(FLERR,"Invalid atom ID in variable file");
-      if ((m = atom->map(tag)) >= 0) vstore[m] = value;
-      buf = next + 1;
+      tag = (tagint) ubuf(pairs[2*i]).i;
+      if ((m = atom->map(tag)) >= 0) vstore[m] = pairs[2*i+1];
     }
 
     nread += nchunk;
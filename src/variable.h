@@ -46,6 +46,7 @@ class Variable : protected Pointers {
   void compute_atom(int, int, double *, int, int);
   int compute_vector(int, double **);
   void internal_set(int, double);
+  void clear_cache();
 
   tagint int_between_brackets(char *&, int);
   double evaluate_boolean(char *);
@@ -71,7 +72,8 @@ class Variable : protected Pointers {
   VecVar *vecs;
 
   int *eval_in_progress;       // flag if evaluation of variable is in progress
-  int treetype;                // ATOM or VECTOR flag for formula evaluation
+  int treetype;                // EQUAL, ATOM, or VECTOR flag for formula eval
+  int uncacheable;             // set during compile if formula must eval eagerly
 
   class RanMars *randomequal;   // random number generator for equal-style vars
   class RanMars *randomatom;    // random number generator for atom-style vars
@@ -88,17 +90,22 @@ class Variable : protected Pointers {
     int nvector;           // length of array for vector-style variable
     int nstride;           // stride between atoms if array is a 2d array
     int selfalloc;         // 1 if array is allocated here, else 0
-    int ivalue1,ivalue2;   // extra values needed for gmask,rmask,grmask
+    int ivalue1,ivalue2;   // extra values: gmask,rmask,grmask,vector indices
+    void *vptr;            // Compute or Fix ptr for deferred equal-style leaf
+    char *sstr;            // thermo keyword string for deferred leaf
     int nextra;            // # of additional args beyond first 2
     Tree *first,*second;   // ptrs further down tree for first 2 args
     Tree **extra;          // ptrs further down tree for nextra args
 
     Tree() :
       array(NULL), iarray(NULL), barray(NULL),
-      selfalloc(0), ivalue1(0), ivalue2(0), nextra(0),
-      first(NULL), second(NULL), extra(NULL) {}
+      selfalloc(0), ivalue1(0), ivalue2(0), vptr(NULL), sstr(NULL),
+      nextra(0), first(NULL), second(NULL), extra(NULL) {}
   };
 
+  Tree **ctree;            // cached parse tree for each equal-style variable
+  int *cflag;              // 0 = not yet compiled, 1 = cached, -1 = cannot cache
+
   int compute_python(int);
   void remove(int);
   void grow();
@@ -144,6 +151,7 @@ class VarReader : protected Pointers {
   int me,style;
   FILE *fp;
   char *buffer;
+  double *pairs;     // packed (ID,value) pairs bcast for atomfile frames
 };
 
 }
@@ -25,6 +25,7 @@
 #include "compute.h"
 #include "compute_temp.h"
 #include "random_park.h"
+#include "random_philox.h"
 #include "group.h"
 #include "comm.h"
 #include "memory.h"
@@ -34,7 +35,7 @@
 using namespace LAMMPS_NS;
 
 enum{CREATE,SET,SCALE,RAMP,ZERO};
-enum{ALL,LOCAL,GEOM};
+enum{ALL,LOCAL,GEOM,TAG};
 enum{NONE,CONSTANT,EQUAL,ATOM};
 
 #define WARMUP 100
@@ -229,6 +230,9 @@ void Velocity::create(double t_desired, int seed)
   //    choose RNG for each atom based on its xyz coord (geometry)
   //      via random->reset()
   //    will always produce same V, independent of P
+  //   TAG = only loop over my atoms
+  //    counter-based RNG keyed on (seed,atom ID)
+  //    will always produce same V, independent of P, at O(nlocal) cost
   // adjust by factor for atom mass
   // set xdim,ydim,zdim = 1/0 for whether to create velocity in those dims
   //   zdim = 0 for 2d
@@ -356,6 +360,43 @@ void Velocity::create(double t_desired, int seed)
         else v[i][2] = 0.0;
       }
     }
+  } else if (loop_flag == TAG) {
+
+    // each proc computes only its own atoms, but the RNG values depend
+    // only on (seed,ID), so the velocities are independent of the proc
+    // count like loop all, without the O(natoms) per-proc scan
+
+    if (atom->tag_enable == 0)
+      error->all(FLERR,
+                 "Cannot use velocity create loop tag unless atoms have IDs");
+
+    RanPhilox *randomtag = new RanPhilox(lmp,seed);
+    tagint *tag = atom->tag;
+    double rr[3];
+
+    for (i = 0; i < nlocal; i++) {
+      if (mask[i] & groupbit) {
+        if (dist_flag == 0) {
+          randomtag->uniform3(tag[i],0,0,rr);
+          vx = rr[0] - 0.5;
+          vy = rr[1] - 0.5;
+          vz = rr[2] - 0.5;
+        } else {
+          randomtag->gaussian3(tag[i],0,0,rr);
+          vx = rr[0];
+          vy = rr[1];
+          vz = rr[2];
+        }
+        if (rmass) factor = 1.0/sqrt(rmass[i]);
+        else factor = 1.0/sqrt(mass[type[i]]);
+        v[i][0] = vx * factor;
+        v[i][1] = vy * factor;
+        if (dim == 3) v[i][2] = vz * factor;
+        else v[i][2] = 0.0;
+      }
+    }
+
+    delete randomtag;
   }
 
   // apply momentum and rotation zeroing
@@ -883,6 +924,7 @@ void Velocity::options(int narg, char **arg)
       if (strcmp(arg[iarg+1],"all") == 0) loop_flag = ALL;
       else if (strcmp(arg[iarg+1],"local") == 0) loop_flag = LOCAL;
       else if (strcmp(arg[iarg+1],"geom") == 0) loop_flag = GEOM;
+      else if (strcmp(arg[iarg+1],"tag") == 0) loop_flag = TAG;
       else error->all(FLERR,"Illegal velocity command");
       iarg += 2;
     } else if (strcmp(arg[iarg],"rigid") == 0) {
@@ -149,6 +149,10 @@ void Verlet::setup(int flag)
 
   modify->setup_pre_reverse(eflag,vflag);
   if (force->newton) comm->reverse_comm();
+  if (atom->f_det_flag) {
+    if (force->newton) comm->reverse_comm_det();
+    atom->det_force_sum();
+  }
 
   modify->setup(vflag);
   output->setup(flag);
@@ -211,6 +215,10 @@ void Verlet::setup_minimal(int flag)
 
   modify->setup_pre_reverse(eflag,vflag);
   if (force->newton) comm->reverse_comm();
+  if (atom->f_det_flag) {
+    if (force->newton) comm->reverse_comm_det();
+    atom->det_force_sum();
+  }
 
   modify->setup(vflag);
   update->setupflag = 0;
@@ -223,7 +231,7 @@ void Verlet::setup_minimal(int flag)
 void Verlet::run(int n)
 {
   bigint ntimestep;
-  int nflag,sortflag;
+  int nflag,sortflag,clearflag;
 
   int n_post_integrate = modify->n_post_integrate;
   int n_pre_exchange = modify->n_pre_exchange;
@@ -256,11 +264,28 @@ void Verlet::run(int n)
     // regular communication vs neighbor list rebuild
 
     nflag = neighbor->decide();
+    clearflag = 0;
 
     if (nflag == 0) {
+
+      // overlap the forward comm receives with clearing the force arrays,
+      // which touches no data the pending swaps write
+
+      timer->stamp();
+      comm->forward_comm_start();
+      force_clear();
+      clearflag = 1;
+      comm->forward_comm_finish();
+      timer->stamp(Timer::COMM);
+    } else if (neighbor->partial_ok()) {
+
+      // partial rebuild: no exchange/borders, only refresh rows near movers
+
       timer->stamp();
       comm->forward_comm();
       timer->stamp(Timer::COMM);
+      neighbor->build_partial();
+      timer->stamp(Timer::NEIGH);
     } else {
       if (n_pre_exchange) {
         timer->stamp();
@@ -297,7 +322,7 @@ void Verlet::run(int n)
     // since some bonded potentials tally pairwise energy/virial
     // and Pair:ev_tally() needs to be called before any tallying
 
-    force_clear();
+    if (!clearflag) force_clear();
 
     timer->stamp();
 
@@ -330,15 +355,40 @@ void Verlet::run(int n)
     }
 
     // reverse communication of forces
+    // post_force fixes which only accumulate into f may run while the
+    //   trailing ghost force messages are still in flight; the rest run
+    //   after the fence, preserving their invocation order
+    // deterministic mode skips the overlap path since post_force fixes
+    //   must see the folded fixed-point forces
 
     if (force->newton) {
-      comm->reverse_comm();
-      timer->stamp(Timer::COMM);
+      if (modify->n_post_force_overlap && !atom->f_det_flag) {
+        comm->reverse_comm_start();
+        timer->stamp(Timer::COMM);
+        modify->post_force_overlap(vflag);
+        timer->stamp(Timer::MODIFY);
+        comm->reverse_comm_finish();
+        timer->stamp(Timer::COMM);
+        if (modify->n_post_force_fence) {
+          modify->post_force_fence(vflag);
+          timer->stamp(Timer::MODIFY);
+        }
+      } else {
+        comm->reverse_comm();
+        if (atom->f_det_flag) {
+          comm->reverse_comm_det();
+          atom->det_force_sum();
+        }
+        timer->stamp(Timer::COMM);
+        if (n_post_force) modify->post_force(vflag);
+      }
+    } else {
+      if (atom->f_det_flag) atom->det_force_sum();
+      if (n_post_force) modify->post_force(vflag);
     }
 
-    // force modifications, final time integration, diagnostics
+    // final time integration, diagnostics
 
-    if (n_post_force) modify->post_force(vflag);
     modify->final_integrate();
     if (n_end_of_step) modify->end_of_step();
     timer->stamp(Timer::MODIFY);
@@ -371,6 +421,8 @@ void Verlet::force_clear()
 {
   size_t nbytes;
 
+  if (atom->f_det_flag) atom->det_force_clear();
+
   if (external_force_clear) return;
 
   // clear force on all particles
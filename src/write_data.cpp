@@ -73,6 +73,7 @@ void WriteData::command(int narg, char **arg)
   pairflag = II;
   coeffflag = 1;
   fixflag = 1;
+  binaryflag = 0;
   int noinit = 0;
 
   int iarg = 1;
@@ -86,6 +87,9 @@ void WriteData::command(int narg, char **arg)
     } else if (strcmp(arg[iarg],"noinit") == 0) {
       noinit = 1;
       iarg++;
+    } else if (strcmp(arg[iarg],"binary") == 0) {
+      binaryflag = 1;
+      iarg++;
     } else if (strcmp(arg[iarg],"nocoeff") == 0) {
       coeffflag = 0;
       iarg++;
@@ -95,6 +99,11 @@ void WriteData::command(int narg, char **arg)
     } else error->all(FLERR,"Illegal write_data command");
   }
 
+  if (binaryflag &&
+      (atom->ellipsoid_flag || atom->line_flag ||
+       atom->tri_flag || atom->body_flag))
+    error->all(FLERR,"Write_data binary does not support bonus atom styles");
+
   // init entire system since comm->exchange is done
   // comm::init needs neighbor::init needs pair::init needs kspace::init, etc
   // exception is when called by -r command-line switch
@@ -191,9 +200,14 @@ void WriteData::write(const std::string &file)
   }
 
   // per atom info in Atoms and Velocities sections
+  // binary mode emits both as one fixed-width Atoms Binary section
 
-  if (natoms) atoms();
-  if (natoms) velocities();
+  if (binaryflag) {
+    if (natoms) atoms_binary();
+  } else {
+    if (natoms) atoms();
+    if (natoms) velocities();
+  }
 
   // molecular topology info if defined
   // do not write molecular topology for atom_style template
@@ -381,6 +395,78 @@ void WriteData::atoms()
   memory->destroy(buf);
 }
 
+/* ----------------------------------------------------------------------
+   write out Atoms Binary section of data file
+   one fixed-width binary record per atom = data columns + velocity
+   columns, exactly the doubles produced by pack_data() and pack_vel()
+   section layout: keyword line, blank line, one text metadata line
+   "natoms ncol_atom ncol_vel", raw records, trailing newline
+------------------------------------------------------------------------- */
+
+void WriteData::atoms_binary()
+{
+  // communication buffer holds data + velocity columns per atom
+
+  int ncola = atom->avec->size_data_atom + 3;
+  int ncolv = atom->avec->size_velocity + 1;
+  int ncol = ncola + ncolv;
+
+  int sendrow = atom->nlocal;
+  int maxrow;
+  MPI_Allreduce(&sendrow,&maxrow,1,MPI_INT,MPI_MAX,world);
+
+  double **bufa,**bufv,**buf;
+  memory->create(bufa,MAX(1,sendrow),ncola,"write_data:bufa");
+  memory->create(bufv,MAX(1,sendrow),ncolv,"write_data:bufv");
+  if (me == 0) memory->create(buf,MAX(1,maxrow),ncol,"write_data:buf");
+  else memory->create(buf,MAX(1,sendrow),ncol,"write_data:buf");
+
+  atom->avec->pack_data(bufa);
+  atom->avec->pack_vel(bufv);
+
+  for (int i = 0; i < sendrow; i++) {
+    memcpy(buf[i],bufa[i],ncola*sizeof(double));
+    memcpy(&buf[i][ncola],bufv[i],ncolv*sizeof(double));
+  }
+
+  memory->destroy(bufa);
+  memory->destroy(bufv);
+
+  // write one chunk of records per proc to file
+  // proc 0 pings each proc, receives its chunk, writes to file
+  // all other procs wait for ping, send their chunk to proc 0
+
+  int tmp,recvrow;
+
+  if (me == 0) {
+    MPI_Status status;
+    MPI_Request request;
+
+    fmt::print(fp,"\nAtoms Binary # {}\n\n",atom->atom_style);
+    fmt::print(fp,"{} {} {}\n",atom->natoms,ncola,ncolv);
+
+    for (int iproc = 0; iproc < nprocs; iproc++) {
+      if (iproc) {
+        MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_DOUBLE,iproc,0,world,&request);
+        MPI_Send(&tmp,0,MPI_INT,iproc,0,world);
+        MPI_Wait(&request,&status);
+        MPI_Get_count(&status,MPI_DOUBLE,&recvrow);
+        recvrow /= ncol;
+      } else recvrow = sendrow;
+
+      fwrite(&buf[0][0],sizeof(double),(bigint) recvrow*ncol,fp);
+    }
+
+    fputs("\n",fp);
+
+  } else {
+    MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
+    MPI_Rsend(&buf[0][0],sendrow*ncol,MPI_DOUBLE,0,0,world);
+  }
+
+  memory->destroy(buf);
+}
+
 /* ----------------------------------------------------------------------
    write out Velocities section of data file
 ------------------------------------------------------------------------- */
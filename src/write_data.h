@@ -36,6 +36,7 @@ class WriteData : protected Pointers {
   int pairflag;
   int coeffflag;
   int fixflag;
+  int binaryflag;
   FILE *fp;
   bigint nbonds_local,nbonds;
   bigint nangles_local,nangles;
@@ -46,6 +47,7 @@ class WriteData : protected Pointers {
   void type_arrays();
   void force_fields();
   void atoms();
+  void atoms_binary();
   void velocities();
   void bonds();
   void angles();
@@ -15,6 +15,7 @@
 #include <mpi.h>
 #include <cstring>
 #include <string>
+#include <thread>
 #include "atom.h"
 #include "atom_vec.h"
 #include "group.h"
@@ -43,6 +44,24 @@
 
 using namespace LAMMPS_NS;
 
+// serialized restart image staged for the helper I/O thread when the
+// "async" keyword is on
+// the bytes are captured via a memory stream while the procs gather,
+//   so the thread only appends the blob to the already-opened file
+//   and touches no simulation state
+
+struct WriteRestart::AsyncFrame {
+  std::thread thread;      // helper thread writing the previous image
+  FILE *realfp;            // actual restart file the blob goes to
+  char *blob;              // serialized bytes captured via memory stream
+  size_t blobsize;         // # of bytes in blob
+  int pending;             // 1 if helper thread still owns realfp
+  int ioerror;             // 1 if helper thread hit a write error
+
+  AsyncFrame() : realfp(NULL), blob(NULL), blobsize(0),
+                 pending(0), ioerror(0) {}
+};
+
 /* ---------------------------------------------------------------------- */
 
 WriteRestart::WriteRestart(LAMMPS *lmp) : Pointers(lmp)
@@ -52,6 +71,19 @@ WriteRestart::WriteRestart(LAMMPS *lmp) : Pointers(lmp)
   multiproc = 0;
   noinit = 0;
   fp = NULL;
+  asyncflag = 0;
+  async = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+WriteRestart::~WriteRestart()
+{
+  async_wait();
+  if (async) {
+    free(async->blob);
+    delete async;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -138,6 +170,7 @@ void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
 
   // defaults for multiproc file writing
 
+  deltaflag = 0;
   nclusterprocs = nprocs;
   filewriter = 0;
   if (me == 0) filewriter = 1;
@@ -198,6 +231,22 @@ void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
     } else if (strcmp(arg[iarg],"noinit") == 0) {
       noinit = 1;
       iarg++;
+    } else if (strcmp(arg[iarg],"delta") == 0) {
+      if (multiproc)
+        error->all(FLERR,"Cannot use write_restart delta "
+                   "with % in restart file name");
+      if (mpiioflag)
+        error->all(FLERR,"Cannot use write_restart delta "
+                   "with MPI-IO restart file");
+      deltaflag = 1;
+      iarg++;
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (mpiioflag)
+        error->all(FLERR,"Cannot use write_restart async "
+                   "with MPI-IO restart file");
+      asyncflag = 1;
+      if (async == NULL) async = new AsyncFrame();
+      iarg++;
     } else error->all(FLERR,"Illegal write_restart command");
   }
 }
@@ -209,6 +258,18 @@ void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
 
 void WriteRestart::write(std::string file)
 {
+  // wait for helper thread to finish the previous checkpoint before
+  // its target file and blob are reused
+
+  if (asyncflag) async_wait();
+
+  // delta mode writes only dynamic per-atom state, not a full system image
+
+  if (deltaflag) {
+    write_delta(file);
+    return;
+  }
+
   // special case where reneighboring is not done in integrator
   //   on timestep restart file is written (due to build_once being set)
   // if box is changing, must be reset, else restart file will have
@@ -303,6 +364,18 @@ void WriteRestart::write(std::string file)
     }
   }
 
+  // if async, redirect the per-atom data into a memory stream
+  // the gather below still runs inline (MPI is not called from the
+  //   helper thread), only the disk write of the image is overlapped
+
+  if (asyncflag && !mpiioflag && fp) {
+    async->realfp = fp;
+    free(async->blob);
+    async->blob = NULL;
+    async->blobsize = 0;
+    fp = open_memstream(&async->blob,&async->blobsize);
+  }
+
   // pack my atom data into buf
 
   AtomVec *avec = atom->avec;
@@ -396,6 +469,7 @@ void WriteRestart::write(std::string file)
       if (ferror(fp)) io_error = 1;
       fclose(fp);
       fp = NULL;
+      if (asyncflag) async_launch();
 
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
@@ -420,6 +494,181 @@ void WriteRestart::write(std::string file)
       modify->fix[ifix]->write_restart_file(file.c_str());
 }
 
+/* ----------------------------------------------------------------------
+   write a delta restart file with only dynamic per-atom state
+   file replays on top of a full restart file via read_restart delta option
+   holds current timestep, box, and per-atom tag/image/x/v (+ omega)
+   skips groups, force field, per-type arrays, fix state = all
+     static or slowly-varying info which the full base file provides
+   much smaller and faster than a full restart for frequent checkpoints
+------------------------------------------------------------------------- */
+
+void WriteRestart::write_delta(std::string file)
+{
+  // same box reset and atom count logic as write()
+
+  if (neighbor->build_once) domain->reset_box();
+
+  bigint nblocal = atom->nlocal;
+  MPI_Allreduce(&nblocal,&natoms,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  if (natoms != atom->natoms && output->thermo->lostflag == Thermo::ERROR)
+    error->all(FLERR,"Atom count is inconsistent, cannot write restart file");
+
+  // proc 0 opens file and writes magic string + header
+  // header = timestep, atom count, omega flag, triclinic flag, box bounds
+
+  int io_error = 0;
+
+  if (me == 0) {
+    fp = fopen(file.c_str(),"wb");
+    if (fp == NULL)
+      error->one(FLERR, fmt::format("Cannot open restart file {}: {}",
+                                    file, utils::getsyserror()));
+
+    const char magic[] = DELTA_MAGIC_STRING;
+    fwrite(magic,sizeof(char),strlen(magic)+1,fp);
+    fwrite(&update->ntimestep,sizeof(bigint),1,fp);
+    fwrite(&natoms,sizeof(bigint),1,fp);
+    int omega_flag = atom->omega_flag;
+    fwrite(&omega_flag,sizeof(int),1,fp);
+    int triclinic = domain->triclinic;
+    fwrite(&triclinic,sizeof(int),1,fp);
+    fwrite(domain->boxlo,sizeof(double),3,fp);
+    fwrite(domain->boxhi,sizeof(double),3,fp);
+    double tilt[3];
+    tilt[0] = domain->xy;
+    tilt[1] = domain->xz;
+    tilt[2] = domain->yz;
+    fwrite(tilt,sizeof(double),3,fp);
+
+    // if async, redirect the per-atom records into a memory stream
+
+    if (asyncflag) {
+      async->realfp = fp;
+      free(async->blob);
+      async->blob = NULL;
+      async->blobsize = 0;
+      fp = open_memstream(&async->blob,&async->blobsize);
+    }
+  }
+
+  // pack fixed-width per-atom records: tag, image, x, v, optionally omega
+
+  int nper = 8;
+  if (atom->omega_flag) nper += 3;
+
+  int max_size;
+  int send_size = nper * atom->nlocal;
+  MPI_Allreduce(&send_size,&max_size,1,MPI_INT,MPI_MAX,world);
+
+  double *buf;
+  memory->create(buf,MAX(1,max_size),"write_restart:buf");
+
+  tagint *tag = atom->tag;
+  imageint *image = atom->image;
+  double **x = atom->x;
+  double **v = atom->v;
+  double **omega = atom->omega;
+  int nlocal = atom->nlocal;
+
+  int m = 0;
+  for (int i = 0; i < nlocal; i++) {
+    buf[m++] = ubuf(tag[i]).d;
+    buf[m++] = ubuf(image[i]).d;
+    buf[m++] = x[i][0];
+    buf[m++] = x[i][1];
+    buf[m++] = x[i][2];
+    buf[m++] = v[i][0];
+    buf[m++] = v[i][1];
+    buf[m++] = v[i][2];
+    if (atom->omega_flag) {
+      buf[m++] = omega[i][0];
+      buf[m++] = omega[i][1];
+      buf[m++] = omega[i][2];
+    }
+  }
+
+  // proc 0 pings each proc, receives its records, writes them as one chunk
+  // chunk = int count of doubles + doubles, count of -1 terminates file
+
+  int tmp,recv_size;
+
+  if (me == 0) {
+    MPI_Status status;
+    MPI_Request request;
+    for (int iproc = 0; iproc < nprocs; iproc++) {
+      if (iproc) {
+        MPI_Irecv(buf,max_size,MPI_DOUBLE,iproc,0,world,&request);
+        MPI_Send(&tmp,0,MPI_INT,iproc,0,world);
+        MPI_Wait(&request,&status);
+        MPI_Get_count(&status,MPI_DOUBLE,&recv_size);
+      } else recv_size = send_size;
+
+      fwrite(&recv_size,sizeof(int),1,fp);
+      fwrite(buf,sizeof(double),recv_size,fp);
+    }
+
+    int last = -1;
+    fwrite(&last,sizeof(int),1,fp);
+    if (ferror(fp)) io_error = 1;
+    fclose(fp);
+    fp = NULL;
+    if (asyncflag) async_launch();
+
+  } else {
+    MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
+    MPI_Rsend(buf,send_size,MPI_DOUBLE,0,0,world);
+  }
+
+  // check for I/O error status
+
+  int io_all = 0;
+  MPI_Allreduce(&io_error,&io_all,1,MPI_INT,MPI_MAX,world);
+  if (io_all) error->all(FLERR,"I/O error while writing restart");
+
+  memory->destroy(buf);
+}
+
+/* ----------------------------------------------------------------------
+   hand the finalized blob to the helper thread
+   only called by procs that serialized into a memory stream
+------------------------------------------------------------------------- */
+
+void WriteRestart::async_launch()
+{
+  async->pending = 1;
+  async->ioerror = 0;
+  async->thread = std::thread(&WriteRestart::async_write,this);
+}
+
+/* ----------------------------------------------------------------------
+   helper thread: append blob to the restart file and close it
+------------------------------------------------------------------------- */
+
+void WriteRestart::async_write()
+{
+  if (async->blobsize)
+    if (fwrite(async->blob,1,async->blobsize,async->realfp) !=
+        async->blobsize) async->ioerror = 1;
+  if (ferror(async->realfp)) async->ioerror = 1;
+  fclose(async->realfp);
+  async->realfp = NULL;
+}
+
+/* ----------------------------------------------------------------------
+   block until the helper thread has finished the previous checkpoint
+------------------------------------------------------------------------- */
+
+void WriteRestart::async_wait()
+{
+  if (async == NULL || !async->pending) return;
+
+  async->thread.join();
+  async->pending = 0;
+  if (async->ioerror)
+    error->one(FLERR,"I/O error while writing restart");
+}
+
 /* ----------------------------------------------------------------------
    proc 0 writes out problem description
 ------------------------------------------------------------------------- */
@@ -28,6 +28,7 @@ namespace LAMMPS_NS {
 class WriteRestart : protected Pointers {
  public:
   WriteRestart(class LAMMPS *);
+  ~WriteRestart();
   void command(int, char **);
   void multiproc_options(int, int, int, char **);
   void write(std::string);
@@ -40,6 +41,7 @@ class WriteRestart : protected Pointers {
 
   int multiproc;             // 0 = proc 0 writes for all
                              // else # of procs writing files
+  int deltaflag;             // 1 = write small delta file, not full restart
   int nclusterprocs;         // # of procs in my cluster that write to one file
   int filewriter;            // 1 if this proc writes a file, else 0
   int fileproc;              // ID of proc in my cluster who writes to file
@@ -51,6 +53,18 @@ class WriteRestart : protected Pointers {
   class RestartMPIIO *mpiio;   // MPIIO for restart file output
   MPI_Offset headerOffset;
 
+  // helper-thread state for the "async" keyword
+
+  int asyncflag;             // 1 if blob bytes written by helper thread
+  struct AsyncFrame;
+  AsyncFrame *async;
+
+  void async_launch();
+  void async_write();
+  void async_wait();
+
+  void write_delta(std::string);
+
   void header();
   void type_arrays();
   void force_fields();
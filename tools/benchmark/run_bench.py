@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+# run the standard decks in bench/ across rank/thread sweeps, collect the
+# timing breakdown printed at the end of each run into machine-readable
+# JSON, and optionally compare loop times against a stored baseline
+#
+# typical usage:
+#   run_bench.py --exe /path/to/lmp --ranks 1,4 --output results.json
+#   run_bench.py --exe /path/to/lmp --scaled --ranks 1,8
+#   run_bench.py --exe /path/to/lmp --baseline results.json --tolerance 0.05
+#
+# fixed-size runs use the in.<deck> inputs unchanged; --scaled multiplies
+# the x/y/z replication variables by a near-cubic factorization of the
+# rank count, matching how the in.*.scaled decks are meant to be driven
+
+from __future__ import print_function
+
+import argparse
+import datetime
+import json
+import os
+import re
+import subprocess
+import sys
+
+DECKS = ["lj", "chain", "eam", "chute", "rhodo"]
+
+# deck -> input file for fixed and scaled runs
+# lj and eam have no separate .scaled deck; their plain inputs already
+# take x/y/z replication variables
+
+FIXED_INPUT = {d: "in." + d for d in DECKS}
+SCALED_INPUT = {
+    "lj": "in.lj",
+    "eam": "in.eam",
+    "chain": "in.chain.scaled",
+    "chute": "in.chute.scaled",
+    "rhodo": "in.rhodo.scaled",
+}
+
+LOOP_RE = re.compile(
+    r"Loop time of ([0-9.eE+-]+) on (\d+) procs "
+    r"for (\d+) steps with (\d+) atoms")
+PERF_RE = re.compile(r"Performance: (.*)")
+SECTION_RE = re.compile(
+    r"^(Pair|Bond|Kspace|Neigh|Comm|Output|Modify|Sync|Other)\s*\|"
+    r"\s*([0-9.eE+-]*)\s*\|\s*([0-9.eE+-]+)\s*\|\s*([0-9.eE+-]*)\s*\|")
+
+
+def near_cubic_factors(n):
+    """factor n into (x,y,z) with x <= y <= z as close to cubic as possible"""
+    best = (1, 1, n)
+    for x in range(1, int(round(n ** (1.0 / 3.0))) + 2):
+        if n % x:
+            continue
+        m = n // x
+        for y in range(x, int(round(m ** 0.5)) + 2):
+            if m % y:
+                continue
+            z = m // y
+            if z < y:
+                continue
+            if max(x, y, z) - min(x, y, z) < max(best) - min(best):
+                best = (x, y, z)
+    return best
+
+
+def parse_log(text):
+    """extract loop time, performance, and breakdown from run output"""
+    result = {}
+    m = LOOP_RE.search(text)
+    if not m:
+        return None
+    result["loop_time"] = float(m.group(1))
+    result["procs"] = int(m.group(2))
+    result["steps"] = int(m.group(3))
+    result["natoms"] = int(m.group(4))
+    m = PERF_RE.search(text)
+    if m:
+        result["performance"] = m.group(1).strip()
+    sections = {}
+    for line in text.splitlines():
+        m = SECTION_RE.match(line)
+        if m:
+            name = m.group(1)
+            sections[name] = {
+                "min": float(m.group(2)) if m.group(2) else None,
+                "avg": float(m.group(3)),
+                "max": float(m.group(4)) if m.group(4) else None,
+            }
+    result["sections"] = sections
+    return result
+
+
+def run_one(args, deck, ranks, threads, scaled):
+    infile = (SCALED_INPUT if scaled else FIXED_INPUT)[deck]
+    cmd = []
+    if ranks > 1 or args.always_mpi:
+        cmd += args.mpiexec.split() + [args.np_flag, str(ranks)]
+    cmd += [args.exe, "-in", infile, "-log", "none"]
+    scale = (1, 1, 1)
+    if scaled:
+        scale = near_cubic_factors(ranks)
+        for var, val in zip(("x", "y", "z"), scale):
+            cmd += ["-var", var, str(val)]
+    env = dict(os.environ)
+    env["OMP_NUM_THREADS"] = str(threads)
+    if args.suffix:
+        cmd += ["-sf", args.suffix]
+
+    key = "%s ranks=%d threads=%d scaled=%d" % (deck, ranks, threads, scaled)
+    print("running:", " ".join(cmd))
+    best = None
+    for _ in range(args.repeat):
+        try:
+            out = subprocess.check_output(cmd, cwd=args.bench_dir, env=env,
+                                          stderr=subprocess.STDOUT)
+        except subprocess.CalledProcessError as err:
+            print("FAILED:", key)
+            print(err.output.decode(errors="replace"))
+            return None
+        parsed = parse_log(out.decode(errors="replace"))
+        if parsed is None:
+            print("FAILED to parse output of:", key)
+            return None
+        if best is None or parsed["loop_time"] < best["loop_time"]:
+            best = parsed
+    best.update(deck=deck, ranks=ranks, threads=threads,
+                scaled=int(scaled), scale=list(scale))
+    print("  loop time %g s on %d procs, %d atoms"
+          % (best["loop_time"], best["procs"], best["natoms"]))
+    return best
+
+
+def run_key(run):
+    return (run["deck"], run["ranks"], run["threads"], run["scaled"])
+
+
+def compare(results, baseline, tolerance):
+    """return number of regressions of loop time vs. the baseline"""
+    base = {tuple(run_key(r)): r for r in baseline["runs"]}
+    regressions = 0
+    for run in results["runs"]:
+        ref = base.get(tuple(run_key(run)))
+        if ref is None:
+            print("no baseline for", run_key(run))
+            continue
+        ratio = run["loop_time"] / ref["loop_time"]
+        status = "ok"
+        if ratio > 1.0 + tolerance:
+            status = "REGRESSION"
+            regressions += 1
+        print("%-32s %10.4g s vs %10.4g s  (%+.1f%%)  %s"
+              % ("%s/%d ranks/%d threads%s"
+                 % (run["deck"], run["ranks"], run["threads"],
+                    "/scaled" if run["scaled"] else ""),
+                 run["loop_time"], ref["loop_time"],
+                 100.0 * (ratio - 1.0), status))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="run bench/ decks over rank/thread sweeps, "
+        "emit JSON, diff against a baseline")
+    parser.add_argument("--exe", required=True, help="LAMMPS executable")
+    parser.add_argument("--bench-dir", default=os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), "..", "..", "bench"))
+    parser.add_argument("--decks", default=",".join(DECKS),
+                        help="comma-separated deck list (default: all)")
+    parser.add_argument("--ranks", default="1",
+                        help="comma-separated MPI rank counts")
+    parser.add_argument("--threads", default="1",
+                        help="comma-separated thread counts")
+    parser.add_argument("--scaled", action="store_true",
+                        help="size-scale decks with the rank count")
+    parser.add_argument("--mpiexec", default="mpirun")
+    parser.add_argument("--np-flag", default="-np")
+    parser.add_argument("--always-mpi", action="store_true",
+                        help="launch through mpiexec even for 1 rank")
+    parser.add_argument("--suffix", default="",
+                        help="pass -sf SUFFIX to LAMMPS (e.g. omp, intel)")
+    parser.add_argument("--repeat", type=int, default=1,
+                        help="repetitions per point, minimum is kept")
+    parser.add_argument("--output", default="",
+                        help="write results to this JSON file")
+    parser.add_argument("--baseline", default="",
+                        help="JSON file with results to compare against")
+    parser.add_argument("--tolerance", type=float, default=0.05,
+                        help="allowed fractional loop-time increase")
+    args = parser.parse_args()
+
+    decks = [d.strip() for d in args.decks.split(",") if d.strip()]
+    for d in decks:
+        if d not in DECKS:
+            parser.error("unknown deck: " + d)
+
+    results = {
+        "date": datetime.datetime.now().isoformat(),
+        "exe": os.path.abspath(args.exe),
+        "runs": [],
+    }
+
+    failed = 0
+    for deck in decks:
+        for ranks in [int(r) for r in args.ranks.split(",")]:
+            for threads in [int(t) for t in args.threads.split(",")]:
+                run = run_one(args, deck, ranks, threads, args.scaled)
+                if run is None:
+                    failed += 1
+                else:
+                    results["runs"].append(run)
+
+    if args.output:
+        with open(args.output, "w") as fp:
+            json.dump(results, fp, indent=2, sort_keys=True)
+            fp.write("\n")
+        print("wrote", args.output)
+
+    regressions = 0
+    if args.baseline:
+        with open(args.baseline) as fp:
+            baseline = json.load(fp)
+        regressions = compare(results, baseline, args.tolerance)
+
+    if failed or regressions:
+        print("%d failed runs, %d regressions" % (failed, regressions))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
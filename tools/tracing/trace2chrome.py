@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# convert per-rank trace files written by the LAMMPS "timer trace" option
+# into JSON loadable by chrome://tracing or https://ui.perfetto.dev
+#
+# usage: trace2chrome.py tracebase [tracebase2 ...] > timeline.json
+#        trace2chrome.py -o timeline.json tracebase
+#
+# each argument is the base name given to "timer trace"; all files named
+# <base>.<rank> are merged into one timeline with one row per rank.
+# timestamps are shifted so the earliest event across all ranks is zero.
+
+from __future__ import print_function
+
+import argparse
+import glob
+import json
+import struct
+import sys
+
+# names for the timer category enum in src/timer.h, in order
+
+CATEGORY = ["Total", "Pair", "Bond", "Kspace", "Neigh", "Comm", "Modify",
+            "Output", "Sync", "All", "Dephase", "Dynamics", "Quench",
+            "NEB", "RepComm", "RepOut"]
+
+RECORD = struct.Struct("=idd")
+
+
+def read_trace(fname):
+    """read one per-rank trace file, return (rank, [(which,start,stop)])"""
+    with open(fname, "rb") as fp:
+        header = fp.readline().split()
+        if len(header) != 3 or header[0] != b"LMPTRACE":
+            raise ValueError(fname + ": not a LAMMPS trace file")
+        if int(header[1]) != 1:
+            raise ValueError(fname + ": unsupported trace version")
+        rank = int(header[2])
+        events = []
+        while True:
+            buf = fp.read(RECORD.size)
+            if len(buf) < RECORD.size:
+                break
+            events.append(RECORD.unpack(buf))
+    return rank, events
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="merge LAMMPS timer trace files into chrome tracing JSON")
+    parser.add_argument("base", nargs="+",
+                        help="base name passed to the timer trace option")
+    parser.add_argument("-o", "--output", default="",
+                        help="output file (default: stdout)")
+    args = parser.parse_args()
+
+    files = []
+    for base in args.base:
+        found = sorted(glob.glob(base + ".[0-9]*"))
+        if not found:
+            print("no trace files match", base + ".*", file=sys.stderr)
+            return 1
+        files += found
+
+    ranks = [read_trace(f) for f in files]
+
+    t0 = min(ev[1] for _, events in ranks for ev in events if events)
+
+    trace = []
+    for rank, events in ranks:
+        for which, start, stop in events:
+            name = CATEGORY[which] if 0 <= which < len(CATEGORY) else str(which)
+            trace.append({
+                "name": name,
+                "cat": "lammps",
+                "ph": "X",
+                "ts": (start - t0) * 1.0e6,
+                "dur": (stop - start) * 1.0e6,
+                "pid": 0,
+                "tid": rank,
+            })
+
+    out = {"traceEvents": trace, "displayTimeUnit": "ms"}
+    if args.output:
+        with open(args.output, "w") as fp:
+            json.dump(out, fp)
+        print("wrote %d events from %d ranks to %s"
+              % (len(trace), len(ranks), args.output), file=sys.stderr)
+    else:
+        json.dump(out, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
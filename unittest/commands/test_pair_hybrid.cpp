@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "atom.h"
+#include "force.h"
+#include "info.h"
+#include "input.h"
+#include "lammps.h"
+#include "pair.h"
+#include "utils.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <mpi.h>
+
+// whether to print verbose output (i.e. not capturing LAMMPS screen output).
+bool verbose = false;
+
+using LAMMPS_NS::utils::split_words;
+
+namespace LAMMPS_NS {
+
+class PairHybridFusedTest : public ::testing::Test {
+protected:
+    LAMMPS *lmp;
+
+    void SetUp() override
+    {
+        const char *args[] = {"PairHybridFusedTest", "-log", "none", "-nocite"};
+        char **argv        = (char **)args;
+        int argc           = sizeof(args) / sizeof(char *);
+        if (!verbose) ::testing::internal::CaptureStdout();
+        lmp = new LAMMPS(argc, argv, MPI_COMM_WORLD);
+        lmp->input->one("units lj");
+        lmp->input->one("atom_style atomic");
+        lmp->input->one("atom_modify map array");
+        lmp->input->one("lattice fcc 0.8442");
+        lmp->input->one("region box block 0 2 0 2 0 2");
+        lmp->input->one("create_box 2 box");
+        lmp->input->one("create_atoms 1 box");
+        lmp->input->one("set group all type/fraction 2 0.5 12345");
+        lmp->input->one("mass * 1.0");
+        lmp->input->one("velocity all create 1.44 87287");
+        lmp->input->one("pair_style hybrid lj/cut 2.5 lj/cut 2.0");
+        lmp->input->one("pair_coeff 1 1 lj/cut 1 1.0 1.0");
+        lmp->input->one("pair_coeff 1 2 lj/cut 1 1.0 1.0");
+        lmp->input->one("pair_coeff 2 2 lj/cut 2 1.0 0.9");
+        lmp->input->one("fix 1 all nve");
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+    }
+
+    void TearDown() override
+    {
+        if (!verbose) ::testing::internal::CaptureStdout();
+        delete lmp;
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+    }
+};
+
+TEST_F(PairHybridFusedTest, FusedMatchesRegular)
+{
+    // reference: regular sub-style sweeps
+
+    if (!verbose) ::testing::internal::CaptureStdout();
+    lmp->input->one("run 2 post no");
+    if (!verbose) ::testing::internal::GetCapturedStdout();
+
+    double eng_regular = lmp->force->pair->eng_vdwl;
+    int idx            = lmp->atom->map(1);
+    ASSERT_GE(idx, 0);
+    double fx = lmp->atom->f[idx][0];
+    double fy = lmp->atom->f[idx][1];
+    double fz = lmp->atom->f[idx][2];
+
+    // fused one-sweep dispatch must reproduce energy and forces
+    // exercises build_fused_table() in setup and compute_fused() in run
+
+    if (!verbose) ::testing::internal::CaptureStdout();
+    lmp->input->one("pair_modify fused yes");
+    lmp->input->one("run 0 post no");
+    if (!verbose) ::testing::internal::GetCapturedStdout();
+
+    EXPECT_NEAR(eng_regular, lmp->force->pair->eng_vdwl, 1.0e-12);
+    idx = lmp->atom->map(1);
+    ASSERT_GE(idx, 0);
+    EXPECT_NEAR(fx, lmp->atom->f[idx][0], 1.0e-12);
+    EXPECT_NEAR(fy, lmp->atom->f[idx][1], 1.0e-12);
+    EXPECT_NEAR(fz, lmp->atom->f[idx][2], 1.0e-12);
+
+    // and a fused dynamics run must get through setup and steps
+
+    if (!verbose) ::testing::internal::CaptureStdout();
+    lmp->input->one("run 2 post no");
+    if (!verbose) ::testing::internal::GetCapturedStdout();
+}
+
+} // namespace LAMMPS_NS
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleMock(&argc, argv);
+
+    // handle arguments passed via environment variable
+    if (const char *var = getenv("TEST_ARGS")) {
+        std::vector<std::string> env = split_words(var);
+        for (auto arg : env) {
+            if (arg == "-v") {
+                verbose = true;
+            }
+        }
+    }
+
+    if ((argc > 1) && (strcmp(argv[1], "-v") == 0)) verbose = true;
+
+    int rv = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return rv;
+}
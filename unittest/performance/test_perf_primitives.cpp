@@ -0,0 +1,294 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+// micro-benchmarks for hot primitives with timing assertions.
+//
+// each benchmark is timed relative to a fixed arithmetic calibration
+// kernel run on the same machine, so the committed baselines are
+// dimensionless ratios instead of absolute seconds and transfer between
+// machines of similar architecture.  baselines live in
+// baselines/<profile>.txt where <profile> is taken from the
+// LAMMPS_PERF_PROFILE environment variable (default "default").
+// benchmarks without a baseline entry are skipped.  set
+// LAMMPS_PERF_RECORD=1 to print measured ratios in baseline file format
+// instead of asserting, e.g. to record a new machine profile.
+//
+// run via: ctest -L performance
+
+#include "atom.h"
+#include "atom_vec.h"
+#include "force.h"
+#include "info.h"
+#include "input.h"
+#include "kspace.h"
+#include "lammps.h"
+#include "neighbor.h"
+#include "utils.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mpi.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// whether to print verbose output (i.e. not capturing LAMMPS screen output).
+bool verbose = false;
+
+#if defined(OMPI_MAJOR_VERSION)
+const bool have_openmpi = true;
+#else
+const bool have_openmpi = false;
+#endif
+
+using LAMMPS_NS::utils::split_words;
+
+#define XSTR(val) #val
+#define STRINGIFY(val) XSTR(val)
+
+namespace LAMMPS_NS {
+
+static double now()
+{
+    return std::chrono::duration<double>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/* ----------------------------------------------------------------------
+   fixed floating point kernel used as the unit of time.  volatile sink
+   keeps the compiler from deleting the loop.
+------------------------------------------------------------------------- */
+
+static double calibrate()
+{
+    static double cached = -1.0;
+    if (cached > 0.0) return cached;
+
+    std::vector<double> v(65536, 1.0);
+    double best = 1.0e30;
+    for (int trial = 0; trial < 3; ++trial) {
+        double start = now();
+        for (int rep = 0; rep < 400; ++rep)
+            for (std::size_t i = 0; i < v.size(); ++i)
+                v[i] = v[i] * 1.0000000001 + 1.0e-12;
+        best = std::min(best, now() - start);
+    }
+    volatile double sink = v[0];
+    (void)sink;
+    cached = best;
+    return cached;
+}
+
+/* ----------------------------------------------------------------------
+   median wall time of nrepeat invocations, in units of the calibration
+   kernel time
+------------------------------------------------------------------------- */
+
+static double bench_ratio(const std::function<void()> &body, int nrepeat = 5)
+{
+    std::vector<double> times;
+    for (int i = 0; i < nrepeat; ++i) {
+        double start = now();
+        body();
+        times.push_back(now() - start);
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2] / calibrate();
+}
+
+/* ----------------------------------------------------------------------
+   baseline file: one "<benchmark> <ratio> [<tolerance>]" entry per line,
+   '#' starts a comment.  tolerance is a multiplicative slack factor.
+------------------------------------------------------------------------- */
+
+struct Baseline {
+    double ratio;
+    double tolerance;
+};
+
+static std::map<std::string, Baseline> load_baselines()
+{
+    std::map<std::string, Baseline> baselines;
+    const char *profile = getenv("LAMMPS_PERF_PROFILE");
+    if (!profile) profile = "default";
+    std::string fname = std::string(STRINGIFY(TEST_BASELINE_FOLDER)) + "/" + profile + ".txt";
+    std::ifstream in(fname.c_str());
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string::size_type hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        std::istringstream values(line);
+        std::string name;
+        Baseline entry;
+        entry.tolerance = 2.0;
+        if (values >> name >> entry.ratio) {
+            values >> entry.tolerance;
+            baselines[name] = entry;
+        }
+    }
+    return baselines;
+}
+
+class PerformanceTest : public ::testing::Test {
+protected:
+    LAMMPS *lmp;
+
+    void SetUp() override
+    {
+        const char *args[] = {"PerformanceTest", "-log", "none", "-echo", "none", "-nocite"};
+        char **argv        = (char **)args;
+        int argc           = sizeof(args) / sizeof(char *);
+        if (!verbose) ::testing::internal::CaptureStdout();
+        lmp = new LAMMPS(argc, argv, MPI_COMM_WORLD);
+
+        // canned lj melt configuration, 4000 atoms
+
+        lmp->input->one("units lj");
+        lmp->input->one("atom_style charge");
+        lmp->input->one("lattice fcc 0.8442");
+        lmp->input->one("region box block 0 10 0 10 0 10");
+        lmp->input->one("create_box 1 box");
+        lmp->input->one("create_atoms 1 box");
+        lmp->input->one("mass 1 1.0");
+        lmp->input->one("velocity all create 1.44 87287");
+        lmp->input->one("pair_style lj/cut 2.5");
+        lmp->input->one("pair_coeff 1 1 1.0 1.0");
+        lmp->input->one("neighbor 0.3 bin");
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+    }
+
+    void TearDown() override
+    {
+        if (!verbose) ::testing::internal::CaptureStdout();
+        delete lmp;
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+    }
+
+    void run_setup(const char *extra = nullptr)
+    {
+        if (!verbose) ::testing::internal::CaptureStdout();
+        if (extra) lmp->input->one(extra);
+        lmp->input->one("run 0 post no");
+        if (!verbose) ::testing::internal::GetCapturedStdout();
+    }
+
+    // time body and compare against the committed baseline for name
+
+    void check(const std::string &name, const std::function<void()> &body)
+    {
+        double ratio = bench_ratio(body);
+        if (getenv("LAMMPS_PERF_RECORD")) {
+            printf("%s %.4g\n", name.c_str(), ratio);
+            GTEST_SKIP();
+        }
+        std::map<std::string, Baseline> baselines = load_baselines();
+        if (baselines.count(name) == 0) GTEST_SKIP();
+        const Baseline &ref = baselines[name];
+        EXPECT_LE(ratio, ref.ratio * ref.tolerance)
+            << name << " slowed down: measured ratio " << ratio << " vs baseline " << ref.ratio
+            << " (tolerance x" << ref.tolerance << ")";
+    }
+};
+
+TEST_F(PerformanceTest, NeighborBuild)
+{
+    run_setup();
+    check("neighbor_build", [&]() { lmp->neighbor->build(1); });
+}
+
+TEST_F(PerformanceTest, AtomVecPackComm)
+{
+    run_setup();
+    AtomVec *avec = lmp->atom->avec;
+    const int n   = lmp->atom->nlocal;
+    std::vector<int> list(n);
+    for (int i = 0; i < n; ++i)
+        list[i] = i;
+    std::vector<double> buf((std::size_t)n * avec->size_forward);
+    int pbc[6] = {0, 0, 0, 0, 0, 0};
+    check("atomvec_pack_comm", [&]() {
+        avec->pack_comm(n, list.data(), buf.data(), 0, pbc);
+        avec->unpack_comm(n, 0, buf.data());
+    });
+}
+
+TEST_F(PerformanceTest, AtomVecPackBorder)
+{
+    run_setup();
+    AtomVec *avec = lmp->atom->avec;
+    const int n   = lmp->atom->nlocal;
+    std::vector<int> list(n);
+    for (int i = 0; i < n; ++i)
+        list[i] = i;
+    std::vector<double> buf((std::size_t)n * avec->size_border);
+    int pbc[6] = {0, 0, 0, 0, 0, 0};
+    check("atomvec_pack_border", [&]() { avec->pack_border(n, list.data(), buf.data(), 0, pbc); });
+}
+
+TEST_F(PerformanceTest, PppmCompute)
+{
+    if (!LAMMPS::is_installed_pkg("KSPACE")) GTEST_SKIP();
+
+    // alternate +1/-1 charges by atom id so the system stays neutral
+
+    if (!verbose) ::testing::internal::CaptureStdout();
+    lmp->input->one("variable q atom 2.0*(id%2)-1.0");
+    lmp->input->one("set group all charge v_q");
+    lmp->input->one("pair_style lj/cut/coul/long 2.5");
+    lmp->input->one("pair_coeff 1 1 1.0 1.0");
+    lmp->input->one("kspace_style pppm 1.0e-4");
+    if (!verbose) ::testing::internal::GetCapturedStdout();
+    run_setup();
+
+    // covers make_rho, the poisson solve, and fieldforce on a fixed grid
+
+    KSpace *kspace = lmp->force->kspace;
+    check("pppm_compute", [&]() { kspace->compute(0, 0); });
+}
+
+} // namespace LAMMPS_NS
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleMock(&argc, argv);
+
+    if (have_openmpi && !LAMMPS_NS::Info::has_exceptions())
+        std::cout << "Warning: using OpenMPI without exceptions. "
+                     "Death tests will be skipped\n";
+
+    // handle arguments passed via environment variable
+    if (const char *var = getenv("TEST_ARGS")) {
+        std::vector<std::string> env = split_words(var);
+        for (auto arg : env) {
+            if (arg == "-v") {
+                verbose = true;
+            }
+        }
+    }
+
+    if ((argc > 1) && (strcmp(argv[1], "-v") == 0)) verbose = true;
+
+    int result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}